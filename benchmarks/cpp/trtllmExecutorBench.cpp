@@ -0,0 +1,401 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// End-to-end serving benchmark that replays a recorded arrival trace against the executor API.
+// Unlike gptManagerBenchmark, which synthesizes arrivals from a request rate, this harness
+// reproduces the exact arrival process of a production trace (one JSON object per line with
+// "timestamp_ms", "input_ids" or "input_len", "output_len" and optional per-request sampling
+// parameters) and reports TTFT / inter-token latency / end-to-end latency percentiles and
+// throughput as machine-readable JSON.
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/types.h"
+#include "tensorrt_llm/plugins/api/tllmPlugin.h"
+#include "tensorrt_llm/runtime/common.h"
+#include "tensorrt_llm/runtime/tllmLogger.h"
+#include "utils/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cxxopts.hpp>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace tensorrt_llm::runtime;
+using namespace tensorrt_llm::benchmark;
+namespace texec = tensorrt_llm::executor;
+namespace fs = std::filesystem;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+using TimePoint = Clock::time_point;
+
+struct TraceRequest
+{
+    double timestampMs;
+    std::vector<texec::TokenIdType> inputIds;
+    SizeType32 outputLen;
+    texec::SamplingConfig samplingConfig;
+};
+
+std::vector<TraceRequest> parseArrivalTrace(
+    fs::path const& tracePath, SizeType32 beamWidth, std::optional<int> maxNumRequests)
+{
+    TLLM_CHECK_WITH_INFO(fs::exists(tracePath), "Arrival trace file does not exist: %s", tracePath.string().c_str());
+    std::ifstream traceFile(tracePath);
+    TLLM_CHECK_WITH_INFO(traceFile.good(), "Failed to open arrival trace: %s", tracePath.string().c_str());
+
+    std::vector<TraceRequest> requests;
+    std::string line;
+    while (std::getline(traceFile, line))
+    {
+        if (line.empty())
+        {
+            continue;
+        }
+        auto const entry = nlohmann::json::parse(line);
+
+        TraceRequest request;
+        request.timestampMs = entry.at("timestamp_ms").template get<double>();
+        if (entry.contains("input_ids"))
+        {
+            request.inputIds = entry.at("input_ids").template get<std::vector<texec::TokenIdType>>();
+        }
+        else
+        {
+            // Traces recorded without token ids only carry lengths; the ids do not matter for
+            // scheduler benchmarking as long as they do not hit the KV cache reuse path.
+            auto const inputLen = entry.at("input_len").template get<SizeType32>();
+            request.inputIds.resize(inputLen);
+            for (SizeType32 ti = 0; ti < inputLen; ++ti)
+            {
+                request.inputIds[ti] = 100 + ((static_cast<SizeType32>(requests.size()) + ti) % 1000);
+            }
+        }
+        request.outputLen = entry.at("output_len").template get<SizeType32>();
+
+        auto samplingConfig = texec::SamplingConfig(beamWidth);
+        if (entry.contains("temperature"))
+        {
+            samplingConfig.setTemperature(entry.at("temperature").template get<float>());
+        }
+        if (entry.contains("top_k"))
+        {
+            samplingConfig.setTopK(entry.at("top_k").template get<SizeType32>());
+        }
+        if (entry.contains("top_p"))
+        {
+            samplingConfig.setTopP(entry.at("top_p").template get<float>());
+        }
+        request.samplingConfig = samplingConfig;
+
+        requests.emplace_back(std::move(request));
+        if (maxNumRequests && static_cast<int>(requests.size()) >= maxNumRequests.value())
+        {
+            break;
+        }
+    }
+    TLLM_CHECK_WITH_INFO(!requests.empty(), "Arrival trace is empty: %s", tracePath.string().c_str());
+    TLLM_CHECK_WITH_INFO(std::is_sorted(requests.begin(), requests.end(),
+                             [](auto const& lh, auto const& rh) { return lh.timestampMs < rh.timestampMs; }),
+        "Arrival trace must be sorted by timestamp_ms");
+    return requests;
+}
+
+class TraceRecorder
+{
+public:
+    //! Enqueue under the recorder lock so the response thread cannot observe a request id before
+    //! its bookkeeping entry exists.
+    texec::IdType enqueue(texec::Executor& executor, texec::Request&& request, SizeType32 inputLen)
+    {
+        std::scoped_lock<std::mutex> lock(mMutex);
+        auto const enqueueTime = Clock::now();
+        auto const requestId = executor.enqueueRequest(std::move(request));
+        mRequestInfo[requestId] = RequestInfo{enqueueTime, {}, {}, inputLen, 0};
+        return requestId;
+    }
+
+    void recordResponse(texec::Response const& response, TimePoint responseTime)
+    {
+        std::scoped_lock<std::mutex> lock(mMutex);
+        if (response.hasError())
+        {
+            ++mNumErrors;
+            return;
+        }
+        auto& info = mRequestInfo.at(response.getRequestId());
+        auto const& result = response.getResult();
+        if (!info.firstTokenTime)
+        {
+            info.firstTokenTime = responseTime;
+        }
+        else
+        {
+            mInterTokenLatencies.mDataTimes.push_back(toMs(responseTime - info.lastTokenTime.value()));
+        }
+        info.lastTokenTime = responseTime;
+        for (auto const& beamTokens : result.outputTokenIds)
+        {
+            info.numOutputTokens += static_cast<SizeType32>(beamTokens.size());
+        }
+        if (result.isFinal)
+        {
+            mFirstTokenLatencies.mDataTimes.push_back(toMs(info.firstTokenTime.value() - info.enqueueTime));
+            mSequenceLatencies.mDataTimes.push_back(toMs(responseTime - info.enqueueTime));
+            mTotalOutputTokens += info.numOutputTokens;
+            mTotalInputTokens += info.inputLen;
+        }
+    }
+
+    void calculate(TimePoint benchmarkStart, TimePoint benchmarkEnd)
+    {
+        mDurationSec = std::chrono::duration<double>(benchmarkEnd - benchmarkStart).count();
+        mFirstTokenLatencies.calculate();
+        mSequenceLatencies.calculate();
+        if (!mInterTokenLatencies.mDataTimes.empty())
+        {
+            mInterTokenLatencies.calculate();
+        }
+    }
+
+    void report() const
+    {
+        printf("[BENCHMARK] num_requests %zu\n", mRequestInfo.size());
+        printf("[BENCHMARK] num_errors %d\n", mNumErrors);
+        printf("[BENCHMARK] duration(s) %.2f\n", mDurationSec);
+        printf("[BENCHMARK] request_throughput(req/sec) %.2f\n", mRequestInfo.size() / mDurationSec);
+        printf("[BENCHMARK] token_throughput(tokens/sec) %.2f\n\n", mTotalOutputTokens / mDurationSec);
+        mFirstTokenLatencies.report();
+        if (!mInterTokenLatencies.mDataTimes.empty())
+        {
+            mInterTokenLatencies.report();
+        }
+        mSequenceLatencies.report();
+    }
+
+    void writeJson(fs::path const& outputPath) const
+    {
+        auto const metricToJson = [](RecordTimeMetric const& metric)
+        {
+            return nlohmann::json{{"avg", metric.mAvg}, {"p50", metric.mP50}, {"p90", metric.mP90},
+                {"p99", metric.mP99}, {"min", metric.mMin}, {"max", metric.mMax}};
+        };
+        nlohmann::json results;
+        results["num_requests"] = mRequestInfo.size();
+        results["num_errors"] = mNumErrors;
+        results["duration_sec"] = mDurationSec;
+        results["request_throughput_per_sec"] = mRequestInfo.size() / mDurationSec;
+        results["token_throughput_per_sec"] = mTotalOutputTokens / mDurationSec;
+        results["total_input_tokens"] = mTotalInputTokens;
+        results["total_output_tokens"] = mTotalOutputTokens;
+        results["time_to_first_token_ms"] = metricToJson(mFirstTokenLatencies);
+        if (!mInterTokenLatencies.mDataTimes.empty())
+        {
+            results["inter_token_latency_ms"] = metricToJson(mInterTokenLatencies);
+        }
+        results["sequence_latency_ms"] = metricToJson(mSequenceLatencies);
+
+        std::ofstream outputFile(outputPath);
+        TLLM_CHECK_WITH_INFO(outputFile.good(), "Failed to open output file: %s", outputPath.string().c_str());
+        outputFile << results.dump(4) << std::endl;
+        TLLM_LOG_INFO("Wrote benchmark results to %s", outputPath.string().c_str());
+    }
+
+private:
+    struct RequestInfo
+    {
+        TimePoint enqueueTime;
+        std::optional<TimePoint> firstTokenTime;
+        std::optional<TimePoint> lastTokenTime;
+        SizeType32 inputLen;
+        SizeType32 numOutputTokens;
+    };
+
+    static float toMs(Clock::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+
+    std::mutex mMutex;
+    std::unordered_map<texec::IdType, RequestInfo> mRequestInfo;
+    RecordTimeMetric mFirstTokenLatencies{"time_to_first_token"};
+    RecordTimeMetric mInterTokenLatencies{"inter_token_latency"};
+    RecordTimeMetric mSequenceLatencies{"sequence_latency"};
+    int64_t mTotalOutputTokens{0};
+    int64_t mTotalInputTokens{0};
+    int mNumErrors{0};
+    double mDurationSec{0.};
+};
+
+void replayTrace(texec::Executor& executor, std::vector<TraceRequest> const& traceRequests, double timeScale,
+    bool streaming, TraceRecorder& recorder)
+{
+    auto const benchmarkStart = Clock::now();
+
+    // Collect responses on a separate thread so a slow consumer never delays the arrival process.
+    std::atomic<size_t> numFinished{0};
+    auto responseThread = std::thread(
+        [&]()
+        {
+            while (numFinished < traceRequests.size())
+            {
+                auto const responses = executor.awaitResponses(std::chrono::milliseconds{10});
+                auto const responseTime = Clock::now();
+                for (auto const& response : responses)
+                {
+                    if (response.hasError() || response.getResult().isFinal)
+                    {
+                        ++numFinished;
+                    }
+                    recorder.recordResponse(response, responseTime);
+                }
+            }
+        });
+
+    for (auto const& traceRequest : traceRequests)
+    {
+        auto const arrivalTime
+            = benchmarkStart + std::chrono::duration_cast<Clock::duration>(
+                                   std::chrono::duration<double, std::milli>(traceRequest.timestampMs * timeScale));
+        std::this_thread::sleep_until(arrivalTime);
+
+        texec::Request request(traceRequest.inputIds, traceRequest.outputLen, streaming, traceRequest.samplingConfig);
+        recorder.enqueue(executor, std::move(request), static_cast<SizeType32>(traceRequest.inputIds.size()));
+    }
+
+    responseThread.join();
+    recorder.calculate(benchmarkStart, Clock::now());
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    cxxopts::Options options(
+        "trtllmExecutorBench", "Replay a recorded arrival trace against the executor and measure serving latencies.");
+    options.add_options()("h,help", "Print usage");
+    options.add_options()("engine_dir", "Directory that stores the engine.", cxxopts::value<std::string>());
+    options.add_options()("trace",
+        "Arrival trace with one JSON object per line: timestamp_ms, input_ids or input_len, output_len and optional "
+        "temperature/top_k/top_p.",
+        cxxopts::value<std::string>());
+    options.add_options()(
+        "output_json", "Write machine-readable results to this file.", cxxopts::value<std::string>()->default_value(""));
+    options.add_options()(
+        "max_num_requests", "Replay at most this many trace entries.", cxxopts::value<int>()->default_value("-1"));
+    options.add_options()("time_scale", "Scale factor applied to trace timestamps; 0 replays with no delays.",
+        cxxopts::value<double>()->default_value("1.0"));
+    options.add_options()(
+        "beam_width", "Beam width of the replayed requests.", cxxopts::value<int>()->default_value("1"));
+    options.add_options()("streaming", "Stream tokens back as they are produced; required for inter-token latencies.",
+        cxxopts::value<bool>()->default_value("true"));
+    options.add_options()(
+        "warm_up", "Number of leading trace entries replayed untimed.", cxxopts::value<int>()->default_value("2"));
+    options.add_options()("kv_cache_free_gpu_mem_fraction", "K-V Cache Free Gpu Mem Fraction.",
+        cxxopts::value<float>()->default_value("0.9"));
+    options.add_options()(
+        "enable_chunked_context", "Whether to enable context chunking.", cxxopts::value<bool>()->default_value("true"));
+    options.add_options()("max_batch_size", "Cap the runtime batch size.", cxxopts::value<int>());
+    options.add_options()("max_num_tokens", "Cap the runtime token budget.", cxxopts::value<int>());
+
+    auto result = options.parse(argc, argv);
+    if (result.count("help"))
+    {
+        std::cout << options.help() << std::endl;
+        return 0;
+    }
+    TLLM_CHECK_WITH_INFO(result.count("engine_dir"), "engine_dir is required");
+    TLLM_CHECK_WITH_INFO(result.count("trace"), "trace is required");
+
+    auto logger = std::make_shared<TllmLogger>();
+    initTrtLlmPlugins(logger.get());
+
+    try
+    {
+        auto const beamWidth = static_cast<SizeType32>(result["beam_width"].as<int>());
+        auto const maxNumRequests = result["max_num_requests"].as<int>() > 0
+            ? std::make_optional(result["max_num_requests"].as<int>())
+            : std::nullopt;
+        auto const traceRequests = parseArrivalTrace(result["trace"].as<std::string>(), beamWidth, maxNumRequests);
+
+        texec::KvCacheConfig kvCacheConfig(false);
+        kvCacheConfig.setFreeGpuMemoryFraction(result["kv_cache_free_gpu_mem_fraction"].as<float>());
+        texec::ExecutorConfig executorConfig(beamWidth);
+        executorConfig.setKvCacheConfig(kvCacheConfig);
+        executorConfig.setEnableChunkedContext(result["enable_chunked_context"].as<bool>());
+        executorConfig.setBatchingType(texec::BatchingType::kINFLIGHT);
+        if (result.count("max_batch_size"))
+        {
+            executorConfig.setMaxBatchSize(result["max_batch_size"].as<int>());
+        }
+        if (result.count("max_num_tokens"))
+        {
+            executorConfig.setMaxNumTokens(result["max_num_tokens"].as<int>());
+        }
+
+        auto executor = texec::Executor(
+            fs::path{result["engine_dir"].as<std::string>()}, texec::ModelType::kDECODER_ONLY, executorConfig);
+        auto const streaming = result["streaming"].as<bool>();
+
+        if (executor.canEnqueueRequests())
+        {
+            auto const numWarmUp = std::min<size_t>(result["warm_up"].as<int>(), traceRequests.size());
+            if (numWarmUp > 0)
+            {
+                std::vector<TraceRequest> warmUpRequests(
+                    traceRequests.begin(), traceRequests.begin() + static_cast<std::ptrdiff_t>(numWarmUp));
+                TraceRecorder warmUpRecorder;
+                replayTrace(executor, warmUpRequests, /* timeScale */ 0., streaming, warmUpRecorder);
+            }
+
+            TraceRecorder recorder;
+            replayTrace(executor, traceRequests, result["time_scale"].as<double>(), streaming, recorder);
+            recorder.report();
+
+            auto const outputJson = result["output_json"].as<std::string>();
+            if (!outputJson.empty())
+            {
+                recorder.writeJson(outputJson);
+            }
+        }
+        else
+        {
+            // Worker ranks block inside the executor until the leader shuts down.
+        }
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_ERROR(e.what());
+        return 1;
+    }
+
+    return 0;
+}
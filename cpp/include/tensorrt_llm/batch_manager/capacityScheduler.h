@@ -21,7 +21,11 @@
 #include "tensorrt_llm/common/algorithm.h"
 #include "tensorrt_llm/common/optionalRef.h"
 #include "tensorrt_llm/runtime/common.h"
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <variant>
+#include <vector>
 
 namespace tensorrt_llm::batch_manager
 {
@@ -38,6 +42,45 @@ namespace tensorrt_llm::batch_manager
 using tensorrt_llm::runtime::SizeType32;
 using common::OptionalRef;
 
+/// @brief Structure-of-arrays snapshot of the scheduling-relevant request fields.
+/// @details The capacity policies walk the active list several times per iteration (the chunked-prefill
+///          pre-pass, the admission loop and the pause-victim search), and with tens of thousands of
+///          queued requests each walk chases a shared_ptr into a scattered heap object just to read the
+///          state. Gathering state and phase flags once per invocation lets the repeated scans filter on
+///          contiguous arrays and dereference only the requests that pass.
+struct RequestSnapshot
+{
+    /// Phase flags derived from each request once at gather time.
+    enum Flags : uint8_t
+    {
+        kENCODER_INIT_FLAG = 1 << 0,
+        kCONTEXT_INIT_FLAG = 1 << 1,
+        kFIRST_CONTEXT_CHUNK_FLAG = 1 << 2,
+        kGENERATION_IN_PROGRESS_FLAG = 1 << 3,
+        kDISAGG_GENERATION_INIT_FLAG = 1 << 4,
+    };
+
+    /// Stable pointers into the (ordered) active request list; valid for the duration of one call.
+    std::vector<std::shared_ptr<LlmRequest> const*> requests;
+    std::vector<LlmRequestState> states;
+    std::vector<uint8_t> flags;
+
+    /// @brief Gather the snapshot in a single pass over the active requests.
+    [[nodiscard]] static RequestSnapshot gather(RequestList const& activeRequests);
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return requests.size();
+    }
+
+    /// @brief Mirrors the hasReachedState() window check without touching the request object.
+    [[nodiscard]] bool isSchedulable(
+        std::size_t idx, LlmRequestState noScheduleUntilState, LlmRequestState noScheduleAfterState) const noexcept
+    {
+        return states[idx] >= noScheduleUntilState && states[idx] < noScheduleAfterState;
+    }
+};
+
 /// @brief This scheduler takes into account the given request capacity and the KV cache capacity.
 ///        Depending on the CapacitySchedulerPolicy it will schedule already started and new requests,
 ///        or even pause previously started requests.
@@ -74,9 +117,9 @@ public:
         LlmRequestState noScheduleUntilState = LlmRequestState::kCONTEXT_INIT,
         LlmRequestState noScheduleAfterState = LlmRequestState::kGENERATION_COMPLETE);
 
-    /// @brief Takes as input a sorted list of requests and outputs a sorted lists of requests
-    ///        to update for this current iteration, and a map of requests to pause
-    [[nodiscard]] std::tuple<RequestVector, RequestVector> operator()(RequestList const& activeRequests) const;
+    /// @brief Takes as input a snapshot of the sorted active requests and outputs a sorted lists of
+    ///        requests to update for this current iteration, and a map of requests to pause
+    [[nodiscard]] std::tuple<RequestVector, RequestVector> operator()(RequestSnapshot const& snapshot) const;
 
 private:
     SizeType32 mMaxNumRequests;
@@ -94,7 +137,7 @@ public:
 
     [[nodiscard]] std::tuple<RequestVector, RequestVector> operator()(
         kv_cache_manager::BaseKVCacheManager& kvCacheManager, OptionalRef<BasePeftCacheManager const> peftCacheManager,
-        RequestList const& activeRequests) const;
+        RequestSnapshot const& snapshot) const;
 
 private:
     SizeType32 mMaxNumRequests;
@@ -113,14 +156,14 @@ public:
     [[nodiscard]] std::tuple<RequestVector, RequestVector> operator()(
         kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
         OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const;
+        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const;
 
 protected:
     template <bool StaticBatchScheduling>
     [[nodiscard]] std::tuple<RequestVector, RequestVector> impl(
         kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
         OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const;
+        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const;
 
 private:
     SizeType32 mMaxNumRequests;
@@ -137,7 +180,7 @@ public:
     [[nodiscard]] std::tuple<RequestVector, RequestVector> operator()(
         kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
         OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const;
+        OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const;
 };
 
 class CapacityScheduler : public Algorithm
@@ -147,12 +190,16 @@ public:
 
     explicit CapacityScheduler(SizeType32 maxNumRequests, executor::CapacitySchedulerPolicy capacitySchedulerPolicy,
         bool hasKvCacheManager, bool twoStepsLookAhead = false,
+        std::optional<float> contextTokensPerSecond = std::nullopt,
         LlmRequestState noScheduleUntilState = LlmRequestState::kCONTEXT_INIT,
         LlmRequestState noScheduleAfterState = LlmRequestState::kGENERATION_COMPLETE);
 
     /**
      * @brief Schedules requests following the selected policy.
      *
+     * When TRTLLM_SLO_DEADLINE_WINDOW_MS is set to a positive value, requests are presented to the policy in
+     * earliest-deadline-first order, with each request's deadline derived from its start time and priority.
+     *
      * @param kvCacheManager Required in MaxUtilizationScheduler (as a ref) and in GuaranteedNoEvictScheduler and
      * StaticBatchScheduler (as a const ref).
      * @param crossKvCacheManager Optional used in GuaranteedNoEvictScheduler and StaticBatchScheduler.
@@ -168,9 +215,19 @@ public:
         OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager = std::nullopt) const;
 
 private:
+    /// @brief Defers first-chunk context requests that exceed the configured context-token admission
+    ///        rate, spreading an arrival burst of prefill work across iterations.
+    [[nodiscard]] RequestVector paceContextAdmission(RequestVector fittingRequests) const;
+
     std::variant<std::monostate, MaxRequestsScheduler, MaxUtilizationScheduler, GuaranteedNoEvictScheduler,
         StaticBatchScheduler>
         mScheduler;
+
+    /// @brief Context-token admission rate in tokens/sec, nullopt disables pacing.
+    std::optional<float> mContextTokensPerSecond;
+    /// @brief Token-bucket balance for context admission; may go negative so long prompts still make progress.
+    mutable double mContextTokenBucket{0.};
+    mutable std::optional<std::chrono::steady_clock::time_point> mLastAdmissionRefill;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -26,8 +26,12 @@
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace tensorrt_llm::runtime
 {
+class BufferManager;
 class SamplingConfig;
 
 namespace decoder
@@ -71,16 +75,47 @@ public:
         SizeType32 beamWidth, OptionalRef<MedusaBuffers const> medusaBuffers) const;
 
     [[nodiscard]] std::tuple<std::vector<SharedConstPtr>, std::vector<executor::LookaheadDecodingConfig>>
-    createDecoderRequests(RequestVector const& finishedContextRequests, TensorPtr const& inputIds,
+    createDecoderRequests(RequestVector const& finishedContextRequests, DecoderInputBuffers& inputBuffers,
         executor::DecodingConfig const& decodingConfig, runtime::decoder::DecoderState& decoderState,
         nvinfer1::DataType logitsType, runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig,
         runtime::CudaStream const& runtimeStream, runtime::CudaStream const& decoderStream,
         SizeType32 maxSequenceLength, OptionalRef<MedusaBuffers const> medusaBuffers) const;
 
+    //! Cache of device-resident bad/stop word lists keyed by content. Almost all traffic carries the
+    //! same few chat-template stop strings, so identical lists are uploaded to the device once and
+    //! shared between requests instead of being re-allocated and re-copied on every admission.
+    class WordsListCache
+    {
+    public:
+        //! Return a device tensor holding the given host words list with its leading bs1 dimension
+        //! removed, uploading the list only when no identical one is cached.
+        [[nodiscard]] TensorPtr getOrUpload(
+            runtime::ITensor const& wordsHost, nvinfer1::Dims const& wordsShape, runtime::BufferManager const& manager);
+
+    private:
+        struct Entry
+        {
+            std::vector<runtime::TokenIdType> tokens;
+            TensorPtr wordsList;
+        };
+
+        //! Lists above this volume are uploaded privately: they are too rare to amortize and would
+        //! dominate the host-side copies kept for hash verification.
+        static constexpr SizeType32 kMaxCachedVolume{4096};
+        //! Distinct lists seen in practice number in the single digits; treat more as churn and start over.
+        static constexpr std::size_t kMaxEntries{128};
+
+        std::unordered_map<std::size_t, std::vector<Entry>> mEntries;
+        std::size_t mNumEntries{0};
+    };
+
 private:
     bool mSpeculativeDecodingFastLogits;
     bool mIsLeaderInOrchMode;
     bool mIsNormalizeLogProbs;
+    //! Mutable: createDecoderRequests is const, and the cache is an invisible side table whose state
+    //! does not affect observable results.
+    mutable WordsListCache mWordsListCache;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -18,11 +18,13 @@
 
 #include "tensorrt_llm/batch_manager/common.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/cudaEvent.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <optional>
 #include <vector>
 
 namespace tensorrt_llm::runtime::decoder
@@ -55,6 +57,13 @@ public:
     TensorPtr fillValues;
     TensorPtr fillValuesDevice;
 
+    //! Pinned staging area for casting embedding bias tensors of new requests, [numCasts, vocabSize].
+    //! Grown on demand and reused across iterations to avoid per-request allocations.
+    TensorPtr embeddingBiasStaging;
+    //! Pinned staging area for bad/stop word lists of new requests, [sumWordsSize].
+    //! Grown on demand and reused across iterations to avoid per-request allocations.
+    TensorPtr wordsStaging;
+
     //! Buffers for decoder forward
 
     //! Requests for considered in decoder forward
@@ -66,9 +75,17 @@ public:
     //! Logits of decoder requests
     std::vector<TensorPtr> logits;
 
+    //! Persistent storage for tiling context logits of beam search requests, [numRows, vocabSizePadded].
+    //! Grown on demand and reused across iterations to avoid per-request allocations.
+    TensorPtr tiledLogits;
+
     //! Logits for speculative decoding (Medusa)
     //! [maxBatchSize][maxAcceptedDraftTokensPerStep][maxDraftTokens + 1, vocabSizePadded]
     std::vector<std::vector<runtime::ITensor::SharedPtr>> predictedDraftLogits;
+
+    //! Completion event of the logits D2H copies issued on the dedicated copy stream this iteration.
+    //! Synchronized before host logits are read for responses and before the logits buffers are reused.
+    std::optional<runtime::CudaEvent> logitsCopyDoneEvent;
 };
 
 class DecoderOutputBuffers
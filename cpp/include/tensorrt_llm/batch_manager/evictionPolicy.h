@@ -18,7 +18,11 @@
 
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 
+#include <array>
 #include <chrono>
+#include <deque>
+#include <memory>
+#include <unordered_set>
 #include <vector>
 
 using namespace tensorrt_llm::batch_manager::kv_cache_manager;
@@ -40,6 +44,12 @@ public:
     /// @brief Get a free block from the specified cache level
     /// @returns The pointer to the free block, along with whether it can be offloaded
     virtual std::tuple<BlockPtr, bool> getFreeBlock(SizeType32 cacheLevel) = 0;
+    /// @brief Get up to numBlocks distinct victim blocks from the specified cache level in one pass
+    /// @details Selection order matches repeated getFreeBlock/claimBlock cycles, but the queues are
+    /// scanned only once, so freeing a long chain does not restart the priority scan per block.
+    /// None of the returned blocks are claimed; the caller claims the ones it uses.
+    /// @returns Up to numBlocks (block, canOffload) tuples; fewer if the level runs out of free blocks
+    virtual std::vector<std::tuple<BlockPtr, bool>> getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks) = 0;
     /// @brief Release a block. Prioritize the block for eviction if toFront=true
     virtual void releaseBlock(BlockPtr block) = 0;
     virtual void releaseBlock(BlockPtr block, bool toFront) = 0;
@@ -73,6 +83,7 @@ public:
     void initialize(std::vector<BlockPtr>& mAllBlocksById, std::vector<SizeType32> sizes,
         std::optional<executor::RetentionPriority> secondaryOffloadMinPriority) override;
     std::tuple<BlockPtr, bool> getFreeBlock(SizeType32 cacheLevel) override;
+    std::vector<std::tuple<BlockPtr, bool>> getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks) override;
 
     void releaseBlock(BlockPtr block) override;
     void releaseBlock(BlockPtr block, bool toFront) override;
@@ -91,11 +102,24 @@ public:
 
     bool verifyQueueIntegrity() override;
 
-private:
+    /// @brief Remove a block from this policy's bookkeeping without touching the block's shared
+    /// priority/duration state. Used by AdaptiveEvictionPolicy to keep a shadow policy in lockstep
+    /// with the live one; claimBlock is claimBlockBookkeeping plus the shared-state updates.
+    virtual void claimBlockBookkeeping(BlockPtr const& block);
+    /// @brief Counterpart of claimBlockBookkeeping for releases. Expects the block's expiration
+    /// time to have been set already by the policy that took the full releaseBlock call.
+    void releaseBlockBookkeeping(BlockPtr block, bool toFront);
+
+protected:
     // Queues of available leaf blocks, split by cache level and priority level
     std::vector<std::vector<FreeBlocksQueue>> mFreeQueues;
     // Iterators to block entries in mFreeQueues
     std::vector<std::optional<FreeBlocksQueue::iterator>> mFreeBlockIterators;
+    // Priority index each free block was enqueued under. Erasures go through this instead of the
+    // block's current priority, which a twin policy may have rewritten in the meantime.
+    std::vector<SizeType32> mQueuedPriorityIdx;
+    // Whether each free block was inserted into mExpiringBlockHeap on release
+    std::vector<bool> mQueuedExpiring;
     // Amount of free blocks at each cache level
     std::vector<SizeType32> mNumFreeBlocksPerLevel;
     // Secondary offload threshold. Blocks below this priority won't be evicted.
@@ -104,4 +128,102 @@ private:
     std::set<BlockPtr, ExpiringBlockComparator> mExpiringBlockHeap;
 };
 
+/// @brief LRU-ordered eviction with approximate least-frequently-used victim selection.
+/// @details Keeps a decaying reuse count per block and, when asked for victims, scans a bounded
+/// sample at the front of each priority queue for the least-frequently-reused candidate. Ties fall
+/// back to LRU order, so a workload without block reuse behaves exactly like LRUEvictionPolicy.
+/// Counts are halved every kAgingPeriod iterations so historic reuse ages out (LFU-with-aging).
+class LFUEvictionPolicy : public LRUEvictionPolicy
+{
+public:
+    /// Number of queue-front candidates examined per victim selection.
+    static constexpr SizeType32 kEvictionSampleSize = 32;
+    /// Reuse counts are halved every this many refresh() calls.
+    static constexpr SizeType32 kAgingPeriod = 512;
+
+    void initialize(std::vector<BlockPtr>& mAllBlocksById, std::vector<SizeType32> sizes,
+        std::optional<executor::RetentionPriority> secondaryOffloadMinPriority) override;
+    std::vector<std::tuple<BlockPtr, bool>> getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks) override;
+    void claimBlockBookkeeping(BlockPtr const& block) override;
+    void refresh() override;
+
+private:
+    // Decaying per-block reuse counts. Indexed by block id; counts survive a refill of the block
+    // until aging washes them out, mirroring how approximate LFU caches seed new entries.
+    std::vector<float> mReuseCounts;
+    SizeType32 mRefreshesUntilAging{kAgingPeriod};
+};
+
+/// @brief Meta-policy that keeps an LRU and an LFU-with-aging policy in lockstep and serves
+/// evictions from whichever has the better recent simulated hit rate.
+/// @details Both policies observe every claim and release, so each always orders the full set of
+/// free blocks its own way and switching the live policy between iterations needs no flush of
+/// resident blocks. Policy quality is estimated with ghost sampling: on every real eviction, each
+/// policy nominates the additional block it would evict if the cache were slightly smaller; those
+/// nominees stay resident, so a later reuse of one counts as a simulated miss against the
+/// nominating policy. Whenever a decision window of reuses completes, the policy with fewer
+/// simulated misses (by a hysteresis margin) becomes the live one.
+class AdaptiveEvictionPolicy : public BaseEvictionPolicy
+{
+public:
+    /// Number of reuse events per policy-selection window.
+    static constexpr SizeType32 kDecisionWindow = 1024;
+    /// Maximum number of ghost nominees remembered per policy.
+    static constexpr SizeType32 kGhostCapacity = 4096;
+
+    void initialize(std::vector<BlockPtr>& mAllBlocksById, std::vector<SizeType32> sizes,
+        std::optional<executor::RetentionPriority> secondaryOffloadMinPriority) override;
+    std::tuple<BlockPtr, bool> getFreeBlock(SizeType32 cacheLevel) override;
+    std::vector<std::tuple<BlockPtr, bool>> getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks) override;
+    void releaseBlock(BlockPtr block) override;
+    void releaseBlock(BlockPtr block, bool toFront) override;
+    SizeType32 getNumFreeBlocks(SizeType32 cacheLevel) override;
+    void claimBlock(BlockPtr block) override;
+    void claimBlock(BlockPtr block, std::optional<executor::RetentionPriority> priority,
+        std::optional<std::chrono::milliseconds> durationMs) override;
+    void refresh() override;
+    bool verifyQueueIntegrity() override;
+
+    /// @brief Whether the LFU policy is currently serving evictions. Exposed for tests and logs.
+    [[nodiscard]] bool isLfuLive() const
+    {
+        return mLiveIdx == kLfu;
+    }
+
+private:
+    static constexpr SizeType32 kLru = 0;
+    static constexpr SizeType32 kLfu = 1;
+
+    // Resident blocks a policy would have evicted in a slightly smaller cache, in nomination order
+    struct GhostList
+    {
+        std::deque<KVCacheBlock::IdType> order;
+        std::unordered_set<KVCacheBlock::IdType> ids;
+        uint64_t simulatedMisses{0};
+    };
+
+    [[nodiscard]] LRUEvictionPolicy& livePolicy() const
+    {
+        return *mPolicies[mLiveIdx];
+    }
+
+    [[nodiscard]] LRUEvictionPolicy& shadowPolicy() const
+    {
+        return *mPolicies[1 - mLiveIdx];
+    }
+
+    void recordEviction(BlockPtr const& victim);
+    void recordReuse(KVCacheBlock::IdType blockId);
+    void ghostInsert(GhostList& ghost, KVCacheBlock::IdType blockId);
+    void ghostErase(GhostList& ghost, KVCacheBlock::IdType blockId);
+
+    std::array<std::shared_ptr<LRUEvictionPolicy>, 2> mPolicies;
+    SizeType32 mLiveIdx{kLru};
+    std::array<GhostList, 2> mGhosts;
+    // Victim candidates handed out via getFreeBlock(s) this iteration; a claim of one of these
+    // that still holds tokens is a real eviction, any other tokened claim is a reuse hit.
+    std::unordered_set<KVCacheBlock::IdType> mPendingVictims;
+    uint64_t mWindowReuses{0};
+};
+
 } // namespace tensorrt_llm::batch_manager::eviction_policy
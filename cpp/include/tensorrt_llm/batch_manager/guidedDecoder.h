@@ -21,6 +21,8 @@
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 
+#include <future>
+
 namespace xgrammar
 {
 class GrammarMatcher;
@@ -29,8 +31,14 @@ class GrammarCompiler;
 
 namespace tensorrt_llm::batch_manager
 {
+class CompiledGrammarCache;
 class DecoderInputBuffers;
 
+namespace utils
+{
+class StaticThreadPool;
+}
+
 class GuidedDecoder
 {
 public:
@@ -40,19 +48,36 @@ public:
 
     GuidedDecoder(executor::GuidedDecodingConfig const& guidedDecodingConfig, SizeType32 maxNumSequences,
         SizeType32 vocabSizePadded, nvinfer1::DataType logitsDtype, runtime::BufferManager const& runtimeBufferManager);
+    ~GuidedDecoder();
     void build(ScheduledRequests const& scheduledRequests);
+    //! \brief Run build on a background thread so the bitmask computation overlaps the host-side
+    //! work of the forward step. execute() joins the pending build before consuming the bitmasks.
+    void buildAsync(ScheduledRequests const& scheduledRequests);
     void execute(DecoderInputBuffers const& decoderInputBuffers, runtime::BufferManager const& runtimeBufferManager);
 
 private:
+    //! \brief Builds the device representation of the slot's freshly filled host bitmask: a sparse
+    //! (word index, mask word) list when few words are constrained, the dense bitmask otherwise.
+    void storeBitmask(SizeType32 seqSlot);
+    //! \brief Reuses the mask already built for srcSlot this step, skipping the xgrammar fill.
+    void copyMaskFromSlot(SizeType32 srcSlot, SizeType32 dstSlot);
+
     executor::GuidedDecodingConfig::GuidedDecodingBackend mGuidedDecodingBackend;
     std::vector<std::shared_ptr<xgrammar::GrammarMatcher>> mXGrammarMatchers;
     std::shared_ptr<xgrammar::GrammarCompiler> mXGrammarCompiler;
+    // LRU cache of compiled grammars shared across requests, with compilation running on its own
+    // worker pool. Only accessed from the build thread.
+    std::unique_ptr<CompiledGrammarCache> mGrammarCache;
 
     SizeType32 mMaxNumSequences;
     SizeType32 mVocabSizePadded;
-    SizeType32 mBitmaskSize; // CeilDiv(vocabSizePadded, 32)
+    SizeType32 mBitmaskSize;         // CeilDiv(vocabSizePadded, 32)
+    SizeType32 mMaxSparseMaskWords;  // Sparse capacity per slot; denser masks fall back to the dense kernel.
     nvinfer1::DataType mLogitsDtype;
 
+    //! Sentinel in mSparseMaskNumWords for slots whose mask exceeded the sparse capacity.
+    static constexpr SizeType32 kDenseMask = -1;
+
     TensorPtr mLogitsBitmask;           // [mMaxNumRequests, mBitmaskSize]
     TensorPtr mLogitsBitmaskHost;       // [mMaxNumRequests, mBitmaskSize]
     TensorPtr mLogitsBitmaskPtrVec;     // [mMaxNumRequests], pointers to the logitsBitmask in a batch
@@ -60,8 +85,26 @@ private:
     TensorPtr mLogitsPtrVec;            // [mMaxNumRequests], pointers to the logits in a batch
     TensorPtr mLogitsPtrVecHost;        // [mMaxNumRequests]
 
+    // Sparse masks as interleaved (word index, mask word) pairs for the 32-token segments that are
+    // not fully allowed; typical JSON grammars constrain only a few percent of the vocabulary, so
+    // the sparse kernel and the smaller H2D copy skip almost all of the dense mask traffic.
+    TensorPtr mSparseMask;              // [mMaxNumRequests, 2 * mMaxSparseMaskWords]
+    TensorPtr mSparseMaskHost;          // [mMaxNumRequests, 2 * mMaxSparseMaskWords]
+    TensorPtr mSparseLogitsPtrVec;      // [mMaxNumRequests], pointers to the logits in a batch
+    TensorPtr mSparseLogitsPtrVecHost;  // [mMaxNumRequests]
+    TensorPtr mSparseMaskPtrVec;        // [mMaxNumRequests], pointers to the sparse masks in a batch
+    TensorPtr mSparseMaskPtrVecHost;    // [mMaxNumRequests]
+    TensorPtr mSparseNumWordsVec;       // [mMaxNumRequests]
+    TensorPtr mSparseNumWordsVecHost;   // [mMaxNumRequests]
+    //! Per-slot sparse word count; 0 means nothing is banned and kDenseMask means dense fallback.
+    std::vector<SizeType32> mSparseMaskNumWords;
+
     // BufferManager with a dedicated stream for async copy of buffers for guided decoding.
     runtime::BufferManager mCopyBufferManager;
+
+    // Worker thread for buildAsync; the xgrammar matchers are only touched from this thread.
+    std::unique_ptr<utils::StaticThreadPool> mBuildThreadPool;
+    std::future<void> mBuildFuture;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -44,10 +44,13 @@ public:
 
     HandleContextLogits() = default;
 
+    //! @param copyManager manager on a dedicated copy stream for logits D2H traffic. When provided, its stream
+    //! must already wait on the runtime stream having produced the logits; the caller owns the completion event.
     runtime::SizeType32 operator()(DecoderInputBuffers& inputBuffers, RequestVector const& contextRequests,
         runtime::ITensor::SharedPtr const& logits, std::vector<runtime::SizeType32> const& numContextLogitsVec,
         runtime::ModelConfig const& modelConfig, runtime::BufferManager const& manager,
-        OptionalRef<MedusaBuffers> medusaBuffers) const;
+        OptionalRef<MedusaBuffers> medusaBuffers,
+        OptionalRef<runtime::BufferManager const> copyManager = std::nullopt) const;
 };
 
 } // namespace tensorrt_llm::batch_manager
@@ -44,10 +44,13 @@ public:
 
     HandleGenerationLogits() = default;
 
+    //! @param copyManager manager on a dedicated copy stream for logits D2H traffic. When provided, its stream
+    //! must already wait on the runtime stream having produced the logits; the caller owns the completion event.
     void operator()(DecoderInputBuffers& inputBuffers, RequestVector const& generationRequests,
         runtime::ITensor::SharedPtr const& logits, runtime::SizeType32 logitsIndex,
         runtime::ModelConfig const& modelConfig, runtime::BufferManager const& manager,
-        OptionalRef<RuntimeBuffers> genRuntimeBuffers, OptionalRef<MedusaBuffers> medusaBuffers) const;
+        OptionalRef<RuntimeBuffers> genRuntimeBuffers, OptionalRef<MedusaBuffers> medusaBuffers,
+        OptionalRef<runtime::BufferManager const> copyManager = std::nullopt) const;
 };
 
 } // namespace tensorrt_llm::batch_manager
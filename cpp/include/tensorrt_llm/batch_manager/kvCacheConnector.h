@@ -18,19 +18,119 @@
 
 #include "tensorrt_llm/batch_manager/common.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/runtime/common.h"
+#include "tensorrt_llm/runtime/cudaStream.h"
+#include "tensorrt_llm/runtime/iTensor.h"
 
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
 using SizeType32 = tensorrt_llm::runtime::SizeType32;
 using RequestIdType = tensorrt_llm::batch_manager::LlmRequest::RequestIdType;
 
-/// See tensorrt_llm/_torch/pyexecutor/connector.py for details on the Connector API.
+/// See tensorrt_llm/_torch/pyexecutor/kv_cache_connector.py for details on the Connector API.
 
 namespace tensorrt_llm::batch_manager::kv_connector
 {
 
+/// @brief Transfer counters a connector backend maintains, polled by the runtime for statistics.
+/// @details Blocks count device-sized cache blocks; lookups count getNumNewMatchedTokens calls.
+struct KvCacheConnectorMetrics
+{
+    uint64_t numLookups{0};
+    uint64_t numMatchedTokens{0};
+    uint64_t numOnboardedBlocks{0};
+    uint64_t numOffloadedBlocks{0};
+    /// @brief Offloads the backend pushed back on via canScheduleSave, i.e. flow control hits.
+    uint64_t numDeferredOffloads{0};
+    uint64_t numFailedTransfers{0};
+};
+
+/// @brief Worker side of the connector SPI: performs and monitors the transfers the scheduler side
+/// decided on. One worker runs per model rank, next to the forward pass.
+/// @details Onboarding is streamed at layer granularity: startLoadKv kicks off the transfers for
+/// the next forward pass and waitForLayerLoad is called right before each layer's work is enqueued,
+/// so deep layers still transfer while early layers already compute. Offload is write-behind:
+/// saveKvLayer is called right after each layer's work is enqueued and completion is reported
+/// asynchronously through getFinished.
+class KvCacheConnectorWorker
+{
+public:
+    using CudaStreamPtr = std::shared_ptr<runtime::CudaStream>;
+
+    KvCacheConnectorWorker() = default;
+    virtual ~KvCacheConnectorWorker() = default;
+
+    /// @brief Register the device cache pools with the backend, e.g. for RDMA registration.
+    /// Called once after allocation, before any transfer.
+    virtual void registerKvCaches(std::vector<runtime::ITensor::SharedPtr> const& pools) = 0;
+
+    /// @brief Begin loading the blocks the scheduler matched, ahead of the next forward pass.
+    virtual void startLoadKv(CudaStreamPtr const& stream) = 0;
+
+    /// @brief Make \p stream wait until the given layer has finished onboarding.
+    /// Called immediately before the layer's work is enqueued.
+    virtual void waitForLayerLoad(SizeType32 layerIdx, CudaStreamPtr const& stream) = 0;
+
+    /// @brief Begin the write-behind offload of one layer.
+    /// Called immediately after the layer's work is enqueued on \p stream.
+    virtual void saveKvLayer(SizeType32 layerIdx, CudaStreamPtr const& stream) = 0;
+
+    /// @brief Block until the synchronous part of all pending saves is done.
+    /// Called at the end of the forward pass.
+    virtual void waitForSave(CudaStreamPtr const& stream) = 0;
+
+    /// @brief Flow control for write-behind offload. The runtime asks before scheduling the saves
+    /// of a finished request; returning false defers the request to a later iteration instead of
+    /// queueing more transfers onto a saturated backend.
+    virtual bool canScheduleSave(SizeType32 numBlocks)
+    {
+        return true;
+    }
+
+    /// @brief Poll for requests whose async transfers completed.
+    /// @param finishedGenReqIds Requests that finished generating and are now saving asynchronously.
+    /// @param startedLoadingReqIds Requests whose async onboarding has started.
+    /// @return The ids that finished saving and the ids that finished loading. Ids may only be
+    /// returned after they were passed in, and the runtime acts on an id once all workers returned it.
+    virtual std::pair<std::vector<RequestIdType>, std::vector<RequestIdType>> getFinished(
+        std::vector<RequestIdType> const& finishedGenReqIds, std::vector<RequestIdType> const& startedLoadingReqIds)
+        = 0;
+
+    /// @brief Snapshot of the backend's transfer counters.
+    virtual KvCacheConnectorMetrics getMetrics() const
+    {
+        return {};
+    }
+};
+
+/// @brief Scheduler side of the connector SPI: decides which blocks to onboard and offload and
+/// builds the metadata the workers act on. Runs once, next to the scheduler.
+class KvCacheConnectorScheduler
+{
+public:
+    KvCacheConnectorScheduler() = default;
+    virtual ~KvCacheConnectorScheduler() = default;
+
+    /// @brief Look up how many tokens beyond \p numComputedTokens the backend can provide.
+    /// @return The number of loadable tokens and whether they will be onboarded asynchronously
+    /// (the request then waits outside the batch until the workers report the load finished).
+    virtual std::pair<SizeType32, bool> getNumNewMatchedTokens(LlmRequest const& request, SizeType32 numComputedTokens)
+        = 0;
+
+    /// @brief Called after block allocation with the block ids backing the request, so lookup
+    /// results can be turned into concrete transfer metadata.
+    virtual void updateStateAfterAlloc(LlmRequest const& request, std::vector<SizeType32> const& blockIds) = 0;
+
+    /// @brief Called when a request finished generating.
+    /// @return Whether the request offloads asynchronously; its blocks are then kept allocated
+    /// until the workers report the save finished.
+    virtual bool requestFinished(LlmRequest const& request, std::vector<SizeType32> const& cacheBlockIds) = 0;
+};
+
 /// @brief The KV connector manager. This is passed into the C++ KV Cache Manager when adding sequences.
 class KvCacheConnectorManager
 {
@@ -41,6 +141,28 @@ public:
     /// @brief Handle the getNumNewMatchedTokens call inside the C++ KV Cache Manager.
     /// @return The number of tokens that can be loaded from remote KV cache.
     virtual SizeType32 getNumNewMatchedTokens(LlmRequest const& request, SizeType32 numComputedTokens) = 0;
+
+    /// @brief Batched form of getNumNewMatchedTokens for lookups against remote backends, where
+    /// one round trip per request dominates. The default loops over the single-request form;
+    /// backends with a batched lookup should override it.
+    virtual std::vector<SizeType32> getNumNewMatchedTokens(
+        RequestVector const& requests, std::vector<SizeType32> const& numComputedTokens)
+    {
+        TLLM_CHECK(requests.size() == numComputedTokens.size());
+        std::vector<SizeType32> numMatchedTokens;
+        numMatchedTokens.reserve(requests.size());
+        for (std::size_t ri = 0; ri < requests.size(); ++ri)
+        {
+            numMatchedTokens.push_back(getNumNewMatchedTokens(*requests[ri], numComputedTokens[ri]));
+        }
+        return numMatchedTokens;
+    }
+
+    /// @brief Snapshot of the connector's transfer counters.
+    virtual KvCacheConnectorMetrics getMetrics() const
+    {
+        return {};
+    }
 };
 
 } // namespace tensorrt_llm::batch_manager::kv_connector
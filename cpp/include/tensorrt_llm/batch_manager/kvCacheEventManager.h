@@ -84,15 +84,28 @@ private:
     /// @brief Condition variable for blocking read
     std::condition_variable mEmptyCV;
 
-    /// @brief List of buffers waiting awaiting insertion into mEvents. Consumed by the worker.
-    std::deque<std::deque<executor::KVCacheEvent>> mPendingEvents;
-    /// @brief Lock for mPendingEvents
-    std::mutex mPendingEventsMutex;
+    /// @brief A batch of flushed events, linked into the lock-free pending list.
+    struct EventBatch
+    {
+        std::deque<executor::KVCacheEvent> events;
+        EventBatch* next{nullptr};
+    };
+
+    /// @brief Head of the lock-free list of flushed batches, newest first. flush() pushes with an
+    /// atomic exchange so the forward pass never contends with the worker on a mutex. Consumed
+    /// (and freed) by the worker, drained by the destructor.
+    std::atomic<EventBatch*> mPendingBatches{nullptr};
+    /// @brief Mutex backing mPendingEmptyCV; it guards no data.
+    std::mutex mPendingWakeupMutex;
     /// @brief Condition variable to notify worker thread
     std::condition_variable mPendingEmptyCV;
 
-    /// @brief Buffer of events waiting to be added to the eventQueue. Only ever accessed by forward pass thread.
+    /// @brief Buffer of events waiting to be added to the eventQueue. Guarded by mEventQueueMutex;
+    /// the per-window block managers of a multi-window model enqueue from concurrent workers.
     std::deque<executor::KVCacheEvent> mEventQueue;
+    /// @brief Lock for mEventQueue and mEventId. Only ever contended while a multi-window model
+    /// runs cross-window bookkeeping in parallel; flush() takes it briefly to swap the queue out.
+    std::mutex mEventQueueMutex;
 
     /// @brief The maximum size of the deque
     size_t mMaxSize;
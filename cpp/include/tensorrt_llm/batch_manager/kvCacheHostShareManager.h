@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+// KVCacheHostShareManager lets multiple replicas of the same model on one host reuse each
+// other's cached prefixes instead of prefilling them independently.
+//
+// Each replica exports its primary (GPU) block pools with cudaIpcGetMemHandle and registers
+// the handles in a POSIX shared-memory segment. The segment also holds a fixed-capacity hash
+// index mapping a block's chained hash (see BlockKeyHasher) to the owning replica and its
+// block index. When a reuse lookup misses the local radix tree, the index is consulted and a
+// hit is onboarded with a device-to-device copy from the peer's pool (NVLink/PCIe peer access
+// via cudaIpcOpenMemHandle) into a freshly allocated local block.
+//
+// Consistency: every index entry carries a generation counter. The owner bumps it when the
+// published block is claimed for overwrite or swapped out of the primary pool, always before
+// the contents can change. A reader snapshots the entry, performs the copy, synchronizes, and
+// re-validates the generation; a mismatch discards the copy. Stale or evicted entries thus
+// degrade to ordinary misses. Publication happens when blocks are stored for reuse, i.e. after
+// the producing context step has completed.
+//
+// Sharing is enabled via TRTLLM_KVCACHE_HOST_SHARE, which names the shared-memory segment;
+// replicas must use the same value. Replicas with a different pool geometry (pool count, block
+// bytes, tokens per block or attention window) refuse to join and fall back to private reuse.
+class KVCacheHostShareManager
+{
+public:
+    using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+    //! \brief Create a share manager if TRTLLM_KVCACHE_HOST_SHARE is set, nullptr otherwise.
+    static std::shared_ptr<KVCacheHostShareManager> createFromEnv(std::string const& logPrefix);
+
+    KVCacheHostShareManager(std::string const& segmentName, std::string logPrefix);
+    ~KVCacheHostShareManager();
+
+    KVCacheHostShareManager(KVCacheHostShareManager const&) = delete;
+    KVCacheHostShareManager& operator=(KVCacheHostShareManager const&) = delete;
+
+    //! \brief Export the primary pools over CUDA IPC and claim a replica slot in the segment.
+    //! \details Must be called once, after the pools have been allocated. Returns false (and
+    //! leaves the segment untouched) when the replica table is full or the pool geometry does
+    //! not match the replicas already registered; the caller should then disable sharing.
+    bool registerLocalPools(std::vector<KVCacheBlockPool> const& pools, SizeType32 numPrimaryBlocks,
+        SizeType32 windowSize, SizeType32 tokensPerBlock);
+
+    //! \brief Publish a primary-resident full block under its chained hash.
+    void publish(size_t hash, SizeType32 poolBlockIdx);
+
+    //! \brief Withdraw this replica's entry for the given hash, if any.
+    //! \details Must be called before the published block's contents may change or leave the
+    //! primary pool.
+    void retract(size_t hash);
+
+    //! \brief Copy a peer replica's published block into dst (a primary block).
+    //! \details Synchronizes the copy and re-validates the index entry before reporting success.
+    //! \return True on a validated hit, false on a miss or when the entry went stale mid-copy.
+    bool onboard(size_t hash, BlockPtr const& dst, std::vector<KVCacheBlockPool> const& pools,
+        runtime::BufferManager const& bufferManager);
+
+    static constexpr uint32_t kMaxReplicas = 8;
+    static constexpr uint32_t kMaxPools = 8;
+
+private:
+    struct SegmentHeader;
+
+    //! \brief Get (or lazily open) the mapped base pointer of a peer replica's pool.
+    void* peerPoolPtr(uint32_t replica, uint32_t poolIdx);
+
+    std::string mSegmentName;
+    std::string mLogPrefix;
+    int mShmFd{-1};
+    SegmentHeader* mHeader{nullptr};
+    // Slot claimed in the segment's replica table, -1 until registerLocalPools succeeds.
+    int32_t mReplicaSlot{-1};
+    // Lazily opened IPC mappings of peer pools; guarded by mPeerPoolsMutex.
+    std::array<std::array<void*, kMaxPools>, kMaxReplicas> mPeerPools{};
+    std::mutex mPeerPoolsMutex;
+};
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -35,11 +35,13 @@
 
 #include <array>
 #include <cstdint>
+#include <future>
 #include <limits>
 #include <list>
 #include <memory>
 #include <optional>
 #include <set>
+#include <shared_mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -51,6 +53,11 @@ namespace tensorrt_llm::batch_manager::eviction_policy
 class BaseEvictionPolicy;
 } // namespace tensorrt_llm::batch_manager::eviction_policy
 
+namespace tensorrt_llm::runtime
+{
+class WorkerPool;
+} // namespace tensorrt_llm::runtime
+
 namespace tensorrt_llm::batch_manager::kv_cache_manager
 {
 
@@ -66,6 +73,9 @@ class KVCacheBlock;
 class BlockManager;
 class KVCacheManager;
 class KVCacheTransferManager;
+class KVCacheSpillManager;
+class KVCacheHostShareManager;
+class KVCachePrefixDigest;
 
 using SizeType32 = tensorrt_llm::runtime::SizeType32;
 using TokenIdType = tensorrt_llm::runtime::TokenIdType;
@@ -158,6 +168,11 @@ struct BlockKey
     std::vector<MmKey> extraKeys;
     std::optional<CacheSaltIDType> cacheSaltID = std::nullopt;
 
+    // Memoized prefix-agnostic hash (BlockKeyHasher with parentHash == 0), filled on first use.
+    // Lets background workers hash prompt blocks ahead of time and spares repeated token-walks
+    // when the same key is probed against several maps. Not part of the key's identity.
+    mutable std::optional<size_t> cachedHash = std::nullopt;
+
     BlockKey() = default;
 
     explicit BlockKey(VecTokens const& tokens, std::optional<LoraTaskIdType> loraTaskId = std::nullopt)
@@ -236,6 +251,30 @@ struct KvCacheStats
     std::map<SizeType32, SizeType32> numFreeBlocksPerWindowSize;
     // GPU bytes allocated for KV-cache
     std::size_t allocatedBytes{};
+    // Number of speculatively pre-allocated blocks later consumed by sequence growth.
+    SizeType32 preallocHitBlocks{};
+    // Number of speculatively pre-allocated blocks released unused.
+    SizeType32 preallocWastedBlocks{};
+    // Block capacity held by active sequences beyond the tokens actually stored, in tokens: the
+    // internal fragmentation of partially filled tail blocks imposed by the engine-global
+    // tokensPerBlock. Guides the block-size choice at engine build time.
+    SizeType32 tailWastedTokens{};
+};
+
+// Fragmentation snapshot of the block index space of one window's pools. A "free" slot is one
+// whose block carries no references; runs are maximal stretches of contiguous free slot indices.
+struct KvCacheFragmentationStats
+{
+    // Number of free blocks in the primary (GPU) / secondary (host) memory pool.
+    SizeType32 freeBlocksPrimary{0};
+    SizeType32 freeBlocksSecondary{0};
+    // Length of the longest run of contiguous free slots per pool. Equal to the free block count
+    // when the pool is unfragmented.
+    SizeType32 largestFreeRunPrimary{0};
+    SizeType32 largestFreeRunSecondary{0};
+    // Histogram of free-run lengths per pool; bucket i counts runs of length in [2^i, 2^(i+1)).
+    std::vector<SizeType32> freeRunHistogramPrimary;
+    std::vector<SizeType32> freeRunHistogramSecondary;
 };
 
 // Basic building block of a paged KV cache - a single
@@ -374,19 +413,22 @@ public:
 
     explicit GenerationRequest(LlmRequest::RequestIdType requestId, SizeType32 numTokens, SizeType32 beamWidth,
         std::map<SizeType32, WindowSizeMetadata> const& windowSizeToMetadata,
-        executor::KvCacheRetentionConfig kvCacheRetentionConfig = executor::KvCacheRetentionConfig())
+        executor::KvCacheRetentionConfig kvCacheRetentionConfig = executor::KvCacheRetentionConfig(),
+        SizeType32 numSinkBlocks = 0)
         : mRequestId(requestId)
         , mNumTokens(numTokens)
         , mBeamWidth(beamWidth)
         , mKvCacheRetentionConfig(std::move(kvCacheRetentionConfig))
-        , mNumFrontBlocksRemoved(0)
+        , mNumSinkBlocks(numSinkBlocks)
     {
         auto const numWindowSizes = windowSizeToMetadata.size();
         mCacheBlockIds.reserve(numWindowSizes);
         mCacheBlockIndices.reserve(numWindowSizes);
+        mNumFrontBlocksRemoved.reserve(numWindowSizes);
         for (auto const [windowSize, metadata] : windowSizeToMetadata)
         {
             mCacheBlockIds[windowSize] = std::vector<std::vector<KVCacheBlock::IdType>>(beamWidth);
+            mNumFrontBlocksRemoved[windowSize] = 0;
             auto const numPools = metadata.numPools;
             auto const maxBlocks = metadata.maxBlocksPerSeq;
             mCacheBlockIndices[windowSize]
@@ -422,9 +464,14 @@ public:
         return mNumTokens;
     }
 
-    [[nodiscard]] SizeType32 getNumFrontBlocksRemoved() const
+    [[nodiscard]] SizeType32 getNumFrontBlocksRemoved(SizeType32 windowSize) const
+    {
+        return mNumFrontBlocksRemoved.at(windowSize);
+    }
+
+    [[nodiscard]] SizeType32 getNumSinkBlocks() const
     {
-        return mNumFrontBlocksRemoved;
+        return mNumSinkBlocks;
     }
 
     [[nodiscard]] SizeType32 getBeamWidth() const
@@ -464,12 +511,12 @@ public:
         {
             beamBlockIds.clear();
         }
-        mNumFrontBlocksRemoved = 0;
+        mNumFrontBlocksRemoved.at(windowSize) = 0;
     }
 
     void removeFrontBlock(SizeType32 windowSize)
     {
-        ++mNumFrontBlocksRemoved;
+        ++mNumFrontBlocksRemoved.at(windowSize);
     }
 
     void removeLastBlock(SizeType32 windowSize)
@@ -480,6 +527,35 @@ public:
         }
     }
 
+    //! \brief Record n tail blocks reserved ahead of sequence growth.
+    void addPreallocatedBlocks(SizeType32 n)
+    {
+        mNumPreallocatedBlocks += n;
+    }
+
+    //! \brief Consume one reserved tail block, if any are left.
+    //! \return true when a reserved block covered this allocation step.
+    bool consumePreallocatedBlock()
+    {
+        if (mNumPreallocatedBlocks == 0)
+        {
+            return false;
+        }
+        --mNumPreallocatedBlocks;
+        ++mNumPreallocatedConsumed;
+        return true;
+    }
+
+    [[nodiscard]] SizeType32 getNumPreallocatedBlocks() const
+    {
+        return mNumPreallocatedBlocks;
+    }
+
+    [[nodiscard]] SizeType32 getNumPreallocatedConsumed() const
+    {
+        return mNumPreallocatedConsumed;
+    }
+
     [[nodiscard]] executor::RetentionPriority getDecodeRetentionPriority() const
     {
         return mKvCacheRetentionConfig.getDecodeRetentionPriority();
@@ -513,8 +589,16 @@ private:
     std::unordered_map<SizeType32, runtime::ITensor::SharedPtr> mCacheBlockIndices;
     // The retention priority to assign to decode blocks
     executor::KvCacheRetentionConfig mKvCacheRetentionConfig;
-    // Number of front blocks removed from the sequence
-    SizeType32 mNumFrontBlocksRemoved;
+    // Number of front blocks removed from the sequence, per window size. Kept per window so the
+    // per-window block managers can release a sequence concurrently without observing each
+    // other's detach counters.
+    std::unordered_map<SizeType32, SizeType32> mNumFrontBlocksRemoved;
+    // Number of leading blocks pinned as attention sinks; the sliding window rotates over the blocks behind them
+    SizeType32 mNumSinkBlocks;
+    // Number of tail blocks reserved ahead of sequence growth that are not covered by tokens yet
+    SizeType32 mNumPreallocatedBlocks{0};
+    // Number of reserved tail blocks that ended up covering an allocation step
+    SizeType32 mNumPreallocatedConsumed{0};
     // Set of used blocks by the sequence
     std::set<KVCacheBlock::IdType> mUsedBlocks;
 };
@@ -585,7 +669,8 @@ public:
         SizeType32 sizePerHead, SizeType32 tokensPerBlock, bool isSWA, SizeType32 blocksInPrimaryPool,
         SizeType32 blocksInSecondaryPool, SizeType32 maxNumSequences, std::shared_ptr<runtime::CudaStream> stream,
         bool onboardBlocks, CacheType cacheType, std::optional<executor::RetentionPriority> secondaryOffloadMinPriority,
-        std::shared_ptr<KVCacheEventManager> eventManager, bool enablePartialReuse, bool copyOnPartialReuse,
+        std::shared_ptr<KVCacheEventManager> eventManager, std::shared_ptr<KVCachePrefixDigest> prefixDigest,
+        bool enablePartialReuse, bool copyOnPartialReuse,
         std::shared_ptr<kv_connector::KvCacheConnectorManager> kvCacheConnectorManager,
         std::shared_ptr<kvc::BaseLoopbackAgent> loopbackAgent = nullptr);
 
@@ -626,6 +711,11 @@ public:
     //! \brief Simulate freeing all blocks for that sequence to check impact on number of free blocks
     void schedulingReleaseBlocks(LlmRequest::RequestIdType requestId);
 
+    //! \brief Demote the tail blocks of a sequence about to be paused to the minimum retention priority.
+    //! \details The leading ceil(residentPrefixFraction * numBlocks) blocks keep their priority; the
+    //! rest become the preferred eviction/offload victims once released. No-op for unknown requests.
+    void demotePausedSequenceTail(LlmRequest::RequestIdType requestId, float residentPrefixFraction);
+
     //! \brief Update cache offsets for last block
     void updateLastCacheBlockOffsets(GenerationRequest& seq);
 
@@ -776,6 +866,31 @@ public:
     void offloadBlock(BlockPtr const& block, executor::KvCacheTransferMode mode = executor::KvCacheTransferMode::DRAM,
         std::string const& directory = "");
 
+    //! \brief Compute a fragmentation snapshot of the primary and secondary block index spaces.
+    [[nodiscard]] KvCacheFragmentationStats calculateFragmentationStats() const;
+
+    //! \brief Compact the secondary (host) memory pool by relocating offloaded reuse-tree blocks
+    //! into the lowest free slots. Only unreferenced blocks are moved, so no sequence offset
+    //! tables need patching; intended to be called during idle iterations.
+    //! \param maxBlocksToMove Upper bound on the number of block relocations to perform.
+    //! \return The number of blocks that were relocated.
+    SizeType32 compactSecondaryPool(SizeType32 maxBlocksToMove);
+
+    //! \brief Take up to numBlocks free primary blocks out of circulation, lowering the capacity
+    //! visible to the scheduler. Reusable content held by the drained blocks is evicted in the
+    //! order dictated by the eviction policy; blocks referenced by running sequences are never taken.
+    //! \return The number of blocks actually drained.
+    SizeType32 drainFreeBlocks(SizeType32 numBlocks);
+
+    //! \brief Return up to numBlocks previously drained blocks to circulation.
+    //! \return The number of blocks actually restored.
+    SizeType32 restoreDrainedBlocks(SizeType32 numBlocks);
+
+    [[nodiscard]] SizeType32 getNumDrainedBlocks() const noexcept
+    {
+        return static_cast<SizeType32>(mDrainedBlocks.size());
+    }
+
     //! \brief Find first new block that must be allocated for context phase and return it's concatenated token vectors.
     //! \details Only full blocks are considered.
     [[nodiscard]] std::optional<BlockKey> findNewContextBlock(
@@ -876,6 +991,9 @@ private:
     //! \brief Calls KVCacheBlock::freeLeafBlock to remove block from search tree.
     void freeLeafBlock(BlockPtr const& block);
 
+    //! \brief Fill cached hashes of blockKeys from the background hashing job of the request, if any.
+    void applyPrefetchedHashes(LlmRequest::RequestIdType requestId, std::vector<BlockKey>& blockKeys);
+
     //! \brief For FP4 quantization. Creates pool objects for FP4 block scalars.
     void createBlockScalePools(SizeType32 blockSize);
 
@@ -890,6 +1008,11 @@ private:
     // List of allocated blocks for each sequences
     std::unordered_map<LlmRequest::RequestIdType, std::vector<BlockPtr>> mAllocatedBlocksPerSeq;
 
+    // Ring-buffer mode for SWA: out-of-window blocks stashed here instead of being returned to
+    // the free store, to be rebound as the sequence's next tail block without touching the
+    // free list. At most one block per sequence.
+    std::unordered_map<LlmRequest::RequestIdType, BlockPtr> mRecycledBlockPerSeq;
+
     // Pool per unique numKvHeads in the model
     std::vector<KVCacheBlockPool> mPools;
 
@@ -912,6 +1035,8 @@ private:
     bool mIsSWA;
     // List of all blocks by idx
     std::vector<BlockPtr> mAllBlocksById;
+    // Free primary blocks taken out of circulation by drainFreeBlocks
+    std::vector<BlockPtr> mDrainedBlocks;
     // Dummy block acting as root for BlockToken searches
     BlockPtr mCachedBlocksRoot;
     // KV cache type (self or cross)
@@ -920,10 +1045,16 @@ private:
     std::shared_ptr<BaseEvictionPolicy> mEvictionPolicy;
     // Event manager
     std::shared_ptr<KVCacheEventManager> mEventManager;
+    // Bloom-filter digest over stored block hashes, shared across window managers
+    std::shared_ptr<KVCachePrefixDigest> mPrefixDigest;
     // Pointer to parent loopback agent
     std::shared_ptr<kvc::BaseLoopbackAgent> mLoopbackAgent;
     // Transfer manager
     std::shared_ptr<KVCacheTransferManager> mTransferManager;
+    // Tertiary, file-backed cache tier. nullptr unless spilling is enabled.
+    std::shared_ptr<KVCacheSpillManager> mSpillManager;
+    // Cross-replica block sharing over CUDA IPC. nullptr unless host sharing is enabled.
+    std::shared_ptr<KVCacheHostShareManager> mShareManager;
 
     // Statistics for block allocations/reuse
     // Total number of blocks allocated by all requests
@@ -952,8 +1083,17 @@ private:
     // The kv cache connector manager
     std::shared_ptr<kv_connector::KvCacheConnectorManager> mKvCacheConnectorManager;
 
-    // Mutex for the cached blocks root
-    std::mutex mCachedBlocksRootMutex;
+    // Reader/writer lock for the reuse search tree rooted at mCachedBlocksRoot.
+    // Mutating walks (loadOrAllocateBlocks, storeBlocks) take the lock exclusively; read-only
+    // lookups from the scheduler thread and the KV event manager take it shared so they can
+    // query the tree concurrently without serializing on each other.
+    mutable std::shared_mutex mCachedBlocksRootMutex;
+
+    // Worker pool that hashes prompt block keys while the context phase executes, so storing
+    // blocks for reuse does not recompute token-sequence hashes on the batch loop.
+    std::shared_ptr<runtime::WorkerPool> mHashWorkerPool;
+    // Pending background hashing jobs, keyed by request id.
+    std::unordered_map<LlmRequest::RequestIdType, std::future<std::vector<size_t>>> mPendingBlockHashes;
 
     // Record which sequence is using the block
     std::map<KVCacheBlock::IdType, LlmRequest::RequestIdType> mBlockToSequence;
@@ -1020,6 +1160,8 @@ public:
 
     void schedulingReleaseBlocks(LlmRequest::RequestIdType requestId);
 
+    void demotePausedSequenceTail(LlmRequest::RequestIdType requestId, float residentPrefixFraction);
+
     /// @brief Pin all blocks associated with a sequence across all window managers.
     /// @param sequence The generation request whose blocks should be pinned.
     void pinBlocks(GenerationRequest& sequence);
@@ -1045,6 +1187,23 @@ public:
     void offloadBlock(BlockPtr const& block, SizeType32 windowSize,
         executor::KvCacheTransferMode mode = executor::KvCacheTransferMode::DRAM, std::string const& directory = "");
 
+    //! \brief Compute a fragmentation snapshot for every configured attention-window size.
+    [[nodiscard]] std::map<SizeType32, KvCacheFragmentationStats> calculateFragmentationStats() const;
+
+    //! \brief Compact the secondary (host) pools of all window sizes. See
+    //! WindowBlockManager::compactSecondaryPool.
+    //! \return The total number of blocks that were relocated.
+    SizeType32 compactSecondaryPools(SizeType32 maxBlocksToMove);
+
+    //! \brief Take up to numBlocks free primary blocks out of circulation, spread across the
+    //! window sizes in proportion to their pool sizes. See WindowBlockManager::drainFreeBlocks.
+    //! \return The number of blocks actually drained.
+    SizeType32 drainFreeBlocks(SizeType32 numBlocks);
+
+    //! \brief Return up to numBlocks previously drained blocks to circulation.
+    //! \return The number of blocks actually restored.
+    SizeType32 restoreDrainedBlocks(SizeType32 numBlocks);
+
     [[nodiscard]] std::pair<SizeType32, std::optional<KVCacheBlock::IdType>> storeBlocks(
         std::vector<BlockKey> const& blockKeys, std::vector<KVCacheBlock::IdType> const& blockIds,
         SizeType32 windowSize, bool pinBlocks = false)
@@ -1143,6 +1302,8 @@ public:
     [[nodiscard]] std::deque<executor::KVCacheEvent> getLatestEvents(
         std::optional<std::chrono::milliseconds> timeout) const;
 
+    [[nodiscard]] executor::KVCachePrefixDigest getPrefixDigest() const;
+
     void flushIterationEvents()
     {
         if (mEventManager)
@@ -1334,9 +1495,15 @@ private:
     }
 
 private:
+    //! \brief Run a task for every window block manager, fanned out over mWindowWorkerPool when the
+    //! model has several window sizes. The calling thread processes the first window itself and
+    //! rethrows any worker exception. windowIdx follows the mWindowBlockManagers iteration order.
+    void runPerWindow(std::function<void(size_t windowIdx, WindowBlockManager&)> const& task);
+
     SizeType32 mNumLayers;
     SizeType32 mTokensPerBlock;
     std::shared_ptr<KVCacheEventManager> mEventManager;
+    std::shared_ptr<KVCachePrefixDigest> mPrefixDigest;
     std::shared_ptr<kvc::BaseLoopbackAgent> mLoopbackAgent;
     CudaStreamPtr mStream;
     CacheType mCacheType;
@@ -1345,6 +1512,9 @@ private:
     bool mIsVariableGQA;
 
     std::map<SizeType32, WindowBlockManager> mWindowBlockManagers;
+    // Workers for cross-window bookkeeping of multi-window (VSWA) models, one per window beyond the
+    // first; nullptr for single-window models, which run every per-window task inline.
+    std::shared_ptr<runtime::WorkerPool> mWindowWorkerPool;
     std::map<SizeType32, WindowSizeMetadata> mWindowSizeToMetadata;
     std::vector<SizeType32> mLayerToWindowSize;
     std::vector<SizeType32> mAbsolutePoolToWindowSize;
@@ -1396,6 +1566,13 @@ public:
         std::optional<std::chrono::milliseconds> timeout = std::nullopt) const
         = 0;
 
+    /// @brief Snapshot of the Bloom-filter digest over the block hashes currently stored for reuse.
+    /// Managers that do not track reuse return an empty digest.
+    [[nodiscard]] virtual executor::KVCachePrefixDigest getPrefixDigest() const
+    {
+        return {};
+    }
+
     [[nodiscard]] virtual BlockManager const& getBlockManager() const = 0;
 
     /// @brief  Function that computes the number of KV cache blocks needed to advance a request by one or two
@@ -1413,6 +1590,26 @@ public:
     [[nodiscard]] virtual SizeType32 getRemainingBlocksToCompletion(LlmRequest const& req, SizeType32 windowSize) const
         = 0;
 
+    /// @brief Check whether every window's free pool can absorb the full KV cache of req while keeping a one-block
+    /// growth margin per active sequence. Used to gate the disaggregated-generation prefetch that reserves blocks and
+    /// starts KV reception before the capacity scheduler admits the request.
+    [[nodiscard]] virtual bool canPrefetchRequest(LlmRequest const& /*req*/) const
+    {
+        return false;
+    }
+
+    /// @brief Shrink schedulable KV cache capacity by taking up to numBlocks free primary blocks out of
+    /// circulation, e.g. to hand GPU memory to a co-located job. Reusable content held by the drained
+    /// blocks is evicted per the retention policy; blocks of running requests are never taken, so
+    /// repeated calls may be needed to reach the target as requests complete. The capacity scheduler
+    /// observes the reduction through the free-block counts.
+    /// @return The number of blocks actually removed.
+    virtual SizeType32 shrinkCapacity(SizeType32 numBlocks) = 0;
+
+    /// @brief Return up to numBlocks blocks previously removed by shrinkCapacity to circulation.
+    /// @return The number of blocks actually returned.
+    virtual SizeType32 growCapacity(SizeType32 numBlocks) = 0;
+
     /// @brief Pin blocks associated with a request to prevent eviction.
     /// @param requestId The ID of the request whose blocks should be pinned.
     virtual void pinBlocks(LlmRequest::RequestIdType requestId) = 0;
@@ -1456,6 +1653,24 @@ public:
     // void removeToken(SizeType32 seqSlotIdx);
     virtual void rewindKVCache(LlmRequest::RequestIdType requestId, SizeType32 rewindLengths) = 0;
 
+    //! \brief Rewind the caches of a batch of sequences at once, e.g. after draft-token rejection.
+    //! \details Equivalent to rewinding each request individually; implementations may resolve all
+    //! sequences in one pass instead of once per request.
+    virtual void rewindKVCacheBatched(
+        std::vector<std::pair<LlmRequest::RequestIdType, SizeType32>> const& rewindLengths)
+    {
+        for (auto const& [requestId, rewindLength] : rewindLengths)
+        {
+            rewindKVCache(requestId, rewindLength);
+        }
+    }
+
+    //! \brief Grade the retention priorities of a sequence that is about to be paused.
+    //! \details Called before the sequence's blocks are released so that, under memory pressure,
+    //! eviction and offload relieve pressure from the sequence's tail while the prefix stays
+    //! resident for reuse on resume. No-op by default.
+    virtual void preparePausedSequenceRetention(LlmRequest::RequestIdType /*requestId*/) {}
+
     [[nodiscard]] virtual GenerationRequest const& getSequence(LlmRequest::RequestIdType requestId) const = 0;
     [[nodiscard]] virtual GenerationRequest& getSequence(LlmRequest::RequestIdType requestId) = 0;
 
@@ -1694,6 +1909,9 @@ public:
                 / static_cast<float>(kvCacheStats.reusedBlocks + kvCacheStats.missedBlocks);
         kvCacheStats.numFreeBlocksPerWindowSize = getNumFreeBlocksPerWindowSize();
         kvCacheStats.allocatedBytes = mAllocatedBytes;
+        kvCacheStats.preallocHitBlocks = mPreallocHitBlocks;
+        kvCacheStats.preallocWastedBlocks = mPreallocWastedBlocks;
+        kvCacheStats.tailWastedTokens = calculateTailWastedTokens();
         return kvCacheStats;
     }
 
@@ -1714,6 +1932,11 @@ public:
         return mBlockManager.getLatestEvents(timeout);
     }
 
+    [[nodiscard]] executor::KVCachePrefixDigest getPrefixDigest() const override
+    {
+        return mBlockManager.getPrefixDigest();
+    }
+
     [[nodiscard]] BlockManager const& getBlockManager() const override
     {
         return mBlockManager;
@@ -1733,6 +1956,8 @@ public:
     [[nodiscard]] SizeType32 getRemainingBlocksToCompletion(
         LlmRequest const& req, SizeType32 windowSize) const override;
 
+    [[nodiscard]] bool canPrefetchRequest(LlmRequest const& req) const override;
+
     /// @brief Increase size for request with requestId. Allocate new KV cache block(s) if needed.
     void addToken(LlmRequest::RequestIdType requestId) override;
 
@@ -1780,6 +2005,10 @@ public:
 
     void removeToken(LlmRequest::RequestIdType requestId);
     void rewindKVCache(LlmRequest::RequestIdType requestId, SizeType32 rewindLengths) override;
+    void rewindKVCacheBatched(
+        std::vector<std::pair<LlmRequest::RequestIdType, SizeType32>> const& rewindLengths) override;
+
+    void preparePausedSequenceRetention(LlmRequest::RequestIdType requestId) override;
 
     [[nodiscard]] GenerationRequest const& getSequence(LlmRequest::RequestIdType requestId) const override;
     [[nodiscard]] GenerationRequest& getSequence(LlmRequest::RequestIdType requestId) override;
@@ -1825,6 +2054,10 @@ public:
     [[nodiscard]] static SizeType32 calculateMaxBlockRequirements(SizeType32 inputLength, SizeType32 outputLength,
         SizeType32 sinkTokenLength, SizeType32 windowSize, SizeType32 beamWidth, SizeType32 tokensPerBlock);
 
+    SizeType32 shrinkCapacity(SizeType32 numBlocks) override;
+
+    SizeType32 growCapacity(SizeType32 numBlocks) override;
+
     void pinBlocks(LlmRequest::RequestIdType requestId) override;
 
     void unpinBlocksById(KVCacheBlock::IdType blockId) override;
@@ -1885,6 +2118,21 @@ public:
         SizeType32 sinkTokenLength, SizeType32 blockCapacity, SizeType32 beamWidth, SizeType32 tokensPerBlock);
 
 private:
+    /// @brief Sum, over all active sequences and windows, the tokens of block capacity held beyond
+    ///        the tokens actually stored. Blocks have a single engine-global size, so this is the
+    ///        internal fragmentation of the partially filled tail blocks.
+    [[nodiscard]] SizeType32 calculateTailWastedTokens() const;
+
+    /// @brief Remove the last rewindLengths tokens of a sequence and release the vacated blocks.
+    void rewindSequence(GenerationRequest& sequence, SizeType32 rewindLengths);
+
+    /// @brief Record the output length (in blocks) of a finished sequence in the prediction histogram.
+    void recordFinishedSequence(SizeType32 numOutputBlocks);
+
+    /// @brief Predict the number of output blocks a new sequence will need, based on finished sequences.
+    /// @return 0 until enough sequences have finished to make a prediction.
+    [[nodiscard]] SizeType32 predictOutputBlocks() const;
+
     // Maximum number of sequences
     SizeType32 mMaxNumSequences;
     // Maximum beam width
@@ -1912,6 +2160,15 @@ private:
     runtime::ITensor::SharedPtr mBlockScalePoolPointers;
     // GPU bytes allocated for KV-cache
     std::size_t mAllocatedBytes{0};
+    // Histogram over the output length (in blocks) of finished sequences, used to predict how many
+    // blocks a new sequence will need when speculative pre-allocation is enabled
+    std::vector<SizeType32> mOutputBlocksHistogram;
+    // Number of finished sequences recorded in the histogram
+    SizeType32 mNumFinishedSequences{0};
+    // Pre-allocated blocks that ended up covering an allocation step
+    SizeType32 mPreallocHitBlocks{0};
+    // Pre-allocated blocks still unused when their sequence finished
+    SizeType32 mPreallocWastedBlocks{0};
 };
 
 } // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/runtime/common.h"
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+// KVCachePrefixDigest maintains a counting Bloom filter over the chained hashes (see
+// BlockKeyHasher) of the blocks currently stored for reuse, so fleet routers can learn which
+// replica holds which prefix from a few kilobytes of state instead of subscribing to the full
+// KV cache event stream. Hashes are inserted when blocks enter the radix tree and removed when
+// they leave it, mirroring the stored/removed event protocol.
+//
+// The counters stay private; snapshot() packs them into the plain bitset documented on
+// executor::KVCachePrefixDigest, which is what the executor endpoint returns. Counters
+// saturate at 255 and are never decremented past saturation, so heavy churn on a bucket can
+// only add false positives, never false negatives.
+class KVCachePrefixDigest
+{
+public:
+    using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+    // 64Ki bits make an 8 KiB snapshot; with 4 probes the false positive rate stays below 1%
+    // up to roughly 6K stored blocks.
+    static constexpr SizeType32 kDefaultNumBits = 1 << 16;
+    static constexpr SizeType32 kDefaultNumHashes = 4;
+
+    explicit KVCachePrefixDigest(
+        SizeType32 numBits = kDefaultNumBits, SizeType32 numHashes = kDefaultNumHashes);
+
+    //! \brief Record that a block with the given hash was stored for reuse.
+    void insert(std::size_t hash);
+
+    //! \brief Record that a block with the given hash left the reuse tree.
+    void remove(std::size_t hash);
+
+    //! \brief Pack the current filter into the wire format polled by routers.
+    [[nodiscard]] executor::KVCachePrefixDigest snapshot() const;
+
+private:
+    SizeType32 const mNumBits;
+    SizeType32 const mNumHashes;
+    uint64_t mVersion{0};
+    std::vector<uint8_t> mCounters;
+    mutable std::mutex mMutex;
+};
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
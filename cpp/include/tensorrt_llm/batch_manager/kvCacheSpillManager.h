@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/iTensor.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+// KVCacheSpillManager implements a tertiary, file-backed cache tier below the GPU (primary)
+// and host (secondary) pools managed by WindowBlockManager.
+//
+// When the secondary pool is exhausted, the least valuable host-resident block would normally
+// be overwritten and its contents lost. With spilling enabled, the block contents are copied
+// into a staging buffer and written to a per-window-size directory on a background thread, so
+// cold prefixes survive beyond host memory and can be onboarded again on a later reuse match.
+//
+// Files are keyed by the block's chained hash (see BlockKeyHasher), one file per memory pool.
+// Total on-disk footprint is bounded; the oldest spilled blocks are unlinked first.
+//
+// Spilling is enabled via TRTLLM_KVCACHE_SPILL_DIRECTORY; the on-disk budget is controlled by
+// TRTLLM_KVCACHE_SPILL_MAX_GB (default 64). Writes use regular pwrite on the staging copy;
+// the staging copy is taken synchronously from pinned host memory so the source block can be
+// reused immediately.
+class KVCacheSpillManager
+{
+public:
+    using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+    //! \brief Create a spill manager if TRTLLM_KVCACHE_SPILL_DIRECTORY is set, nullptr otherwise.
+    static std::shared_ptr<KVCacheSpillManager> createFromEnv(std::string const& logPrefix);
+
+    KVCacheSpillManager(std::string directory, size_t maxBytes, std::string logPrefix);
+    ~KVCacheSpillManager();
+
+    //! \brief Spill contents of a host-resident block to disk before the block is repurposed.
+    //! \details Copies the block's bytes for every pool into a staging buffer synchronously and
+    //! enqueues the file write on the background thread. No-op for blocks without tokens.
+    void spill(BlockPtr const& block, std::vector<KVCacheBlockPool> const& pools);
+
+    //! \brief True if a spilled copy of the block with the given chained hash exists.
+    [[nodiscard]] bool contains(size_t hash) const;
+
+    //! \brief Read a spilled block back and copy it into dst (a primary block).
+    //! \details Blocks until any in-flight write of the same hash has completed.
+    //! \return True on success, false if the spilled copy is missing or unreadable.
+    bool onboard(size_t hash, BlockPtr const& dst, std::vector<KVCacheBlockPool> const& pools,
+        runtime::BufferManager const& bufferManager);
+
+    [[nodiscard]] size_t getNumSpilledBlocks() const;
+
+private:
+    struct SpillTask
+    {
+        size_t hash;
+        std::vector<std::vector<char>> poolBytes;
+    };
+
+    struct SpillEntry
+    {
+        size_t bytes;
+        std::list<size_t>::iterator lruIt;
+    };
+
+    void writerLoop();
+    void writeTask(SpillTask const& task);
+    void evictUntilWithinBudget();
+    [[nodiscard]] std::string blockFilename(size_t hash, size_t poolIdx) const;
+
+    std::string mDirectory;
+    size_t mMaxBytes;
+    size_t mTotalBytes{0};
+    std::string mLogPrefix;
+
+    // hash -> on-disk entry; guarded by mMutex
+    std::unordered_map<size_t, SpillEntry> mSpilledBlocks;
+    // LRU order of spilled hashes, oldest first; guarded by mMutex
+    std::list<size_t> mLruOrder;
+    // hashes with a queued or in-flight write; guarded by mMutex
+    std::unordered_map<size_t, int> mPendingWrites;
+
+    std::deque<SpillTask> mTaskQueue;
+    mutable std::mutex mMutex;
+    std::condition_variable mTaskCv;
+    std::condition_variable mDoneCv;
+    bool mShutdown{false};
+    std::thread mWriterThread;
+};
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
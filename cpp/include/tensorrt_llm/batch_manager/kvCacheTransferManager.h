@@ -19,6 +19,9 @@
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
 
+#include <array>
+#include <unordered_set>
+
 namespace tr = tensorrt_llm::runtime;
 namespace kvc = tensorrt_llm::executor::kv_cache;
 
@@ -47,13 +50,28 @@ public:
         std::string const& directory = "");
 
     //! \brief Synchronize the offload/onboard streams with the bufferManager stream.
+    //! \details Flushes any deferred batched copies first.
     void syncTransfers();
 
 private:
+    //! \brief A full-block copy held back for batched submission.
+    struct DeferredCopy
+    {
+        tr::ITensor::SharedPtr src;
+        tr::ITensor::SharedPtr dst;
+    };
+
     //! \brief Get pointer to pool specified by cache block.
     static tr::ITensor::SharedPtr computeBlockPointer(
         BlockPtr const& block, std::vector<KVCacheBlockPool> const& pools, size_t poolIdx);
 
+    //! \brief Get (or lazily allocate) the per-pool FP8 scale scratch for an offloaded block.
+    tr::ITensor::SharedPtr getBlockScales(int32_t offloadBlockId, size_t numPools);
+
+    //! \brief Submit all deferred copies as batched kernel launches on the offload/onboard streams.
+    //! \details Records one offload event shared by all blocks offloaded in the flushed batch.
+    void flushDeferredCopies();
+
     /*!
      * \brief The key method that copies the src block to the dst block.
      *
@@ -75,8 +93,19 @@ private:
     runtime::BufferManager mOnboardManager;
     runtime::BufferManager mOffloadManager;
 
-    // Track the block ids offloaded in this iteration.
-    std::unordered_map<int32_t, tr::CudaEvent> mPendingOffloads;
+    // Track the block ids offloaded in this iteration. Blocks offloaded in the same batch
+    // share one event, recorded when the batch is flushed.
+    std::unordered_map<int32_t, std::shared_ptr<tr::CudaEvent>> mPendingOffloads;
+    // Full-block DRAM copies aggregated into batched kernel launches. Index 0 holds onboard
+    // (H2D) copies, index 1 holds offload (D2H) copies.
+    std::array<std::vector<DeferredCopy>, 2> mDeferredCopies;
+    // Block ids whose offload copy is still deferred (not yet submitted to the stream).
+    std::unordered_set<int32_t> mDeferredOffloadBlockIds;
+    // Offload block ids whose secondary-pool copy holds an FP8 payload instead of the pool dtype.
+    std::unordered_set<int32_t> mCompressedOffloads;
+    // Per offload block: one float of device memory per pool holding the block absmax used for
+    // FP8 (de)quantization. Allocated lazily, reused across offloads of the same block slot.
+    std::unordered_map<int32_t, tr::ITensor::SharedPtr> mBlockScales;
     // Reference to parent loopback agent
     std::shared_ptr<kvc::BaseLoopbackAgent> mLoopbackAgent;
     int mDeviceId;
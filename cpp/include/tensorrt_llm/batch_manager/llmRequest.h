@@ -30,6 +30,7 @@
 #include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <list>
 #include <memory>
 #include <optional>
@@ -79,6 +80,18 @@ enum LlmRequestType
 
 class ContextProgress;
 
+//! @brief Borrow token vector storage with retained capacity from the process-wide freelist.
+//! Returns an empty vector (possibly without capacity) when the freelist is empty or recycling is disabled.
+std::vector<runtime::TokenIdType> acquirePooledTokenStorage();
+
+//! @brief Donate grown token vector storage to the process-wide freelist. Only has an effect when
+//! recycling is enabled via TRTLLM_LLMREQUEST_TOKEN_POOL_SIZE.
+void recyclePooledTokenStorage(std::vector<runtime::TokenIdType>&& storage);
+
+//! @brief Per-request budget in bytes for the pinned host buffers attributed to a single request,
+//! derived from TRTLLM_REQUEST_HOST_MEMORY_BUDGET_MB. 0 disables the budget.
+[[nodiscard]] std::size_t requestHostMemoryBudgetBytes();
+
 template <typename TTensor, typename TStream = runtime::BufferManager::CudaStreamPtr>
 class GenericLlmRequest
 {
@@ -332,6 +345,13 @@ public:
             mReturnGenerationLogits = false;
         }
 
+        mTopKLogits = req.getOutputConfig().topKLogits;
+        if (mTopKLogits.has_value())
+        {
+            TLLM_CHECK_WITH_INFO(mReturnGenerationLogits && mIsStreaming,
+                "topKLogits is only supported for streaming requests with returnGenerationLogits enabled");
+        }
+
         if (req.getEncoderInputTokenIds().has_value() || req.getEncoderInputFeatures().has_value())
         {
             mState = LlmRequestState::kENCODER_INIT;
@@ -416,6 +436,9 @@ public:
             // NOTE: Draft acceptance threshold is stored in mSamplingConfig
         }
 
+        mReturnDeltaLogProbs = req.getOutputConfig().returnDeltaLogProbs;
+        mPackedLogProbs = req.getOutputConfig().packedLogProbs;
+
         if (req.getOutputConfig().additionalModelOutputs.has_value())
         {
             auto const& outputConfig = req.getOutputConfig();
@@ -479,6 +502,17 @@ public:
 
     GenericLlmRequest(GenericLlmRequest&& request) = default;
     GenericLlmRequest(GenericLlmRequest const& request) = default;
+    GenericLlmRequest& operator=(GenericLlmRequest&& request) = default;
+    GenericLlmRequest& operator=(GenericLlmRequest const& request) = default;
+
+    ~GenericLlmRequest()
+    {
+        // Donate the grown per-beam token storage so the next request starts with its capacity.
+        for (auto& beamTokens : mTokens)
+        {
+            recyclePooledTokenStorage(std::move(beamTokens));
+        }
+    }
 
     void setExcludeInputFromOutput(bool exclude)
     {
@@ -690,6 +724,13 @@ public:
         return mLlmRequestType;
     }
 
+    /// @brief Change the request type, e.g. to context-only when an executor drain hands the
+    /// request off for resumption on another instance.
+    void setLlmRequestType(LlmRequestType llmRequestType)
+    {
+        mLlmRequestType = llmRequestType;
+    }
+
     /// @brief Add new generated tokens to the vector of tokens and set mLastTokens
     /// @param token The token to add
     /// @param beam The beam to which to add the new token
@@ -1023,6 +1064,26 @@ public:
         mSamplingConfig.cumLogProbs = {{returnLogProbs}};
     }
 
+    [[nodiscard]] bool returnDeltaLogProbs() const
+    {
+        return mReturnDeltaLogProbs;
+    }
+
+    void setReturnDeltaLogProbs(bool returnDeltaLogProbs)
+    {
+        mReturnDeltaLogProbs = returnDeltaLogProbs;
+    }
+
+    [[nodiscard]] bool packedLogProbs() const
+    {
+        return mPackedLogProbs;
+    }
+
+    void setPackedLogProbs(bool packedLogProbs)
+    {
+        mPackedLogProbs = packedLogProbs;
+    }
+
     [[nodiscard]] std::vector<VecLogProbs> const& getLogProbs() const
     {
         return mLogProbs;
@@ -1188,8 +1249,8 @@ public:
 
     void allocEncoderOutputHost(SizeType32 encoderHiddenSize, nvinfer1::DataType dataType)
     {
-        mEncoderOutputHost = runtime::BufferManager::pinned(
-            runtime::ITensor::makeShape({getEncoderOutputLen(), encoderHiddenSize}), dataType);
+        mEncoderOutputHost = allocHostTensorWithinBudget(
+            runtime::ITensor::makeShape({getEncoderOutputLen(), encoderHiddenSize}), dataType, /*pooled=*/false);
     }
 
     [[nodiscard]] TensorPtr const& getEncoderOutput() const noexcept
@@ -1258,6 +1319,8 @@ public:
         if (mPerfMetrics.timingMetrics.firstScheduledTime == executor::RequestPerfMetrics::TimePoint{})
         {
             mPerfMetrics.timingMetrics.firstScheduledTime = getSteadyClockNow();
+            mTimeInQueueMS
+                = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mStartTime).count();
         }
     }
 
@@ -1326,9 +1389,48 @@ public:
         mContextLogitsHost = std::move(contextLogitsHost);
     }
 
+    /// @brief Allocate a pinned host tensor charged against this request's memory budget.
+    /// @details Host buffers that scale with a single request (logits staging, encoder output,
+    /// additional outputs) draw from a per-request budget (TRTLLM_REQUEST_HOST_MEMORY_BUDGET_MB)
+    /// so a pathological request is failed individually instead of exhausting host memory for the
+    /// whole executor. Throws a RequestSpecificException when the budget would be exceeded or the
+    /// allocation itself fails.
+    [[nodiscard]] TensorPtr allocHostTensorWithinBudget(
+        runtime::ITensor::Shape const& shape, nvinfer1::DataType dataType, bool pooled = true)
+    {
+        auto const bytes
+            = static_cast<std::size_t>(runtime::ITensor::volume(shape)) * runtime::BufferDataType(dataType).getSize();
+        auto const budget = requestHostMemoryBudgetBytes();
+        if (budget > 0 && mHostMemoryBytes + bytes > budget)
+        {
+            throw TLLM_REQUEST_EXCEPTION(mRequestId, common::RequestErrorCode::kMEMORY_ALLOCATION_ERROR,
+                "Request would exceed its host memory budget: %zu bytes requested, %zu bytes already in use, budget "
+                "is %zu bytes",
+                bytes, mHostMemoryBytes, budget);
+        }
+        try
+        {
+            auto tensor = pooled ? runtime::BufferManager::pinnedPool(shape, dataType)
+                                 : runtime::BufferManager::pinned(shape, dataType);
+            mHostMemoryBytes += bytes;
+            return tensor;
+        }
+        catch (std::exception const& e)
+        {
+            throw TLLM_REQUEST_EXCEPTION(mRequestId, common::RequestErrorCode::kMEMORY_ALLOCATION_ERROR,
+                "Failed to allocate %zu bytes of host memory for request: %s", bytes, e.what());
+        }
+    }
+
+    /// @brief Host bytes currently charged against this request's memory budget.
+    [[nodiscard]] std::size_t getHostMemoryBytes() const noexcept
+    {
+        return mHostMemoryBytes;
+    }
+
     void allocContextLogitsHost(SizeType32 vocabSizePadded, nvinfer1::DataType logitsDataType)
     {
-        mContextLogitsHost = runtime::BufferManager::pinnedPool(
+        mContextLogitsHost = allocHostTensorWithinBudget(
             runtime::ITensor::makeShape({mPromptLen, vocabSizePadded}), logitsDataType);
     }
 
@@ -1337,6 +1439,18 @@ public:
         return mGenerationLogitsHost;
     }
 
+    //! @brief Number of top logits to compact the generation logits to, when enabled.
+    [[nodiscard]] std::optional<SizeType32> getTopKLogits() const
+    {
+        return mTopKLogits;
+    }
+
+    //! @brief Token ids of the compacted generation logits columns, same shape as the host logits.
+    [[nodiscard]] TensorPtr const& getGenerationLogitsTopKIndicesHost() const
+    {
+        return mGenerationLogitsTopKIndicesHost;
+    }
+
     /// @param generationLogitsHost Expected shape
     /// * [beamWidth, maxNewTokens, vocabSizePadded] for non-speculative decoding
     /// * [1, numDraftTokens + 1, vocabSizePadded] for speculative decoding
@@ -1352,13 +1466,21 @@ public:
             // If streaming mode, the complete generation logits shape will be [1, beamWidth, vocabSizePadded],
             // or [allGeneratedTokens, beamWidth, vocabSizePadded] if mReturnAllGeneratedTokens is True.
             // This could reduce unnecessary format conversions and allows the data to be returned directly.
-            mGenerationLogitsHost = runtime::BufferManager::pinnedPool(
-                runtime::ITensor::makeShape({mMaxNewTokens, mSamplingConfig.beamWidth, vocabSizePadded}),
-                logitsDataType);
+            // When the top-K entries are compacted on device, the last dimension shrinks to K and the
+            // token ids of the surviving columns are staged next to the values.
+            auto const logitsWidth = mTopKLogits.value_or(vocabSizePadded);
+            mGenerationLogitsHost = allocHostTensorWithinBudget(
+                runtime::ITensor::makeShape({mMaxNewTokens, mSamplingConfig.beamWidth, logitsWidth}), logitsDataType);
+            if (mTopKLogits.has_value())
+            {
+                mGenerationLogitsTopKIndicesHost = allocHostTensorWithinBudget(
+                    runtime::ITensor::makeShape({mMaxNewTokens, mSamplingConfig.beamWidth, logitsWidth}),
+                    nvinfer1::DataType::kINT32);
+            }
         }
         else
         {
-            mGenerationLogitsHost = runtime::BufferManager::pinnedPool(
+            mGenerationLogitsHost = allocHostTensorWithinBudget(
                 runtime::ITensor::makeShape({mSamplingConfig.beamWidth, mMaxNewTokens, vocabSizePadded}),
                 logitsDataType);
         }
@@ -1366,7 +1488,7 @@ public:
 
     void allocTargetModelAcceptedTokenLogitsHost(SizeType32 vocabSizePadded, nvinfer1::DataType logitsDataType)
     {
-        mGenerationLogitsHost = runtime::BufferManager::pinnedPool(
+        mGenerationLogitsHost = allocHostTensorWithinBudget(
             runtime::ITensor::makeShape({1, getNumDraftTokens() + 1, vocabSizePadded}), logitsDataType);
     }
 
@@ -1416,7 +1538,7 @@ public:
             TLLM_CHECK_WITH_INFO(shape.d[0] == -1, "First dimension of additional output tensor '%s' must be dynamic",
                 outputTensorName.c_str());
             shape.d[0] = mPromptLen;
-            auto tensor = runtime::BufferManager::pinnedPool(shape, dataType);
+            auto tensor = allocHostTensorWithinBudget(shape, dataType);
             outputTensor.second = std::move(tensor);
         }
         for (auto& outputTensor : mAdditionalGenerationOutputTensors)
@@ -1429,7 +1551,7 @@ public:
             shape.d[0] = mMaxNewTokens;
             shape = runtime::ITensor::unsqueeze(shape, 0);
             shape.d[0] = mSamplingConfig.beamWidth;
-            auto tensor = runtime::BufferManager::pinnedPool(shape, dataType);
+            auto tensor = allocHostTensorWithinBudget(shape, dataType);
             outputTensor.second = std::move(tensor);
         }
     }
@@ -1437,6 +1559,15 @@ public:
     void setState(LlmRequestState state)
     {
         TLLM_LOG_DEBUG("Set request %lu from state %d to %d", mRequestId, mState, state);
+        if (state == LlmRequestState::kGENERATION_IN_PROGRESS && isContextInitState())
+        {
+            auto const& firstScheduledTime = mPerfMetrics.timingMetrics.firstScheduledTime;
+            if (firstScheduledTime != executor::RequestPerfMetrics::TimePoint{})
+            {
+                mContextLatencyMS
+                    = std::chrono::duration<double, std::milli>(getSteadyClockNow() - firstScheduledTime).count();
+            }
+        }
         mState = state;
     }
 
@@ -1603,6 +1734,12 @@ public:
         return mPriority;
     }
 
+    /// Get the timepoint at which the request started.
+    [[nodiscard]] std::chrono::steady_clock::time_point getStartTime() const noexcept
+    {
+        return mStartTime;
+    }
+
     /// Get the counter of decoding iterations.
     SizeType32 getDecodingIter()
     {
@@ -1612,9 +1749,39 @@ public:
     /// Increment the counter of decoding iterations.
     void advanceDecodingIter()
     {
+        auto const now = getSteadyClockNow();
+        if (mDecodingIter > 0)
+        {
+            if (mTokenLatenciesMS.size() == kMAX_TOKEN_LATENCIES)
+            {
+                mTokenLatenciesMS.pop_front();
+            }
+            mTokenLatenciesMS.push_back(std::chrono::duration<double, std::milli>(now - mPrevDecodingIterTime).count());
+        }
+        mPrevDecodingIterTime = now;
         mDecodingIter++;
     }
 
+    /// @brief Time the request spent in the queue before its first scheduling in milliseconds.
+    /// Remains 0 until the request is scheduled.
+    [[nodiscard]] double getTimeInQueueMS() const noexcept
+    {
+        return mTimeInQueueMS;
+    }
+
+    /// @brief Time between the first scheduling and the completion of the context phase in milliseconds.
+    /// Remains 0 while the context phase is still running.
+    [[nodiscard]] double getContextLatencyMS() const noexcept
+    {
+        return mContextLatencyMS;
+    }
+
+    /// @brief Decode latencies of the most recent decoding iterations in milliseconds, oldest first.
+    [[nodiscard]] std::vector<double> getLastTokenLatenciesMS() const
+    {
+        return {mTokenLatenciesMS.begin(), mTokenLatenciesMS.end()};
+    }
+
     /// @brief  Return the average number of decoded tokens per iteration. For standard model it is 1.
     /// For speculative decoding model >= 1 -- number of draft tokens accepted per step + 1.
     [[nodiscard]] float getAvgDecodedTokensPerIter() const noexcept
@@ -1966,8 +2133,17 @@ protected:
     bool mReturnContextLogits;
     bool mReturnGenerationLogits;
     bool mReturnLogProbs;
+    // Only stream the log probs of tokens that have not been sent yet
+    bool mReturnDeltaLogProbs{false};
+    bool mPackedLogProbs{false};
+    // Compact the generation logits to the top-K entries per step on device before the D2H copy
+    std::optional<SizeType32> mTopKLogits;
+    // Host bytes charged against this request's memory budget, see allocHostTensorWithinBudget()
+    std::size_t mHostMemoryBytes{0};
     TensorPtr mContextLogitsHost;    // [mPromptLen, vocabSizePadded]
-    TensorPtr mGenerationLogitsHost; // [beamSize, mMaxNewTokens, vocabSizePadded]
+    TensorPtr mGenerationLogitsHost; // [beamSize, mMaxNewTokens, vocabSizePadded (or topKLogits)]
+    // Token ids of the compacted generation logits columns, same shape as mGenerationLogitsHost
+    TensorPtr mGenerationLogitsTopKIndicesHost;
     std::vector<TensorPtr> mGenerationLogitsFragments;
 
     bool mExcludeInputFromOutput;
@@ -1985,6 +2161,16 @@ protected:
 
     SizeType32 mDecodingIter{0};
 
+    // Number of decoding iteration latencies retained for the latency breakdown in RequestStats.
+    static constexpr size_t kMAX_TOKEN_LATENCIES{64};
+
+    // Latency breakdown reported through RequestStats.
+    double mTimeInQueueMS{0.};
+    double mContextLatencyMS{0.};
+    // Decode latencies of the most recent decoding iterations, oldest first.
+    std::deque<double> mTokenLatenciesMS;
+    TimePoint mPrevDecodingIterTime{};
+
     executor::PriorityType mPriority;
 
     std::vector<executor::FinishReason> mFinishReasons;
@@ -2064,8 +2250,16 @@ private:
             mState = LlmRequestState::kDISAGG_GENERATION_INIT;
         }
 
-        // Scatter the input tokens to other beam
-        mTokens = BeamTokens(mSamplingConfig.beamWidth, inputTokens);
+        // Scatter the input tokens to other beams, drawing on recycled token storage so that
+        // steady-state request turnover reuses grown capacity instead of reallocating.
+        mTokens.clear();
+        mTokens.reserve(mSamplingConfig.beamWidth);
+        for (SizeType32 beam = 0; beam < mSamplingConfig.beamWidth; ++beam)
+        {
+            auto beamTokens = acquirePooledTokenStorage();
+            beamTokens.assign(inputTokens.begin(), inputTokens.end());
+            mTokens.push_back(std::move(beamTokens));
+        }
         mLastTokens = VecTokens(mSamplingConfig.beamWidth, inputTokens.back());
 
         // Init mUniqueTokens
@@ -31,6 +31,11 @@ namespace tensorrt_llm::batch_manager
 {
 class DecoderInputBuffers;
 
+namespace utils
+{
+class StaticThreadPool;
+}
+
 class LogitsPostProcessor : Algorithm
 {
 public:
@@ -43,11 +48,17 @@ public:
 
     constexpr static auto name{"LogitsPostProcessor"};
 
-    LogitsPostProcessor() = default;
+    LogitsPostProcessor();
+    ~LogitsPostProcessor();
 
     bool operator()(DecoderInputBuffers& inputBuffers, bool replicateLogitsPostProcessor,
         runtime::WorldConfig const& worldConfig, CudaStreamPtr const& stream,
         std::optional<LogitsPostProcessorBatched> const& logitsPostProcessorBatched = std::nullopt) const;
+
+private:
+    // Worker pool for running per-request callbacks concurrently, created when
+    // TRTLLM_LOGITS_POST_PROCESSOR_WORKERS is set; null when the callbacks run inline.
+    std::unique_ptr<utils::StaticThreadPool> mWorkerPool;
 };
 
 } // namespace tensorrt_llm::batch_manager
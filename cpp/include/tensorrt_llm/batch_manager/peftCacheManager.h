@@ -80,6 +80,13 @@ public:
         RequestVector const& contextRequests, RequestVector const& generationRequests, bool resetGpuCache = false)
         = 0;
 
+    /**
+     * \brief hint which LoRA tasks are likely to be scheduled soon, so implementations may stage their
+     * weights onto the device ahead of ensureBatch. The default implementation ignores the hint.
+     * \param[in] queuedTaskIds: task ids visible in the request queue, most urgent first
+     */
+    virtual void prefetchTasks(std::vector<uint64_t> const& /*queuedTaskIds*/) {}
+
     /**
      * \brief mark all the tasks in device cache as done
      */
@@ -109,6 +116,8 @@ public:
     PeftTable ensureBatch(RequestVector const& contextRequests, RequestVector const& generationRequests,
         bool resetGpuCache = false) override;
 
+    void prefetchTasks(std::vector<uint64_t> const& queuedTaskIds) override;
+
     [[nodiscard]] bool isTaskCached(uint64_t taskId) const;
 
     [[nodiscard]] bool isTaskDone(uint64_t taskId) const;
@@ -156,6 +165,19 @@ private:
     mutable std::mutex mPutFuturesMutex;
     std::unordered_map<std::uint64_t, std::future<void>> mPutFutures;
 
+    // Popularity-decayed per-task arrival score used to rank prefetch candidates.
+    struct TaskScore
+    {
+        float score{0.0F};
+        uint64_t lastArrival{0};
+    };
+
+    mutable std::mutex mTaskScoresMutex;
+    std::unordered_map<uint64_t, TaskScore> mTaskScores;
+    uint64_t mTaskArrivalCount{0};
+
+    void recordTaskArrival(uint64_t taskId);
+
     std::unordered_map<uint64_t, std::unordered_set<uint64_t>> mTaskIdToReqIds;
     std::unordered_map<uint64_t, std::unordered_set<uint64_t>> mTaskIdToPausedReqIds;
 
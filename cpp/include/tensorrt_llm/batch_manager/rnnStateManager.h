@@ -21,6 +21,9 @@
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace tensorrt_llm::batch_manager::rnn_state_manager
 {
 
@@ -40,7 +43,30 @@ public:
     void fillSlotMapping(
         runtime::ITensor& dstPointers, SizeType32 dstSlotOffset, SizeType32 seqSlotIdx, SizeType32 beamWidth) const;
 
+    //! @brief Copy the rnn and conv states of a sequence to pinned host memory, keyed by request id.
+    //! @details The recurrent state of a sequence is fixed-size and never shared, so unlike transformer kv cache
+    //!          there is nothing to page: offloading the state slots is all that is needed to free a sequence slot
+    //!          for another request.
+    void offloadSequenceState(std::uint64_t requestId, SizeType32 seqSlotIdx,
+        tensorrt_llm::runtime::BufferManager const& bufferManager);
+
+    //! @brief Copy a previously offloaded state back into a (possibly different) sequence slot and drop the snapshot.
+    //! @return true if a snapshot existed for requestId, false otherwise.
+    bool onboardSequenceState(std::uint64_t requestId, SizeType32 seqSlotIdx,
+        tensorrt_llm::runtime::BufferManager const& bufferManager);
+
+    //! @brief Drop the offloaded state of a request, if any.
+    void releaseSequenceState(std::uint64_t requestId);
+
 private:
+    struct StateSnapshot
+    {
+        TensorPtr rnnStates;  // [local_nb_layers, max_beam_width, ...], pinned host
+        TensorPtr convStates; // [local_nb_layers, max_beam_width, ...], pinned host
+    };
+
+    void copySequenceSlots(StateSnapshot const& snapshot, SizeType32 seqSlotIdx, bool toSnapshot,
+        tensorrt_llm::runtime::BufferManager const& bufferManager);
     // If we need support beam search, we may need mMaxBeamWidth + 1 slots and use separate input / output states.
     TensorPtr pagedRnnStates;  // [local_nb_layers, max_seq_num * max_beam_width, state_size, rnn_hidden_size] or
                                // [local_nb_layers, max_seq_num * max_beam_width, num_heads, state_size, rnn_head_size]
@@ -55,6 +81,8 @@ private:
     SizeType32 mMaxNumSequences = 0;
     SizeType32 mMaxBeamWidth = 0;
     SizeType32 mBeamSlotsPerSequence = 0;
+
+    std::unordered_map<std::uint64_t, StateSnapshot> mOffloadedStates;
 };
 
 } // namespace tensorrt_llm::batch_manager::rnn_state_manager
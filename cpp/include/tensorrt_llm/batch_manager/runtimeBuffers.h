@@ -19,6 +19,7 @@
 #include "tensorrt_llm/batch_manager/common.h"
 #include "tensorrt_llm/batch_manager/rnnStateManager.h"
 #include "tensorrt_llm/common/optionalRef.h"
+#include "tensorrt_llm/runtime/bufferArena.h"
 #include "tensorrt_llm/runtime/eagleBuffers.h"
 #include "tensorrt_llm/runtime/explicitDraftTokensBuffers.h"
 #include "tensorrt_llm/runtime/iTensor.h"
@@ -28,8 +29,10 @@
 #include "tensorrt_llm/runtime/worldConfig.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
+#include <utility>
 #include <vector>
 
 namespace tensorrt_llm::runtime
@@ -156,6 +159,12 @@ private:
     TensorPtr lastTokenIdsDevice;
     TensorPtr logitsIdsHost;
 
+    //! Signature (request id, beam width) of the generation batch whose decode metadata currently
+    //! lives on device. When the next iteration presents the same pure-generation batch, sequence
+    //! lengths and position ids are advanced in place on device instead of being re-uploaded.
+    std::vector<std::pair<std::uint64_t, SizeType32>> mMetadataBatchSignature;
+    bool mDeviceMetadataValid{false};
+
     //! Pipeline-Parallelism
     TensorPtr hiddenStates;
 
@@ -193,6 +202,8 @@ public:
     //! Logits
     std::vector<SizeType32> numContextLogits;
     TensorPtr logits;
+    //! Arena backing the per-iteration context logits buffer, reset on every reshape
+    runtime::BufferArena logitsArena;
 
     //! Helper cache for store generation logits
     struct GenerationLogitsCache
@@ -277,7 +288,7 @@ public:
         runtime::decoder::DecoderState const& decoderState, kv_cache_manager::BaseKVCacheManager* kvCacheManager,
         kv_cache_manager::BaseKVCacheManager* crossKvCacheManager, rnn_state_manager::RnnStateManager* rnnStateManager,
         PeftTable const& peftTable, runtime::TllmRuntime const& runtime, runtime::ModelConfig const& modelConfig,
-        runtime::WorldConfig const& worldConfig, bool gatherGenerationLogits, bool trtOverlap,
+        runtime::WorldConfig const& worldConfig, bool gatherGenerationLogits, SizeType32 stepsSinceHostSync,
         OptionalRef<runtime::ITensor const> newOutputTokens = std::nullopt);
 
     void prepareBuffersForCudaGraph(SizeType32 maxSequenceLength);
@@ -313,7 +324,8 @@ private:
         kv_cache_manager::BaseKVCacheManager* crossKvCacheManagerPtr,
         rnn_state_manager::RnnStateManager* rnnStateManagerPtr, PeftTable const& peftTable,
         runtime::TllmRuntime const& runtime, runtime::ModelConfig const& modelConfig,
-        runtime::WorldConfig const& worldConfig, bool trtOverlap, OptionalRef<runtime::ITensor const> newOutputTokens);
+        runtime::WorldConfig const& worldConfig, SizeType32 stepsSinceHostSync,
+        OptionalRef<runtime::ITensor const> newOutputTokens);
 
     void fillIOMaps(runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig);
 };
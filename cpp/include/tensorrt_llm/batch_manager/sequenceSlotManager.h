@@ -19,7 +19,7 @@
 #include <chrono>
 #include <cstdint>
 #include <optional>
-#include <queue>
+#include <set>
 #include <unordered_map>
 #include <vector>
 
@@ -42,6 +42,9 @@ public:
     /// Function that returns a slot for the provided sequenceId
     /// For a new sequence id, a new slot will be allocated
     /// In case no slot could be allocated or matched, optional will be empty
+    /// New sequences get their previous slot back when it is still free, and the lowest free slot
+    /// otherwise, so the active slots stay in a dense, stable range across iterations. This keeps
+    /// batch shapes stable for CUDA graph reuse and per-slot buffer accesses compact.
     std::optional<SlotIdType> getSequenceSlot(bool const& startFlag, SequenceIdType const& sequenceId);
 
     /// Function that frees the slot associated with the given sequence id
@@ -52,11 +55,16 @@ public:
     void freeIdleSequenceSlots();
 
 private:
+    /// Function that records the slot a sequence id held so it can be preferred on restart
+    void rememberLastUsedSlot(SequenceIdType sequenceId, SlotIdType slot);
+
     SlotIdType mMaxNumSlots;
     std::chrono::microseconds mMaxSequenceIdleMicroseconds;
 
     std::unordered_map<SequenceIdType, SlotIdType> mSequenceIdToSlot;
-    std::queue<SlotIdType> mAvailableSlots;
+    std::set<SlotIdType> mAvailableSlots;
+    /// Slot a sequence id held before it was freed, used as a best-effort affinity hint on restart
+    std::unordered_map<SequenceIdType, SlotIdType> mLastUsedSlot;
     std::vector<std::chrono::steady_clock::time_point> mLastTimepoint;
 };
 
@@ -70,6 +70,18 @@ public:
     TensorPtr cacheIndirection;
     TensorPtr kvCacheBlockOffsetsHost;   // [numPools, maxBatch * maxBeamWidth, 2, maxBlocksPerSeq]
     TensorPtr kvCacheBlockOffsetsDevice; // [numPools, maxBatch * maxBeamWidth, 2, maxBlocksPerSeq]
+    // Host mirrors of the device block-offset tables, used to upload only changed rows when delta
+    // uploads are enabled. Null when disabled.
+    TensorPtr kvCacheBlockOffsetsShadow = nullptr;
+    TensorPtr crossKvCacheBlockOffsetsShadow = nullptr;
+    // Batch composition (request id, beam width) of the last upload; the tables' row layout is only
+    // stable, and delta upload only possible, while it is unchanged.
+    std::vector<std::pair<RequestIdType, SizeType32>> kvOffsetsUploadedOrder;
+    // Number of offset columns per row the device tables are known to mirror. Columns beyond it
+    // were never uploaded, so a batch needing more forces a full upload.
+    SizeType32 kvOffsetsUploadedWidth{0};
+    SizeType32 crossKvOffsetsUploadedWidth{0};
+    bool kvOffsetsShadowValid{false};
     TensorPtr contextProgressHost;
 
     // Cross attention buffers
@@ -52,6 +52,9 @@ enum class RequestErrorCode : uint32_t
 
     // Network and communication errors (1000-1999)
     kNETWORK_ERROR = 1000,
+
+    // Resource errors (2000-2999)
+    kMEMORY_ALLOCATION_ERROR = 2000,
 };
 
 /// @brief Constant for unknown request ID
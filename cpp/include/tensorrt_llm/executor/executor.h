@@ -215,7 +215,9 @@ public:
     explicit OutputConfig(bool returnLogProbs = false, bool returnContextLogits = false,
         bool returnGenerationLogits = false, bool excludeInputFromOutput = false, bool returnEncoderOutput = false,
         bool returnPerfMetrics = false,
-        std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs = std::nullopt);
+        std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs = std::nullopt,
+        bool returnDeltaLogProbs = false, std::optional<SizeType32> topKLogits = std::nullopt,
+        bool packedLogProbs = false);
 
     /// @brief Controls if Result should contain log probabilities. Default is false.
     bool returnLogProbs;
@@ -233,6 +235,23 @@ public:
 
     /// @brief The additional outputs to gather from the model.
     std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs;
+
+    /// @brief Controls if the log probabilities of streaming Results should only cover the newly generated
+    /// tokens of each response instead of repeating all generated tokens. The position of the first entry
+    /// is reported in Result::logProbsOffset. Default is false.
+    bool returnDeltaLogProbs;
+
+    /// @brief When set together with returnGenerationLogits on a streaming request, only the top-K logits of each
+    /// step are compacted on device and copied to host, instead of the full vocabulary width. The values are
+    /// returned in Result::generationLogits with K as the last dimension and the corresponding token ids in
+    /// Result::generationLogitsTopKIndices. Default is std::nullopt, returning the full logits.
+    std::optional<SizeType32> topKLogits;
+
+    /// @brief Controls if Result::logProbs travels in a packed binary encoding (fp16 values with varint framing)
+    /// when responses are serialized between processes, cutting the wire size of logprob-heavy streams. The
+    /// encoding is decoded transparently on deserialization; consumers always see plain float vectors. The fp16
+    /// round trip loses precision below ~1e-3, hence opt-in. Default is false.
+    bool packedLogProbs;
 };
 
 /// @brief Configuration for speculative decoding with external draft tokens.
@@ -347,7 +366,8 @@ private:
 /// Allows to include window size, ngram size and verification set size
 struct LookaheadDecodingConfig
 {
-    LookaheadDecodingConfig(SizeType32 windowSize, SizeType32 ngramSize, SizeType32 verificationSetSize);
+    LookaheadDecodingConfig(
+        SizeType32 windowSize, SizeType32 ngramSize, SizeType32 verificationSetSize, bool usePoolCache = false);
 
     explicit LookaheadDecodingConfig()
         : LookaheadDecodingConfig(
@@ -360,6 +380,7 @@ struct LookaheadDecodingConfig
     [[nodiscard]] SizeType32 getWindowSize() const;
     [[nodiscard]] SizeType32 getNgramSize() const;
     [[nodiscard]] SizeType32 getVerificationSetSize() const;
+    [[nodiscard]] bool getUsePoolCache() const;
 
     /// @brief return <maxDecodingTokens, maxPathLen, maxDraftTokens, maxDraftPathLen>
     [[nodiscard]] std::tuple<SizeType32, SizeType32, SizeType32, SizeType32> calculateSpeculativeResource() const;
@@ -385,6 +406,8 @@ private:
     SizeType32 mNgramSize;
     // Number of NGrams in verification branch per step.
     SizeType32 mVerificationSetSize;
+    // Warm start new requests from an n-gram cache that survives request completion.
+    bool mUsePoolCache;
 };
 
 struct EagleConfig
@@ -474,13 +497,17 @@ private:
 class SpeculativeDecodingConfig
 {
 public:
-    explicit SpeculativeDecodingConfig(bool fastLogits = false);
+    explicit SpeculativeDecodingConfig(bool fastLogits = false, bool dynamicDraftLen = false);
 
     bool operator==(SpeculativeDecodingConfig const& other) const;
 
     /// @brief Send logits tensor directly from draft to target model.
     bool fastLogits;
 
+    /// @brief Adapt the number of external draft tokens per request to the measured acceptance rate,
+    /// truncating drafts that do not pay off on the current traffic.
+    bool dynamicDraftLen;
+
 private:
     friend class Serialization;
 };
@@ -582,13 +609,15 @@ public:
     explicit KvCacheRetentionConfig(std::vector<TokenRangeRetentionConfig> const& tokenRangeRetentionPriorities,
         RetentionPriority decodeRetentionPriority = kDefaultRetentionPriority,
         std::optional<std::chrono::milliseconds> decodeDurationMs = std::nullopt,
-        KvCacheTransferMode transferMode = KvCacheTransferMode::DRAM, std::string const& directory = "");
+        KvCacheTransferMode transferMode = KvCacheTransferMode::DRAM, std::string const& directory = "",
+        std::optional<SizeType32> attentionSinkTokenCount = std::nullopt);
 
     [[nodiscard]] std::vector<TokenRangeRetentionConfig> getTokenRangeRetentionConfigs() const;
     [[nodiscard]] RetentionPriority getDecodeRetentionPriority() const;
     [[nodiscard]] std::optional<std::chrono::milliseconds> getDecodeDurationMs() const;
     [[nodiscard]] KvCacheTransferMode getTransferMode() const;
     [[nodiscard]] std::string const& getDirectory() const;
+    [[nodiscard]] std::optional<SizeType32> getAttentionSinkTokenCount() const;
 
     /// @brief Convert the token range data into an entry per kv block. Returns a tuple of vectors corresponding to the
     /// priorities and durations for each block.
@@ -600,7 +629,7 @@ public:
         return mTokenRangeRetentionConfigs == other.mTokenRangeRetentionConfigs
             && mDecodeRetentionPriority == other.mDecodeRetentionPriority
             && mDecodeDurationMs == other.mDecodeDurationMs && mTransferMode == other.mTransferMode
-            && mDirectory == other.mDirectory;
+            && mDirectory == other.mDirectory && mAttentionSinkTokenCount == other.mAttentionSinkTokenCount;
     }
 
 private:
@@ -616,6 +645,10 @@ private:
     KvCacheTransferMode mTransferMode;
     /// @brief Name of the directory if transfer mode is GDS or POSIX_DEBUG_FALLBACK.
     std::string mDirectory;
+    /// @brief The number of leading tokens to keep resident as attention sinks while the sliding window rotates over
+    /// the rest of the sequence (the StreamingLLM eviction shape). Must be a multiple of the KV cache block size and
+    /// must match KvCacheConfig::sinkTokenLength, since the attention kernels read one batch-uniform sink length.
+    std::optional<SizeType32> mAttentionSinkTokenCount;
 };
 
 /// @brief A class that holds information about the request
@@ -710,7 +743,7 @@ public:
     Request& operator=(Request&& other) noexcept;
     ~Request();
 
-    [[nodiscard]] VecTokens getInputTokenIds() const;
+    [[nodiscard]] VecTokens const& getInputTokenIds() const;
     [[nodiscard]] SizeType32 getMaxTokens() const;
     [[nodiscard]] bool getStreaming() const;
     [[nodiscard]] SamplingConfig getSamplingConfig() const;
@@ -880,6 +913,18 @@ struct Result
 
     /// @brief The additional outputs
     std::vector<AdditionalOutput> additionalOutputs;
+
+    /// @brief The generation position of the first entry in logProbs. Only set for streaming responses
+    /// when OutputConfig::returnDeltaLogProbs is enabled, so clients can stitch the deltas together.
+    std::optional<SizeType32> logProbsOffset;
+
+    /// @brief The token ids of the columns returned in generationLogits when OutputConfig::topKLogits is set.
+    /// Same shape as generationLogits.
+    std::optional<Tensor> generationLogitsTopKIndices;
+
+    /// @brief Mirrors OutputConfig::packedLogProbs. When true, logProbs is serialized in the packed fp16
+    /// encoding; the field itself always holds plain floats.
+    bool packedLogProbs{false};
 };
 
 /// @brief Class that holds either an error or a result
@@ -970,7 +1015,8 @@ public:
     explicit SchedulerConfig(
         CapacitySchedulerPolicy capacitySchedulerPolicy = CapacitySchedulerPolicy::kGUARANTEED_NO_EVICT,
         std::optional<ContextChunkingPolicy> contextChunkingPolicy = std::nullopt,
-        std::optional<DynamicBatchConfig> dynamicBatchConfig = std::nullopt);
+        std::optional<DynamicBatchConfig> dynamicBatchConfig = std::nullopt,
+        std::optional<FloatType> contextTokensPerSecond = std::nullopt);
 
     bool operator==(SchedulerConfig const& other) const;
 
@@ -980,6 +1026,8 @@ public:
 
     [[nodiscard]] std::optional<DynamicBatchConfig> getDynamicBatchConfig() const;
 
+    [[nodiscard]] std::optional<FloatType> getContextTokensPerSecond() const;
+
 private:
     friend class Serialization;
 
@@ -991,6 +1039,11 @@ private:
 
     /// @brief The config for tuning batch size dynamically. See DynamicBatchSizeConfig.
     std::optional<DynamicBatchConfig> mDynamicBatchConfig;
+
+    /// @brief Context-token admission rate used to pace new prefill work. When set, an arrival
+    /// burst is spread across iterations at this rate instead of being admitted all at once,
+    /// protecting the inter-token latency of running requests. Unset disables pacing.
+    std::optional<FloatType> mContextTokensPerSecond;
 };
 
 /// @brief Configuration class for the KV cache
@@ -1765,6 +1818,26 @@ struct KVCacheEvent
     std::optional<SizeType32> attentionDpRank;
 };
 
+/// @brief A compact Bloom-filter digest of the block hashes currently stored for reuse.
+/// @details Routers can poll this instead of replaying the full KV cache event stream: a block hash h is possibly
+/// cached iff for every probe i in [0, numHashes) the bit at index (splitmix64(h) + i * splitmix64(h ^ kProbeSeed))
+/// % numBits is set, where splitmix64 is the finalizer of the SplitMix64 generator and kProbeSeed is
+/// 0x9e3779b97f4a7c15. False positives are possible, false negatives are not (up to snapshot staleness).
+struct KVCachePrefixDigest
+{
+    /// @brief The second-probe seed, see class description
+    static constexpr uint64_t kProbeSeed = 0x9e3779b97f4a7c15ULL;
+
+    /// @brief Number of bits in the filter
+    SizeType32 numBits{0};
+    /// @brief Number of hash probes per block hash
+    SizeType32 numHashes{0};
+    /// @brief Monotonic counter, bumped on every filter mutation, so unchanged snapshots can be skipped cheaply
+    uint64_t version{0};
+    /// @brief Packed filter, bit b is stored as bits[b / 8] & (1 << (b % 8))
+    std::vector<uint8_t> bits;
+};
+
 /// @brief Exposes a limited set of KV cache manager functionalities
 class KVCacheEventManager
 {
@@ -1862,6 +1935,28 @@ public:
     /// @param id The request id for which to cancel the response
     void cancelRequest(IdType requestId);
 
+    /// @brief   Stops admitting new requests and hands off in-flight requests instead of generating
+    ///          them to completion, e.g. before this replica is taken down for a rolling update.
+    /// @details Each in-flight request is switched to context-only at its next iteration boundary:
+    ///          its KV cache is exported through the disaggregated-serving cache transceiver and its
+    ///          final response carries ContextPhaseParams. To resume, re-enqueue the request on a
+    ///          successor replica as generation-only with the tokens processed so far (the original
+    ///          prompt plus the generated tokens, minus the first generation tokens recorded in the
+    ///          ContextPhaseParams) so that the successor pulls the KV cache and continues decoding.
+    ///          Requires disaggregated serving to be enabled via cacheTransceiverConfig. Only
+    ///          supported in LEADER mode without pipeline parallelism.
+    void drain();
+
+    /// @brief Update named engine weights in place without restarting the executor, e.g. after an
+    ///        online fine-tuning step.
+    /// @details Only weights that were excluded from the engine as managed weights can be updated. The
+    ///          updates are staged to device on a side stream and applied between two iterations, so
+    ///          active requests keep running and the next forward pass uses the new weights. Weights are
+    ///          sharded per rank; every participant must be given the shards of its own rank. Not
+    ///          supported in ORCHESTRATOR mode.
+    /// @param weights Map of engine tensor name to the new weight values
+    void updateWeights(std::map<std::string, Tensor> const& weights);
+
     /// @brief   Signals the server to shutdown.
     /// @details This call is blocking. Only returns when all requests have terminated or timeout has been reached
     void shutdown();
@@ -1889,6 +1984,17 @@ public:
 
     std::optional<std::shared_ptr<KVCacheEventManager>> getKVCacheEventManager() const;
 
+    /// @brief  Returns a snapshot of the prefix digest maintained by the KV cache manager, a few-kilobyte Bloom
+    ///         filter over the stored block hashes that fleet routers can poll for cache-aware placement.
+    /// @return The digest, or std::nullopt if no KV cache manager is available on this rank.
+    [[nodiscard]] std::optional<KVCachePrefixDigest> getKVCachePrefixDigest() const;
+
+    /// @brief  Writes the decoder per-step timing ring as a binary trace, a diagnostic for attributing
+    ///         inter-token latency spikes. Safe to call while the executor is serving requests.
+    /// @return Whether a trace was written; false on ranks without a decoder or when the ring is disabled
+    ///         via TRTLLM_DECODER_TIMING_RING_SIZE=0.
+    bool writeDecoderTimingTrace(std::string const& path) const;
+
 private:
     class Impl;
     std::unique_ptr<Impl> mImpl;
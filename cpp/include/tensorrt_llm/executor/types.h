@@ -420,6 +420,13 @@ struct RequestStats
     SizeType32 missedBlocksPerRequest;
     /// @brief KV Cache Hit Rate per request, defined as reusedBlocks / (reusedBlocks + missedBlocks)
     FloatType kvCacheHitRatePerRequest;
+    /// @brief Time the request spent in the queue before its first scheduling (ms)
+    double timeInQueueMS;
+    /// @brief Time between the first scheduling and the completion of the context phase (ms).
+    /// Stays 0 while the context phase is still running.
+    double contextLatencyMS;
+    /// @brief Decode latencies of the most recent decoding iterations (ms), oldest first
+    std::vector<double> lastTokenLatenciesMS;
 };
 
 /// @brief Struct that holds the stats of all requests in an iteration
@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cuda_runtime_api.h>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+
+// Upper bound on copies per kernel launch. The pointer/size arrays are passed by value in the
+// kernel parameter buffer, so no device-side staging or lifetime management is needed; larger
+// batches are simply split into multiple launches.
+constexpr int kMaxBatchedCopies = 64;
+
+struct KvCacheBatchedCopyParams
+{
+    void const* srcs[kMaxBatchedCopies];
+    void* dsts[kMaxBatchedCopies];
+    unsigned long long sizesInBytes[kMaxBatchedCopies];
+    int numCopies;
+};
+
+// Copies numCopies independent byte ranges in a single kernel launch. All pointers must be
+// 16-byte aligned and all sizes multiples of 16 bytes (KV cache blocks satisfy this). Source
+// and destination may be device memory or pinned host memory (accessed through UVA), so the
+// same kernel serves both offload (D2H) and onboard (H2D) batches.
+void invokeKvCacheBatchedCopy(KvCacheBatchedCopyParams const& params, cudaStream_t stream);
+
+} // namespace kernels
+} // namespace tensorrt_llm
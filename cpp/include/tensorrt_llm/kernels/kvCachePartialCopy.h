@@ -25,5 +25,15 @@ namespace kernels
 void kvCacheBlockPartialCopy(IBuffer& dst, IBuffer const& src, unsigned int numLayers, unsigned int numHeads,
     unsigned int tokensPerBlock, unsigned int numHidden, unsigned int numTokensToCopy, int kvFactor,
     cudaStream_t stream);
+
+//! \brief Copy a full KV cache block while quantizing it to FP8 (e4m3) with a single per-block scale.
+//! \details The source block must hold half or bfloat16 data. The FP8 payload is written to the
+//! first half of dst (which keeps the uncompressed block geometry) and the block absmax, from which
+//! the scale is derived, is written to blockAmax (one float in device memory).
+void kvCacheBlockQuantizeCopyFp8(IBuffer& dst, IBuffer const& src, float* blockAmax, cudaStream_t stream);
+
+//! \brief Inverse of kvCacheBlockQuantizeCopyFp8: expand an FP8 payload back to the dst data type.
+//! \details blockAmax must be the absmax recorded when the block was quantized.
+void kvCacheBlockDequantizeCopyFp8(IBuffer& dst, IBuffer const& src, float const* blockAmax, cudaStream_t stream);
 } // namespace kernels
 } // namespace tensorrt_llm
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/iTensor.h"
+
+#include <cstddef>
+
+namespace tensorrt_llm::runtime
+{
+
+//! \brief Iteration-scoped bump allocator over a preallocated slab.
+//!
+//! Tensors handed out by allocate are views into the slab and stay valid until the next reset. Resetting
+//! reclaims the whole slab at once, so transient tensors that are recreated every iteration produce no
+//! allocator traffic in the steady state. The slab is sized to the high-water mark of past iterations and
+//! only grows when no tensors are outstanding; requests that do not fit fall back to the buffer manager.
+class BufferArena
+{
+public:
+    using TensorPtr = ITensor::SharedPtr;
+
+    BufferArena() = default;
+
+    //! \brief Hand out a tensor backed by the slab.
+    //! Falls back to a regular allocation when the slab is exhausted.
+    TensorPtr allocate(BufferManager const& manager, nvinfer1::Dims const& shape, nvinfer1::DataType type);
+
+    //! \brief Reclaim the slab.
+    //! All tensors handed out since the previous reset must no longer be dereferenced on the host. Pending
+    //! device work may still use them, since the slab is reused in stream order and only reallocated when
+    //! it has to grow.
+    void reset();
+
+private:
+    //! Matches the alignment guaranteed by cudaMalloc, so views behave like regular allocations.
+    static std::size_t constexpr kAlignment{256};
+
+    BufferManager::IBufferPtr mSlab;
+    std::size_t mOffset{0};
+    std::size_t mIterationBytes{0};
+    std::size_t mHighWaterMark{0};
+};
+
+} // namespace tensorrt_llm::runtime
@@ -218,6 +218,10 @@ private:
     SizeType32 mMaxBeamWidth{};
     SizeType32 mMaxSequenceLength{};
 
+    //! @brief Data type the decoder buffers were allocated with. Buffers are only allocated again
+    //! when the type changes; other setup calls reconfigure the existing allocation.
+    std::optional<nvinfer1::DataType> mBufferDtype;
+
     //! @brief Stateful inputs for the decoder. Allocated for maxNumSequences slots.
     DecodingInputPtr mJointDecodingInput;
     //! @brief Stateful outputs for the decoder. Allocated for maxNumSequences slots.
@@ -177,6 +177,10 @@ private:
     TensorPtr greedySamplingHost;
     TensorPtr posteriorAlphaHost;
     TensorPtr posteriorThresholdHost;
+    // Prebuilt draft-paths row for chunked-context requests (first path 0..maxPathLen-1, rest -1).
+    // Copied device-to-device per chunked row instead of a fill plus a host-staged path upload.
+    TensorPtr chunkedContextDraftPathsRow;
+    TensorPtr chunkedContextDraftPathsRowHost;
 };
 
 } // namespace tensorrt_llm::runtime
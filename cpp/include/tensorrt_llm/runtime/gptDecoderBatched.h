@@ -25,7 +25,10 @@
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <list>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace tensorrt_llm::batch_manager
@@ -35,6 +38,7 @@ class LlmRequest;
 
 namespace tensorrt_llm::runtime
 {
+class DecoderTimingRing;
 
 //! GPT decoder class with support for in-flight batching
 class GptDecoderBatched : public IGptDecoderBatched
@@ -46,6 +50,7 @@ public:
     using TensorPtr = ITensor::SharedPtr;
 
     explicit GptDecoderBatched(CudaStreamPtr stream);
+    ~GptDecoderBatched() override;
 
     void setup(executor::DecodingMode const& mode, SizeType32 maxNumSequences, SizeType32 maxBeamWidth,
         nvinfer1::DataType dtype, ModelConfig const& modelConfig, WorldConfig const& worldConfig) override;
@@ -75,10 +80,28 @@ public:
         return mBufferManager;
     }
 
+    //! @brief Enable CUDA graph capture and replay of decoder iterations with a stable input layout.
+    void setCudaGraphMode(bool enabled)
+    {
+        mCudaGraphMode = enabled;
+    }
+
+    //! @brief Drop all captured decoder graphs. Must be called whenever the underlying decoder is set up for
+    //! new requests, since per-request host-side decisions are baked into the captured graphs.
+    void clearCudaGraphs();
+
+    //! @brief Write the per-step timing ring as a binary trace, see DecoderTimingRing::writeTrace.
+    //! Safe to call from another thread while the decoder is running.
+    //! @return Whether the trace file was written; false when the ring is disabled.
+    bool writeTimingTrace(std::string const& path) const;
+
 private:
     //! @brief Calls decoders for tokens per engine step
     void forwardDispatch(decoder::DecoderState const& decoderState, decoder_batch::Input const& input);
 
+    //! @brief Runs the decoder iteration through a cached CUDA graph, capturing it first if necessary.
+    void forwardGraph(decoder::DecoderState const& decoderState, decoder_batch::Input const& input);
+
 private:
     CudaStreamPtr mRuntimeStream;
     CudaStreamPtr mDecoderStream;
@@ -86,5 +109,31 @@ private:
 
     using GptDecoderPtr = std::unique_ptr<IGptDecoder>;
     GptDecoderPtr mDecoder;
+
+    //! Configuration the underlying decoder was created with. Setup requests that fit it reuse the
+    //! decoder instead of recreating it, keeping reconfiguration off the serving path.
+    std::optional<executor::DecodingMode> mDecoderMode;
+    SizeType32 mDecoderMaxNumSequences{};
+    SizeType32 mDecoderMaxBeamWidth{};
+    nvinfer1::DataType mDecoderDtype{};
+
+    //! Executable graph of one decoder iteration and the input layout it was captured for.
+    //! Replay is only valid while the batch slots and the input addresses are unchanged, since the recorded
+    //! copies read the pinned input buffers by address.
+    struct DecoderGraph
+    {
+        std::vector<void const*> inputPointers;
+        std::vector<SizeType32> batchSlotValues;
+        cudaGraphExec_t instance{};
+    };
+
+    static constexpr SizeType32 kMaxDecoderGraphs{4};
+
+    bool mCudaGraphMode{false};
+    //! Small LRU cache of captured decoder iterations, most recently used in front
+    std::list<DecoderGraph> mDecoderGraphs;
+
+    //! Diagnostic ring of per-step timings for inter-token latency attribution, see DecoderTimingRing.
+    std::unique_ptr<DecoderTimingRing> mTimingRing;
 };
 } // namespace tensorrt_llm::runtime
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/iBuffer.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::runtime
+{
+
+//! \brief Opt-in allocation-site tracker complementing the totals in MemoryCounters.
+//!
+//! \details When enabled (TRTLLM_MEMORY_PROFILER or setEnabled), every allocation going through the
+//! tllmBuffers.h allocators records a lightweight stack fingerprint (raw return addresses, no
+//! symbolization) with byte attribution per memory type. The aggregated sites can be exported in
+//! the pprof-compatible legacy heap profile format, so a memory regression is attributed to its
+//! call site with `pprof --text <binary> <profile>` instead of a sanitizer rebuild and bisect.
+//! Recording takes one backtrace and a short critical section per allocation; the disabled check on
+//! the allocator hot path is a single relaxed atomic load.
+class MemoryProfiler
+{
+public:
+    static SizeType32 constexpr kMaxFrames = 24;
+
+    static MemoryProfiler& getInstance();
+
+    [[nodiscard]] static bool isEnabled()
+    {
+        return mEnabled.load(std::memory_order_relaxed);
+    }
+
+    //! \brief Enables or disables recording. Sites recorded so far are kept.
+    static void setEnabled(bool enabled)
+    {
+        mEnabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void recordAlloc(MemoryType memoryType, void const* ptr, std::size_t size);
+
+    void recordFree(void const* ptr);
+
+    //! \brief Renders all recorded sites, or only those of \p memoryType, as a legacy pprof heap
+    //! profile ("heap profile:" header, one line per site, followed by the process mappings).
+    [[nodiscard]] std::string toPprofProfile(std::optional<MemoryType> memoryType = std::nullopt) const;
+
+    //! \brief Writes toPprofProfile to \p path.
+    void writeProfile(std::string const& path, std::optional<MemoryType> memoryType = std::nullopt) const;
+
+    //! \brief Drops all recorded sites and live allocations.
+    void reset();
+
+private:
+    MemoryProfiler() = default;
+
+    struct Site
+    {
+        std::array<void*, kMaxFrames> frames{};
+        SizeType32 depth{0};
+        // Indexed by MemoryType; tracks live bytes/objects and cumulative allocated bytes/objects.
+        std::array<std::size_t, 5> inUseBytes{};
+        std::array<std::size_t, 5> inUseObjects{};
+        std::array<std::size_t, 5> allocBytes{};
+        std::array<std::size_t, 5> allocObjects{};
+    };
+
+    struct LiveAlloc
+    {
+        std::uint64_t siteId;
+        MemoryType memoryType;
+        std::size_t size;
+    };
+
+    static std::atomic<bool> mEnabled;
+
+    mutable std::mutex mMutex;
+    std::unordered_map<std::uint64_t, Site> mSites;
+    std::unordered_map<void const*, LiveAlloc> mLiveAllocs;
+};
+
+} // namespace tensorrt_llm::runtime
@@ -71,7 +71,11 @@ enum class MpiTag : int
 
     // KvCacheEventManager
     kKvCacheEventSize = 1026,
-    kKvCacheEvent = 1027
+    kKvCacheEvent = 1027,
+
+    // Orchestrator shared-memory transport handshake
+    kOrchestratorShmHostname = 1028,
+    kOrchestratorShmName = 1029
 };
 
 } // namespace tensorrt_llm::mpi
@@ -467,6 +467,12 @@ int getNumNodes();
 
 void initialize(MpiThreadSupport threadMode = MpiThreadSupport::THREAD_MULTIPLE, bool forwardAbortToParent = false);
 
+//! \brief Initializes MPI even for a single-process launch, where initialize() elides it. Needed
+//! before MPI features beyond plain communication, e.g. spawning worker processes or connecting to
+//! an orchestrator through MPI ports.
+void forceInitialize(
+    MpiThreadSupport threadMode = MpiThreadSupport::THREAD_MULTIPLE, bool forwardAbortToParent = false);
+
 class MpiWaitThread
 {
 public:
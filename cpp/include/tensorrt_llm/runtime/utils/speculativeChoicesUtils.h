@@ -32,6 +32,13 @@ struct TreeNode
     std::vector<SizeType32> childLinearIndices;
 };
 
+//! @brief Build the linearized draft tree and its tensors from the choices of a Medusa-style tree.
+//!
+//! Choices describe root-to-node paths, which share prefixes between sibling paths. They are deduplicated
+//! into a tree of unique nodes, and every tensor is indexed by the node's linearIdx: each unique draft token
+//! occupies exactly one engine input position and therefore one KV cache slot during verification, regardless
+//! of how many paths run through it. The packed mask encodes the tree's adjacency so that tree attention
+//! restricts every node to its own root-to-node prefix.
 SizeType32 initTensorsFromChoices(SpeculativeDecodingModule const& speculativeDecodingModule,
     std::vector<std::vector<SizeType32>> const& choices, std::vector<SizeType32>& topKs,
     ITensor::SharedPtr generationInputLengths, ITensor::SharedPtr positionOffsets, ITensor::SharedPtr treeIds,
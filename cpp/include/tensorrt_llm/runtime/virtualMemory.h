@@ -447,6 +447,70 @@ private:
     friend VirtualMemoryManagerTest;
 };
 
+/**
+ * GrowableDeviceBuffer reserves a fixed virtual address range up front and backs a prefix of
+ * it with physical memory, mapped on demand in fixed-size chunks. Growing maps additional
+ * chunks and shrinking unmaps tail chunks and returns their physical memory to the driver.
+ * The base address never changes, so offsets into the mapped prefix stay valid across
+ * resizes. The KV cache manager uses this to resize its block pools at runtime without
+ * copying live blocks.
+ */
+class GrowableDeviceBuffer
+{
+public:
+    /**
+     * Reserve address space for `capacity` bytes on `device`, mapped in chunks of
+     * `chunkSize` bytes. Both sizes are rounded up to the allocation granularity of the
+     * device. No physical memory is mapped until grow() is called.
+     */
+    GrowableDeviceBuffer(std::size_t capacity, std::size_t chunkSize, int device);
+
+    GrowableDeviceBuffer(GrowableDeviceBuffer const&) = delete;
+    GrowableDeviceBuffer& operator=(GrowableDeviceBuffer const&) = delete;
+    GrowableDeviceBuffer(GrowableDeviceBuffer&&) = delete;
+    GrowableDeviceBuffer& operator=(GrowableDeviceBuffer&&) = delete;
+
+    ~GrowableDeviceBuffer();
+
+    [[nodiscard]] void* data() const noexcept;
+
+    /// Bytes of reserved address space.
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return mChunkSize * mChunks.size();
+    }
+
+    /// Bytes currently backed by physical memory.
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return mChunkSize * mMappedChunks;
+    }
+
+    [[nodiscard]] std::size_t chunkSize() const noexcept
+    {
+        return mChunkSize;
+    }
+
+    /**
+     * Map chunks until at least `newSize` bytes are backed.
+     * @return The new backed size. Throws if `newSize` exceeds capacity().
+     */
+    std::size_t grow(std::size_t newSize);
+
+    /**
+     * Unmap tail chunks while at least `newSize` bytes stay backed, returning their
+     * physical memory to the driver. The content of the remaining prefix is unaffected.
+     * @return The new backed size.
+     */
+    std::size_t shrink(std::size_t newSize);
+
+private:
+    CUdeviceptr mAddress{};
+    std::size_t mChunkSize{};
+    std::size_t mMappedChunks{};
+    std::vector<CUDAVirtualMemoryChunk> mChunks;
+};
+
 class CudaVirtualMemoryAllocator
 {
     using CudaStreamPtr = std::shared_ptr<CudaStream>;
@@ -0,0 +1,359 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks the two attention paths that dominate GPU time in serving: the XQA decode kernels
+// (through DecoderXQARunner, with a paged KV cache) and the context FMHA kernels (through
+// FmhaDispatcher, packed QKV). The sweeps cover batch size, KV length, head configuration,
+// paged-block size and dtype. Every run reports GFLOPS, GB/s and the arithmetic intensity
+// (FLOP/byte) as counters, so results can be placed on the roofline of the device directly;
+// decode is expected to sit on the bandwidth side, context on the compute side.
+
+#include <benchmark/benchmark.h>
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention/decoderXQARunner.h"
+#include "tensorrt_llm/kernels/fmhaDispatcher.h"
+#include "tensorrt_llm/kernels/kvCacheUtils.h"
+#include "tensorrt_llm/kernels/multiHeadAttentionCommon.h"
+
+#include <cuda_fp16.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using namespace tensorrt_llm::common;
+using namespace tensorrt_llm::kernels;
+
+namespace
+{
+
+struct DeviceBuffer
+{
+    explicit DeviceBuffer(size_t bytes)
+    {
+        check_cuda_error(cudaMalloc(&ptr, bytes));
+        check_cuda_error(cudaMemset(ptr, 0, bytes));
+    }
+
+    ~DeviceBuffer()
+    {
+        cudaFree(ptr);
+    }
+
+    DeviceBuffer(DeviceBuffer const&) = delete;
+    DeviceBuffer& operator=(DeviceBuffer const&) = delete;
+
+    template <typename T = void>
+    T* get() const
+    {
+        return static_cast<T*>(ptr);
+    }
+
+    void* ptr{nullptr};
+};
+
+template <typename T>
+DeviceBuffer uploadVector(std::vector<T> const& hostData)
+{
+    DeviceBuffer buffer(hostData.size() * sizeof(T));
+    check_cuda_error(cudaMemcpy(buffer.ptr, hostData.data(), hostData.size() * sizeof(T), cudaMemcpyHostToDevice));
+    return buffer;
+}
+
+void reportRoofline(benchmark::State& state, double flops, double bytes)
+{
+    state.counters["GFLOPS"] = benchmark::Counter(flops / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["GBps"] = benchmark::Counter(bytes / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+    // Compare against the device's FLOP/byte ridge point to see whether a config is bandwidth or
+    // compute bound; this one is iteration invariant, not a rate.
+    state.counters["flop_per_byte"] = benchmark::Counter(flops / bytes);
+}
+
+// Decode-phase attention: one new token per sequence against a paged KV cache.
+// {batch, kvLen, numQHeads, numKvHeads, headSize, tokensPerBlock, useBf16}
+void runXqaDecode(benchmark::State& state)
+{
+    auto const batchSize = static_cast<int>(state.range(0));
+    auto const kvLen = static_cast<int>(state.range(1));
+    auto const numQHeads = static_cast<int>(state.range(2));
+    auto const numKvHeads = static_cast<int>(state.range(3));
+    auto const headSize = static_cast<int>(state.range(4));
+    auto const tokensPerBlock = static_cast<int>(state.range(5));
+    bool const useBf16 = state.range(6) != 0;
+
+    auto const dataType = useBf16 ? DATA_TYPE_BF16 : DATA_TYPE_FP16;
+    size_t constexpr kElemSize = 2;
+    auto const maxBlocksPerSeq = (kvLen + tokensPerBlock - 1) / tokensPerBlock;
+    auto const bytesPerToken = static_cast<int>(numKvHeads * headSize * kElemSize);
+
+    DecoderXQARunner runner(dataType, numQHeads, numKvHeads, headSize, /* multi_block_mode */ true);
+
+    // QKV of the single new token per sequence, attention output, and scratch.
+    DeviceBuffer qkv(static_cast<size_t>(batchSize) * (numQHeads + 2 * numKvHeads) * headSize * kElemSize);
+    DeviceBuffer output(static_cast<size_t>(batchSize) * numQHeads * headSize * kElemSize);
+    DeviceBuffer workspace(size_t{256} << 20);
+    DeviceBuffer semaphores(static_cast<size_t>(batchSize) * numQHeads * sizeof(int32_t));
+
+    std::vector<int32_t> const pastKvLengths(batchSize, kvLen - 1);
+    std::vector<int32_t> const contextLengths(batchSize, kvLen - 1);
+    auto const sequenceLengths = uploadVector(std::vector<int32_t>(batchSize, kvLen));
+    auto const contextLengthsDevice = uploadVector(contextLengths);
+
+    // Paged KV cache with one unique pool block per (sequence, K/V, block) entry.
+    DeviceBuffer kvCachePool(static_cast<size_t>(batchSize) * 2 * maxBlocksPerSeq * tokensPerBlock * bytesPerToken);
+    std::vector<KVCacheIndex> blockOffsets;
+    blockOffsets.reserve(static_cast<size_t>(batchSize) * 2 * maxBlocksPerSeq);
+    for (int32_t blockIdx = 0; blockIdx < batchSize * 2 * maxBlocksPerSeq; ++blockIdx)
+    {
+        blockOffsets.emplace_back(blockIdx);
+    }
+    auto const blockOffsetsDevice = uploadVector(blockOffsets);
+    KVBlockArray kvCacheBuffer(batchSize, maxBlocksPerSeq, tokensPerBlock, bytesPerToken, kvLen, kvLen,
+        /* sinkTokenLen */ 0, /* canUseOneMoreBlock */ false, kvCachePool.ptr, nullptr,
+        blockOffsetsDevice.get<KVCacheIndex const>());
+
+    XQAParams params{};
+    params.data_type = dataType;
+    params.kv_cache_data_type = dataType;
+    params.output_data_type = dataType;
+    params.output = output.ptr;
+    params.qkv = qkv.ptr;
+    params.host_past_key_value_lengths = pastKvLengths.data();
+    params.host_context_lengths = contextLengths.data();
+    params.semaphores = semaphores.get<int32_t>();
+    params.workspaces = workspace.ptr;
+    params.batch_size = batchSize;
+    params.beam_width = 1;
+    params.max_attention_window_size = kvLen;
+    params.cyclic_attention_window_size = kvLen;
+    params.max_past_kv_length = kvLen - 1;
+    params.qkv_bias = nullptr;
+    params.sequence_lengths = sequenceLengths.get<int32_t const>();
+    params.context_lengths = contextLengthsDevice.get<int32_t const>();
+    params.generation_input_length = 1;
+    params.num_q_heads = numQHeads;
+    params.num_kv_heads = numKvHeads;
+    params.head_size = headSize;
+    params.unidirectional = 1;
+    params.q_scaling = 1.F;
+    params.position_embedding_type = PositionEmbeddingType::kLEARNED_ABSOLUTE;
+    params.mask_type = AttentionMaskType::CAUSAL;
+    params.paged_kv_cache = true;
+    params.tokens_per_block = tokensPerBlock;
+    params.max_blocks_per_sequence = maxBlocksPerSeq;
+    params.qkv_bias_enabled = false;
+    params.cross_attention = false;
+    params.multi_block_mode = true;
+    params.total_num_input_tokens = batchSize;
+    params.is_fp8_output = false;
+
+    if (!runner.shouldUse(params, /* forConfigurePlugin */ false))
+    {
+        state.SkipWithMessage("XQA does not support this configuration");
+        return;
+    }
+
+    cudaStream_t stream;
+    check_cuda_error(cudaStreamCreate(&stream));
+    params.stream = stream;
+    cudaEvent_t startEvent;
+    cudaEvent_t endEvent;
+    check_cuda_error(cudaEventCreate(&startEvent));
+    check_cuda_error(cudaEventCreate(&endEvent));
+
+    runner.prepare(params);
+    // Warm once outside the timed loop to absorb cubin loading.
+    runner.dispatch(params, kvCacheBuffer, stream);
+    check_cuda_error(cudaStreamSynchronize(stream));
+
+    for (auto _ : state)
+    {
+        check_cuda_error(cudaEventRecord(startEvent, stream));
+        runner.dispatch(params, kvCacheBuffer, stream);
+        check_cuda_error(cudaEventRecord(endEvent, stream));
+        check_cuda_error(cudaEventSynchronize(endEvent));
+        float elapsedMs{0.F};
+        check_cuda_error(cudaEventElapsedTime(&elapsedMs, startEvent, endEvent));
+        state.SetIterationTime(elapsedMs / 1000.F);
+    }
+
+    // Decode reads the whole KV cache once and is dominated by it; QK^T and PV contribute
+    // 2 * 2 * H * D FLOPs per cached token.
+    double const bytes = static_cast<double>(batchSize) * kvLen * 2 * numKvHeads * headSize * kElemSize
+        + static_cast<double>(batchSize) * (numQHeads + 2 * numKvHeads) * headSize * kElemSize
+        + static_cast<double>(batchSize) * numQHeads * headSize * kElemSize;
+    double const flops = 4.0 * batchSize * numQHeads * headSize * kvLen;
+    reportRoofline(state, flops, bytes);
+
+    check_cuda_error(cudaEventDestroy(startEvent));
+    check_cuda_error(cudaEventDestroy(endEvent));
+    check_cuda_error(cudaStreamDestroy(stream));
+}
+
+// Context-phase attention: full causal prefill with packed QKV input.
+// {batch, seqLen, numQHeads, numKvHeads, headSize, useBf16}
+void runFmhaContext(benchmark::State& state)
+{
+    auto const batchSize = static_cast<int>(state.range(0));
+    auto const seqLen = static_cast<int>(state.range(1));
+    auto const numQHeads = static_cast<int>(state.range(2));
+    auto const numKvHeads = static_cast<int>(state.range(3));
+    auto const headSize = static_cast<int>(state.range(4));
+    bool const useBf16 = state.range(5) != 0;
+
+    auto const dataType = useBf16 ? DATA_TYPE_BF16 : DATA_TYPE_FP16;
+    size_t constexpr kElemSize = 2;
+    auto const totalTokens = batchSize * seqLen;
+
+    MHARunnerFixedParams fixedParams{};
+    fixedParams.dataType = dataType;
+    fixedParams.dataTypeKv = dataType;
+    fixedParams.dataTypeOut = dataType;
+    fixedParams.forceFp32Acc = false;
+    fixedParams.attentionMaskType = ContextAttentionMaskType::CAUSAL;
+    fixedParams.attentionInputLayout = AttentionInputLayout::PACKED_QKV;
+    fixedParams.isSPadded = false;
+    fixedParams.numQHeads = numQHeads;
+    fixedParams.numKvHeads = numKvHeads;
+    fixedParams.numTokensPerBlock = 0;
+    fixedParams.headSize = headSize;
+    fixedParams.headSizeV = headSize;
+    fixedParams.qScaling = 1.F;
+
+    FmhaDispatcher dispatcher(fixedParams);
+    if (!dispatcher.isSupported())
+    {
+        state.SkipWithMessage("No context FMHA kernel supports this configuration");
+        return;
+    }
+
+    DeviceBuffer qkv(static_cast<size_t>(totalTokens) * (numQHeads + 2 * numKvHeads) * headSize * kElemSize);
+    DeviceBuffer output(static_cast<size_t>(totalTokens) * numQHeads * headSize * kElemSize);
+    DeviceBuffer tileCounter(sizeof(uint32_t));
+
+    std::vector<int32_t> cuSeqLens(batchSize + 1);
+    for (int32_t si = 0; si <= batchSize; ++si)
+    {
+        cuSeqLens[si] = si * seqLen;
+    }
+    auto const cuQSeqLenDevice = uploadVector(cuSeqLens);
+    auto const cuKvSeqLenDevice = uploadVector(cuSeqLens);
+    auto const kvSeqLenDevice = uploadVector(std::vector<int32_t>(batchSize, seqLen));
+
+    MHARunnerParams runnerParams{};
+    runnerParams.b = batchSize;
+    runnerParams.qSeqLen = seqLen;
+    runnerParams.kvSeqLen = seqLen;
+    runnerParams.slidingWindowSize = seqLen;
+    runnerParams.totalQSeqLen = totalTokens;
+    runnerParams.totalKvSeqLen = totalTokens;
+    runnerParams.qkvPtr = qkv.ptr;
+    runnerParams.outputPtr = output.ptr;
+    runnerParams.cuQSeqLenPtr = cuQSeqLenDevice.ptr;
+    runnerParams.kvSeqLenPtr = kvSeqLenDevice.ptr;
+    runnerParams.cuKvSeqLenPtr = cuKvSeqLenDevice.ptr;
+    runnerParams.tileCounterPtr = tileCounter.ptr;
+
+    cudaStream_t stream;
+    check_cuda_error(cudaStreamCreate(&stream));
+    runnerParams.stream = stream;
+    cudaEvent_t startEvent;
+    cudaEvent_t endEvent;
+    check_cuda_error(cudaEventCreate(&startEvent));
+    check_cuda_error(cudaEventCreate(&endEvent));
+
+    dispatcher.run(runnerParams);
+    check_cuda_error(cudaStreamSynchronize(stream));
+
+    for (auto _ : state)
+    {
+        check_cuda_error(cudaEventRecord(startEvent, stream));
+        dispatcher.run(runnerParams);
+        check_cuda_error(cudaEventRecord(endEvent, stream));
+        check_cuda_error(cudaEventSynchronize(endEvent));
+        float elapsedMs{0.F};
+        check_cuda_error(cudaEventElapsedTime(&elapsedMs, startEvent, endEvent));
+        state.SetIterationTime(elapsedMs / 1000.F);
+    }
+
+    // Causal prefill visits seqLen * (seqLen + 1) / 2 key positions per query head.
+    double const visitedPositions = static_cast<double>(batchSize) * numQHeads * seqLen * (seqLen + 1) / 2;
+    double const flops = 4.0 * visitedPositions * headSize;
+    double const bytes = static_cast<double>(totalTokens) * (numQHeads + 2 * numKvHeads) * headSize * kElemSize
+        + static_cast<double>(totalTokens) * numQHeads * headSize * kElemSize;
+    reportRoofline(state, flops, bytes);
+
+    check_cuda_error(cudaEventDestroy(startEvent));
+    check_cuda_error(cudaEventDestroy(endEvent));
+    check_cuda_error(cudaStreamDestroy(stream));
+}
+
+} // namespace
+
+// {batch, kvLen, numQHeads, numKvHeads, headSize, tokensPerBlock, useBf16}
+BENCHMARK(runXqaDecode)
+    ->Name("xqaDecode_batch")
+    ->Args({1, 2048, 32, 8, 128, 64, 0})
+    ->Args({8, 2048, 32, 8, 128, 64, 0})
+    ->Args({64, 2048, 32, 8, 128, 64, 0})
+    ->Args({256, 2048, 32, 8, 128, 64, 0})
+    ->UseManualTime();
+
+BENCHMARK(runXqaDecode)
+    ->Name("xqaDecode_kvLen")
+    ->Args({8, 512, 32, 8, 128, 64, 0})
+    ->Args({8, 8192, 32, 8, 128, 64, 0})
+    ->Args({8, 32768, 32, 8, 128, 64, 0})
+    ->UseManualTime();
+
+BENCHMARK(runXqaDecode)
+    ->Name("xqaDecode_heads")
+    ->Args({8, 2048, 32, 1, 128, 64, 0})
+    ->Args({8, 2048, 32, 4, 128, 64, 0})
+    ->Args({8, 2048, 64, 8, 128, 64, 0})
+    ->Args({8, 2048, 32, 8, 64, 64, 0})
+    ->UseManualTime();
+
+BENCHMARK(runXqaDecode)
+    ->Name("xqaDecode_blockSize")
+    ->Args({8, 2048, 32, 8, 128, 16, 0})
+    ->Args({8, 2048, 32, 8, 128, 32, 0})
+    ->Args({8, 2048, 32, 8, 128, 128, 0})
+    ->UseManualTime();
+
+BENCHMARK(runXqaDecode)->Name("xqaDecode_bf16")->Args({8, 2048, 32, 8, 128, 64, 1})->UseManualTime();
+
+// {batch, seqLen, numQHeads, numKvHeads, headSize, useBf16}
+BENCHMARK(runFmhaContext)
+    ->Name("fmhaContext_seqLen")
+    ->Args({8, 512, 32, 8, 128, 0})
+    ->Args({8, 2048, 32, 8, 128, 0})
+    ->Args({1, 8192, 32, 8, 128, 0})
+    ->Args({1, 32768, 32, 8, 128, 0})
+    ->UseManualTime();
+
+BENCHMARK(runFmhaContext)
+    ->Name("fmhaContext_heads")
+    ->Args({8, 2048, 32, 32, 128, 0})
+    ->Args({8, 2048, 32, 1, 128, 0})
+    ->Args({8, 2048, 32, 8, 64, 0})
+    ->UseManualTime();
+
+BENCHMARK(runFmhaContext)->Name("fmhaContext_bf16")->Args({8, 2048, 32, 8, 128, 1})->UseManualTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,271 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks the FlashMLA split-KV decode kernel at the MLA geometry it is built for (head size
+// 576, value head size 512, 64-token paged blocks) across every dtype combination the dispatcher
+// in AttentionOp::mlaGeneration can route to it: fp16, bf16, and FP8 KV cache with either bf16 or
+// fp16 output. The sweeps cover batch size and KV length so the four combinations can be compared
+// like-for-like at each shape; decode is bandwidth bound, so the GBps counter is the one that
+// should be flat across dtypes once the per-token byte counts are taken into account.
+
+#include <benchmark/benchmark.h>
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/flashMLA/flash_mla.h"
+
+#include <cutlass/numeric_types.h>
+
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using namespace tensorrt_llm::common;
+
+namespace
+{
+
+struct DeviceBuffer
+{
+    explicit DeviceBuffer(size_t bytes)
+    {
+        check_cuda_error(cudaMalloc(&ptr, bytes));
+        check_cuda_error(cudaMemset(ptr, 0, bytes));
+    }
+
+    ~DeviceBuffer()
+    {
+        cudaFree(ptr);
+    }
+
+    DeviceBuffer(DeviceBuffer const&) = delete;
+    DeviceBuffer& operator=(DeviceBuffer const&) = delete;
+
+    template <typename T = void>
+    T* get() const
+    {
+        return static_cast<T*>(ptr);
+    }
+
+    void* ptr{nullptr};
+};
+
+template <typename T>
+DeviceBuffer uploadVector(std::vector<T> const& hostData)
+{
+    DeviceBuffer buffer(hostData.size() * sizeof(T));
+    check_cuda_error(cudaMemcpy(buffer.ptr, hostData.data(), hostData.size() * sizeof(T), cudaMemcpyHostToDevice));
+    return buffer;
+}
+
+enum class MlaDtype : int
+{
+    kFP16 = 0,     // fp16 KV cache, fp16 output
+    kBF16 = 1,     // bf16 KV cache, bf16 output
+    kFP8toBF16 = 2, // FP8 KV cache, bf16 output
+    kFP8toFP16 = 3, // FP8 KV cache, fp16 output
+};
+
+// Single-token decode through the FlashMLA split-KV kernel against a paged latent KV cache.
+// {batch, kvLen, numQHeads, dtype}
+void runFlashMlaDecode(benchmark::State& state)
+{
+    auto const batchSize = static_cast<int>(state.range(0));
+    auto const kvLen = static_cast<int>(state.range(1));
+    auto const numQHeads = static_cast<int>(state.range(2));
+    auto const dtype = static_cast<MlaDtype>(state.range(3));
+
+    if (getSMVersion() != 90)
+    {
+        state.SkipWithMessage("FlashMLA kernels are built for SM90 only");
+        return;
+    }
+
+    // Kernel-fixed MLA geometry: latent dim 512 + rope dim 64, shared K/V, 64-token blocks.
+    int constexpr kHeadDim = 576;
+    int constexpr kHeadDimV = 512;
+    int constexpr kTokensPerBlock = 64;
+    int constexpr kBlockSizeM = 64;
+    int constexpr kFixedOverheadNumBlocks = 5;
+    int constexpr sQ = 1;
+
+    bool const fp8Kv = dtype == MlaDtype::kFP8toBF16 || dtype == MlaDtype::kFP8toFP16;
+    size_t const kvElemSize = fp8Kv ? 1 : 2;
+    auto const maxBlocksPerSeq = (kvLen + kTokensPerBlock - 1) / kTokensPerBlock;
+
+    int smCount{0};
+    check_cuda_error(cudaDeviceGetAttribute(&smCount, cudaDevAttrMultiProcessorCount, 0));
+    auto const numSmParts = std::max(1, smCount / ((sQ * numQHeads + kBlockSizeM - 1) / kBlockSizeM));
+
+    // One new query token per sequence; q shares the KV cache dtype.
+    DeviceBuffer q(static_cast<size_t>(batchSize) * numQHeads * kHeadDim * kvElemSize);
+    DeviceBuffer output(static_cast<size_t>(batchSize) * numQHeads * kHeadDimV * 2);
+    DeviceBuffer kvCachePool(static_cast<size_t>(batchSize) * maxBlocksPerSeq * kTokensPerBlock * kHeadDim * kvElemSize);
+
+    std::vector<int32_t> blockTable(static_cast<size_t>(batchSize) * maxBlocksPerSeq);
+    std::iota(blockTable.begin(), blockTable.end(), 0);
+    auto const blockTableDevice = uploadVector(blockTable);
+    auto const seqLensDevice = uploadVector(std::vector<int32_t>(batchSize, kvLen));
+    auto const descales = uploadVector(std::vector<float>{1.F, 1.F});
+
+    DeviceBuffer tileSchedulerMetadata(static_cast<size_t>(numSmParts) * TileSchedulerMetaDataSize * sizeof(int));
+    DeviceBuffer numSplits(static_cast<size_t>(batchSize + 1) * sizeof(int));
+    DeviceBuffer softmaxLse(static_cast<size_t>(batchSize) * sQ * numQHeads * sizeof(float));
+    DeviceBuffer softmaxLseAccum(static_cast<size_t>(batchSize + numSmParts) * numQHeads * sQ * sizeof(float));
+    DeviceBuffer outAccum(static_cast<size_t>(batchSize + numSmParts) * numQHeads * sQ * kHeadDimV * sizeof(float));
+
+    cudaStream_t stream;
+    check_cuda_error(cudaStreamCreate(&stream));
+
+    Mla_metadata_params metadataParams{};
+    metadataParams.seqlens_k_ptr = seqLensDevice.get<int>();
+    metadataParams.tile_scheduler_metadata_ptr = tileSchedulerMetadata.get<int>();
+    metadataParams.num_splits_ptr = numSplits.get<int>();
+    metadataParams.batch_size = batchSize;
+    metadataParams.block_size_n = kTokensPerBlock;
+    metadataParams.fixed_overhead_num_blocks = kFixedOverheadNumBlocks;
+    metadataParams.num_sm_parts = numSmParts;
+
+    float const softmaxScale = 1.F / std::sqrt(static_cast<float>(kHeadDim));
+
+    Flash_fwd_mla_params params{};
+    params.b = batchSize;
+    params.seqlen_q = numQHeads * sQ;
+    params.cu_seqlens_k = seqLensDevice.get<int>();
+    params.h = 1;
+    params.h_h_k_ratio = 1;
+    params.ngroups = numQHeads;
+    params.is_causal = false;
+    params.d = kHeadDim;
+    params.d_v = kHeadDimV;
+    params.scale_softmax = softmaxScale;
+    params.scale_softmax_log2 = softmaxScale * static_cast<float>(M_LOG2E);
+    params.q_ptr = q.ptr;
+    params.k_ptr = kvCachePool.ptr;
+    params.v_ptr = kvCachePool.ptr;
+    params.o_ptr = output.ptr;
+    params.softmax_lse_ptr = softmaxLse.ptr;
+    params.q_batch_stride = static_cast<int64_t>(kHeadDim) * numQHeads * sQ;
+    params.k_batch_stride = static_cast<int64_t>(kTokensPerBlock) * kHeadDim;
+    params.v_batch_stride = params.k_batch_stride;
+    params.o_batch_stride = static_cast<int64_t>(sQ) * numQHeads * kHeadDimV;
+    params.q_row_stride = kHeadDim;
+    params.k_row_stride = kHeadDim;
+    params.v_row_stride = kHeadDim;
+    params.o_row_stride = kHeadDimV;
+    params.q_head_stride = kHeadDim;
+    params.k_head_stride = kHeadDim;
+    params.v_head_stride = kHeadDim;
+    params.o_head_stride = kHeadDimV;
+    params.block_table = blockTableDevice.get<int>();
+    params.block_table_batch_stride = maxBlocksPerSeq;
+    params.page_block_size = kTokensPerBlock;
+    params.descale_q_ptr = descales.get<float>();
+    params.descale_k_ptr = descales.get<float>() + 1;
+    params.tile_scheduler_metadata_ptr = tileSchedulerMetadata.get<int>();
+    params.num_sm_parts = numSmParts;
+    params.num_splits_ptr = numSplits.get<int>();
+    params.softmax_lseaccum_ptr = softmaxLseAccum.ptr;
+    params.oaccum_ptr = outAccum.ptr;
+
+    auto const runOnce = [&]()
+    {
+        get_mla_metadata_func(metadataParams, stream);
+        switch (dtype)
+        {
+        case MlaDtype::kFP16: run_mha_fwd_splitkv_mla<cutlass::half_t, cutlass::half_t, 576>(params, stream); break;
+        case MlaDtype::kBF16:
+            run_mha_fwd_splitkv_mla<cutlass::bfloat16_t, cutlass::bfloat16_t, 576>(params, stream);
+            break;
+        case MlaDtype::kFP8toBF16:
+            run_mha_fwd_splitkv_mla<cutlass::float_e4m3_t, cutlass::bfloat16_t, 576>(params, stream);
+            break;
+        case MlaDtype::kFP8toFP16:
+            run_mha_fwd_splitkv_mla<cutlass::float_e4m3_t, cutlass::half_t, 576>(params, stream);
+            break;
+        }
+    };
+
+    cudaEvent_t startEvent;
+    cudaEvent_t endEvent;
+    check_cuda_error(cudaEventCreate(&startEvent));
+    check_cuda_error(cudaEventCreate(&endEvent));
+
+    // Warm once outside the timed loop to absorb module loading.
+    runOnce();
+    check_cuda_error(cudaStreamSynchronize(stream));
+
+    for (auto _ : state)
+    {
+        check_cuda_error(cudaEventRecord(startEvent, stream));
+        runOnce();
+        check_cuda_error(cudaEventRecord(endEvent, stream));
+        check_cuda_error(cudaEventSynchronize(endEvent));
+        float elapsedMs{0.F};
+        check_cuda_error(cudaEventElapsedTime(&elapsedMs, startEvent, endEvent));
+        state.SetIterationTime(elapsedMs / 1000.F);
+    }
+
+    // Decode reads the latent KV cache once; QK^T contributes 2 * d and PV 2 * d_v FLOPs per
+    // (head, cached token) pair.
+    double const bytes = static_cast<double>(batchSize) * kvLen * kHeadDim * kvElemSize
+        + static_cast<double>(batchSize) * numQHeads * kHeadDim * kvElemSize
+        + static_cast<double>(batchSize) * numQHeads * kHeadDimV * 2;
+    double const flops = 2.0 * batchSize * numQHeads * kvLen * (kHeadDim + kHeadDimV);
+    state.counters["GFLOPS"] = benchmark::Counter(flops / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["GBps"] = benchmark::Counter(bytes / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+
+    check_cuda_error(cudaEventDestroy(startEvent));
+    check_cuda_error(cudaEventDestroy(endEvent));
+    check_cuda_error(cudaStreamDestroy(stream));
+}
+
+} // namespace
+
+// {batch, kvLen, numQHeads, dtype}; dtype: 0 fp16, 1 bf16, 2 fp8->bf16, 3 fp8->fp16
+BENCHMARK(runFlashMlaDecode)
+    ->Name("flashMlaDecode_batch")
+    ->Args({1, 4096, 128, 1})
+    ->Args({8, 4096, 128, 1})
+    ->Args({64, 4096, 128, 1})
+    ->Args({256, 4096, 128, 1})
+    ->UseManualTime();
+
+BENCHMARK(runFlashMlaDecode)
+    ->Name("flashMlaDecode_kvLen")
+    ->Args({16, 1024, 128, 1})
+    ->Args({16, 8192, 128, 1})
+    ->Args({16, 32768, 128, 1})
+    ->UseManualTime();
+
+// Tensor-parallel head counts of DeepSeek-V3 (128 total heads at TP1/TP8/TP16).
+BENCHMARK(runFlashMlaDecode)
+    ->Name("flashMlaDecode_heads")
+    ->Args({64, 4096, 16, 1})
+    ->Args({64, 4096, 8, 1})
+    ->UseManualTime();
+
+// All dtype combinations the mlaGeneration dispatcher can route here, at one shape each.
+BENCHMARK(runFlashMlaDecode)
+    ->Name("flashMlaDecode_dtype")
+    ->Args({64, 4096, 128, 0})
+    ->Args({64, 4096, 128, 1})
+    ->Args({64, 4096, 128, 2})
+    ->Args({64, 4096, 128, 3})
+    ->UseManualTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks the two grouped GEMMs of the LoRA path (input projection with splitK, output
+// projection without) on batches that mix adapter ranks, mirroring how lora.cpp builds the
+// problem lists. Compare the *_mixed runs against the *_uniform ones to see the effect of the
+// rank-bucketed tile selection.
+
+#include <benchmark/benchmark.h>
+
+#include "cutlass/gemm_coord.h"
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/groupGemm.h"
+#include "tensorrt_llm/kernels/splitkGroupGemm.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace tensorrt_llm::common;
+using namespace tensorrt_llm::kernels;
+
+namespace
+{
+
+constexpr int kSplitKSlices = 16; // Matches LoraImpl::mSplitKSlices.
+
+// One entry per adapter group, in the same [M, N(rank), K(hidden)] / [M, N2(out), K(rank)] form
+// that LoraImpl::run produces.
+struct GroupedProblems
+{
+    std::vector<cutlass::gemm::GemmCoord> problemsIn;
+    std::vector<cutlass::gemm::GemmCoord> problemsOut;
+    std::vector<void*> ptrA;
+    std::vector<void*> ptrB;
+    std::vector<void*> ptrC;
+    std::vector<void*> ptrD;
+    std::vector<void*> ptrA2;
+    std::vector<void*> ptrB2;
+    std::vector<void*> ptrC2;
+    std::vector<void*> ptrD2;
+    int minKN = 0;
+    int maxKN = 0;
+};
+
+void runLoraGroupGemm(benchmark::State& state)
+{
+    int const numGroups = state.range(0);
+    int const tokensPerGroup = state.range(1);
+    int const hiddenSize = state.range(2);
+    int const minRank = state.range(3);
+    int const maxRank = state.range(4);
+
+    int const totalTokens = numGroups * tokensPerGroup;
+
+    // Ranks cycle through the powers of two in [minRank, maxRank], so minRank == maxRank gives a
+    // uniform batch and anything else a mixed one.
+    std::vector<int> ranks(numGroups);
+    int rank = minRank;
+    for (int g = 0; g < numGroups; g++)
+    {
+        ranks[g] = rank;
+        rank *= 2;
+        if (rank > maxRank)
+        {
+            rank = minRank;
+        }
+    }
+
+    size_t inputElems = static_cast<size_t>(totalTokens) * hiddenSize;
+    size_t weightInElems = 0;
+    size_t weightOutElems = 0;
+    size_t midElems = 0;
+    for (int g = 0; g < numGroups; g++)
+    {
+        weightInElems += static_cast<size_t>(hiddenSize) * ranks[g];
+        weightOutElems += static_cast<size_t>(ranks[g]) * hiddenSize;
+        midElems += static_cast<size_t>(tokensPerGroup) * ranks[g];
+    }
+    size_t outputElems = static_cast<size_t>(totalTokens) * hiddenSize;
+
+    half* input{};
+    half* weightIn{};
+    half* weightOut{};
+    half* mid{};
+    half* output{};
+    check_cuda_error(cudaMalloc(&input, inputElems * sizeof(half)));
+    check_cuda_error(cudaMalloc(&weightIn, weightInElems * sizeof(half)));
+    check_cuda_error(cudaMalloc(&weightOut, weightOutElems * sizeof(half)));
+    check_cuda_error(cudaMalloc(&mid, midElems * sizeof(half)));
+    check_cuda_error(cudaMalloc(&output, outputElems * sizeof(half)));
+    check_cuda_error(cudaMemset(input, 0, inputElems * sizeof(half)));
+    check_cuda_error(cudaMemset(weightIn, 0, weightInElems * sizeof(half)));
+    check_cuda_error(cudaMemset(weightOut, 0, weightOutElems * sizeof(half)));
+
+    GroupedProblems problems;
+    problems.minKN = hiddenSize;
+    size_t weightInOffset = 0;
+    size_t weightOutOffset = 0;
+    size_t midOffset = 0;
+    for (int g = 0; g < numGroups; g++)
+    {
+        int const N = ranks[g];
+        problems.problemsIn.emplace_back(tokensPerGroup, N, hiddenSize);
+        problems.problemsOut.emplace_back(tokensPerGroup, hiddenSize, N);
+        problems.ptrA.push_back(input + static_cast<size_t>(g) * tokensPerGroup * hiddenSize);
+        problems.ptrB.push_back(weightIn + weightInOffset);
+        problems.ptrC.push_back(mid + midOffset);
+        problems.ptrD.push_back(mid + midOffset);
+        problems.ptrA2.push_back(mid + midOffset);
+        problems.ptrB2.push_back(weightOut + weightOutOffset);
+        problems.ptrC2.push_back(output + static_cast<size_t>(g) * tokensPerGroup * hiddenSize);
+        problems.ptrD2.push_back(output + static_cast<size_t>(g) * tokensPerGroup * hiddenSize);
+        weightInOffset += static_cast<size_t>(hiddenSize) * N;
+        weightOutOffset += static_cast<size_t>(N) * hiddenSize;
+        midOffset += static_cast<size_t>(tokensPerGroup) * N;
+        problems.minKN = std::min(problems.minKN, N);
+        problems.maxKN = std::max(problems.maxKN, N);
+    }
+
+    int64_t const paramsWorkSpaceSize = std::max(
+        getSplitkGroupedGemmParamsWorkSpaceSize(numGroups), getGroupedGemmParamsWorkSpaceSize(numGroups));
+    int64_t const gemmWorkSpaceSize
+        = static_cast<int64_t>(totalTokens) * maxRank * sizeof(float) * kSplitKSlices + (1 << 25);
+    void* paramsWorkSpace{};
+    void* gemmWorkSpace{};
+    check_cuda_error(cudaMalloc(&paramsWorkSpace, paramsWorkSpaceSize));
+    check_cuda_error(cudaMalloc(&gemmWorkSpace, gemmWorkSpaceSize));
+
+    cudaStream_t stream;
+    check_cuda_error(cudaStreamCreate(&stream));
+    cudaEvent_t startEvent, endEvent;
+    check_cuda_error(cudaEventCreate(&startEvent));
+    check_cuda_error(cudaEventCreate(&endEvent));
+
+    auto runOnce = [&]()
+    {
+        splitkGroupedGemm(problems.problemsIn, problems.ptrA, problems.ptrB, problems.ptrC, problems.ptrD,
+            paramsWorkSpace, paramsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, true, nvinfer1::DataType::kHALF,
+            kSplitKSlices, problems.minKN, problems.maxKN, stream);
+        groupedGemm(problems.problemsOut, problems.ptrA2, problems.ptrB2, problems.ptrC2, problems.ptrD2,
+            paramsWorkSpace, paramsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, false, nvinfer1::DataType::kHALF,
+            problems.minKN, problems.maxKN, stream);
+    };
+
+    // Warmup.
+    runOnce();
+    check_cuda_error(cudaStreamSynchronize(stream));
+
+    for (auto _ : state)
+    {
+        check_cuda_error(cudaEventRecord(startEvent, stream));
+        runOnce();
+        check_cuda_error(cudaEventRecord(endEvent, stream));
+        check_cuda_error(cudaEventSynchronize(endEvent));
+        float ms = 0.f;
+        check_cuda_error(cudaEventElapsedTime(&ms, startEvent, endEvent));
+        state.SetIterationTime(ms / 1000.f);
+    }
+
+    double flops = 0.0;
+    for (int g = 0; g < numGroups; g++)
+    {
+        flops += 4.0 * tokensPerGroup * ranks[g] * hiddenSize;
+    }
+    state.counters["GFLOPS"]
+        = benchmark::Counter(flops / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+
+    check_cuda_error(cudaEventDestroy(startEvent));
+    check_cuda_error(cudaEventDestroy(endEvent));
+    check_cuda_error(cudaStreamDestroy(stream));
+    check_cuda_error(cudaFree(paramsWorkSpace));
+    check_cuda_error(cudaFree(gemmWorkSpace));
+    check_cuda_error(cudaFree(input));
+    check_cuda_error(cudaFree(weightIn));
+    check_cuda_error(cudaFree(weightOut));
+    check_cuda_error(cudaFree(mid));
+    check_cuda_error(cudaFree(output));
+}
+
+} // namespace
+
+// {numGroups, tokensPerGroup, hiddenSize, minRank, maxRank}
+BENCHMARK(runLoraGroupGemm)
+    ->Name("loraGroupGemm_uniform")
+    ->Args({64, 8, 4096, 64, 64})
+    ->Args({64, 8, 4096, 8, 8})
+    ->Args({64, 128, 4096, 16, 16})
+    ->UseManualTime();
+
+BENCHMARK(runLoraGroupGemm)
+    ->Name("loraGroupGemm_mixed")
+    ->Args({64, 8, 4096, 8, 64})
+    ->Args({64, 128, 4096, 8, 64})
+    ->Args({128, 8, 8192, 8, 32})
+    ->UseManualTime();
+
+BENCHMARK_MAIN();
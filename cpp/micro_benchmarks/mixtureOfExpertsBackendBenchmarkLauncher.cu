@@ -384,7 +384,7 @@ void argGenHardcoded(benchmark::internal::Benchmark* benchmark)
     auto top_k = {1, 2, 3, 16};                // {1, 2, 3, 42};
     auto hidden_size = {4096};
     auto inter_size_mul = {4.f};               // {7.f/2.f, 4.f};
-    auto num_tokens = {2048};                  // {1, 20, 200, 2048};
+    auto num_tokens = {1, 8, 64, 2048};        // {1, 20, 200, 2048};
     auto use_bias = {0};                       // {0, 1};
     auto activation_type = {ActivationType::Gelu};
     // {ActivationType::Relu, ActivationType::Gelu,
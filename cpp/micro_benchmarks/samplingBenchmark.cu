@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Benchmarks one decode step of the sampling stack through DynamicDecodeLayer, the same entry
+// point the decoder uses at runtime, so the penalty, top-K and top-P kernels are all covered.
+// The sweeps vary batch size, vocab size, top-K, top-P and whether runtime penalties are
+// configured; each iteration measures the device time of a full forwardAsync over fresh
+// sequence state.
+
+#include <benchmark/benchmark.h>
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/layers/decodingParams.h"
+#include "tensorrt_llm/layers/dynamicDecodeLayer.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+#include "tensorrt_llm/runtime/cudaStream.h"
+#include "tensorrt_llm/runtime/decodingLayerWorkspace.h"
+#include "tensorrt_llm/runtime/runtimeKernels.h"
+#include "tensorrt_llm/runtime/speculativeDecodingModule.h"
+
+#include <cuda_fp16.h>
+
+#include <memory>
+#include <numeric>
+#include <vector>
+
+using namespace tensorrt_llm::common;
+using namespace tensorrt_llm::layers;
+using namespace tensorrt_llm::runtime;
+
+namespace tk = tensorrt_llm::kernels;
+namespace trk = tensorrt_llm::runtime::kernels;
+namespace tle = tensorrt_llm::executor;
+
+namespace
+{
+
+SizeType32 constexpr kMaxSeqLen = 8;
+
+// One decode step of TopKTopP sampling. {batch, vocab, topK, topP * 100, usePenalties}
+template <typename T>
+void runSamplingStep(benchmark::State& state)
+{
+    auto const batchSize = static_cast<SizeType32>(state.range(0));
+    auto const vocabSize = static_cast<SizeType32>(state.range(1));
+    auto const topK = static_cast<SizeType32>(state.range(2));
+    auto const topP = static_cast<float>(state.range(3)) / 100.F;
+    bool const usePenalties = state.range(4) != 0;
+
+    auto const streamPtr = std::make_shared<CudaStream>();
+    auto const bufferManager = std::make_shared<BufferManager>(streamPtr);
+    auto const dataType = TRTDataType<T>::value;
+
+    auto const decodingMode = tle::DecodingMode::TopKTopP();
+    auto const decodingDomain = DecoderDomain(
+        batchSize, 1, vocabSize, vocabSize, std::make_shared<SpeculativeDecodingModule>(0, 0, 1));
+    auto decodeLayer = std::make_unique<DynamicDecodeLayer<T>>(decodingMode, decodingDomain, bufferManager);
+    auto const workspace = std::make_shared<DecodingLayerWorkspace>(
+        bufferManager, decodingDomain, dataType, decodeLayer->getWorkspaceSize());
+
+    auto logitsDevice = bufferManager->gpu(ITensor::makeShape({batchSize, 1, 1, vocabSize}), dataType);
+    auto seqLengthsDevice = bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    auto finishedDevice
+        = bufferManager->gpu(ITensor::makeShape({batchSize}), TRTDataType<tk::FinishedState::UnderlyingType>::value);
+    auto finishedSumHost = BufferManager::pinned(ITensor::makeShape({1}), nvinfer1::DataType::kFLOAT);
+    auto outputIdsDevice
+        = bufferManager->gpu(ITensor::makeShape({batchSize, 1, kMaxSeqLen}), nvinfer1::DataType::kINT32);
+    auto newTokensDevice = bufferManager->gpu(ITensor::makeShape({1, batchSize}), nvinfer1::DataType::kINT32);
+    auto endIdsDevice = bufferManager->gpu(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+    auto batchSlots = BufferManager::pinned(ITensor::makeShape({batchSize}), nvinfer1::DataType::kINT32);
+
+    auto batchSlotsRange = BufferRange<SizeType32>(*batchSlots);
+    std::iota(batchSlotsRange.begin(), batchSlotsRange.end(), 0);
+
+    // Pseudo-random logits; an end id outside the vocab keeps sequences unfinished.
+    {
+        std::vector<T> logitsHost(static_cast<size_t>(batchSize) * vocabSize);
+        uint32_t lcg = 12345;
+        for (auto& logit : logitsHost)
+        {
+            lcg = lcg * 1664525U + 1013904223U;
+            logit = static_cast<T>(static_cast<float>(lcg % 1024) / 64.F - 8.F);
+        }
+        auto const logitsWrapped = ITensor::wrap(logitsHost, logitsDevice->getShape());
+        bufferManager->copy(*logitsWrapped, *logitsDevice);
+        trk::invokeFill(*outputIdsDevice, TokenIdType{0}, *streamPtr);
+        trk::invokeFill(*endIdsDevice, TokenIdType{vocabSize}, *streamPtr);
+    }
+
+    auto setupParams = std::make_shared<DynamicDecodeSetupParams>();
+    setupParams->penaltyParams = std::make_shared<PenaltySetupParams>();
+    if (usePenalties)
+    {
+        setupParams->penaltyParams->temperature = std::vector<float>{0.8F};
+        setupParams->penaltyParams->repetitionPenalty = std::vector<float>{1.1F};
+        setupParams->penaltyParams->presencePenalty = std::vector<float>{0.1F};
+        setupParams->penaltyParams->frequencyPenalty = std::vector<float>{0.1F};
+        setupParams->penaltyParams->minLength = std::vector<SizeType32>{1};
+    }
+    setupParams->banWordsParams = std::make_shared<BanWordsSetupParams>();
+
+    auto samplingParams = std::make_shared<SamplingSetupParams>();
+    samplingParams->randomSeed = std::vector<uint64_t>{42};
+    samplingParams->runtimeTopK = std::vector<SizeType32>{topK};
+    samplingParams->runtimeTopP = std::vector<float>{topP};
+    samplingParams->normalizeLogProbs = {false};
+    samplingParams->outputLogProbs = {false};
+    samplingParams->cumLogProbs = {false};
+    setupParams->decodingParams = samplingParams;
+
+    decodeLayer->setup(batchSize, 1, batchSlots, setupParams, workspace);
+
+    auto inputs = std::make_shared<SamplingInputs>(endIdsDevice, batchSlots, /* step */ 0, /* ite */ 0, batchSize);
+    inputs->logits = logitsDevice;
+    inputs->finished = finishedDevice;
+    inputs->banWordsInputs = std::make_shared<BanWordsDecodingInputs>(batchSize);
+    inputs->stopCriteriaInputs = std::make_shared<StopCriteriaDecodingInputs>(batchSize);
+
+    auto outputs = std::make_shared<BaseDecodingOutputs>(outputIdsDevice);
+    outputs->sequenceLength = seqLengthsDevice;
+    outputs->finished = finishedDevice;
+    outputs->finishedSum = finishedSumHost;
+    outputs->newTokens = newTokensDevice;
+
+    auto const stream = streamPtr->get();
+    cudaEvent_t startEvent;
+    cudaEvent_t endEvent;
+    check_cuda_error(cudaEventCreate(&startEvent));
+    check_cuda_error(cudaEventCreate(&endEvent));
+
+    // Warm once outside the timed loop so cuRAND state setup and kernel selection are absorbed.
+    trk::invokeFill(*seqLengthsDevice, SizeType32{0}, *streamPtr);
+    trk::invokeFill(*finishedDevice, uint8_t{0}, *streamPtr);
+    decodeLayer->forwardAsync(outputs, inputs, workspace);
+    streamPtr->synchronize();
+
+    for (auto _ : state)
+    {
+        // Reset the sequence state on the stream so every iteration samples the first token; the
+        // resets run before the start event and do not count towards the measured time.
+        trk::invokeFill(*seqLengthsDevice, SizeType32{0}, *streamPtr);
+        trk::invokeFill(*finishedDevice, uint8_t{0}, *streamPtr);
+        check_cuda_error(cudaEventRecord(startEvent, stream));
+        decodeLayer->forwardAsync(outputs, inputs, workspace);
+        check_cuda_error(cudaEventRecord(endEvent, stream));
+        check_cuda_error(cudaEventSynchronize(endEvent));
+        float elapsedMs{0.F};
+        check_cuda_error(cudaEventElapsedTime(&elapsedMs, startEvent, endEvent));
+        state.SetIterationTime(elapsedMs / 1000.F);
+    }
+
+    state.counters["tokens_per_s"]
+        = benchmark::Counter(static_cast<double>(batchSize), benchmark::Counter::kIsIterationInvariantRate);
+    // The sampling stack is bandwidth bound on the logits; report the traffic of one pass.
+    state.counters["logit_GBps"] = benchmark::Counter(
+        static_cast<double>(batchSize) * vocabSize * sizeof(T) / 1e9, benchmark::Counter::kIsIterationInvariantRate);
+
+    check_cuda_error(cudaEventDestroy(startEvent));
+    check_cuda_error(cudaEventDestroy(endEvent));
+}
+
+void runSamplingStepHalf(benchmark::State& state)
+{
+    runSamplingStep<half>(state);
+}
+
+void runSamplingStepFloat(benchmark::State& state)
+{
+    runSamplingStep<float>(state);
+}
+
+} // namespace
+
+// {batch, vocab, topK, topP * 100, usePenalties}
+BENCHMARK(runSamplingStepHalf)
+    ->Name("sampling_batch")
+    ->Args({1, 32000, 32, 100, 0})
+    ->Args({16, 32000, 32, 100, 0})
+    ->Args({64, 32000, 32, 100, 0})
+    ->Args({256, 32000, 32, 100, 0})
+    ->UseManualTime();
+
+BENCHMARK(runSamplingStepHalf)
+    ->Name("sampling_vocab")
+    ->Args({64, 32000, 32, 100, 0})
+    ->Args({64, 128256, 32, 100, 0})
+    ->Args({64, 256000, 32, 100, 0})
+    ->UseManualTime();
+
+BENCHMARK(runSamplingStepHalf)
+    ->Name("sampling_topK")
+    ->Args({64, 128256, 1, 100, 0})
+    ->Args({64, 128256, 8, 100, 0})
+    ->Args({64, 128256, 1024, 100, 0})
+    ->UseManualTime();
+
+BENCHMARK(runSamplingStepHalf)
+    ->Name("sampling_topP")
+    ->Args({64, 128256, 0, 50, 0})
+    ->Args({64, 128256, 0, 90, 0})
+    ->Args({64, 128256, 32, 90, 0})
+    ->UseManualTime();
+
+BENCHMARK(runSamplingStepHalf)
+    ->Name("sampling_penalties")
+    ->Args({64, 128256, 32, 100, 1})
+    ->Args({64, 128256, 0, 90, 1})
+    ->UseManualTime();
+
+BENCHMARK(runSamplingStepFloat)->Name("sampling_fp32Logits")->Args({64, 128256, 32, 100, 0})->UseManualTime();
+
+BENCHMARK_MAIN();
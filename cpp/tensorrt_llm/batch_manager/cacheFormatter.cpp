@@ -214,8 +214,14 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         auto& progress = llmRequest.getContextProgress();
         SizeType32 const numLayers = blockManager.getNumLayers();
         runtime::ITensor::Shape offset = runtime::ITensor::makeShape({0, 0});
+        auto startTime = llmRequest.getSteadyClockNow();
+        size_t sentBytes = 0;
         for (SizeType32 layerIdx = 0; layerIdx < numLayers; layerIdx++)
         {
+            if (session.isCancelled())
+            {
+                TLLM_THROW("KV cache send for request %ld was cancelled", llmRequest.mRequestId);
+            }
             auto const poolIdx = blockManager.getLayerPoolIdx(layerIdx);
             auto const layerIdxInPool = blockManager.getPoolLayerIdx(layerIdx);
             offset.d[1] = layerIdxInPool;
@@ -237,9 +243,21 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
                 {
                     TLLM_LOG_DEBUG("Send layer %d(%d-%d)", layerIdx, poolIdx, layerIdxInPool);
                     session.send(i, layer->data(), layer->getSizeInBytes());
+                    sentBytes += layer->getSizeInBytes();
                 }
             }
         }
+        auto endTime = llmRequest.getSteadyClockNow();
+        double delay = 0.0;
+        if (recordDelay)
+        {
+            delay = std::chrono::duration<double, std::milli>(startTime - lastTokenTime).count();
+        }
+        // The measured span covers waiting for each layer's context pass, so it reflects the
+        // streamed transfer as the decode side experiences it, not pure wire time.
+        double cacheTransferTime
+            = std::max(0.0, std::chrono::duration<double, std::milli>(endTime - startTime).count());
+        session.appendMeasure(delay, cacheTransferTime, sentBytes);
     }
     else
     {
@@ -322,6 +340,12 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         // cache blocks to the corresponding buffer.
         // 5. send the buffer to the corresponding target. Ideally, we send only once (one buffer) for each target.
 
+        if (session.isCancelled())
+        {
+            // Bail out before grabbing a transfer buffer slot; the peer's pending recv is bounded
+            // by the transfer timeout, the same as any other mid-transfer failure.
+            TLLM_THROW("KV cache send for request %ld was cancelled", llmRequest.mRequestId);
+        }
         auto cacheBufferId = mCacheTransBufferManager->assignBufferIndexForSend();
         int peerDuplicateHeadFactor = targetInfo.mPeerDupHeadFactor;
         auto targetNum = connections.size();
@@ -387,6 +411,10 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         {
             TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(), " send processIdx: %ld", processIdx);
             NVTX3_SCOPED_RANGE(sendBufferFun);
+            if (session.isCancelled())
+            {
+                return;
+            }
             TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
             TLLM_CHECK(connections.size() > (processIdx / peerDuplicateHeadFactor));
             TLLM_CHECK(outputSplitCaches.size() > (processIdx / peerDuplicateHeadFactor));
@@ -423,6 +451,10 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
 
                 while (remainSendSize > 0)
                 {
+                    if (session.isCancelled())
+                    {
+                        return;
+                    }
                     TLLM_CHECK(sendUseAllocBuffer != nullptr);
                     auto sendBufferEleSize = sendUseAllocBuffer->getSize();
 
@@ -492,6 +524,12 @@ void CacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& sessio
         }
 
         mCacheTransBufferManager->freeBufferIndexForSend(cacheBufferId);
+        if (session.isCancelled())
+        {
+            // The slot is released above; surface the abort so the sender marks the request failed
+            // instead of completed.
+            TLLM_THROW("KV cache send for request %ld was cancelled", llmRequest.mRequestId);
+        }
     }
     TLLM_LOG_DEBUG(
         mpi::MpiComm::world().getRank(), "End the sending of KV cache for the request ID:%ld ", llmRequest.mRequestId);
@@ -585,6 +623,8 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             SizeType32 const numLayers = cacheShape.d[0];
             TLLM_CHECK(numLayers % numLocalLayers == 0 || numLocalLayers % numLayers == 0);
             auto layerVolume = cacheVolume / cacheShape.d[0];
+            auto startTime = llmRequest.getSteadyClockNow();
+            size_t recvBytes = 0;
             for (SizeType32 layerIdx = 0; layerIdx < numLayers; layerIdx++)
             {
                 // TODO: only send/recv required layers for ctxPP < genPP (numLayers > numLocalLayers)
@@ -607,10 +647,22 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
                             = runtime::ITensor::slice(recvBufferTmps[idx], layerIdxInPool * layerVolume, layerVolume);
                         llmRequest.updateKvCacheSize((*layer).getSizeInBytes());
                         session.recv(pickUpConnections[i], layer->data(), layer->getSizeInBytes());
+                        recvBytes += layer->getSizeInBytes();
                         idx++;
                     }
                 }
             }
+            {
+                auto endTime = llmRequest.getSteadyClockNow();
+                double delay = 0.0;
+                if (recordDelay)
+                {
+                    delay = std::chrono::duration<double, std::milli>(startTime - arrivalTime).count();
+                }
+                double cacheTransferTime
+                    = std::max(0.0, std::chrono::duration<double, std::milli>(endTime - startTime).count());
+                session.appendMeasure(delay, cacheTransferTime, recvBytes);
+            }
             {
                 NVTX3_SCOPED_RANGE(formatInputConcatenate);
                 executor::kv_cache::concatKVCacheDispatch(recvBufferTmps.data(), recvBufferTmps.size(),
@@ -708,6 +760,13 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             {
                 NVTX3_SCOPED_RANGE(formatInputAllocBuffer);
 
+                if (session.isCancelled())
+                {
+                    // Bail out before grabbing a transfer buffer slot; the peer's pending send is
+                    // bounded by the transfer timeout, the same as any other mid-transfer failure.
+                    TLLM_THROW("KV cache reception for request %ld was cancelled", llmRequest.mRequestId);
+                }
+
                 TLLM_CHECK(blockNum > 0);
 
                 auto* agentConnnecion
@@ -750,6 +809,10 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             auto recvBufferFun = [&](int deviceId, size_t processIdx)
             {
                 NVTX3_SCOPED_RANGE(recvBufferFun);
+                if (session.isCancelled())
+                {
+                    return;
+                }
                 TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
                 TLLM_CHECK(pickUpConnections.size() > processIdx);
                 TLLM_CHECK(recvSplitCaches.size() > processIdx);
@@ -779,6 +842,10 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
                     size_t needRecvSize = recvSplitCaches[processIdx]->getSize();
                     while (remainRecvSize > 0)
                     {
+                        if (session.isCancelled())
+                        {
+                            return;
+                        }
                         TLLM_CHECK(recvBufferUsed != nullptr);
                         auto recvBufferEleSize = recvBufferUsed->getSize();
                         auto recvSize = std::min(remainRecvSize, recvBufferEleSize);
@@ -854,6 +921,17 @@ void CacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& sess
             {
                 NVTX3_SCOPED_RANGE(formatInputConcatenate);
 
+                if (session.isCancelled())
+                {
+                    // Drop the partial data: release the slot now and surface the abort so the
+                    // receiver marks the request failed instead of completed.
+                    if (cacheBufferId.has_value())
+                    {
+                        mCacheTransBufferManager->freeBufferIndexForRecv(cacheBufferId);
+                    }
+                    TLLM_THROW("KV cache reception for request %ld was cancelled", llmRequest.mRequestId);
+                }
+
                 executor::kv_cache::concatKvCacheV2Dispatch(
                     recvSplitCaches, outputBuffersPerWindow, destConfig, selfConfig, selfIdx, bufferManager);
 
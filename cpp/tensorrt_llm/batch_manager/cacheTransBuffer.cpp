@@ -227,6 +227,9 @@ CacheTransBufferManager::CacheTransBufferManager(
         mTransferBufferSize = FabricMemory::getAlignedSize(mTransferBufferSize);
     }
     mPreAllocBufferSize = mTransferBufferSize * (mRecvBufferCount + mSendBufferCount);
+    // Overflow buffers that the ring cannot cover are recycled through a small pool; keep at most
+    // a couple of generations' worth so the retained memory stays bounded.
+    mDynamicPoolCapacity = 2 * (mSendBufferCount + mRecvBufferCount);
     TLLM_LOG_INFO(
         "CacheTransBufferManager: mMaxNumTokens:%ld, mRecvBufferCount:%ld, "
         "mSendBufferCount:%ld,mTransferBufferSize:%ld, mPreAllocBufferSize:%ld,mOnlyUseDynamicBuffer:%d "
@@ -361,8 +364,7 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> CacheTransBuf
             }
             else
             {
-                retSplitCaches.push_back(bufferManagerToUse.gpu(
-                    runtime::ITensor::makeShape({static_cast<int64_t>(targetBufferEleSizes[i])}), mDataType));
+                retSplitCaches.push_back(acquireDynamicBuffer(targetBufferEleSizes[i], bufferManagerToUse));
             }
         }
         TLLM_LOG_DEBUG("getOrAllocateBuffers bufferCoverTargetNum:%d", bufferCoverTargetNum);
@@ -380,8 +382,7 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> CacheTransBuf
     {
         for (int i = 0; i < targetNum; i++)
         {
-            retSplitCaches.push_back(bufferManagerToUse.gpu(
-                runtime::ITensor::makeShape({static_cast<int64_t>(targetBufferEleSizes[i])}), mDataType));
+            retSplitCaches.push_back(acquireDynamicBuffer(targetBufferEleSizes[i], bufferManagerToUse));
         }
         bufferCoverTargetNum = targetNum;
     }
@@ -389,6 +390,41 @@ std::tuple<std::vector<runtime::ITensor::SharedPtr>, size_t, bool> CacheTransBuf
     return std::make_tuple(retSplitCaches, bufferCoverTargetNum, mOnlyUseDynamicBuffer);
 }
 
+runtime::ITensor::SharedPtr CacheTransBufferManager::acquireDynamicBuffer(
+    size_t eleSize, runtime::BufferManager const& bufferManagerToUse)
+{
+    runtime::ITensor::SharedPtr buffer;
+    {
+        std::scoped_lock lk(mDynamicPoolMutex);
+        auto it = mDynamicBufferPool.find(eleSize);
+        if (it != mDynamicBufferPool.end())
+        {
+            buffer = std::move(it->second);
+            mDynamicBufferPool.erase(it);
+        }
+    }
+    if (buffer == nullptr)
+    {
+        buffer = bufferManagerToUse.gpu(runtime::ITensor::makeShape({static_cast<int64_t>(eleSize)}), mDataType);
+    }
+    // Alias the tensor with a deleter that recycles it, so the transport keeps seeing the same
+    // registered address range instead of re-registering a fresh allocation every session.
+    auto* rawPtr = buffer.get();
+    return runtime::ITensor::SharedPtr(rawPtr,
+        [this, inner = std::move(buffer)](runtime::ITensor*) mutable { recycleDynamicBuffer(std::move(inner)); });
+}
+
+void CacheTransBufferManager::recycleDynamicBuffer(runtime::ITensor::SharedPtr buffer)
+{
+    std::scoped_lock lk(mDynamicPoolMutex);
+    if (mDynamicBufferPool.size() >= mDynamicPoolCapacity)
+    {
+        // Pool is full; let the allocation go back to the allocator.
+        return;
+    }
+    mDynamicBufferPool.emplace(buffer->getSize(), std::move(buffer));
+}
+
 void CacheTransBufferManager::allocateBuffer()
 {
     if (mOnlyUseDynamicBuffer)
@@ -24,6 +24,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <map>
 #include <optional>
 #include <unordered_map>
 #include <vector>
@@ -95,6 +96,12 @@ private:
         int targetNum, std::vector<size_t> const& targetBufferEleSizes,
         runtime::BufferManager const& bufferManagerToUse, ConcurrenceResource& concurrenceResource);
 
+    // Hands out a dynamic overflow buffer, preferring a recycled allocation of the same size so
+    // steady-state traffic reuses addresses the transport has already registered. The returned
+    // tensor recycles itself into mDynamicBufferPool when the caller drops it.
+    runtime::ITensor::SharedPtr acquireDynamicBuffer(size_t eleSize, runtime::BufferManager const& bufferManagerToUse);
+    void recycleDynamicBuffer(runtime::ITensor::SharedPtr buffer);
+
     void allocateBuffer();
     std::optional<int> assignBufferIndex(ConcurrenceResource& resource, size_t bufferCount, bool onlyUseDynamicBuffer);
     void freeBufferIndex(
@@ -113,6 +120,9 @@ private:
     KVCacheManager::BaseKVCacheManager* mCacheManager;
     runtime::BufferManager mBufferManager;
     std::vector<std::unique_ptr<FabricMemory>> mFabricMemory;
+    std::mutex mDynamicPoolMutex;
+    std::multimap<size_t, runtime::ITensor::SharedPtr> mDynamicBufferPool;
+    size_t mDynamicPoolCapacity;
 };
 
 } // namespace tensorrt_llm::batch_manager::kv_cache_manager
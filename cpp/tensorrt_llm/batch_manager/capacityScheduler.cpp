@@ -19,9 +19,12 @@
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/batch_manager/peftCacheManager.h"
 #include "tensorrt_llm/batch_manager/scheduledBlocksManager.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 
+#include <algorithm>
+
 namespace tensorrt_llm::batch_manager
 {
 using kv_cache_manager::VecUniqueTokens;
@@ -32,16 +35,19 @@ namespace
 {
 
 std::tuple<std::unordered_set<BlockKey, BlockKeyHasher>, std::unordered_set<BlockKey, BlockKeyHasher>>
-prefillWithChunkedContextsAlreadyExecuting(RequestList const& activeRequests,
+prefillWithChunkedContextsAlreadyExecuting(RequestSnapshot const& snapshot,
     kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager = std::nullopt)
 {
     std::unordered_set<BlockKey, BlockKeyHasher> newlyContributedContextBlocks;
     std::unordered_set<BlockKey, BlockKeyHasher> newlyContributedCrossContextBlocks;
-    for (auto const& req : activeRequests)
+    for (std::size_t idx = 0; idx < snapshot.size(); ++idx)
     {
-        if (req->isContextInitState() && !req->isFirstContextChunk())
+        auto const reqFlags = snapshot.flags[idx];
+        if ((reqFlags & RequestSnapshot::kCONTEXT_INIT_FLAG)
+            && !(reqFlags & RequestSnapshot::kFIRST_CONTEXT_CHUNK_FLAG))
         {
+            auto const& req = *snapshot.requests[idx];
             // Chunked context request already executing, but haven't completed all chunks yet.
             // Skipping is not an option, register it's contributed blocks
             if (kvCacheManager.isEnableBlockReuse())
@@ -121,8 +127,73 @@ bool beneficialToSkip(std::shared_ptr<tensorrt_llm::batch_manager::LlmRequest> c
     }
     return false;
 }
+
+//! \brief Order requests earliest-deadline-first.
+//! \details A request's deadline is its start time plus a slack of deadlineWindowMs * (1 - priority), so
+//! high-priority (interactive) requests are admitted ahead of batch traffic that arrived earlier. Batch
+//! requests sink to the back of the list, which is where MaxUtilizationScheduler picks pause victims.
+RequestList sortRequestsByDeadline(RequestList const& activeRequests, float deadlineWindowMs)
+{
+    using Deadline = std::chrono::steady_clock::time_point;
+    std::vector<std::pair<Deadline, std::shared_ptr<LlmRequest>>> requestsWithDeadline;
+    requestsWithDeadline.reserve(activeRequests.size());
+    for (auto const& req : activeRequests)
+    {
+        auto const slackMs = std::chrono::duration<float, std::milli>(deadlineWindowMs * (1.F - req->priority()));
+        auto const deadline
+            = req->getStartTime() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(slackMs);
+        requestsWithDeadline.emplace_back(deadline, req);
+    }
+    // Stable sort preserves arrival order for requests with identical deadlines.
+    std::stable_sort(requestsWithDeadline.begin(), requestsWithDeadline.end(),
+        [](auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+
+    RequestList orderedRequests;
+    for (auto& [deadline, req] : requestsWithDeadline)
+    {
+        orderedRequests.emplace_back(std::move(req));
+    }
+    return orderedRequests;
+}
 } // namespace
 
+RequestSnapshot RequestSnapshot::gather(RequestList const& activeRequests)
+{
+    RequestSnapshot snapshot;
+    auto const numRequests = activeRequests.size();
+    snapshot.requests.reserve(numRequests);
+    snapshot.states.reserve(numRequests);
+    snapshot.flags.reserve(numRequests);
+    for (auto const& req : activeRequests)
+    {
+        uint8_t reqFlags{0};
+        if (req->isEncoderInitState())
+        {
+            reqFlags |= kENCODER_INIT_FLAG;
+        }
+        if (req->isContextInitState())
+        {
+            reqFlags |= kCONTEXT_INIT_FLAG;
+            if (req->isFirstContextChunk())
+            {
+                reqFlags |= kFIRST_CONTEXT_CHUNK_FLAG;
+            }
+        }
+        if (req->isGenerationInProgressState())
+        {
+            reqFlags |= kGENERATION_IN_PROGRESS_FLAG;
+        }
+        if (req->isDisaggGenerationInitState())
+        {
+            reqFlags |= kDISAGG_GENERATION_INIT_FLAG;
+        }
+        snapshot.requests.push_back(&req);
+        snapshot.states.push_back(req->getState());
+        snapshot.flags.push_back(reqFlags);
+    }
+    return snapshot;
+}
+
 MaxRequestsScheduler::MaxRequestsScheduler(
     SizeType32 maxNumRequests, LlmRequestState noScheduleUntilState, LlmRequestState noScheduleAfterState)
     : BaseCapacityScheduler(noScheduleUntilState, noScheduleAfterState)
@@ -151,13 +222,15 @@ StaticBatchScheduler::StaticBatchScheduler(
 {
 }
 
-std::tuple<RequestVector, RequestVector> MaxRequestsScheduler::operator()(RequestList const& activeRequests) const
+std::tuple<RequestVector, RequestVector> MaxRequestsScheduler::operator()(RequestSnapshot const& snapshot) const
 {
+    constexpr uint8_t schedulableFlags = RequestSnapshot::kENCODER_INIT_FLAG | RequestSnapshot::kCONTEXT_INIT_FLAG
+        | RequestSnapshot::kGENERATION_IN_PROGRESS_FLAG;
     RequestVector scheduledRequests;
-    for (auto const& req : activeRequests)
+    for (std::size_t idx = 0; idx < snapshot.size(); ++idx)
     {
         // if request cannot be scheduled yet or request should no longer be scheduled, skip
-        if (!req->hasReachedState(getNoScheduleUntilState()) || req->hasReachedState(getNoScheduleAfterState()))
+        if (!snapshot.isSchedulable(idx, getNoScheduleUntilState(), getNoScheduleAfterState()))
         {
             continue;
         }
@@ -167,9 +240,9 @@ std::tuple<RequestVector, RequestVector> MaxRequestsScheduler::operator()(Reques
             break;
         }
 
-        if (req->isEncoderInitState() || req->isContextInitState() || req->isGenerationInProgressState())
+        if (snapshot.flags[idx] & schedulableFlags)
         {
-            scheduledRequests.emplace_back(req);
+            scheduledRequests.emplace_back(*snapshot.requests[idx]);
         }
     }
     return {std::move(scheduledRequests), RequestVector{}};
@@ -178,24 +251,24 @@ std::tuple<RequestVector, RequestVector> MaxRequestsScheduler::operator()(Reques
 std::tuple<RequestVector, RequestVector> StaticBatchScheduler::operator()(
     kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const
+    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const
 {
-    return this->impl<true>(kvCacheManager, crossKvCacheManager, peftCacheManager, activeRequests);
+    return this->impl<true>(kvCacheManager, crossKvCacheManager, peftCacheManager, snapshot);
 }
 
 std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::operator()(
     kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const
+    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const
 {
-    return impl<false>(kvCacheManager, crossKvCacheManager, peftCacheManager, activeRequests);
+    return impl<false>(kvCacheManager, crossKvCacheManager, peftCacheManager, snapshot);
 }
 
 template <bool StaticBatchScheduling>
 std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
     kv_cache_manager::BaseKVCacheManager const& kvCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager,
-    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestList const& activeRequests) const
+    OptionalRef<BasePeftCacheManager const> peftCacheManager, RequestSnapshot const& snapshot) const
 {
     RequestVector scheduledRequests;
 
@@ -215,7 +288,7 @@ std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
         if (skippingIsRelevant)
         {
             std::tie(newlyContributedContextBlocks, newlyContributedCrossContextBlocks)
-                = prefillWithChunkedContextsAlreadyExecuting(activeRequests, kvCacheManager, crossKvCacheManager);
+                = prefillWithChunkedContextsAlreadyExecuting(snapshot, kvCacheManager, crossKvCacheManager);
         }
     }
 
@@ -230,24 +303,26 @@ std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
     std::unordered_set<uint64_t> uniqTaskIds{};
     RequestVector pendingRequests;
     RequestVector pendingDisGenInitRequests;
-    pendingRequests.reserve(activeRequests.size());
-    pendingDisGenInitRequests.reserve(activeRequests.size());
-    for (auto const& req : activeRequests)
+    pendingRequests.reserve(snapshot.size());
+    pendingDisGenInitRequests.reserve(snapshot.size());
+    for (std::size_t idx = 0; idx < snapshot.size(); ++idx)
     {
+        auto const reqFlags = snapshot.flags[idx];
         // if request cannot be scheduled yet or request should no longer be scheduled, skip
         if (
             // Allow disagg_generation_init requests to be scheduled, so that we'll allocate their KV cache
-            !req->isDisaggGenerationInitState()
-            && (!req->hasReachedState(getNoScheduleUntilState()) || req->hasReachedState(getNoScheduleAfterState())))
+            !(reqFlags & RequestSnapshot::kDISAGG_GENERATION_INIT_FLAG)
+            && !snapshot.isSchedulable(idx, getNoScheduleUntilState(), getNoScheduleAfterState()))
         {
             continue;
         }
 
+        auto const& req = *snapshot.requests[idx];
         if (scheduledRequests.size() >= static_cast<std::size_t>(mMaxNumRequests))
         {
             break;
         }
-        else if (req->isGenerationInProgressState())
+        else if (reqFlags & RequestSnapshot::kGENERATION_IN_PROGRESS_FLAG)
         {
             scheduledRequests.emplace_back(req);
             reservedBlocks.decrementReservedBlocks(*req);
@@ -261,7 +336,7 @@ std::tuple<RequestVector, RequestVector> GuaranteedNoEvictScheduler::impl(
                 uniqTaskIds.insert(req->getLoraTaskId().value());
             }
         }
-        else if (req->isDisaggGenerationInitState())
+        else if (reqFlags & RequestSnapshot::kDISAGG_GENERATION_INIT_FLAG)
         {
             pendingDisGenInitRequests.emplace_back(req);
         }
@@ -338,7 +413,7 @@ bool trySchedulingRequestMaxUtilization(std::shared_ptr<LlmRequest> const& req,
 
 std::tuple<RequestVector, RequestVector> MaxUtilizationScheduler::operator()(
     kv_cache_manager::BaseKVCacheManager& kvCacheManager, OptionalRef<BasePeftCacheManager const> peftCacheManager,
-    RequestList const& activeRequests) const
+    RequestSnapshot const& snapshot) const
 {
     kvCacheManager.startScheduling();
 
@@ -353,40 +428,43 @@ std::tuple<RequestVector, RequestVector> MaxUtilizationScheduler::operator()(
 
     // Keep track of blocks contributed by requests in context phase
     auto [newlyContributedContextBlocks, newlyContributedCrossContextBlocks]
-        = prefillWithChunkedContextsAlreadyExecuting(activeRequests, kvCacheManager);
+        = prefillWithChunkedContextsAlreadyExecuting(snapshot, kvCacheManager);
 
-    // Find last active in case we need to evict
-    auto startedReqLambda = [this](std::shared_ptr<LlmRequest> const& req)
+    // Find last active in case we need to evict; reads only the contiguous snapshot arrays, so the
+    // repeated backward searches do not chase pointers into the request objects.
+    auto startedReqLambda = [this, &snapshot](std::size_t idx)
     {
-        return (req->hasReachedState(getNoScheduleUntilState()) && !req->hasReachedState(getNoScheduleAfterState())
-            && ((req->isContextInitState() && !req->isFirstContextChunk()) || req->isGenerationInProgressState()));
+        auto const reqFlags = snapshot.flags[idx];
+        return snapshot.isSchedulable(idx, getNoScheduleUntilState(), getNoScheduleAfterState())
+            && (((reqFlags & RequestSnapshot::kCONTEXT_INIT_FLAG)
+                    && !(reqFlags & RequestSnapshot::kFIRST_CONTEXT_CHUNK_FLAG))
+                || (reqFlags & RequestSnapshot::kGENERATION_IN_PROGRESS_FLAG));
     };
 
     RequestVector scheduledRequests;
     RequestVector pausedRequests;
-    auto reqItEnd = std::end(activeRequests);
-    for (auto reqIt = std::begin(activeRequests); reqIt != reqItEnd;)
+    auto idxEnd = snapshot.size();
+    for (std::size_t idx = 0; idx < idxEnd;)
     {
-        auto const& req = *reqIt;
-        TLLM_LOG_DEBUG("MaxUtilizationScheduler: scheduling request ID %lu", req->mRequestId);
-
         // if request cannot be scheduled yet or request should no longer be scheduled, skip
         if (
             // Allow disagg_generation_init requests to be scheduled, so that we'll allocate their KV cache
-            !req->isDisaggGenerationInitState()
-            && (!req->hasReachedState(getNoScheduleUntilState()) || req->hasReachedState(getNoScheduleAfterState())))
+            !(snapshot.flags[idx] & RequestSnapshot::kDISAGG_GENERATION_INIT_FLAG)
+            && !snapshot.isSchedulable(idx, getNoScheduleUntilState(), getNoScheduleAfterState()))
         {
-            TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu cannot / should not be scheduled", req->mRequestId);
-            reqIt++;
+            idx++;
             continue;
         }
 
+        auto const& req = *snapshot.requests[idx];
+        TLLM_LOG_DEBUG("MaxUtilizationScheduler: scheduling request ID %lu", req->mRequestId);
+
         // if context request can reuse blocks contributed by another context request, skip
         if (skippingIsRelevant
             && beneficialToSkip(
                 req, kvCacheManager, std::nullopt, newlyContributedContextBlocks, newlyContributedCrossContextBlocks))
         {
-            reqIt++;
+            idx++;
             continue;
         }
 
@@ -395,22 +473,30 @@ std::tuple<RequestVector, RequestVector> MaxUtilizationScheduler::operator()(
         if (wasScheduled)
         {
             TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu -> start", req->mRequestId);
-            reqIt++;
+            idx++;
         }
         else
         {
-            auto const rbegin = std::reverse_iterator(reqItEnd);
-            auto const rend = std::reverse_iterator(reqIt);
-            auto const lastStartedReqIt = std::find_if(rbegin, rend, startedReqLambda);
-            if (lastStartedReqIt != rend)
+            // Search backwards for the last started request, including the current one.
+            std::optional<std::size_t> lastStartedIdx;
+            for (auto victimIdx = idxEnd; victimIdx-- > idx;)
+            {
+                if (startedReqLambda(victimIdx))
+                {
+                    lastStartedIdx = victimIdx;
+                    break;
+                }
+            }
+            if (lastStartedIdx.has_value())
             {
                 // If we can't allocate a started request, we need to start freeing started requests
                 // from the end of the vector and try again
                 // Here we simulate freeing the kvCache blocks associated with that sequence
-                kvCacheManager.schedulingRemoveSequence((*lastStartedReqIt)->mRequestId);
-                pausedRequests.emplace_back(*lastStartedReqIt);
-                TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu -> pause", (*lastStartedReqIt)->mRequestId);
-                reqItEnd = std::next(lastStartedReqIt).base();
+                auto const& pausedReq = *snapshot.requests[lastStartedIdx.value()];
+                kvCacheManager.schedulingRemoveSequence(pausedReq->mRequestId);
+                pausedRequests.emplace_back(pausedReq);
+                TLLM_LOG_DEBUG("MaxUtilizationScheduler: request ID %lu -> pause", pausedReq->mRequestId);
+                idxEnd = lastStartedIdx.value();
             }
             else
             {
@@ -458,7 +544,9 @@ bool trySchedulingRequestMaxUtilization(std::shared_ptr<LlmRequest> const& req,
 
 CapacityScheduler::CapacityScheduler(SizeType32 maxNumRequests,
     executor::CapacitySchedulerPolicy capacitySchedulerPolicy, bool hasKvCacheManager, bool twoStepsLookAhead,
-    LlmRequestState noScheduleUntilState, LlmRequestState noScheduleAfterState)
+    std::optional<float> contextTokensPerSecond, LlmRequestState noScheduleUntilState,
+    LlmRequestState noScheduleAfterState)
+    : mContextTokensPerSecond(contextTokensPerSecond)
 {
     if (!hasKvCacheManager)
     {
@@ -483,32 +571,88 @@ CapacityScheduler::CapacityScheduler(SizeType32 maxNumRequests,
     }
 }
 
+RequestVector CapacityScheduler::paceContextAdmission(RequestVector fittingRequests) const
+{
+    if (!mContextTokensPerSecond.has_value())
+    {
+        return fittingRequests;
+    }
+    auto const rate = static_cast<double>(mContextTokensPerSecond.value());
+    auto const now = std::chrono::steady_clock::now();
+    if (mLastAdmissionRefill.has_value())
+    {
+        auto const elapsedSec = std::chrono::duration<double>(now - mLastAdmissionRefill.value()).count();
+        // Cap the accumulated budget at one second of rate so an idle period cannot build up
+        // an unbounded burst allowance.
+        mContextTokenBucket = std::min(mContextTokenBucket + elapsedSec * rate, rate);
+    }
+    mLastAdmissionRefill = now;
+
+    RequestVector pacedRequests;
+    pacedRequests.reserve(fittingRequests.size());
+    SizeType32 numDeferred{0};
+    for (auto const& llmReq : fittingRequests)
+    {
+        // Only requests whose prefill has not started yet are paced; requests mid-chunking or in
+        // generation already hold resources and deferring them would waste work.
+        if (llmReq->isContextInitState() && llmReq->isFirstContextChunk())
+        {
+            if (mContextTokenBucket < 0.)
+            {
+                ++numDeferred;
+                continue;
+            }
+            // Charge the full prompt and let the bucket go negative, so a prompt longer than one
+            // second of budget is still admitted once the balance recovers.
+            mContextTokenBucket -= static_cast<double>(llmReq->getContextRemainingLength());
+        }
+        pacedRequests.push_back(llmReq);
+    }
+    if (numDeferred > 0)
+    {
+        TLLM_LOG_DEBUG(
+            "CapacityScheduler: context admission pacing deferred %d request(s) to later iterations", numDeferred);
+    }
+    return pacedRequests;
+}
+
 std::tuple<RequestVector, RequestVector, RequestVector> CapacityScheduler::operator()(RequestList const& activeRequests,
     OptionalRef<kv_cache_manager::BaseKVCacheManager> kvCacheManager,
     OptionalRef<BasePeftCacheManager const> peftCacheManager,
     OptionalRef<kv_cache_manager::BaseKVCacheManager const> crossKvCacheManager) const
 {
     NVTX3_SCOPED_RANGE(capacitySchedulerScheduling);
-    return std::visit(
-        [&activeRequests, &kvCacheManager, &crossKvCacheManager, &peftCacheManager](
+    // When an SLO deadline window is configured, present the requests to the policy in
+    // earliest-deadline-first order instead of arrival order.
+    auto const deadlineWindowMs = common::getEnvSloDeadlineWindowMs();
+    RequestList edfRequests;
+    if (deadlineWindowMs > 0.F)
+    {
+        edfRequests = sortRequestsByDeadline(activeRequests, deadlineWindowMs);
+    }
+    auto const& orderedRequests = deadlineWindowMs > 0.F ? edfRequests : activeRequests;
+    // One contiguous gather of the scheduling-relevant fields; the policies below scan it instead of
+    // repeatedly dereferencing the scattered request objects.
+    auto const snapshot = RequestSnapshot::gather(orderedRequests);
+    auto [fittingRequests, fittingDisaggGenInitRequests, pausedRequests] = std::visit(
+        [&snapshot, &kvCacheManager, &crossKvCacheManager, &peftCacheManager](
             auto const& scheduler) -> std::tuple<RequestVector, RequestVector, RequestVector>
         {
             RequestVector tmpFittingRequests;
             RequestVector pausedRequests;
             if constexpr (std::is_same_v<std::decay_t<decltype(scheduler)>, MaxRequestsScheduler>)
             {
-                std::tie(tmpFittingRequests, pausedRequests) = scheduler(activeRequests);
+                std::tie(tmpFittingRequests, pausedRequests) = scheduler(snapshot);
             }
             else if constexpr (std::is_same_v<std::decay_t<decltype(scheduler)>, MaxUtilizationScheduler>)
             {
-                std::tie(tmpFittingRequests, pausedRequests)
-                    = scheduler(*kvCacheManager, peftCacheManager, activeRequests);
+                std::tie(tmpFittingRequests, pausedRequests) = scheduler(*kvCacheManager, peftCacheManager, snapshot);
             }
             else if constexpr (std::is_same_v<std::decay_t<decltype(scheduler)>, GuaranteedNoEvictScheduler>
                 || std::is_same_v<std::decay_t<decltype(scheduler)>, StaticBatchScheduler>)
             {
                 std::tie(tmpFittingRequests, pausedRequests)
-                    = scheduler(*kvCacheManager, crossKvCacheManager, peftCacheManager, activeRequests);
+                    = scheduler(*kvCacheManager, crossKvCacheManager, peftCacheManager, snapshot);
             }
             else
             {
@@ -534,6 +678,9 @@ std::tuple<RequestVector, RequestVector, RequestVector> CapacityScheduler::opera
             return {std::move(fittingRequests), std::move(fittingDisaggGenInitRequests), std::move(pausedRequests)};
         },
         mScheduler);
+    // Deferred requests stay active and are offered to the policy again next iteration.
+    fittingRequests = paceContextAdmission(std::move(fittingRequests));
+    return {std::move(fittingRequests), std::move(fittingDisaggGenInitRequests), std::move(pausedRequests)};
 }
 
 } // namespace tensorrt_llm::batch_manager
@@ -38,19 +38,21 @@ void ContextProgress::recordEvent(int layerIdx, cudaStream_t stream)
     TLLM_CHECK_WITH_INFO(layerIdx == 0 || mCudaEventsRecorded[layerIdx - 1], "Layer %d is skipped", layerIdx - 1);
     TLLM_CHECK_WITH_INFO(!mCudaEventsRecorded[layerIdx], "Layer %d is recorded twice", layerIdx);
     TLLM_CUDA_CHECK(cudaEventRecord(mCudaEvents[layerIdx].get(), stream));
-    mCudaEventsRecorded[layerIdx] = true;
+    {
+        std::lock_guard lock(mMutex);
+        mCudaEventsRecorded[layerIdx] = true;
+    }
     mConditionVariable.notify_all();
 }
 
 void ContextProgress::wait(int layerIdx)
 {
     TLLM_CHECK(layerIdx < getNumLayers());
-    while (!mCudaEventsRecorded[layerIdx])
-    {
-        std::unique_lock lock(mMutex);
-        auto const timeout = std::chrono::milliseconds(10);
-        mConditionVariable.wait_for(lock, timeout);
-    }
+    // The flag is set under the mutex, so a predicate wait cannot miss the wakeup; polling with a
+    // timeout here used to add up to 10 ms of latency to every layer handoff when streaming.
+    std::unique_lock lock(mMutex);
+    mConditionVariable.wait(lock, [this, layerIdx] { return mCudaEventsRecorded[layerIdx].load(); });
+    lock.unlock();
     mCudaEvents[layerIdx].synchronize();
 }
 
@@ -35,6 +35,9 @@
 
 #include <NvInferRuntimeBase.h>
 
+#include <algorithm>
+#include <cstdint>
+
 using namespace tensorrt_llm::runtime;
 
 namespace tc = tensorrt_llm::common;
@@ -93,7 +96,8 @@ void copySequenceLengths(RequestVector const& contextRequests, DecoderInputBuffe
 
 /// @brief Retrieve the embedding bias from the request. This potentially makes a copy of the tensor
 /// to the appropriate type if the input tensor does not match it.
-[[nodiscard]] TensorPtr getEmbeddingBias(nvinfer1::DataType logitsType, TensorPtr const& tensor)
+[[nodiscard]] TensorPtr getEmbeddingBias(
+    nvinfer1::DataType logitsType, TensorPtr const& tensor, TensorPtr const& staging, SizeType32& stagingRowIdx)
 {
     // Check that embedding bias type is same as logits type. If so, we can return the tensor right away
     if (tensor->getDataType() == logitsType)
@@ -104,7 +108,7 @@ void copySequenceLengths(RequestVector const& contextRequests, DecoderInputBuffe
     // Support FP32 input for FP16 embedding bias (in the case of FP8 models)
     if (tensor->getDataType() == nvinfer1::DataType::kFLOAT && logitsType == nvinfer1::DataType::kHALF)
     {
-        // Do a deep copy of the tensor to the expected type
+        // Cast the tensor to the expected type into the preallocated pinned staging area
         TLLM_LOG_WARNING(
             "Embedding bias data type must be same as model logits type, will copy the tensor from float to half");
 
@@ -114,7 +118,8 @@ void copySequenceLengths(RequestVector const& contextRequests, DecoderInputBuffe
         auto const shape = tensor->getShape();
         TLLM_CHECK(shape.nbDims == 2); // [1, vocabSizePadded]
         TLLM_CHECK(shape.d[0] == 1);
-        auto newTensor = tensorrt_llm::runtime::BufferManager::pinnedPool(shape, logitsType);
+        TLLM_CHECK(shape.d[1] == staging->getShape().d[1]);
+        TensorPtr newTensor = ITensor::slice(staging, stagingRowIdx++, 1);
 
         auto const tensorRange = BufferRange<float>(*tensor);
         auto newTensorRange = BufferRange<half>(*newTensor);
@@ -152,8 +157,8 @@ CreateNewDecoderRequests::operator()(runtime::ModelConfig const& modelConfig, ru
     }
 
     auto [lookaheadPrompt, lookaheadAlgoConfigs]
-        = createDecoderRequests(finishedContextRequests, inputBuffers.inputsIds, decodingConfig, decoderState,
-            logitsType, modelConfig, worldConfig, runtimeStream, decoderStream, maxSequenceLength, medusaBuffers);
+        = createDecoderRequests(finishedContextRequests, inputBuffers, decodingConfig, decoderState, logitsType,
+            modelConfig, worldConfig, runtimeStream, decoderStream, maxSequenceLength, medusaBuffers);
 
     auto const batchSize = finishedContextRequests.size();
 
@@ -235,13 +240,13 @@ void initializeBeamSearch(DecodingInput& dJointInput, DecodingOutput& dJointOutp
 }
 
 void initializeEmbeddingBias(DecodingInput& dJointInput, SizeType32 batchSlot,
-    std::optional<TensorPtr> const& embeddingBias, nvinfer1::DataType logitsType,
-    runtime::ModelConfig const& modelConfig, BufferManager const& manager)
+    std::optional<TensorPtr> const& embeddingBias, nvinfer1::DataType logitsType, TensorPtr const& biasStaging,
+    SizeType32& biasStagingRowIdx, runtime::ModelConfig const& modelConfig, BufferManager const& manager)
 {
     TensorPtr const embeddingBiasSlice = ITensor::slice(constPointerCast(dJointInput.embeddingBias), batchSlot, 1);
     if (embeddingBias.has_value())
     {
-        auto embeddingBiasTensor = getEmbeddingBias(logitsType, embeddingBias.value());
+        auto embeddingBiasTensor = getEmbeddingBias(logitsType, embeddingBias.value(), biasStaging, biasStagingRowIdx);
 
         TLLM_CHECK(embeddingBiasTensor->getShape().nbDims == 2);
         TLLM_CHECK(embeddingBiasTensor->getShape().d[0] == 1);
@@ -258,13 +263,23 @@ void initializeEmbeddingBias(DecodingInput& dJointInput, SizeType32 batchSlot,
 
 void setupWords(std::vector<runtime::ITensor::SharedPtr>& jointWordsLists,
     std::optional<TensorPtr> const& requestWordsList, SharedConstPtr& jointWordsPtrs, SharedConstPtr& jointWordsLens,
-    SizeType32& jointMaxWordsLen, SizeType32 batchSlot, BufferManager const& manager)
+    SizeType32& jointMaxWordsLen, SizeType32 batchSlot, TensorPtr const& wordsStaging, SizeType32& wordsStagingOffset,
+    CreateNewDecoderRequests::WordsListCache& wordsCache, BufferManager const& manager)
 {
     if (requestWordsList.has_value())
     {
-        // Move to GPU and remove leading bs1 dimension since this is what decoderRequest expects
-        TensorPtr wordsList = manager.copyFrom(*requestWordsList.value(), MemoryType::kGPU);
-        wordsList->squeeze(0);
+        auto const wordsShape = requestWordsList.value()->getShape();
+        auto const wordsVolume = static_cast<SizeType32>(ITensor::volume(wordsShape));
+
+        // Stage through preallocated pinned memory so any copy to device below is asynchronous
+        TensorPtr wordsHost = ITensor::slice(wordsStaging, wordsStagingOffset, wordsVolume);
+        wordsStagingOffset += wordsVolume;
+        manager.copy(runtime::bufferCast<TokenIdType>(*requestWordsList.value()), *wordsHost);
+
+        // Reuse the device copy of an identical list uploaded for an earlier request, or upload this
+        // one. The returned tensor has the leading bs1 dimension removed since this is what
+        // decoderRequest expects.
+        TensorPtr wordsList = wordsCache.getOrUpload(*wordsHost, wordsShape, manager);
 
         auto const wordsLen = wordsList->getShape().d[1];
         BufferRange<int32_t*>(*constPointerCast(jointWordsPtrs))[batchSlot]
@@ -628,23 +643,103 @@ void newRequestSpeculativeDecoding(DecodingInput& jointDecodingInput, DecodingOu
 
 } // namespace
 
+TensorPtr CreateNewDecoderRequests::WordsListCache::getOrUpload(
+    runtime::ITensor const& wordsHost, nvinfer1::Dims const& wordsShape, BufferManager const& manager)
+{
+    auto const uploadWordsList = [&wordsHost, &wordsShape, &manager]()
+    {
+        TensorPtr wordsList = manager.gpu(wordsShape, TRTDataType<TokenIdType>::value);
+        manager.copy(wordsHost, *wordsList);
+        wordsList->squeeze(0);
+        return wordsList;
+    };
+
+    auto const wordsVolume = static_cast<SizeType32>(ITensor::volume(wordsShape));
+    if (wordsVolume > kMaxCachedVolume)
+    {
+        return uploadWordsList();
+    }
+
+    auto const* const tokens = runtime::bufferCast<TokenIdType>(wordsHost);
+    // FNV-1a over the token data; collisions are resolved by comparing against the retained host copy.
+    std::size_t hash{0xcbf29ce484222325ull};
+    for (SizeType32 i = 0; i < wordsVolume; ++i)
+    {
+        hash = (hash ^ static_cast<std::size_t>(static_cast<std::uint32_t>(tokens[i]))) * 0x100000001b3ull;
+    }
+
+    if (mNumEntries >= kMaxEntries)
+    {
+        TLLM_LOG_DEBUG("WordsListCache holds %zu distinct lists, resetting", mNumEntries);
+        mEntries.clear();
+        mNumEntries = 0;
+    }
+
+    auto& chain = mEntries[hash];
+    for (auto const& entry : chain)
+    {
+        if (entry.tokens.size() == static_cast<std::size_t>(wordsVolume)
+            && std::equal(entry.tokens.begin(), entry.tokens.end(), tokens))
+        {
+            return entry.wordsList;
+        }
+    }
+
+    TensorPtr wordsList = uploadWordsList();
+    chain.push_back(Entry{std::vector<TokenIdType>(tokens, tokens + wordsVolume), wordsList});
+    ++mNumEntries;
+    return wordsList;
+}
+
 std::tuple<std::vector<runtime::ITensor::SharedConstPtr>, std::vector<executor::LookaheadDecodingConfig>>
-CreateNewDecoderRequests::createDecoderRequests(RequestVector const& finishedContextRequests, TensorPtr const& inputIds,
-    executor::DecodingConfig const& decodingConfig, runtime::decoder::DecoderState& decoderState,
-    nvinfer1::DataType logitsType, runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig,
+CreateNewDecoderRequests::createDecoderRequests(RequestVector const& finishedContextRequests,
+    DecoderInputBuffers& inputBuffers, executor::DecodingConfig const& decodingConfig,
+    runtime::decoder::DecoderState& decoderState, nvinfer1::DataType logitsType,
+    runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig,
     runtime::CudaStream const& runtimeStream, runtime::CudaStream const& decoderStream, SizeType32 maxSequenceLength,
     OptionalRef<MedusaBuffers const> medusaBuffers) const
 {
     auto const decoderBufferManager = BufferManager{std::make_shared<CudaStream>(decoderStream.get())};
 
     unsigned decoderInputSize{0};
+    SizeType32 numEmbeddingBiasCasts{0};
+    SizeType32 wordsStagingSize{0};
     for (auto const& llmReq : finishedContextRequests)
     {
         auto const& reqTokens = llmReq->getTokens(0);
         decoderInputSize += reqTokens.size();
+
+        auto const& embeddingBias = llmReq->getEmbeddingBias();
+        if (embeddingBias.has_value() && embeddingBias.value()->getDataType() != logitsType)
+        {
+            ++numEmbeddingBiasCasts;
+        }
+        auto const& badWordsList = llmReq->getBadWordsList();
+        if (badWordsList.has_value())
+        {
+            wordsStagingSize += static_cast<SizeType32>(ITensor::volume(badWordsList.value()->getShape()));
+        }
+        auto const& stopWordsList = llmReq->getStopWordsList();
+        if (stopWordsList.has_value())
+        {
+            wordsStagingSize += static_cast<SizeType32>(ITensor::volume(stopWordsList.value()->getShape()));
+        }
     }
+    auto const& inputIds = inputBuffers.inputsIds;
     inputIds->resize(decoderInputSize);
 
+    // Grow the pinned staging areas once per batch of new requests, so that the setup functions below only
+    // perform in-place writes and asynchronous copies instead of per-request allocations.
+    if (numEmbeddingBiasCasts > 0)
+    {
+        inputBuffers.embeddingBiasStaging->reshape(
+            ITensor::makeShape({numEmbeddingBiasCasts, modelConfig.getVocabSize()}));
+    }
+    if (wordsStagingSize > 0)
+    {
+        inputBuffers.wordsStaging->resize(wordsStagingSize);
+    }
+
     std::vector<runtime::ITensor::SharedConstPtr> lookaheadPrompt;
     std::vector<executor::LookaheadDecodingConfig> lookaheadAlgoConfigs;
     if (modelConfig.getSpeculativeDecodingMode().isLookaheadDecoding())
@@ -656,6 +751,8 @@ CreateNewDecoderRequests::createDecoderRequests(RequestVector const& finishedCon
     }
 
     SizeType32 inputOffset{0};
+    SizeType32 embeddingBiasStagingRowIdx{0};
+    SizeType32 wordsStagingOffset{0};
     for (auto const& llmReq : finishedContextRequests)
     {
         llmReq->mSamplingConfig.normalizeLogProbs = mIsNormalizeLogProbs;
@@ -692,14 +789,16 @@ CreateNewDecoderRequests::createDecoderRequests(RequestVector const& finishedCon
             maxSequenceLength, decoderBufferManager);
         decoderState.setNumDecodingEngineTokens(batchSlot, numDecodingEngineTokens);
 
-        initializeEmbeddingBias(
-            dJointInput, batchSlot, llmReq->getEmbeddingBias(), logitsType, modelConfig, decoderBufferManager);
+        initializeEmbeddingBias(dJointInput, batchSlot, llmReq->getEmbeddingBias(), logitsType,
+            inputBuffers.embeddingBiasStaging, embeddingBiasStagingRowIdx, modelConfig, decoderBufferManager);
 
         setupWords(dJointInput.badWordsLists, llmReq->getBadWordsList(), dJointInput.badWordsPtrs,
-            dJointInput.badWordsLens, dJointInput.maxBadWordsLen, batchSlot, decoderBufferManager);
+            dJointInput.badWordsLens, dJointInput.maxBadWordsLen, batchSlot, inputBuffers.wordsStaging,
+            wordsStagingOffset, mWordsListCache, decoderBufferManager);
 
         setupWords(dJointInput.stopWordsLists, llmReq->getStopWordsList(), dJointInput.stopWordsPtrs,
-            dJointInput.stopWordsLens, dJointInput.maxStopWordsLen, batchSlot, decoderBufferManager);
+            dJointInput.stopWordsLens, dJointInput.maxStopWordsLen, batchSlot, inputBuffers.wordsStaging,
+            wordsStagingOffset, mWordsListCache, decoderBufferManager);
 
         auto& dJointOutput = decoderState.getJointDecodingOutput();
 
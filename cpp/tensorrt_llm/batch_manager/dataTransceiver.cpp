@@ -27,6 +27,7 @@
 #include "tensorrt_llm/common/utils.h"
 #include "tensorrt_llm/executor/cache_transmission/agent_utils/connection.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
+#include <algorithm>
 #include <future>
 #include <map>
 #include <memory>
@@ -93,6 +94,113 @@ void TransferSession::recv(size_t idx, void* data, size_t size)
     }
 }
 
+namespace
+{
+// tagFromRequestId packs the data tag into the low 20 bits; channel indices live above it, so
+// channel 0 keeps the unstriped tag and stays wire-compatible with peers that do not stripe.
+constexpr int32_t kCHANNEL_TAG_SHIFT{20};
+// Stripes below this size do not amortize the extra tag matching; the channel count is clamped so
+// every stripe stays at least this large. Both peers clamp from the same size, so they agree.
+constexpr size_t kMIN_CHANNEL_STRIPE_BYTES{4 * 1024 * 1024};
+
+size_t clampNumChannels(size_t size, size_t numChannels)
+{
+    return std::min(numChannels, std::max(size / kMIN_CHANNEL_STRIPE_BYTES, static_cast<size_t>(1)));
+}
+
+// Runs channelFun(0..numChannels-1) in waves of at most the configured channel concurrency, so a
+// striped transfer cannot occupy every NIC queue at once.
+template <typename ChannelFun>
+void runChannels(ChannelFun const& channelFun, size_t numChannels)
+{
+    auto concurrency = common::getEnvKVCacheTransferChannelConcurrency();
+    if (concurrency == 0 || concurrency > numChannels)
+    {
+        concurrency = numChannels;
+    }
+    size_t nextChannel = 0;
+    while (nextChannel < numChannels)
+    {
+        auto const waveSize = std::min(concurrency, numChannels - nextChannel);
+        std::vector<std::future<void>> futures;
+        futures.reserve(waveSize);
+        for (size_t i = 0; i < waveSize; i++)
+        {
+            futures.push_back(std::async(std::launch::async, channelFun, nextChannel + i));
+        }
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+        nextChannel += waveSize;
+    }
+}
+} // namespace
+
+void TransferSession::sendStriped(size_t idx, void const* data, size_t size, size_t numChannels)
+{
+    numChannels = clampNumChannels(size, numChannels);
+    if (numChannels <= 1)
+    {
+        send(idx, data, size);
+        return;
+    }
+    int deviceId = 0;
+    TLLM_CUDA_CHECK(cudaGetDevice(&deviceId));
+    auto const stripeSize = size / numChannels;
+    auto const remainder = size % numChannels;
+    auto sendChannelFun = [&, deviceId](size_t channelIdx)
+    {
+        TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
+        auto const offset = channelIdx * stripeSize + std::min(channelIdx, remainder);
+        auto const length = stripeSize + (channelIdx < remainder ? 1 : 0);
+        DataContext channelContext{
+            mDataContext.getTag() | static_cast<int32_t>(channelIdx << kCHANNEL_TAG_SHIFT)};
+        try
+        {
+            mConnections.at(idx)->send(channelContext, static_cast<char const*>(data) + offset, length);
+        }
+        catch (std::exception const& e)
+        {
+            throw common::RequestSpecificException(
+                __FILE__, __LINE__, e.what(), mRequest->mRequestId, common::RequestErrorCode::kNETWORK_ERROR);
+        }
+    };
+    runChannels(sendChannelFun, numChannels);
+}
+
+void TransferSession::recvStriped(size_t idx, void* data, size_t size, size_t numChannels)
+{
+    numChannels = clampNumChannels(size, numChannels);
+    if (numChannels <= 1)
+    {
+        recv(idx, data, size);
+        return;
+    }
+    int deviceId = 0;
+    TLLM_CUDA_CHECK(cudaGetDevice(&deviceId));
+    auto const stripeSize = size / numChannels;
+    auto const remainder = size % numChannels;
+    auto recvChannelFun = [&, deviceId](size_t channelIdx)
+    {
+        TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
+        auto const offset = channelIdx * stripeSize + std::min(channelIdx, remainder);
+        auto const length = stripeSize + (channelIdx < remainder ? 1 : 0);
+        DataContext channelContext{
+            mDataContext.getTag() | static_cast<int32_t>(channelIdx << kCHANNEL_TAG_SHIFT)};
+        try
+        {
+            mConnections.at(idx)->recv(channelContext, static_cast<char*>(data) + offset, length);
+        }
+        catch (std::exception const& e)
+        {
+            throw common::RequestSpecificException(
+                __FILE__, __LINE__, e.what(), mRequest->mRequestId, common::RequestErrorCode::kNETWORK_ERROR);
+        }
+    };
+    runChannels(recvChannelFun, numChannels);
+}
+
 LlmRequest const& TransferSession::getLlmRequest() const
 {
     TLLM_CHECK(mRequest != nullptr);
@@ -104,6 +212,21 @@ void TransferSession::setLlmRequest(LlmRequest const& llmRequest)
     mRequest = &llmRequest;
 }
 
+void TransferSession::markCancelled() noexcept
+{
+    mCancelled->store(true, std::memory_order_release);
+}
+
+bool TransferSession::isCancelled() const noexcept
+{
+    return mCancelled->load(std::memory_order_acquire);
+}
+
+double TransferSession::getLifetimeMs() const
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - mCreationTime).count();
+}
+
 void TransferSession::appendMeasure(double delay, double duration, size_t size)
 {
     if (!mRecordMeasure)
@@ -315,6 +438,8 @@ public:
             }
             it->second.exportMeasure(mMeasuresFile, true);
         }
+        TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(), "Transfer session for request %zu closed after %.2f ms",
+            requestId, it->second.getLifetimeMs());
         mRequestToSession.erase(it);
     }
 
@@ -392,7 +517,20 @@ public:
             mCancelledRequests.insert(llmRequest.mRequestId);
             isCancelled = true;
         }
-        else
+        else if (mCurrentRequest.has_value() && getCurrentRequestId() == llmRequest.mRequestId)
+        {
+            // The transfer is already on the wire; flag the session so the formatter stops at the
+            // next buffer boundary and frees its transfer buffer slot. The counterpart's pending
+            // recv is bounded by the transfer timeout, like any other mid-transfer failure.
+            std::unique_lock<std::mutex> lk(mMtxForMap);
+            auto sessionIt = mRequestToSession.find(llmRequest.mRequestId);
+            if (sessionIt != mRequestToSession.end())
+            {
+                sessionIt->second.markCancelled();
+                isCancelled = true;
+            }
+        }
+        if (!isCancelled)
         {
             TLLM_LOG_WARNING("Cannot cancel request %zu", llmRequest.mRequestId);
         }
@@ -539,6 +677,9 @@ private:
                     mCancelledRequests.erase(mCurrentRequest.value());
                     mRemainSendCount.erase(mCurrentRequest.value());
                 }
+                // Flush the session right away instead of leaving it to the timeout sweep, so its
+                // measures are exported and the map entry does not pile up under router retries.
+                release(reqId);
                 mCurrentRequest = std::nullopt;
 
                 if (mReadyResponses.empty())
@@ -885,11 +1026,23 @@ public:
                 asyncResource->mRequestsQueue.erase(it);
                 isCancelled = true;
             }
-            else
+        }
+        if (!isCancelled)
+        {
+            // Not queued anymore: the transfer is in flight. Flag the session so the formatter
+            // stops at the next buffer boundary and frees its transfer buffer slot.
+            std::scoped_lock<std::mutex> lock(mActiveSessionsMutex);
+            auto it = mActiveSessions.find(llmRequest.mRequestId);
+            if (it != mActiveSessions.end())
             {
-                TLLM_LOG_WARNING("Cannot cancel request %zu", llmRequest.mRequestId);
+                it->second->markCancelled();
+                isCancelled = true;
             }
         }
+        if (!isCancelled)
+        {
+            TLLM_LOG_WARNING("Cannot cancel request %zu", llmRequest.mRequestId);
+        }
         return isCancelled;
     }
 
@@ -934,6 +1087,31 @@ public:
     }
 
 private:
+    class ActiveSessionGuard
+    {
+    public:
+        ActiveSessionGuard(Impl& impl, LlmRequest::RequestIdType requestId, TransferSession* session)
+            : mImpl(impl)
+            , mRequestId(requestId)
+        {
+            std::scoped_lock<std::mutex> lock(mImpl.mActiveSessionsMutex);
+            mImpl.mActiveSessions.emplace(mRequestId, session);
+        }
+
+        ~ActiveSessionGuard()
+        {
+            std::scoped_lock<std::mutex> lock(mImpl.mActiveSessionsMutex);
+            mImpl.mActiveSessions.erase(mRequestId);
+        }
+
+        ActiveSessionGuard(ActiveSessionGuard const&) = delete;
+        ActiveSessionGuard& operator=(ActiveSessionGuard const&) = delete;
+
+    private:
+        Impl& mImpl;
+        LlmRequest::RequestIdType mRequestId;
+    };
+
     void requestSync(LlmRequest& llmRequest)
     {
         TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(),
@@ -942,6 +1120,8 @@ private:
         llmRequest.setKvCacheTransferStart(std::chrono::steady_clock::now());
         TLLM_CUDA_CHECK(cudaSetDevice(mDeviceId));
         auto session = sendRequestInfo(llmRequest);
+        // Keep the in-flight session reachable for cancelRequest while it lives on this stack.
+        ActiveSessionGuard sessionGuard{*this, llmRequest.mRequestId, &session};
         bool isReady = receiveReadySignal(session);
         if (!isReady)
         {
@@ -1074,6 +1254,9 @@ private:
     std::unique_ptr<BaseCacheFormatter> mFormatter;
     std::unordered_map<std::string, std::unique_ptr<ReceiveCacheResource>> mProcessToResources;
     std::mutex mProcessIoResouceMutex;
+    // in-flight sessions, registered by requestSync so cancelRequest can reach them
+    std::unordered_map<LlmRequest::RequestIdType, TransferSession*> mActiveSessions;
+    std::mutex mActiveSessionsMutex;
     runtime::BufferManager mBufferManager;
     std::ofstream mMeasuresFile;
     std::mutex mMeasuresFileMutex;
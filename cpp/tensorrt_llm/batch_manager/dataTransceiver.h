@@ -16,9 +16,12 @@
  */
 
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <future>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -97,6 +100,13 @@ public:
 
     void recv(size_t idx, void* data, size_t size);
 
+    // Stripe one peer transfer across several tagged channels of the same connection, so a single
+    // large buffer can use more than one NIC queue. Both sides must stripe with the same channel
+    // count; numChannels <= 1 falls back to a plain send/recv.
+    void sendStriped(size_t idx, void const* data, size_t size, size_t numChannels);
+
+    void recvStriped(size_t idx, void* data, size_t size, size_t numChannels);
+
     [[nodiscard]] LlmRequest const& getLlmRequest() const;
 
     // in CacheSender, the LlmRequest is not available until the sendSync is called
@@ -107,6 +117,16 @@ public:
     // TODO: 1. use global id instead of context request id; 2. export to llm metrics instead of file
     void exportMeasure(std::ofstream& outFile, bool isContext) const;
 
+    // Cooperative cancellation: the executor's cancel path flips the flag from another thread and
+    // the formatter polls it at buffer boundaries, so a cancelled session stops queueing new wire
+    // operations and releases its transfer buffer slot instead of running to completion.
+    void markCancelled() noexcept;
+
+    [[nodiscard]] bool isCancelled() const noexcept;
+
+    // Wall-clock age of the session since construction, in ms.
+    [[nodiscard]] double getLifetimeMs() const;
+
     [[nodiscard]] int32_t getIndexFromEnd() const
     {
         return mIndexFromEnd;
@@ -128,6 +148,9 @@ private:
     bool mRecordMeasure{false};
     int32_t mIndexFromEnd{0};
     BlockKey mLastBlockKey{};
+    // shared_ptr keeps the flag movable with the session while cancel and transfer threads race
+    std::shared_ptr<std::atomic<bool>> mCancelled{std::make_shared<std::atomic<bool>>(false)};
+    std::chrono::steady_clock::time_point mCreationTime{std::chrono::steady_clock::now()};
 };
 
 using UniqueToken = tensorrt_llm::runtime::UniqueToken;
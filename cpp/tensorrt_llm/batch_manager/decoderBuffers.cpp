@@ -38,6 +38,9 @@ DecoderInputBuffers::DecoderInputBuffers(
 
     inputsIds = BufferManager::pinnedPool(ITensor::makeShape({0}), TRTDataType<TokenIdType>::value);
 
+    embeddingBiasStaging = BufferManager::pinnedPool(ITensor::makeShape({0, 0}), nvinfer1::DataType::kHALF);
+    wordsStaging = BufferManager::pinnedPool(ITensor::makeShape({0}), TRTDataType<TokenIdType>::value);
+
     setupBatchSlots = BufferManager::pinnedPool(maxBatchSizeShape, nvSizeType);
     setupBatchSlotsDevice = manager.gpu(maxBatchSizeShape, nvSizeType);
 
@@ -17,6 +17,8 @@
 
 #include "tensorrt_llm/batch_manager/evictionPolicy.h"
 
+#include <algorithm>
+
 using namespace tensorrt_llm::batch_manager::kv_cache_manager;
 
 // This implements priority-based eviction.
@@ -66,6 +68,8 @@ void LRUEvictionPolicy::initialize(std::vector<BlockPtr>& mAllBlocksById, std::v
         {
             // Initialize all blocks to be the default priority level
             mFreeBlockIterators.emplace_back(freeQueue.insert(freeQueue.end(), mAllBlocksById[startIdx + blockId]));
+            mQueuedPriorityIdx.push_back(defaultPriorityIdx);
+            mQueuedExpiring.push_back(false);
         }
 
         startIdx += sizes[cacheLevel];
@@ -105,21 +109,34 @@ bool LRUEvictionPolicy::verifyQueueIntegrity()
 
 std::tuple<BlockPtr, bool> LRUEvictionPolicy::getFreeBlock(SizeType32 cacheLevel)
 {
-    for (SizeType32 level = 0; level < kMaxPriority - kMinPriority + 1; level++)
+    auto blocks = getFreeBlocks(cacheLevel, 1);
+    TLLM_CHECK_WITH_INFO(!blocks.empty(), "No free block found. This shouldn't happen!");
+    return blocks.front();
+}
+
+std::vector<std::tuple<BlockPtr, bool>> LRUEvictionPolicy::getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks)
+{
+    std::vector<std::tuple<BlockPtr, bool>> blocks;
+    blocks.reserve(numBlocks);
+    for (SizeType32 level = 0; level < kMaxPriority - kMinPriority + 1 && blocks.size() < (size_t) numBlocks; level++)
     {
-        // Find the first non-empty queue, and return the first block.
-        if (!mFreeQueues[cacheLevel][level].empty())
+        // Walk each queue front to back, collecting victims in eviction order without restarting
+        // the priority scan per block.
+        auto const canOffload = cacheLevel == 0 && level >= mSecondaryOffloadMinPriority;
+        for (auto const& block : mFreeQueues[cacheLevel][level])
         {
-            auto block = mFreeQueues[cacheLevel][level].front();
-
             // mFreeQueues only contains leaf blocks, so no need to iterate through the next block pointers.
             // It's possible to have a primary block with children in secondary memory. We handle this
             // by freeing all descendants in WindowBlockManager::getFreeBlock. This is done either by
             // offloading (preferred method) or explicitly.
-            return std::make_tuple(block, cacheLevel == 0 && level >= mSecondaryOffloadMinPriority);
+            blocks.emplace_back(block, canOffload);
+            if (blocks.size() == (size_t) numBlocks)
+            {
+                break;
+            }
         }
     }
-    TLLM_THROW("No free block found. This shouldn't happen!");
+    return blocks;
 }
 
 void LRUEvictionPolicy::releaseBlock(BlockPtr block)
@@ -128,12 +145,22 @@ void LRUEvictionPolicy::releaseBlock(BlockPtr block)
 }
 
 void LRUEvictionPolicy::releaseBlock(BlockPtr block, bool toFront)
+{
+    if (block->getDurationMs().has_value() && block->getPriority() != kDefaultPriority)
+    {
+        block->setExpirationTime(getTime() + *block->getDurationMs());
+    }
+    releaseBlockBookkeeping(std::move(block), toFront);
+}
+
+void LRUEvictionPolicy::releaseBlockBookkeeping(BlockPtr block, bool toFront)
 {
     SizeType32 const cacheLevel = getCacheLevel(block);
     SizeType32 const id = block->getBlockId();
+    auto const priorityIdx = getPriorityIdx(block->getPriority());
 
     // If there are no children, this is a leaf block. Insert into a queue.
-    auto& q = mFreeQueues[cacheLevel][getPriorityIdx(block->getPriority())];
+    auto& q = mFreeQueues[cacheLevel][priorityIdx];
     if (toFront)
     {
         mFreeBlockIterators[id] = q.insert(q.begin(), block);
@@ -142,15 +169,14 @@ void LRUEvictionPolicy::releaseBlock(BlockPtr block, bool toFront)
     {
         mFreeBlockIterators[id] = q.insert(q.end(), block);
     }
+    mQueuedPriorityIdx[id] = priorityIdx;
 
     mNumFreeBlocksPerLevel[cacheLevel]++;
 
-    if (block->getDurationMs().has_value()
-        && block->getPriority() != executor::KvCacheRetentionConfig::kDefaultRetentionPriority)
+    if (block->getDurationMs().has_value() && block->getPriority() != kDefaultPriority)
     {
-        auto expirationTime = getTime() + *block->getDurationMs();
-        block->setExpirationTime(expirationTime);
         mExpiringBlockHeap.emplace(block);
+        mQueuedExpiring[id] = true;
     }
 }
 
@@ -166,25 +192,38 @@ void LRUEvictionPolicy::claimBlock(BlockPtr block)
 
 void LRUEvictionPolicy::claimBlock(BlockPtr block, std::optional<executor::RetentionPriority> priority,
     std::optional<std::chrono::milliseconds> durationMs)
+{
+    claimBlockBookkeeping(block);
+
+    if (priority.has_value())
+    {
+        block->setPriority(*priority);
+    }
+    block->setDurationMs(durationMs);
+}
+
+void LRUEvictionPolicy::claimBlockBookkeeping(BlockPtr const& block)
 {
     SizeType32 const id = block->getBlockId();
     SizeType32 const cacheLevel = getCacheLevel(block);
 
     if (mFreeBlockIterators[id] != std::nullopt)
     {
-        mFreeQueues[cacheLevel][getPriorityIdx(block->getPriority())].erase(*mFreeBlockIterators[id]);
+        // Erase from the queue the block was actually enqueued under; the block's current
+        // priority may have been rewritten since it was released.
+        mFreeQueues[cacheLevel][mQueuedPriorityIdx[id]].erase(*mFreeBlockIterators[id]);
         mNumFreeBlocksPerLevel[cacheLevel] -= 1;
     }
 
     mFreeBlockIterators[id] = std::nullopt;
 
-    if (priority.has_value())
+    // Matches the insertion condition in releaseBlockBookkeeping; blocks without an expiration
+    // entry can skip the heap lookup entirely, which dominates claim cost at large block counts.
+    if (mQueuedExpiring[id])
     {
-        block->setPriority(*priority);
+        mExpiringBlockHeap.erase(block);
+        mQueuedExpiring[id] = false;
     }
-
-    mExpiringBlockHeap.erase(block);
-    block->setDurationMs(durationMs);
 }
 
 std::chrono::steady_clock::time_point::duration LRUEvictionPolicy::getTime() const
@@ -206,16 +245,281 @@ void LRUEvictionPolicy::refresh()
         auto const level = getCacheLevel(block);
 
         mExpiringBlockHeap.erase(mExpiringBlockHeap.begin());
+        mQueuedExpiring[id] = false;
 
         if (mFreeBlockIterators[id] != std::nullopt)
         {
             // This is already in another queue. Delete it, and bring it down to the default queue
-            mFreeQueues[level][getPriorityIdx(block->getPriority())].erase(*mFreeBlockIterators[id]);
+            mFreeQueues[level][mQueuedPriorityIdx[id]].erase(*mFreeBlockIterators[id]);
             auto& q = mFreeQueues[level][getPriorityIdx(kDefaultPriority)];
             mFreeBlockIterators[id] = q.insert(q.end(), block);
+            mQueuedPriorityIdx[id] = getPriorityIdx(kDefaultPriority);
         }
         block->setPriority(kDefaultPriority);
     }
 }
 
+void LFUEvictionPolicy::initialize(std::vector<BlockPtr>& mAllBlocksById, std::vector<SizeType32> sizes,
+    std::optional<executor::RetentionPriority> secondaryOffloadMinPriority)
+{
+    LRUEvictionPolicy::initialize(mAllBlocksById, sizes, secondaryOffloadMinPriority);
+    mReuseCounts.assign(mFreeBlockIterators.size(), 0.F);
+}
+
+std::vector<std::tuple<BlockPtr, bool>> LFUEvictionPolicy::getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks)
+{
+    std::vector<std::tuple<BlockPtr, bool>> blocks;
+    blocks.reserve(numBlocks);
+    for (SizeType32 level = 0; level < kMaxPriority - kMinPriority + 1 && blocks.size() < (size_t) numBlocks; level++)
+    {
+        auto const canOffload = cacheLevel == 0 && level >= mSecondaryOffloadMinPriority;
+        auto const needed = static_cast<std::size_t>(numBlocks) - blocks.size();
+
+        // Collect the LRU-ordered queue prefix once. Every selection step below only looks at the
+        // first kEvictionSampleSize unselected entries, so the result matches repeated
+        // getFreeBlock/claimBlock cycles while keeping the selection cost bounded.
+        std::vector<BlockPtr> candidates;
+        candidates.reserve(needed + kEvictionSampleSize - 1);
+        for (auto const& block : mFreeQueues[cacheLevel][level])
+        {
+            candidates.push_back(block);
+            if (candidates.size() == needed + kEvictionSampleSize - 1)
+            {
+                break;
+            }
+        }
+
+        std::vector<bool> selected(candidates.size(), false);
+        std::size_t numSelected = 0;
+        while (blocks.size() < (size_t) numBlocks && numSelected < candidates.size())
+        {
+            // Evict the least-frequently-reused block within the sample window; ties fall back to
+            // the least-recently-used one.
+            auto bestIdx = candidates.size();
+            SizeType32 sampled = 0;
+            for (std::size_t idx = 0; idx < candidates.size(); idx++)
+            {
+                if (selected[idx])
+                {
+                    continue;
+                }
+                if (bestIdx == candidates.size()
+                    || mReuseCounts[candidates[idx]->getBlockId()] < mReuseCounts[candidates[bestIdx]->getBlockId()])
+                {
+                    bestIdx = idx;
+                }
+                if (++sampled == kEvictionSampleSize)
+                {
+                    break;
+                }
+            }
+            selected[bestIdx] = true;
+            numSelected++;
+            blocks.emplace_back(candidates[bestIdx], canOffload);
+        }
+    }
+    return blocks;
+}
+
+void LFUEvictionPolicy::claimBlockBookkeeping(BlockPtr const& block)
+{
+    LRUEvictionPolicy::claimBlockBookkeeping(block);
+
+    // A claim of a block that still holds tokens reuses its content. A victim claimed for
+    // overwrite also still holds its previous tokens at this point, so its count carries over one
+    // refill; aging washes that out, mirroring how approximate LFU caches seed new entries.
+    auto const id = block->getBlockId();
+    if (block->getUniqueTokens().empty())
+    {
+        mReuseCounts[id] = 0.F;
+    }
+    else
+    {
+        mReuseCounts[id] += 1.F;
+    }
+}
+
+void LFUEvictionPolicy::refresh()
+{
+    LRUEvictionPolicy::refresh();
+
+    if (--mRefreshesUntilAging == 0)
+    {
+        mRefreshesUntilAging = kAgingPeriod;
+        for (auto& count : mReuseCounts)
+        {
+            count *= 0.5F;
+        }
+    }
+}
+
+// How many victim candidates a policy scans when nominating its ghost block.
+SizeType32 constexpr kGhostProbeDepth = 8;
+
+void AdaptiveEvictionPolicy::initialize(std::vector<BlockPtr>& mAllBlocksById, std::vector<SizeType32> sizes,
+    std::optional<executor::RetentionPriority> secondaryOffloadMinPriority)
+{
+    mPolicies[kLru] = std::make_shared<LRUEvictionPolicy>();
+    mPolicies[kLfu] = std::make_shared<LFUEvictionPolicy>();
+    mPolicies[kLru]->initialize(mAllBlocksById, sizes, secondaryOffloadMinPriority);
+    mPolicies[kLfu]->initialize(mAllBlocksById, sizes, secondaryOffloadMinPriority);
+}
+
+std::tuple<BlockPtr, bool> AdaptiveEvictionPolicy::getFreeBlock(SizeType32 cacheLevel)
+{
+    auto block = livePolicy().getFreeBlock(cacheLevel);
+    mPendingVictims.insert(std::get<0>(block)->getBlockId());
+    return block;
+}
+
+std::vector<std::tuple<BlockPtr, bool>> AdaptiveEvictionPolicy::getFreeBlocks(SizeType32 cacheLevel, SizeType32 numBlocks)
+{
+    auto blocks = livePolicy().getFreeBlocks(cacheLevel, numBlocks);
+    for (auto const& [block, canOffload] : blocks)
+    {
+        mPendingVictims.insert(block->getBlockId());
+    }
+    return blocks;
+}
+
+void AdaptiveEvictionPolicy::releaseBlock(BlockPtr block)
+{
+    releaseBlock(std::move(block), false);
+}
+
+void AdaptiveEvictionPolicy::releaseBlock(BlockPtr block, bool toFront)
+{
+    // The live policy takes the full call and sets the block's shared expiration state; the
+    // shadow policy only mirrors the bookkeeping so the state is written exactly once.
+    livePolicy().releaseBlock(block, toFront);
+    shadowPolicy().releaseBlockBookkeeping(std::move(block), toFront);
+}
+
+SizeType32 AdaptiveEvictionPolicy::getNumFreeBlocks(SizeType32 cacheLevel)
+{
+    return livePolicy().getNumFreeBlocks(cacheLevel);
+}
+
+void AdaptiveEvictionPolicy::claimBlock(BlockPtr block)
+{
+    claimBlock(std::move(block), std::nullopt, std::nullopt);
+}
+
+void AdaptiveEvictionPolicy::claimBlock(BlockPtr block, std::optional<executor::RetentionPriority> priority,
+    std::optional<std::chrono::milliseconds> durationMs)
+{
+    auto const id = block->getBlockId();
+    if (!block->getUniqueTokens().empty())
+    {
+        if (mPendingVictims.erase(id) > 0)
+        {
+            recordEviction(block);
+        }
+        else
+        {
+            recordReuse(id);
+        }
+    }
+    else
+    {
+        mPendingVictims.erase(id);
+    }
+
+    livePolicy().claimBlock(block, priority, durationMs);
+    shadowPolicy().claimBlockBookkeeping(block);
+}
+
+void AdaptiveEvictionPolicy::refresh()
+{
+    mPolicies[kLru]->refresh();
+    mPolicies[kLfu]->refresh();
+    mPendingVictims.clear();
+
+    if (mWindowReuses < kDecisionWindow)
+    {
+        return;
+    }
+
+    auto const liveMisses = mGhosts[mLiveIdx].simulatedMisses;
+    auto const shadowMisses = mGhosts[1 - mLiveIdx].simulatedMisses;
+    // Require a 10% advantage before switching so noisy windows don't cause flapping.
+    if (shadowMisses * 10 < liveMisses * 9)
+    {
+        mLiveIdx = 1 - mLiveIdx;
+        TLLM_LOG_INFO(
+            "AdaptiveEvictionPolicy: switching live KV cache eviction policy to %s (simulated misses %lu vs %lu over "
+            "%lu reuses)",
+            mLiveIdx == kLfu ? "LFU" : "LRU", static_cast<unsigned long>(shadowMisses),
+            static_cast<unsigned long>(liveMisses), static_cast<unsigned long>(mWindowReuses));
+    }
+    // Exponential forgetting keeps old windows from drowning out shifts in the workload.
+    mGhosts[kLru].simulatedMisses /= 2;
+    mGhosts[kLfu].simulatedMisses /= 2;
+    mWindowReuses = 0;
+}
+
+bool AdaptiveEvictionPolicy::verifyQueueIntegrity()
+{
+    return mPolicies[kLru]->verifyQueueIntegrity() && mPolicies[kLfu]->verifyQueueIntegrity();
+}
+
+void AdaptiveEvictionPolicy::recordEviction(BlockPtr const& victim)
+{
+    auto const victimId = victim->getBlockId();
+    // The victim's content is gone, so any earlier nomination of it is obsolete.
+    ghostErase(mGhosts[kLru], victimId);
+    ghostErase(mGhosts[kLfu], victimId);
+
+    // Each policy nominates the next reusable block it would evict if the cache were slightly
+    // smaller. Nominees stay resident, so a later reuse of one is a simulated miss the other
+    // policy may have avoided.
+    auto const cacheLevel = victim->isPrimary() ? 0 : 1;
+    for (auto const policyIdx : {kLru, kLfu})
+    {
+        auto& ghost = mGhosts[policyIdx];
+        for (auto const& [candidate, canOffload] : mPolicies[policyIdx]->getFreeBlocks(cacheLevel, kGhostProbeDepth))
+        {
+            auto const candidateId = candidate->getBlockId();
+            if (candidateId != victimId && ghost.ids.count(candidateId) == 0 && !candidate->getUniqueTokens().empty())
+            {
+                ghostInsert(ghost, candidateId);
+                break;
+            }
+        }
+    }
+}
+
+void AdaptiveEvictionPolicy::recordReuse(KVCacheBlock::IdType blockId)
+{
+    for (auto const policyIdx : {kLru, kLfu})
+    {
+        auto& ghost = mGhosts[policyIdx];
+        if (ghost.ids.count(blockId) > 0)
+        {
+            ghost.simulatedMisses++;
+            ghostErase(ghost, blockId);
+        }
+    }
+    mWindowReuses++;
+}
+
+void AdaptiveEvictionPolicy::ghostInsert(GhostList& ghost, KVCacheBlock::IdType blockId)
+{
+    ghost.order.push_back(blockId);
+    ghost.ids.insert(blockId);
+    while (ghost.order.size() > static_cast<std::size_t>(kGhostCapacity))
+    {
+        ghost.ids.erase(ghost.order.front());
+        ghost.order.pop_front();
+    }
+}
+
+void AdaptiveEvictionPolicy::ghostErase(GhostList& ghost, KVCacheBlock::IdType blockId)
+{
+    if (ghost.ids.erase(blockId) > 0)
+    {
+        ghost.order.erase(std::find(ghost.order.begin(), ghost.order.end(), blockId));
+    }
+}
+
 } // namespace tensorrt_llm::batch_manager::eviction_policy
@@ -18,23 +18,133 @@
 #include "tensorrt_llm/batch_manager/guidedDecoder.h"
 #include "tensorrt_llm/batch_manager/decoderBuffers.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/batch_manager/utils/staticThreadPool.h"
+#include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/kernels/logitsBitmask.h"
 
 #include <nlohmann/json.hpp>
 #include <xgrammar/xgrammar.h>
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <list>
+#include <unordered_map>
+
 using namespace tensorrt_llm::runtime;
 
 namespace tensorrt_llm::batch_manager
 {
 
+//! Shares compiled grammars across requests. Entries are keyed by guide type and guide text and
+//! bounded by an LRU limit; compilation runs on a dedicated worker pool, so a repeat guide attaches
+//! its grammar immediately while a first occurrence compiles in the background and can stay pending
+//! until the request actually needs its bitmask. Only accessed from the build thread.
+class CompiledGrammarCache
+{
+public:
+    using SizeType32 = GuidedDecoder::SizeType32;
+    using GuideType = executor::GuidedDecodingParams::GuideType;
+
+    CompiledGrammarCache(std::shared_ptr<xgrammar::GrammarCompiler> compiler, SizeType32 maxNumSequences,
+        std::size_t maxEntries, std::size_t numWorkers)
+        : mCompiler{std::move(compiler)}
+        , mMaxEntries{std::max<std::size_t>(1, maxEntries)}
+        , mWorkerPool{std::make_unique<utils::StaticThreadPool>(numWorkers)}
+        , mPendingGrammars(maxNumSequences)
+        , mPendingKeys(maxNumSequences)
+    {
+    }
+
+    //! Points the slot at the compiled grammar for the given guide, starting an asynchronous
+    //! compilation on a cache miss.
+    void prepare(SizeType32 seqSlot, GuideType guideType, std::optional<std::string> const& guide)
+    {
+        auto key = std::to_string(static_cast<int>(guideType));
+        key.push_back('\0');
+        key.append(guide.value_or(""));
+        auto it = mEntries.find(key);
+        if (it == mEntries.end())
+        {
+            auto future
+                = mWorkerPool->execute([this, guideType, guide]() { return compile(guideType, guide); }).share();
+            mLruOrder.push_front(key);
+            it = mEntries.emplace(std::move(key), Entry{std::move(future), mLruOrder.begin()}).first;
+            if (mEntries.size() > mMaxEntries)
+            {
+                // Slots keep their own copy of the shared future, so evicting is always safe.
+                mEntries.erase(mLruOrder.back());
+                mLruOrder.pop_back();
+            }
+        }
+        else
+        {
+            mLruOrder.splice(mLruOrder.begin(), mLruOrder, it->second.lruIt);
+        }
+        mPendingGrammars.at(seqSlot) = it->second.grammar;
+        mPendingKeys.at(seqSlot) = it->first;
+    }
+
+    //! Identifies the guide behind the slot's grammar. Equal keys imply identical grammars and
+    //! therefore identical initial matcher states; the key outlives take() and cache eviction.
+    [[nodiscard]] std::string const& guideKey(SizeType32 seqSlot) const
+    {
+        return mPendingKeys.at(seqSlot);
+    }
+
+    [[nodiscard]] bool isReady(SizeType32 seqSlot) const
+    {
+        return mPendingGrammars.at(seqSlot).wait_for(std::chrono::seconds::zero()) == std::future_status::ready;
+    }
+
+    //! Hands out the slot's compiled grammar, blocking while it is still compiling.
+    [[nodiscard]] xgrammar::CompiledGrammar take(SizeType32 seqSlot)
+    {
+        auto grammar = mPendingGrammars.at(seqSlot).get();
+        mPendingGrammars.at(seqSlot) = {};
+        return grammar;
+    }
+
+private:
+    xgrammar::CompiledGrammar compile(GuideType guideType, std::optional<std::string> const& guide) const
+    {
+        switch (guideType)
+        {
+        case GuideType::kJSON: return mCompiler->CompileBuiltinJSONGrammar();
+        case GuideType::kJSON_SCHEMA: return mCompiler->CompileJSONSchema(guide.value());
+        case GuideType::kREGEX: return mCompiler->CompileRegex(guide.value());
+        case GuideType::kEBNF_GRAMMAR: return mCompiler->CompileGrammar(guide.value());
+        case GuideType::kSTRUCTURAL_TAG: return mCompiler->CompileStructuralTag(guide.value());
+        default: TLLM_THROW("Unsupported guide type.");
+        }
+    }
+
+    struct Entry
+    {
+        std::shared_future<xgrammar::CompiledGrammar> grammar;
+        std::list<std::string>::iterator lruIt;
+    };
+
+    std::shared_ptr<xgrammar::GrammarCompiler> mCompiler;
+    std::size_t mMaxEntries;
+    std::unique_ptr<utils::StaticThreadPool> mWorkerPool;
+    //! Most recently used key at the front.
+    std::list<std::string> mLruOrder;
+    std::unordered_map<std::string, Entry> mEntries;
+    //! Per-slot compiled grammar awaited between prepare() and take().
+    std::vector<std::shared_future<xgrammar::CompiledGrammar>> mPendingGrammars;
+    //! Per-slot cache key of the grammar last prepared for the slot.
+    std::vector<std::string> mPendingKeys;
+};
+
 GuidedDecoder::GuidedDecoder(executor::GuidedDecodingConfig const& guidedDecodingConfig, SizeType32 maxNumSequences,
     SizeType32 vocabSizePadded, nvinfer1::DataType logitsDtype, BufferManager const& runtimeBufferManager)
     : mGuidedDecodingBackend{guidedDecodingConfig.getBackend()}
     , mMaxNumSequences{maxNumSequences}
     , mVocabSizePadded{vocabSizePadded}
     , mBitmaskSize{common::ceilDiv(mVocabSizePadded, 32)}
+    , mMaxSparseMaskWords{common::ceilDiv(mBitmaskSize, 8)}
     , mLogitsDtype{logitsDtype}
     , mCopyBufferManager{std::make_shared<CudaStream>()}
 {
@@ -71,6 +181,32 @@ GuidedDecoder::GuidedDecoder(executor::GuidedDecodingConfig const& guidedDecodin
         mLogitsBitmaskPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), bitmaskPtrDtype);
         mLogitsPtrVec = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
         mLogitsPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
+
+        mSparseMask
+            = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences, 2 * mMaxSparseMaskWords}), bitmaskDtype);
+        mSparseMaskHost
+            = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences, 2 * mMaxSparseMaskWords}), bitmaskDtype);
+        mSparseLogitsPtrVec = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
+        mSparseLogitsPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), logitsPtrDtype);
+        mSparseMaskPtrVec = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), bitmaskPtrDtype);
+        mSparseMaskPtrVecHost = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), bitmaskPtrDtype);
+        mSparseNumWordsVec
+            = runtimeBufferManager.gpu(ITensor::makeShape({mMaxNumSequences}), nvinfer1::DataType::kINT32);
+        mSparseNumWordsVecHost
+            = BufferManager::pinned(ITensor::makeShape({mMaxNumSequences}), nvinfer1::DataType::kINT32);
+        mSparseMaskNumWords.resize(mMaxNumSequences, 0);
+
+        mBuildThreadPool = std::make_unique<utils::StaticThreadPool>(1);
+        mGrammarCache = std::make_unique<CompiledGrammarCache>(mXGrammarCompiler, mMaxNumSequences,
+            common::getEnvGuidedGrammarCacheSize(), common::getEnvGuidedGrammarCompileWorkers());
+    }
+}
+
+GuidedDecoder::~GuidedDecoder()
+{
+    if (mBuildFuture.valid())
+    {
+        mBuildFuture.wait();
     }
 }
 
@@ -78,6 +214,10 @@ void GuidedDecoder::build(ScheduledRequests const& scheduledRequests)
 {
     if (mGuidedDecodingBackend == executor::GuidedDecodingConfig::GuidedDecodingBackend::kXGRAMMAR)
     {
+        // Freshly attached matchers start in their grammar's initial state, so requests entering
+        // the batch with the same guide produce identical first bitmasks; only the first one runs
+        // the xgrammar fill and the others copy its mask.
+        std::unordered_map<std::string, SizeType32> initialMaskSlots;
         for (auto const& requests : {scheduledRequests.contextRequests, scheduledRequests.generationRequests})
         {
             for (auto const& llmReq : requests)
@@ -88,48 +228,31 @@ void GuidedDecoder::build(ScheduledRequests const& scheduledRequests)
                     continue;
                 }
                 auto const seqSlot = llmReq->mSeqSlot.value();
-                if (llmReq->isContextInitState() && llmReq->isFirstContextChunk())
+                bool isInitialMask{false};
+                if (llmReq->isContextInitState())
                 {
-                    // The request is in the first context forward step (considering kv cache reuse).
-                    auto const& guideType = guidedDecodingParams->getGuideType();
-                    auto const& guide = guidedDecodingParams->getGuide();
-                    switch (guideType)
-                    {
-                    case executor::GuidedDecodingParams::GuideType::kJSON:
+                    if (llmReq->isFirstContextChunk())
                     {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileBuiltinJSONGrammar());
-                        break;
+                        // The request is in the first context forward step (considering kv cache reuse).
+                        mXGrammarMatchers.at(seqSlot).reset();
+                        mGrammarCache->prepare(
+                            seqSlot, guidedDecodingParams->getGuideType(), guidedDecodingParams->getGuide());
                     }
-                    case executor::GuidedDecodingParams::GuideType::kJSON_SCHEMA:
+                    if (mXGrammarMatchers.at(seqSlot) != nullptr)
                     {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileJSONSchema(guide.value()));
-                        break;
+                        // Matcher attached and bitmask filled in an earlier context chunk.
+                        continue;
                     }
-                    case executor::GuidedDecodingParams::GuideType::kREGEX:
+                    if (!llmReq->isLastContextChunk() && !mGrammarCache->isReady(seqSlot))
                     {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileRegex(guide.value()));
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kEBNF_GRAMMAR:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileGrammar(guide.value()));
-                        break;
-                    }
-                    case executor::GuidedDecodingParams::GuideType::kSTRUCTURAL_TAG:
-                    {
-                        mXGrammarMatchers.at(seqSlot) = std::make_shared<xgrammar::GrammarMatcher>(
-                            mXGrammarCompiler->CompileStructuralTag(guide.value()));
-                        break;
-                    }
-                    default:
-                    {
-                        TLLM_THROW("Unsupported guide type.");
-                    }
+                        // First-occurrence compilation still in flight on the cache workers; the
+                        // bitmask is not consumed before the last context chunk, so try again with
+                        // the next chunk instead of stalling the build.
+                        continue;
                     }
+                    mXGrammarMatchers.at(seqSlot)
+                        = std::make_shared<xgrammar::GrammarMatcher>(mGrammarCache->take(seqSlot));
+                    isInitialMask = true;
                 }
                 else if (llmReq->isGenerationInProgressState())
                 {
@@ -142,24 +265,114 @@ void GuidedDecoder::build(ScheduledRequests const& scheduledRequests)
                     continue;
                 }
 
+                if (isInitialMask)
+                {
+                    auto const [maskIt, isFirst]
+                        = initialMaskSlots.try_emplace(mGrammarCache->guideKey(seqSlot), seqSlot);
+                    if (!isFirst)
+                    {
+                        copyMaskFromSlot(maskIt->second, seqSlot);
+                        continue;
+                    }
+                }
+
                 // Fill the bitmask on host and asynchorously copy to device using mCopyBufferManager.
-                auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
                 auto const logitsBitmaskHost = ITensor::at(mLogitsBitmaskHost, {seqSlot});
 
                 std::array<int64_t, 1> bitmaskShape{mBitmaskSize};
                 DLTensor logitsBitmaskDlt{logitsBitmaskHost->data(), DLDevice{kDLCPU, 0}, 1, DLDataType{kDLInt, 32, 1},
                     bitmaskShape.data(), nullptr, 0};
                 mXGrammarMatchers.at(seqSlot)->FillNextTokenBitmask(&logitsBitmaskDlt);
-                mCopyBufferManager.copy(*logitsBitmaskHost, *logitsBitmask);
+                storeBitmask(seqSlot);
             }
         }
     }
 }
 
+void GuidedDecoder::storeBitmask(SizeType32 seqSlot)
+{
+    auto constexpr kAllowAllWord = ~BitmaskT{0};
+    auto const* bitmaskRow
+        = bufferCast<BitmaskT>(*mLogitsBitmaskHost) + static_cast<std::size_t>(seqSlot) * mBitmaskSize;
+    auto* sparseRow = bufferCast<BitmaskT>(*mSparseMaskHost) + static_cast<std::size_t>(seqSlot) * 2 * mMaxSparseMaskWords;
+
+    SizeType32 numWords{0};
+    for (SizeType32 wordIdx = 0; wordIdx < mBitmaskSize; ++wordIdx)
+    {
+        if (bitmaskRow[wordIdx] == kAllowAllWord)
+        {
+            continue;
+        }
+        if (numWords == mMaxSparseMaskWords)
+        {
+            numWords = kDenseMask;
+            break;
+        }
+        sparseRow[2 * numWords] = static_cast<BitmaskT>(wordIdx);
+        sparseRow[2 * numWords + 1] = bitmaskRow[wordIdx];
+        ++numWords;
+    }
+    mSparseMaskNumWords.at(seqSlot) = numWords;
+
+    if (numWords == kDenseMask)
+    {
+        mCopyBufferManager.copy(*ITensor::at(mLogitsBitmaskHost, {seqSlot}), *ITensor::at(mLogitsBitmask, {seqSlot}));
+    }
+    else if (numWords > 0)
+    {
+        // Only the populated pairs travel to the device, so sparse masks also shrink the H2D copy.
+        mCopyBufferManager.copy(*ITensor::slice(ITensor::at(mSparseMaskHost, {seqSlot}), 0, 2 * numWords),
+            *ITensor::slice(ITensor::at(mSparseMask, {seqSlot}), 0, 2 * numWords));
+    }
+}
+
+void GuidedDecoder::copyMaskFromSlot(SizeType32 srcSlot, SizeType32 dstSlot)
+{
+    auto const numWords = mSparseMaskNumWords.at(srcSlot);
+    mSparseMaskNumWords.at(dstSlot) = numWords;
+    if (numWords == kDenseMask)
+    {
+        auto const srcHost = ITensor::at(mLogitsBitmaskHost, {srcSlot});
+        auto const dstHost = ITensor::at(mLogitsBitmaskHost, {dstSlot});
+        std::memcpy(dstHost->data(), srcHost->data(), srcHost->getSizeInBytes());
+        mCopyBufferManager.copy(*dstHost, *ITensor::at(mLogitsBitmask, {dstSlot}));
+    }
+    else if (numWords > 0)
+    {
+        auto const srcHost = ITensor::slice(ITensor::at(mSparseMaskHost, {srcSlot}), 0, 2 * numWords);
+        auto const dstHost = ITensor::slice(ITensor::at(mSparseMaskHost, {dstSlot}), 0, 2 * numWords);
+        std::memcpy(dstHost->data(), srcHost->data(), srcHost->getSizeInBytes());
+        mCopyBufferManager.copy(*dstHost, *ITensor::slice(ITensor::at(mSparseMask, {dstSlot}), 0, 2 * numWords));
+    }
+}
+
+void GuidedDecoder::buildAsync(ScheduledRequests const& scheduledRequests)
+{
+    if (mGuidedDecodingBackend == executor::GuidedDecodingConfig::GuidedDecodingBackend::kXGRAMMAR)
+    {
+        TLLM_CHECK_WITH_INFO(!mBuildFuture.valid(), "The previous bitmask build has not been consumed by execute().");
+        // The scheduled requests outlive the forward step that joins this future in execute(), and
+        // the matchers and host bitmasks are only touched from the worker thread in between.
+        auto const device = common::getDevice();
+        mBuildFuture = mBuildThreadPool->execute(
+            [this, device, &scheduledRequests]()
+            {
+                TLLM_CUDA_CHECK(cudaSetDevice(device));
+                build(scheduledRequests);
+            });
+    }
+}
+
 void GuidedDecoder::execute(DecoderInputBuffers const& decoderInputBuffers, BufferManager const& runtimeBufferManager)
 {
     auto const& stream = runtimeBufferManager.getStream();
 
+    if (mBuildFuture.valid())
+    {
+        // Join the background bitmask build; its H2D copies are then in flight on mCopyBufferManager.
+        mBuildFuture.get();
+    }
+
     // Wait for mCopyBufferManager finishing the H2D copy of logitsBitmask
     // TODO(enweiz): Move the H2D copy of logitsBitmaskPtrVec to buildGuidedDecoding.
     // This may not bring too much perf gain because of the small size of logitsBitmaskPtrVec.
@@ -172,7 +385,9 @@ void GuidedDecoder::execute(DecoderInputBuffers const& decoderInputBuffers, Buff
     if (mGuidedDecodingBackend == executor::GuidedDecodingConfig::GuidedDecodingBackend::kXGRAMMAR
         && !decoderInputBuffers.decoderRequests.empty())
     {
-        SizeType32 batchIdx{0};
+        SizeType32 denseBatchIdx{0};
+        SizeType32 sparseBatchIdx{0};
+        SizeType32 maxSparseNumWords{0};
         for (size_t requestIdx = 0; requestIdx < decoderInputBuffers.decoderRequests.size(); ++requestIdx)
         {
             auto const& llmReq = decoderInputBuffers.decoderRequests.at(requestIdx);
@@ -181,37 +396,84 @@ void GuidedDecoder::execute(DecoderInputBuffers const& decoderInputBuffers, Buff
             if (guidedDecodingParams.has_value())
             {
                 auto const seqSlot = llmReq->mSeqSlot.value();
+                auto const numWords = mSparseMaskNumWords.at(seqSlot);
+                if (numWords == 0)
+                {
+                    // The grammar allows the full vocabulary in this state.
+                    continue;
+                }
 
                 auto const& logits = decoderInputBuffers.logits.at(requestIdx);
-                auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
 
                 // Use void* to unify the code for different mLogitsDtype
-                *reinterpret_cast<void**>(ITensor::at(mLogitsPtrVecHost, {batchIdx})->data()) = logits->data();
-                *reinterpret_cast<void**>(ITensor::at(mLogitsBitmaskPtrVecHost, {batchIdx})->data())
-                    = logitsBitmask->data();
-
-                ++batchIdx;
+                if (numWords == kDenseMask)
+                {
+                    auto const logitsBitmask = ITensor::at(mLogitsBitmask, {seqSlot});
+                    *reinterpret_cast<void**>(ITensor::at(mLogitsPtrVecHost, {denseBatchIdx})->data())
+                        = logits->data();
+                    *reinterpret_cast<void**>(ITensor::at(mLogitsBitmaskPtrVecHost, {denseBatchIdx})->data())
+                        = logitsBitmask->data();
+                    ++denseBatchIdx;
+                }
+                else
+                {
+                    *reinterpret_cast<void**>(ITensor::at(mSparseLogitsPtrVecHost, {sparseBatchIdx})->data())
+                        = logits->data();
+                    *reinterpret_cast<void**>(ITensor::at(mSparseMaskPtrVecHost, {sparseBatchIdx})->data())
+                        = ITensor::at(mSparseMask, {seqSlot})->data();
+                    bufferCast<SizeType32>(*mSparseNumWordsVecHost)[sparseBatchIdx] = numWords;
+                    maxSparseNumWords = std::max(maxSparseNumWords, numWords);
+                    ++sparseBatchIdx;
+                }
             }
         }
-        if (batchIdx > 0)
+        if (denseBatchIdx > 0)
         {
-            runtimeBufferManager.copy(
-                *ITensor::slice(mLogitsPtrVecHost, 0, batchIdx), *ITensor::slice(mLogitsPtrVec, 0, batchIdx));
-            runtimeBufferManager.copy(*ITensor::slice(mLogitsBitmaskPtrVecHost, 0, batchIdx),
-                *ITensor::slice(mLogitsBitmaskPtrVec, 0, batchIdx));
+            runtimeBufferManager.copy(*ITensor::slice(mLogitsPtrVecHost, 0, denseBatchIdx),
+                *ITensor::slice(mLogitsPtrVec, 0, denseBatchIdx));
+            runtimeBufferManager.copy(*ITensor::slice(mLogitsBitmaskPtrVecHost, 0, denseBatchIdx),
+                *ITensor::slice(mLogitsBitmaskPtrVec, 0, denseBatchIdx));
 
             auto logitsBitmaskPtrVec = bufferCast<BitmaskT const*>(*mLogitsBitmaskPtrVec);
             if (mLogitsDtype == nvinfer1::DataType::kFLOAT)
             {
                 auto logitsPtrVec = bufferCast<float*>(*mLogitsPtrVec);
                 tensorrt_llm::kernels::invokeLogitsBitmask<float>(
-                    logitsPtrVec, logitsBitmaskPtrVec, batchIdx, mVocabSizePadded, stream.get());
+                    logitsPtrVec, logitsBitmaskPtrVec, denseBatchIdx, mVocabSizePadded, stream.get());
             }
             else if (mLogitsDtype == nvinfer1::DataType::kHALF)
             {
                 auto logitsPtrVec = bufferCast<half*>(*mLogitsPtrVec);
                 tensorrt_llm::kernels::invokeLogitsBitmask<half>(
-                    logitsPtrVec, logitsBitmaskPtrVec, batchIdx, mVocabSizePadded, stream.get());
+                    logitsPtrVec, logitsBitmaskPtrVec, denseBatchIdx, mVocabSizePadded, stream.get());
+            }
+            else
+            {
+                TLLM_THROW("Unsupported logits data type.");
+            }
+        }
+        if (sparseBatchIdx > 0)
+        {
+            runtimeBufferManager.copy(*ITensor::slice(mSparseLogitsPtrVecHost, 0, sparseBatchIdx),
+                *ITensor::slice(mSparseLogitsPtrVec, 0, sparseBatchIdx));
+            runtimeBufferManager.copy(*ITensor::slice(mSparseMaskPtrVecHost, 0, sparseBatchIdx),
+                *ITensor::slice(mSparseMaskPtrVec, 0, sparseBatchIdx));
+            runtimeBufferManager.copy(*ITensor::slice(mSparseNumWordsVecHost, 0, sparseBatchIdx),
+                *ITensor::slice(mSparseNumWordsVec, 0, sparseBatchIdx));
+
+            auto sparseMaskPtrVec = bufferCast<BitmaskT const*>(*mSparseMaskPtrVec);
+            auto sparseNumWordsVec = bufferCast<SizeType32 const>(*mSparseNumWordsVec);
+            if (mLogitsDtype == nvinfer1::DataType::kFLOAT)
+            {
+                auto logitsPtrVec = bufferCast<float*>(*mSparseLogitsPtrVec);
+                tensorrt_llm::kernels::invokeSparseLogitsBitmask<float>(logitsPtrVec, sparseMaskPtrVec,
+                    sparseNumWordsVec, maxSparseNumWords, sparseBatchIdx, mVocabSizePadded, stream.get());
+            }
+            else if (mLogitsDtype == nvinfer1::DataType::kHALF)
+            {
+                auto logitsPtrVec = bufferCast<half*>(*mSparseLogitsPtrVec);
+                tensorrt_llm::kernels::invokeSparseLogitsBitmask<half>(logitsPtrVec, sparseMaskPtrVec,
+                    sparseNumWordsVec, maxSparseNumWords, sparseBatchIdx, mVocabSizePadded, stream.get());
             }
             else
             {
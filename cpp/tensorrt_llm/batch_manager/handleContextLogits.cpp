@@ -66,16 +66,35 @@ void setupMedusaLogits(std::vector<TensorPtr>& medusaLogitsHeads, TensorPtr cons
     }
 }
 
+//! @brief Get a view of the persistent tiled logits storage, growing the backing buffer if needed.
+TensorPtr tiledLogitsView(DecoderInputBuffers& inputBuffers, SizeType32 offset, SizeType32 reqBeamWidth,
+    ITensor::DimType64 vocabSizePadded, nvinfer1::DataType logitsType, BufferManager const& manager)
+{
+    auto const numRows = static_cast<ITensor::DimType64>(offset + reqBeamWidth);
+    auto& storage = inputBuffers.tiledLogits;
+    if (!storage || storage->getDataType() != logitsType || storage->getShape().d[1] != vocabSizePadded
+        || storage->getShape().d[0] < numRows)
+    {
+        // Views handed out earlier this iteration keep the previous buffer alive until the decoder consumed them.
+        storage = manager.gpu(ITensor::makeShape({numRows, vocabSizePadded}), logitsType);
+    }
+    return ITensor::slice(storage, offset, reqBeamWidth);
+}
+
 } // namespace
 
 SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, RequestVector const& contextRequests,
     tr::ITensor::SharedPtr const& logits, std::vector<tr::SizeType32> const& numContextLogitsVec,
-    tr::ModelConfig const& modelConfig, tr::BufferManager const& manager,
-    OptionalRef<MedusaBuffers> medusaBuffers) const
+    tr::ModelConfig const& modelConfig, tr::BufferManager const& manager, OptionalRef<MedusaBuffers> medusaBuffers,
+    OptionalRef<tr::BufferManager const> copyManager) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(HandleContextLogits);
 
+    // Host copies of returned logits go to the dedicated copy stream when one is provided, so a large
+    // context-logits copy does not delay the decoder and the next engine launch on the runtime stream.
+    auto const& hostCopyManager = copyManager ? *copyManager : manager;
+
     auto& decoderRequests = inputBuffers.decoderRequests;
     decoderRequests.clear();
     decoderRequests.reserve(contextRequests.size());
@@ -85,6 +104,7 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
 
     SizeType32 batchIndex{0};
     SizeType32 logitsIndex{0};
+    SizeType32 tiledLogitsOffset{0};
     // Copy logits into decoderBuffers.logits
     for (auto const& llmReq : contextRequests)
     {
@@ -114,7 +134,7 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
                 TensorPtr contextLogitsHostView = ITensor::slice(
                     llmReq->getContextLogitsHost(), llmReq->getContextCurrentPosition(), numContextLogits);
                 // Copy to host directly
-                manager.copy(*contextLogitsDeviceView, *contextLogitsHostView);
+                hostCopyManager.copy(*contextLogitsDeviceView, *contextLogitsHostView);
             }
         }
         logitsIndex += numContextLogits + draftLength;
@@ -137,7 +157,7 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
         // save the accepted token logits from target model
         if (llmReq->getReturnGenerationLogits())
         {
-            copyLastContextLogits(logitsView, *llmReq, manager);
+            copyLastContextLogits(logitsView, *llmReq, hostCopyManager);
         }
 
         TLLM_CHECK_DEBUG_WITH_INFO(tru::tensorHasInvalid<float>(*logitsView, manager, "logits") == false,
@@ -149,13 +169,15 @@ SizeType32 HandleContextLogits::operator()(DecoderInputBuffers& inputBuffers, Re
             auto const reqBeamWidth = llmReq->getBeamWidthByIter();
             if (reqBeamWidth > 1)
             {
-                // Tile logits of context requests
+                // Tile logits of context requests into persistent storage to avoid a fresh allocation per request
                 auto const& logitsShape = logitsView->getShape();
                 auto const logitsType = logitsView->getDataType();
-                decoderLogits = manager.gpu(ITensor::makeShape({reqBeamWidth, logitsShape.d[1]}), logitsType);
+                decoderLogits
+                    = tiledLogitsView(inputBuffers, tiledLogitsOffset, reqBeamWidth, logitsShape.d[1], logitsType, manager);
                 tensorrt_llm::runtime::kernels::tileTensor(
                     *decoderLogits, *logitsView, reqBeamWidth, manager.getStream());
                 decoderLogits->unsqueeze(0);
+                tiledLogitsOffset += reqBeamWidth;
             }
             else
             {
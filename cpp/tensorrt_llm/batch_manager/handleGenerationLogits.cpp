@@ -24,9 +24,15 @@
 #include "tensorrt_llm/batch_manager/utils/inflightBatchingUtils.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
+#include "tensorrt_llm/kernels/topkLastDim.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/utils/debugUtils.h"
 
+#ifdef ENABLE_BF16
+#include <cuda_bf16.h>
+#endif
+
+namespace tk = tensorrt_llm::kernels;
 namespace tr = tensorrt_llm::runtime;
 namespace tru = tensorrt_llm::runtime::utils;
 
@@ -62,6 +68,56 @@ void copyStreamingGenerationLogits(BufferManager const& bufferManager, LlmReques
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+//! @brief Compact the step's generation logits to the top-K values and token ids on device, so only
+//! the compacted tensors travel over D2H instead of the full vocabulary width.
+void copyStreamingTopKGenerationLogits(BufferManager const& bufferManager, LlmRequest& llmReq)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    TLLM_CHECK(llmReq.getGenerationLogitsFragmentsSize() == 1);
+
+    auto const k = llmReq.getTopKLogits().value();
+    SizeType32 const numGenerationToken = llmReq.getMaxBeamNumTokens() - llmReq.mPromptLen;
+
+    TensorPtr hostValues = ITensor::slice(llmReq.getGenerationLogitsHost(), numGenerationToken, 1); // [1, beamWidth, k]
+    TensorPtr hostIndices = ITensor::slice(llmReq.getGenerationLogitsTopKIndicesHost(), numGenerationToken, 1);
+    TensorPtr deviceTensorPtr = *(llmReq.getGenerationLogitsFragments().begin());
+
+    auto const& fragmentShape = deviceTensorPtr->getShape();
+    auto const vocabSizePadded = static_cast<SizeType32>(fragmentShape.d[fragmentShape.nbDims - 1]);
+    auto const numRows = static_cast<SizeType32>(deviceTensorPtr->getSize() / vocabSizePadded);
+    TLLM_CHECK_WITH_INFO(k <= vocabSizePadded, "topKLogits (%d) must not exceed the vocabulary size (%d)",
+        static_cast<int>(k), static_cast<int>(vocabSizePadded));
+    TLLM_CHECK(static_cast<SizeType32>(hostValues->getSize()) == numRows * k);
+
+    auto const logitsType = deviceTensorPtr->getDataType();
+    TensorPtr valuesDevice = bufferManager.gpu(ITensor::makeShape({numRows, k}), logitsType);
+    TensorPtr indicesDevice = bufferManager.gpu(ITensor::makeShape({numRows, k}), nvinfer1::DataType::kINT32);
+
+    auto const invokeTopK = [&](auto typeTag)
+    {
+        using T = decltype(typeTag);
+        auto const workspaceSize = static_cast<SizeType32>(
+            tk::invokeComputeTopkLastDimWorkspaceSize<T>(numRows, vocabSizePadded, k, /* is_largest */ true));
+        TensorPtr workspace = bufferManager.gpu(ITensor::makeShape({workspaceSize}), nvinfer1::DataType::kUINT8);
+        tk::invokeTopkLastDim<T>(numRows, vocabSizePadded, k, /* is_largest */ true, deviceTensorPtr->data(),
+            valuesDevice->data(), indicesDevice->data(), workspace->data(), bufferManager.getStream().get());
+    };
+    switch (logitsType)
+    {
+    case nvinfer1::DataType::kFLOAT: invokeTopK(float{}); break;
+    case nvinfer1::DataType::kHALF: invokeTopK(half{}); break;
+#ifdef ENABLE_BF16
+    case nvinfer1::DataType::kBF16: invokeTopK(__nv_bfloat16{}); break;
+#endif
+    default: TLLM_THROW("Unsupported logits data type for top-K compaction");
+    }
+
+    bufferManager.copy(*valuesDevice, *hostValues);
+    bufferManager.copy(*indicesDevice, *hostIndices);
+    llmReq.clearGenerationLogitsFragments();
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 void setupMedusaLogits(std::vector<TensorPtr>& medusaLogitsHeads, TensorPtr const& medusaLogitsDevice,
     SizeType32 medusaHeads, SizeType32 logitsIndex, SizeType32 numLogits)
 {
@@ -78,11 +134,15 @@ void setupMedusaLogits(std::vector<TensorPtr>& medusaLogitsHeads, TensorPtr cons
 void HandleGenerationLogits::operator()(DecoderInputBuffers& inputBuffers, RequestVector const& generationRequests,
     tr::ITensor::SharedPtr const& logits, tr::SizeType32 logitsIndex, tr::ModelConfig const& modelConfig,
     tr::BufferManager const& manager, OptionalRef<RuntimeBuffers> genRuntimeBuffers,
-    OptionalRef<MedusaBuffers> medusaBuffers) const
+    OptionalRef<MedusaBuffers> medusaBuffers, OptionalRef<tr::BufferManager const> copyManager) const
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(HandleGenerationLogits);
 
+    // Host copies of returned logits go to the dedicated copy stream when one is provided, so they
+    // do not delay the decoder and the next engine launch on the runtime stream.
+    auto const& hostCopyManager = copyManager ? *copyManager : manager;
+
     auto& decoderRequests = inputBuffers.decoderRequests;
     decoderRequests.reserve(decoderRequests.size() + generationRequests.size());
     auto& allDecoderLogits = inputBuffers.logits;
@@ -135,14 +195,22 @@ void HandleGenerationLogits::operator()(DecoderInputBuffers& inputBuffers, Reque
                 llmReq->getGenerationLogitsFragmentsSize() <= RuntimeBuffers::GenerationLogitsCache::kCACHE_LENGTH);
             if (llmReq->isStreaming())
             {
-                copyStreamingGenerationLogits(manager, *llmReq);
+                if (llmReq->getTopKLogits().has_value())
+                {
+                    copyStreamingTopKGenerationLogits(hostCopyManager, *llmReq);
+                }
+                else
+                {
+                    copyStreamingGenerationLogits(hostCopyManager, *llmReq);
+                }
             }
             // Copy back to host for every kCACHE_LENGTH steps to mitigate GPU memory pressure
             else if (llmReq->getGenerationLogitsFragmentsSize() == RuntimeBuffers::GenerationLogitsCache::kCACHE_LENGTH)
             {
                 TLLM_CHECK(genRuntimeBuffers);
                 auto constexpr beforeDecoder = true;
-                utils::copyGenerationLogits(genRuntimeBuffers->generationLogitsCache, manager, *llmReq, beforeDecoder);
+                utils::copyGenerationLogits(
+                    genRuntimeBuffers->generationLogitsCache, hostCopyManager, *llmReq, beforeDecoder);
             }
         }
         if (modelConfig.getSpeculativeDecodingMode().hasDraftLogits())
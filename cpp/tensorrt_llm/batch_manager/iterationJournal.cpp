@@ -0,0 +1,278 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/iterationJournal.h"
+
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <sstream>
+
+namespace tensorrt_llm::batch_manager
+{
+
+namespace
+{
+
+//! FNV-1a over the batch composition; stable across builds so a journal can verify a replay.
+class CompositionHash
+{
+public:
+    void update(uint64_t value) noexcept
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            mHash ^= (value >> (i * 8)) & 0xffULL;
+            mHash *= 0x100000001b3ULL;
+        }
+    }
+
+    [[nodiscard]] uint64_t digest() const noexcept
+    {
+        return mHash;
+    }
+
+private:
+    uint64_t mHash{0xcbf29ce484222325ULL};
+};
+
+std::optional<uint64_t> getRequestSeed(LlmRequest const& llmRequest)
+{
+    auto const& seeds = llmRequest.mSamplingConfig.randomSeed;
+    if (seeds.has_value() && !seeds->empty())
+    {
+        return seeds->front();
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+std::unique_ptr<IterationJournal> IterationJournal::fromEnv()
+{
+    auto const& recordPath = common::getEnvIterationJournalRecordPath();
+    auto const& replayPath = common::getEnvIterationJournalReplayPath();
+    if (recordPath.empty() && replayPath.empty())
+    {
+        return nullptr;
+    }
+    TLLM_CHECK_WITH_INFO(
+        recordPath.empty() || replayPath.empty(), "Iteration journal cannot record and replay at the same time");
+
+    // make_unique cannot reach the private constructor
+    auto journal = std::unique_ptr<IterationJournal>(new IterationJournal());
+    if (!recordPath.empty())
+    {
+        journal->mOutFile.open(recordPath, std::ios::out | std::ios::trunc);
+        if (!journal->mOutFile)
+        {
+            TLLM_LOG_ERROR("Failed to open iteration journal %s for recording", recordPath.c_str());
+            return nullptr;
+        }
+        TLLM_LOG_INFO("Recording per-iteration batch composition to %s", recordPath.c_str());
+        return journal;
+    }
+    journal->mReplaying = true;
+    journal->loadJournal(replayPath);
+    if (journal->mEntries.empty())
+    {
+        TLLM_LOG_ERROR("Iteration journal %s is empty or unreadable, replay disabled", replayPath.c_str());
+        return nullptr;
+    }
+    TLLM_LOG_INFO(
+        "Replaying batch composition of %zu iterations from %s", journal->mEntries.size(), replayPath.c_str());
+    return journal;
+}
+
+void IterationJournal::recordIteration(
+    IterationType iter, RequestVector const& contextRequests, RequestVector const& generationRequests)
+{
+    if (contextRequests.empty() && generationRequests.empty())
+    {
+        return;
+    }
+    CompositionHash hash;
+    hash.update(iter);
+    std::ostringstream line;
+    line << "iter=" << iter << " ctx=";
+    for (auto const& llmReq : contextRequests)
+    {
+        auto const contextPosition = llmReq->getContextCurrentPosition();
+        auto const chunkSize = llmReq->getContextChunkSize();
+        auto const seed = getRequestSeed(*llmReq);
+        line << llmReq->mRequestId << ':' << contextPosition << ':' << chunkSize << ':';
+        if (seed.has_value())
+        {
+            line << seed.value();
+        }
+        else
+        {
+            line << '-';
+        }
+        line << ',';
+        hash.update(llmReq->mRequestId);
+        hash.update(static_cast<uint64_t>(contextPosition));
+        hash.update(static_cast<uint64_t>(chunkSize));
+    }
+    line << " gen=";
+    for (auto const& llmReq : generationRequests)
+    {
+        line << llmReq->mRequestId << ',';
+        hash.update(llmReq->mRequestId);
+    }
+    line << " hash=" << std::hex << hash.digest();
+    mOutFile << line.str() << '\n';
+    // One line per iteration; keep the journal intact if the server dies mid-anomaly.
+    mOutFile.flush();
+}
+
+void IterationJournal::replayIteration(IterationType iter, RequestList const& activeRequests,
+    RequestVector& contextRequests, RequestVector& generationRequests)
+{
+    auto const entryItr = mEntries.find(iter);
+    if (entryItr == mEntries.end())
+    {
+        // Recorded-idle iteration or past the end of the journal: keep the live schedule so the
+        // remaining requests can drain normally.
+        return;
+    }
+    auto const& entry = entryItr->second;
+
+    std::unordered_map<RequestIdType, std::shared_ptr<LlmRequest>> activeById;
+    activeById.reserve(activeRequests.size());
+    for (auto const& llmReq : activeRequests)
+    {
+        activeById.emplace(llmReq->mRequestId, llmReq);
+    }
+
+    contextRequests.clear();
+    generationRequests.clear();
+    CompositionHash hash;
+    hash.update(iter);
+    for (auto const& ctxEntry : entry.contextEntries)
+    {
+        auto const reqItr = activeById.find(ctxEntry.requestId);
+        if (reqItr == activeById.end())
+        {
+            TLLM_LOG_ERROR("Iteration journal replay: context request %lu recorded for iteration %lu is not active",
+                ctxEntry.requestId, iter);
+            continue;
+        }
+        auto const& llmReq = reqItr->second;
+        if (llmReq->getContextCurrentPosition() != ctxEntry.contextPosition)
+        {
+            TLLM_LOG_ERROR(
+                "Iteration journal replay: request %lu is at context position %d, journal expects %d (iteration %lu)",
+                ctxEntry.requestId, llmReq->getContextCurrentPosition(), ctxEntry.contextPosition, iter);
+        }
+        llmReq->setContextChunkSize(ctxEntry.chunkSize);
+        if (ctxEntry.hasSeed)
+        {
+            llmReq->mSamplingConfig.randomSeed = {ctxEntry.seed};
+        }
+        contextRequests.push_back(llmReq);
+        hash.update(ctxEntry.requestId);
+        hash.update(static_cast<uint64_t>(llmReq->getContextCurrentPosition()));
+        hash.update(static_cast<uint64_t>(llmReq->getContextChunkSize()));
+    }
+    for (auto const genId : entry.generationIds)
+    {
+        auto const reqItr = activeById.find(genId);
+        if (reqItr == activeById.end())
+        {
+            TLLM_LOG_ERROR("Iteration journal replay: generation request %lu recorded for iteration %lu is not active",
+                genId, iter);
+            continue;
+        }
+        generationRequests.push_back(reqItr->second);
+        hash.update(genId);
+    }
+    if (hash.digest() != entry.hash)
+    {
+        TLLM_LOG_ERROR(
+            "Iteration journal replay diverged at iteration %lu: composition hash %lx does not match recorded %lx",
+            iter, hash.digest(), entry.hash);
+    }
+}
+
+void IterationJournal::loadJournal(std::string const& path)
+{
+    std::ifstream inFile(path);
+    if (!inFile)
+    {
+        return;
+    }
+    std::string line;
+    while (std::getline(inFile, line))
+    {
+        std::istringstream tokens(line);
+        std::string field;
+        IterationEntry entry{};
+        bool valid = false;
+        while (tokens >> field)
+        {
+            if (field.rfind("iter=", 0) == 0)
+            {
+                entry.iter = std::stoull(field.substr(5));
+                valid = true;
+            }
+            else if (field.rfind("ctx=", 0) == 0)
+            {
+                std::istringstream ctxTokens(field.substr(4));
+                std::string ctxField;
+                while (std::getline(ctxTokens, ctxField, ','))
+                {
+                    ContextEntry ctxEntry{};
+                    std::istringstream parts(ctxField);
+                    std::string part;
+                    std::getline(parts, part, ':');
+                    ctxEntry.requestId = std::stoull(part);
+                    std::getline(parts, part, ':');
+                    ctxEntry.contextPosition = static_cast<SizeType32>(std::stoi(part));
+                    std::getline(parts, part, ':');
+                    ctxEntry.chunkSize = static_cast<SizeType32>(std::stoi(part));
+                    std::getline(parts, part, ':');
+                    if (part != "-")
+                    {
+                        ctxEntry.seed = std::stoull(part);
+                        ctxEntry.hasSeed = true;
+                    }
+                    entry.contextEntries.push_back(ctxEntry);
+                }
+            }
+            else if (field.rfind("gen=", 0) == 0)
+            {
+                std::istringstream genTokens(field.substr(4));
+                std::string genField;
+                while (std::getline(genTokens, genField, ','))
+                {
+                    entry.generationIds.push_back(std::stoull(genField));
+                }
+            }
+            else if (field.rfind("hash=", 0) == 0)
+            {
+                entry.hash = std::stoull(field.substr(5), nullptr, 16);
+            }
+        }
+        if (valid)
+        {
+            mEntries.emplace(entry.iter, std::move(entry));
+        }
+    }
+}
+
+} // namespace tensorrt_llm::batch_manager
@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/batch_manager/common.h"
+#include "tensorrt_llm/batch_manager/llmRequest.h"
+
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::batch_manager
+{
+
+using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+/// @brief Record/replay journal for per-iteration batch composition.
+/// @details In record mode the journal appends one line per iteration with the scheduled context
+/// requests (id, context position, chunk size, sampling seed) and generation requests, plus a hash of
+/// the composition. In replay mode the journal overrides the scheduler output with the recorded sets,
+/// matching requests by id among the active requests and restoring chunk sizes and seeds, so an
+/// anomalous production run can be re-executed with identical batch composition. The recomputed hash
+/// is checked against the journalled one each iteration and divergence is logged with the cause
+/// (e.g. a recorded request that was never resubmitted).
+///
+/// Enabled via TRTLLM_ITER_JOURNAL_RECORD=<path> or TRTLLM_ITER_JOURNAL_REPLAY=<path>. Replay assumes
+/// the same engine and the same request stream (ids, prompts) as the recorded run; only the
+/// scheduling decisions are forced.
+class IterationJournal
+{
+public:
+    using IterationType = executor::IterationType;
+    using RequestIdType = LlmRequest::RequestIdType;
+
+    /// @brief Build a journal from the environment. Returns nullptr when neither record nor replay
+    /// is requested, or when the journal file cannot be opened.
+    static std::unique_ptr<IterationJournal> fromEnv();
+
+    [[nodiscard]] bool isReplaying() const noexcept
+    {
+        return mReplaying;
+    }
+
+    /// @brief Record-mode: append the scheduled batch of this iteration to the journal.
+    void recordIteration(
+        IterationType iter, RequestVector const& contextRequests, RequestVector const& generationRequests);
+
+    /// @brief Replay-mode: replace the scheduler output with the recorded batch for this iteration.
+    /// Requests are matched by id among activeRequests; recorded chunk sizes and sampling seeds are
+    /// restored. Iterations beyond the end of the journal keep the live scheduler output.
+    void replayIteration(IterationType iter, RequestList const& activeRequests, RequestVector& contextRequests,
+        RequestVector& generationRequests);
+
+private:
+    struct ContextEntry
+    {
+        RequestIdType requestId;
+        SizeType32 contextPosition;
+        SizeType32 chunkSize;
+        uint64_t seed;
+        bool hasSeed;
+    };
+
+    struct IterationEntry
+    {
+        IterationType iter;
+        std::vector<ContextEntry> contextEntries;
+        std::vector<RequestIdType> generationIds;
+        uint64_t hash;
+    };
+
+    IterationJournal() = default;
+
+    void loadJournal(std::string const& path);
+
+    bool mReplaying{false};
+    std::ofstream mOutFile;
+    // Replay journal indexed by iteration counter; sparse because idle iterations are not recorded.
+    std::unordered_map<IterationType, IterationEntry> mEntries;
+};
+
+} // namespace tensorrt_llm::batch_manager
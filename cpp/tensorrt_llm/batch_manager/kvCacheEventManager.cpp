@@ -77,11 +77,20 @@ KVCacheEventManager::~KVCacheEventManager()
         mExchangeAttentionDpThread.join();
     }
 #endif
+    // Free any batches the worker did not get to.
+    auto* batch = mPendingBatches.exchange(nullptr, std::memory_order_acquire);
+    while (batch != nullptr)
+    {
+        auto* next = batch->next;
+        delete batch;
+        batch = next;
+    }
 }
 
 void KVCacheEventManager::enqueueCreatedEvent(
     std::vector<SizeType32> const& numBlocksPerCacheLevel, SizeType32 windowSize)
 {
+    std::lock_guard<std::mutex> lck(mEventQueueMutex);
     enqueueEvent({mEventId++, tle::KVCacheCreatedData{numBlocksPerCacheLevel}, windowSize, mAttentionDpRank});
 }
 
@@ -105,11 +114,13 @@ void KVCacheEventManager::enqueueStoredEvent(std::vector<BlockPtr> const& blocks
             block->isPrimary() ? kPrimaryLevel : kSecondaryLevel, block->getPriority());
     }
 
+    std::lock_guard<std::mutex> lck(mEventQueueMutex);
     enqueueEvent({mEventId++, data, windowSize, mAttentionDpRank});
 }
 
 void KVCacheEventManager::enqueueRemovedEvent(BlockPtr const& block, SizeType32 windowSize)
 {
+    std::lock_guard<std::mutex> lck(mEventQueueMutex);
     // We can only batch the removed block events if the same sliding window size is used.
     if (!mEventQueue.empty() && mEventQueue.back().windowSize == windowSize
         && std::holds_alternative<tle::KVCacheRemovedData>(mEventQueue.back().data))
@@ -124,6 +135,7 @@ void KVCacheEventManager::enqueueRemovedEvent(BlockPtr const& block, SizeType32
 
 void KVCacheEventManager::enqueueUpdatedEvent(tle::KVCacheUpdatedData const& data, SizeType32 windowSize)
 {
+    std::lock_guard<std::mutex> lck(mEventQueueMutex);
     enqueueEvent({mEventId++, data, windowSize, mAttentionDpRank});
 }
 
@@ -151,9 +163,19 @@ std::deque<tle::KVCacheEvent> KVCacheEventManager::getEvents(std::optional<std::
 
 void KVCacheEventManager::flush()
 {
-    auto eventQueue = std::exchange(mEventQueue, {});
-    std::unique_lock<std::mutex> lck(mPendingEventsMutex);
-    mPendingEvents.push_back(std::move(eventQueue));
+    // Lock-free push onto the pending list: the forward pass thread only pays for one allocation
+    // and one atomic exchange here, never for a mutex shared with the worker or event consumers.
+    // mEventQueueMutex is uncontended here; the per-window enqueues have finished by flush time.
+    auto* batch = [this]
+    {
+        std::lock_guard<std::mutex> lck(mEventQueueMutex);
+        return new EventBatch{std::exchange(mEventQueue, {}), nullptr};
+    }();
+    batch->next = mPendingBatches.load(std::memory_order_relaxed);
+    while (!mPendingBatches.compare_exchange_weak(
+        batch->next, batch, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
     mPendingEmptyCV.notify_one();
 }
 
@@ -177,14 +199,14 @@ void KVCacheEventManager::exchangeAttentionDpThread()
         // If we are not rank 0, send events to rank 0
         if (mAttentionDpRank.value() != 0)
         {
-            std::vector<char> serializedEvents;
-            uint64_t numEvents = 0;
+            std::deque<tle::KVCacheEvent> eventsToSend;
             {
                 std::lock_guard<std::mutex> lck(mEventsMutex);
-                serializedEvents = executor::Serialization::serialize(mEvents);
-                numEvents = mEvents.size();
-                mEvents.clear();
+                eventsToSend = std::exchange(mEvents, {});
             }
+            // Serialize outside the lock so the worker and getEvents() are not stalled behind it.
+            auto const serializedEvents = executor::Serialization::serialize(eventsToSend);
+            uint64_t const numEvents = eventsToSend.size();
             uint64_t vecSize = numEvents > 0 ? serializedEvents.size() : 0;
             mMpiComm->send(&vecSize, 1, mpi::MpiType::kUINT64, 0, mpi::MpiTag::kKvCacheEventSize);
             if (vecSize > 0)
@@ -229,33 +251,62 @@ void KVCacheEventManager::worker()
 
     while (true)
     {
-        std::deque<tle::KVCacheEvent> events;
         {
-            std::unique_lock<std::mutex> pendingLock(mPendingEventsMutex);
-            mPendingEmptyCV.wait(pendingLock, [this] { return !mPendingEvents.empty() || !mRun; });
+            std::unique_lock<std::mutex> wakeupLock(mPendingWakeupMutex);
+            mPendingEmptyCV.wait(wakeupLock,
+                [this] { return mPendingBatches.load(std::memory_order_acquire) != nullptr || !mRun; });
             if (!mRun)
             {
                 return;
             }
-            events = mPendingEvents.front();
-            mPendingEvents.pop_front();
         }
 
-        std::unique_lock<std::mutex> lck(mEventsMutex);
-
-        SizeType32 elementsToRemove = mEvents.size() + events.size() - mMaxSize;
+        auto* head = mPendingBatches.exchange(nullptr, std::memory_order_acquire);
+        if (head == nullptr)
+        {
+            continue;
+        }
+        // The list is newest first; reverse it so batches are appended in flush order.
+        EventBatch* batches = nullptr;
+        while (head != nullptr)
+        {
+            auto* next = head->next;
+            head->next = batches;
+            batches = head;
+            head = next;
+        }
 
-        // First, take elements from mEvents since they are the oldest.
-        if (elementsToRemove > 0)
+        std::unique_lock<std::mutex> lck(mEventsMutex);
+        while (batches != nullptr)
         {
-            SizeType32 numRemoved = std::min(static_cast<SizeType32>(mEvents.size()), elementsToRemove);
-            mEvents.erase(mEvents.begin(), mEvents.begin() + numRemoved);
-            elementsToRemove -= numRemoved;
-            TLLM_LOG_WARNING("The event queue has reached the max size of %d. Events have been discarded.", mMaxSize);
+            for (auto& event : batches->events)
+            {
+                // Coalesce adjacent removed-block events of the same window size across flush
+                // boundaries, so a burst of evictions yields one event carrying many hashes.
+                if (!mEvents.empty() && mEvents.back().windowSize == event.windowSize
+                    && std::holds_alternative<tle::KVCacheRemovedData>(mEvents.back().data)
+                    && std::holds_alternative<tle::KVCacheRemovedData>(event.data))
+                {
+                    auto& backHashes = std::get<tle::KVCacheRemovedData>(mEvents.back().data).blockHashes;
+                    auto& eventHashes = std::get<tle::KVCacheRemovedData>(event.data).blockHashes;
+                    backHashes.insert(backHashes.end(), eventHashes.begin(), eventHashes.end());
+                }
+                else
+                {
+                    mEvents.push_back(std::move(event));
+                }
+            }
+            auto* next = batches->next;
+            delete batches;
+            batches = next;
         }
 
-        // If there's still too many events, take from the front of the events queue.
-        mEvents.insert(mEvents.end(), events.begin() + std::max(0, elementsToRemove), events.end());
+        // Drop the oldest events when the queue overflows.
+        if (mEvents.size() > mMaxSize)
+        {
+            mEvents.erase(mEvents.begin(), mEvents.begin() + (mEvents.size() - mMaxSize));
+            TLLM_LOG_WARNING("The event queue has reached the max size of %zu. Events have been discarded.", mMaxSize);
+        }
 
         // Notify the empty condition variable to wake up any waiting threads
         mEmptyCV.notify_one();
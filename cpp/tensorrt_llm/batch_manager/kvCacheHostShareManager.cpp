@@ -0,0 +1,454 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/kvCacheHostShareManager.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+
+namespace tr = tensorrt_llm::runtime;
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+namespace
+{
+
+constexpr uint32_t kSegmentMagic = 0x4b565348; // "KVSH"
+constexpr uint32_t kSegmentVersion = 1;
+constexpr uint32_t kNumEntries = 1u << 16;
+constexpr uint32_t kProbeWindow = 8;
+constexpr uint32_t kInvalidReplica = 0xFFFFFFFFu;
+
+//! \brief Fold a value into a running hash (boost-style combine).
+uint64_t combineHash(uint64_t seed, uint64_t value)
+{
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+//! \brief Lock a process-shared robust mutex, recovering it if the previous owner died.
+void lockRobust(pthread_mutex_t* mutex)
+{
+    int const rc = pthread_mutex_lock(mutex);
+    if (rc == EOWNERDEAD)
+    {
+        // A replica died while holding the lock. The index only caches hints that are
+        // re-validated on use, so marking the mutex consistent is safe.
+        pthread_mutex_consistent(mutex);
+        return;
+    }
+    TLLM_CHECK_WITH_INFO(rc == 0, "Failed to lock KV cache share segment mutex: %s", strerror(rc));
+}
+
+//! \brief RAII guard for the segment mutex.
+class SegmentLock
+{
+public:
+    explicit SegmentLock(pthread_mutex_t* mutex)
+        : mMutex(mutex)
+    {
+        lockRobust(mMutex);
+    }
+
+    ~SegmentLock()
+    {
+        pthread_mutex_unlock(mMutex);
+    }
+
+    SegmentLock(SegmentLock const&) = delete;
+    SegmentLock& operator=(SegmentLock const&) = delete;
+
+private:
+    pthread_mutex_t* mMutex;
+};
+
+} // namespace
+
+struct KVCacheHostShareManager::SegmentHeader
+{
+    struct ReplicaInfo
+    {
+        uint32_t valid;
+        uint32_t numPools;
+        uint64_t poolBlockBytes[kMaxPools];
+        cudaIpcMemHandle_t poolHandles[kMaxPools];
+    };
+
+    struct IndexEntry
+    {
+        uint64_t hash;
+        // Bumped whenever the slot's contents are retracted or replaced; readers re-validate
+        // against their snapshot after copying.
+        uint32_t generation;
+        uint32_t replica; // kInvalidReplica when the slot is empty
+        uint32_t blockIdx;
+    };
+
+    // Set last during initialization; joiners wait for it before touching the segment.
+    std::atomic<uint32_t> magic;
+    uint32_t version;
+    pthread_mutex_t mutex;
+    // Geometry signature of the registered pools; written by the first replica, checked by joiners.
+    uint64_t geometryHash;
+    uint32_t numActiveReplicas;
+    ReplicaInfo replicas[kMaxReplicas];
+    IndexEntry entries[kNumEntries];
+};
+
+std::shared_ptr<KVCacheHostShareManager> KVCacheHostShareManager::createFromEnv(std::string const& logPrefix)
+{
+    auto const& segment = common::getEnvKVCacheHostShareSegment();
+    if (segment.empty())
+    {
+        return nullptr;
+    }
+    return std::make_shared<KVCacheHostShareManager>(segment, logPrefix);
+}
+
+KVCacheHostShareManager::KVCacheHostShareManager(std::string const& segmentName, std::string logPrefix)
+    : mSegmentName("/trtllm_kvshare_" + segmentName)
+    , mLogPrefix(std::move(logPrefix))
+{
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "segment magic must be lock-free");
+
+    bool creator = true;
+    mShmFd = shm_open(mSegmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (mShmFd < 0 && errno == EEXIST)
+    {
+        creator = false;
+        mShmFd = shm_open(mSegmentName.c_str(), O_RDWR, 0600);
+    }
+    TLLM_CHECK_WITH_INFO(
+        mShmFd >= 0, "Failed to open KV cache share segment %s: %s", mSegmentName.c_str(), strerror(errno));
+
+    auto const segmentBytes = sizeof(SegmentHeader);
+    if (creator)
+    {
+        TLLM_CHECK_WITH_INFO(ftruncate(mShmFd, static_cast<off_t>(segmentBytes)) == 0,
+            "Failed to size KV cache share segment %s: %s", mSegmentName.c_str(), strerror(errno));
+    }
+
+    auto* mapped = mmap(nullptr, segmentBytes, PROT_READ | PROT_WRITE, MAP_SHARED, mShmFd, 0);
+    TLLM_CHECK_WITH_INFO(
+        mapped != MAP_FAILED, "Failed to map KV cache share segment %s: %s", mSegmentName.c_str(), strerror(errno));
+    mHeader = static_cast<SegmentHeader*>(mapped);
+
+    if (creator)
+    {
+        mHeader->version = kSegmentVersion;
+        mHeader->geometryHash = 0;
+        mHeader->numActiveReplicas = 0;
+        for (auto& replica : mHeader->replicas)
+        {
+            replica.valid = 0;
+        }
+        for (auto& entry : mHeader->entries)
+        {
+            entry.replica = kInvalidReplica;
+            entry.generation = 0;
+        }
+
+        pthread_mutexattr_t attr;
+        pthread_mutexattr_init(&attr);
+        pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+        pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+        pthread_mutex_init(&mHeader->mutex, &attr);
+        pthread_mutexattr_destroy(&attr);
+
+        mHeader->magic.store(kSegmentMagic, std::memory_order_release);
+    }
+    else
+    {
+        // Wait until the creator has finished initializing the segment.
+        auto constexpr kTimeout = std::chrono::seconds(10);
+        auto const deadline = std::chrono::steady_clock::now() + kTimeout;
+        while (mHeader->magic.load(std::memory_order_acquire) != kSegmentMagic)
+        {
+            TLLM_CHECK_WITH_INFO(std::chrono::steady_clock::now() < deadline,
+                "Timed out waiting for KV cache share segment %s to be initialized", mSegmentName.c_str());
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        TLLM_CHECK_WITH_INFO(mHeader->version == kSegmentVersion,
+            "KV cache share segment %s has version %u, expected %u", mSegmentName.c_str(), mHeader->version,
+            kSegmentVersion);
+    }
+
+    TLLM_LOG_INFO("%s KV cache host sharing enabled: segment=%s (%s)", mLogPrefix.c_str(), mSegmentName.c_str(),
+        creator ? "created" : "joined");
+}
+
+KVCacheHostShareManager::~KVCacheHostShareManager()
+{
+    if (mHeader != nullptr)
+    {
+        bool unlink = false;
+        {
+            SegmentLock lock(&mHeader->mutex);
+            if (mReplicaSlot >= 0)
+            {
+                // Withdraw every entry this replica published; the exported pool goes away.
+                for (auto& entry : mHeader->entries)
+                {
+                    if (entry.replica == static_cast<uint32_t>(mReplicaSlot))
+                    {
+                        ++entry.generation;
+                        entry.replica = kInvalidReplica;
+                    }
+                }
+                mHeader->replicas[mReplicaSlot].valid = 0;
+                unlink = --mHeader->numActiveReplicas == 0;
+            }
+        }
+        for (auto& replicaPools : mPeerPools)
+        {
+            for (auto* ptr : replicaPools)
+            {
+                if (ptr != nullptr)
+                {
+                    cudaIpcCloseMemHandle(ptr);
+                }
+            }
+        }
+        munmap(mHeader, sizeof(SegmentHeader));
+        if (unlink)
+        {
+            shm_unlink(mSegmentName.c_str());
+        }
+    }
+    if (mShmFd >= 0)
+    {
+        close(mShmFd);
+    }
+}
+
+bool KVCacheHostShareManager::registerLocalPools(
+    std::vector<KVCacheBlockPool> const& pools, SizeType32 numPrimaryBlocks, SizeType32 windowSize,
+    SizeType32 tokensPerBlock)
+{
+    TLLM_CHECK_WITH_INFO(mReplicaSlot < 0, "KV cache share pools are already registered");
+    if (pools.size() > kMaxPools)
+    {
+        TLLM_LOG_WARNING("%s KV cache host sharing disabled: %zu pools exceed the supported maximum of %u",
+            mLogPrefix.c_str(), pools.size(), kMaxPools);
+        return false;
+    }
+
+    std::vector<uint64_t> poolBlockBytes(pools.size());
+    auto geometry = combineHash(combineHash(0, static_cast<uint64_t>(windowSize)), static_cast<uint64_t>(tokensPerBlock));
+    for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
+    {
+        auto const& pool = pools[poolIdx];
+        poolBlockBytes[poolIdx] = pool.primaryPtr->getSizeInBytes() / static_cast<size_t>(numPrimaryBlocks);
+        geometry = combineHash(geometry, poolBlockBytes[poolIdx]);
+        geometry = combineHash(geometry, static_cast<uint64_t>(pool.primaryPtr->getDataType()));
+    }
+
+    SegmentLock lock(&mHeader->mutex);
+    if (mHeader->geometryHash == 0)
+    {
+        mHeader->geometryHash = geometry;
+    }
+    else if (mHeader->geometryHash != geometry)
+    {
+        TLLM_LOG_WARNING("%s KV cache host sharing disabled: pool geometry differs from registered replicas",
+            mLogPrefix.c_str());
+        return false;
+    }
+
+    int32_t slot = -1;
+    for (uint32_t candidate = 0; candidate < kMaxReplicas; ++candidate)
+    {
+        if (mHeader->replicas[candidate].valid == 0)
+        {
+            slot = static_cast<int32_t>(candidate);
+            break;
+        }
+    }
+    if (slot < 0)
+    {
+        TLLM_LOG_WARNING("%s KV cache host sharing disabled: replica table is full", mLogPrefix.c_str());
+        return false;
+    }
+
+    auto& replica = mHeader->replicas[slot];
+    replica.numPools = static_cast<uint32_t>(pools.size());
+    for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
+    {
+        replica.poolBlockBytes[poolIdx] = poolBlockBytes[poolIdx];
+        TLLM_CUDA_CHECK(cudaIpcGetMemHandle(&replica.poolHandles[poolIdx], pools[poolIdx].primaryPtr->data()));
+    }
+    replica.valid = 1;
+    ++mHeader->numActiveReplicas;
+    mReplicaSlot = slot;
+    TLLM_LOG_INFO("%s Registered KV cache pools as replica %d in segment %s", mLogPrefix.c_str(), slot,
+        mSegmentName.c_str());
+    return true;
+}
+
+void KVCacheHostShareManager::publish(size_t hash, SizeType32 poolBlockIdx)
+{
+    if (mReplicaSlot < 0)
+    {
+        return;
+    }
+    SegmentLock lock(&mHeader->mutex);
+    auto const base = static_cast<uint32_t>(hash % kNumEntries);
+    SegmentHeader::IndexEntry* victim = nullptr;
+    for (uint32_t probe = 0; probe < kProbeWindow; ++probe)
+    {
+        auto& entry = mHeader->entries[(base + probe) % kNumEntries];
+        if (entry.replica == static_cast<uint32_t>(mReplicaSlot) && entry.hash == hash)
+        {
+            victim = &entry;
+            break;
+        }
+        if (victim == nullptr && entry.replica == kInvalidReplica)
+        {
+            victim = &entry;
+        }
+    }
+    if (victim == nullptr)
+    {
+        // Probe window is full; clobber the home slot. The index is a cache of hints, losing
+        // an older entry only costs a recompute on some other replica.
+        victim = &mHeader->entries[base];
+    }
+    ++victim->generation;
+    victim->hash = hash;
+    victim->replica = static_cast<uint32_t>(mReplicaSlot);
+    victim->blockIdx = static_cast<uint32_t>(poolBlockIdx);
+}
+
+void KVCacheHostShareManager::retract(size_t hash)
+{
+    if (mReplicaSlot < 0)
+    {
+        return;
+    }
+    SegmentLock lock(&mHeader->mutex);
+    auto const base = static_cast<uint32_t>(hash % kNumEntries);
+    for (uint32_t probe = 0; probe < kProbeWindow; ++probe)
+    {
+        auto& entry = mHeader->entries[(base + probe) % kNumEntries];
+        if (entry.replica == static_cast<uint32_t>(mReplicaSlot) && entry.hash == hash)
+        {
+            ++entry.generation;
+            entry.replica = kInvalidReplica;
+            return;
+        }
+    }
+}
+
+void* KVCacheHostShareManager::peerPoolPtr(uint32_t replica, uint32_t poolIdx)
+{
+    std::lock_guard<std::mutex> lock(mPeerPoolsMutex);
+    auto& ptr = mPeerPools[replica][poolIdx];
+    if (ptr == nullptr)
+    {
+        TLLM_CUDA_CHECK(cudaIpcOpenMemHandle(
+            &ptr, mHeader->replicas[replica].poolHandles[poolIdx], cudaIpcMemLazyEnablePeerAccess));
+    }
+    return ptr;
+}
+
+bool KVCacheHostShareManager::onboard(size_t hash, BlockPtr const& dst, std::vector<KVCacheBlockPool> const& pools,
+    runtime::BufferManager const& bufferManager)
+{
+    if (mReplicaSlot < 0)
+    {
+        return false;
+    }
+
+    uint32_t entryIdx = 0;
+    uint32_t generation = 0;
+    uint32_t replica = 0;
+    uint32_t blockIdx = 0;
+    {
+        SegmentLock lock(&mHeader->mutex);
+        auto const base = static_cast<uint32_t>(hash % kNumEntries);
+        bool found = false;
+        for (uint32_t probe = 0; probe < kProbeWindow; ++probe)
+        {
+            auto const idx = (base + probe) % kNumEntries;
+            auto const& entry = mHeader->entries[idx];
+            // Entries owned by this replica are only consulted by peers; a local lookup that
+            // reached this point already missed the radix tree, so the entry must be stale.
+            if (entry.replica != kInvalidReplica && entry.hash == hash
+                && entry.replica != static_cast<uint32_t>(mReplicaSlot)
+                && mHeader->replicas[entry.replica].valid != 0)
+            {
+                entryIdx = idx;
+                generation = entry.generation;
+                replica = entry.replica;
+                blockIdx = entry.blockIdx;
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+        {
+            return false;
+        }
+        if (mHeader->replicas[replica].numPools != pools.size())
+        {
+            return false;
+        }
+    }
+
+    for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
+    {
+        auto const& pool = pools[poolIdx];
+        auto dstTensor = tr::ITensor::slice(pool.primaryPtr, dst->getMemoryPoolBlockIndex(), 1);
+        auto const numBytes = dstTensor->getSizeInBytes();
+        if (numBytes != mHeader->replicas[replica].poolBlockBytes[poolIdx])
+        {
+            return false;
+        }
+        auto const* src = static_cast<char const*>(peerPoolPtr(replica, poolIdx))
+            + static_cast<size_t>(blockIdx) * numBytes;
+        TLLM_CUDA_CHECK(
+            cudaMemcpyAsync(dstTensor->data(), src, numBytes, cudaMemcpyDefault, bufferManager.getStream().get()));
+    }
+    // The entry is only trustworthy if it survived the whole copy: owners bump the generation
+    // before the published contents can change, so finish the copy and re-validate.
+    bufferManager.getStream().synchronize();
+
+    SegmentLock lock(&mHeader->mutex);
+    auto const& entry = mHeader->entries[entryIdx];
+    if (entry.replica != replica || entry.hash != hash || entry.generation != generation)
+    {
+        TLLM_LOG_DEBUG("%s Discarded stale peer KV block %zx from replica %u", mLogPrefix.c_str(), hash, replica);
+        return false;
+    }
+    TLLM_LOG_DEBUG("%s Onboarded KV block %zx from replica %u", mLogPrefix.c_str(), hash, replica);
+    return true;
+}
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -19,9 +19,13 @@
 
 #include "tensorrt_llm/batch_manager/common.h"
 #include "tensorrt_llm/batch_manager/evictionPolicy.h"
+#include "tensorrt_llm/batch_manager/kvCacheHostShareManager.h"
+#include "tensorrt_llm/batch_manager/kvCachePrefixDigest.h"
+#include "tensorrt_llm/batch_manager/kvCacheSpillManager.h"
 #include "tensorrt_llm/batch_manager/kvCacheTransferManager.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/executor/executor.h"
@@ -31,9 +35,13 @@
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
+#include "tensorrt_llm/runtime/workerPool.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <future>
 #include <map>
 #include <optional>
 #include <utility>
@@ -176,6 +184,11 @@ bool BlockKey::operator==(BlockKey const& other) const noexcept
 
 size_t BlockKeyHasher::hash(BlockKey const& blockKey, std::size_t parentHash) noexcept
 {
+    if (parentHash == 0 && blockKey.cachedHash)
+    {
+        return *blockKey.cachedHash;
+    }
+
     // Hashing algorithm adapted from StackOverflow:
     // https://stackoverflow.com/questions/664014/what-integer-hash-function-are-good-that-accepts-an-integer-hash-key
     // Constants provide very good distribution - each input bit affects each output bit with ~50% probability.
@@ -246,6 +259,10 @@ size_t BlockKeyHasher::hash(BlockKey const& blockKey, std::size_t parentHash) no
         }
     }
 
+    if (parentHash == 0)
+    {
+        blockKey.cachedHash = seed;
+    }
     return seed;
 }
 
@@ -548,6 +565,7 @@ BlockManager::BlockManager(std::vector<SizeType32> const& numKvHeadsPerLayer, Si
     : mNumLayers{static_cast<SizeType32>(numKvHeadsPerLayer.size())}
     , mTokensPerBlock{tokensPerBlock}
     , mEventManager{std::move(eventManager)}
+    , mPrefixDigest{std::make_shared<KVCachePrefixDigest>()}
     , mStream{stream}
     , mCacheType{cacheType}
 {
@@ -584,7 +602,8 @@ BlockManager::BlockManager(std::vector<SizeType32> const& numKvHeadsPerLayer, Si
         mWindowBlockManagers.try_emplace(windowSize, dtype, windowSize, layersWithWindowSize, numKvHeadsPerLayer,
             sizePerHead, tokensPerBlock, /*isSWA=*/windowSize < maxSequenceLength, allottedPrimaryBlocks,
             allottedSecondaryBlocks, maxNumSequences, stream, onboardBlocks, cacheType, secondaryOffloadMinPriority,
-            mEventManager, enablePartialReuse, copyOnPartialReuse, kvCacheConnectorManager, mLoopbackAgent);
+            mEventManager, mPrefixDigest, enablePartialReuse, copyOnPartialReuse, kvCacheConnectorManager,
+            mLoopbackAgent);
     }
 
     auto const numAllPools = getNumPools();
@@ -632,6 +651,42 @@ BlockManager::BlockManager(std::vector<SizeType32> const& numKvHeadsPerLayer, Si
                 [](auto const& window1, auto const& window2) { return window1.first == window2.first; }),
         "Iteration order of window sizes between mWindowBlockManagers and mWindowSizeToMetadata *must* be ensured. "
         "Maybe you tried changing either of them to an std::unordered_map?");
+
+    if (mWindowBlockManagers.size() > 1)
+    {
+        // Multi-window (VSWA) models pay the block bookkeeping once per window size. Fan the
+        // per-window work out so it costs roughly one window; the calling thread handles the first
+        // window, so one worker per extra window suffices.
+        mWindowWorkerPool = std::make_shared<runtime::WorkerPool>(mWindowBlockManagers.size() - 1, tc::getDevice());
+    }
+}
+
+void BlockManager::runPerWindow(std::function<void(size_t windowIdx, WindowBlockManager&)> const& task)
+{
+    if (!mWindowWorkerPool)
+    {
+        size_t windowIdx = 0;
+        for (auto& [_, manager] : mWindowBlockManagers)
+        {
+            task(windowIdx++, manager);
+        }
+        return;
+    }
+    std::vector<std::future<void>> futures;
+    futures.reserve(mWindowBlockManagers.size() - 1);
+    auto managerItr = mWindowBlockManagers.begin();
+    size_t windowIdx = 1;
+    for (auto workerItr = std::next(managerItr); workerItr != mWindowBlockManagers.end(); ++workerItr, ++windowIdx)
+    {
+        auto* managerPtr = &workerItr->second;
+        futures.emplace_back(mWindowWorkerPool->enqueue([task, windowIdx, managerPtr] { task(windowIdx, *managerPtr); }));
+    }
+    task(0, managerItr->second);
+    // get() rethrows any worker exception on the calling thread.
+    for (auto& future : futures)
+    {
+        future.get();
+    }
 }
 
 WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 windowSize,
@@ -639,7 +694,8 @@ WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 wind
     SizeType32 sizePerHead, SizeType32 tokensPerBlock, bool isSWA, SizeType32 blocksInPrimaryPool,
     SizeType32 blocksInSecondaryPool, SizeType32 maxNumSequences, std::shared_ptr<runtime::CudaStream> stream,
     bool onboardBlocks, CacheType cacheType, std::optional<executor::RetentionPriority> secondaryOffloadMinPriority,
-    std::shared_ptr<KVCacheEventManager> eventManager, bool enablePartialReuse, bool copyOnPartialReuse,
+    std::shared_ptr<KVCacheEventManager> eventManager, std::shared_ptr<KVCachePrefixDigest> prefixDigest,
+    bool enablePartialReuse, bool copyOnPartialReuse,
     std::shared_ptr<kv_connector::KvCacheConnectorManager> kvCacheConnectorManager,
     std::shared_ptr<kvc::BaseLoopbackAgent> loopbackAgent)
     : mDataType{dtype}
@@ -654,6 +710,7 @@ WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 wind
     , mCachedBlocksRoot{std::make_shared<KVCacheBlock>(KVCacheBlock::kCachedBlocksRootId, tk::KVCacheIndex{0})}
     , mCacheType{cacheType}
     , mEventManager(std::move(eventManager))
+    , mPrefixDigest(std::move(prefixDigest))
     , mLoopbackAgent{loopbackAgent}
     , mTransferManager{std::make_shared<KVCacheTransferManager>(mBufferManager, mLoopbackAgent)}
     , mAllocTotalBlocks{0}
@@ -723,9 +780,18 @@ WindowBlockManager::WindowBlockManager(nvinfer1::DataType dtype, SizeType32 wind
     }
     mAllocatedBlocksPerSeq.reserve(maxNumSequences);
 
-    mEvictionPolicy = std::make_shared<LRUEvictionPolicy>();
+    if (tc::getEnvKVCacheAdaptiveEviction())
+    {
+        mEvictionPolicy = std::make_shared<AdaptiveEvictionPolicy>();
+    }
+    else
+    {
+        mEvictionPolicy = std::make_shared<LRUEvictionPolicy>();
+    }
     mEvictionPolicy->initialize(
         mAllBlocksById, {blocksInPrimaryPool, blocksInSecondaryPool}, secondaryOffloadMinPriority);
+    mSpillManager = KVCacheSpillManager::createFromEnv(mLogPrefix);
+    mShareManager = KVCacheHostShareManager::createFromEnv(mLogPrefix);
     if (mEventManager)
     {
         mEventManager->enqueueCreatedEvent({blocksInPrimaryPool, blocksInSecondaryPool}, mWindowSize);
@@ -766,22 +832,23 @@ bool WindowBlockManager::verifyQueueIntegrity()
 void BlockManager::storeContextBlocks(GenerationRequest& sequence, LlmRequest const& llmRequest)
 {
     constexpr int beamIdx = 0; // no need to consider more than one beam for input tokens
-    for (auto const& [windowSize, _] : mWindowBlockManagers)
-    {
-        if (mWindowBlockManagers.at(windowSize).isSWA())
+    runPerWindow(
+        [&](size_t /*windowIdx*/, WindowBlockManager& manager)
         {
-            // SWA cannot store new blocks on the fly because the block stored
-            // may go OOW and be reused by another sequence.
-            continue;
-        }
-        auto cacheBlockIds = sequence.getCacheBlockIds(windowSize);
-        auto const& uniqueTokens = llmRequest.getUniqueTokens(beamIdx);
+            if (manager.isSWA())
+            {
+                // SWA cannot store new blocks on the fly because the block stored
+                // may go OOW and be reused by another sequence.
+                return;
+            }
+            auto cacheBlockIds = sequence.getCacheBlockIds(manager.getWindowSize());
+            auto const& uniqueTokens = llmRequest.getUniqueTokens(beamIdx);
 
-        auto blockedUniqueTokens
-            = chopVectorIntoBlocks<UniqueToken>(uniqueTokens, uniqueTokens.size() - 1, getTokensPerBlock(), false);
-        auto blockKeys = buildBlockKeys(blockedUniqueTokens, llmRequest);
-        (void) mWindowBlockManagers.at(windowSize).storeBlocks(std::move(blockKeys), cacheBlockIds[beamIdx]);
-    }
+            auto blockedUniqueTokens
+                = chopVectorIntoBlocks<UniqueToken>(uniqueTokens, uniqueTokens.size() - 1, getTokensPerBlock(), false);
+            auto blockKeys = buildBlockKeys(blockedUniqueTokens, llmRequest);
+            (void) manager.storeBlocks(std::move(blockKeys), cacheBlockIds[beamIdx]);
+        });
 }
 
 void WindowBlockManager::createBlockScalePools(SizeType32 quantBlockSize)
@@ -804,9 +871,36 @@ void WindowBlockManager::createBlockScalePools(SizeType32 quantBlockSize)
 
 void BlockManager::allocatePools(bool useUvm)
 {
-    for (auto& [_, manager] : mWindowBlockManagers)
+    // Allocation time is dominated by synchronous cudaMalloc/cudaHostAlloc calls, so for
+    // variable-window models the window sizes are allocated from one thread each to shorten
+    // cold start.
+    if (mWindowBlockManagers.size() > 1)
     {
-        manager.allocatePools(useUvm);
+        auto const device = tc::getDevice();
+        std::vector<std::future<void>> futures;
+        futures.reserve(mWindowBlockManagers.size());
+        for (auto& [windowSize, manager] : mWindowBlockManagers)
+        {
+            auto* managerPtr = &manager;
+            futures.emplace_back(std::async(std::launch::async,
+                [managerPtr, useUvm, device]()
+                {
+                    TLLM_CUDA_CHECK(cudaSetDevice(device));
+                    managerPtr->allocatePools(useUvm);
+                }));
+        }
+        // get() rethrows any allocation failure on the calling thread.
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+    else
+    {
+        for (auto& [_, manager] : mWindowBlockManagers)
+        {
+            manager.allocatePools(useUvm);
+        }
     }
 }
 
@@ -816,7 +910,7 @@ void WindowBlockManager::allocatePools(bool useUvm)
 
     // Allocate a memory pool backing the blocks for each numKvHeads
     // TODO(oargov): allocate pools in a single buffer and split it, to avoid fragmentation
-    for (auto& pool : mPools)
+    auto const allocateOnePool = [this, useUvm, kScaleDtypeNVFP4](KVCacheBlockPool& pool)
     {
         auto blockSize = pool.blockSize;
         auto poolDtype = pool.containsBlockScales ? kScaleDtypeNVFP4 : mDataType;
@@ -850,6 +944,42 @@ void WindowBlockManager::allocatePools(bool useUvm)
                 mLogPrefix.c_str(), mNumSecondaryBlocks, pool.numLayers, pool.numKvHeads);
             pool.secondaryPtr = BufferManager::pinned(cacheShapeOffload, poolDtype);
         }
+    };
+
+    if (mPools.size() > 1)
+    {
+        // Models with several pools (variable GQA, FP4 block scales) spend most of the allocation
+        // time inside the driver; allocating the pools concurrently overlaps that cost.
+        auto const device = tc::getDevice();
+        std::vector<std::future<void>> futures;
+        futures.reserve(mPools.size());
+        for (auto& pool : mPools)
+        {
+            auto* poolPtr = &pool;
+            futures.emplace_back(std::async(std::launch::async,
+                [&allocateOnePool, poolPtr, device]()
+                {
+                    TLLM_CUDA_CHECK(cudaSetDevice(device));
+                    allocateOnePool(*poolPtr);
+                }));
+        }
+        for (auto& future : futures)
+        {
+            future.get();
+        }
+    }
+    else
+    {
+        for (auto& pool : mPools)
+        {
+            allocateOnePool(pool);
+        }
+    }
+
+    if (mShareManager
+        && !mShareManager->registerLocalPools(mPools, mNumPrimaryBlocks, mWindowSize, mTokensPerBlock))
+    {
+        mShareManager.reset();
     }
 }
 
@@ -919,6 +1049,10 @@ void WindowBlockManager::freeChildren(BlockPtr const& block)
     {
         mEventManager->enqueueRemovedEvent(block, mWindowSize);
     }
+    if (mPrefixDigest && blockInRadixTree(block))
+    {
+        mPrefixDigest->remove(block->getHash());
+    }
     freeLeafBlock(block);
 }
 
@@ -943,10 +1077,20 @@ BlockPtr WindowBlockManager::getFreeBlock(GenerationRequest& sequence, executor:
     {
         // Offload block in primary memory before repurposing
         auto offloadBlock = std::get<0>(mEvictionPolicy->getFreeBlock(kSecondaryLevel));
+        if (mSpillManager)
+        {
+            // The secondary victim's contents are overwritten below; preserve them on the spill tier.
+            mSpillManager->spill(offloadBlock, mPools);
+        }
         mTransferManager->offload(block, offloadBlock, mPools, 0, mode, directory);
         // swap linear block offsets (i.e. make block the offload block)
         block->swapMemoryPoolBlockOffset(offloadBlock);
 
+        if (mShareManager)
+        {
+            // The block left the IPC-exported primary pool; peers must not copy from its old slot.
+            mShareManager->retract(block->getHash());
+        }
         if (mEventManager && blockInRadixTree(block))
         {
             mEventManager->enqueueUpdatedEvent(
@@ -961,6 +1105,11 @@ BlockPtr WindowBlockManager::getFreeBlock(GenerationRequest& sequence, executor:
         block = offloadBlock;
     }
 
+    if (mShareManager)
+    {
+        // The claimed block's contents are about to be overwritten.
+        mShareManager->retract(block->getHash());
+    }
     // Removes children of the block from the search tree
     freeChildren(block);
     // Claim the block in primary block queue
@@ -1072,12 +1221,22 @@ void WindowBlockManager::offloadBlock(
     {
         // Offload block in primary memory before repurposing
         auto offloadBlock = std::get<0>(mEvictionPolicy->getFreeBlock(kSecondaryLevel));
+        if (mSpillManager)
+        {
+            // The secondary victim's contents are overwritten below; preserve them on the spill tier.
+            mSpillManager->spill(offloadBlock, mPools);
+        }
         // If we're swapping a block to secondary memory, maintain the prior priority values.
         mEvictionPolicy->claimBlock(offloadBlock);
         mTransferManager->offload(block, offloadBlock, mPools, 0, mode, directory);
         // swap linear block offsets (i.e. make block the offload block)
         block->swapMemoryPoolBlockOffset(offloadBlock);
 
+        if (mShareManager)
+        {
+            // The block left the IPC-exported primary pool; peers must not copy from its old slot.
+            mShareManager->retract(block->getHash());
+        }
         if (mEventManager && blockInRadixTree(block))
         {
             mEventManager->enqueueUpdatedEvent(
@@ -1089,6 +1248,243 @@ void WindowBlockManager::offloadBlock(
     }
 }
 
+std::map<SizeType32, KvCacheFragmentationStats> BlockManager::calculateFragmentationStats() const
+{
+    std::map<SizeType32, KvCacheFragmentationStats> fragmentationStats;
+    for (auto const& [windowSize, manager] : mWindowBlockManagers)
+    {
+        fragmentationStats[windowSize] = manager.calculateFragmentationStats();
+    }
+    return fragmentationStats;
+}
+
+SizeType32 BlockManager::compactSecondaryPools(SizeType32 maxBlocksToMove)
+{
+    SizeType32 numMoved = 0;
+    for (auto& [windowSize, manager] : mWindowBlockManagers)
+    {
+        if (numMoved >= maxBlocksToMove)
+        {
+            break;
+        }
+        numMoved += manager.compactSecondaryPool(maxBlocksToMove - numMoved);
+    }
+    return numMoved;
+}
+
+namespace
+{
+//! \brief Accumulate free-run statistics of one pool level from its slot occupancy map.
+void analyzeFreeRuns(
+    std::vector<bool> const& freeSlots, SizeType32& numFree, SizeType32& largestRun, std::vector<SizeType32>& histogram)
+{
+    auto const commitRun = [&largestRun, &histogram](SizeType32 runLength)
+    {
+        if (runLength == 0)
+        {
+            return;
+        }
+        largestRun = std::max(largestRun, runLength);
+        SizeType32 bucket = 0;
+        while ((SizeType32{1} << (bucket + 1)) <= runLength)
+        {
+            ++bucket;
+        }
+        if (static_cast<SizeType32>(histogram.size()) <= bucket)
+        {
+            histogram.resize(bucket + 1);
+        }
+        ++histogram[bucket];
+    };
+
+    SizeType32 runLength = 0;
+    for (auto const isFree : freeSlots)
+    {
+        if (isFree)
+        {
+            ++numFree;
+            ++runLength;
+        }
+        else
+        {
+            commitRun(runLength);
+            runLength = 0;
+        }
+    }
+    commitRun(runLength);
+}
+} // namespace
+
+KvCacheFragmentationStats WindowBlockManager::calculateFragmentationStats() const
+{
+    std::vector<bool> primaryFreeSlots(mNumPrimaryBlocks, false);
+    std::vector<bool> secondaryFreeSlots(mNumSecondaryBlocks, false);
+    for (auto const& block : mAllBlocksById)
+    {
+        if (block->hasRefs())
+        {
+            continue;
+        }
+        auto& freeSlots = block->isPrimary() ? primaryFreeSlots : secondaryFreeSlots;
+        freeSlots.at(block->getMemoryPoolBlockIndex()) = true;
+    }
+
+    KvCacheFragmentationStats stats;
+    analyzeFreeRuns(
+        primaryFreeSlots, stats.freeBlocksPrimary, stats.largestFreeRunPrimary, stats.freeRunHistogramPrimary);
+    analyzeFreeRuns(
+        secondaryFreeSlots, stats.freeBlocksSecondary, stats.largestFreeRunSecondary, stats.freeRunHistogramSecondary);
+    return stats;
+}
+
+SizeType32 WindowBlockManager::compactSecondaryPool(SizeType32 maxBlocksToMove)
+{
+    if (mNumSecondaryBlocks == 0 || maxBlocksToMove <= 0)
+    {
+        return 0;
+    }
+
+    // Partition the unreferenced secondary blocks into content blocks, which hold offloaded cache
+    // that is still reachable through the reuse tree, and holes, whose slots hold nothing of value.
+    std::vector<BlockPtr> contentBlocks;
+    std::vector<BlockPtr> holeBlocks;
+    for (auto const& block : mAllBlocksById)
+    {
+        if (block->isPrimary() || block->hasRefs())
+        {
+            continue;
+        }
+        (blockInRadixTree(block) ? contentBlocks : holeBlocks).emplace_back(block);
+    }
+
+    // Pair the highest content slots with the lowest holes so content migrates towards the front
+    // of the pool and the free space coalesces at its tail.
+    std::sort(contentBlocks.begin(), contentBlocks.end(), [](BlockPtr const& lhs, BlockPtr const& rhs)
+        { return lhs->getMemoryPoolBlockIndex() > rhs->getMemoryPoolBlockIndex(); });
+    std::sort(holeBlocks.begin(), holeBlocks.end(), [](BlockPtr const& lhs, BlockPtr const& rhs)
+        { return lhs->getMemoryPoolBlockIndex() < rhs->getMemoryPoolBlockIndex(); });
+
+    // The host-side copies below read the pool memory directly, so any in-flight offloads have to
+    // land first.
+    mTransferManager->syncTransfers();
+
+    SizeType32 numMoved = 0;
+    for (size_t pairIdx = 0; pairIdx < contentBlocks.size() && pairIdx < holeBlocks.size() && numMoved < maxBlocksToMove;
+        ++pairIdx)
+    {
+        auto const& content = contentBlocks[pairIdx];
+        auto const& hole = holeBlocks[pairIdx];
+        if (hole->getMemoryPoolBlockIndex() >= content->getMemoryPoolBlockIndex())
+        {
+            // All remaining pairs would move content backwards.
+            break;
+        }
+        for (auto const& pool : mPools)
+        {
+            if (!pool.secondaryPtr)
+            {
+                continue;
+            }
+            auto const srcSlice = runtime::ITensor::slice(pool.secondaryPtr, content->getMemoryPoolBlockIndex(), 1);
+            auto dstSlice = runtime::ITensor::slice(pool.secondaryPtr, hole->getMemoryPoolBlockIndex(), 1);
+            std::memcpy(dstSlice->data(), srcSlice->data(), srcSlice->getSizeInBytes());
+        }
+        content->swapMemoryPoolBlockOffset(hole);
+        ++numMoved;
+    }
+    if (numMoved > 0)
+    {
+        TLLM_LOG_DEBUG("%s::compactSecondaryPool relocated %d offloaded blocks", mLogPrefix.c_str(), numMoved);
+    }
+    return numMoved;
+}
+
+SizeType32 BlockManager::drainFreeBlocks(SizeType32 numBlocks)
+{
+    auto const totalPrimaryBlocks = getNumPrimaryBlocks();
+    if (totalPrimaryBlocks == 0 || numBlocks <= 0)
+    {
+        return 0;
+    }
+    SizeType32 numDrained = 0;
+    for (auto& [windowSize, manager] : mWindowBlockManagers)
+    {
+        // Spread the reduction across the windows in proportion to their pool sizes, so
+        // variable-window models keep their relative shares. Rounding up lets small pools
+        // contribute; the remaining budget keeps the total bounded.
+        auto share = static_cast<SizeType32>(
+            (static_cast<std::int64_t>(numBlocks) * manager.getNumPrimaryBlocks() + totalPrimaryBlocks - 1)
+            / totalPrimaryBlocks);
+        share = std::min(share, numBlocks - numDrained);
+        numDrained += manager.drainFreeBlocks(share);
+        if (numDrained >= numBlocks)
+        {
+            break;
+        }
+    }
+    return numDrained;
+}
+
+SizeType32 BlockManager::restoreDrainedBlocks(SizeType32 numBlocks)
+{
+    // Drained blocks can only return to the window they were taken from, so a greedy pass over
+    // the windows restores the requested count wherever it is available.
+    SizeType32 numRestored = 0;
+    for (auto& [windowSize, manager] : mWindowBlockManagers)
+    {
+        numRestored += manager.restoreDrainedBlocks(numBlocks - numRestored);
+        if (numRestored >= numBlocks)
+        {
+            break;
+        }
+    }
+    return numRestored;
+}
+
+SizeType32 WindowBlockManager::drainFreeBlocks(SizeType32 numBlocks)
+{
+    SizeType32 numDrained = 0;
+    while (numDrained < numBlocks && mEvictionPolicy->getNumFreeBlocks(kPrimaryLevel) > 0)
+    {
+        // The eviction policy hands out free blocks in eviction order, so cached content is
+        // sacrificed per the retention policy, least valuable first.
+        auto block = std::get<0>(mEvictionPolicy->getFreeBlock(kPrimaryLevel));
+        if (mShareManager)
+        {
+            // The block leaves circulation; peers must not copy from its slot anymore.
+            mShareManager->retract(block->getHash());
+        }
+        // Removes any reusable content from the search tree and emits removal events.
+        freeChildren(block);
+        mEvictionPolicy->claimBlock(block);
+        mDrainedBlocks.push_back(std::move(block));
+        ++numDrained;
+    }
+    if (numDrained > 0)
+    {
+        TLLM_LOG_DEBUG("%s::drainFreeBlocks took %d blocks out of circulation, %zu drained in total",
+            mLogPrefix.c_str(), numDrained, mDrainedBlocks.size());
+    }
+    return numDrained;
+}
+
+SizeType32 WindowBlockManager::restoreDrainedBlocks(SizeType32 numBlocks)
+{
+    SizeType32 numRestored = 0;
+    while (numRestored < numBlocks && !mDrainedBlocks.empty())
+    {
+        mEvictionPolicy->releaseBlock(mDrainedBlocks.back());
+        mDrainedBlocks.pop_back();
+        ++numRestored;
+    }
+    if (numRestored > 0)
+    {
+        TLLM_LOG_DEBUG("%s::restoreDrainedBlocks returned %d blocks to circulation, %zu still drained",
+            mLogPrefix.c_str(), numRestored, mDrainedBlocks.size());
+    }
+    return numRestored;
+}
+
 [[nodiscard]] std::optional<BlockKey> BlockManager::findNewContextBlock(
     VecUniqueTokens const& uniqueTokens, LlmRequest const& llmRequest) const
 {
@@ -1101,6 +1497,8 @@ void WindowBlockManager::offloadBlock(
 std::optional<BlockKey> WindowBlockManager::findNewContextBlock(
     VecUniqueTokens const& uniqueTokens, LlmRequest const& llmRequest) const
 {
+    // Read-only walk from the scheduler thread; may run concurrently with other readers.
+    std::shared_lock<std::shared_mutex> lock(mCachedBlocksRootMutex);
     auto blockedUniqueTokens
         = chopVectorIntoBlocks<UniqueToken>(uniqueTokens, uniqueTokens.size(), mTokensPerBlock, false);
     auto blockKeys = buildBlockKeys(blockedUniqueTokens, llmRequest);
@@ -1129,7 +1527,7 @@ bool WindowBlockManager::blockInRadixTree(BlockPtr const& block)
 
 std::shared_ptr<KVCacheBlock> WindowBlockManager::findBlocksInReuseTreeByBlockKey(BlockKey const& blockKey)
 {
-    std::lock_guard<std::mutex> lock(mCachedBlocksRootMutex);
+    std::shared_lock<std::shared_mutex> lock(mCachedBlocksRootMutex);
     auto blockedUniqueTokens
         = chopVectorIntoBlocks<UniqueToken>(blockKey.uniqueTokens, blockKey.uniqueTokens.size(), mTokensPerBlock, true);
 
@@ -1160,9 +1558,11 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
     GenerationRequest& sequence, std::vector<executor::RetentionPriorityAndDuration> const& perBlockRetentions,
     executor::KvCacheTransferMode mode, std::string const& directory)
 {
-    std::lock_guard<std::mutex> lock(mCachedBlocksRootMutex);
+    std::lock_guard<std::shared_mutex> lock(mCachedBlocksRootMutex);
     SizeType32 numMatchedTokens{0};
     auto searchRoot = mCachedBlocksRoot;
+    // Chained hash of the last matched block, used to look up spilled blocks on the tertiary tier.
+    std::size_t parentHash = 0;
 
     // The last block cannot be shared between beams because it will be written to.
     // Make sure a unique block is allocated per beam.
@@ -1228,6 +1628,7 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
             }
             onboardBlock(sequence, matchingBlock, mode, directory);
             addBlockToAllBeams(matchingBlock, sequence);
+            parentHash = matchingBlock->getHash();
             // TODO: only add once for reused blocks
             ++mReusedBlocks;
             if (!reusedBlockIds.count(matchingBlockId))
@@ -1244,6 +1645,39 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
                 perBlockRetentions[bi].retentionPriority.value_or(
                     executor::KvCacheRetentionConfig::kDefaultRetentionPriority),
                 perBlockRetentions[bi].durationMs, mode, directory);
+            if ((mShareManager || mSpillManager) && blockItr != blockKeys.end()
+                && blockItr->uniqueTokens.size() == static_cast<size_t>(mTokensPerBlock))
+            {
+                // Not cached in device or host memory; the block may still be published by a peer
+                // replica on this host, or live on the spill tier.
+                auto const candidateHash = BlockKeyHasher::hash(*blockItr, parentHash);
+                bool restored = false;
+                if (mShareManager && mShareManager->onboard(candidateHash, freeBlock, mPools, mBufferManager))
+                {
+                    restored = true;
+                    TLLM_LOG_DEBUG("%s::loadOrAllocateBlocks - Onboarded block %d from peer replica",
+                        mLogPrefix.c_str(), freeBlock->getBlockId());
+                }
+                else if (mSpillManager && mSpillManager->contains(candidateHash)
+                    && mSpillManager->onboard(candidateHash, freeBlock, mPools, mBufferManager))
+                {
+                    restored = true;
+                    TLLM_LOG_DEBUG("%s::loadOrAllocateBlocks - Onboarded spilled block %d from tertiary tier",
+                        mLogPrefix.c_str(), freeBlock->getBlockId());
+                }
+                if (restored)
+                {
+                    searchRoot = nullptr; // restored blocks are not in the search tree
+                    addBlockToAllBeams(freeBlock, sequence);
+                    freeBlock->setBlockKey(*blockItr, true);
+                    freeBlock->setHash();
+                    numMatchedTokens += blockItr->uniqueTokens.size();
+                    parentHash = candidateHash;
+                    ++blockItr;
+                    ++mReusedBlocks;
+                    continue;
+                }
+            }
             addBlockToAllBeams(freeBlock, sequence);
             TLLM_LOG_DEBUG("%s::loadOrAllocateBlocks - No match, allocated new block %d for sequence %lu",
                 mLogPrefix.c_str(), freeBlock->getBlockId(), sequence.getRequestId());
@@ -1262,8 +1696,23 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
     // Allocate new blocks that cannot be shared by multiple beams.
     for (int bi = numSharedContextBlocks; bi < numContextBlocks; ++bi)
     {
-        // TODO: Still look for match. Clone matching block or allocate fresh ones.
-        // This work is described in JIRA task https://jirasw.nvidia.com/browse/TRTLLM-2069.
+        // The per-beam block is written independently by each beam so it cannot be shared, but its
+        // contents may still be cached: clone a matching block into every beam's private copy on the
+        // transfer manager's onboard stream, so the fork costs an overlapped device copy instead of
+        // recomputing the tokens. Every clone is a copy, so partial matches are only taken when
+        // copy-on-partial-reuse is enabled. Disk-backed blocks are skipped; onboarding those
+        // requires a prior offload of the destination block.
+        auto [partialMatch, numMatched, matchingBlock]
+            = searchRoot != nullptr && blockItr != blockKeys.end() && mode == executor::KvCacheTransferMode::DRAM
+            ? searchRoot->findMatchingBlock(*blockItr, mEnablePartialReuse && mCopyOnPartialReuse, true)
+            : std::make_tuple(false, 0, nullptr);
+        // Keep an unreferenced source out of the free queues while the per-beam copies are
+        // enqueued; one of the getFreeBlock calls below could otherwise evict it mid-fork.
+        bool const sourcePinned = matchingBlock != nullptr && !matchingBlock->hasRefs();
+        if (sourcePinned)
+        {
+            mEvictionPolicy->claimBlock(matchingBlock);
+        }
         for (SizeType32 beamIdx = 0; beamIdx < beamWidth; ++beamIdx)
         {
             // If we haven't set a priority, set it to the default priority level (low)
@@ -1272,17 +1721,35 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
                     executor::KvCacheRetentionConfig::kDefaultRetentionPriority),
                 perBlockRetentions[bi].durationMs, mode, directory);
             addBlockToBeam(freeBlock, sequence, beamIdx);
+            if (matchingBlock != nullptr)
+            {
+                mTransferManager->onboard(matchingBlock, freeBlock, mPools, numMatched, mode, directory);
+            }
             if (blockItr != blockKeys.end())
             {
                 freeBlock->setBlockKey(
                     *blockItr, blockItr->uniqueTokens.size() == static_cast<size_t>(mTokensPerBlock));
-                ++blockItr;
             }
             freeBlock->setHash();
             TLLM_LOG_DEBUG("%s::loadOrAllocateBlocks - Beam %d. Allocated non-shared block %d for bi %d",
                 mLogPrefix.c_str(), beamIdx, freeBlock->getBlockId(), bi);
         }
-        ++mMissedBlocks;
+        if (sourcePinned)
+        {
+            mEvictionPolicy->releaseBlock(matchingBlock);
+        }
+        if (matchingBlock != nullptr)
+        {
+            numMatchedTokens += numMatched > 0 ? numMatched : blockItr->uniqueTokens.size();
+            TLLM_LOG_DEBUG("%s::loadOrAllocateBlocks - Cloned block %d into %d per-beam copies for bi %d",
+                mLogPrefix.c_str(), matchingBlock->getBlockId(), beamWidth, bi);
+            ++mReusedBlocks;
+        }
+        else
+        {
+            ++mMissedBlocks;
+        }
+        searchRoot = nullptr; // per-beam blocks diverge, no matching for following blocks
         if (blockItr != blockKeys.end())
         {
             ++blockItr;
@@ -1294,10 +1761,8 @@ SizeType32 WindowBlockManager::loadOrAllocateBlocks(std::vector<BlockKey> const&
 
 void BlockManager::refreshBlocks()
 {
-    for (auto& [_, manager] : mWindowBlockManagers)
-    {
-        manager.refreshBlocks();
-    }
+    // Parallelizing overlaps the per-window transfer-stream syncs on top of the bookkeeping.
+    runPerWindow([](size_t /*windowIdx*/, WindowBlockManager& manager) { manager.refreshBlocks(); });
 }
 
 void WindowBlockManager::refreshBlocks()
@@ -1360,6 +1825,31 @@ void WindowBlockManager::addSequence(
     mReusedTokens += static_cast<double>(prepopulatedPromptLen);
     mTotalInputTokens += static_cast<double>(uniqueTokens.size());
 
+    // Hash the prompt's full block keys on a background worker while the context phase executes,
+    // so storing the blocks for reuse later does not recompute token-sequence hashes on the
+    // batch loop. Keys already probed above carry a memoized hash, making this mostly a no-op
+    // for reused prefixes.
+    if (!mHashWorkerPool)
+    {
+        mHashWorkerPool = std::make_shared<runtime::WorkerPool>(1);
+    }
+    mPendingBlockHashes[requestId] = mHashWorkerPool->enqueue(
+        [keys = blockKeys, tokensPerBlock = mTokensPerBlock]()
+        {
+            std::vector<size_t> hashes;
+            hashes.reserve(keys.size());
+            for (auto const& key : keys)
+            {
+                if (key.uniqueTokens.size() != static_cast<size_t>(tokensPerBlock))
+                {
+                    // Partial trailing blocks get different keys at store time; stop here.
+                    break;
+                }
+                hashes.push_back(BlockKeyHasher::hash(key));
+            }
+            return hashes;
+        });
+
     SizeType32 numConnectorMatchedTokens = 0;
 
     // If we're using a KV cache connector, check if any additional blocks can be loaded.
@@ -1385,7 +1875,7 @@ void WindowBlockManager::adjustBlocksIfNeeded(GenerationRequest& sequence)
 {
     auto const minTokensForBlockDetach = mWindowSize + mTokensPerBlock;
     while (
-        sequence.getNumTokens() - sequence.getNumFrontBlocksRemoved() * getTokensPerBlock() >= minTokensForBlockDetach)
+        sequence.getNumTokens() - sequence.getNumFrontBlocksRemoved(mWindowSize) * getTokensPerBlock() >= minTokensForBlockDetach)
     {
         // Detaching block for SWA is non-trivial due to the radix tree structure.
         // For now, when reuse is enabled, we do not detach blocks for SWA.
@@ -1395,9 +1885,14 @@ void WindowBlockManager::adjustBlocksIfNeeded(GenerationRequest& sequence)
 
     if ((sequence.getNumTokens() - 1) % getTokensPerBlock() == 0)
     {
-        // Allocating a new block when the last token is a block boundary
-        allocateBlock(sequence, /*shareAmongBeams=*/sequence.getBeamWidth() == 1);
-        updateLastCacheBlockOffsets(sequence);
+        // Allocating a new block when the last token is a block boundary. A block reserved ahead
+        // of time already sits at the tail of the block table with its offsets written, so the
+        // allocation step reduces to consuming the reservation.
+        if (mIsSWA || !sequence.consumePreallocatedBlock())
+        {
+            allocateBlock(sequence, /*shareAmongBeams=*/sequence.getBeamWidth() == 1);
+            updateLastCacheBlockOffsets(sequence);
+        }
     }
 }
 
@@ -1469,6 +1964,21 @@ void WindowBlockManager::allocateBlock(GenerationRequest& sequence, bool shareAm
     auto const beamWidth = sequence.getBeamWidth();
     auto const requiredBlocks = shareAmongBeams ? 1 : beamWidth;
 
+    // Ring-buffer mode: rebind the stashed out-of-window block as the new tail block. Only the
+    // offset table entry changes; the free list is not touched.
+    if (auto const ringIt = mRecycledBlockPerSeq.find(sequence.getRequestId()); ringIt != mRecycledBlockPerSeq.end())
+    {
+        auto block = ringIt->second;
+        mRecycledBlockPerSeq.erase(ringIt);
+        TLLM_LOG_DEBUG("%s::allocateBlock - Rebinding out-of-window block %d as tail of sequence %lu",
+            mLogPrefix.c_str(), block->getBlockId(), sequence.getRequestId());
+        // The rebound block is rewritten with new tokens, so the sequence can no longer be
+        // stored for reuse as one contiguous token stream.
+        mIsValidStoreForReuseSequence[sequence.getRequestId()] = false;
+        addBlockToAllBeams(block, sequence);
+        return;
+    }
+
     TLLM_CHECK_WITH_INFO(hasFreeBlocks(requiredBlocks), "Can't allocate new blocks. No free blocks left.");
 
     if (shareAmongBeams)
@@ -1497,7 +2007,7 @@ std::pair<SizeType32, std::optional<KVCacheBlock::IdType>> WindowBlockManager::s
     std::vector<BlockKey> const& blockKeys, std::vector<KVCacheBlock::IdType> const& blockIds, bool pinBlocks)
 {
     SizeType32 numBlocksStoredForReuse = 0;
-    std::lock_guard<std::mutex> lock(mCachedBlocksRootMutex);
+    std::lock_guard<std::shared_mutex> lock(mCachedBlocksRootMutex);
     TLLM_LOG_DEBUG(
         "%s::storeBlocks - %zu blockKeys, %zu blockIds", mLogPrefix.c_str(), blockKeys.size(), blockIds.size());
 
@@ -1560,10 +2070,28 @@ std::pair<SizeType32, std::optional<KVCacheBlock::IdType>> WindowBlockManager::s
         }
         lastStoredId = searchRoot->getBlockId();
     }
+    if (mShareManager)
+    {
+        // Announce full device-resident blocks to peer replicas on this host.
+        for (auto const& block : storedBlocks)
+        {
+            if (block->isPrimary() && block->isFull())
+            {
+                mShareManager->publish(block->getHash(), block->getMemoryPoolBlockIndex());
+            }
+        }
+    }
     if (mEventManager)
     {
         mEventManager->enqueueStoredEvent(storedBlocks, mWindowSize);
     }
+    if (mPrefixDigest)
+    {
+        for (auto const& block : storedBlocks)
+        {
+            mPrefixDigest->insert(block->getHash());
+        }
+    }
     return {numBlocksStoredForReuse, lastStoredId};
 }
 
@@ -1652,15 +2180,18 @@ std::deque<tle::KVCacheEvent> BlockManager::getLatestEvents(std::optional<std::c
     return mEventManager ? mEventManager->getEvents(timeout) : std::deque<tle::KVCacheEvent>{};
 }
 
+tle::KVCachePrefixDigest BlockManager::getPrefixDigest() const
+{
+    return mPrefixDigest ? mPrefixDigest->snapshot() : tle::KVCachePrefixDigest{};
+}
+
 std::optional<KVCacheBlock::IdType> BlockManager::storeBlocksForReuse(
     GenerationRequest& sequence, OptionalRef<LlmRequest const> llmRequest, bool pinBlocks)
 {
-    std::optional<KVCacheBlock::IdType> lastStoredId = std::nullopt;
-    for (auto& [_, manager] : mWindowBlockManagers)
-    {
-        lastStoredId = manager.storeBlocksForReuse(sequence, llmRequest, pinBlocks);
-    }
-    return lastStoredId;
+    std::vector<std::optional<KVCacheBlock::IdType>> lastStoredIds(mWindowBlockManagers.size());
+    runPerWindow([&](size_t windowIdx, WindowBlockManager& manager)
+        { lastStoredIds[windowIdx] = manager.storeBlocksForReuse(sequence, llmRequest, pinBlocks); });
+    return lastStoredIds.back();
 }
 
 std::optional<KVCacheBlock::IdType> BlockManager::releaseBlocks(
@@ -1668,19 +2199,15 @@ std::optional<KVCacheBlock::IdType> BlockManager::releaseBlocks(
 {
     // Released block will be stored when reuse is enabled.
     // Reuse is implied to be enabled if llmRequest is provided.
-    std::optional<KVCacheBlock::IdType> lastStoredId = std::nullopt;
-    for (auto& [_, manager] : mWindowBlockManagers)
-    {
-        if (!llmRequest.has_value() || llmRequest->isDummyRequest() || sequence.getBeamWidth() > 1)
-        {
-            lastStoredId = manager.releaseBlocks(sequence, std::nullopt);
-        }
-        else
+    bool const storeForReuse = llmRequest.has_value() && !llmRequest->isDummyRequest() && sequence.getBeamWidth() <= 1;
+    std::vector<std::optional<KVCacheBlock::IdType>> lastStoredIds(mWindowBlockManagers.size());
+    runPerWindow(
+        [&](size_t windowIdx, WindowBlockManager& manager)
         {
-            lastStoredId = manager.releaseBlocks(sequence, llmRequest);
-        }
-    }
-    return lastStoredId;
+            lastStoredIds[windowIdx] = storeForReuse ? manager.releaseBlocks(sequence, llmRequest)
+                                                     : manager.releaseBlocks(sequence, std::nullopt);
+        });
+    return lastStoredIds.back();
 }
 
 void BlockManager::pinBlocks(GenerationRequest& sequence)
@@ -1794,6 +2321,25 @@ void WindowBlockManager::storeNewBlock(GenerationRequest& sequence, OptionalRef<
     (void) storeBlocks(std::move(blockKeys), cacheBlockIds[beamIdx]);
 }
 
+void WindowBlockManager::applyPrefetchedHashes(LlmRequest::RequestIdType requestId, std::vector<BlockKey>& blockKeys)
+{
+    auto jobIt = mPendingBlockHashes.find(requestId);
+    if (jobIt == mPendingBlockHashes.end())
+    {
+        return;
+    }
+    auto const hashes = jobIt->second.get();
+    mPendingBlockHashes.erase(jobIt);
+    for (size_t i = 0; i < hashes.size() && i < blockKeys.size(); ++i)
+    {
+        if (blockKeys[i].uniqueTokens.size() != static_cast<size_t>(mTokensPerBlock))
+        {
+            break;
+        }
+        blockKeys[i].cachedHash = hashes[i];
+    }
+}
+
 std::optional<KVCacheBlock::IdType> WindowBlockManager::storeBlocksForReuse(
     GenerationRequest& sequence, OptionalRef<LlmRequest const> llmRequest, bool pinBlocks)
 {
@@ -1807,6 +2353,7 @@ std::optional<KVCacheBlock::IdType> WindowBlockManager::storeBlocksForReuse(
     auto const usableSize = static_cast<runtime::SizeType32>(uniqueTokens.size()) - 1;
     auto blockedUniqueTokens = chopVectorIntoBlocks<UniqueToken>(uniqueTokens, usableSize, mTokensPerBlock, true);
     auto blockKeys = buildBlockKeys(blockedUniqueTokens, *llmRequest);
+    applyPrefetchedHashes(sequence.getRequestId(), blockKeys);
     return storeBlocks(std::move(blockKeys), cacheBlockIds[beamIdx], pinBlocks).second;
 }
 
@@ -1841,6 +2388,7 @@ std::optional<KVCacheBlock::IdType> WindowBlockManager::releaseBlocks(
             auto blockedUniqueTokens
                 = chopVectorIntoBlocks<UniqueToken>(uniqueTokens, usableSize, mTokensPerBlock, /*allowPartial=*/true);
             auto blockKeys = buildBlockKeys(blockedUniqueTokens, *llmRequest);
+            applyPrefetchedHashes(requestId, blockKeys);
 
             std::vector<KVCacheBlock::IdType> cacheBlockIds(allocatedBlocks.size());
             std::transform(allocatedBlocks.begin(), allocatedBlocks.end(), cacheBlockIds.begin(),
@@ -1851,9 +2399,25 @@ std::optional<KVCacheBlock::IdType> WindowBlockManager::releaseBlocks(
                 sequence.getRequestId(), numBlocksStoredForReuse);
         }
     }
-    for (auto it = allocatedBlocks.rbegin(); it != allocatedBlocks.rend() - sequence.getNumFrontBlocksRemoved(); ++it)
+    // Drop any background hashing job that was not consumed (e.g. store-for-reuse skipped).
+    mPendingBlockHashes.erase(requestId);
+    if (auto const ringIt = mRecycledBlockPerSeq.find(requestId); ringIt != mRecycledBlockPerSeq.end())
+    {
+        // A stashed ring block that was never rebound carries no refs; return it to the free store.
+        mEvictionPolicy->releaseBlock(ringIt->second);
+        mRecycledBlockPerSeq.erase(ringIt);
+    }
+    // Detached out-of-window blocks sit right behind the pinned sink blocks and already dropped
+    // this sequence's ref when they were detached, so they are skipped here.
+    auto const firstDetachedBlockIdx = sequence.getNumSinkBlocks();
+    auto const numDetachedBlocks = sequence.getNumFrontBlocksRemoved(mWindowSize);
+    for (auto blockIdx = static_cast<SizeType32>(allocatedBlocks.size()) - 1; blockIdx >= 0; --blockIdx)
     {
-        auto& block = *it;
+        if (blockIdx >= firstDetachedBlockIdx && blockIdx < firstDetachedBlockIdx + numDetachedBlocks)
+        {
+            continue;
+        }
+        auto& block = allocatedBlocks.at(blockIdx);
         // Decrease ref count
         if (block->hasRefs())
         {
@@ -1893,6 +2457,33 @@ void WindowBlockManager::schedulingReleaseBlocks(RequestIdType requestId)
     }
 }
 
+void BlockManager::demotePausedSequenceTail(RequestIdType requestId, float residentPrefixFraction)
+{
+    for (auto& [_, manager] : mWindowBlockManagers)
+    {
+        manager.demotePausedSequenceTail(requestId, residentPrefixFraction);
+    }
+}
+
+void WindowBlockManager::demotePausedSequenceTail(RequestIdType requestId, float residentPrefixFraction)
+{
+    auto const seqIt = mAllocatedBlocksPerSeq.find(requestId);
+    if (seqIt == mAllocatedBlocksPerSeq.end())
+    {
+        return;
+    }
+    auto const& allocatedBlocks = seqIt->second;
+    auto const numBlocks = static_cast<SizeType32>(allocatedBlocks.size());
+    auto const numResident = std::min(
+        numBlocks, static_cast<SizeType32>(std::ceil(residentPrefixFraction * static_cast<float>(numBlocks))));
+    // The blocks stay allocated, so no free-queue rebucketing is needed here; releaseBlocks buckets
+    // them by the new priority, and a reuse match restores the priority through claimBlock.
+    for (SizeType32 blockIdx = numResident; blockIdx < numBlocks; ++blockIdx)
+    {
+        allocatedBlocks.at(blockIdx)->setPriority(executor::KvCacheRetentionConfig::kMinRetentionPriority);
+    }
+}
+
 KVCacheManager::KVCacheManager(SizeType32 numLayers, SizeType32 numKvHeads, SizeType32 sizePerHead,
     SizeType32 tokensPerBlock, BlocksPerWindow const& blocksPerWindow, SizeType32 maxNumSequences,
     SizeType32 maxBeamWidth, std::vector<SizeType32> const& maxAttentionWindowVec,
@@ -1943,8 +2534,13 @@ KVCacheManager::KVCacheManager(std::vector<SizeType32> const& numKvHeadsPerLayer
     // disable block reuse for sink bubble since chopVectorIntoBlocks does not match KV cache blocks in this case
     , mEnableBlockReuse{mSinkBubbleLength > 0 ? false : enableBlockReuse}
 {
-    TLLM_CHECK_WITH_INFO(mSinkBlockTokenLength == 0 && mSinkBubbleLength == 0,
-        "[kv cache manager] streamLLM is not supported at the moment");
+    TLLM_CHECK_WITH_INFO(mSinkBubbleLength == 0,
+        "[kv cache manager] sink tokens must be a multiple of tokensPerBlock; partially filled sink blocks are not "
+        "supported");
+    TLLM_CHECK_WITH_INFO(mSinkBlockTokenLength == 0
+            || mSinkBlockTokenLength < *std::min_element(maxAttentionWindowVec.begin(), maxAttentionWindowVec.end()),
+        "[kv cache manager] sink token length (%d) must be smaller than the smallest attention window",
+        mSinkBlockTokenLength);
     TLLM_CHECK_DEBUG(std::find(maxAttentionWindowVec.begin(), maxAttentionWindowVec.end(), mMaxAttentionWindow)
         != maxAttentionWindowVec.end());
     // The sink tokens are stored in blocks separate from other tokens.
@@ -2156,6 +2752,22 @@ SizeType32 KVCacheManager::getRemainingBlocksToCompletion(LlmRequest const& req,
     return (numTotalBlocksPerBeam - numAllocBlocksPerBeam + numExtraBlocksPerBeam) * req.mSamplingConfig.beamWidth;
 }
 
+bool KVCacheManager::canPrefetchRequest(LlmRequest const& req) const
+{
+    for (auto const& [windowSize, metadata] : mBlockManager.getWindowSizesMetadata())
+    {
+        auto const neededBlocks = getRemainingBlocksToCompletion(req, windowSize);
+        auto const freeBlocks = mBlockManager.getNumFreeBlocksPerWindowSize().at(windowSize);
+        // Keep a one-block growth margin per potentially active sequence so prefetching an
+        // unadmitted request cannot starve the sequences the scheduler already admitted.
+        if (neededBlocks + mMaxNumSequences > freeBlocks)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BlockManager::updateSequenceCacheBlockOffsets(GenerationRequest& sequence, SizeType32 windowSize)
 {
     auto const& cacheBlocks = sequence.getCacheBlockIds(windowSize);
@@ -2213,7 +2825,6 @@ void BlockManager::updateCacheBlockOffsetsAtIdx(GenerationRequest& sequence, Siz
 
 void KVCacheManager::addToken(RequestIdType requestId)
 {
-    // TODO: add streamLLM support
     auto& sequence = getSequence(requestId);
     sequence.addNewTokens(1);
     mBlockManager.adjustBlocksIfNeeded(sequence);
@@ -2221,15 +2832,15 @@ void KVCacheManager::addToken(RequestIdType requestId)
 
 void WindowBlockManager::detachFrontBlock(GenerationRequest& sequence)
 {
-    // streamLLM is not supported at the moment. The out of window block will
-    // always be the 0th block.
     TLLM_CHECK_WITH_INFO(
         sequence.getBeamWidth() == 1, "[kv cache manager] detachBlock does not support beamWidth > 1 now.");
 
     auto const requestId = sequence.getRequestId();
     auto const beamWidth = sequence.getBeamWidth();
     auto& allocatedBlocks = mAllocatedBlocksPerSeq.at(requestId);
-    SizeType32 outOfWindowBlockIdx = sequence.getNumFrontBlocksRemoved();
+    // The oldest block behind the pinned attention sinks is the one that went out of window
+    // (StreamingLLM shape); without sinks this is simply the 0th block.
+    SizeType32 outOfWindowBlockIdx = sequence.getNumSinkBlocks() + sequence.getNumFrontBlocksRemoved(mWindowSize);
 
     for (auto beamIdx = 0; beamIdx < beamWidth; ++beamIdx)
     {
@@ -2237,6 +2848,20 @@ void WindowBlockManager::detachFrontBlock(GenerationRequest& sequence)
         TLLM_LOG_DEBUG("%s::detachFrontBlock - Detaching block %d from sequence %d", mLogPrefix.c_str(),
             outOfWindowBlock->getBlockId(), requestId);
 
+        // Ring-buffer mode: an exclusively owned block outside the reuse tree is stashed for the
+        // sequence instead of being returned to the free store, so the next tail allocation can
+        // rebind it in place without touching the free list.
+        if (tc::getEnvKVCacheSwaRingBuffer() && !outOfWindowBlock->isShared() && outOfWindowBlock->isLeaf()
+            && mRecycledBlockPerSeq.count(requestId) == 0)
+        {
+            outOfWindowBlock->decRefCount();
+            TLLM_LOG_DEBUG("%s::detachFrontBlock - Stashing block %d for ring-buffer reuse by sequence %lu",
+                mLogPrefix.c_str(), outOfWindowBlock->getBlockId(), requestId);
+            mRecycledBlockPerSeq[requestId] = outOfWindowBlock;
+            sequence.removeFrontBlock(mWindowSize);
+            return;
+        }
+
         outOfWindowBlock->decRefCount();
 
         if (outOfWindowBlock->hasRefs())
@@ -2262,19 +2887,84 @@ std::optional<BlockKey> KVCacheManager::findNewContextBlock(
     return newContextBlockOpt;
 }
 
+SizeType32 KVCacheManager::calculateTailWastedTokens() const
+{
+    auto const tokensPerBlock = getTokensPerBlock();
+    SizeType32 wastedTokens{0};
+    std::scoped_lock lck(mSequencesMtx);
+    for (auto const& [requestId, sequence] : mSequences)
+    {
+        auto const numTokens = sequence.getNumTokens();
+        for (auto const& [windowSize, _] : mBlockManager.getWindowSizesMetadata())
+        {
+            // Tokens still backed by the held blocks; for sliding windows the detached front
+            // blocks no longer store their tokens.
+            auto const heldTokens = numTokens - sequence.getNumFrontBlocksRemoved(windowSize) * tokensPerBlock;
+            for (auto const& beamBlockIds : sequence.getCacheBlockIds(windowSize))
+            {
+                auto const capacity = static_cast<SizeType32>(beamBlockIds.size()) * tokensPerBlock;
+                wastedTokens += std::max(capacity - heldTokens, 0);
+            }
+        }
+    }
+    return wastedTokens;
+}
+
+void KVCacheManager::recordFinishedSequence(SizeType32 numOutputBlocks)
+{
+    if (static_cast<size_t>(numOutputBlocks) >= mOutputBlocksHistogram.size())
+    {
+        mOutputBlocksHistogram.resize(numOutputBlocks + 1, 0);
+    }
+    ++mOutputBlocksHistogram[numOutputBlocks];
+    ++mNumFinishedSequences;
+}
+
+SizeType32 KVCacheManager::predictOutputBlocks() const
+{
+    // Too few samples to trust the histogram; fall back to just-in-time allocation.
+    SizeType32 constexpr kMinFinishedSequences = 16;
+    if (mNumFinishedSequences < kMinFinishedSequences)
+    {
+        return 0;
+    }
+    // The median balances the two failure modes: half the sequences outgrow the reservation and
+    // take the allocation path for their tail, while overshoot on the short half is bounded by
+    // the reservation cap and recovered when the sequence is removed.
+    auto const target = (mNumFinishedSequences + 1) / 2;
+    SizeType32 cumulative = 0;
+    for (size_t numBlocks = 0; numBlocks < mOutputBlocksHistogram.size(); ++numBlocks)
+    {
+        cumulative += mOutputBlocksHistogram[numBlocks];
+        if (cumulative >= target)
+        {
+            return static_cast<SizeType32>(numBlocks);
+        }
+    }
+    return 0;
+}
+
 void KVCacheManager::addSequence(
     RequestIdType requestId, SizeType32 inputLength, SizeType32 beamWidth, OptionalRef<LlmRequest> llmRequest)
 {
-    // TODO: add streamLLM support
     auto kvCacheRetentionConfig = llmRequest
         ? llmRequest->getKvCacheRetentionConfig().value_or(executor::KvCacheRetentionConfig())
         : executor::KvCacheRetentionConfig();
 
+    // Resolve the StreamingLLM eviction shape for this request. The attention kernels read one
+    // batch-uniform sink token length, so a per-request count can only opt into the engine-wide value.
+    auto const sinkTokenCount = kvCacheRetentionConfig.getAttentionSinkTokenCount().value_or(mSinkBlockTokenLength);
+    TLLM_CHECK_WITH_INFO(sinkTokenCount == mSinkBlockTokenLength,
+        "attentionSinkTokenCount (%d) of request %lu must match the sink token length the attention kernels were "
+        "configured with (%d)",
+        sinkTokenCount, requestId, mSinkBlockTokenLength);
+    auto const numSinkBlocks = sinkTokenCount / getTokensPerBlock();
+
     auto const [seqIt, emplaceDone] = [&]
     {
         auto lck = std::scoped_lock(mSequencesMtx);
         return mSequences.try_emplace(requestId, requestId, inputLength, beamWidth,
-            mBlockManager.getWindowSizesMetadata(), kvCacheRetentionConfig);
+            mBlockManager.getWindowSizesMetadata(), kvCacheRetentionConfig, numSinkBlocks);
     }();
     TLLM_CHECK(emplaceDone);
     auto& sequence = seqIt->second;
@@ -2328,6 +3018,33 @@ void KVCacheManager::addSequence(
         mBlockManager.updateSequenceCacheBlockOffsets(sequence, windowSize);
     }
 
+    // Speculatively reserve tail blocks for the predicted output length, so steady-state decode
+    // steps consume a reservation instead of taking the allocation path. SWA and beam search keep
+    // the just-in-time behavior; their block tables are reshaped as the sequence advances.
+    auto const preallocCap = static_cast<SizeType32>(tc::getEnvKVCachePreallocBlocks());
+    auto const& windowSizesMetadata = mBlockManager.getWindowSizesMetadata();
+    if (preallocCap > 0 && beamWidth == 1 && windowSizesMetadata.size() == 1
+        && !windowSizesMetadata.begin()->second.isSWA)
+    {
+        auto const [windowSize, metadata] = *windowSizesMetadata.begin();
+        auto const numAllocated = static_cast<SizeType32>(sequence.getCacheBlockIds(windowSize).at(0).size());
+        auto const numToReserve
+            = std::min({preallocCap, predictOutputBlocks(), metadata.maxBlocksPerSeq - numAllocated});
+        SizeType32 numReserved = 0;
+        // Keep a one-step growth margin in the free store so reservations cannot starve requests
+        // the scheduler already admitted.
+        while (numReserved < numToReserve && mBlockManager.getNumFreeBlocks() > mMaxNumSequences)
+        {
+            mBlockManager.allocateBlock(sequence, windowSize);
+            ++numReserved;
+        }
+        if (numReserved > 0)
+        {
+            mBlockManager.updateSequenceCacheBlockOffsets(sequence, windowSize);
+            sequence.addPreallocatedBlocks(numReserved);
+        }
+    }
+
     if (llmRequest)
     {
         // Update statistics for block allocations/reuse per request.
@@ -2382,6 +3099,14 @@ std::optional<KVCacheBlock::IdType> KVCacheManager::removeSequence(
     std::optional<KVCacheBlock::IdType> lastStoredId = std::nullopt;
     if (!sequenceNode.empty())
     {
+        auto const& sequence = sequenceNode.mapped();
+        mPreallocHitBlocks += sequence.getNumPreallocatedConsumed();
+        mPreallocWastedBlocks += sequence.getNumPreallocatedBlocks();
+        if (llmRequest)
+        {
+            recordFinishedSequence(tc::ceilDiv(
+                std::max(llmRequest->getMaxBeamNumTokens() - llmRequest->mPromptLen, 0), getTokensPerBlock()));
+        }
         if (mEnableBlockReuse)
         {
             lastStoredId = mBlockManager.releaseBlocks(sequenceNode.mapped(), llmRequest, pinBlocks);
@@ -2429,6 +3154,20 @@ void KVCacheManager::unpinBlocksById(KVCacheBlock::IdType blockId)
     mBlockManager.unpinBlocksById(blockId);
 }
 
+SizeType32 KVCacheManager::shrinkCapacity(SizeType32 numBlocks)
+{
+    auto const numDrained = mBlockManager.drainFreeBlocks(numBlocks);
+    TLLM_LOG_INFO("Shrunk KV cache capacity by %d blocks, %d requested", numDrained, numBlocks);
+    return numDrained;
+}
+
+SizeType32 KVCacheManager::growCapacity(SizeType32 numBlocks)
+{
+    auto const numRestored = mBlockManager.restoreDrainedBlocks(numBlocks);
+    TLLM_LOG_INFO("Grew KV cache capacity by %d blocks, %d requested", numRestored, numBlocks);
+    return numRestored;
+}
+
 SizeType32 KVCacheManager::copyBlockOffsets(ITensor& output, SizeType32 outputSlotOffset, RequestIdType requestId) const
 {
     auto const& sequence = getSequence(requestId);
@@ -2736,32 +3475,67 @@ BlocksPerWindow BaseKVCacheManager::calculateMaxNumBlocks(executor::KvCacheConfi
     return windowSizeToBlocks;
 }
 
-void KVCacheManager::removeToken(RequestIdType requestId)
+void KVCacheManager::rewindSequence(GenerationRequest& sequence, SizeType32 rewindLengths)
 {
     // TODO: add streamLLM support
-    auto& sequence = getSequence(requestId);
-    if (sequence.getNumTokens() == 0)
+    auto const numRemoved = std::min(rewindLengths, sequence.getNumTokens());
+    if (numRemoved == 0)
     {
         return;
     }
-    TLLM_CHECK_WITH_INFO(sequence.getBeamWidth() == 1, "[kv cache manager] removeToken does not support beamWidth > 1");
-    sequence.removeTokens(1);
-    for (auto const [windowSize, metadata] : mBlockManager.getWindowSizesMetadata())
+    TLLM_CHECK_WITH_INFO(sequence.getBeamWidth() == 1, "[kv cache manager] rewind does not support beamWidth > 1");
+    auto const tokensPerBlock = getTokensPerBlock();
+    for (SizeType32 si = 0; si < numRemoved; ++si)
     {
-        SizeType32 const tokensInWindow = sequence.getNumTokens() % windowSize;
-        if (tokensInWindow % getTokensPerBlock() == 0)
+        sequence.removeTokens(1);
+        for (auto const [windowSize, metadata] : mBlockManager.getWindowSizesMetadata())
         {
-            mBlockManager.releaseLastBlock(sequence, windowSize);
+            SizeType32 const tokensInWindow = sequence.getNumTokens() % windowSize;
+            if (tokensInWindow % tokensPerBlock == 0)
+            {
+                mBlockManager.releaseLastBlock(sequence, windowSize);
+            }
         }
     }
 }
 
+void KVCacheManager::removeToken(RequestIdType requestId)
+{
+    rewindSequence(getSequence(requestId), 1);
+}
+
 void KVCacheManager::rewindKVCache(RequestIdType requestId, SizeType32 rewindLengths)
 {
-    for (SizeType32 si = 0; si < rewindLengths; ++si)
+    rewindSequence(getSequence(requestId), rewindLengths);
+}
+
+void KVCacheManager::rewindKVCacheBatched(
+    std::vector<std::pair<LlmRequest::RequestIdType, SizeType32>> const& rewindLengths)
+{
+    // Resolve all sequences under one lock; the per-sequence bookkeeping does not touch the map.
+    std::vector<GenerationRequest*> sequences;
+    sequences.reserve(rewindLengths.size());
     {
-        removeToken(requestId);
+        auto lck = std::scoped_lock(mSequencesMtx);
+        for (auto const& [requestId, rewindLength] : rewindLengths)
+        {
+            sequences.push_back(&mSequences.at(requestId));
+        }
+    }
+    for (std::size_t ri = 0; ri < rewindLengths.size(); ++ri)
+    {
+        rewindSequence(*sequences[ri], rewindLengths[ri].second);
+    }
+}
+
+void KVCacheManager::preparePausedSequenceRetention(RequestIdType requestId)
+{
+    auto const residentPrefixFraction = tc::getEnvPauseResidentPrefixFraction();
+    if (residentPrefixFraction <= 0.F)
+    {
+        return;
     }
+    mBlockManager.demotePausedSequenceTail(requestId, residentPrefixFraction);
 }
 
 GenerationRequest const& KVCacheManager::getSequence(RequestIdType requestId) const
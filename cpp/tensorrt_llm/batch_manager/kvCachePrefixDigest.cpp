@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/kvCachePrefixDigest.h"
+#include "tensorrt_llm/common/assert.h"
+
+#include <limits>
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+namespace
+{
+
+// Finalizer of the SplitMix64 generator; decorrelates the chained block hashes, which share
+// structure between blocks of the same sequence.
+uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Kirsch-Mitzenmacher double hashing; must match the probe schedule documented on
+// executor::KVCachePrefixDigest so routers can run membership queries on the raw bitset.
+template <typename Fn>
+void forEachProbe(std::size_t hash, int32_t numBits, int32_t numHashes, Fn&& fn)
+{
+    uint64_t const h1 = splitmix64(hash);
+    uint64_t const h2 = splitmix64(hash ^ executor::KVCachePrefixDigest::kProbeSeed);
+    for (int32_t i = 0; i < numHashes; ++i)
+    {
+        fn(static_cast<int32_t>((h1 + static_cast<uint64_t>(i) * h2) % static_cast<uint64_t>(numBits)));
+    }
+}
+
+} // namespace
+
+KVCachePrefixDigest::KVCachePrefixDigest(SizeType32 numBits, SizeType32 numHashes)
+    : mNumBits{numBits}
+    , mNumHashes{numHashes}
+    , mCounters(numBits, 0)
+{
+    TLLM_CHECK_WITH_INFO(numBits > 0 && numHashes > 0, "Prefix digest needs at least one bit and one hash probe.");
+}
+
+void KVCachePrefixDigest::insert(std::size_t hash)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mVersion;
+    forEachProbe(hash, mNumBits, mNumHashes,
+        [this](SizeType32 bit)
+        {
+            if (mCounters[bit] != std::numeric_limits<uint8_t>::max())
+            {
+                ++mCounters[bit];
+            }
+        });
+}
+
+void KVCachePrefixDigest::remove(std::size_t hash)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    ++mVersion;
+    forEachProbe(hash, mNumBits, mNumHashes,
+        [this](SizeType32 bit)
+        {
+            // Saturated counters are left set forever: decrementing them could drop a bit that
+            // other live hashes still rely on, turning false positives into false negatives.
+            if (mCounters[bit] != 0 && mCounters[bit] != std::numeric_limits<uint8_t>::max())
+            {
+                --mCounters[bit];
+            }
+        });
+}
+
+executor::KVCachePrefixDigest KVCachePrefixDigest::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    executor::KVCachePrefixDigest digest;
+    digest.numBits = mNumBits;
+    digest.numHashes = mNumHashes;
+    digest.version = mVersion;
+    digest.bits.assign((mNumBits + 7) / 8, 0);
+    for (SizeType32 bit = 0; bit < mNumBits; ++bit)
+    {
+        if (mCounters[bit] != 0)
+        {
+            digest.bits[bit / 8] |= static_cast<uint8_t>(1U << (bit % 8));
+        }
+    }
+    return digest;
+}
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
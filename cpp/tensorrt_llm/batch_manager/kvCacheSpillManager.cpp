@@ -0,0 +1,244 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/batch_manager/kvCacheSpillManager.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace tr = tensorrt_llm::runtime;
+
+namespace tensorrt_llm::batch_manager::kv_cache_manager
+{
+
+namespace
+{
+
+tr::ITensor::SharedPtr blockPoolTensor(BlockPtr const& block, KVCacheBlockPool const& pool)
+{
+    auto ptr = block->isPrimary() ? pool.primaryPtr : pool.secondaryPtr;
+    auto const blockOffset = block->getMemoryPoolBlockIndex();
+    return tr::ITensor::slice(ptr, blockOffset, 1);
+}
+
+} // namespace
+
+std::shared_ptr<KVCacheSpillManager> KVCacheSpillManager::createFromEnv(std::string const& logPrefix)
+{
+    auto const& directory = common::getEnvKVCacheSpillDirectory();
+    if (directory.empty())
+    {
+        return nullptr;
+    }
+    auto const maxBytes = common::getEnvKVCacheSpillMaxGB() * (static_cast<size_t>(1) << 30);
+    return std::make_shared<KVCacheSpillManager>(directory, maxBytes, logPrefix);
+}
+
+KVCacheSpillManager::KVCacheSpillManager(std::string directory, size_t maxBytes, std::string logPrefix)
+    : mDirectory(std::move(directory))
+    , mMaxBytes(maxBytes)
+    , mLogPrefix(std::move(logPrefix))
+{
+    std::error_code ec;
+    std::filesystem::create_directories(mDirectory, ec);
+    TLLM_CHECK_WITH_INFO(!ec, "Failed to create KV cache spill directory %s: %s", mDirectory.c_str(),
+        ec.message().c_str());
+    mWriterThread = std::thread(&KVCacheSpillManager::writerLoop, this);
+    TLLM_LOG_INFO("%s KV cache spill tier enabled: directory=%s, budget=%zu bytes", mLogPrefix.c_str(),
+        mDirectory.c_str(), mMaxBytes);
+}
+
+KVCacheSpillManager::~KVCacheSpillManager()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShutdown = true;
+    }
+    mTaskCv.notify_all();
+    if (mWriterThread.joinable())
+    {
+        mWriterThread.join();
+    }
+}
+
+std::string KVCacheSpillManager::blockFilename(size_t hash, size_t poolIdx) const
+{
+    return common::fmtstr("%s/spill_%zx_pool_%zu.bin", mDirectory.c_str(), hash, poolIdx);
+}
+
+void KVCacheSpillManager::spill(BlockPtr const& block, std::vector<KVCacheBlockPool> const& pools)
+{
+    if (block->getUniqueTokens().empty() || block->isPrimary())
+    {
+        // Only host-resident blocks with state are spilled; spilling straight from device
+        // would serialize a D2H copy on the critical path.
+        return;
+    }
+
+    auto const hash = block->getHash();
+
+    SpillTask task;
+    task.hash = hash;
+    task.poolBytes.reserve(pools.size());
+    for (auto const& pool : pools)
+    {
+        auto const tensor = blockPoolTensor(block, pool);
+        auto const numBytes = tensor->getSizeInBytes();
+        std::vector<char> bytes(numBytes);
+        // The source lives in pinned host memory; a synchronous memcpy lets the caller
+        // repurpose the block immediately while the file write proceeds in the background.
+        std::memcpy(bytes.data(), tensor->data(), numBytes);
+        task.poolBytes.emplace_back(std::move(bytes));
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mSpilledBlocks.count(hash) > 0 || mPendingWrites.count(hash) > 0)
+        {
+            return;
+        }
+        mPendingWrites[hash] = 1;
+        mTaskQueue.emplace_back(std::move(task));
+    }
+    mTaskCv.notify_one();
+}
+
+bool KVCacheSpillManager::contains(size_t hash) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mSpilledBlocks.count(hash) > 0 || mPendingWrites.count(hash) > 0;
+}
+
+size_t KVCacheSpillManager::getNumSpilledBlocks() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mSpilledBlocks.size();
+}
+
+bool KVCacheSpillManager::onboard(size_t hash, BlockPtr const& dst, std::vector<KVCacheBlockPool> const& pools,
+    runtime::BufferManager const& bufferManager)
+{
+    {
+        // Wait for any queued write of this hash so the files are complete before reading.
+        std::unique_lock<std::mutex> lock(mMutex);
+        mDoneCv.wait(lock, [this, hash] { return mPendingWrites.count(hash) == 0; });
+        auto it = mSpilledBlocks.find(hash);
+        if (it == mSpilledBlocks.end())
+        {
+            return false;
+        }
+        // Refresh LRU position.
+        mLruOrder.erase(it->second.lruIt);
+        it->second.lruIt = mLruOrder.insert(mLruOrder.end(), hash);
+    }
+
+    for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
+    {
+        auto dstTensor = blockPoolTensor(dst, pools.at(poolIdx));
+        auto const numBytes = dstTensor->getSizeInBytes();
+        std::vector<char> bytes(numBytes);
+        std::ifstream file(blockFilename(hash, poolIdx), std::ios::binary);
+        if (!file.read(bytes.data(), static_cast<std::streamsize>(numBytes)))
+        {
+            TLLM_LOG_WARNING("%s Failed to read spilled KV block %zx pool %zu", mLogPrefix.c_str(), hash, poolIdx);
+            return false;
+        }
+        auto const staged
+            = tr::ITensor::wrap(bytes.data(), dstTensor->getDataType(), dstTensor->getShape(), dstTensor->getSize());
+        bufferManager.copy(*staged, *dstTensor);
+        // The staging buffer is stack-owned, so the H2D copy must complete before it goes away.
+        // Disk read latency dominates this path, so the extra sync is acceptable.
+        bufferManager.getStream().synchronize();
+    }
+    return true;
+}
+
+void KVCacheSpillManager::writerLoop()
+{
+    while (true)
+    {
+        SpillTask task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTaskCv.wait(lock, [this] { return mShutdown || !mTaskQueue.empty(); });
+            if (mTaskQueue.empty())
+            {
+                return;
+            }
+            task = std::move(mTaskQueue.front());
+            mTaskQueue.pop_front();
+        }
+        writeTask(task);
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPendingWrites.erase(task.hash);
+            evictUntilWithinBudget();
+        }
+        mDoneCv.notify_all();
+    }
+}
+
+void KVCacheSpillManager::writeTask(SpillTask const& task)
+{
+    size_t totalBytes = 0;
+    for (size_t poolIdx = 0; poolIdx < task.poolBytes.size(); ++poolIdx)
+    {
+        auto const& bytes = task.poolBytes[poolIdx];
+        std::ofstream file(blockFilename(task.hash, poolIdx), std::ios::binary | std::ios::trunc);
+        if (!file.write(bytes.data(), static_cast<std::streamsize>(bytes.size())))
+        {
+            TLLM_LOG_WARNING("%s Failed to spill KV block %zx pool %zu", mLogPrefix.c_str(), task.hash, poolIdx);
+            return;
+        }
+        totalBytes += bytes.size();
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto const lruIt = mLruOrder.insert(mLruOrder.end(), task.hash);
+    mSpilledBlocks.emplace(task.hash, SpillEntry{totalBytes, lruIt});
+    mTotalBytes += totalBytes;
+}
+
+void KVCacheSpillManager::evictUntilWithinBudget()
+{
+    while (mTotalBytes > mMaxBytes && !mLruOrder.empty())
+    {
+        auto const victim = mLruOrder.front();
+        auto const it = mSpilledBlocks.find(victim);
+        TLLM_CHECK(it != mSpilledBlocks.end());
+        for (size_t poolIdx = 0;; ++poolIdx)
+        {
+            auto const filename = blockFilename(victim, poolIdx);
+            if (std::remove(filename.c_str()) != 0)
+            {
+                break;
+            }
+        }
+        mTotalBytes -= it->second.bytes;
+        mLruOrder.pop_front();
+        mSpilledBlocks.erase(it);
+    }
+}
+
+} // namespace tensorrt_llm::batch_manager::kv_cache_manager
@@ -21,8 +21,10 @@
 
 #include "tensorrt_llm/batch_manager/kvCacheEventManager.h"
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/kernels/kvCacheBatchedCopy.h"
 #include "tensorrt_llm/kernels/kvCachePartialCopy.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
@@ -36,6 +38,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -87,6 +90,19 @@ static bool fileToGpuPosix(tr::ITensor::SharedPtr const& dstPtr, std::string con
     return true;
 }
 
+namespace
+{
+
+// Whether a copy qualifies for the batched copy kernel (16-byte aligned, 16-byte multiple size).
+bool isBatchableCopy(tr::ITensor::SharedPtr const& src, tr::ITensor::SharedPtr const& dst)
+{
+    auto const numBytes = src->getSizeInBytes();
+    return numBytes == dst->getSizeInBytes() && numBytes % 16 == 0
+        && reinterpret_cast<uintptr_t>(src->data()) % 16 == 0 && reinterpret_cast<uintptr_t>(dst->data()) % 16 == 0;
+}
+
+} // namespace
+
 KVCacheTransferManager::KVCacheTransferManager(
     tr::BufferManager const& bufferManager, std::shared_ptr<kvc::BaseLoopbackAgent> loopbackAgent)
     : mBufferManager{bufferManager}
@@ -109,6 +125,17 @@ tr::ITensor::SharedPtr KVCacheTransferManager::computeBlockPointer(
     return blockTensor;
 }
 
+tr::ITensor::SharedPtr KVCacheTransferManager::getBlockScales(int32_t offloadBlockId, size_t numPools)
+{
+    auto& scales = mBlockScales[offloadBlockId];
+    if (!scales)
+    {
+        scales = tr::BufferManager::gpuSync(
+            tr::ITensor::makeShape({static_cast<tr::SizeType32>(numPools)}), nvinfer1::DataType::kFLOAT);
+    }
+    return scales;
+}
+
 void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
     std::vector<KVCacheBlockPool> const& pools, bool isOffload, int numTokensToCopy, executor::KvCacheTransferMode mode,
     std::string const& directory)
@@ -120,19 +147,75 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
     {
         TLLM_LOG_DEBUG("Using DRAM-based copy (GPU <-> CPU) for this block.");
 
+        // Cold blocks can be requantized to FP8 on their way to host memory. Only full-block
+        // copies of half/bf16 pools qualify; the onboard path must expand whatever the offload
+        // wrote, so the decision is recorded per offload block.
+        auto const offloadBlockId = (isOffload ? dst : src)->getBlockId();
+        bool compress = false;
+        if (isOffload)
+        {
+            compress = common::getEnvKVCacheOffloadFp8Compression()
+                && std::all_of(pools.begin(), pools.end(),
+                    [numTokensToCopy](KVCacheBlockPool const& pool)
+                    {
+                        auto const dataType = pool.primaryPtr->getDataType();
+                        return (dataType == nvinfer1::DataType::kHALF || dataType == nvinfer1::DataType::kBF16)
+                            && (numTokensToCopy <= 0 || numTokensToCopy >= pool.tokensPerBlock);
+                    });
+            if (compress)
+            {
+                mCompressedOffloads.insert(offloadBlockId);
+            }
+            else
+            {
+                mCompressedOffloads.erase(offloadBlockId);
+            }
+        }
+        else
+        {
+            compress = mCompressedOffloads.count(offloadBlockId) > 0;
+        }
+
         // Iterate over all pools, partial-copy logic
         for (size_t poolIdx = 0; poolIdx < pools.size(); ++poolIdx)
         {
             auto srcPtr = computeBlockPointer(src, pools, poolIdx);
             auto dstPtr = computeBlockPointer(dst, pools, poolIdx);
 
+            if (compress)
+            {
+                // Quantized copies depend on stream order relative to earlier full-block copies
+                // of the same pools, so submit anything still deferred first.
+                flushDeferredCopies();
+                auto stream = (isOffload ? mOffloadManager : mOnboardManager).getStream().get();
+                auto* blockAmax = tr::bufferCast<float>(*getBlockScales(offloadBlockId, pools.size())) + poolIdx;
+                if (isOffload)
+                {
+                    tk::kvCacheBlockQuantizeCopyFp8(*dstPtr, *srcPtr, blockAmax, stream);
+                }
+                else
+                {
+                    tk::kvCacheBlockDequantizeCopyFp8(*dstPtr, *srcPtr, blockAmax, stream);
+                }
+                continue;
+            }
+
             // If no partial tokens or if the dataType is not supported for partial copy, copy entire block.
             if (numTokensToCopy <= 0 || srcPtr->getDataType() == nvinfer1::DataType::kINT4
                 || srcPtr->getDataType() == nvinfer1::DataType::kFP4)
             {
                 // For partial copy not implemented with these data types,
                 // just do a full copy.
-                (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                if (isBatchableCopy(srcPtr, dstPtr))
+                {
+                    // Defer so all blocks flushed in this iteration go out as a few batched launches
+                    // instead of one small memcpy per block per pool.
+                    mDeferredCopies[isOffload ? 1 : 0].push_back(DeferredCopy{srcPtr, dstPtr});
+                }
+                else
+                {
+                    (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                }
             }
             else
             {
@@ -140,10 +223,20 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
                 if (numTokensToCopy >= tokensPerBlock)
                 {
                     // If requested tokens >= entire block, just do a full copy.
-                    (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                    if (isBatchableCopy(srcPtr, dstPtr))
+                    {
+                        mDeferredCopies[isOffload ? 1 : 0].push_back(DeferredCopy{srcPtr, dstPtr});
+                    }
+                    else
+                    {
+                        (isOffload ? mOffloadManager : mOnboardManager).copy(*srcPtr, *dstPtr);
+                    }
                 }
                 else
                 {
+                    // Partial copies depend on stream order relative to earlier full-block copies
+                    // of the same pools, so submit anything still deferred first.
+                    flushDeferredCopies();
                     auto stream = (isOffload ? mOffloadManager : mOnboardManager).getStream().get();
                     int const numLayers = pools[poolIdx].numLayers;
                     int const kvFactor = pools[poolIdx].kvFactor;
@@ -164,6 +257,10 @@ void KVCacheTransferManager::copyBlock(BlockPtr const& src, BlockPtr const& dst,
         return;
     }
 
+    // File-backed transfers read/write pool memory directly; submit deferred copies first to
+    // preserve ordering with respect to them.
+    flushDeferredCopies();
+
     std::vector<kvc::FileDesc> fileBlobs;
     std::vector<kvc::MemoryDesc> memoryBlobs;
 
@@ -231,9 +328,15 @@ void KVCacheTransferManager::onboard(BlockPtr const& offloadBlock, BlockPtr cons
         return;
     }
 
-    if (mPendingOffloads.find(offloadBlock->getBlockId()) != mPendingOffloads.end())
+    if (mDeferredOffloadBlockIds.count(offloadBlock->getBlockId()) > 0)
+    {
+        // The offload this onboard depends on has not been submitted yet.
+        flushDeferredCopies();
+    }
+    auto const pendingIt = mPendingOffloads.find(offloadBlock->getBlockId());
+    if (pendingIt != mPendingOffloads.end() && pendingIt->second != nullptr)
     {
-        mOnboardManager.getStream().wait(mPendingOffloads[offloadBlock->getBlockId()]);
+        mOnboardManager.getStream().wait(*pendingIt->second);
     }
     copyBlock(offloadBlock, block, pools, false, numTokensToCopy, mode, directory);
 }
@@ -242,13 +345,64 @@ void KVCacheTransferManager::offload(BlockPtr const& block, BlockPtr const& offl
     std::vector<KVCacheBlockPool> const& pools, int numTokensToCopy, executor::KvCacheTransferMode mode,
     std::string const& directory)
 {
-    mPendingOffloads[block->getBlockId()] = tr::CudaEvent();
+    auto const sizeBefore = mDeferredCopies[1].size();
     copyBlock(block, offloadBlock, pools, true, numTokensToCopy, mode, directory);
-    mOffloadManager.getStream().record(mPendingOffloads[block->getBlockId()]);
+    if (mDeferredCopies[1].size() > sizeBefore)
+    {
+        // Copy was deferred; the event is recorded for the whole batch when it is flushed.
+        mDeferredOffloadBlockIds.insert(block->getBlockId());
+        mPendingOffloads[block->getBlockId()] = nullptr;
+    }
+    else
+    {
+        auto event = std::make_shared<tr::CudaEvent>();
+        mOffloadManager.getStream().record(*event);
+        mPendingOffloads[block->getBlockId()] = std::move(event);
+    }
+}
+
+void KVCacheTransferManager::flushDeferredCopies()
+{
+    for (int direction = 0; direction < 2; ++direction)
+    {
+        auto& copies = mDeferredCopies[direction];
+        if (copies.empty())
+        {
+            continue;
+        }
+        auto const& stream = (direction == 1 ? mOffloadManager : mOnboardManager).getStream();
+        tk::KvCacheBatchedCopyParams params{};
+        for (size_t idx = 0; idx < copies.size(); idx += tk::kMaxBatchedCopies)
+        {
+            auto const chunk = std::min<size_t>(tk::kMaxBatchedCopies, copies.size() - idx);
+            for (size_t i = 0; i < chunk; ++i)
+            {
+                params.srcs[i] = copies[idx + i].src->data();
+                params.dsts[i] = copies[idx + i].dst->data();
+                params.sizesInBytes[i] = copies[idx + i].src->getSizeInBytes();
+            }
+            params.numCopies = static_cast<int>(chunk);
+            tk::invokeKvCacheBatchedCopy(params, stream.get());
+        }
+        copies.clear();
+
+        if (direction == 1 && !mDeferredOffloadBlockIds.empty())
+        {
+            auto event = std::make_shared<tr::CudaEvent>();
+            stream.record(*event);
+            for (auto const blockId : mDeferredOffloadBlockIds)
+            {
+                mPendingOffloads[blockId] = event;
+            }
+            mDeferredOffloadBlockIds.clear();
+        }
+    }
 }
 
 void KVCacheTransferManager::syncTransfers()
 {
+    flushDeferredCopies();
+
     tr::CudaEvent offloadEvent;
     mOffloadManager.getStream().record(offloadEvent);
 
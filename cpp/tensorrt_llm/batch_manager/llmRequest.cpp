@@ -16,12 +16,61 @@
  */
 
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/tokenScanUtils.h"
 #include "tensorrt_llm/executor/serializeUtils.h"
 #include "tensorrt_llm/kernels/beamSearchKernels.h"
 
+#include <mutex>
+
 namespace tensorrt_llm::batch_manager
 {
 
+namespace
+{
+// Process-wide freelist of token vector storage. Completed requests donate their per-beam vectors
+// here and initialize() draws from it, so under a steady request rate the token vectors keep their
+// grown capacity across requests instead of being reallocated. Bounded by
+// TRTLLM_LLMREQUEST_TOKEN_POOL_SIZE; an empty pool (the default) falls back to plain allocation.
+std::mutex tokenStoragePoolMutex;
+std::vector<std::vector<runtime::TokenIdType>> tokenStoragePool;
+} // namespace
+
+std::vector<runtime::TokenIdType> acquirePooledTokenStorage()
+{
+    {
+        std::scoped_lock<std::mutex> lck(tokenStoragePoolMutex);
+        if (!tokenStoragePool.empty())
+        {
+            auto storage = std::move(tokenStoragePool.back());
+            tokenStoragePool.pop_back();
+            storage.clear();
+            return storage;
+        }
+    }
+    return {};
+}
+
+void recyclePooledTokenStorage(std::vector<runtime::TokenIdType>&& storage)
+{
+    auto const poolSize = common::getEnvLlmRequestTokenPoolSize();
+    if (poolSize == 0 || storage.capacity() == 0)
+    {
+        return;
+    }
+    std::scoped_lock<std::mutex> lck(tokenStoragePoolMutex);
+    if (tokenStoragePool.size() < poolSize)
+    {
+        tokenStoragePool.push_back(std::move(storage));
+    }
+}
+
+std::size_t requestHostMemoryBudgetBytes()
+{
+    static std::size_t const budgetBytes = common::getEnvRequestHostMemoryBudgetMb() * (1024ULL * 1024ULL);
+    return budgetBytes;
+}
+
 template <typename TTensor, typename TStream>
 runtime::SizeType32 GenericLlmRequest<TTensor, TStream>::getBeamWidthByIter(bool const forNextIteration)
 {
@@ -46,7 +95,7 @@ std::optional<executor::Response> LlmRequest::createResponse(bool useFastLogits,
     auto result = createResult(useFastLogits, mpiWorldRank);
     if (result.has_value())
     {
-        return executor::Response(requestId, result.value(), mClientId);
+        return executor::Response(requestId, std::move(result.value()), mClientId);
     }
     return std::nullopt;
 }
@@ -57,11 +106,12 @@ void LlmRequest::createSerializedResult(
     auto result = createResult(useFastLogits, mpiWorldRank);
     if (result.has_value())
     {
-        std::ostringstream oStream;
+        // Size the buffer up front and serialize straight into it; staging through an
+        // ostringstream would copy the payload two more times.
+        serializedResult.resize(executor::serialize_utils::serializedSize(result.value()));
+        executor::serialize_utils::VectorSinkBuf<char> sinkBuf{serializedResult};
+        std::ostream oStream(&sinkBuf);
         executor::serialize_utils::serialize(result.value(), oStream);
-        auto str = oStream.str();
-        serializedResult.resize(str.size());
-        std::copy(str.begin(), str.end(), serializedResult.begin());
         isFinal = result.value().isFinal;
     }
 }
@@ -148,8 +198,29 @@ std::optional<executor::Result> LlmRequest::createResult(bool useFastLogits, int
 
     if (returnLogProbs())
     {
+        // the packed wire encoding is applied by the serializer, createResult always fills plain floats
+        result.packedLogProbs = packedLogProbs();
         result.cumLogProbs = sliceBeams(getCumLogProbs());
-        result.logProbs = sliceBeams(getLogProbs());
+        if (mIsStreaming && !mReturnAllGeneratedTokens && returnDeltaLogProbs())
+        {
+            // Only ship the log probs of tokens that have not been sent yet; clients stitch the deltas
+            // together using logProbsOffset, so the payload stays constant over the generation.
+            auto const startGenTokenPos = startTokenPos - getOrigPromptLen();
+            std::vector<VecLogProbs> deltaLogProbs;
+            deltaLogProbs.reserve(nbBeams);
+            for (SizeType32 beam = 0; beam < nbBeams; ++beam)
+            {
+                auto const& beamLogProbs = getLogProbs(beam);
+                auto const beamStart = std::min<std::size_t>(startGenTokenPos, beamLogProbs.size());
+                deltaLogProbs.emplace_back(beamLogProbs.begin() + beamStart, beamLogProbs.end());
+            }
+            result.logProbs = std::move(deltaLogProbs);
+            result.logProbsOffset = startGenTokenPos;
+        }
+        else
+        {
+            result.logProbs = sliceBeams(getLogProbs());
+        }
     }
 
     if (getReturnContextLogits())
@@ -166,6 +237,11 @@ std::optional<executor::Result> LlmRequest::createResult(bool useFastLogits, int
             TensorPtr generationLogitsHostCurrentStep
                 = runtime::ITensor::slice(getGenerationLogitsHost(), startGenTokenPos, maxNbTokensOut);
             result.generationLogits = executor::detail::ofITensor(generationLogitsHostCurrentStep);
+            if (getTopKLogits().has_value())
+            {
+                result.generationLogitsTopKIndices = executor::detail::ofITensor(
+                    runtime::ITensor::slice(getGenerationLogitsTopKIndicesHost(), startGenTokenPos, maxNbTokensOut));
+            }
         }
         else if (useFastLogits)
         {
@@ -233,8 +309,7 @@ bool LlmRequest::checkTokenIdRange(SizeType32 vocabSize)
 
     // Before generation, all beams contain the same tokens
     auto const& tokens = getTokens(0);
-    return std::all_of(
-        tokens.begin(), tokens.end(), [&vocabSize](auto const& token) { return token >= 0 && token < vocabSize; });
+    return common::allTokensInRange(tokens.data(), tokens.size(), 0, vocabSize);
 }
 
 void LlmRequest::validate(SizeType32 maxInputLen, SizeType32 maxSequenceLen, SizeType32 maxDraftLen,
@@ -20,9 +20,14 @@
 #include "tensorrt_llm/batch_manager/decoderBuffers.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
 #include "tensorrt_llm/batch_manager/runtimeBuffers.h"
+#include "tensorrt_llm/batch_manager/utils/staticThreadPool.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 
+#include <future>
+
 namespace tr = tensorrt_llm::runtime;
 
 namespace tensorrt_llm::batch_manager
@@ -32,6 +37,17 @@ using TensorPtr = runtime::ITensor::SharedPtr;
 using ITensor = runtime::ITensor;
 using SizeType32 = tensorrt_llm::runtime::SizeType32;
 
+LogitsPostProcessor::LogitsPostProcessor()
+{
+    auto const numWorkers = common::getEnvLogitsPostProcessorWorkers();
+    if (numWorkers > 0)
+    {
+        mWorkerPool = std::make_unique<utils::StaticThreadPool>(numWorkers);
+    }
+}
+
+LogitsPostProcessor::~LogitsPostProcessor() = default;
+
 bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool replicateLogitsPostProcessor,
     tr::WorldConfig const& worldConfig, CudaStreamPtr const& stream,
     std::optional<LogitsPostProcessorBatched> const& logitsPostProcessorBatched) const
@@ -45,6 +61,10 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
     std::vector<std::reference_wrapper<LlmRequest::BeamTokens const>> beamTokensVec;
     std::vector<std::optional<LlmRequest::RequestIdType>> clientIdsVec;
 
+    // Futures of callbacks dispatched to the worker pool
+    std::vector<std::future<void>> callbackFutures;
+    auto const device = common::getDevice();
+
     bool logitsPostProcessorIsApplied = false;
     for (size_t batchIdx = 0; batchIdx < inputBuffers.decoderRequests.size(); ++batchIdx)
     {
@@ -57,8 +77,23 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
             logitsPostProcessorIsApplied = true;
             if (replicateLogitsPostProcessor || worldConfig.isFirstTensorParallelRank())
             {
-                (*llmReq->mLogitsPostProcessor)(
-                    llmReq->mRequestId, logits, llmReq->getTokens(), stream, llmReq->mClientId);
+                if (mWorkerPool)
+                {
+                    // Callbacks of different requests touch disjoint logits tensors and enqueueing
+                    // to the stream is thread safe, so they may run concurrently.
+                    callbackFutures.push_back(mWorkerPool->execute(
+                        [llmReq, logitsPtr = &logits, stream, device]()
+                        {
+                            TLLM_CUDA_CHECK(cudaSetDevice(device));
+                            (*llmReq->mLogitsPostProcessor)(
+                                llmReq->mRequestId, *logitsPtr, llmReq->getTokens(), stream, llmReq->mClientId);
+                        }));
+                }
+                else
+                {
+                    (*llmReq->mLogitsPostProcessor)(
+                        llmReq->mRequestId, logits, llmReq->getTokens(), stream, llmReq->mClientId);
+                }
             }
         }
         else if (llmReq->mApplyLogitsPostProcessorBatched)
@@ -70,7 +105,7 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
         }
     }
 
-    // Invoke batched processor
+    // Invoke batched processor; it runs on the model thread and overlaps the dispatched callbacks
     if (!reqIdsVec.empty())
     {
         logitsPostProcessorIsApplied = true;
@@ -80,6 +115,12 @@ bool LogitsPostProcessor::operator()(DecoderInputBuffers& inputBuffers, bool rep
         }
     }
 
+    // Completion barrier: sampling must not start before every callback has issued its work
+    for (auto& future : callbackFutures)
+    {
+        future.get();
+    }
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 
     return logitsPostProcessorIsApplied;
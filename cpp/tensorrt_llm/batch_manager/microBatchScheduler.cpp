@@ -17,13 +17,32 @@
 
 #include "tensorrt_llm/batch_manager/microBatchScheduler.h"
 #include "tensorrt_llm/batch_manager/utils/inflightBatchingUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 
+#include <cmath>
+
 namespace tensorrt_llm::batch_manager
 {
 
 using SizeType32 = MicroBatchScheduler::SizeType32;
 
+namespace
+{
+//! Largest chunk whose predicted cost matches that of processing refChunkSize fresh tokens, given
+//! pastLength cached tokens that every new token attends to. costLength calibrates how many tokens
+//! of linear (GEMM) work cost as much as attending to one cached token per new token, so the
+//! predicted cost of a chunk of x tokens is x * (1 + pastLength / costLength) + x^2 / (2 * costLength).
+SizeType32 equalCostChunkSize(SizeType32 refChunkSize, SizeType32 pastLength, SizeType32 costLength)
+{
+    auto const ref = static_cast<float>(refChunkSize);
+    auto const lin = static_cast<float>(costLength);
+    float const target = ref * (1.F + ref / (2.F * lin));
+    float const b = 1.F + static_cast<float>(pastLength) / lin;
+    return static_cast<SizeType32>((std::sqrt(b * b + 2.F * target / lin) - b) * lin);
+}
+} // namespace
+
 MicroBatchScheduler::MicroBatchScheduler(std::optional<batch_scheduler::ContextChunkingConfig> ctxChunkConfig,
     std::optional<SizeType32> maxContextLength, LlmRequestState noScheduleUntilState,
     LlmRequestState noScheduleAfterState)
@@ -164,6 +183,34 @@ void MicroBatchScheduler::setCtxRequestsChunkSize(RequestVector& contextsToBeChu
     default: TLLM_THROW("The chunked scheduling type `NO_CHUNKING` cannot be performed.");
     }
 
+    // Optionally adapt the chunk sizes to the cached prefix length. With fixed-size chunks, every
+    // successive chunk of a long prompt attends to a longer kv prefix, so late chunks take much
+    // longer than the first one and stretch the iterations of co-scheduled generation requests.
+    // Shrinking a chunk to the size whose predicted cost matches a fresh chunk of the assigned size
+    // keeps the iteration time - and thus the inter-token latency - flat while long prompts prefill.
+    auto const costLength = common::getEnvAdaptiveChunkingCostLength();
+    if (costLength > 0)
+    {
+        for (auto& llmReq : contextsToBeChunked)
+        {
+            auto const pastLength = llmReq->getContextCurrentPosition();
+            auto const chunkSize = llmReq->getContextChunkSize();
+            if (pastLength == 0 || chunkSize <= chunkUnitSize)
+            {
+                continue;
+            }
+            auto adaptedSize = equalCostChunkSize(chunkSize, pastLength, costLength);
+            // Keep whole chunk units and always progress by at least one unit.
+            adaptedSize = std::max(chunkUnitSize, adaptedSize / chunkUnitSize * chunkUnitSize);
+            if (adaptedSize < chunkSize)
+            {
+                TLLM_LOG_DEBUG("Adaptive chunking: request ID %lu chunk size %d -> %d (past kv length %d)",
+                    llmReq->mRequestId, chunkSize, adaptedSize, pastLength);
+                llmReq->setContextChunkSize(adaptedSize);
+            }
+        }
+    }
+
     // After scheduling chunk sizes, discard draft tokens that won't fit.
     fitDraftTokens(contextsToBeChunked, ctxTokensCapacity, chunkUnitSize, maxContextLength);
 }
@@ -184,6 +231,27 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
     SizeType32 numChunkedTokens{0};
     bool allContextRequestsFit{true};
 
+    // Optional per-kind token cost model: context and draft-verify tokens are weighted by their
+    // measured cost relative to a plain decode token, and the weighted sum is held against the
+    // iteration token budget. With unit weights (the default) this degenerates to token counting.
+    float const ctxTokenWeight = common::getEnvSchedCtxTokenWeight();
+    float const draftTokenWeight = common::getEnvSchedDraftTokenWeight();
+    float batchCost{0.F};
+    float numChunkedCost{0.F};
+
+    // Optional split of the iteration token budget: cap the share context/encoder tokens may
+    // take so a burst of long prompts cannot crowd out generation requests and inflate
+    // inter-token latency. Generation tokens keep the full budget.
+    std::optional<SizeType32> maxCtxTokens;
+    auto const ctxFraction = common::getEnvCtxTokenBudgetFraction();
+    if (ctxFraction > 0.F && maxNumTokensRuntime)
+    {
+        // Never drop below one chunk unit, otherwise context requests could starve instead.
+        maxCtxTokens = std::max<SizeType32>(mCtxChunkConfig ? mCtxChunkConfig->chunkUnitSize : 1,
+            static_cast<SizeType32>(ctxFraction * static_cast<float>(maxNumTokensRuntime.value())));
+    }
+    SizeType32 numCtxScheduledTokens{0};
+
     // 1. Select the generation phase requests that meet the criteria of total token size.
     //    If there is any remaining space, include the context requests and divide them into chunks.
     for (auto& llmReq : activeRequests)
@@ -201,37 +269,60 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
         }
 
         SizeType32 reqNumTokens = 0;
+        float reqCost = 0.F;
         if (llmReq->isEncoderInitState())
         {
             reqNumTokens = llmReq->getEncoderOutputLen();
+            reqCost = static_cast<float>(reqNumTokens) * ctxTokenWeight;
             TLLM_CHECK_WITH_INFO(!mMaxContextLength || reqNumTokens <= mMaxContextLength.value(),
                 "The number of encoder tokens (%d) exceeds the limit value (%d)", reqNumTokens,
                 mMaxContextLength.value());
-            if (maxNumTokensRuntime && batchNumTokens + reqNumTokens > maxNumTokensRuntime.value())
+            if (maxNumTokensRuntime && batchCost + reqCost > static_cast<float>(maxNumTokensRuntime.value()))
             {
-                break;
+                // Encoder batches mix widely varying lengths (embedding/rerank workloads) and have
+                // no chunking to fall back on, so keep scanning for shorter requests that still fit
+                // into the token budget instead of stopping at the first one that does not. Arrival
+                // order is preserved across iterations, so a skipped long request is packed first
+                // once the batch drains.
+                continue;
+            }
+            if (maxCtxTokens && numCtxScheduledTokens + reqNumTokens > maxCtxTokens.value())
+            {
+                // Context budget exhausted; keep scanning for generation requests.
+                continue;
             }
             TLLM_LOG_DEBUG("encoder request scheduled: ID %u", llmReq->mRequestId);
             contextRequests.emplace_back(llmReq);
             batchNumTokens += reqNumTokens;
+            batchCost += reqCost;
+            numCtxScheduledTokens += reqNumTokens;
         }
         else if (llmReq->isContextInitState())
         {
             if (!mCtxChunkConfig) // skip chunking
             {
                 constexpr SizeType32 beam{0};
-                reqNumTokens
-                    = llmReq->getNumTokens(beam) + (llmReq->hasDraftTokens() ? llmReq->getNumDraftTokens() : 0);
+                auto const draftTokens = llmReq->hasDraftTokens() ? llmReq->getNumDraftTokens() : 0;
+                reqNumTokens = llmReq->getNumTokens(beam) + draftTokens;
+                reqCost = static_cast<float>(llmReq->getNumTokens(beam)) * ctxTokenWeight
+                    + static_cast<float>(draftTokens) * draftTokenWeight;
                 TLLM_CHECK_WITH_INFO(!mMaxContextLength || reqNumTokens <= mMaxContextLength.value(),
                     "The number of context tokens (%d) exceeds the limit value (%d)", reqNumTokens,
                     mMaxContextLength.value());
-                if (maxNumTokensRuntime && batchNumTokens + reqNumTokens > maxNumTokensRuntime.value())
+                if (maxNumTokensRuntime && batchCost + reqCost > static_cast<float>(maxNumTokensRuntime.value()))
                 {
                     break;
                 }
+                if (maxCtxTokens && numCtxScheduledTokens + reqNumTokens > maxCtxTokens.value())
+                {
+                    // Context budget exhausted; keep scanning for generation requests.
+                    continue;
+                }
                 TLLM_LOG_DEBUG("context request scheduled: ID %u", llmReq->mRequestId);
                 contextRequests.emplace_back(llmReq);
                 batchNumTokens += reqNumTokens;
+                batchCost += reqCost;
+                numCtxScheduledTokens += reqNumTokens;
             }
             else
             {
@@ -251,6 +342,9 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
                 }
                 contextsToBeChunked.emplace_back(llmReq);
                 numChunkedTokens += reqNumTokens;
+                // Draft tokens riding on the last context chunk are verified alongside the prefill,
+                // so both parts carry the context weight here.
+                numChunkedCost += static_cast<float>(reqNumTokens) * ctxTokenWeight;
                 TLLM_LOG_DEBUG("contexts-to-be-chunked request scheduled: ID %u", llmReq->mRequestId);
             }
         }
@@ -258,7 +352,9 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
         {
             auto const reqBeamWidth = llmReq->getBeamWidthByIter();
             reqNumTokens = reqBeamWidth + llmReq->getNumDraftTokens();
-            if (maxNumTokensRuntime && batchNumTokens + reqNumTokens > maxNumTokensRuntime.value())
+            reqCost = static_cast<float>(reqBeamWidth)
+                + static_cast<float>(llmReq->getNumDraftTokens()) * draftTokenWeight;
+            if (maxNumTokensRuntime && batchCost + reqCost > static_cast<float>(maxNumTokensRuntime.value()))
             {
                 break;
             }
@@ -276,6 +372,7 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
             TLLM_LOG_DEBUG("generation request scheduled: ID %u with beam width %d", llmReq->mRequestId, reqBeamWidth);
             generationRequests.emplace_back(llmReq);
             batchNumTokens += reqNumTokens;
+            batchCost += reqCost;
         }
 
         if (++scheduledReqSize >= maxBatchSizeRuntime)
@@ -284,7 +381,14 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
         }
     }
 
-    if (maxNumTokensRuntime && numChunkedTokens > maxNumTokensRuntime.value() - batchNumTokens)
+    auto const ctxBudgetLeft = maxCtxTokens
+        ? std::make_optional(std::max(0, maxCtxTokens.value() - numCtxScheduledTokens))
+        : std::nullopt;
+    if (maxNumTokensRuntime && numChunkedCost > static_cast<float>(maxNumTokensRuntime.value()) - batchCost)
+    {
+        allContextRequestsFit = false;
+    }
+    if (ctxBudgetLeft && numChunkedTokens > ctxBudgetLeft.value())
     {
         allContextRequestsFit = false;
     }
@@ -293,8 +397,16 @@ std::tuple<RequestVector, RequestVector> MicroBatchScheduler::operator()(Request
     if (!allContextRequestsFit)
     {
         TLLM_CHECK_WITH_INFO(mCtxChunkConfig, "If chunking is not enabled, context scheduling should be completed.");
-        auto const ctxTokensCapacity
-            = maxNumTokensRuntime ? std::make_optional(maxNumTokensRuntime.value() - batchNumTokens) : std::nullopt;
+        // Chunk sizing works in raw context tokens, so convert the remaining weighted budget back.
+        auto ctxTokensCapacity = maxNumTokensRuntime
+            ? std::make_optional(static_cast<SizeType32>(
+                std::max(0.F, (static_cast<float>(maxNumTokensRuntime.value()) - batchCost) / ctxTokenWeight)))
+            : std::nullopt;
+        if (ctxBudgetLeft)
+        {
+            ctxTokensCapacity
+                = ctxTokensCapacity ? std::min(ctxTokensCapacity.value(), ctxBudgetLeft.value()) : ctxBudgetLeft;
+        }
         setCtxRequestsChunkSize(contextsToBeChunked, mCtxChunkConfig.value().chunkingPolicy, ctxTokensCapacity,
             mCtxChunkConfig.value().chunkUnitSize, mMaxContextLength);
     }
@@ -211,6 +211,12 @@ void MLACacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& ses
         return bufferSizeForTarget;
     };
     auto bufferEleSizes = getBufferSizeForTarget();
+    if (session.isCancelled())
+    {
+        // Bail out before grabbing a transfer buffer slot; the peer's pending recv is bounded by
+        // the transfer timeout, the same as any other mid-transfer failure.
+        TLLM_THROW("KV cache send for request %ld was cancelled", llmRequest.mRequestId);
+    }
     auto cacheBufferId = mCacheTransBufferManager->assignBufferIndexForSend();
     auto result = mCacheTransBufferManager->getOrAllocateSendBuffers(
         cacheBufferId, static_cast<int>(pPDomainSize * cPDomainSize), bufferEleSizes, bufferManager);
@@ -224,6 +230,8 @@ void MLACacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& ses
             bufferCoverTargetNum == pPDomainSize * cPDomainSize, "Agent need all buffer pre-allocated");
         TLLM_CHECK(onlyUseDynamicBuffer == false);
     }
+    // Channel striping is tag-based and thus UCX-only; the agent backend keeps one descriptor per transfer.
+    auto const numChannels = agentConnnecion == nullptr ? common::getEnvKVCacheTransferNumChannels() : size_t{1};
 
     // The size of outputSplitCaches should be equal to pPDomainSize * cPDomainSize.
     SizeType32 window = mCacheManager->getBlockManager().getPoolWindowSize(0);
@@ -243,13 +251,17 @@ void MLACacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& ses
     {
         NVTX3_SCOPED_RANGE(sendBufferFun);
 
+        if (session.isCancelled())
+        {
+            return;
+        }
         TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
         auto startTime = llmRequest.getSteadyClockNow();
         auto cacheIdx = processIdx % (pPDomainSize * cPDomainSize);
         if (cacheIdx < bufferCoverTargetNum)
         {
             size_t size = outputSplitCaches.at(cacheIdx)->getSizeInBytes();
-            session.send(processIdx, outputSplitCaches.at(cacheIdx)->data(), size);
+            session.sendStriped(processIdx, outputSplitCaches.at(cacheIdx)->data(), size, numChannels);
         }
         else
         {
@@ -264,6 +276,10 @@ void MLACacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& ses
             auto sendBufferUsed = bufferCoverTargetNum == 0 ? preAllocSendBuffer : outputSplitCaches.at(sendBufferIdx);
             while (remainSendSize > 0)
             {
+                if (session.isCancelled())
+                {
+                    return;
+                }
                 TLLM_CHECK(sendBufferUsed != nullptr);
                 auto sendBufferEleSize = sendBufferUsed->getSize();
                 auto sendSize = std::min(remainSendSize, sendBufferEleSize);
@@ -330,6 +346,12 @@ void MLACacheFormatter::format(tensorrt_llm::batch_manager::TransferSession& ses
         sendBufferFun(deviceId, 0);
     }
     mCacheTransBufferManager->freeBufferIndexForSend(cacheBufferId);
+    if (session.isCancelled())
+    {
+        // The slot is released above; surface the abort so the sender marks the request failed
+        // instead of completed.
+        TLLM_THROW("KV cache send for request %ld was cancelled", llmRequest.mRequestId);
+    }
 
     TLLM_LOG_DEBUG(
         mpi::MpiComm::world().getRank(), "End the sending of KV cache for the request ID: %ld.", llmRequest.mRequestId);
@@ -402,6 +424,12 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
         }
         else
         {
+            if (session.isCancelled())
+            {
+                // Bail out before grabbing a transfer buffer slot; the peer's pending send is
+                // bounded by the transfer timeout, the same as any other mid-transfer failure.
+                TLLM_THROW("KV cache reception for request %ld was cancelled", llmRequest.mRequestId);
+            }
             cacheBufferId = mCacheTransBufferManager->assignBufferIndexForRecv();
         }
 
@@ -439,6 +467,9 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
             TLLM_CHECK_WITH_INFO(bufferCoverTargetNum == targetNum, "Agent need buffer pre-allocated");
             TLLM_CHECK(onlyUseDynamicBuffer == false);
         }
+        // Matches the channel count the sending side stripes with; see format().
+        auto const numChannels
+            = agentConnnecion == nullptr ? common::getEnvKVCacheTransferNumChannels() : size_t{1};
         bufferManager.getStream().synchronize();
 
         auto preAllocRecvBuffer = mCacheTransBufferManager->getRecvBuffer(cacheBufferId);
@@ -450,6 +481,10 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
         auto recvBufferFun = [&](int deviceId, size_t processIdx)
         {
             NVTX3_SCOPED_RANGE(recvBufferFun);
+            if (session.isCancelled())
+            {
+                return;
+            }
             TLLM_CUDA_CHECK(cudaSetDevice(deviceId));
             auto startTime = llmRequest.getSteadyClockNow();
             size_t size = 0;
@@ -458,7 +493,8 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
                 auto& buffer = recvSplitCaches.at(processIdx);
                 llmRequest.updateKvCacheSize(buffer->getSizeInBytes());
                 size = buffer->getSizeInBytes();
-                session.recv(pickUpConnections.at(processIdx), buffer->data(), buffer->getSizeInBytes());
+                session.recvStriped(
+                    pickUpConnections.at(processIdx), buffer->data(), buffer->getSizeInBytes(), numChannels);
             }
             else
             {
@@ -470,6 +506,10 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
                 size_t needRecvSize = recvSplitCaches.at(processIdx)->getSize();
                 while (remainRecvSize > 0)
                 {
+                    if (session.isCancelled())
+                    {
+                        return;
+                    }
                     TLLM_CHECK(recvBufferUsed != nullptr);
                     auto recvBufferEleSize = recvBufferUsed->getSize();
                     auto recvSize = std::min(remainRecvSize, recvBufferEleSize);
@@ -542,6 +582,17 @@ void MLACacheFormatter::unformat(tensorrt_llm::batch_manager::TransferSession& s
             recvBufferFun(deviceId, 0);
         }
 
+        if (session.isCancelled())
+        {
+            // Drop the partial data: release the slot now and surface the abort so the receiver
+            // marks the request failed instead of completed.
+            if (cacheBufferId.has_value())
+            {
+                mCacheTransBufferManager->freeBufferIndexForRecv(cacheBufferId);
+            }
+            TLLM_THROW("KV cache reception for request %ld was cancelled", llmRequest.mRequestId);
+        }
+
         {
             std::map<SizeType32, std::vector<runtime::ITensor::SharedPtr>> outputCachesPerWindow;
             SizeType32 window = mCacheManager->getBlockManager().getPoolWindowSize(0);
@@ -32,6 +32,8 @@
 
 #include <NvInferRuntime.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -44,6 +46,17 @@
 namespace tensorrt_llm::batch_manager
 {
 
+namespace
+{
+// Multiplicative decay applied to a task's popularity score per request arrival, so adapters that
+// stop being requested fall out of the prefetch candidate set after a few hundred arrivals.
+constexpr float kTaskScoreDecay = 0.95F;
+// Tasks whose decayed score falls below this are not worth staging speculatively.
+constexpr float kMinPrefetchScore = 0.5F;
+// Upper bound on background copies started per prefetch pass, to bound PCIe pressure.
+constexpr size_t kMaxPrefetchTasksPerPass = 4;
+} // namespace
+
 PeftTaskNotCachedException::PeftTaskNotCachedException(std::string const& msg)
     : runtime::LoraExpectedException(msg)
 {
@@ -158,6 +171,10 @@ PeftCacheManager::getPageManagerConfig(PeftCacheManagerConfig const& config, run
     TLLM_CHECK(std::numeric_limits<SizeType32>::max() >= numSlotsPerPage);
     TLLM_CHECK(std::numeric_limits<SizeType32>::max() >= pageWidth);
 
+    // TODO: storing device pages in FP8 would double the slot count computed above, but the LoRA
+    // grouped GEMMs (kernels/groupGemm.cu) are Sm80 tensor-op kernels with same-type operands, so
+    // FP8-resident weights would need a dequant pass on every layer of every step. Revisit once the
+    // grouped path gains SM90 kernels that can consume e4m3 directly.
     runtime::LoraCachePageManagerConfig hostPageConfig(runtime::MemoryType::kCPU, modelConfig.getDataType(),
         totalHostPages, config.maxPagesPerBlockHost, numSlotsPerPage, pageWidth, 0);
     runtime::LoraCachePageManagerConfig devicePageConfig(runtime::MemoryType::kGPU, modelConfig.getDataType(),
@@ -286,6 +303,7 @@ void PeftCacheManager::addRequestPeft(std::shared_ptr<LlmRequest> llmRequest, bo
     TLLM_LOG_DEBUG("addRequestPeft taskId=" + std::to_string(taskId) + " reqId=" + std::to_string(reqId));
 
     updateTaskState(taskId, reqId);
+    recordTaskArrival(taskId);
     {
         // if we are already processing this task we are done
         std::lock_guard<std::mutex> lk(mPutFuturesMutex);
@@ -471,6 +489,86 @@ PeftCacheManager::PeftTable PeftCacheManager::ensureBatch(
     return peftTable;
 }
 
+void PeftCacheManager::recordTaskArrival(uint64_t taskId)
+{
+    std::lock_guard<std::mutex> lk(mTaskScoresMutex);
+    ++mTaskArrivalCount;
+    auto& entry = mTaskScores[taskId];
+    entry.score
+        = entry.score * std::pow(kTaskScoreDecay, static_cast<float>(mTaskArrivalCount - entry.lastArrival)) + 1.0F;
+    entry.lastArrival = mTaskArrivalCount;
+}
+
+void PeftCacheManager::prefetchTasks(std::vector<uint64_t> const& queuedTaskIds)
+{
+    TLLM_LOG_DEBUG("%s start", __PRETTY_FUNCTION__);
+    // Rank the candidates: tasks visible in the queue are staged first, then recently popular tasks
+    // that may arrive again before the next pass.
+    std::vector<uint64_t> candidates;
+    std::unordered_set<uint64_t> seen;
+    for (auto const taskId : queuedTaskIds)
+    {
+        if (seen.insert(taskId).second)
+        {
+            candidates.push_back(taskId);
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lk(mTaskScoresMutex);
+        std::vector<std::pair<float, uint64_t>> scored;
+        scored.reserve(mTaskScores.size());
+        for (auto const& [taskId, entry] : mTaskScores)
+        {
+            if (seen.count(taskId))
+            {
+                continue;
+            }
+            auto const score = entry.score
+                * std::pow(kTaskScoreDecay, static_cast<float>(mTaskArrivalCount - entry.lastArrival));
+            if (score >= kMinPrefetchScore)
+            {
+                scored.emplace_back(score, taskId);
+            }
+        }
+        std::sort(scored.rbegin(), scored.rend());
+        for (auto const& [score, taskId] : scored)
+        {
+            candidates.push_back(taskId);
+        }
+    }
+
+    // Registering the copy in mPutFutures makes ensureBatch wait for an in-flight prefetch of the
+    // same task instead of racing it through a second copyTask.
+    size_t started = 0;
+    std::lock_guard<std::mutex> lk(mPutFuturesMutex);
+    for (auto const taskId : candidates)
+    {
+        if (started >= kMaxPrefetchTasksPerPass)
+        {
+            break;
+        }
+        if (mPutFutures.count(taskId) || !mHostLoraCache->isLoaded(taskId) || mDeviceLoraCache->has(taskId))
+        {
+            continue;
+        }
+        auto fn = [taskId, this]()
+        {
+            try
+            {
+                mHostLoraCache->copyTask(taskId, *mDeviceLoraCache, false);
+            }
+            catch (std::runtime_error const& e)
+            {
+                // Prefetch is best effort; a full device cache or a concurrent load is not an error.
+                TLLM_LOG_DEBUG("failed to prefetch task " + std::to_string(taskId) + " to gpu cache -- " + e.what());
+            }
+        };
+        mPutFutures.try_emplace(taskId, mPutWorkerPool->enqueue(fn));
+        started++;
+    }
+    TLLM_LOG_DEBUG("%s stop", __PRETTY_FUNCTION__);
+}
+
 bool PeftCacheManager::isTaskCached(uint64_t taskId) const
 {
     return mHostLoraCache->has(taskId);
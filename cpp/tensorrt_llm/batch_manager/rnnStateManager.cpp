@@ -113,4 +113,76 @@ void RnnStateManager::fillSlotMapping(
     }
 }
 
+void RnnStateManager::copySequenceSlots(StateSnapshot const& snapshot, SizeType32 seqSlotIdx, bool toSnapshot,
+    tensorrt_llm::runtime::BufferManager const& bufferManager)
+{
+    auto const localNbLayers = static_cast<SizeType32>(pagedRnnStates->getShape().d[0]);
+    auto const slotIdx = seqSlotIdx * mBeamSlotsPerSequence;
+    for (SizeType32 i = 0; i < localNbLayers; i++)
+    {
+        auto layerRnnStates = tensorrt_llm::runtime::ITensor::slice(pagedRnnStates, i, 1);
+        auto layerConvStates = tensorrt_llm::runtime::ITensor::slice(pagedConvStates, i, 1);
+        layerRnnStates->squeeze(0);
+        layerConvStates->squeeze(0);
+        auto slotRnnStates = tensorrt_llm::runtime::ITensor::slice(layerRnnStates, slotIdx, mBeamSlotsPerSequence);
+        auto slotConvStates = tensorrt_llm::runtime::ITensor::slice(layerConvStates, slotIdx, mBeamSlotsPerSequence);
+        auto layerRnnSnapshot = tensorrt_llm::runtime::ITensor::slice(snapshot.rnnStates, i, 1);
+        auto layerConvSnapshot = tensorrt_llm::runtime::ITensor::slice(snapshot.convStates, i, 1);
+        layerRnnSnapshot->squeeze(0);
+        layerConvSnapshot->squeeze(0);
+        if (toSnapshot)
+        {
+            bufferManager.copy(*slotRnnStates, *layerRnnSnapshot);
+            bufferManager.copy(*slotConvStates, *layerConvSnapshot);
+        }
+        else
+        {
+            bufferManager.copy(*layerRnnSnapshot, *slotRnnStates);
+            bufferManager.copy(*layerConvSnapshot, *slotConvStates);
+        }
+    }
+}
+
+void RnnStateManager::offloadSequenceState(
+    std::uint64_t requestId, SizeType32 seqSlotIdx, tensorrt_llm::runtime::BufferManager const& bufferManager)
+{
+    TLLM_CHECK(seqSlotIdx < mMaxNumSequences);
+
+    auto& snapshot = mOffloadedStates[requestId];
+    if (!snapshot.rnnStates)
+    {
+        auto rnnSnapshotShape = pagedRnnStates->getShape();
+        auto convSnapshotShape = pagedConvStates->getShape();
+        rnnSnapshotShape.d[1] = mBeamSlotsPerSequence;
+        convSnapshotShape.d[1] = mBeamSlotsPerSequence;
+        snapshot.rnnStates = BufferManager::pinned(rnnSnapshotShape, pagedRnnStates->getDataType());
+        snapshot.convStates = BufferManager::pinned(convSnapshotShape, pagedConvStates->getDataType());
+    }
+    copySequenceSlots(snapshot, seqSlotIdx, true, bufferManager);
+}
+
+bool RnnStateManager::onboardSequenceState(
+    std::uint64_t requestId, SizeType32 seqSlotIdx, tensorrt_llm::runtime::BufferManager const& bufferManager)
+{
+    auto const it = mOffloadedStates.find(requestId);
+    if (it == mOffloadedStates.end())
+    {
+        return false;
+    }
+    TLLM_CHECK(seqSlotIdx < mMaxNumSequences);
+
+    auto const snapshot = std::move(it->second);
+    mOffloadedStates.erase(it);
+    copySequenceSlots(snapshot, seqSlotIdx, false, bufferManager);
+    // The pinned snapshot is released on return, so make sure the copies issued on the manager's
+    // stream have consumed it.
+    bufferManager.getStream().synchronize();
+    return true;
+}
+
+void RnnStateManager::releaseSequenceState(std::uint64_t requestId)
+{
+    mOffloadedStates.erase(requestId);
+}
+
 } // namespace tensorrt_llm::batch_manager::rnn_state_manager
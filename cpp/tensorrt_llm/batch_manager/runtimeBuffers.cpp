@@ -302,7 +302,11 @@ void RuntimeBuffers::reshape(TllmRuntime const& runtime, ModelConfig const& mode
             auto const& engine = runtime.getEngine();
             auto const& manager = runtime.getBufferManager();
             auto const logitsType = engine.getTensorDataType(kLogitsTensorName);
-            logits = manager.gpu(ITensor::makeShape({numContextTokens + numGenSequences, vocabSizePadded}), logitsType);
+            // The buffer only lives for one iteration, so serve it from the arena instead of going through
+            // the allocator on every batch composition change.
+            logitsArena.reset();
+            logits = logitsArena.allocate(
+                manager, ITensor::makeShape({numContextTokens + numGenSequences, vocabSizePadded}), logitsType);
         }
         else if (gatherGenerationLogits && modelConfig.getSpeculativeDecodingMode().isNone())
         {
@@ -449,7 +453,8 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
     kv_cache_manager::BaseKVCacheManager* crossKvCacheManagerPtr,
     rnn_state_manager::RnnStateManager* rnnStateManagerPtr, PeftTable const& peftTable,
     runtime::TllmRuntime const& runtime, runtime::ModelConfig const& modelConfig,
-    runtime::WorldConfig const& worldConfig, bool trtOverlap, OptionalRef<runtime::ITensor const> newOutputTokens)
+    runtime::WorldConfig const& worldConfig, SizeType32 stepsSinceHostSync,
+    OptionalRef<runtime::ITensor const> newOutputTokens)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(runtimeBuffersSetFromInputs);
@@ -630,14 +635,13 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
             TLLM_CHECK(draftLength == 0 || reqBeamWidth == 1);
 
             auto const promptLen = llmReq->mPromptLen;
-            auto const sequenceLen
-                = promptLen + llmReq->getMaxNumGeneratedTokens() + static_cast<SizeType32>(trtOverlap);
+            auto const sequenceLen = promptLen + llmReq->getMaxNumGeneratedTokens() + stepsSinceHostSync;
             auto const& positionIds = llmReq->getPositionIds();
             for (int beam = 0; beam < reqBeamWidth; ++beam)
             {
-                auto const numTokens = llmReq->getNumTokens(beam) + static_cast<SizeType32>(trtOverlap);
+                auto const numTokens = llmReq->getNumTokens(beam) + stepsSinceHostSync;
                 // TODO: can this be removed completely?
-                if (!trtOverlap)
+                if (stepsSinceHostSync == 0)
                 {
                     auto const lastToken = llmReq->getLastTokens(beam);
                     inputHost.push_back(lastToken);
@@ -726,8 +730,7 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
             auto const draftLength = llmReq->getNumDraftTokens();
 
             auto const contextQLength = llmReq->mPromptLen + draftLength;
-            auto const sequenceLen
-                = contextQLength + llmReq->getMaxNumGeneratedTokens() + static_cast<SizeType32>(trtOverlap);
+            auto const sequenceLen = contextQLength + llmReq->getMaxNumGeneratedTokens() + stepsSinceHostSync;
 
             std::fill_n(contextLengthsHostPtr + numSequences, reqBeamWidth, contextQLength);
             std::fill_n(sequenceLengthsHostPtr + numSequences, reqBeamWidth, sequenceLen);
@@ -787,9 +790,25 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
         }
     }
 
+    // A pure generation batch with unchanged composition advances every sequence length and
+    // position id by exactly one between iterations, so the device-side arrays of the previous
+    // iteration can be bumped in place instead of being rebuilt and re-uploaded.
+    bool const canDeltaUpdate = transformerBuffers && contextRequests.empty() && !genRequests.empty()
+        && !(isChatGlm || isGlm) && modelConfig.getSpeculativeDecodingMode().isNone() && !modelConfig.useMrope();
+    std::vector<std::pair<std::uint64_t, SizeType32>> batchSignature;
+    if (canDeltaUpdate)
+    {
+        batchSignature.reserve(genRequests.size());
+        for (auto const& llmReq : genRequests)
+        {
+            batchSignature.emplace_back(llmReq->mRequestId, llmReq->getBeamWidthByIter());
+        }
+    }
+    bool const steadyStateDecode = canDeltaUpdate && mDeviceMetadataValid && batchSignature == mMetadataBatchSignature;
+
     {
         NVTX3_SCOPED_RANGE(bufferCopies);
-        if (trtOverlap)
+        if (stepsSinceHostSync > 0)
         {
             auto contextInputsIds = ITensor::slice(inputsIds, 0, numContextTokens);
             manager.copy(inputHost.data(), *contextInputsIds);
@@ -806,21 +825,34 @@ void RuntimeBuffers::setFromInputs(RequestVector const& contextRequests, Request
         {
             manager.copy(inputHost.data(), *inputsIds);
         }
-        // In generation phase, device ptr of context lengths need to be tiled.
-        manager.copy(*contextLengthsHost, *contextLengthsDevice);
-        manager.copy(*sequenceLengthsHost, *sequenceLengthsDevice);
-        auto const logitsIdsHostRange = BufferRange<SizeType32>(*logitsIdsHost);
-        auto lastTokenIdsHostRange = BufferRange<SizeType32>(*lastTokenIdsHost);
-        common::stl_utils::inclusiveScan(
-            logitsIdsHostRange.begin(), logitsIdsHostRange.end(), lastTokenIdsHostRange.begin());
-        manager.copy(*lastTokenIdsHost, *lastTokenIdsDevice);
-        if (transformerBuffers)
+        if (steadyStateDecode)
         {
-            TensorPtr decoderPositionIds = modelConfig.getSpeculativeDecodingMode().isLookaheadDecoding()
-                ? mLookaheadBuffers->positionIdsDevice
-                : nullptr;
-            transformerBuffers->copyPositionIds(runtime, positionIdsHost, isChatGlm || isGlm, decoderPositionIds);
+            // Same generation batch as the previous iteration: derive this iteration's metadata on
+            // device with a single kernel. Context lengths and last-token ids depend only on the
+            // batch composition and are still valid on device.
+            runtime::kernels::invokeIncrementDecodeStep(
+                *sequenceLengthsDevice, *transformerBuffers->positionIds, stream);
         }
+        else
+        {
+            // In generation phase, device ptr of context lengths need to be tiled.
+            manager.copy(*contextLengthsHost, *contextLengthsDevice);
+            manager.copy(*sequenceLengthsHost, *sequenceLengthsDevice);
+            auto const logitsIdsHostRange = BufferRange<SizeType32>(*logitsIdsHost);
+            auto lastTokenIdsHostRange = BufferRange<SizeType32>(*lastTokenIdsHost);
+            common::stl_utils::inclusiveScan(
+                logitsIdsHostRange.begin(), logitsIdsHostRange.end(), lastTokenIdsHostRange.begin());
+            manager.copy(*lastTokenIdsHost, *lastTokenIdsDevice);
+            if (transformerBuffers)
+            {
+                TensorPtr decoderPositionIds = modelConfig.getSpeculativeDecodingMode().isLookaheadDecoding()
+                    ? mLookaheadBuffers->positionIdsDevice
+                    : nullptr;
+                transformerBuffers->copyPositionIds(runtime, positionIdsHost, isChatGlm || isGlm, decoderPositionIds);
+            }
+        }
+        mDeviceMetadataValid = canDeltaUpdate;
+        mMetadataBatchSignature = std::move(batchSignature);
         if (rnnStateBuffers)
         {
             rnnStateBuffers->copySlotMappingH2D(runtime);
@@ -906,8 +938,8 @@ std::tuple<SizeType32, RuntimeBuffers::TensorMap const&, RuntimeBuffers::TensorM
     SizeType32 maxAttentionWindow, runtime::decoder::DecoderState const& decoderState,
     kv_cache_manager::BaseKVCacheManager* kvCacheManager, kv_cache_manager::BaseKVCacheManager* crossKvCacheManager,
     rnn_state_manager::RnnStateManager* rnnStateManager, PeftTable const& peftTable, TllmRuntime const& runtime,
-    ModelConfig const& modelConfig, WorldConfig const& worldConfig, bool gatherGenerationLogits, bool trtOverlap,
-    OptionalRef<runtime::ITensor const> newOutputTokens)
+    ModelConfig const& modelConfig, WorldConfig const& worldConfig, bool gatherGenerationLogits,
+    SizeType32 stepsSinceHostSync, OptionalRef<runtime::ITensor const> newOutputTokens)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(runtimeBuffersPrepareStep);
@@ -916,7 +948,7 @@ std::tuple<SizeType32, RuntimeBuffers::TensorMap const&, RuntimeBuffers::TensorM
     reshape(runtime, modelConfig, worldConfig, gatherGenerationLogits);
 
     setFromInputs(contextRequests, genRequests, maxBeamWidth, maxAttentionWindow, decoderState, kvCacheManager,
-        crossKvCacheManager, rnnStateManager, peftTable, runtime, modelConfig, worldConfig, trtOverlap,
+        crossKvCacheManager, rnnStateManager, peftTable, runtime, modelConfig, worldConfig, stepsSinceHostSync,
         newOutputTokens);
 
     fillIOMaps(modelConfig, worldConfig);
@@ -28,11 +28,22 @@ SequenceSlotManager::SequenceSlotManager(SlotIdType maxNumSlots, uint64_t maxSeq
     mSequenceIdToSlot.reserve(maxNumSlots);
     for (SlotIdType slot = 0; slot < mMaxNumSlots; ++slot)
     {
-        mAvailableSlots.emplace(slot);
+        mAvailableSlots.insert(slot);
     }
     mLastTimepoint.resize(mMaxNumSlots);
 }
 
+void SequenceSlotManager::rememberLastUsedSlot(SequenceIdType sequenceId, SlotIdType slot)
+{
+    // The affinity hint is best effort; bound the map instead of letting it grow with every
+    // sequence id ever seen.
+    if (mLastUsedSlot.size() >= static_cast<size_t>(4 * mMaxNumSlots))
+    {
+        mLastUsedSlot.clear();
+    }
+    mLastUsedSlot[sequenceId] = slot;
+}
+
 std::optional<SequenceSlotManager::SlotIdType> SequenceSlotManager::getSequenceSlot(
     bool const& startFlag, SequenceIdType const& sequenceId)
 {
@@ -47,8 +58,21 @@ std::optional<SequenceSlotManager::SlotIdType> SequenceSlotManager::getSequenceS
 
         if (!mAvailableSlots.empty())
         {
-            slot = mAvailableSlots.front();
-            mAvailableSlots.pop();
+            // Prefer the slot the sequence held before it was freed; otherwise take the lowest free
+            // slot so the active slots stay in a dense, stable range across iterations.
+            auto slotIt = mAvailableSlots.begin();
+            auto const lastUsedIt = mLastUsedSlot.find(sequenceId);
+            if (lastUsedIt != mLastUsedSlot.end())
+            {
+                if (auto const affinityIt = mAvailableSlots.find(lastUsedIt->second);
+                    affinityIt != mAvailableSlots.end())
+                {
+                    slotIt = affinityIt;
+                }
+                mLastUsedSlot.erase(lastUsedIt);
+            }
+            slot = *slotIt;
+            mAvailableSlots.erase(slotIt);
             mSequenceIdToSlot.emplace(sequenceId, slot.value());
         }
         else
@@ -82,7 +106,8 @@ void SequenceSlotManager::freeSequenceSlot(SequenceIdType sequenceId)
     {
         auto const slot = it->second;
         mSequenceIdToSlot.erase(it);
-        mAvailableSlots.push(slot);
+        mAvailableSlots.insert(slot);
+        rememberLastUsedSlot(sequenceId, slot);
     }
 }
 
@@ -97,8 +122,9 @@ void SequenceSlotManager::freeIdleSequenceSlots()
         {
             TLLM_LOG_INFO("Releasing idle sequence with correlation id %lu idle time %li us", sequenceId,
                 idleMicroseconds.count());
+            mAvailableSlots.insert(slot);
+            rememberLastUsedSlot(sequenceId, slot);
             it = mSequenceIdToSlot.erase(it);
-            mAvailableSlots.push(slot);
         }
         else
         {
@@ -19,6 +19,7 @@
 
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/kernels/attentionMask.h"
@@ -31,6 +32,7 @@
 #include "tensorrt_llm/runtime/tllmBuffers.h"
 #include "tensorrt_llm/runtime/tllmRuntime.h"
 #include <cstdint>
+#include <cstring>
 
 using namespace tensorrt_llm::runtime;
 namespace tk = tensorrt_llm::kernels;
@@ -155,6 +157,10 @@ void TransformerBuffers::reshape(SizeType32 numSequences, SizeType32 numInputTok
             cacheBlockOffsetsShape.d[1] = numSequences;
             kvCacheBlockOffsetsHost->reshape(cacheBlockOffsetsShape);
             kvCacheBlockOffsetsDevice->reshape(cacheBlockOffsetsShape);
+            if (kvCacheBlockOffsetsShadow)
+            {
+                kvCacheBlockOffsetsShadow->reshape(cacheBlockOffsetsShape);
+            }
         }
         else
         {
@@ -172,6 +178,10 @@ void TransformerBuffers::reshape(SizeType32 numSequences, SizeType32 numInputTok
             crossCacheBlockOffsetsShape.d[1] = numSequences;
             crossKvCacheBlockOffsetsHost->reshape(crossCacheBlockOffsetsShape);
             crossKvCacheBlockOffsetsDevice->reshape(crossCacheBlockOffsetsShape);
+            if (crossKvCacheBlockOffsetsShadow)
+            {
+                crossKvCacheBlockOffsetsShadow->reshape(crossCacheBlockOffsetsShape);
+            }
         }
         else
         {
@@ -230,6 +240,13 @@ void TransformerBuffers::reshapeKvTensors(SizeType32 maxBatchSize, SizeType32 ma
 
         kvCacheBlockOffsetsDevice->reshape(cacheBlockOffsetsShape);
         manager.setZero(*kvCacheBlockOffsetsDevice);
+
+        if (common::getEnvKvOffsetsDeltaUpload())
+        {
+            kvCacheBlockOffsetsShadow
+                = BufferManager::cpu(cacheBlockOffsetsShape, kvCacheBlockOffsetsHost->getDataType());
+            kvOffsetsShadowValid = false;
+        }
     }
     else if (kvCacheType == kv_cache_manager::CacheType::kCROSS)
     {
@@ -242,6 +259,13 @@ void TransformerBuffers::reshapeKvTensors(SizeType32 maxBatchSize, SizeType32 ma
         crossKvCacheBlockOffsetsDevice->reshape(crossCacheBlockOffsetsShape);
         manager.setZero(*crossKvCacheBlockOffsetsDevice);
 
+        if (common::getEnvKvOffsetsDeltaUpload())
+        {
+            crossKvCacheBlockOffsetsShadow
+                = BufferManager::cpu(crossCacheBlockOffsetsShape, crossKvCacheBlockOffsetsHost->getDataType());
+            kvOffsetsShadowValid = false;
+        }
+
         crossAttentionMaskDevice->reshape(ITensor::makeShape({maxNumTokens, maxEncoderOutputLen}));
         manager.setZero(*crossAttentionMaskDevice);
         manager.setZero(*crossAttentionMaskPinnedHost);
@@ -350,6 +374,8 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
     SizeType32 numSequences{0};
     SizeType32 maxBlockCount{0};
     SizeType32 maxCrossBlockCount{0};
+    std::vector<std::pair<RequestIdType, SizeType32>> batchOrder;
+    batchOrder.reserve(contextRequests.size() + genRequests.size());
     for (auto const& requests : {contextRequests, genRequests})
     {
         for (auto const& llmReq : requests)
@@ -357,6 +383,7 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
             auto const requestId = llmReq->mRequestId;
             auto const isContextRequest = llmReq->isContextInitState();
             auto const beamWidth = isContextRequest ? contextBeamWidth : llmReq->getBeamWidthByIter();
+            batchOrder.emplace_back(requestId, beamWidth);
             auto const maxBeamBlockCount
                 = kvCacheManager->copyBlockOffsets(*kvCacheBlockOffsetsHost, numSequences, requestId);
             maxBlockCount = std::max(maxBlockCount, maxBeamBlockCount);
@@ -387,10 +414,85 @@ void TransformerBuffers::copyKvBlockOffsets(RequestVector const& contextRequests
             dstPtr, copyPitch, srcPtr, copyPitch, copyWidth, copyHeight, cudaMemcpyHostToDevice, cudaStream.get()));
     };
 
-    copyOffsetsToDevice(kvCacheBlockOffsetsHost, kvCacheBlockOffsetsDevice, maxBlockCount);
-    if (crossKvCacheBlockOffsetsHost)
+    // While the batch composition is unchanged, the row layout of the tables is stable and only
+    // rows that actually changed since the last upload (a sequence crossed a block boundary, or a
+    // block moved between primary and secondary memory) need to go over PCIe. The shadow tensor
+    // mirrors what the device holds; adjacent dirty rows are coalesced into one copy.
+    auto copyDirtyOffsetsToDevice
+        = [&cudaStream](TensorPtr const& offsetsHost, TensorPtr const& offsetsShadow, TensorPtr& offsetsDevice,
+              SizeType32 maxBlockCount)
     {
-        copyOffsetsToDevice(crossKvCacheBlockOffsetsHost, crossKvCacheBlockOffsetsDevice, maxCrossBlockCount);
+        auto const& offsetsShape = offsetsHost->getShape();
+        auto const maxBlocksPerSeq = offsetsShape.d[3];
+        auto const offsetsTypeSize = tensorrt_llm::common::getDTypeSize(offsetsHost->getDataType());
+        auto const copyPitch = maxBlocksPerSeq * offsetsTypeSize;
+        auto const numRows = offsetsShape.d[0] * offsetsShape.d[1] * offsetsShape.d[2];
+        auto const copyWidth = maxBlockCount * offsetsTypeSize;
+        auto const* srcPtr = reinterpret_cast<std::uint8_t const*>(bufferCast<tk::KVCacheIndex>(*offsetsHost));
+        auto* shadowPtr = reinterpret_cast<std::uint8_t*>(bufferCast<tk::KVCacheIndex>(*offsetsShadow));
+        auto* dstPtr = reinterpret_cast<std::uint8_t*>(bufferCast<tk::KVCacheIndex>(*offsetsDevice));
+        for (ITensor::DimType64 row = 0; row < numRows;)
+        {
+            if (std::memcmp(srcPtr + row * copyPitch, shadowPtr + row * copyPitch, copyWidth) == 0)
+            {
+                ++row;
+                continue;
+            }
+            auto rowEnd = row + 1;
+            while (rowEnd < numRows
+                && std::memcmp(srcPtr + rowEnd * copyPitch, shadowPtr + rowEnd * copyPitch, copyWidth) != 0)
+            {
+                ++rowEnd;
+            }
+            TLLM_CUDA_CHECK(cudaMemcpy2DAsync(dstPtr + row * copyPitch, copyPitch, srcPtr + row * copyPitch, copyPitch,
+                copyWidth, rowEnd - row, cudaMemcpyHostToDevice, cudaStream.get()));
+            for (auto dirtyRow = row; dirtyRow < rowEnd; ++dirtyRow)
+            {
+                std::memcpy(shadowPtr + dirtyRow * copyPitch, srcPtr + dirtyRow * copyPitch, copyWidth);
+            }
+            row = rowEnd;
+        }
+    };
+
+    // Columns beyond the last uploaded width were never mirrored to the device, so a batch that
+    // needs more of them has to re-upload in full.
+    bool const deltaUpload = kvCacheBlockOffsetsShadow && kvOffsetsShadowValid
+        && (!crossKvCacheBlockOffsetsHost || crossKvCacheBlockOffsetsShadow) && batchOrder == kvOffsetsUploadedOrder
+        && maxBlockCount <= kvOffsetsUploadedWidth && maxCrossBlockCount <= crossKvOffsetsUploadedWidth;
+
+    if (deltaUpload)
+    {
+        copyDirtyOffsetsToDevice(kvCacheBlockOffsetsHost, kvCacheBlockOffsetsShadow, kvCacheBlockOffsetsDevice,
+            maxBlockCount);
+        if (crossKvCacheBlockOffsetsHost)
+        {
+            copyDirtyOffsetsToDevice(crossKvCacheBlockOffsetsHost, crossKvCacheBlockOffsetsShadow,
+                crossKvCacheBlockOffsetsDevice, maxCrossBlockCount);
+        }
+    }
+    else
+    {
+        copyOffsetsToDevice(kvCacheBlockOffsetsHost, kvCacheBlockOffsetsDevice, maxBlockCount);
+        if (crossKvCacheBlockOffsetsHost)
+        {
+            copyOffsetsToDevice(crossKvCacheBlockOffsetsHost, crossKvCacheBlockOffsetsDevice, maxCrossBlockCount);
+        }
+        if (kvCacheBlockOffsetsShadow)
+        {
+            kvCacheBlockOffsetsShadow->reshape(kvCacheBlockOffsetsHost->getShape());
+            std::memcpy(kvCacheBlockOffsetsShadow->data(), kvCacheBlockOffsetsHost->data(),
+                kvCacheBlockOffsetsHost->getSizeInBytes());
+            if (crossKvCacheBlockOffsetsShadow)
+            {
+                crossKvCacheBlockOffsetsShadow->reshape(crossKvCacheBlockOffsetsHost->getShape());
+                std::memcpy(crossKvCacheBlockOffsetsShadow->data(), crossKvCacheBlockOffsetsHost->data(),
+                    crossKvCacheBlockOffsetsHost->getSizeInBytes());
+            }
+            kvOffsetsUploadedOrder = std::move(batchOrder);
+            kvOffsetsUploadedWidth = maxBlockCount;
+            crossKvOffsetsUploadedWidth = maxCrossBlockCount;
+            kvOffsetsShadowValid = true;
+        }
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -287,7 +287,7 @@ void TrtEncoderModel::forwardAsync(RequestList const& activeRequests)
             fittingDisaggeGenInitReuqests.empty(), "Disaggregated servering is not support by encoder model.");
 
         std::tie(currRequests.contextRequests, std::ignore) = (*mMicroBatchScheduler)(
-            fittingRequests, mInflightReqIds, getMaxBatchSize(), mModelConfig.getMaxNumTokens());
+            fittingRequests, mInflightReqIds, getMaxBatchSize(), getMaxNumTokens());
 
         {
             NVTX3_SCOPED_RANGE(pauseRequestsFlaggedByScheduler);
@@ -405,25 +405,26 @@ void TrtEncoderModel::terminateRequestSync(
 
 void TrtEncoderModel::fillEncoderOutputSync(RequestVector const& requestList, TensorMap outputTensors)
 {
-    auto const totalTokensNb = outputTensors["encoder_output"]->getShape().d[0];
-    auto const encoderOutputDtype = mRuntime->getEngine().getTensorDataType("encoder_output");
-    SizeType32 const bytesPerValue = (encoderOutputDtype == nvinfer1::DataType::kFLOAT) ? 4 : 2;
-    std::vector<std::byte> encoderOutputHost(
-        totalTokensNb * mHiddenSize * bytesPerValue * mWorldConfig.getTensorParallelism());
-    TLLM_CHECK_WITH_INFO(encoderOutputHost.size() > 0, "Encoder output size is 0!");
-    getBufferManager().copy(*(outputTensors["encoder_output"]), reinterpret_cast<void*>(encoderOutputHost.data()));
-    getBufferManager().getStream().synchronize(); // TODO: change engine call to async to improve perf. Also
-                                                  // need to store output buffers, cuda events, etc.
-
-    auto encoderOutputHostPtr = encoderOutputHost.data();
+    // Only requests that asked for the encoder output in their response need it on the host; the
+    // decoder's cross attention reads the device tensors distributed by rearrangeOutputs. Copying
+    // per request into the preallocated pinned buffers and synchronizing only when such a copy was
+    // issued keeps the host free to schedule the decoder iteration while the encoder engine is
+    // still running on its own stream; the executor orders the decoder stream behind the encoder
+    // with an event.
+    auto const& encoderOutput = outputTensors.at("encoder_output");
+    TLLM_CHECK_WITH_INFO(encoderOutput->getShape().d[0] > 0, "Encoder output size is 0!");
+
+    bool needsSync = false;
+    SizeType32 offset = 0;
     for (auto const& llmReq : requestList)
     {
         SizeType32 const seqLen = llmReq->getEncoderOutputLen();
-        TensorPtr currentEncoderOutput
-            = mCopyBufferManager.copyFrom(reinterpret_cast<half const*>(encoderOutputHostPtr),
-                ITensor::makeShape({seqLen, mHiddenSize * mWorldConfig.getTensorParallelism()}), MemoryType::kCPU);
-        llmReq->setEncoderOutputHost(currentEncoderOutput);
-        encoderOutputHostPtr += seqLen * mHiddenSize * bytesPerValue * mWorldConfig.getTensorParallelism();
+        if (llmReq->getReturnEncoderOutput())
+        {
+            getBufferManager().copy(*ITensor::slice(encoderOutput, offset, seqLen), *llmReq->getEncoderOutputHost());
+            needsSync = true;
+        }
+        offset += seqLen;
 
         if (llmReq->isEncoderInitState())
         {
@@ -434,6 +435,11 @@ void TrtEncoderModel::fillEncoderOutputSync(RequestVector const& requestList, Te
             TLLM_LOG_DEBUG("Non-encoder request terminated in encoder model: id %lu", llmReq->mRequestId);
         }
     }
+
+    if (needsSync)
+    {
+        getBufferManager().getStream().synchronize();
+    }
 }
 
 void TrtEncoderModel::executeBatch(RequestVector const& requestList)
@@ -78,6 +78,12 @@ public:
             }
             if (!modelConfig.getSpeculativeDecodingMode().isNone())
             {
+                // Overlap scheduling prepares the engine inputs of iteration N+1 before the decoder results of
+                // iteration N reach the host. All speculative decoding modes break this: the number of accepted
+                // draft tokens of iteration N determines the input length, logits count and KV cache allocation
+                // of iteration N+1 on the host, and modes that need KV cache rewind must rewind before the next
+                // engine run of the request. Lifting this requires a device-side path for the draft tokens in the
+                // input preparation plus draft-length-independent host bookkeeping.
                 mEnableTrtOverlap = false;
                 TLLM_LOG_WARNING("TRT overlap is not supported with speculative decoding and will be disabled.");
             }
@@ -261,6 +267,11 @@ public:
         return false;
     }
 
+    [[nodiscard]] bool hasKvCacheTransceiver() const noexcept override
+    {
+        return false;
+    }
+
     virtual void setLayerProfiler() = 0;
     [[nodiscard]] virtual std::string getLayerProfileInfo() const = 0;
 
@@ -0,0 +1,315 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trtGptModelDummy.h"
+#include "tensorrt_llm/batch_manager/capacityScheduler.h"
+#include "tensorrt_llm/batch_manager/microBatchScheduler.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/executor/executor.h"
+
+#include <chrono>
+#include <thread>
+
+namespace tensorrt_llm::batch_manager
+{
+
+namespace
+{
+// Token id the dummy emits; the value is irrelevant, responses are only inspected for shape.
+constexpr runtime::TokenIdType kDummyTokenId{1};
+} // namespace
+
+TrtGptModelDummy::TrtGptModelDummy(runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig,
+    TrtGptModelType modelType, executor::ExecutorConfig const& executorConfig)
+    : TrtGptModel(modelConfig, worldConfig, executorConfig)
+    , mModelConfig{modelConfig}
+    , mWorldConfig{worldConfig}
+    , mModelType{modelType}
+    , mContextTokenLatencyUs{common::getEnvDummyModelContextTokenLatencyUs()}
+    , mGenerationTokenLatencyUs{common::getEnvDummyModelGenerationTokenLatencyUs()}
+    , mIterationOverheadUs{common::getEnvDummyModelIterationOverheadUs()}
+    , mTokensPerBlock{modelConfig.getTokensPerBlock()}
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    // Without a KV cache manager the capacity scheduler falls back to MaxRequests; the simulated
+    // block pool below models the memory footprint instead.
+    mCapacityScheduler = std::make_unique<tensorrt_llm::batch_manager::CapacityScheduler>(
+        getMaxNumSequences(), executorConfig.getSchedulerConfig().getCapacitySchedulerPolicy(), false);
+
+    mMicroBatchScheduler = std::make_unique<tensorrt_llm::batch_manager::MicroBatchScheduler>(
+        std::nullopt, getMaxInputLen());
+
+    if (executorConfig.getKvCacheConfig().getMaxTokens().has_value())
+    {
+        TLLM_CHECK_WITH_INFO(mTokensPerBlock > 0,
+            "A positive tokensPerBlock is required to simulate the KV cache footprint from "
+            "KvCacheConfig::getMaxTokens.");
+        mNumFreeBlocks = executorConfig.getKvCacheConfig().getMaxTokens().value() / mTokensPerBlock;
+        TLLM_LOG_INFO("TrtGptModelDummy simulating a KV cache of %d blocks of %d tokens", mNumFreeBlocks.value(),
+            mTokensPerBlock);
+    }
+
+    TLLM_LOG_WARNING(
+        "TrtGptModelDummy replays calibrated latencies (context %.2f us/token, generation %.2f us/token, "
+        "overhead %.2f us/iteration) and produces placeholder tokens. For scheduler and executor load "
+        "testing only.",
+        mContextTokenLatencyUs, mGenerationTokenLatencyUs, mIterationOverheadUs);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
+TrtGptModelDummy::~TrtGptModelDummy() = default;
+
+SizeType32 TrtGptModelDummy::numBlocksForSeqLen(SizeType32 seqLen) const
+{
+    return (seqLen + mTokensPerBlock - 1) / mTokensPerBlock;
+}
+
+bool TrtGptModelDummy::tryAllocateBlocks(std::shared_ptr<LlmRequest> const& llmReq, SizeType32 numBlocks)
+{
+    auto& allocated = mAllocatedBlocks[llmReq->mRequestId];
+    auto const numNewBlocks = numBlocks - allocated;
+    if (numNewBlocks <= 0)
+    {
+        return true;
+    }
+    if (mNumFreeBlocks.has_value())
+    {
+        if (mNumFreeBlocks.value() < numNewBlocks)
+        {
+            return false;
+        }
+        mNumFreeBlocks.value() -= numNewBlocks;
+    }
+    allocated = numBlocks;
+    return true;
+}
+
+void TrtGptModelDummy::freeBlocks(std::shared_ptr<LlmRequest> const& llmReq)
+{
+    auto const it = mAllocatedBlocks.find(llmReq->mRequestId);
+    if (it != mAllocatedBlocks.end())
+    {
+        if (mNumFreeBlocks.has_value())
+        {
+            mNumFreeBlocks.value() += it->second;
+        }
+        mAllocatedBlocks.erase(it);
+    }
+}
+
+void TrtGptModelDummy::forwardSync()
+{
+    // The dummy completes each iteration synchronously in forwardAsync.
+}
+
+void TrtGptModelDummy::forwardAsync(RequestList const& activeRequests)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    try
+    {
+        auto [fittingRequests, fittingDisaggGenInitRequests, requestsToPause] = (*mCapacityScheduler)(activeRequests);
+        TLLM_CHECK_WITH_INFO(
+            fittingDisaggGenInitRequests.empty(), "Disaggregated serving is not supported by the dummy model.");
+
+        ScheduledRequests currRequests;
+        std::tie(currRequests.contextRequests, currRequests.generationRequests)
+            = (*mMicroBatchScheduler)(fittingRequests, mInflightReqIds, getMaxBatchSize(), getMaxNumTokens());
+
+        for (auto const& llmReq : requestsToPause)
+        {
+            terminateRequest(llmReq, true);
+        }
+
+        double latencyUs{0.};
+        bool ranBatch{false};
+
+        for (auto const& llmReq : currRequests.contextRequests)
+        {
+            // Room for the whole prompt plus the first generated token.
+            auto const numBlocks = numBlocksForSeqLen(llmReq->getNumTokens(0) + 1);
+            if (!tryAllocateBlocks(llmReq, numBlocks))
+            {
+                // Simulated out of memory: leave the request in context init for a later iteration.
+                continue;
+            }
+            latencyUs += static_cast<double>(llmReq->getNumTokens(0)) * mContextTokenLatencyUs;
+            ranBatch = true;
+
+            auto const numBeams = llmReq->mSamplingConfig.getNumReturnBeams();
+            llmReq->addNewTokens(LlmRequest::VecTokens(numBeams, kDummyTokenId));
+            llmReq->setState(llmReq->getMaxNumGeneratedTokens() >= llmReq->mMaxNewTokens
+                    ? LlmRequestState::kGENERATION_COMPLETE
+                    : LlmRequestState::kGENERATION_IN_PROGRESS);
+        }
+
+        for (auto const& llmReq : currRequests.generationRequests)
+        {
+            auto const numBlocks = numBlocksForSeqLen(llmReq->getNumTokens(0) + 1);
+            if (!tryAllocateBlocks(llmReq, numBlocks))
+            {
+                // Simulated out of memory: pause the request like an eviction on a real model.
+                terminateRequest(llmReq, true);
+                continue;
+            }
+            latencyUs += mGenerationTokenLatencyUs;
+            ranBatch = true;
+
+            auto const numBeams = llmReq->mSamplingConfig.getNumReturnBeams();
+            llmReq->addNewTokens(LlmRequest::VecTokens(numBeams, kDummyTokenId));
+            if (llmReq->getMaxNumGeneratedTokens() >= llmReq->mMaxNewTokens)
+            {
+                llmReq->setState(LlmRequestState::kGENERATION_COMPLETE);
+            }
+        }
+
+        if (ranBatch)
+        {
+            latencyUs += mIterationOverheadUs;
+            std::this_thread::sleep_for(std::chrono::duration<double, std::micro>(latencyUs));
+        }
+    }
+    // In case of error, we need to free the batch slot associated with those requests
+    catch (std::exception const& e)
+    {
+        for (auto const& llmReq : activeRequests)
+        {
+            terminateRequest(llmReq);
+        }
+        throw;
+    }
+
+    ++mIterCounter;
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
+void TrtGptModelDummy::terminateRequest(std::shared_ptr<LlmRequest> const& llmReq, bool pause)
+{
+    freeBlocks(llmReq);
+    if (pause)
+    {
+        llmReq->pause(getMaxInputLen());
+    }
+}
+
+void TrtGptModelDummy::terminateRequestSync(
+    std::shared_ptr<LlmRequest> const& llmReq, executor::FinishReason finishReason)
+{
+    terminateRequest(llmReq, false);
+    llmReq->finishByReason(finishReason);
+    llmReq->clearGeneratedTokens();
+}
+
+runtime::BufferManager const& TrtGptModelDummy::getBufferManager() const
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+runtime::BufferManager::CudaStreamPtr TrtGptModelDummy::getRuntimeStreamPtr() const
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+nvinfer1::DataType TrtGptModelDummy::getTensorDataType(std::string const& /*name*/) const
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+nvinfer1::Dims TrtGptModelDummy::getTensorShape(std::string const& /*name*/) const
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+void TrtGptModelDummy::getCurrentIterationStats(executor::IterationStats& stats) const
+{
+    stats.iter = mIterCounter;
+    if (mNumFreeBlocks.has_value())
+    {
+        executor::KvCacheStats kvStats{};
+        kvStats.maxNumBlocks = mNumFreeBlocks.value();
+        for (auto const& [reqId, numBlocks] : mAllocatedBlocks)
+        {
+            kvStats.maxNumBlocks += numBlocks;
+            kvStats.usedNumBlocks += numBlocks;
+        }
+        kvStats.freeNumBlocks = mNumFreeBlocks.value();
+        kvStats.tokensPerBlock = mTokensPerBlock;
+        stats.kvCacheStats = kvStats;
+    }
+}
+
+void TrtGptModelDummy::getCurrentRequestStats(executor::RequestStatsPerIteration& stats) const
+{
+    stats.iter = mIterCounter;
+}
+
+executor::DebugTensorsPerIteration TrtGptModelDummy::getCurrentDebugTensors() const
+{
+    executor::DebugTensorsPerIteration debugTensors;
+    debugTensors.iter = mIterCounter;
+
+    TLLM_LOG_WARNING("TrtGptModelDummy doesn't support getting debug tensors.");
+
+    return debugTensors;
+}
+
+void TrtGptModelDummy::setLayerProfiler()
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+std::string TrtGptModelDummy::getLayerProfileInfo() const
+{
+    TLLM_THROW("TrtGptModelDummy has no TensorRT engine.");
+}
+
+void TrtGptModelDummy::setLogitsPostProcessorBatched(std::optional<LogitsPostProcessorBatched> logitsPostProcessorBatched)
+{
+    TLLM_CHECK_WITH_INFO(
+        !logitsPostProcessorBatched.has_value(), "TrtGptModelDummy does not use logits processor.");
+}
+
+void TrtGptModelDummy::setReplicateLogitsPostProcessor(bool /*replicateLogitsPostProcessor*/)
+{
+    TLLM_THROW("TrtGptModelDummy does not use logits processor.");
+}
+
+bool TrtGptModelDummy::getReplicateLogitsPostProcessor() const
+{
+    TLLM_THROW("TrtGptModelDummy does not use logits processor.");
+}
+
+SizeType32 TrtGptModelDummy::getMaxCapacityBatchSize(SizeType32 inputLength, SizeType32 outputLength) const
+{
+    if (!mNumFreeBlocks.has_value())
+    {
+        return 0;
+    }
+    auto const blocksPerSequence = numBlocksForSeqLen(inputLength + outputLength);
+    SizeType32 totalBlocks = mNumFreeBlocks.value();
+    for (auto const& [reqId, numBlocks] : mAllocatedBlocks)
+    {
+        totalBlocks += numBlocks;
+    }
+    return totalBlocks / blocksPerSequence;
+}
+
+} // namespace tensorrt_llm::batch_manager
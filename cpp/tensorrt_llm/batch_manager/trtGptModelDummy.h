@@ -0,0 +1,174 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "trtGptModel.h"
+
+#include <optional>
+#include <unordered_map>
+
+namespace tensorrt_llm::batch_manager
+{
+class CapacityScheduler;
+class MicroBatchScheduler;
+
+/// @brief Engine-less model that replays calibrated per-token latencies instead of running TRT.
+/// @details The dummy runs the regular CapacityScheduler/MicroBatchScheduler pipeline over the
+/// active requests, sleeps for the time the scheduled batch would have taken on a real engine and
+/// emits placeholder tokens, so scheduler and executor changes can be regression and soak tested
+/// on CPU-only machines. The per-token costs are taken from TRTLLM_DUMMY_MODEL_*_LATENCY_US and
+/// the simulated KV cache capacity from KvCacheConfig::getMaxTokens; generation requests that
+/// outgrow the simulated capacity are paused like an eviction would on a real model.
+class TrtGptModelDummy : public TrtGptModel
+{
+public:
+    using SizeType32 = tensorrt_llm::runtime::SizeType32;
+
+    TrtGptModelDummy(runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig,
+        TrtGptModelType modelType, executor::ExecutorConfig const& executorConfig);
+
+    ~TrtGptModelDummy() override;
+
+    void terminateRequest(std::shared_ptr<LlmRequest> const& llmRequest, bool pause = false) override;
+    void terminateRequestSync(
+        std::shared_ptr<LlmRequest> const& llmRequest, executor::FinishReason finishReason) override;
+
+    void forwardSync() override;
+
+    void forwardAsync(RequestList const& activeRequests) override;
+
+    [[nodiscard]] runtime::BufferManager const& getBufferManager() const override;
+    [[nodiscard]] runtime::BufferManager::CudaStreamPtr getRuntimeStreamPtr() const override;
+
+    runtime::ModelConfig const& getModelConfig() const override
+    {
+        return mModelConfig;
+    }
+
+    [[nodiscard]] bool getGatherGenerationLogits() const override
+    {
+        return false;
+    }
+
+    runtime::WorldConfig const& getWorldConfig() const override
+    {
+        return mWorldConfig;
+    }
+
+    [[nodiscard]] SizeType32 getNumMicroBatches() const override
+    {
+        return 1;
+    }
+
+    [[nodiscard]] nvinfer1::DataType getLogitDataType() const override
+    {
+        return getModelConfig().getDataType();
+    }
+
+    nvinfer1::DataType getTensorDataType(std::string const& name) const override;
+    nvinfer1::Dims getTensorShape(std::string const& name) const override;
+
+    [[nodiscard]] TrtGptModelType getModelType() const override
+    {
+        return mModelType;
+    }
+
+    [[nodiscard]] executor::IterationType getIterCounter() const noexcept override
+    {
+        return mIterCounter;
+    }
+
+    void updatePeftCache(std::shared_ptr<LlmRequest> const& /*llmRequest*/) override {}
+
+    void getCurrentIterationStats(executor::IterationStats& stats) const override;
+    void getCurrentRequestStats(executor::RequestStatsPerIteration& stats) const override;
+    [[nodiscard]] executor::DebugTensorsPerIteration getCurrentDebugTensors() const override;
+
+    void setLayerProfiler() override;
+    std::string getLayerProfileInfo() const override;
+
+    void setLogitsPostProcessorBatched(std::optional<LogitsPostProcessorBatched> logitsPostProcessorBatched) override;
+    void setReplicateLogitsPostProcessor(bool replicateLogitsPostProcessor) override;
+    [[nodiscard]] bool getReplicateLogitsPostProcessor() const override;
+
+    void resetIterationStats() override {}
+
+    [[nodiscard]] SizeType32 getMaxCapacityBatchSize(SizeType32 inputLength, SizeType32 outputLength) const override;
+
+    /// @brief Simulated KV cache blocks currently free, for test assertions. Empty when the
+    /// capacity is unlimited.
+    [[nodiscard]] std::optional<SizeType32> getNumFreeBlocks() const
+    {
+        return mNumFreeBlocks;
+    }
+
+protected:
+    std::shared_ptr<kv_cache_manager::BaseKVCacheManager> getKVCacheManager() override
+    {
+        return nullptr;
+    }
+
+    [[nodiscard]] std::shared_ptr<kv_cache_manager::BaseKVCacheManager const> getKVCacheManager() const override
+    {
+        return nullptr;
+    }
+
+    [[nodiscard]] std::shared_ptr<BasePeftCacheManager> getPeftCacheManager() override
+    {
+        return nullptr;
+    }
+
+    [[nodiscard]] std::shared_ptr<BasePeftCacheManager const> getPeftCacheManager() const override
+    {
+        return nullptr;
+    }
+
+private:
+    /// @brief Simulated blocks a sequence of seqLen tokens occupies.
+    [[nodiscard]] SizeType32 numBlocksForSeqLen(SizeType32 seqLen) const;
+
+    /// @brief Reserve blocks from the simulated pool; false when they do not fit.
+    bool tryAllocateBlocks(std::shared_ptr<LlmRequest> const& llmReq, SizeType32 numBlocks);
+
+    void freeBlocks(std::shared_ptr<LlmRequest> const& llmReq);
+
+    runtime::ModelConfig const mModelConfig;
+    runtime::WorldConfig const mWorldConfig;
+    TrtGptModelType const mModelType;
+
+    std::unique_ptr<tensorrt_llm::batch_manager::CapacityScheduler const> mCapacityScheduler;
+    std::unique_ptr<tensorrt_llm::batch_manager::MicroBatchScheduler const> mMicroBatchScheduler;
+
+    /// The dummy is fully synchronous, so nothing is ever in flight; the set only feeds the
+    /// MicroBatchScheduler interface.
+    ReqIdsSet mInflightReqIds;
+
+    // Calibrated latency model, see envUtils.
+    double mContextTokenLatencyUs;
+    double mGenerationTokenLatencyUs;
+    double mIterationOverheadUs;
+
+    // Simulated KV cache footprint. Unset capacity means unlimited.
+    SizeType32 mTokensPerBlock;
+    std::optional<SizeType32> mNumFreeBlocks;
+    std::unordered_map<RequestIdType, SizeType32> mAllocatedBlocks;
+
+    executor::IterationType mIterCounter{0};
+};
+
+} // namespace tensorrt_llm::batch_manager
@@ -18,7 +18,9 @@
 #pragma once
 
 #include "tensorrt_llm/batch_manager/trtGptModel.h"
+#include "tensorrt_llm/batch_manager/trtGptModelDummy.h"
 #include "tensorrt_llm/batch_manager/trtGptModelInflightBatching.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/runtime/gptJsonConfig.h"
 #include "tensorrt_llm/runtime/modelConfig.h"
@@ -66,6 +68,13 @@ public:
         runtime::ModelConfig const& modelConfig, runtime::WorldConfig const& worldConfig, TrtGptModelType modelType,
         executor::ExecutorConfig const& executorConfig, bool isLeaderInOrchMode)
     {
+        if (common::getEnvUseDummyGptModel())
+        {
+            // Engine-less path for scheduler and executor load testing: the engine file is still
+            // parsed for its config but never loaded onto a GPU.
+            return std::make_shared<TrtGptModelDummy>(modelConfig, worldConfig, modelType, executorConfig);
+        }
+
         auto logger = std::make_shared<runtime::TllmLogger>();
         auto const device = worldConfig.getDevice();
         auto const rank = worldConfig.getRank();
@@ -28,6 +28,7 @@
 #include "tensorrt_llm/batch_manager/guidedDecoder.h"
 #include "tensorrt_llm/batch_manager/handleContextLogits.h"
 #include "tensorrt_llm/batch_manager/handleGenerationLogits.h"
+#include "tensorrt_llm/batch_manager/iterationJournal.h"
 #include "tensorrt_llm/batch_manager/kvCacheEventManager.h"
 #include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
@@ -54,11 +55,13 @@
 #include "tensorrt_llm/common/timestampUtils.h"
 #include "tensorrt_llm/kernels/decodingCommon.h"
 #include "tensorrt_llm/layers/defaultDecodingParams.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/common.h"
 #include "tensorrt_llm/runtime/gptDecoderBatched.h"
 #include "tensorrt_llm/runtime/iBuffer.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/ipcUtils.h"
+#include "tensorrt_llm/runtime/iterationProfiler.h"
 #include "tensorrt_llm/runtime/lookaheadModule.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
 #include "tensorrt_llm/runtime/runtimeKernels.h"
@@ -68,11 +71,15 @@
 #include "tensorrt_llm/runtime/utils/runtimeUtils.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <memory>
 #include <optional>
 #include <stdexcept>
 #include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -208,6 +215,13 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
     if (mWorldConfig.isPipelineParallel())
     {
         mNumMicroBatches = mWorldConfig.getPipelineParallelism();
+        // Only the last rank runs the decoder, so only it can interleave sampling with the next
+        // micro batch's engine forward. The other ranks keep their schedule and simply observe the
+        // token broadcast one iteration later. Deferring the drain relies on a micro batch's
+        // requests staying in the inflight set until the drain ran, which overlap scheduling does
+        // not guarantee.
+        mPPDecoderOverlap
+            = mWorldConfig.isLastPipelineParallelRank() && !isTrtOverlap() && common::getEnvEnablePPDecoderOverlap();
     }
     else
     {
@@ -389,8 +403,37 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
 
     mMicroBatchScheduledRequests.resize(mNumMicroBatches);
     mDecoderFinishedEvents.resize(mNumMicroBatches);
+    mDecoderStepsSinceSync.resize(mNumMicroBatches, 1);
     mPeftTables.resize(mNumMicroBatches);
 
+    if (common::getEnvEnableMicroBatchStreams())
+    {
+        mMicroBatchStreams.reserve(mNumMicroBatches);
+        for (SizeType32 i = 0; i < mNumMicroBatches; ++i)
+        {
+            mMicroBatchStreams.emplace_back(std::make_shared<CudaStream>());
+        }
+    }
+
+    if (common::getEnvEnableSplitPriorityStreams())
+    {
+        if (mCtxGenFusion)
+        {
+            TLLM_LOG_WARNING(
+                "TRTLLM_ENABLE_SPLIT_PRIORITY_STREAMS requires context-gen fusion to be disabled (model type "
+                "InflightBatching); ignoring.");
+        }
+        else
+        {
+            int leastPriority{0};
+            int greatestPriority{0};
+            TLLM_CUDA_CHECK(cudaDeviceGetStreamPriorityRange(&leastPriority, &greatestPriority));
+            // Lower numbers are higher CUDA stream priorities.
+            mContextEngineStream = std::make_shared<CudaStream>(cudaStreamNonBlocking, leastPriority);
+            mGenerationEngineStream = std::make_shared<CudaStream>(cudaStreamNonBlocking, greatestPriority);
+        }
+    }
+
     if (modelConfig.isRnnBased())
     {
         TLLM_CHECK_WITH_INFO(modelConfig.getMaxBeamWidth() == 1, "RNN based model doesn't support beam search now.");
@@ -445,7 +488,7 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
 
     mCapacityScheduler = std::make_unique<CapacityScheduler>(getMaxNumSequences(),
         executorConfig.getSchedulerConfig().getCapacitySchedulerPolicy(), mKvCacheManager != nullptr,
-        mWorldConfig.isPipelineParallel());
+        mWorldConfig.isPipelineParallel(), executorConfig.getSchedulerConfig().getContextTokensPerSecond());
 
     mMicroBatchScheduler = std::make_unique<MicroBatchScheduler>(ctxChunkConfig, maxContextLength);
 
@@ -473,6 +516,7 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
     mPauseRequests = std::make_unique<PauseRequests>(getMaxInputLen());
     mAssignReqSeqSlots = std::make_unique<AssignReqSeqSlots>();
     mAllocateKvCache = std::make_unique<AllocateKvCache>();
+    mLogitsPostProcessor = std::make_unique<LogitsPostProcessor>();
 
     if (isCudaGraphMode())
     {
@@ -496,9 +540,87 @@ TrtGptModelInflightBatching::TrtGptModelInflightBatching(std::shared_ptr<nvinfer
     mCreateNewDecoderRequests = std::make_unique<CreateNewDecoderRequests>(
         mSpeculativeDecodingFastLogits, mIsLeaderInOrchMode, isNormalizeLogProbs());
 
+    if (auto const profilerSize = common::getEnvIterationProfilerSize(); profilerSize > 0)
+    {
+        mIterationProfiler = std::make_unique<runtime::IterationProfiler>(static_cast<SizeType32>(profilerSize));
+    }
+
+    mIterationJournal = IterationJournal::fromEnv();
+
+    runEngineWarmup();
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+void TrtGptModelInflightBatching::runEngineWarmup()
+{
+    auto const profile = common::getEnvEngineWarmupShapes();
+    if (profile.empty())
+    {
+        return;
+    }
+    if (!mModelConfig.getSpeculativeDecodingMode().isNone())
+    {
+        TLLM_LOG_WARNING("Engine warmup is not supported with speculative decoding; skipping.");
+        return;
+    }
+
+    auto const vocabSizePadded = mModelConfig.getVocabSizePadded(mWorldConfig.getSize());
+    RequestList warmupRequests;
+    LlmRequest::RequestIdType requestId{1};
+    size_t pos = 0;
+    while (pos < profile.size())
+    {
+        auto const entryEnd = profile.find(';', pos);
+        auto const entry = profile.substr(pos, entryEnd == std::string::npos ? std::string::npos : entryEnd - pos);
+        pos = entryEnd == std::string::npos ? profile.size() : entryEnd + 1;
+
+        int inputLen{0};
+        int outputLen{0};
+        int count{0};
+        if (std::sscanf(entry.c_str(), "%d:%d:%d", &inputLen, &outputLen, &count) != 3 || inputLen <= 0
+            || outputLen <= 0 || count <= 0)
+        {
+            TLLM_LOG_WARNING("Ignoring malformed TRTLLM_ENGINE_WARMUP_SHAPES entry '%s'", entry.c_str());
+            continue;
+        }
+        inputLen = std::min(inputLen, getMaxInputLen());
+        outputLen = std::min(outputLen, getMaxSequenceLen() - inputLen);
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto tokens = std::make_shared<std::vector<TokenIdType>>(inputLen);
+            for (int tokenIdx = 0; tokenIdx < inputLen; ++tokenIdx)
+            {
+                // deterministic pseudo-random prompt, identical on every rank
+                (*tokens)[tokenIdx]
+                    = static_cast<TokenIdType>((requestId * 7919 + tokenIdx * 31) % vocabSizePadded);
+            }
+            runtime::SamplingConfig samplingConfig{1};
+            samplingConfig.topK = std::vector{1};
+            // no endId, so the request runs all outputLen steps
+            warmupRequests.push_back(std::make_shared<LlmRequest>(requestId++, outputLen, std::move(tokens),
+                samplingConfig, /*isStreaming=*/false, /*endId=*/std::nullopt, /*padId=*/std::nullopt));
+        }
+    }
+    if (warmupRequests.empty())
+    {
+        return;
+    }
+
+    TLLM_LOG_INFO("Running engine warmup with %zu synthetic requests", warmupRequests.size());
+    auto const warmupStart = std::chrono::steady_clock::now();
+    while (!warmupRequests.empty())
+    {
+        forwardAsync(warmupRequests);
+        forwardSync();
+        warmupRequests.remove_if([](auto const& request) { return request->isGenerationCompleteState(); });
+    }
+    auto const warmupMs
+        = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - warmupStart).count();
+    TLLM_LOG_INFO("Engine warmup finished in %.1f ms", warmupMs);
+}
+
 TrtGptModelInflightBatching::~TrtGptModelInflightBatching()
 {
     if (mCacheTransceiver)
@@ -516,6 +638,14 @@ TrtGptModelInflightBatching::~TrtGptModelInflightBatching()
         mDraftModelSendLogitsThread->join();
         mDraftModelSendLogitsThread.reset(nullptr);
     }
+    if (mIterationProfiler)
+    {
+        auto const& tracePath = common::getEnvIterationProfilerTracePath();
+        if (!tracePath.empty())
+        {
+            mIterationProfiler->writeTrace(tracePath);
+        }
+    }
 }
 
 void TrtGptModelInflightBatching::setupSpeculativeDecodingModule(executor::DecodingConfig const& decodingConfig)
@@ -791,6 +921,29 @@ void TrtGptModelInflightBatching::terminateRequestSync(
     mReqIdsToTerminate.try_emplace(llmRequest->mRequestId, finishReason);
 }
 
+void TrtGptModelInflightBatching::terminateCancelledRequestsEarly(RequestList const& activeRequests)
+{
+    if (mReqIdsToTerminate.empty())
+    {
+        return;
+    }
+    for (auto const& llmReq : activeRequests)
+    {
+        auto const it = mReqIdsToTerminate.find(llmReq->mRequestId);
+        if (it == mReqIdsToTerminate.end() || llmReq->isGenerationCompleteState()
+            || mInflightReqIds.find(llmReq->mRequestId) != mInflightReqIds.end())
+        {
+            continue;
+        }
+        TLLM_LOG_DEBUG("Terminating request %lu before its next scheduling with finish reason %d", llmReq->mRequestId,
+            static_cast<int>(it->second));
+        terminateRequest(llmReq);
+        llmReq->finishByReason(it->second);
+        llmReq->clearGeneratedTokens();
+        mReqIdsToTerminate.erase(it);
+    }
+}
+
 TrtGptModelInflightBatching::IterationStatsIFB TrtGptModelInflightBatching::fillIterationStats(
     ScheduledRequests const& scheduledRequests, RequestVector const& requestsToPause)
 {
@@ -833,7 +986,7 @@ TrtGptModelInflightBatching::IterationStatsIFB TrtGptModelInflightBatching::fill
 void TrtGptModelInflightBatching::forwardSync()
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE_WITH_NAME(range, "TrtGptModelInflightBatching::forwardSync");
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(kBatchManager, range, "TrtGptModelInflightBatching::forwardSync", mIterCounter);
 
     TLLM_CUDA_CHECK(cudaSetDevice(mWorldConfig.getDevice()));
 
@@ -846,6 +999,15 @@ void TrtGptModelInflightBatching::forwardSync()
 
     if (!currRequests.empty())
     {
+        auto& decoderInputBuffers = mDecoderInputBuffers.at(getFusedBufferId());
+        if (decoderInputBuffers.logitsCopyDoneEvent)
+        {
+            // Host logits copied on the dedicated copy stream must have landed before responses read
+            // them and before the logits buffers are written by the next engine run.
+            decoderInputBuffers.logitsCopyDoneEvent->synchronize();
+            decoderInputBuffers.logitsCopyDoneEvent.reset();
+        }
+
         if (!mWorldConfig.isPipelineParallel() || !mWorldConfig.isLastPipelineParallelRank())
         {
             for (auto& hdl : mDecStepAsyncSndHdls)
@@ -854,7 +1016,13 @@ void TrtGptModelInflightBatching::forwardSync()
             }
             // Wait for decoding for requests in flight for the current micro batch
             auto& decoderWaitEvent = mDecoderFinishedEvents.at(mMicroBatchId);
-            mDecStepAsyncSndHdls = decoderSync(currRequests, decoderWaitEvent);
+            auto const transferStart = std::chrono::steady_clock::now();
+            mDecStepAsyncSndHdls = decoderSync(currRequests, decoderWaitEvent, mMicroBatchId);
+            if (mIterationProfiler)
+            {
+                mIterationProfiler->addHostTime(runtime::IterationProfiler::Stage::kTRANSFER,
+                    std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - transferStart).count());
+            }
             decoderWaitEvent.reset();
 
             if (!mWorldConfig.isLastPipelineParallelRank())
@@ -938,6 +1106,8 @@ void TrtGptModelInflightBatching::forwardSync()
     }
     ++mIterCounter;
 
+    arbitrateDeviceMemory();
+
     if (mKvCacheManager)
     {
         mKvCacheManager->flushIterationEvents();
@@ -946,6 +1116,54 @@ void TrtGptModelInflightBatching::forwardSync()
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+void TrtGptModelInflightBatching::arbitrateDeviceMemory()
+{
+    auto const interval = tc::getEnvMemoryArbiterIntervalIters();
+    if (interval == 0 || mIterCounter % static_cast<executor::IterationType>(interval) != 0 || !mKvCacheManager)
+    {
+        return;
+    }
+    NVTX3_SCOPED_RANGE(arbitrateDeviceMemory);
+    auto const headroomBytes = tc::getEnvMemoryArbiterHeadroomMb() << 20;
+    auto [freeMem, totalMem] = tc::getDeviceMemoryInfo(false);
+
+    if (freeMem < headroomBytes)
+    {
+        // The runtime buffer pool keeps everything it ever grew to; return the idle reserve to the
+        // driver first. The pool grows back on demand if a later batch needs it again.
+        auto& manager = mRuntime->getBufferManager();
+        auto const idleReserve = manager.memoryPoolFree();
+        if (idleReserve > 0)
+        {
+            manager.memoryPoolTrimTo(manager.memoryPoolUsed());
+            freeMem += idleReserve;
+        }
+    }
+
+    auto const stats = mKvCacheManager->getKvCacheStats();
+    auto const totalBlocks = stats.maxNumBlocks + mArbiterDrainedBlocks;
+    if (totalBlocks <= 0 || stats.allocatedBytes == 0)
+    {
+        return;
+    }
+    auto const bytesPerBlock = stats.allocatedBytes / static_cast<std::size_t>(totalBlocks);
+    // Track the remaining headroom deficit with the schedulable KV cache capacity: while the device
+    // is short, free blocks worth the deficit are taken out of circulation so the scheduler does not
+    // grow the working set into memory other consumers are contending for; they are returned as the
+    // pressure recedes. The drained count follows the deficit, so repeated runs do not accumulate.
+    auto const deficit = freeMem < headroomBytes ? headroomBytes - freeMem : 0;
+    auto const targetDrained = static_cast<SizeType32>(
+        std::min<std::size_t>((deficit + bytesPerBlock - 1) / bytesPerBlock, static_cast<std::size_t>(totalBlocks)));
+    if (targetDrained > mArbiterDrainedBlocks)
+    {
+        mArbiterDrainedBlocks += mKvCacheManager->shrinkCapacity(targetDrained - mArbiterDrainedBlocks);
+    }
+    else if (targetDrained < mArbiterDrainedBlocks)
+    {
+        mArbiterDrainedBlocks -= mKvCacheManager->growCapacity(mArbiterDrainedBlocks - targetDrained);
+    }
+}
+
 void TrtGptModelInflightBatching::storeContextBlocks(std::shared_ptr<LlmRequest> const& llmReq)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
@@ -986,6 +1204,65 @@ void TrtGptModelInflightBatching::storeNewBlock(std::shared_ptr<LlmRequest> cons
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+void TrtGptModelInflightBatching::deferDuplicatePromptRequests(
+    RequestList const& activeRequests, RequestVector& fittingRequests) const
+{
+    // Hash the prompt of every eligible request still in its context phase. The earliest request of
+    // each group is the lead and runs normally; later arrivals with the same prompt are removed from
+    // the fitting set below until the lead has left the context phase and stored its blocks.
+    // A hash collision merely delays a request for a few iterations - the actual kv cache sharing
+    // happens in the reuse path, which matches full block keys.
+    auto const promptHash = [](std::shared_ptr<LlmRequest> const& llmReq)
+    {
+        std::size_t hash{0xcbf29ce484222325ull};
+        for (auto const token : llmReq->getTokens(0))
+        {
+            hash = (hash ^ static_cast<std::size_t>(static_cast<std::uint32_t>(token))) * 0x100000001b3ull;
+        }
+        if (auto const loraTaskId = llmReq->getLoraTaskId())
+        {
+            hash = (hash ^ static_cast<std::size_t>(loraTaskId.value())) * 0x100000001b3ull;
+        }
+        return hash;
+    };
+    // Prompts shorter than a block leave nothing behind to reuse, and requests with prompt tuning or
+    // multimodal embeddings produce kv cache content that is not captured by the token ids alone.
+    auto const tokensPerBlock = mKvCacheManager->getTokensPerBlock();
+    auto const isEligible = [tokensPerBlock](std::shared_ptr<LlmRequest> const& llmReq)
+    {
+        return llmReq->isContextInitState() && llmReq->getPromptLen() >= tokensPerBlock
+            && !llmReq->getPromptEmbeddingTable().has_value() && !llmReq->getMultimodalEmbedding().has_value();
+    };
+
+    std::unordered_map<std::size_t, LlmRequest::RequestIdType> leadRequests;
+    for (auto const& llmReq : activeRequests)
+    {
+        if (isEligible(llmReq))
+        {
+            leadRequests.try_emplace(promptHash(llmReq), llmReq->mRequestId);
+        }
+    }
+
+    fittingRequests.erase(std::remove_if(fittingRequests.begin(), fittingRequests.end(),
+                              [&promptHash, &isEligible, &leadRequests](std::shared_ptr<LlmRequest> const& llmReq)
+                              {
+                                  if (!isEligible(llmReq) || llmReq->getContextCurrentPosition() > 0)
+                                  {
+                                      return false;
+                                  }
+                                  auto const it = leadRequests.find(promptHash(llmReq));
+                                  if (it == leadRequests.end() || it->second == llmReq->mRequestId)
+                                  {
+                                      return false;
+                                  }
+                                  TLLM_LOG_DEBUG("Deferring request %lu with the same prompt as in-context request "
+                                                 "%lu to reuse its kv cache blocks",
+                                      llmReq->mRequestId, it->second);
+                                  return true;
+                              }),
+        fittingRequests.end());
+}
+
 void TrtGptModelInflightBatching::resetIterationStats()
 {
     mLastIterationStatsIFB = IterationStatsIFB{mMicroBatchId};
@@ -994,16 +1271,40 @@ void TrtGptModelInflightBatching::resetIterationStats()
 void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE_WITH_NAME(range, "TrtGptModelInflightBatching::forwardAsync");
+    NVTX3_CATEGORIZED_RANGE_WITH_BATCH(
+        kBatchManager, range, "TrtGptModelInflightBatching::forwardAsync", mIterCounter, activeRequests.size());
 
     TLLM_CUDA_CHECK(cudaSetDevice(mWorldConfig.getDevice()));
 
+    if (mIterationProfiler)
+    {
+        mIterationProfiler->beginIteration(mIterCounter);
+    }
+
     try
     {
         verifyRequests(activeRequests);
         if (mModelConfig.isTransformerBased() && getKVCacheManager() && mCacheTransceiver)
         {
             checkDisaggGenTransferStatus(activeRequests);
+            if (common::getEnvDisaggGenPrefetchKVCache())
+            {
+                prefetchDisaggGenInitRequests(activeRequests);
+            }
+        }
+        if (common::getEnvPeftCachePrefetch() && mPeftCacheManager->enabled())
+        {
+            // Stage LoRA weights for queued tasks onto the device before the scheduler picks them,
+            // so ensureBatch finds them resident instead of faulting them in on the critical path.
+            std::vector<uint64_t> queuedTaskIds;
+            for (auto const& llmReq : activeRequests)
+            {
+                if (llmReq->getLoraTaskId().has_value())
+                {
+                    queuedTaskIds.push_back(llmReq->getLoraTaskId().value());
+                }
+            }
+            mPeftCacheManager->prefetchTasks(queuedTaskIds);
         }
         auto& currRequests = mMicroBatchScheduledRequests.at(mMicroBatchId);
 
@@ -1011,6 +1312,15 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
         // The scheduler will not include any requests that are (i) still in encoder state if encoder-decoder models OR
         // (ii) already in flight for decoder models
         TLLM_LOG_DEBUG("Running DECODER request scheduler");
+        auto const scheduleStart = std::chrono::steady_clock::now();
+        // Cancelled requests with no work in flight (e.g. between context chunks of a long prefill)
+        // are terminated before scheduling, so their capacity is available in this iteration already.
+        // With overlap scheduling the in-flight set is not tracked, so the forwardSync path handles
+        // them as before.
+        if (!isTrtOverlap())
+        {
+            terminateCancelledRequestsEarly(activeRequests);
+        }
         auto [fittingRequests, fittingDisaggGenInitRequests, requestsToPause]
             = (*mCapacityScheduler)(activeRequests, mKvCacheManager, mPeftCacheManager, mCrossKvCacheManager);
         // Remove from fitting requests the requests that cannot be scheduled due to disagg KV cache transfer
@@ -1031,9 +1341,33 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
                 // will free kvCache in next iteration.
             }
         }
+        // Let fan-out duplicates of a prompt that is currently prefilling wait for the lead request,
+        // so they reuse its stored blocks instead of recomputing the same context.
+        if (mKvCacheManager && mKvCacheManager->isEnableBlockReuse() && !mCrossKvCacheManager)
+        {
+            deferDuplicatePromptRequests(activeRequests, fittingRequests);
+        }
         std::tie(currRequests.contextRequests, currRequests.generationRequests)
             = (*mMicroBatchScheduler)(fittingRequests, mInflightReqIds, mMaxBatchSizeRuntime, mMaxNumTokensRuntime);
+        if (mIterationJournal)
+        {
+            if (mIterationJournal->isReplaying())
+            {
+                mIterationJournal->replayIteration(
+                    mIterCounter, activeRequests, currRequests.contextRequests, currRequests.generationRequests);
+            }
+            else
+            {
+                mIterationJournal->recordIteration(
+                    mIterCounter, currRequests.contextRequests, currRequests.generationRequests);
+            }
+        }
         TLLM_CHECK(currRequests.size() <= static_cast<size_t>(getMaxBatchSize()));
+        if (mIterationProfiler)
+        {
+            mIterationProfiler->addHostTime(runtime::IterationProfiler::Stage::kSCHEDULE,
+                std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - scheduleStart).count());
+        }
 
         (*mPauseRequests)(requestsToPause, mInflightReqIds, mReqIdsToPause, false, *mSeqSlotManager, mKvCacheManager,
             mCrossKvCacheManager, mPeftCacheManager);
@@ -1089,12 +1423,23 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
             }
             sync_check_cuda_error(mRuntime->getStream().get());
 
+            if (mIterationProfiler)
+            {
+                mIterationProfiler->recordStart(
+                    runtime::IterationProfiler::Stage::kENGINE, mRuntime->getStream().get());
+            }
             executeBatch(currRequests);
+            if (mIterationProfiler)
+            {
+                mIterationProfiler->recordStop(runtime::IterationProfiler::Stage::kENGINE, mRuntime->getStream().get());
+            }
             if (mWorldConfig.isLastPipelineParallelRank() && mGuidedDecoder)
             {
-                // XGrammar: build maskcache for context requests and perform maskgen for all requests
-                // These need to be overlapped with the kernel execution of forward step
-                mGuidedDecoder->build(currRequests);
+                // XGrammar: build maskcache for context requests and perform maskgen for all requests.
+                // This runs on a side thread so it overlaps the host-side decoder preparation below as
+                // well as the kernel execution of the forward step; the guided decoder joins the build
+                // before applying the bitmasks in execute().
+                mGuidedDecoder->buildAsync(currRequests);
             }
 
             sync_check_cuda_error(mRuntime->getStream().get());
@@ -1121,14 +1466,39 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
                 }
             }
 
+            if (mPPDecoderOverlap)
+            {
+                // The engine forward of this micro batch is enqueued; drain the previous micro
+                // batch's decoder now, so its sampling and token broadcast overlapped the engine
+                // run instead of stalling the pipeline at the iteration boundary. This also covers
+                // the decoder statefulness WAR above before this micro batch's decoder step.
+                finishPreviousMicroBatchDecoder();
+            }
+
             auto& decoderFinishedEvent = mDecoderFinishedEvents.at(mMicroBatchId);
             TLLM_CHECK_WITH_INFO(!decoderFinishedEvent.has_value(), "decoderFinishedEvent must be nullopt.");
+            if (mIterationProfiler && mWorldConfig.isLastPipelineParallelRank())
+            {
+                mIterationProfiler->recordStart(
+                    runtime::IterationProfiler::Stage::kDECODE, mRuntime->getStream().get());
+            }
             decoderFinishedEvent = mWorldConfig.isLastPipelineParallelRank()
                 ? std::make_optional(decoderStepAsync(currRequests))
                 : std::nullopt;
+            if (mIterationProfiler && mWorldConfig.isLastPipelineParallelRank())
+            {
+                mIterationProfiler->recordStop(runtime::IterationProfiler::Stage::kDECODE, mRuntime->getStream().get());
+            }
 
             sync_check_cuda_error(mRuntime->getStream().get());
 
+            mDecoderStepsSinceSync.at(mMicroBatchId) = 1;
+            if (auto const multiStepDecodeSteps = common::getEnvMultiStepDecodeSteps();
+                multiStepDecodeSteps > 1 && canRunMultiStepDecode(currRequests))
+            {
+                mDecoderStepsSinceSync.at(mMicroBatchId) = runMultiStepDecode(currRequests, multiStepDecodeSteps);
+            }
+
             mLastIterationStatsIFB = fillIterationStats(currRequests, requestsToPause);
             for (auto const& requests : {currRequests.contextRequests, currRequests.generationRequests})
             {
@@ -1172,10 +1542,16 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
         }
         else
         {
+            if (mPPDecoderOverlap)
+            {
+                // Nothing was scheduled for this micro batch, so there is no engine run to hide
+                // behind; drain the previous micro batch's decoder before handing back the slot.
+                finishPreviousMicroBatchDecoder();
+            }
             mLastIterationStatsIFB = IterationStatsIFB{mMicroBatchId};
         }
 
-        if (mWorldConfig.isPipelineParallel() && mWorldConfig.isLastPipelineParallelRank())
+        if (mWorldConfig.isPipelineParallel() && mWorldConfig.isLastPipelineParallelRank() && !mPPDecoderOverlap)
         {
             mAsyncSendWaitThread->waitStop();
             if (!currRequests.empty())
@@ -1186,7 +1562,14 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
                 }
                 // Wait for decoding for requests in flight for the current micro batch
                 auto& decoderFinishedEvent = mDecoderFinishedEvents.at(mMicroBatchId);
-                mDecStepAsyncSndHdls = decoderSync(currRequests, decoderFinishedEvent);
+                auto const transferStart = std::chrono::steady_clock::now();
+                mDecStepAsyncSndHdls = decoderSync(currRequests, decoderFinishedEvent, mMicroBatchId);
+                if (mIterationProfiler)
+                {
+                    mIterationProfiler->addHostTime(runtime::IterationProfiler::Stage::kTRANSFER,
+                        std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - transferStart)
+                            .count());
+                }
                 decoderFinishedEvent.reset();
 
                 mAsyncSendWaitThread->notifyStart();
@@ -1196,6 +1579,12 @@ void TrtGptModelInflightBatching::forwardAsync(RequestList const& activeRequests
         // Update the micro batch ID
         mMicroBatchId = getNextMicroBatchId(mMicroBatchId);
     }
+    // An error attributable to a single request propagates as-is: the executor fails only that
+    // request and the other batch slots stay live.
+    catch (common::RequestSpecificException const&)
+    {
+        throw;
+    }
     // In case of error, we need to free the batch slot associated with those requests
     catch (std::exception const&)
     {
@@ -1241,6 +1630,39 @@ void TrtGptModelInflightBatching::updatePeftCache(std::shared_ptr<LlmRequest> co
     mPeftCacheManager->addRequestPeft(llmRequest, true);
 }
 
+void TrtGptModelInflightBatching::updateWeights(std::map<std::string, executor::Tensor> const& weights)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    NVTX3_SCOPED_RANGE(updateWeights);
+
+    if (weights.empty())
+    {
+        TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+        return;
+    }
+
+    TllmRuntime::TensorMap weightsMap;
+    for (auto const& [name, tensor] : weights)
+    {
+        weightsMap.emplace(name, executor::detail::toITensor(tensor));
+    }
+
+    // Stage the copies on the copy stream behind all enqueued engine work and make the runtime stream wait
+    // for them, so the update is atomic between iterations without blocking the host. The weights are
+    // patched in place, which keeps tensor addresses bound to the contexts and captured CUDA graphs valid.
+    runtime::CudaEvent engineDone{};
+    mRuntime->getStream().record(engineDone);
+    mCopyBufferManager.getStream().wait(engineDone);
+
+    mRuntime->refitManagedWeights(weightsMap, mCopyBufferManager);
+
+    runtime::CudaEvent copiesDone{};
+    mCopyBufferManager.getStream().record(copiesDone);
+    mRuntime->getStream().wait(copiesDone);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 runtime::BufferManager const& TrtGptModelInflightBatching::getBufferManager() const
 {
     return mRuntime->getBufferManager();
@@ -1258,7 +1680,7 @@ void TrtGptModelInflightBatching::executeContext(SizeType32 runtimeContextId, Si
 
     auto const& currBatchState = mBuffers[bufferId]->getBatchState();
 
-    bool hasCudaGraph = false;
+    std::shared_ptr<utils::CudaGraphExecutor> cudaGraph{};
     // If batch state is context only, do not capture/launch graph and execute the engine as is.
     if (isCudaGraphMode() && !currBatchState.isAnyContext())
     {
@@ -1266,14 +1688,31 @@ void TrtGptModelInflightBatching::executeContext(SizeType32 runtimeContextId, Si
         // If graph exists for current batch state, launch it.
         if (cudaGraphOpt.has_value())
         {
-            hasCudaGraph = true;
+            cudaGraph = cudaGraphOpt.value();
         }
     }
 
+    // The priority split takes precedence over the per-micro-batch streams: steps of the same kind
+    // then serialize on their priority stream, but generation steps keep preempting context steps.
+    auto const useSplitPriorityStream = mContextEngineStream != nullptr;
+    auto const useMicroBatchStream = !mMicroBatchStreams.empty();
+    auto const useSideStream = useSplitPriorityStream || useMicroBatchStream;
+    auto const& engineStream = useSplitPriorityStream
+        ? (currBatchState.isAnyContext() ? *mContextEngineStream : *mGenerationEngineStream)
+        : useMicroBatchStream ? *mMicroBatchStreams.at(bufferId % mNumMicroBatches)
+                              : mRuntime->getStream();
+    if (useSideStream)
+    {
+        // Engine inputs are prepared on the runtime stream.
+        CudaEvent inputsReady{};
+        mRuntime->getStream().record(inputsReady);
+        engineStream.wait(inputsReady);
+    }
+
     // If there is no graph for current state, execute the engine.
-    if (!hasCudaGraph)
+    if (!cudaGraph)
     {
-        auto enqueueSuccessful = mRuntime->executeContext(runtimeContextId);
+        auto enqueueSuccessful = mRuntime->executeContext(runtimeContextId, engineStream);
         if (!enqueueSuccessful)
         {
             throw std::runtime_error("Executing TRT engine failed!");
@@ -1282,8 +1721,15 @@ void TrtGptModelInflightBatching::executeContext(SizeType32 runtimeContextId, Si
     else
     {
         // Launch graph.
-        auto cudaGraphOpt = mCudaGraphExecutorCaches[bufferId].get(currBatchState);
-        cudaGraphOpt.value()->launch(mRuntime->getStream());
+        cudaGraph->launch(engineStream);
+    }
+
+    if (useSideStream)
+    {
+        // Everything that consumes the engine outputs (logits handoff, decoder) runs on the runtime stream.
+        CudaEvent engineDone{};
+        engineStream.record(engineDone);
+        mRuntime->getStream().wait(engineDone);
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -1343,7 +1789,7 @@ void TrtGptModelInflightBatching::verifyRequests(RequestList const& activeReques
 void TrtGptModelInflightBatching::executeBatch(ScheduledRequests const& scheduledRequests)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(executeBatch);
+    NVTX3_CATEGORIZED_RANGE_WITH_BATCH(kBatchManager, executeBatch_range, "executeBatch", mIterCounter, scheduledRequests.size());
 
     if (!mCtxGenFusion)
     {
@@ -1479,7 +1925,12 @@ void TrtGptModelInflightBatching::createDecoder(std::optional<executor::Decoding
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
 
-    mDecoderState = std::make_unique<runtime::decoder::DecoderState>();
+    // The decoder state is reused across reconfigurations; its setup is incremental and keeps the
+    // existing allocation when the new configuration fits it.
+    if (!mDecoderState)
+    {
+        mDecoderState = std::make_unique<runtime::decoder::DecoderState>();
+    }
 
     if (mWorldConfig.isLastPipelineParallelRank())
     {
@@ -1500,9 +1951,16 @@ void TrtGptModelInflightBatching::createDecoder(std::optional<executor::Decoding
             }
         }
 
-        mDecoder = std::make_unique<runtime::GptDecoderBatched>(mRuntime->getStreamPtr());
+        if (!mDecoder)
+        {
+            mDecoder = std::make_unique<runtime::GptDecoderBatched>(mRuntime->getStreamPtr());
+        }
         mDecoder->setup(
             decodingMode, getMaxNumSequences(), mOperatingBeamWidth, decoderType, mModelConfig, mWorldConfig);
+        if (isCudaGraphMode() && common::getEnvEnableDecoderCudaGraph())
+        {
+            mDecoder->setCudaGraphMode(true);
+        }
 
         mDecoderState->setup(getMaxNumSequences(), mOperatingBeamWidth, getMaxAttentionWindow(), getSinkTokenLen(),
             getMaxSequenceLen(), decoderType, mModelConfig, mWorldConfig, mRuntime->getBufferManager());
@@ -1620,6 +2078,30 @@ void TrtGptModelInflightBatching::prepareDisaggGenInitRequests(
     return;
 }
 
+void TrtGptModelInflightBatching::prefetchDisaggGenInitRequests(RequestList const& activeRequests)
+{
+    NVTX3_SCOPED_RANGE(prefetchDisaggGenInitRequests);
+
+    // Start KV onboarding for arrived generation requests ahead of the capacity scheduler, so the
+    // transfer overlaps with the iterations spent waiting for admission. Only requests whose whole
+    // cache can be reserved next to the already-admitted ones are prefetched; the scheduler then
+    // sees them in the transmission states it already handles.
+    RequestVector prefetchReqs;
+    for (auto const& llmReq : activeRequests)
+    {
+        if (llmReq->isDisaggGenerationInitState() && mKvCacheManager->canPrefetchRequest(*llmReq))
+        {
+            prefetchReqs.push_back(llmReq);
+        }
+    }
+    if (!prefetchReqs.empty())
+    {
+        TLLM_LOG_DEBUG(mpi::MpiComm::world().getRank(),
+            "Prefetching KV cache for %ld disaggregated generation requests", prefetchReqs.size());
+        prepareDisaggGenInitRequests(activeRequests, prefetchReqs);
+    }
+}
+
 void TrtGptModelInflightBatching::checkDisaggGenTransferStatus(RequestList const& activeRequests)
 {
     NVTX3_SCOPED_RANGE(checkDisaggGenTransferStatus);
@@ -1726,8 +2208,8 @@ void TrtGptModelInflightBatching::debugIOTensors(RequestVector const& contextReq
 }
 
 std::tuple<SizeType32, runtime::StringPtrMap<runtime::ITensor> const&, runtime::StringPtrMap<runtime::ITensor>&>
-TrtGptModelInflightBatching::prepareBuffers(
-    RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId)
+TrtGptModelInflightBatching::prepareBuffers(RequestVector const& contextRequests,
+    RequestVector const& generationRequests, SizeType32 bufferId, SizeType32 stepsSinceHostSync)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(prepareBuffers);
@@ -1741,7 +2223,7 @@ TrtGptModelInflightBatching::prepareBuffers(
     auto [optProfileId, inputMap, outputMap] = runtimeBuffers.prepareStep(contextRequests, generationRequests,
         mOperatingBeamWidth, getMaxAttentionWindow(), *mDecoderState, mKvCacheManager.get(), mCrossKvCacheManager.get(),
         mRnnStateManager.get(), mPeftTables[bufferId], *mRuntime, mModelConfig, mWorldConfig,
-        getGatherGenerationLogits(), isTrtOverlap(), allNewTokens);
+        getGatherGenerationLogits(), isTrtOverlap() ? 1 : stepsSinceHostSync, allNewTokens);
 
     // For Variable-Beam-Width-Search
     mRuntime->setCurrentBeamWidths(
@@ -1777,8 +2259,8 @@ void TrtGptModelInflightBatching::prepareGraph(SizeType32 bufferId, SizeType32 o
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
-void TrtGptModelInflightBatching::executeStep(
-    RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId)
+void TrtGptModelInflightBatching::executeStep(RequestVector const& contextRequests,
+    RequestVector const& generationRequests, SizeType32 bufferId, SizeType32 stepsSinceHostSync)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE_WITH_NAME(range,
@@ -1790,7 +2272,8 @@ void TrtGptModelInflightBatching::executeStep(
         prefetchNextPromptTableChunk(contextRequests, /* isFirstChunk */ true, bufferId);
     }
 
-    auto [optProfileId, inputMap, outputMap] = prepareBuffers(contextRequests, generationRequests, bufferId);
+    auto [optProfileId, inputMap, outputMap]
+        = prepareBuffers(contextRequests, generationRequests, bufferId, stepsSinceHostSync);
 
     if (mBuffers[bufferId]->transformerBuffers)
     {
@@ -1877,6 +2360,8 @@ void TrtGptModelInflightBatching::setupDecoderStep(
             mDecoder->getUnderlyingDecoder().setup(samplingConfig, localBatchSize, batchSlots,
                 {mDecoderState->getJointDecodingOutput()}, mModelConfig.getDataType(), lookaheadPrompt,
                 lookaheadAlgoConfigs);
+            // Captured decoder graphs bake in per-request host-side decisions made during setup.
+            mDecoder->clearCudaGraphs();
 
             auto const& stream = mDecoder->getDecoderStream();
             CudaEvent event{};
@@ -2033,27 +2518,68 @@ bool batchReturnLogProbs(ScheduledRequests const& scheduledRequests)
     return std::any_of(scheduledRequests.contextRequests.begin(), scheduledRequests.contextRequests.end(), pred)
         || std::any_of(scheduledRequests.generationRequests.begin(), scheduledRequests.generationRequests.end(), pred);
 }
+
+// Check if one of the requests returns context or generation logits to the host
+bool batchReturnsLogits(ScheduledRequests const& scheduledRequests)
+{
+    auto pred = [](auto const& llmReq)
+    { return llmReq->getReturnContextLogits() || llmReq->getReturnGenerationLogits(); };
+    return std::any_of(scheduledRequests.contextRequests.begin(), scheduledRequests.contextRequests.end(), pred)
+        || std::any_of(scheduledRequests.generationRequests.begin(), scheduledRequests.generationRequests.end(), pred);
+}
+
+// Check if one of the requests modifies its logits with a post-processor callback
+bool batchHasLogitsPostProcessor(ScheduledRequests const& scheduledRequests)
+{
+    auto pred = [](auto const& llmReq) { return llmReq->mLogitsPostProcessor.has_value(); };
+    return std::any_of(scheduledRequests.contextRequests.begin(), scheduledRequests.contextRequests.end(), pred)
+        || std::any_of(scheduledRequests.generationRequests.begin(), scheduledRequests.generationRequests.end(), pred);
+}
 } // namespace
 
 runtime::CudaEvent TrtGptModelInflightBatching::decoderStepAsync(ScheduledRequests const& scheduledRequests)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(decoderStepAsync);
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(kDecoder, decoderStepAsync_range, "decoderStepAsync", mIterCounter);
 
     auto& decoderInputBuffers = mDecoderInputBuffers.at(getFusedBufferId());
 
+    // Route returned-logits D2H traffic to the dedicated copy stream so a large context-logits copy does not
+    // delay the decoder and the next engine launch on the runtime stream. Requests with logits post-processors
+    // and guided decoding keep the runtime-stream copies, since those modify the logits in place after the
+    // handlers would have enqueued the copies.
+    auto const useLogitsCopyStream = batchReturnsLogits(scheduledRequests) && !mGuidedDecoder
+        && !mLogitsPostProcessorBatched && !batchHasLogitsPostProcessor(scheduledRequests);
+    HandleContextLogits::OptionalRef<runtime::BufferManager const> logitsCopyManager{std::nullopt};
+    if (useLogitsCopyStream)
+    {
+        runtime::CudaEvent logitsReady{};
+        mRuntime->getStreamPtr()->record(logitsReady);
+        mCopyBufferManager.getStream().wait(logitsReady);
+        logitsCopyManager = mCopyBufferManager;
+    }
+
     auto const contextBufferId = mCtxGenFusion ? getFusedBufferId() : getContextBufferId();
     auto& contextRuntimeBuffers = mBuffers.at(contextBufferId);
     auto const logitsIndex = (*mHandleContextLogits)(decoderInputBuffers, scheduledRequests.contextRequests,
         contextRuntimeBuffers->logits, contextRuntimeBuffers->numContextLogits, mModelConfig,
-        mRuntime->getBufferManager(), contextRuntimeBuffers->mMedusaBuffers);
+        mRuntime->getBufferManager(), contextRuntimeBuffers->mMedusaBuffers, logitsCopyManager);
 
     auto const genLogitsIndex = mCtxGenFusion ? logitsIndex : 0;
     auto const genBufferId = mCtxGenFusion ? getFusedBufferId() : getGenerationBufferId();
     auto& genRuntimeBuffers = mBuffers.at(genBufferId);
     (*mHandleGenerationLogits)(decoderInputBuffers, scheduledRequests.generationRequests, genRuntimeBuffers->logits,
         genLogitsIndex, mModelConfig, mRuntime->getBufferManager(), *genRuntimeBuffers,
-        genRuntimeBuffers->mMedusaBuffers);
+        genRuntimeBuffers->mMedusaBuffers, logitsCopyManager);
+
+    if (useLogitsCopyStream)
+    {
+        // forwardSync waits on this event before host logits are read for responses and before the
+        // logits buffers can be written by a later engine run.
+        runtime::CudaEvent logitsCopyDone{};
+        mCopyBufferManager.getStream().record(logitsCopyDone);
+        decoderInputBuffers.logitsCopyDoneEvent = std::move(logitsCopyDone);
+    }
 
     if (mOperatingBeamWidth > 1)
     {
@@ -2085,6 +2611,91 @@ runtime::CudaEvent TrtGptModelInflightBatching::decoderStepAsync(ScheduledReques
     return updateDecoderBuffersEvent;
 }
 
+bool TrtGptModelInflightBatching::canRunMultiStepDecode(ScheduledRequests const& scheduledRequests) const
+{
+    // Multi-step decode keeps request state on the device between host reconciles, so every per-step host
+    // action for the batch must be droppable bookkeeping. Anything that reads tokens, logits, or finish
+    // state on the host each step disqualifies the batch.
+    if (!scheduledRequests.contextRequests.empty() || scheduledRequests.generationRequests.empty())
+    {
+        return false;
+    }
+    if (isTrtOverlap() || mNumMicroBatches > 1 || mWorldConfig.isPipelineParallel())
+    {
+        return false;
+    }
+    if (mOperatingBeamWidth > 1 || !mModelConfig.getSpeculativeDecodingMode().isNone()
+        || !mModelConfig.isTransformerBased())
+    {
+        return false;
+    }
+    if (mGuidedDecoder || mLogitsPostProcessorBatched)
+    {
+        return false;
+    }
+    if (mAdditionalModelOutputs.has_value() && !mAdditionalModelOutputs.value().empty())
+    {
+        return false;
+    }
+    // Block reuse stores completed blocks every step with token ids the host does not have mid-burst.
+    if (mKvCacheManager && mKvCacheManager->isEnableBlockReuse())
+    {
+        return false;
+    }
+    for (auto const& llmReq : scheduledRequests.generationRequests)
+    {
+        if (llmReq->isStreaming() || llmReq->returnLogProbs() || llmReq->getReturnContextLogits()
+            || llmReq->getReturnGenerationLogits() || llmReq->mLogitsPostProcessor.has_value()
+            || llmReq->hasDraftTokens())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+SizeType32 TrtGptModelInflightBatching::runMultiStepDecode(
+    ScheduledRequests const& scheduledRequests, SizeType32 maxSteps)
+{
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(kDecoder, runMultiStepDecode_range, "runMultiStepDecode", mIterCounter);
+
+    // Cap the burst so no sequence can outrun its token budget or the engine's maximum sequence length.
+    // Sequences that finish by end id or stop words mid-burst early-exit in the decode kernels via the
+    // device finished flags, like finished sequences of an overlap-scheduled batch.
+    auto steps = maxSteps;
+    for (auto const& llmReq : scheduledRequests.generationRequests)
+    {
+        auto const numGenerated = llmReq->getMaxNumGeneratedTokens();
+        auto const budgetHeadroom = llmReq->mMaxNewTokens - numGenerated;
+        auto const seqLenHeadroom = getMaxSequenceLen() - (llmReq->mPromptLen + numGenerated);
+        steps = std::min(steps, std::min(budgetHeadroom, seqLenHeadroom));
+    }
+    if (steps <= 1)
+    {
+        return 1;
+    }
+
+    auto const bufferId = getFusedBufferId();
+    auto& decoderFinishedEvent = mDecoderFinishedEvents.at(mMicroBatchId);
+    RequestVector noContextRequests;
+    for (SizeType32 step = 1; step < steps; ++step)
+    {
+        // One more kv cache token per sequence for this step.
+        if (mKvCacheManager)
+        {
+            (*mAllocateKvCache)(*mKvCacheManager, noContextRequests, scheduledRequests.generationRequests,
+                mModelConfig, mCrossKvCacheManager);
+        }
+        // Order this step's input-ids gather and engine run behind the previous decoder step, which
+        // produces the tokens and still reads the logits buffers the engine is about to overwrite.
+        mRuntime->getStream().wait(decoderFinishedEvent.value());
+        executeStep(noContextRequests, scheduledRequests.generationRequests, bufferId, step);
+        decoderFinishedEvent = decoderStepAsync(scheduledRequests);
+    }
+    sync_check_cuda_error(mRuntime->getStream().get());
+    return steps;
+}
+
 void TrtGptModelInflightBatching::copyCacheIndirectionFromOutputsToInputs(
     ScheduledRequests const& scheduledRequests, SizeType32 genBufferId)
 {
@@ -2145,12 +2756,12 @@ void TrtGptModelInflightBatching::copyCacheIndirectionFromOutputsToInputs(
 }
 
 std::vector<std::unique_ptr<DecoderStepAsyncSend>> TrtGptModelInflightBatching::communicateDecoderBuffers(
-    bool returnLogProbs)
+    bool returnLogProbs, SizeType32 microBatchId)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     NVTX3_SCOPED_RANGE(communicateDecoderBuffers);
 
-    auto& decoderOutputBuffers = mDecoderOutputBuffers.at(getFusedBufferId());
+    auto& decoderOutputBuffers = mDecoderOutputBuffers.at(microBatchId);
 
     std::vector<std::unique_ptr<DecoderStepAsyncSend>> asyncHandles;
     if (mWorldConfig.isLastPipelineParallelRank())
@@ -2189,12 +2800,12 @@ std::vector<std::unique_ptr<DecoderStepAsyncSend>> TrtGptModelInflightBatching::
     return asyncHandles;
 }
 
-void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& scheduledRequests)
+void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& scheduledRequests, SizeType32 microBatchId)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(updateRequests);
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(kDecoder, updateRequests_range, "updateRequests", mIterCounter);
 
-    auto const& decoderOutputBuffers = mDecoderOutputBuffers.at(getFusedBufferId());
+    auto const& decoderOutputBuffers = mDecoderOutputBuffers.at(microBatchId);
 
     auto const hostNewOutputTokensShape = decoderOutputBuffers.newOutputTokensHost->getShape();
     auto const* const hostNewOutputTokensData
@@ -2206,6 +2817,16 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
     auto const* const finishReasonsHostData
         = bufferCast<kernels::FinishedState>(*decoderOutputBuffers.finishReasonsHost);
 
+    // After a multi-step decode burst the new tokens are read from the staged decoder ids tensor,
+    // since newOutputTokensHost only holds the final step.
+    auto const stepsSinceSync = mDecoderStepsSinceSync.at(microBatchId);
+    auto const* const multiStepIdsData
+        = stepsSinceSync > 1 ? bufferCast<TokenIdType const>(*mMultiStepIdsHost) : nullptr;
+
+    // KV cache rewinds of requests that stay active are gathered and applied in one batched call
+    // below, instead of once per request.
+    std::vector<std::pair<LlmRequest::RequestIdType, SizeType32>> batchedRewinds;
+
     // Update only requests that ran through the decoder
     for (auto const& llmReq : scheduledRequests.generationRequests)
     {
@@ -2237,7 +2858,8 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
 
         // numGeneratedTokens is the number of tokens generated by the decoder.
         // Some tokens might be dropped due to end token or rejected draft tokens.
-        auto const numGeneratedTokens = llmReq->getNumDraftTokens() + 1;
+        auto const numGeneratedTokens
+            = stepsSinceSync > 1 ? stepsSinceSync : llmReq->getNumDraftTokens() + 1;
 
         for (SizeType32 beam = 0; beam < reqBeamWidth; ++beam)
         {
@@ -2256,8 +2878,11 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
             numDroppedTokens[beam] = numGeneratedTokens - numNewTokens[beam];
             for (SizeType32 step = 0; step < numNewTokens[beam]; ++step)
             {
-                auto const newTokenIdx = tc::flat_index(hostNewOutputTokensShape.d, step, seqSlot, beam);
-                auto const newToken = hostNewOutputTokensData[newTokenIdx];
+                // getNumTokens advances with each addNewToken, so it indexes the next burst token in order.
+                auto const newToken = multiStepIdsData != nullptr
+                    ? multiStepIdsData[tc::flat_index(
+                        mMultiStepIdsHost->getShape().d, seqSlot, beam, llmReq->getNumTokens(beam))]
+                    : hostNewOutputTokensData[tc::flat_index(hostNewOutputTokensShape.d, step, seqSlot, beam)];
                 llmReq->addNewToken(newToken, beam);
                 TLLM_LOG_DEBUG("request ID %ld beam %d newToken %d", llmReq->mRequestId, beam, newToken);
 
@@ -2333,8 +2958,20 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
                 TLLM_CHECK(0 <= acceptedTokensLen && acceptedTokensLen <= prevDraftTokensLen);
 
                 // At this point, KV cache rows are already gathered and moved to the right location.
-                // We can safely rewind (draft - accepted) tokens
-                mKvCacheManager->rewindKVCache(llmReq->mRequestId, rewindLength);
+                // We can safely rewind (draft - accepted) tokens. A request that is terminated
+                // below must rewind first, so that only accepted tokens are stored for reuse;
+                // everything else is deferred to the batched call after the loop.
+                bool const willTerminate = decoderFinishedSumPtr[seqSlot] == reqBeamWidth
+                    || (mModelConfig.getSpeculativeDecodingMode().isDraftTokensExternal()
+                        && llmReq->hasDraftTokens());
+                if (willTerminate)
+                {
+                    mKvCacheManager->rewindKVCache(llmReq->mRequestId, rewindLength);
+                }
+                else
+                {
+                    batchedRewinds.emplace_back(llmReq->mRequestId, rewindLength);
+                }
             }
         }
 
@@ -2377,6 +3014,11 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
             {
                 // This state prohibits the request from being scheduled for another iteration. It assumes that the next
                 // iteration has already been scheduled and the request can finish in the next call to updateRequests().
+                // Requests that finish by end id or stop words cannot be predicted on the host, so with overlap they
+                // spend one extra iteration in the engine batch: the batch enqueued alongside the decoder step cannot
+                // be compacted once its shapes are fixed (and may run as a captured CUDA graph). Their slots early-exit
+                // in the decode kernels via the finished flags, and their KV blocks are freed by terminateRequest()
+                // before the following batch is scheduled.
                 llmReq->setState(LlmRequestState::kGENERATION_TO_COMPLETE);
             }
         }
@@ -2397,6 +3039,11 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
         }
     }
 
+    if (!batchedRewinds.empty())
+    {
+        mKvCacheManager->rewindKVCacheBatched(batchedRewinds);
+    }
+
     if (mModelConfig.getSpeculativeDecodingMode().needsKVCacheRewind())
     {
         SizeType32 numSequences{0};
@@ -2417,25 +3064,68 @@ void TrtGptModelInflightBatching::updateRequests(ScheduledRequests const& schedu
 }
 
 std::vector<std::unique_ptr<DecoderStepAsyncSend>> TrtGptModelInflightBatching::decoderSync(
-    ScheduledRequests const& scheduledRequests, std::optional<runtime::CudaEvent> const& decoderFinishEvent)
+    ScheduledRequests const& scheduledRequests, std::optional<runtime::CudaEvent> const& decoderFinishEvent,
+    SizeType32 microBatchId)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    NVTX3_SCOPED_RANGE(decoderSync);
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(kDecoder, decoderSync_range, "decoderSync", mIterCounter);
 
     if (mWorldConfig.isLastPipelineParallelRank())
     {
         decoderFinishEvent->synchronize();
     }
 
+    if (mDecoderStepsSinceSync.at(microBatchId) > 1)
+    {
+        // newOutputTokensHost only holds the final step of a multi-step decode burst; stage the full
+        // decoder ids tensor so updateRequests can append every token generated since the last sync.
+        auto const ids = mDecoderState->getIds();
+        if (!mMultiStepIdsHost || mMultiStepIdsHost->getShape().d[0] != ids->getShape().d[0])
+        {
+            mMultiStepIdsHost = runtime::BufferManager::pinned(ids->getShape(), ids->getDataType());
+        }
+        auto const& manager = mRuntime->getBufferManager();
+        manager.copy(*ids, *mMultiStepIdsHost);
+        manager.getStream().synchronize();
+    }
+
     auto const returnLogProbs = batchReturnLogProbs(scheduledRequests);
-    auto asyncHandles = communicateDecoderBuffers(returnLogProbs);
+    auto asyncHandles = communicateDecoderBuffers(returnLogProbs, microBatchId);
 
-    updateRequests(scheduledRequests);
+    updateRequests(scheduledRequests, microBatchId);
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
     return asyncHandles;
 }
 
+void TrtGptModelInflightBatching::finishPreviousMicroBatchDecoder()
+{
+    auto const prevMicroBatchId = getPrevMicroBatchId(mMicroBatchId);
+    auto& prevDecoderFinishedEvent = mDecoderFinishedEvents.at(prevMicroBatchId);
+    if (!prevDecoderFinishedEvent.has_value())
+    {
+        return;
+    }
+    NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(
+        kDecoder, finishPrevMicroBatch_range, "finishPreviousMicroBatchDecoder", mIterCounter);
+
+    mAsyncSendWaitThread->waitStop();
+    for (auto& hdl : mDecStepAsyncSndHdls)
+    {
+        TLLM_CHECK_WITH_INFO(hdl.get() == nullptr, "decoderSync handle must be nullptr.");
+    }
+    auto& prevRequests = mMicroBatchScheduledRequests.at(prevMicroBatchId);
+    auto const transferStart = std::chrono::steady_clock::now();
+    mDecStepAsyncSndHdls = decoderSync(prevRequests, prevDecoderFinishedEvent, prevMicroBatchId);
+    if (mIterationProfiler)
+    {
+        mIterationProfiler->addHostTime(runtime::IterationProfiler::Stage::kTRANSFER,
+            std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - transferStart).count());
+    }
+    prevDecoderFinishedEvent.reset();
+    mAsyncSendWaitThread->notifyStart();
+}
+
 void TrtGptModelInflightBatching::rewindKVCacheBlocks(SizeType32 numSequences)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
@@ -2697,6 +3387,12 @@ executor::DebugTensorsPerIteration TrtGptModelInflightBatching::getCurrentDebugT
     return debugTensors;
 }
 
+bool TrtGptModelInflightBatching::writeDecoderTimingTrace(std::string const& path) const
+{
+    // The decoder only exists on the last pipeline parallel rank.
+    return mDecoder && mDecoder->writeTimingTrace(path);
+}
+
 nvinfer1::DataType TrtGptModelInflightBatching::getTensorDataType(std::string const& name) const
 {
     auto const& engine = mRuntime->getEngine();
@@ -33,6 +33,7 @@ namespace tensorrt_llm::runtime
 {
 class TllmRuntime;
 class GptDecoderBatched;
+class IterationProfiler;
 class AllReduceBuffers;
 class NcclCommunicator;
 class SpeculativeDecodingMode;
@@ -58,6 +59,7 @@ class MpiWaitThread;
 namespace tensorrt_llm::batch_manager
 {
 class BaseCacheTransceiver;
+class IterationJournal;
 }
 
 namespace tensorrt_llm::batch_manager
@@ -197,6 +199,9 @@ public:
 
     void updatePeftCache(std::shared_ptr<LlmRequest> const& llmRequest) override;
 
+    /// @brief Update managed engine weights in place, staged through the copy stream.
+    void updateWeights(std::map<std::string, executor::Tensor> const& weights) override;
+
     [[nodiscard]] IterationStatsIFB getLastIterationStats() const
     {
         return mLastIterationStatsIFB;
@@ -214,6 +219,8 @@ public:
     void getCurrentRequestStats(executor::RequestStatsPerIteration& stats) const override;
     [[nodiscard]] executor::DebugTensorsPerIteration getCurrentDebugTensors() const override;
 
+    bool writeDecoderTimingTrace(std::string const& path) const override;
+
     [[nodiscard]] executor::IterationType getIterCounter() const noexcept override
     {
         return mIterCounter;
@@ -225,6 +232,7 @@ public:
         runtime::ModelConfig const& modelConfig, executor::ExecutorConfig const& executorConfig);
 
     void prepareDisaggGenInitRequests(RequestList const& activeRequests, RequestVector& newGenReques);
+    void prefetchDisaggGenInitRequests(RequestList const& activeRequests);
     void checkDisaggGenTransferStatus(RequestList const& activeRequests);
     void prepareDistGenBufferAndDecoder(RequestVector const& generationRequests);
 
@@ -261,6 +269,14 @@ private:
         return (bufferId + mNumMicroBatches - 1) % mNumMicroBatches;
     }
 
+    //! @brief Run synthetic requests through the full pipeline before the model serves traffic.
+    //! @details Shapes come from TRTLLM_ENGINE_WARMUP_SHAPES (a recorded profile of
+    //!          inputLen:outputLen:count triples). Each shape passes through scheduler, engine,
+    //!          decoder and kv-cache allocation, so kernel JIT, cuda graph capture and memory pool
+    //!          growth happen here instead of on the first production iterations. Called from the
+    //!          constructor on every rank, keeping multi-rank collectives matched.
+    void runEngineWarmup();
+
     //! @brief Store full kv cache blocks contributed by req.
     //! These blocks become reusable from next step.
     void storeContextBlocks(std::shared_ptr<LlmRequest> const& req);
@@ -269,14 +285,28 @@ private:
     //! The block become reusable from next step.
     void storeNewBlock(std::shared_ptr<LlmRequest> const& req);
 
+    //! @brief Terminate registered requests that are not in flight before scheduling the next batch.
+    //! @details Requests registered via terminateRequestSync are normally terminated in the
+    //!          forwardSync call that includes them in the batch. Requests that are between context
+    //!          chunks (or waiting in the queue) have no GPU work in flight, so they can be
+    //!          terminated here instead, releasing their kv cache blocks and sequence slot to the
+    //!          capacity scheduler of this iteration instead of after the prefill completes.
+    void terminateCancelledRequestsEarly(RequestList const& activeRequests);
+
+    //! @brief Defer context requests whose prompt is identical to that of an earlier active request
+    //! still in its context phase. Fan-out duplicates (e.g. best-of-N over one prompt) then prefill
+    //! once and pick up the stored blocks through the kv cache reuse path instead of recomputing
+    //! the shared prompt. Requires block reuse to be enabled.
+    void deferDuplicatePromptRequests(RequestList const& activeRequests, RequestVector& fittingRequests) const;
+
     //! @brief Set LayerProfiler to collect performance per layer.
     void setLayerProfiler() override;
 
     //! @brief Print profile information per layer.
     std::string getLayerProfileInfo() const override;
 
-    std::tuple<SizeType32, TensorMap const&, TensorMap&> prepareBuffers(
-        RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId);
+    std::tuple<SizeType32, TensorMap const&, TensorMap&> prepareBuffers(RequestVector const& contextRequests,
+        RequestVector const& generationRequests, SizeType32 bufferId, SizeType32 stepsSinceHostSync = 0);
 
     //! @brief Capture graph of current batch state during engine execution.
     //! This is based on the assumptions that
@@ -286,8 +316,8 @@ private:
 
     void executeContext(SizeType32 runtimeContextId, SizeType32 bufferId);
     void executeBatch(ScheduledRequests const& scheduledRequests);
-    void executeStep(
-        RequestVector const& contextRequests, RequestVector const& generationRequests, SizeType32 bufferId);
+    void executeStep(RequestVector const& contextRequests, RequestVector const& generationRequests,
+        SizeType32 bufferId, SizeType32 stepsSinceHostSync = 0);
 
     void debugIOTensors(RequestVector const& contextRequests, RequestVector const& generationRequests,
         TensorMap const& inputMap, TensorMap const& outputMap);
@@ -332,11 +362,30 @@ private:
     void setupDecoderStep(
         RequestVector const& contextRequests, RuntimeBuffers const& buffers, DecoderInputBuffers& inputBuffers);
     runtime::CudaEvent decoderStepAsync(ScheduledRequests const& scheduledRequests);
-    std::vector<std::unique_ptr<DecoderStepAsyncSend>> decoderSync(
-        ScheduledRequests const& scheduledRequests, std::optional<runtime::CudaEvent> const& decoderFinishEvent);
 
-    std::vector<std::unique_ptr<DecoderStepAsyncSend>> communicateDecoderBuffers(bool returnLogProbs);
-    void updateRequests(ScheduledRequests const& scheduledRequests);
+    /// @brief Check whether the current batch may run additional decode steps without host reconciliation.
+    ///        Requires a generation-only batch whose per-step host processing is pure bookkeeping: sampling,
+    ///        stop checks, and token append then live entirely in decoder device state between reconciles.
+    bool canRunMultiStepDecode(ScheduledRequests const& scheduledRequests) const;
+
+    /// @brief Run up to maxSteps - 1 additional engine + decoder steps for the current batch. Engine input
+    ///        ids are gathered from the previous decoder step on device, so the host only enqueues work.
+    ///        Replaces the micro batch's decoder finished event with the one of the last step.
+    /// @return The number of decoder steps taken since the last host sync (including the first one).
+    SizeType32 runMultiStepDecode(ScheduledRequests const& scheduledRequests, SizeType32 maxSteps);
+
+    std::vector<std::unique_ptr<DecoderStepAsyncSend>> decoderSync(ScheduledRequests const& scheduledRequests,
+        std::optional<runtime::CudaEvent> const& decoderFinishEvent, SizeType32 microBatchId);
+
+    /// @brief Drain the previous micro batch's decoder: wait for its finished event, broadcast the
+    ///        new tokens to the other pipeline-parallel ranks and update its requests. Used by the
+    ///        last rank in 1F1B overlap mode, where this runs after the current micro batch's engine
+    ///        forward has been enqueued so sampling of micro batch m overlaps the engine run of m+1.
+    void finishPreviousMicroBatchDecoder();
+
+    std::vector<std::unique_ptr<DecoderStepAsyncSend>> communicateDecoderBuffers(
+        bool returnLogProbs, SizeType32 microBatchId);
+    void updateRequests(ScheduledRequests const& scheduledRequests, SizeType32 microBatchId);
 
     /// @brief It gathers the logits if they need to be returned, calls getDecoderSlotHostOutputs,
     /// and overwrites the llmRequest tokens buffer.
@@ -346,6 +395,10 @@ private:
     void getDecoderSlotHostOutputs(
         SizeType32 seqSlot, bool returnLogProbs, runtime::SamplingConfig const& samplingConfig, bool streaming);
     void rewindKVCacheBlocks(SizeType32 numSequences);
+    /// @brief Rebalance device memory between the runtime buffer pool, the schedulable KV cache
+    /// capacity, and consumers outside the model. Runs every TRTLLM_MEMORY_ARBITER_INTERVAL
+    /// iterations; a no-op when the arbiter is disabled.
+    void arbitrateDeviceMemory();
     void setupSpeculativeDecodingModule(executor::DecodingConfig const& decodingConfig);
 
     /// @brief Copies the content of the cache indirection outputs to the cache indirection inputs.
@@ -391,6 +444,11 @@ private:
         return static_cast<bool>(mGuidedDecoder);
     }
 
+    [[nodiscard]] bool hasKvCacheTransceiver() const noexcept override
+    {
+        return static_cast<bool>(mCacheTransceiver);
+    }
+
     using BlocksPerWindow = std::map<SizeType32, std::tuple<SizeType32, SizeType32>>;
     /// @brief Based on the KV-cache manager's capacity and configuration, we adjust the maximum supported attention
     /// window.
@@ -489,6 +547,11 @@ private:
     std::unique_ptr<runtime::decoder::DecoderState> mDecoderState;
     // Synchronization handles for decoder
     std::vector<std::optional<runtime::CudaEvent>> mDecoderFinishedEvents;
+    // Decoder steps enqueued per micro batch since the host last reconciled requests (1 normally,
+    // up to TRTLLM_MULTI_STEP_DECODE_STEPS in multi-step decode).
+    std::vector<SizeType32> mDecoderStepsSinceSync;
+    // Host staging for the decoder output ids when reconciling a multi-step burst.
+    TensorPtr mMultiStepIdsHost;
 
     // Manager that maps requests to slots
     std::shared_ptr<SequenceSlotManager> mSeqSlotManager;
@@ -536,6 +599,9 @@ private:
     // Number of micro batches. Multiple batches are used for overlapping setup and execution,
     // and in pipeline parallelism.
     SizeType32 mNumMicroBatches;
+    // Whether the last pipeline-parallel rank drains a micro batch's decoder one iteration late,
+    // after the next micro batch's engine forward has been enqueued (1F1B-style interleaving).
+    bool mPPDecoderOverlap{false};
     // Number of buffers to be added to mBuffers.
     SizeType32 mNumBuffers;
     // Current operating beam width. Can be changed with changeBeamWidth function.
@@ -584,10 +650,26 @@ private:
     IterationStatsIFB mLastIterationStatsIFB{-1};
     // Iteration counter used to distinguish debug output
     executor::IterationType mIterCounter{0};
+    // Blocks currently taken out of KV cache circulation by the device memory arbiter.
+    SizeType32 mArbiterDrainedBlocks{0};
+    // Always-on stage profiler. Only allocated when TRTLLM_ITERATION_PROFILER_SIZE is set.
+    std::unique_ptr<runtime::IterationProfiler> mIterationProfiler;
+    // Batch composition record/replay journal. Only allocated when TRTLLM_ITER_JOURNAL_RECORD or
+    // TRTLLM_ITER_JOURNAL_REPLAY is set.
+    std::unique_ptr<IterationJournal> mIterationJournal;
     // Debug tensors of last itreation
     TensorMap mLastIterationDebugTensors;
     // Cuda graph instances for each microbatch.
     std::vector<utils::CudaGraphExecutorCache> mCudaGraphExecutorCaches;
+    // Per-micro-batch streams for engine execution. Empty unless TRTLLM_ENABLE_MICRO_BATCH_STREAMS is set.
+    // The engine is ordered behind its input preparation and the decoder handoff is ordered behind the engine
+    // with events, so micro batches only synchronize at the decoder handoff.
+    std::vector<runtime::BufferManager::CudaStreamPtr> mMicroBatchStreams;
+    // Priority-split engine streams, nullptr unless TRTLLM_ENABLE_SPLIT_PRIORITY_STREAMS is set and
+    // context-gen fusion is off. Generation steps run at the highest device stream priority and
+    // context steps at the lowest, so decode kernels preempt overlapping prefill chunks on the SMs.
+    runtime::BufferManager::CudaStreamPtr mContextEngineStream;
+    runtime::BufferManager::CudaStreamPtr mGenerationEngineStream;
 
     /******************** Cache transceiver ********************/
     std::unique_ptr<BaseCacheTransceiver> mCacheTransceiver;
@@ -261,6 +261,19 @@ void terminateRequest(SequenceSlotManager& seqSlotManager, LlmRequest& llmReq, S
     seqSlotManager.freeSequenceSlot(llmReq.mRequestId);
     // Remove the sequence from kvCacheManager
     auto const requestId = llmReq.mRequestId;
+    // When pausing under pressure, demote the tail blocks of the sequence before they are released
+    // so eviction and offload take the tail first and the prefix stays resident for reuse on resume.
+    if (pause && !llmReq.isGenerationCompleteState())
+    {
+        if (kvCacheManager)
+        {
+            kvCacheManager->preparePausedSequenceRetention(requestId);
+        }
+        if (crossKvCacheManager)
+        {
+            crossKvCacheManager->preparePausedSequenceRetention(requestId);
+        }
+    }
     if (kvCacheManager)
     {
         (void) kvCacheManager->removeSequence(requestId, llmReq);
@@ -370,7 +383,15 @@ void CudaGraphExecutor::prepareNextGraph(std::unique_ptr<runtime::TllmRuntime>&
 std::optional<std::shared_ptr<CudaGraphExecutor>> CudaGraphExecutorCache::get(BatchState const& state)
 {
     auto it = mMap.find(state);
-    if (it == mMap.end())
+    bool const found = it != mMap.end();
+    found ? ++mNumHits : ++mNumMisses;
+    if ((mNumHits + mNumMisses) % kStatsLogInterval == 0)
+    {
+        TLLM_LOG_DEBUG("CUDA graph cache: %zu hits, %zu misses (hit rate %.1f%%), %zu evictions, %zu/%d cached graphs",
+            mNumHits, mNumMisses, 100.0 * static_cast<double>(mNumHits) / static_cast<double>(mNumHits + mNumMisses),
+            mNumEvictions, mMap.size(), mCapacity);
+    }
+    if (!found)
     {
         return std::nullopt;
     }
@@ -393,6 +414,7 @@ void CudaGraphExecutorCache::put(BatchState const& state, std::shared_ptr<CudaGr
         auto lastState = mCache.back().first;
         mCache.pop_back();
         mMap.erase(lastState);
+        ++mNumEvictions;
     }
 }
 
@@ -122,5 +122,13 @@ private:
     SizeType32 mCapacity;
     GraphExecutorLruCache mCache;
     std::unordered_map<BatchState, GraphExecutorLruCache::iterator, BatchStateHash> mMap;
+
+    //! Lookup statistics, logged every kStatsLogInterval lookups. A low hit rate means the decode
+    //! traffic spreads over more batch states than the cache holds and the capacity (or the kv cache
+    //! length rounding in RuntimeBuffers) should be revisited.
+    static std::size_t constexpr kStatsLogInterval{1000};
+    std::size_t mNumHits{0};
+    std::size_t mNumMisses{0};
+    std::size_t mNumEvictions{0};
 };
 } // namespace tensorrt_llm::batch_manager::utils
@@ -0,0 +1,467 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/asyncFileReader.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TLLM_HAS_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+namespace tensorrt_llm::common
+{
+
+namespace
+{
+
+//! Read the full range with plain positional reads, looping over short reads.
+bool preadFully(int fd, char* dest, std::size_t size, std::int64_t offset)
+{
+    std::size_t done = 0;
+    while (done < size)
+    {
+#ifdef _WIN32
+        // The CRT has no pread; serialize the seek+read pairs instead. This path only backs
+        // POSIX-free builds, where none of the parallel consumers exist anyway.
+        static std::mutex seekMutex;
+        std::lock_guard<std::mutex> lock(seekMutex);
+        if (_lseeki64(fd, offset + static_cast<std::int64_t>(done), SEEK_SET) < 0)
+        {
+            return false;
+        }
+        auto const numRead = _read(fd, dest + done, static_cast<unsigned>(std::min<std::size_t>(size - done, 1u << 30)));
+#else
+        auto const numRead = ::pread(fd, dest + done, size - done, offset + static_cast<std::int64_t>(done));
+        if (numRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+#endif
+        if (numRead <= 0)
+        {
+            return false;
+        }
+        done += static_cast<std::size_t>(numRead);
+    }
+    return true;
+}
+
+} // namespace
+
+class AsyncFileReader::Impl
+{
+public:
+    Impl()
+    {
+#if defined(TLLM_HAS_IO_URING)
+        if (setupRing())
+        {
+            mUseRing = true;
+            mCompletionThread = std::thread([this] { completionLoop(); });
+            TLLM_LOG_DEBUG("AsyncFileReader: using io_uring backend with %u entries", mSqEntries);
+            return;
+        }
+#endif
+        auto const numWorkers = 4u;
+        for (auto i = 0u; i < numWorkers; ++i)
+        {
+            mWorkers.emplace_back([this] { workerLoop(); });
+        }
+        TLLM_LOG_DEBUG("AsyncFileReader: io_uring unavailable, using a %u-thread pread pool", numWorkers);
+    }
+
+    ~Impl()
+    {
+#if defined(TLLM_HAS_IO_URING)
+        if (mUseRing)
+        {
+            mStop.store(true, std::memory_order_release);
+            submitNop();
+            mCompletionThread.join();
+            teardownRing();
+            return;
+        }
+#endif
+        {
+            std::lock_guard<std::mutex> lock(mQueueMutex);
+            mShutdown = true;
+        }
+        mQueueCv.notify_all();
+        for (auto& worker : mWorkers)
+        {
+            worker.join();
+        }
+    }
+
+    std::future<bool> submit(int fd, void* dest, std::size_t size, std::int64_t offset)
+    {
+        Pending pending;
+        pending.fd = fd;
+        pending.dest = static_cast<char*>(dest);
+        pending.size = size;
+        pending.offset = offset;
+        auto future = pending.promise.get_future();
+        if (size == 0)
+        {
+            pending.promise.set_value(true);
+            return future;
+        }
+#if defined(TLLM_HAS_IO_URING)
+        if (mUseRing)
+        {
+            auto const id = mNextId.fetch_add(1, std::memory_order_relaxed);
+            Pending* tracked;
+            {
+                std::lock_guard<std::mutex> lock(mPendingMutex);
+                tracked = &mPending.emplace(id, std::move(pending)).first->second;
+            }
+            if (!submitToRing(id, *tracked))
+            {
+                // Submission queue full; finish the read inline rather than blocking the ring.
+                // Rare at the configured queue depth.
+                decltype(mPending)::node_type node;
+                {
+                    std::lock_guard<std::mutex> lock(mPendingMutex);
+                    node = mPending.extract(id);
+                }
+                node.mapped().promise.set_value(preadFully(fd, node.mapped().dest, size, offset));
+            }
+            return future;
+        }
+#endif
+        {
+            std::lock_guard<std::mutex> lock(mQueueMutex);
+            mQueue.push_back(std::move(pending));
+        }
+        mQueueCv.notify_one();
+        return future;
+    }
+
+private:
+    struct Pending
+    {
+        std::promise<bool> promise;
+        int fd{-1};
+        char* dest{nullptr};
+        std::size_t size{0};
+        std::int64_t offset{0};
+        std::size_t done{0};
+#if defined(TLLM_HAS_IO_URING)
+        // Submission uses IORING_OP_READV (kernel 5.1) rather than IORING_OP_READ (5.6); the iovec
+        // must stay addressable until completion, which the node-based pending map guarantees.
+        struct iovec iov
+        {
+        };
+#endif
+    };
+
+    void workerLoop()
+    {
+        while (true)
+        {
+            Pending pending;
+            {
+                std::unique_lock<std::mutex> lock(mQueueMutex);
+                mQueueCv.wait(lock, [this] { return mShutdown || !mQueue.empty(); });
+                if (mQueue.empty())
+                {
+                    return;
+                }
+                pending = std::move(mQueue.front());
+                mQueue.pop_front();
+            }
+            pending.promise.set_value(preadFully(pending.fd, pending.dest, pending.size, pending.offset));
+        }
+    }
+
+#if defined(TLLM_HAS_IO_URING)
+    bool setupRing()
+    {
+        struct io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        auto const ringFd
+            = static_cast<int>(syscall(__NR_io_uring_setup, kRingEntries, &params));
+        if (ringFd < 0)
+        {
+            // ENOSYS on old kernels, EPERM in locked-down containers.
+            return false;
+        }
+        if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0)
+        {
+            // Pre-5.4 layout with separate SQ/CQ mappings; not worth supporting, those kernels get
+            // the pread pool.
+            ::close(ringFd);
+            return false;
+        }
+        mSqEntries = params.sq_entries;
+        mRingSize = std::max(params.sq_off.array + params.sq_entries * sizeof(std::uint32_t),
+            params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+        mRing = mmap(nullptr, mRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        if (mRing == MAP_FAILED)
+        {
+            ::close(ringFd);
+            mRing = nullptr;
+            return false;
+        }
+        mSqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+        mSqes = static_cast<struct io_uring_sqe*>(
+            mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES));
+        if (mSqes == MAP_FAILED)
+        {
+            munmap(mRing, mRingSize);
+            mRing = nullptr;
+            mSqes = nullptr;
+            ::close(ringFd);
+            return false;
+        }
+        auto* const ring = static_cast<char*>(mRing);
+        mSqHead = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.head);
+        mSqTail = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.tail);
+        mSqMask = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.ring_mask);
+        mSqArray = reinterpret_cast<std::uint32_t*>(ring + params.sq_off.array);
+        mCqHead = reinterpret_cast<std::uint32_t*>(ring + params.cq_off.head);
+        mCqTail = reinterpret_cast<std::uint32_t*>(ring + params.cq_off.tail);
+        mCqMask = reinterpret_cast<std::uint32_t*>(ring + params.cq_off.ring_mask);
+        mCqes = reinterpret_cast<struct io_uring_cqe*>(ring + params.cq_off.cqes);
+        mRingFd = ringFd;
+        return true;
+    }
+
+    void teardownRing()
+    {
+        if (mSqes != nullptr)
+        {
+            munmap(mSqes, mSqesSize);
+        }
+        if (mRing != nullptr)
+        {
+            munmap(mRing, mRingSize);
+        }
+        if (mRingFd >= 0)
+        {
+            ::close(mRingFd);
+        }
+    }
+
+    //! Place one SQE; returns false only when the submission queue is full.
+    bool submitToRing(std::uint64_t id, Pending& pending)
+    {
+        std::lock_guard<std::mutex> lock(mSubmitMutex);
+        auto const head = __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE);
+        auto const tail = *mSqTail;
+        if (tail - head >= mSqEntries)
+        {
+            return false;
+        }
+        auto const idx = tail & *mSqMask;
+        auto& sqe = mSqes[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        pending.iov.iov_base = pending.dest + pending.done;
+        pending.iov.iov_len = pending.size - pending.done;
+        sqe.opcode = IORING_OP_READV;
+        sqe.fd = pending.fd;
+        sqe.addr = reinterpret_cast<std::uint64_t>(&pending.iov);
+        sqe.len = 1;
+        sqe.off = static_cast<std::uint64_t>(pending.offset + static_cast<std::int64_t>(pending.done));
+        sqe.user_data = id;
+        mSqArray[idx] = idx;
+        __atomic_store_n(mSqTail, tail + 1, __ATOMIC_RELEASE);
+        // The SQE is owned by the kernel once the tail moved, so a failed enter must not fall back
+        // to an inline read; a later enter flushes the entry instead.
+        if (syscall(__NR_io_uring_enter, mRingFd, 1, 0, 0, nullptr, 0) < 0)
+        {
+            TLLM_LOG_WARNING("AsyncFileReader: io_uring_enter(submit) failed: %s", std::strerror(errno));
+        }
+        return true;
+    }
+
+    //! Wake the completion thread during shutdown.
+    void submitNop()
+    {
+        std::lock_guard<std::mutex> lock(mSubmitMutex);
+        auto const tail = *mSqTail;
+        if (tail - __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE) >= mSqEntries)
+        {
+            // Queue full means reads are in flight; their completions wake the thread instead.
+            return;
+        }
+        auto const idx = tail & *mSqMask;
+        auto& sqe = mSqes[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        sqe.opcode = IORING_OP_NOP;
+        sqe.user_data = kNopUserData;
+        mSqArray[idx] = idx;
+        __atomic_store_n(mSqTail, tail + 1, __ATOMIC_RELEASE);
+        syscall(__NR_io_uring_enter, mRingFd, 1, 0, 0, nullptr, 0);
+    }
+
+    void completionLoop()
+    {
+        while (true)
+        {
+            auto const ret = syscall(__NR_io_uring_enter, mRingFd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (ret < 0 && errno != EINTR)
+            {
+                TLLM_LOG_WARNING("AsyncFileReader: io_uring_enter failed: %s", std::strerror(errno));
+            }
+            auto head = *mCqHead;
+            auto const tail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+            while (head != tail)
+            {
+                auto const& cqe = mCqes[head & *mCqMask];
+                handleCompletion(cqe.user_data, cqe.res);
+                ++head;
+            }
+            __atomic_store_n(mCqHead, head, __ATOMIC_RELEASE);
+            if (mStop.load(std::memory_order_acquire))
+            {
+                return;
+            }
+        }
+    }
+
+    void handleCompletion(std::uint64_t id, std::int32_t res)
+    {
+        if (id == kNopUserData)
+        {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mPendingMutex);
+        auto const it = mPending.find(id);
+        if (it == mPending.end())
+        {
+            return; // finished inline after a full-queue submit
+        }
+        auto node = mPending.extract(it);
+        lock.unlock();
+        auto& pending = node.mapped();
+        if (res <= 0)
+        {
+            pending.promise.set_value(false);
+            return;
+        }
+        pending.done += static_cast<std::size_t>(res);
+        if (pending.done < pending.size)
+        {
+            // Short read (e.g. readahead window); finishing it here is simpler than resubmitting
+            // and keeps the common full-completion path allocation free.
+            pending.promise.set_value(preadFully(
+                pending.fd, pending.dest + pending.done, pending.size - pending.done,
+                pending.offset + static_cast<std::int64_t>(pending.done)));
+            return;
+        }
+        pending.promise.set_value(true);
+    }
+
+    static constexpr unsigned kRingEntries = 64;
+    static constexpr std::uint64_t kNopUserData = 0;
+
+    int mRingFd{-1};
+    unsigned mSqEntries{0};
+    void* mRing{nullptr};
+    std::size_t mRingSize{0};
+    struct io_uring_sqe* mSqes{nullptr};
+    std::size_t mSqesSize{0};
+    std::uint32_t* mSqHead{nullptr};
+    std::uint32_t* mSqTail{nullptr};
+    std::uint32_t* mSqMask{nullptr};
+    std::uint32_t* mSqArray{nullptr};
+    std::uint32_t* mCqHead{nullptr};
+    std::uint32_t* mCqTail{nullptr};
+    std::uint32_t* mCqMask{nullptr};
+    struct io_uring_cqe* mCqes{nullptr};
+    std::mutex mSubmitMutex;
+    std::thread mCompletionThread;
+    std::atomic<bool> mStop{false};
+    std::mutex mPendingMutex;
+    std::unordered_map<std::uint64_t, Pending> mPending;
+    std::atomic<std::uint64_t> mNextId{1};
+#endif // TLLM_HAS_IO_URING
+
+    bool mUseRing{false};
+    std::vector<std::thread> mWorkers;
+    std::deque<Pending> mQueue;
+    std::mutex mQueueMutex;
+    std::condition_variable mQueueCv;
+    bool mShutdown{false};
+};
+
+AsyncFileReader::AsyncFileReader()
+    : mImpl(std::make_unique<Impl>())
+{
+}
+
+AsyncFileReader::~AsyncFileReader() = default;
+
+AsyncFileReader& AsyncFileReader::instance()
+{
+    static AsyncFileReader reader;
+    return reader;
+}
+
+std::future<bool> AsyncFileReader::readAsync(int fd, void* dest, std::size_t size, std::int64_t offset)
+{
+    return mImpl->submit(fd, dest, size, offset);
+}
+
+bool AsyncFileReader::readRange(int fd, void* dest, std::size_t size, std::int64_t offset)
+{
+    // Chunks sized to keep a handful of requests in flight for multi-megabyte ranges without
+    // flooding the queue for small ones.
+    constexpr std::size_t kChunkSize = 8ull << 20;
+    if (size <= kChunkSize)
+    {
+        return readAsync(fd, dest, size, offset).get();
+    }
+    std::vector<std::future<bool>> futures;
+    futures.reserve((size + kChunkSize - 1) / kChunkSize);
+    for (std::size_t chunkBegin = 0; chunkBegin < size; chunkBegin += kChunkSize)
+    {
+        auto const chunkSize = std::min(kChunkSize, size - chunkBegin);
+        futures.emplace_back(readAsync(fd, static_cast<char*>(dest) + chunkBegin, chunkSize,
+            offset + static_cast<std::int64_t>(chunkBegin)));
+    }
+    bool success = true;
+    for (auto& future : futures)
+    {
+        success = future.get() && success;
+    }
+    return success;
+}
+
+} // namespace tensorrt_llm::common
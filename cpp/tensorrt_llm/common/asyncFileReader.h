@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+
+namespace tensorrt_llm::common
+{
+
+//! Process-wide positional-read service shared by the runtime's file consumers (engine loads,
+//! safetensors fallback reads). Reads are submitted by (fd, offset), so several reads of one file
+//! can be in flight at once and an NVMe device sees real queue depth instead of one blocking read
+//! at a time. On Linux the backend is io_uring driven by a completion thread (raw syscalls, no
+//! liburing dependency); where io_uring is unavailable a small pread worker pool provides the same
+//! semantics.
+class AsyncFileReader
+{
+public:
+    //! @brief The shared reader. Backend threads start on first use.
+    static AsyncFileReader& instance();
+
+    AsyncFileReader(AsyncFileReader const&) = delete;
+    AsyncFileReader& operator=(AsyncFileReader const&) = delete;
+    ~AsyncFileReader();
+
+    //! @brief Read size bytes at offset of fd into dest. Thread safe.
+    //! @return A future resolving to true when the full range was read, false on error or EOF.
+    std::future<bool> readAsync(int fd, void* dest, std::size_t size, std::int64_t offset);
+
+    //! @brief Read the range with queue-depth parallelism, splitting it into chunks and blocking
+    //! until all of them completed.
+    //! @return True when the full range was read.
+    bool readRange(int fd, void* dest, std::size_t size, std::int64_t offset);
+
+private:
+    AsyncFileReader();
+
+    class Impl;
+    std::unique_ptr<Impl> mImpl;
+};
+
+} // namespace tensorrt_llm::common
@@ -19,6 +19,7 @@
 #include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
+#include "tensorrt_llm/kernels/attentionSelectionTuner.h"
 #include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention.h"
 #include "tensorrt_llm/kernels/flashMLA/flash_mla.h"
 #include "tensorrt_llm/kernels/gptKernels.h"
@@ -1212,7 +1213,7 @@ int AttentionOp::mlaGeneration(
         {
             if (mFP8GenerationMLA)
             {
-                TLLM_THROW("FP8 KV cache MLA is only supported for bf16 output");
+                run_mha_fwd_splitkv_mla<cutlass::float_e4m3_t, cutlass::half_t, 576>(flashMlaParams, stream);
             }
             else
             {
@@ -1627,6 +1628,14 @@ int AttentionOp::enqueueContext(EnqueueContextParams<T> const& params, cudaStrea
         TLLM_CHECK_WITH_INFO(!(params.sink_token_length > 0 && enablePagedKVContextFMHA),
             "Cannot support StreamingLLM now when enabling paged KV context FMHA.");
 
+        // When no request in the batch has cached history, the total kv length equals the number of
+        // input tokens. The paged kv path would then write the fresh K/V to the cache only to read
+        // them straight back, so attend to the packed QKV buffer instead: preprocessing keeps the
+        // RoPE'd K/V in place (while still updating the cache) and the PACKED_QKV kernel skips the
+        // cache read entirely.
+        bool const usePackedQkvFmha
+            = mPackedQkvFmhaDispatcher && !isCrossAttention() && params.total_kv_len == params.num_tokens;
+
         // The max_kv_seq_len comes from the encoder seqlen when cross attention is used.
         int const max_kv_seq_len = isCrossAttention() ? params.cross_kv_length : params.max_past_kv_length;
 
@@ -1682,7 +1691,7 @@ int AttentionOp::enqueueContext(EnqueueContextParams<T> const& params, cudaStrea
         preprocessingParams.position_embedding_type = position_embedding_type;
         preprocessingParams.position_shift_enabled = mPosShiftEnabled;
         preprocessingParams.cache_type = cache_type;
-        preprocessingParams.separate_q_kv_output = enablePagedKVContextFMHA || isCrossAttention();
+        preprocessingParams.separate_q_kv_output = (enablePagedKVContextFMHA && !usePackedQkvFmha) || isCrossAttention();
         preprocessingParams.quantized_fp8_output = mFP8ContextFMHA;
         preprocessingParams.generation_phase = false;
         preprocessingParams.multi_processor_count = mMultiProcessorCount;
@@ -1847,7 +1856,8 @@ int AttentionOp::enqueueContext(EnqueueContextParams<T> const& params, cudaStrea
         }
 
         // Run the fmha kernel.
-        mFmhaDispatcher->run(fmhaParams);
+        auto* fmhaDispatcher = usePackedQkvFmha ? mPackedQkvFmhaDispatcher.get() : mFmhaDispatcher.get();
+        fmhaDispatcher->run(fmhaParams);
         sync_check_cuda_error(stream);
 
         if (mCpSize > 1 && mAttnTpSize > 1 && mAttnCpSize == 1)
@@ -2265,6 +2275,10 @@ int AttentionOp::enqueueGeneration(EnqueueGenerationParams<T> const& params, cud
     }
 
     // Try XQA optimization first.
+    auto& selectionTuner = AttentionSelectionTuner::getInstance();
+    AttentionSelectionTuner::BucketKey selectionBucket{};
+    AttentionSelectionTuner::Measurement* mmhaMeasurement = nullptr;
+    bool tuneAgainstMmha = false;
     {
         // NOTE: input_seq_length = num_medusa_tokens + 1 (new generated one from the original LM head)
         // self attn
@@ -2272,21 +2286,39 @@ int AttentionOp::enqueueGeneration(EnqueueGenerationParams<T> const& params, cud
         this->template convertMMHAParamsToXQAParams<T, KVCacheBuffer>(xqaParams, params, /*forConfigurePlugin=*/false);
         if (mEnableXQA && mXqaDispatcher->shouldUse(xqaParams))
         {
-            TLLM_LOG_DEBUG("XQA kernels are selected in the generation phase.");
-            xqaParams.stream = stream;
-            if (mCpSize > 1)
+            // The tuner may prefer MMHA for this shape bucket, but only when MMHA is a legal fallback
+            tuneAgainstMmha = selectionTuner.isEnabled() && !(mIsSpecDecodingEnabled && mUseSpecDecoding)
+                && !mFuseFp4Quant && !mKVCacheQuantMode.hasFp4KvCache();
+            if (tuneAgainstMmha)
             {
-                xqaParams.output = mhaOutput;
-                xqaParams.qkv = attention_input;
+                selectionBucket = AttentionSelectionTuner::makeBucket(xqaParams);
             }
-            mXqaDispatcher->run(xqaParams, kv_cache_buffer, kv_scale_cache_buffer);
-            if (mCpSize > 1 && mAttnTpSize > 1 && mAttnCpSize == 1)
+            if (!tuneAgainstMmha
+                || selectionTuner.choose(selectionBucket) == AttentionSelectionTuner::Choice::kXQA)
             {
-                this->template ulyssesGenerationPostprocess<T>(
-                    mhaOutput, reinterpret_cast<T*>(params.context_buf), mhaInput, batch_beam, stream);
-                sync_check_cuda_error(stream);
+                TLLM_LOG_DEBUG("XQA kernels are selected in the generation phase.");
+                xqaParams.stream = stream;
+                if (mCpSize > 1)
+                {
+                    xqaParams.output = mhaOutput;
+                    xqaParams.qkv = attention_input;
+                }
+                auto* xqaMeasurement = tuneAgainstMmha
+                    ? selectionTuner.beginMeasure(selectionBucket, AttentionSelectionTuner::Choice::kXQA, stream)
+                    : nullptr;
+                mXqaDispatcher->run(xqaParams, kv_cache_buffer, kv_scale_cache_buffer);
+                selectionTuner.endMeasure(xqaMeasurement, stream);
+                if (mCpSize > 1 && mAttnTpSize > 1 && mAttnCpSize == 1)
+                {
+                    this->template ulyssesGenerationPostprocess<T>(
+                        mhaOutput, reinterpret_cast<T*>(params.context_buf), mhaInput, batch_beam, stream);
+                    sync_check_cuda_error(stream);
+                }
+                return 0;
             }
-            return 0;
+            TLLM_LOG_DEBUG("MMHA is selected over XQA in the generation phase by the autotuner.");
+            mmhaMeasurement
+                = selectionTuner.beginMeasure(selectionBucket, AttentionSelectionTuner::Choice::kMMHA, stream);
         }
         else if (mIsSpecDecodingEnabled && mUseSpecDecoding)
         {
@@ -2445,6 +2477,7 @@ int AttentionOp::enqueueGeneration(EnqueueGenerationParams<T> const& params, cud
         Cross_multihead_attention_params<DataType> mmhca_params;
         fusedQKV_masked_attention_dispatch(mmhca_params, dispatch_params, stream);
     }
+    selectionTuner.endMeasure(mmhaMeasurement, stream);
     sync_check_cuda_error(stream);
 
     if (mCpSize > 1 && mAttnTpSize > 1 && mAttnCpSize == 1)
@@ -2727,6 +2760,24 @@ int AttentionOp::initialize() noexcept
         // Load kernels from the pre-compiled cubins.
         mFmhaDispatcher.reset(new FmhaDispatcher(fmhaParams));
 
+        // With paged context FMHA, K/V of the current chunk are written to the paged kv cache by the
+        // preprocessing kernel and then read back by the Q_PAGED_KV kernel. For batches without any
+        // cached history (single-shot context, or a first chunk without reused blocks) the RoPE'd K/V
+        // are still present in the packed QKV buffer, so the PACKED_QKV kernel can attend to them
+        // directly and skip the cache read. Keep a packed dispatcher around for that case;
+        // enqueueContext selects it when the total kv length equals the number of input tokens.
+        if (fmhaParams.attentionInputLayout == AttentionInputLayout::Q_PAGED_KV && !isCrossAttention()
+            && !mIsMLAEnabled && !mFP8ContextFMHA && fmhaParams.dataTypeKv == fmhaParams.dataType)
+        {
+            auto packedFmhaParams = fmhaParams;
+            packedFmhaParams.attentionInputLayout = AttentionInputLayout::PACKED_QKV;
+            mPackedQkvFmhaDispatcher.reset(new FmhaDispatcher(packedFmhaParams));
+            if (!mPackedQkvFmhaDispatcher->isSupported())
+            {
+                mPackedQkvFmhaDispatcher.reset();
+            }
+        }
+
         // Deepseek-V2 Generation needs a differ fmha with different argumments
         if (mIsMLAEnabled)
         {
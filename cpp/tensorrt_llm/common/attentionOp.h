@@ -513,6 +513,9 @@ private:
     std::shared_ptr<CUDADriverWrapper> mDriver;
     UniqPtrWNullCopy<tensorrt_llm::kernels::FusedMHARunnerV2> mDecoderFMHARunner;
     UniqPtrWNullCopy<tensorrt_llm::kernels::FmhaDispatcher> mFmhaDispatcher;
+    // Packed-QKV variant of mFmhaDispatcher, used for context batches without cached history so the
+    // current chunk's K/V do not round-trip through the paged kv cache. See initialization for details.
+    UniqPtrWNullCopy<tensorrt_llm::kernels::FmhaDispatcher> mPackedQkvFmhaDispatcher;
     UniqPtrWNullCopy<tensorrt_llm::kernels::XqaDispatcher> mXqaDispatcher;
     UniqPtrWNullCopy<tensorrt_llm::kernels::TllmGenFmhaRunner> mTllmGenFMHARunner;
 
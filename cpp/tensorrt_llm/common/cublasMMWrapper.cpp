@@ -18,6 +18,9 @@
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cublasVersionCheck.h"
 #include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 #ifndef CUDART_VERSION
 #error CUDART_VERSION Undefined!
@@ -28,6 +31,71 @@ namespace tensorrt_llm
 namespace common
 {
 
+namespace
+{
+
+struct WorkspacePoolState
+{
+    std::mutex mutex;
+    //! Live lease per (device, stream); expired entries are refreshed on the next lease.
+    std::map<std::pair<int, cudaStream_t>, std::weak_ptr<void>> active;
+    //! Blocks with no lease, per device. Never freed: the pool lives for the whole process and
+    //! releasing on teardown would race with CUDA context destruction.
+    std::map<int, std::vector<void*>> freeBlocks;
+};
+
+WorkspacePoolState& workspacePoolState()
+{
+    static WorkspacePoolState state;
+    return state;
+}
+
+} // namespace
+
+std::shared_ptr<void> CublasWorkspacePool::lease(cudaStream_t stream)
+{
+    int device = 0;
+    check_cuda_error(cudaGetDevice(&device));
+
+    auto& state = workspacePoolState();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto const key = std::make_pair(device, stream);
+    if (auto existing = state.active[key].lock())
+    {
+        return existing;
+    }
+
+    void* block = nullptr;
+    auto& freeBlocks = state.freeBlocks[device];
+    if (!freeBlocks.empty())
+    {
+        block = freeBlocks.back();
+        freeBlocks.pop_back();
+    }
+    else
+    {
+        check_cuda_error(cudaMalloc(&block, CUBLAS_WORKSPACE_SIZE));
+    }
+
+    std::shared_ptr<void> leased(block,
+        [device, stream](void* ptr)
+        {
+            // Drain the stream before recycling so a GEMM still in flight cannot share the block
+            // with a new owner on another stream. If the context is already gone the block leaks,
+            // which is fine during process teardown.
+            if (cudaStreamSynchronize(stream) != cudaSuccess)
+            {
+                return;
+            }
+            auto& poolState = workspacePoolState();
+            std::lock_guard<std::mutex> poolLock(poolState.mutex);
+            poolState.freeBlocks[device].push_back(ptr);
+        });
+    state.active[key] = leased;
+    return leased;
+}
+
 CublasMMWrapper::CublasMMWrapper(std::shared_ptr<cublasHandle_t> cublasHandle,
     std::shared_ptr<cublasLtHandle_t> cublasltHandle, cudaStream_t stream, void* workspace)
     : mCublasHandle(cublasHandle)
@@ -220,9 +288,16 @@ void CublasMMWrapper::stridedBatchedGemm(cublasOperation_t transa, cublasOperati
 
 void CublasMMWrapper::setWorkspace(void* workspace)
 {
+    mWorkspaceLease.reset();
     mCublasWorkspace = workspace;
 }
 
+void CublasMMWrapper::acquireWorkspace()
+{
+    mWorkspaceLease = CublasWorkspacePool::lease(mStream);
+    mCublasWorkspace = mWorkspaceLease.get();
+}
+
 void CublasMMWrapper::setFP32GemmConfig()
 {
     setGemmConfig(CUDA_R_32F, CUDA_R_32F, CUDA_R_32F, CUDA_R_32F);
@@ -21,6 +21,7 @@
 #include <cublas_v2.h>
 #include <cuda_runtime.h>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -29,6 +30,18 @@ namespace tensorrt_llm
 namespace common
 {
 
+//! Process-wide pool of cuBLAS workspaces shared across wrapper instances and thop GEMM ops.
+//! Workspaces are keyed by (device, stream): work on one stream serializes, so every GEMM issued to
+//! a stream can share a single CUBLAS_WORKSPACE_SIZE block instead of each owner allocating its own.
+class CublasWorkspacePool
+{
+public:
+    //! \brief Leases the workspace of the given stream on the current device. Concurrent leases
+    //! with the same key share one block; when the last lease drops, the block returns to the
+    //! pool's per-device free list after the stream has drained, ready for reuse by other streams.
+    static std::shared_ptr<void> lease(cudaStream_t stream);
+};
+
 class CublasMMWrapper
 {
 protected:
@@ -49,6 +62,7 @@ protected:
     cudaStream_t mStream;
 
     void* mCublasWorkspace = nullptr;
+    std::shared_ptr<void> mWorkspaceLease;
 
 private:
     bool descriptorsCreated() const
@@ -112,6 +126,10 @@ public:
     /********************** Utils **********************/
     void setWorkspace(void* workspace);
 
+    //! \brief Leases a workspace from CublasWorkspacePool for the wrapper's current stream. Call
+    //! after setStream; the lease is held until the next acquire or the wrapper's destruction.
+    void acquireWorkspace();
+
     void setFP32GemmConfig();
     void setFP16GemmConfig(cudaDataType_t outputType = CUDA_R_16F);
 #ifdef ENABLE_BF16
@@ -163,6 +163,28 @@ std::optional<bool> getEnvEnableXQAJIT()
     return val;
 }
 
+bool getEnvXqaAutotune()
+{
+    static bool const xqaAutotune = getBoolEnv("TRTLLM_XQA_AUTOTUNE");
+    return xqaAutotune;
+}
+
+std::string getEnvXqaSelectionProfile()
+{
+    static std::string const profilePath = []
+    {
+        char const* path = std::getenv("TRTLLM_XQA_SELECTION_PROFILE");
+        return path != nullptr ? std::string{path} : std::string{};
+    }();
+    return profilePath;
+}
+
+std::string const& getEnvXqaCubinCacheDir()
+{
+    static std::string const cacheDir = getStrEnv("TRTLLM_XQA_CUBIN_CACHE_DIR").value_or("");
+    return cacheDir;
+}
+
 std::optional<int> getEnvXqaBlocksPerSequence()
 {
     static auto const xqaBlocksPerSeq = []()
@@ -318,6 +340,12 @@ bool getEnvDisaggLayerwise()
     return disaggLayerwise;
 }
 
+bool getEnvDisaggGenPrefetchKVCache()
+{
+    static bool const prefetchKVCache = getBoolEnv("TRTLLM_DISAGG_GEN_PREFETCH_KVCACHE");
+    return prefetchKVCache;
+}
+
 bool getEnvRequestKVCacheConcurrent()
 {
     static bool const requestKVCacheConcurrent = getBoolEnv("TRTLLM_REQUEST_KV_CACHE_CONCURRENT");
@@ -386,6 +414,164 @@ std::string const& getEnvKVCacheTransferOutputPath()
     return outputPath;
 }
 
+float getEnvCtxTokenBudgetFraction()
+{
+    static float const fraction = getFloatEnv("TRTLLM_CTX_TOKEN_BUDGET_FRACTION").value_or(0.F);
+    return fraction;
+}
+
+float getEnvSchedCtxTokenWeight()
+{
+    static float const weight = getFloatEnv("TRTLLM_SCHED_CTX_TOKEN_WEIGHT").value_or(1.F);
+    return weight;
+}
+
+float getEnvSchedDraftTokenWeight()
+{
+    static float const weight = getFloatEnv("TRTLLM_SCHED_DRAFT_TOKEN_WEIGHT").value_or(1.F);
+    return weight;
+}
+
+int32_t getEnvAdaptiveChunkingCostLength()
+{
+    static int32_t const costLength = getIntEnv("TRTLLM_ADAPTIVE_CHUNKING_COST_LENGTH").value_or(0);
+    return costLength;
+}
+
+bool getEnvOverlapRequestFetch()
+{
+    static bool const overlapFetch = getBoolEnv("TRTLLM_OVERLAP_REQUEST_FETCH");
+    return overlapFetch;
+}
+
+bool getEnvEnableNvlsRequestBcast()
+{
+    static bool const enableNvlsRequestBcast = getBoolEnv("TRTLLM_ENABLE_NVLS_REQUEST_BCAST");
+    return enableNvlsRequestBcast;
+}
+
+bool getEnvBindExecutorThreadsToGpuNuma()
+{
+    static bool const bindThreads = getBoolEnv("TRTLLM_BIND_EXECUTOR_THREADS_TO_GPU_NUMA");
+    return bindThreads;
+}
+
+bool getEnvDisableOrchShmTransport()
+{
+    static bool const disableShmTransport = getBoolEnv("TRTLLM_DISABLE_ORCH_SHM_TRANSPORT");
+    return disableShmTransport;
+}
+
+int32_t getEnvEngineLoadConcurrency()
+{
+    static int32_t const concurrency = getIntEnv("TRTLLM_ENGINE_LOAD_CONCURRENCY").value_or(0);
+    return concurrency;
+}
+
+std::optional<int64_t> getEnvWeightStreamingBudgetMb()
+{
+    static std::optional<int64_t> const budgetMb = []() -> std::optional<int64_t>
+    {
+        char const* const env = std::getenv("TRTLLM_WEIGHT_STREAMING_BUDGET_MB");
+        if (env == nullptr)
+        {
+            return std::nullopt;
+        }
+        return std::stoll(env);
+    }();
+    return budgetMb;
+}
+
+bool getEnvEnableMicroBatchStreams()
+{
+    static bool const enableMicroBatchStreams = getBoolEnv("TRTLLM_ENABLE_MICRO_BATCH_STREAMS");
+    return enableMicroBatchStreams;
+}
+
+bool getEnvEnableSplitPriorityStreams()
+{
+    static bool const enableSplitPriorityStreams = getBoolEnv("TRTLLM_ENABLE_SPLIT_PRIORITY_STREAMS");
+    return enableSplitPriorityStreams;
+}
+
+bool getEnvEnablePPDecoderOverlap()
+{
+    static bool const enablePPDecoderOverlap = getBoolEnv("TRTLLM_ENABLE_PP_DECODER_OVERLAP");
+    return enablePPDecoderOverlap;
+}
+
+bool getEnvForceMpiInit()
+{
+    static bool const forceMpiInit = getBoolEnv("TRTLLM_FORCE_MPI_INIT");
+    return forceMpiInit;
+}
+
+bool getEnvEnableDecoderCudaGraph()
+{
+    static bool const enableDecoderCudaGraph = getBoolEnv("TRTLLM_ENABLE_DECODER_CUDA_GRAPH");
+    return enableDecoderCudaGraph;
+}
+
+int32_t getEnvMultiStepDecodeSteps()
+{
+    static int32_t const multiStepDecodeSteps = getIntEnv("TRTLLM_MULTI_STEP_DECODE_STEPS").value_or(1);
+    return multiStepDecodeSteps;
+}
+
+float getEnvSloDeadlineWindowMs()
+{
+    static float const windowMs = getFloatEnv("TRTLLM_SLO_DEADLINE_WINDOW_MS").value_or(0.F);
+    return windowMs;
+}
+
+std::string const& getEnvKVCacheSpillDirectory()
+{
+    static std::string const directory = getStrEnv("TRTLLM_KVCACHE_SPILL_DIRECTORY").value_or("");
+    return directory;
+}
+
+size_t getEnvKVCacheSpillMaxGB()
+{
+    static size_t const maxGB = getUInt64Env("TRTLLM_KVCACHE_SPILL_MAX_GB").value_or(64);
+    return maxGB;
+}
+
+bool getEnvKVCacheOffloadFp8Compression()
+{
+    static bool const compress = getBoolEnv("TRTLLM_KVCACHE_OFFLOAD_COMPRESS_FP8");
+    return compress;
+}
+
+float getEnvPauseResidentPrefixFraction()
+{
+    static float const fraction = getFloatEnv("TRTLLM_PAUSE_RESIDENT_PREFIX_FRACTION").value_or(0.F);
+    return fraction;
+}
+
+bool getEnvKVCacheSwaRingBuffer()
+{
+    static bool const ringBuffer = getBoolEnv("TRTLLM_KVCACHE_SWA_RING_BUFFER");
+    return ringBuffer;
+}
+
+size_t getEnvKVCachePreallocBlocks()
+{
+    static size_t const preallocBlocks = getUInt64Env("TRTLLM_KVCACHE_PREALLOC_BLOCKS").value_or(0);
+    return preallocBlocks;
+}
+
+bool getEnvKVCacheAdaptiveEviction()
+{
+    static bool const adaptiveEviction = getBoolEnv("TRTLLM_KVCACHE_ADAPTIVE_EVICTION");
+    return adaptiveEviction;
+}
+
+std::string const& getEnvKVCacheHostShareSegment()
+{
+    static std::string const segment = getStrEnv("TRTLLM_KVCACHE_HOST_SHARE").value_or("");
+    return segment;
+}
+
 bool getEnvKVCacheTransferUseAsyncBuffer()
 {
 
@@ -399,6 +585,12 @@ bool getEnvKVCacheTransferUseSyncBuffer()
     return useSyncBuffer;
 }
 
+bool getEnvKVCacheTransferSameHostIpc()
+{
+    static bool const sameHostIpc = getBoolEnv("TRTLLM_KVCACHE_TRANSFER_SAME_HOST_IPC");
+    return sameHostIpc;
+}
+
 size_t getEnvKVCacheSendMaxConcurrenceNum()
 {
 
@@ -406,6 +598,228 @@ size_t getEnvKVCacheSendMaxConcurrenceNum()
     return maxConcurrenceNum;
 }
 
+bool getEnvPeftCachePrefetch()
+{
+    static bool const peftCachePrefetch = getBoolEnv("TRTLLM_PEFT_CACHE_PREFETCH");
+    return peftCachePrefetch;
+}
+
+size_t getEnvGuidedGrammarCacheSize()
+{
+    static size_t const cacheSize = getUInt64Env("TRTLLM_GUIDED_GRAMMAR_CACHE_SIZE").value_or(128);
+    return cacheSize;
+}
+
+size_t getEnvGuidedGrammarCompileWorkers()
+{
+    static size_t const numWorkers = getUInt64Env("TRTLLM_GUIDED_GRAMMAR_COMPILE_WORKERS").value_or(2);
+    return numWorkers;
+}
+
+size_t getEnvLogitsPostProcessorWorkers()
+{
+    static size_t const numWorkers = getUInt64Env("TRTLLM_LOGITS_POST_PROCESSOR_WORKERS").value_or(0);
+    return numWorkers;
+}
+
+bool getEnvKvOffsetsDeltaUpload()
+{
+    static bool const deltaUpload = getBoolEnv("TRTLLM_KV_OFFSETS_DELTA_UPLOAD");
+    return deltaUpload;
+}
+
+size_t getEnvPromptInternCacheSize()
+{
+    static size_t const cacheSize = getUInt64Env("TRTLLM_PROMPT_INTERN_CACHE_SIZE").value_or(0);
+    return cacheSize;
+}
+
+size_t getEnvLlmRequestTokenPoolSize()
+{
+    static size_t const poolSize = getUInt64Env("TRTLLM_LLMREQUEST_TOKEN_POOL_SIZE").value_or(0);
+    return poolSize;
+}
+
+size_t getEnvResponseSerializerThreads()
+{
+    static size_t const numThreads = getUInt64Env("TRTLLM_RESPONSE_SERIALIZER_THREADS").value_or(0);
+    return numThreads;
+}
+
+size_t getEnvMemoryArbiterIntervalIters()
+{
+    static size_t const interval = getUInt64Env("TRTLLM_MEMORY_ARBITER_INTERVAL").value_or(0);
+    return interval;
+}
+
+size_t getEnvMemoryArbiterHeadroomMb()
+{
+    static size_t const headroomMb = getUInt64Env("TRTLLM_MEMORY_ARBITER_HEADROOM_MB").value_or(512);
+    return headroomMb;
+}
+
+size_t getEnvIterationProfilerSize()
+{
+    static size_t const numIterations = getUInt64Env("TRTLLM_ITERATION_PROFILER_SIZE").value_or(0);
+    return numIterations;
+}
+
+std::string const& getEnvIterationProfilerTracePath()
+{
+    static std::string const tracePath = getStrEnv("TRTLLM_ITERATION_PROFILER_TRACE_PATH").value_or("");
+    return tracePath;
+}
+
+size_t getEnvDecoderTimingRingSize()
+{
+    static size_t const numSteps = getUInt64Env("TRTLLM_DECODER_TIMING_RING_SIZE").value_or(8192);
+    return numSteps;
+}
+
+float getEnvTenantTokensPerSec()
+{
+    static float const tokensPerSec = getFloatEnv("TRTLLM_TENANT_TOKENS_PER_SEC").value_or(0.F);
+    return tokensPerSec;
+}
+
+float getEnvTenantTokenBurst()
+{
+    static float const tokenBurst = getFloatEnv("TRTLLM_TENANT_TOKEN_BURST").value_or(0.F);
+    return tokenBurst;
+}
+
+size_t getEnvTenantMaxQueuedRequests()
+{
+    static size_t const maxQueuedRequests = getUInt64Env("TRTLLM_TENANT_MAX_QUEUED_REQUESTS").value_or(0);
+    return maxQueuedRequests;
+}
+
+bool getEnvUseDummyGptModel()
+{
+    static bool const useDummyModel = getBoolEnv("TRTLLM_USE_DUMMY_GPT_MODEL");
+    return useDummyModel;
+}
+
+float getEnvDummyModelContextTokenLatencyUs()
+{
+    static float const latencyUs = getFloatEnv("TRTLLM_DUMMY_MODEL_CONTEXT_TOKEN_LATENCY_US").value_or(0.3F);
+    return latencyUs;
+}
+
+float getEnvDummyModelGenerationTokenLatencyUs()
+{
+    static float const latencyUs = getFloatEnv("TRTLLM_DUMMY_MODEL_GENERATION_TOKEN_LATENCY_US").value_or(15.F);
+    return latencyUs;
+}
+
+float getEnvDummyModelIterationOverheadUs()
+{
+    static float const overheadUs = getFloatEnv("TRTLLM_DUMMY_MODEL_ITERATION_OVERHEAD_US").value_or(150.F);
+    return overheadUs;
+}
+
+size_t getEnvRequestHostMemoryBudgetMb()
+{
+    static size_t const budgetMb = getUInt64Env("TRTLLM_REQUEST_HOST_MEMORY_BUDGET_MB").value_or(0);
+    return budgetMb;
+}
+
+size_t getEnvIdleHeartbeatMs()
+{
+    static size_t const periodMs = getUInt64Env("TRTLLM_IDLE_HEARTBEAT_MS").value_or(100);
+    return periodMs;
+}
+
+size_t getEnvNcclWatchdogTimeoutMs()
+{
+    static size_t const timeoutMs = getUInt64Env("TRTLLM_NCCL_WATCHDOG_TIMEOUT_MS").value_or(0);
+    return timeoutMs;
+}
+
+bool getEnvTorchBridgeDebug()
+{
+    static bool const debug = getBoolEnv("TRTLLM_TORCH_BRIDGE_DEBUG");
+    return debug;
+}
+
+std::string getEnvEngineWarmupShapes()
+{
+    static std::once_flag flag;
+    static std::string warmupShapes;
+
+    std::call_once(flag,
+        [&]()
+        {
+            char const* warmup_shapes = std::getenv("TRTLLM_ENGINE_WARMUP_SHAPES");
+            if (warmup_shapes)
+            {
+                warmupShapes = warmup_shapes;
+            }
+        });
+    return warmupShapes;
+}
+
+float getEnvTopPFullDistThreshold()
+{
+    static float const threshold = getFloatEnv("TRTLLM_TOPP_FULL_DIST_THRESHOLD").value_or(1.F);
+    return threshold;
+}
+
+std::string const& getEnvEngineStagingCacheDir()
+{
+    static std::string const cacheDir = getStrEnv("TRTLLM_ENGINE_STAGING_CACHE_DIR").value_or("");
+    return cacheDir;
+}
+
+size_t getEnvKVCacheTransferNumChannels()
+{
+    static size_t const numChannels = getUInt64Env("TRTLLM_KVCACHE_TRANSFER_NUM_CHANNELS").value_or(1);
+    return numChannels;
+}
+
+std::string const& getEnvIterationStatsShmName()
+{
+    static std::string const shmName = getStrEnv("TRTLLM_ITER_STATS_SHM").value_or("");
+    return shmName;
+}
+
+std::string const& getEnvIterationJournalRecordPath()
+{
+    static std::string const recordPath = getStrEnv("TRTLLM_ITER_JOURNAL_RECORD").value_or("");
+    return recordPath;
+}
+
+std::string const& getEnvIterationJournalReplayPath()
+{
+    static std::string const replayPath = getStrEnv("TRTLLM_ITER_JOURNAL_REPLAY").value_or("");
+    return replayPath;
+}
+
+size_t getEnvKVCacheTransferChannelConcurrency()
+{
+    static size_t const channelConcurrency
+        = getUInt64Env("TRTLLM_KVCACHE_TRANSFER_CHANNEL_CONCURRENCY").value_or(0);
+    return channelConcurrency;
+}
+
+size_t getEnvKVCacheTransferChunkMb()
+{
+    static size_t const chunkMb = getUInt64Env("TRTLLM_KVCACHE_TRANSFER_CHUNK_MB").value_or(0);
+    return chunkMb;
+}
+
+size_t getEnvKVCacheTransferMaxRetries()
+{
+    static size_t const maxRetries = getUInt64Env("TRTLLM_KVCACHE_TRANSFER_MAX_RETRIES").value_or(3);
+    return maxRetries;
+}
+
+size_t getEnvKVCacheTransferAckTimeoutMs()
+{
+    static size_t const ackTimeoutMs = getUInt64Env("TRTLLM_KVCACHE_TRANSFER_ACK_TIMEOUT_MS").value_or(5000);
+    return ackTimeoutMs;
+}
+
 size_t getEnvKVCacheRecvBufferCount()
 {
     static size_t const recvBufferCount = getUInt64Env("TRTLLM_KVCACHE_RECV_BUFFER_COUNT").value_or(2);
@@ -450,4 +864,16 @@ bool getEnvDisableChunkedAttentionInGenPhase()
     return getBoolEnv("TRTLLM_DISABLE_CHUNKED_ATTENTION_IN_GEN_PHASE");
 }
 
+bool getEnvDisableEngineConfigCache()
+{
+    static bool const disableEngineConfigCache = getBoolEnv("TRTLLM_DISABLE_ENGINE_CONFIG_CACHE");
+    return disableEngineConfigCache;
+}
+
+bool getEnvEnableMemoryProfiler()
+{
+    static bool const enableMemoryProfiler = getBoolEnv("TRTLLM_MEMORY_PROFILER");
+    return enableMemoryProfiler;
+}
+
 } // namespace tensorrt_llm::common
@@ -44,6 +44,19 @@ std::optional<bool> getEnvEnableXQAJIT();
 // 0 means to use heuristics.
 std::optional<int32_t> getEnvXqaBlocksPerSequence();
 
+// Whether to time XQA against MMHA online for each observed generation shape bucket and keep the winner,
+// instead of trusting the static heuristics.
+bool getEnvXqaAutotune();
+
+// Path of the XQA/MMHA selection profile. Autotuned winners are appended to it keyed by GPU, and entries
+// matching the current GPU are applied without re-measuring. Empty when unset.
+std::string getEnvXqaSelectionProfile();
+
+// Directory of the persistent XQA JIT cubin cache. Compiled cubins are stored keyed by the full kernel
+// hash key (which includes the SM version) and reloaded by later processes instead of invoking NVRTC.
+// Empty string (the default) disables the cache.
+std::string const& getEnvXqaCubinCacheDir();
+
 // Whether use tileSizeKv64 for multiCtasKvMode of trtllm-gen kernels.
 bool getEnvUseTileSizeKv64ForTrtllmGen();
 
@@ -88,6 +101,10 @@ std::string getEnvNixlInterface();
 
 bool getEnvDisaggLayerwise();
 
+// Start KV cache reception for arrived disaggregated-generation requests before the capacity
+// scheduler admits them, when the cache manager can reserve the blocks up front.
+bool getEnvDisaggGenPrefetchKVCache();
+
 bool getEnvParallelCacheSend();
 
 bool getEnvRequestKVCacheConcurrent();
@@ -98,6 +115,133 @@ bool getEnvEnableReceiveKVCacheParallel();
 
 std::string const& getEnvKVCacheTransferOutputPath();
 
+// Fraction of the per-iteration token budget that context/encoder tokens may consume.
+// Values <= 0 (the default) disable the cap.
+float getEnvCtxTokenBudgetFraction();
+
+// Calibration length for adaptive context chunking: the number of context tokens whose linear
+// (GEMM) cost roughly equals the cost of attending to one cached kv token per new token. When set
+// to a positive value, successive chunks of a long prompt shrink so that the predicted chunk cost
+// stays flat as the kv prefix grows. 0 (the default) keeps fixed-size chunks.
+int32_t getEnvAdaptiveChunkingCostLength();
+
+// Relative cost of one context/encoder token against one decode token in the micro batch
+// scheduler's token budget. Context tokens run as dense GEMM work with high arithmetic intensity,
+// so a measured weight below 1 lets the scheduler pack more prefill into the same iteration
+// budget. 1 (the default) keeps plain token counting.
+float getEnvSchedCtxTokenWeight();
+
+// Relative cost of one speculative draft-verify token against one decode token in the micro batch
+// scheduler's token budget. A request verifying draftLen draft tokens contributes draftLen + 1
+// target tokens whose per-token cost differs from plain decode; weighting them by a measured cost
+// keeps mixed speculative/non-speculative iterations near the budget. 1 (the default) keeps plain
+// token counting.
+float getEnvSchedDraftTokenWeight();
+
+// Whether to fetch and deserialize new requests on a side thread while forwardSync waits for the
+// previous iteration's GPU work, removing that host time from the iteration critical path.
+// Only takes effect without pipeline parallelism.
+bool getEnvOverlapRequestFetch();
+
+// Whether to distribute serialized new requests to tensor parallel ranks through an NVLS multicast
+// buffer, replacing the per-peer sends of the MPI broadcast with a single multicast write. Requires
+// multicast support on every rank of the tensor parallel group; payloads larger than the multicast
+// buffer fall back to the MPI broadcast.
+bool getEnvEnableNvlsRequestBcast();
+
+// Whether to run each micro batch's engine execution on its own CUDA stream.
+// The engine is ordered behind its input preparation and the decoder handoff is ordered behind the
+// engine with events, so only the stream-level false dependencies are removed.
+bool getEnvEnableMicroBatchStreams();
+
+// Whether to run generation engine steps on a high-priority CUDA stream and context steps on a
+// low-priority one, so decode kernels preempt long prefill chunks at SM granularity when steps of
+// different micro batches overlap. Only effective without context-gen fusion (model type
+// InflightBatching), where context and generation run as separate engine enqueues.
+bool getEnvEnableSplitPriorityStreams();
+
+// Whether the last pipeline-parallel rank interleaves micro batches 1F1B style: instead of draining
+// a micro batch's decoder (event sync, token broadcast, request update) before returning from its
+// iteration, the drain is deferred until the next micro batch's engine forward has been enqueued,
+// so sampling of micro batch m overlaps the engine run of m+1 and the iteration-boundary pipeline
+// bubble disappears. Tokens reach the other ranks one iteration later than without the overlap.
+bool getEnvEnablePPDecoderOverlap();
+
+// Force full MPI initialization even when the process was not started by an MPI launcher.
+// By default such a process is treated as a single-rank session and MPI setup is skipped entirely.
+bool getEnvForceMpiInit();
+
+// Whether to bind the executor worker threads to the CPU cores of the NUMA node of their GPU.
+// Keeps response serialization on the GPU-local socket and places the pinned buffers those threads
+// allocate on the same node.
+bool getEnvBindExecutorThreadsToGpuNuma();
+
+// Disable the shared-memory transport between a co-located orchestrator and leader and always exchange
+// messages over MPI.
+bool getEnvDisableOrchShmTransport();
+
+// Maximum number of ranks per node that load their engine concurrently. Ranks take turns in waves of
+// this size, ordered by local rank, so deserialization does not saturate the host memory bus and PCIe.
+// Values <= 0 (the default) let all ranks load at once.
+int32_t getEnvEngineLoadConcurrency();
+
+// Absolute weight streaming budget in MiB of streamable weights kept resident on the device,
+// overriding the gpu_weights_percent fraction. A negative value sizes the budget automatically from
+// the free device memory at engine load, so models whose weights exceed device capacity come up with
+// the remainder streamed from host memory. Unset keeps the fraction-based behavior.
+std::optional<int64_t> getEnvWeightStreamingBudgetMb();
+
+// Whether to capture decoder iterations into CUDA graphs and replay them while the batch is stable.
+// Only takes effect when CUDA graph mode is enabled on the executor.
+bool getEnvEnableDecoderCudaGraph();
+
+// Number of decode steps to run back to back on the device before the host reconciles requests again.
+// Between reconciles, sampling, stop checks, and token append run purely on decoder device state; engine
+// input ids are gathered from the previous decoder step on device. Values <= 1 (the default) keep the
+// per-iteration host sync. Only takes effect for generation-only batches in restricted configurations
+// (beam width 1, no speculative or guided decoding, no streaming or returned logits, block reuse off).
+int32_t getEnvMultiStepDecodeSteps();
+
+// Width in milliseconds of the deadline window used for earliest-deadline-first capacity scheduling.
+// A request's deadline is its arrival time plus (1 - priority) times this window.
+// Values <= 0 (the default) keep arrival-order scheduling.
+float getEnvSloDeadlineWindowMs();
+
+// Directory backing the tertiary (file-backed) KV cache tier. Empty string disables spilling.
+std::string const& getEnvKVCacheSpillDirectory();
+
+// On-disk budget of the tertiary KV cache tier in GiB.
+size_t getEnvKVCacheSpillMaxGB();
+
+// Compress KV cache blocks to FP8 with per-block scales when they are offloaded to host memory.
+bool getEnvKVCacheOffloadFp8Compression();
+
+// Fraction of a paused sequence's KV cache blocks, counted from the front, that keep their
+// retention priority when the scheduler preempts the sequence. The remaining tail blocks are
+// demoted to the minimum priority so eviction and offload take them first and the prefix stays
+// resident for reuse on resume. Values <= 0 (the default) keep the uniform priority.
+float getEnvPauseResidentPrefixFraction();
+
+// Whether to upload only the changed rows of the kv cache block-offset tables each iteration,
+// instead of re-copying the full tables, while the batch composition is unchanged.
+bool getEnvKvOffsetsDeltaUpload();
+
+// Rebind out-of-window SWA blocks as the sequence's next tail block instead of cycling them
+// through the free list, making long generation allocation-free in steady state.
+bool getEnvKVCacheSwaRingBuffer();
+
+// Maximum number of KV cache blocks to speculatively pre-allocate per sequence based on the
+// predicted output length. 0 (the default) disables pre-allocation.
+size_t getEnvKVCachePreallocBlocks();
+
+// Whether to select the KV cache eviction policy (LRU vs LFU-with-aging) adaptively at runtime
+// based on simulated hit rates, instead of the fixed LRU policy.
+bool getEnvKVCacheAdaptiveEviction();
+
+// Name of the shared-memory segment used to share reusable KV cache blocks between model
+// replicas on the same host. Empty string (the default) disables cross-replica sharing.
+std::string const& getEnvKVCacheHostShareSegment();
+
 bool getEnvTryZCopyForKVCacheTransfer();
 
 // Force deterministic behavior for all kernels.
@@ -125,8 +269,171 @@ bool getEnvKVCacheTransferUseAsyncBuffer();
 
 bool getEnvKVCacheTransferUseSyncBuffer();
 
+// Probe each disaggregated cache-transfer connection for a same-host peer and, when the probe
+// succeeds, move the payload with a CUDA IPC device-to-device copy instead of the transfer agent.
+bool getEnvKVCacheTransferSameHostIpc();
+
 size_t getEnvKVCacheSendMaxConcurrenceNum();
 
+// Stage the LoRA weights of tasks that are visible in the request queue, or were popular recently,
+// into the device cache before the batch that needs them is scheduled.
+bool getEnvPeftCachePrefetch();
+
+// Number of compiled grammars the guided decoder keeps in its LRU cache, shared across requests.
+// Repeat guides (e.g. the same JSON schema from one tenant) attach a matcher without recompiling.
+size_t getEnvGuidedGrammarCacheSize();
+
+// Number of worker threads compiling guided-decoding grammars. First-occurrence guides compile on
+// these workers while earlier context chunks run, and distinct new guides compile in parallel.
+size_t getEnvGuidedGrammarCompileWorkers();
+
+// Number of worker threads used to run logits post-processor callbacks of different requests
+// concurrently. 0 (the default) runs the callbacks inline on the model thread. Python callbacks
+// still serialize on the interpreter lock.
+size_t getEnvLogitsPostProcessorWorkers();
+
+// Number of distinct prompts tracked by the content-addressed store that deduplicates the input
+// tokens of live requests, so identical prompts queued concurrently share one host allocation.
+// 0 (the default) disables interning; every request keeps its own immutable copy.
+size_t getEnvPromptInternCacheSize();
+
+// Maximum number of token vectors kept in the process-wide freelist that recycles LlmRequest token
+// storage across requests, keeping steady-state request turnover free of token reallocations.
+// 0 (the default) disables recycling.
+size_t getEnvLlmRequestTokenPoolSize();
+
+// Number of threads serializing orchestrator-mode responses in parallel on the leader. Messages are
+// stamped with sequence numbers when they leave the send queue, so the wire order is preserved.
+// 0 (the default) serializes inline on the send thread.
+size_t getEnvResponseSerializerThreads();
+
+// Number of iterations between runs of the device memory arbiter, which trims the runtime buffer
+// pool's idle reserve and tracks the free-memory headroom deficit with the schedulable KV cache
+// capacity. 0 (the default) disables the arbiter.
+size_t getEnvMemoryArbiterIntervalIters();
+
+// Free device memory headroom in MiB the arbiter maintains for consumers outside the KV cache,
+// e.g. LoRA weight loads, CUDA graph capture, or a co-located process.
+size_t getEnvMemoryArbiterHeadroomMb();
+
+// Number of iterations retained by the always-on iteration profiler, which brackets the stages of
+// each forward iteration (schedule, engine, decode, transfer) with CUDA event pairs and keeps the
+// timings in a ring buffer. 0 (the default) disables the profiler.
+size_t getEnvIterationProfilerSize();
+
+// Path the iteration profiler trace is written to when the model is destroyed. Empty (the default)
+// skips the trace dump; the ring buffer can still be inspected from a debugger.
+std::string const& getEnvIterationProfilerTracePath();
+
+// Number of decoder steps retained by the always-on per-step timing ring of GptDecoderBatched,
+// which records host dispatch timestamps, GPU step times and batch composition for inter-token
+// latency attribution. Defaults to 8192; 0 disables the ring.
+size_t getEnvDecoderTimingRingSize();
+
+// Sustained token admission rate per tenant (client id) enforced at Executor::enqueueRequest,
+// counting input plus requested output tokens. 0 (the default) disables rate shaping.
+float getEnvTenantTokensPerSec();
+
+// Token bucket capacity per tenant for the admission rate limit. 0 (the default) uses one second
+// worth of the configured rate.
+float getEnvTenantTokenBurst();
+
+// Maximum number of queued requests (including child requests) per tenant; requests beyond it
+// fast-fail at enqueue instead of growing the scheduling queue. 0 (the default) disables the bound.
+size_t getEnvTenantMaxQueuedRequests();
+
+// Replace the TRT-backed model with the engine-less TrtGptModelDummy, which runs the regular
+// schedulers but replays calibrated per-token latencies on the host and emits placeholder tokens.
+// For scheduler and executor load testing on CPU-only machines.
+bool getEnvUseDummyGptModel();
+
+// Simulated cost per context token in microseconds for TrtGptModelDummy. Defaults to 0.3.
+float getEnvDummyModelContextTokenLatencyUs();
+
+// Simulated cost per generation step and sequence in microseconds for TrtGptModelDummy.
+// Defaults to 15.
+float getEnvDummyModelGenerationTokenLatencyUs();
+
+// Simulated fixed per-iteration overhead in microseconds for TrtGptModelDummy. Defaults to 150.
+float getEnvDummyModelIterationOverheadUs();
+
+// Budget in mebibytes for the pinned host buffers a single request may allocate (logits staging,
+// encoder output, additional outputs). A request exceeding it is failed individually with an error
+// response instead of taking down the executor. 0 (the default) disables the budget.
+size_t getEnvRequestHostMemoryBudgetMb();
+
+// Period in milliseconds of the warm-keeping heartbeat the execution loop runs while parked with
+// zero active requests. Each beat stages a small host-to-device copy on the model's runtime stream
+// so the CUDA context, pinned staging memory and DMA path stay warm and the first iteration after
+// an idle stretch resumes without a cold-start penalty. 0 disables the heartbeat; the loop then
+// parks on the request queue indefinitely. Defaults to 100.
+size_t getEnvIdleHeartbeatMs();
+
+// Smallest runtime top P value routed to the sort-free full-distribution sampling kernel instead
+// of the sorted/air top P kernels, whose cost spikes for P close to 1 at large vocab sizes. The
+// default of 1.0 only reroutes exact full-distribution sampling; lowering it trades top P
+// truncation accuracy for speed. Values above 1.0 disable the rerouting.
+float getEnvTopPFullDistThreshold();
+
+// Timeout in milliseconds after which a NCCL send/recv that has not completed on the device is
+// considered hung. The communicator's watchdog then dumps the in-flight operations and aborts the
+// communicator so every rank of the group fails fast instead of wedging until an external timeout.
+// 0 (the default) disables the watchdog.
+size_t getEnvNcclWatchdogTimeoutMs();
+
+// Whether to log every tensor that is materialized as a contiguous copy when bridged across the
+// torch boundary, together with its provenance, shape and strides. Tensors that alias the torch
+// storage are silent; only hidden copies are flagged. Off by default.
+bool getEnvTorchBridgeDebug();
+
+// Shape profile for engine warmup: semicolon separated inputLen:outputLen:count triples, e.g.
+// "128:8:4;1024:4:1". When set, synthetic requests of these shapes are run through the full
+// pipeline at model construction, so JIT compilation, graph capture and pool growth happen before
+// the first real request. Empty (the default) disables warmup.
+std::string getEnvEngineWarmupShapes();
+
+// Node-local directory the engine files are staged into before deserialization when running
+// multi-node in orchestrator mode, so only one rank per node reads the engine from a network
+// filesystem. Empty (the default) disables staging and every rank reads the engine in place.
+std::string const& getEnvEngineStagingCacheDir();
+
+// Number of tagged channels a single peer-to-peer KV cache transfer is striped across. Values <= 1
+// (the default) keep one channel per connection. Must be set to the same value on the context and
+// generation instances.
+size_t getEnvKVCacheTransferNumChannels();
+
+// Name of a POSIX shared memory segment to publish per-iteration stats into as flat binary records,
+// so a monitoring agent on the same host can map the ring instead of polling the JSON stats API.
+// Empty (the default) disables the ring.
+std::string const& getEnvIterationStatsShmName();
+
+// Path to write a per-iteration batch composition journal to (record mode), so an anomalous run can
+// later be re-executed with identical scheduling decisions. Empty (the default) disables recording.
+std::string const& getEnvIterationJournalRecordPath();
+
+// Path to read a previously recorded batch composition journal from (replay mode); the journalled
+// scheduling decisions override the live scheduler. Empty (the default) disables replay.
+std::string const& getEnvIterationJournalReplayPath();
+
+// Upper bound on the number of channel stripes a transfer keeps in flight at once, so striped
+// transfers do not monopolize the NIC. 0 (the default) allows all channels to run concurrently.
+size_t getEnvKVCacheTransferChannelConcurrency();
+
+// Chunk size in MiB for resumable agent-backed KV cache transfers. The sender writes the payload in
+// chunks with per-chunk sequence notifications and the receiver acknowledges progress with a chunk
+// bitmap, so a retried transfer resumes from the unacknowledged remainder instead of restarting.
+// 0 (the default) keeps single-shot transfers. Must be set on both the context and generation
+// instances.
+size_t getEnvKVCacheTransferChunkMb();
+
+// Number of times a resumable KV cache transfer is retried after a failed or unacknowledged
+// attempt before the transfer is failed.
+size_t getEnvKVCacheTransferMaxRetries();
+
+// Time in milliseconds a resumable KV cache transfer waits for receiver acknowledgment before it
+// declares an attempt stalled; the receiver uses the same period to re-advertise its progress.
+size_t getEnvKVCacheTransferAckTimeoutMs();
+
 size_t getEnvMemSizeForKVCacheTransferBuffer();
 
 uint16_t getEnvNixlPort();
@@ -136,4 +443,10 @@ bool getEnvDisaggBenchmarkGenOnly();
 // Whether to disable the chunked-attention in the generation phase.
 bool getEnvDisableChunkedAttentionInGenPhase();
 
+// Whether to disable the binary engine config cache written beside config.json.
+bool getEnvDisableEngineConfigCache();
+
+// Whether to enable the allocation-site memory profiler from process start.
+bool getEnvEnableMemoryProfiler();
+
 } // namespace tensorrt_llm::common
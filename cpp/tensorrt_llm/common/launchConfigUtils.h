@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cuda_runtime.h>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace tensorrt_llm::common
+{
+
+//! 1-d launch configuration picked by the occupancy advisor.
+struct LaunchConfig1D
+{
+    dim3 grid;
+    dim3 block;
+};
+
+namespace launch_utils
+{
+
+struct KernelOccupancy
+{
+    //! Block size that maximizes occupancy for the kernel on the current device.
+    int blockSize;
+    //! Smallest grid that keeps every SM busy at that block size.
+    int saturatingGridSize;
+};
+
+//! Queries cudaOccupancyMaxPotentialBlockSize once per (kernel, device) and caches the result.
+//! The answer depends only on the kernel's register/shared-memory footprint and the device, so
+//! repeated launches of the small per-iteration utility kernels pay a map lookup instead of a
+//! driver round trip.
+inline KernelOccupancy queryKernelOccupancy(void const* kernelFunc)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<void const*, int>, KernelOccupancy> cache;
+
+    int device{0};
+    check_cuda_error(cudaGetDevice(&device));
+    auto const key = std::make_pair(kernelFunc, device);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = cache.find(key);
+    if (it == cache.end())
+    {
+        int saturatingGridSize{0};
+        int blockSize{0};
+        check_cuda_error(cudaOccupancyMaxPotentialBlockSize(&saturatingGridSize, &blockSize, kernelFunc));
+        it = cache.emplace(key, KernelOccupancy{blockSize, saturatingGridSize}).first;
+    }
+    return it->second;
+}
+
+} // namespace launch_utils
+
+//! @brief Advises a launch configuration for a 1-d grid-stride kernel.
+//! @details The block size comes from the cached occupancy query, and the grid is sized to the work
+//!          but capped at one full wave of resident blocks: a grid-stride loop covers the remainder,
+//!          so launching beyond the saturating grid only adds scheduling overhead.
+//! @param itemsPerThread how many work items each thread consumes per loop step, e.g. the vector
+//!                       width of a vectorized copy.
+template <typename KernelT>
+LaunchConfig1D adviseGridStrideLaunch1D(KernelT kernelFunc, std::size_t workItems, std::size_t itemsPerThread = 1)
+{
+    auto const occupancy = launch_utils::queryKernelOccupancy(reinterpret_cast<void const*>(kernelFunc));
+    auto const threadsNeeded = ceilDiv(workItems, itemsPerThread);
+    auto const blocksNeeded
+        = std::max<std::size_t>(ceilDiv(threadsNeeded, static_cast<std::size_t>(occupancy.blockSize)), 1);
+    auto const gridSize = std::min(blocksNeeded, static_cast<std::size_t>(occupancy.saturatingGridSize));
+    return {dim3{static_cast<std::uint32_t>(gridSize)}, dim3{static_cast<std::uint32_t>(occupancy.blockSize)}};
+}
+
+//! @brief Advises a launch configuration for a 1-d kernel where each thread handles exactly one item.
+//! @details Unlike the grid-stride variant the grid must cover all of the work, so only the block
+//!          size is tuned and the grid follows from it.
+template <typename KernelT>
+LaunchConfig1D adviseCoveringLaunch1D(KernelT kernelFunc, std::size_t workItems)
+{
+    auto const occupancy = launch_utils::queryKernelOccupancy(reinterpret_cast<void const*>(kernelFunc));
+    auto const gridSize = std::max<std::size_t>(ceilDiv(workItems, static_cast<std::size_t>(occupancy.blockSize)), 1);
+    TLLM_CHECK_WITH_INFO(gridSize <= static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()),
+        "Covering launch grid exceeds the maximum grid dimension");
+    return {dim3{static_cast<std::uint32_t>(gridSize)}, dim3{static_cast<std::uint32_t>(occupancy.blockSize)}};
+}
+
+} // namespace tensorrt_llm::common
@@ -27,9 +27,51 @@
 #endif
 
 #include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
 
 namespace tensorrt_llm::common::nvtx
 {
+
+//! Instrumentation categories that can be toggled at runtime. Ranges opened through the
+//! NVTX3_CATEGORIZED_RANGE* macros belong to one category each; a disabled category emits nothing,
+//! so nsys captures can be narrowed to the stages under investigation without rebuilding.
+enum class Category : std::uint32_t
+{
+    kBatchManager = 1U << 0,
+    kDecoder = 1U << 1,
+    kKvCache = 1U << 2,
+    kCommunication = 1U << 3,
+    kAll = 0xffffffffU,
+};
+
+inline std::atomic<std::uint32_t>& enabledCategoriesMask()
+{
+    // All categories start enabled to preserve the historic behavior. TRTLLM_NVTX_CATEGORIES (a
+    // bitmask) narrows the selection at startup, setEnabledCategories switches it at runtime.
+    static std::atomic<std::uint32_t> mask{
+        []() -> std::uint32_t
+        {
+            char const* const env = std::getenv("TRTLLM_NVTX_CATEGORIES");
+            return env != nullptr ? static_cast<std::uint32_t>(std::strtoul(env, nullptr, 0))
+                                  : static_cast<std::uint32_t>(Category::kAll);
+        }()};
+    return mask;
+}
+
+inline void setEnabledCategories(std::uint32_t mask) noexcept
+{
+    enabledCategoriesMask().store(mask, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline bool isCategoryEnabled(Category category) noexcept
+{
+    return (enabledCategoriesMask().load(std::memory_order_relaxed) & static_cast<std::uint32_t>(category)) != 0;
+}
+
 inline nvtx3::color nextColor()
 {
 #ifndef NVTX_DISABLE
@@ -46,8 +88,57 @@ inline nvtx3::color nextColor()
 #endif
 }
 
+//! Scoped range that only materializes when its category is enabled. The optional payload (e.g. a
+//! request id) is attached to the NVTX event, and the iteration/batch-size constructor renders the
+//! pair into the range label, so profiler rows can be correlated with specific production requests
+//! and iterations instead of anonymous ranges.
+class CategorizedRange
+{
+public:
+    explicit CategorizedRange(Category category, char const* name, std::optional<std::int64_t> payload = std::nullopt)
+    {
+        if (isCategoryEnabled(category))
+        {
+            if (payload.has_value())
+            {
+                mRange.emplace(nvtx3::event_attributes{name, nextColor(), nvtx3::payload{*payload}});
+            }
+            else
+            {
+                mRange.emplace(nvtx3::event_attributes{name, nextColor()});
+            }
+        }
+    }
+
+    //! Range labeled with the iteration and batch composition of the enclosing step. The iteration
+    //! doubles as the numeric payload of the event.
+    CategorizedRange(Category category, char const* name, std::int64_t iteration, std::int32_t batchSize)
+    {
+        if (isCategoryEnabled(category))
+        {
+            char label[128];
+            std::snprintf(label, sizeof(label), "%s it=%lld bs=%d", name, static_cast<long long>(iteration), batchSize);
+            mRange.emplace(nvtx3::event_attributes{label, nextColor(), nvtx3::payload{iteration}});
+        }
+    }
+
+private:
+    std::optional<nvtx3::scoped_range> mRange;
+};
+
 } // namespace tensorrt_llm::common::nvtx
 
 #define NVTX3_SCOPED_RANGE_WITH_NAME(range, name)                                                                      \
     ::nvtx3::scoped_range range(::tensorrt_llm::common::nvtx::nextColor(), name)
 #define NVTX3_SCOPED_RANGE(range) NVTX3_SCOPED_RANGE_WITH_NAME(range##_range, #range)
+
+//! Range gated on a runtime-switchable category, optionally carrying a numeric payload such as a
+//! request id, or an iteration/batch-size pair for per-step ranges.
+#define NVTX3_CATEGORIZED_RANGE(category, range, name)                                                                 \
+    ::tensorrt_llm::common::nvtx::CategorizedRange range(::tensorrt_llm::common::nvtx::Category::category, name)
+#define NVTX3_CATEGORIZED_RANGE_WITH_PAYLOAD(category, range, name, payload)                                           \
+    ::tensorrt_llm::common::nvtx::CategorizedRange range(                                                              \
+        ::tensorrt_llm::common::nvtx::Category::category, name, static_cast<std::int64_t>(payload))
+#define NVTX3_CATEGORIZED_RANGE_WITH_BATCH(category, range, name, iteration, batchSize)                                \
+    ::tensorrt_llm::common::nvtx::CategorizedRange range(::tensorrt_llm::common::nvtx::Category::category, name,       \
+        static_cast<std::int64_t>(iteration), static_cast<std::int32_t>(batchSize))
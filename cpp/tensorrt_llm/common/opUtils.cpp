@@ -52,9 +52,16 @@ namespace
 // Get NCCL unique ID for a group of ranks.
 ncclUniqueId getUniqueId(std::set<int> const& group)
 {
+    ncclUniqueId id;
+    if (group.size() == 1)
+    {
+        // A singleton group has no peers to exchange the id with, so don't touch the MPI session
+        // at all: a TP=1 process then never initializes MPI on behalf of its communicators.
+        NCCLCHECK_THROW(ncclGetUniqueId(&id));
+        return id;
+    }
     auto const rank = COMM_SESSION.getRank();
     TLLM_LOG_TRACE("%s start for rank %d", __PRETTY_FUNCTION__, rank);
-    ncclUniqueId id;
     if (rank == *group.begin())
     {
         NCCLCHECK_THROW(ncclGetUniqueId(&id));
@@ -74,7 +81,9 @@ ncclUniqueId getUniqueId(std::set<int> const& group)
 
 std::shared_ptr<ncclComm_t> getComm(std::set<int> const& group)
 {
-    auto const rank = COMM_SESSION.getRank();
+    // The session rank is only needed to pick this rank's position in a multi-rank group; a
+    // singleton group must not query it, or TP=1 plugin initialization would drag in MPI.
+    auto const rank = group.size() == 1 ? *group.begin() : COMM_SESSION.getRank();
     TLLM_LOG_TRACE("%s start for rank %d", __PRETTY_FUNCTION__, rank);
     static std::map<std::set<int>, std::shared_ptr<ncclComm_t>> commMap;
     static std::mutex mutex;
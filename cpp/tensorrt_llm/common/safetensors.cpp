@@ -17,9 +17,15 @@
 #include "safetensors.h"
 #include "nlohmann/json.hpp"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/asyncFileReader.h"
 #include <NvInferRuntime.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <cstdint>
-#include <fstream>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <utility>
@@ -52,34 +58,140 @@ static DataType convertDataTypeStrToEnum(std::string const& str)
     TLLM_THROW("Unsupported data type: " + str);
 }
 
+//! Shared read-only mapping of a safetensors file. Tensor views return pointers straight into the
+//! mapping, so the page cache holds the only host copy of the weights and the kernel's readahead
+//! overlaps disk reads with whatever the consumer does with the data (typically device uploads).
+class MappedFile
+{
+public:
+    explicit MappedFile(char const* filename)
+    {
+        int32_t const fd = ::open(filename, O_RDONLY);
+        if (fd < 0)
+        {
+            return;
+        }
+        auto const size = ::lseek(fd, 0, SEEK_END);
+        if (size > 0)
+        {
+            void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                mData = data;
+                mSize = size;
+            }
+        }
+        ::close(fd);
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    ~MappedFile()
+    {
+        if (mData != nullptr)
+        {
+            munmap(mData, mSize);
+        }
+    }
+
+    [[nodiscard]] bool isOpen() const
+    {
+        return mData != nullptr;
+    }
+
+    [[nodiscard]] std::byte const* data() const
+    {
+        return static_cast<std::byte const*>(mData);
+    }
+
+    [[nodiscard]] int64_t size() const
+    {
+        return mSize;
+    }
+
+    //! Queue readahead for the given byte range of the file.
+    void willNeed(int64_t offsetBegin, int64_t offsetEnd) const
+    {
+        auto const pageSize = static_cast<int64_t>(::sysconf(_SC_PAGESIZE));
+        auto const alignedBegin = offsetBegin / pageSize * pageSize;
+        madvise(const_cast<std::byte*>(data()) + alignedBegin, offsetEnd - alignedBegin, MADV_WILLNEED);
+    }
+
+private:
+    void* mData{nullptr};
+    int64_t mSize{0};
+};
+
+//! Fallback file handle when mapping failed. Holds the descriptor only; reads go through the shared
+//! AsyncFileReader by (offset, size), so tensors sharing one handle can load concurrently.
+class OpenFile
+{
+public:
+    explicit OpenFile(char const* filename)
+        : mFd(::open(filename, O_RDONLY))
+    {
+    }
+
+    OpenFile(OpenFile const&) = delete;
+    OpenFile& operator=(OpenFile const&) = delete;
+
+    ~OpenFile()
+    {
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+    }
+
+    [[nodiscard]] bool isOpen() const
+    {
+        return mFd >= 0;
+    }
+
+    //! Read size bytes at offset into dest, returning true when the full range was read.
+    [[nodiscard]] bool read(void* dest, int64_t size, int64_t offset) const
+    {
+        return AsyncFileReader::instance().readRange(mFd, dest, static_cast<size_t>(size), offset);
+    }
+
+private:
+    int mFd{-1};
+};
+
 class SafeTensorArray : public INdArray
 {
     std::vector<int64_t> mShape;
     mutable std::unique_ptr<std::byte[]> mData;
     DataType mDataType;
-    int64_t mOffsetBegin; // adjusted to represent offset relative to the beginning of the file
-    int64_t mOffsetEnd;   // adjusted to represent offset relative to the beginning of the file
-    std::shared_ptr<std::ifstream> mFs;
+    int64_t mOffsetBegin;               // adjusted to represent offset relative to the beginning of the file
+    int64_t mOffsetEnd;                 // adjusted to represent offset relative to the beginning of the file
+    std::shared_ptr<MappedFile> mMapped; // set when the file is memory mapped
+    std::shared_ptr<OpenFile> mFile;     // fallback when mapping failed
 
 public:
-    SafeTensorArray(std::shared_ptr<std::ifstream> const& fs, std::string const& dtypeStr,
-        std::vector<int64_t> const& shape, int64_t offsetBegin, int64_t offsetEnd)
+    SafeTensorArray(std::shared_ptr<MappedFile> const& mapped, std::shared_ptr<OpenFile> const& file,
+        std::string const& dtypeStr, std::vector<int64_t> const& shape, int64_t offsetBegin, int64_t offsetEnd)
         : mShape(shape)
         , mDataType(convertDataTypeStrToEnum(dtypeStr))
         , mOffsetBegin(offsetBegin)
         , mOffsetEnd(offsetEnd)
-        , mFs(fs)
+        , mMapped(mapped)
+        , mFile(file)
     {
     }
 
     [[nodiscard]] void const* data() const override
     {
+        if (mMapped)
+        {
+            return mMapped->data() + mOffsetBegin;
+        }
         if (!mData)
         {
-            mFs->seekg(mOffsetBegin);
             int64_t size = mOffsetEnd - mOffsetBegin;
             mData.reset(new std::byte[size]);
-            mFs->read(reinterpret_cast<char*>(mData.get()), size);
+            TLLM_CHECK_WITH_INFO(mFile->read(mData.get(), size, mOffsetBegin), "Failed to read tensor data");
         }
 
         return mData.get();
@@ -107,19 +219,37 @@ class SafeTensor : public ISafeTensor
     int64_t mJsonSize;
     std::map<std::string, std::string> mMetadata;
     std::map<std::string, nlohmann::basic_json<>> mTensorInfo;
-    std::shared_ptr<std::ifstream> mFs;
+    std::shared_ptr<MappedFile> mMapped;
+    std::shared_ptr<OpenFile> mFile;
 
 public:
     SafeTensor(char const* filename)
-        : mFs(new std::ifstream(filename, std::ios::binary))
+        : mMapped(std::make_shared<MappedFile>(filename))
     {
-        if (!mFs->is_open())
+        std::vector<char> jsonBuffer;
+        if (mMapped->isOpen())
+        {
+            TLLM_CHECK_WITH_INFO(
+                mMapped->size() > static_cast<int64_t>(sizeof(mJsonSize)), "File too small: %s", filename);
+            std::memcpy(&mJsonSize, mMapped->data(), sizeof(mJsonSize));
+            auto const* const jsonBegin = reinterpret_cast<char const*>(mMapped->data()) + sizeof(mJsonSize);
+            jsonBuffer.assign(jsonBegin, jsonBegin + mJsonSize);
+        }
+        else
         {
-            TLLM_THROW("Failed to open file: " + std::string(filename));
+            TLLM_LOG_WARNING("Failed to map file %s, falling back to buffered reads.", filename);
+            mMapped.reset();
+            mFile = std::make_shared<OpenFile>(filename);
+            if (!mFile->isOpen())
+            {
+                TLLM_THROW("Failed to open file: " + std::string(filename));
+            }
+            TLLM_CHECK_WITH_INFO(
+                mFile->read(&mJsonSize, sizeof(mJsonSize), 0), "Failed to read header size: %s", filename);
+            jsonBuffer.resize(mJsonSize);
+            TLLM_CHECK_WITH_INFO(
+                mFile->read(jsonBuffer.data(), mJsonSize, sizeof(mJsonSize)), "Failed to read header: %s", filename);
         }
-        mFs->read(reinterpret_cast<char*>(&mJsonSize), sizeof(mJsonSize));
-        std::vector<char> jsonBuffer(mJsonSize);
-        mFs->read(jsonBuffer.data(), mJsonSize);
         nlohmann::json attributes = nlohmann::json::parse(jsonBuffer);
         for (auto const& [key, value] : attributes.items())
         {
@@ -152,12 +282,31 @@ public:
         {
             auto const& value = it->second;
             int64_t offset = mJsonSize + sizeof(mJsonSize);
-            return std::make_shared<SafeTensorArray>(mFs, value["dtype"], value["shape"],
+            return std::make_shared<SafeTensorArray>(mMapped, mFile, value["dtype"], value["shape"],
                 static_cast<int64_t>(value["data_offsets"][0]) + offset,
                 static_cast<int64_t>(value["data_offsets"][1]) + offset);
         }
         TLLM_THROW("Tensor not found: " + std::string(name));
     }
+
+    void prefetch(std::vector<std::string> const& names) override
+    {
+        if (!mMapped)
+        {
+            return;
+        }
+        for (auto const& name : names)
+        {
+            auto const it = mTensorInfo.find(name);
+            if (it == mTensorInfo.end())
+            {
+                TLLM_THROW("Tensor not found: " + name);
+            }
+            int64_t const offset = mJsonSize + sizeof(mJsonSize);
+            mMapped->willNeed(static_cast<int64_t>(it->second["data_offsets"][0]) + offset,
+                static_cast<int64_t>(it->second["data_offsets"][1]) + offset);
+        }
+    }
 };
 
 std::shared_ptr<ISafeTensor> ISafeTensor::open(char const* filename)
@@ -21,7 +21,9 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace tensorrt_llm::common::safetensors
 {
@@ -55,6 +57,12 @@ public:
     static std::shared_ptr<ISafeTensor> open(char const* filename);
     virtual std::shared_ptr<INdArray> getTensor(char const* name) = 0;
     virtual std::vector<std::string> keys() = 0;
+
+    //! Ask the OS to start reading the data of the given tensors in the background, so that
+    //! subsequent data() calls find the pages in the page cache instead of faulting them in one
+    //! by one. No-op when the file could not be memory mapped.
+    virtual void prefetch(std::vector<std::string> const& /*names*/) {}
+
     virtual ~ISafeTensor() = default;
 };
 
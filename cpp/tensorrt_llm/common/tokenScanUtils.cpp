@@ -0,0 +1,220 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/tokenScanUtils.h"
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define TLLM_TOKEN_SCAN_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define TLLM_TOKEN_SCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace tensorrt_llm::common
+{
+
+namespace
+{
+
+// The hash is defined as kHashLanes interleaved 32-bit FNV-1a streams (lane i consumes tokens with
+// index congruent to i) folded together at the end. Interleaving is what makes the SIMD paths
+// possible — a single FNV chain is strictly sequential — and the scalar path follows the same lane
+// schedule so every path produces the same value.
+constexpr std::size_t kHashLanes = 8;
+constexpr std::uint32_t kFnvBasis = 2166136261u;
+constexpr std::uint32_t kFnvPrime = 16777619u;
+
+std::size_t foldHashLanes(std::uint32_t const (&lanes)[kHashLanes], std::size_t count)
+{
+    std::size_t seed = count;
+    for (auto const lane : lanes)
+    {
+        seed ^= lane + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+bool allTokensInRangeScalar(
+    std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (tokens[i] < lowerBound || tokens[i] >= upperBound)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::size_t hashTokensScalar(std::int32_t const* tokens, std::size_t count)
+{
+    std::uint32_t lanes[kHashLanes];
+    std::fill(std::begin(lanes), std::end(lanes), kFnvBasis);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto& lane = lanes[i % kHashLanes];
+        lane = (lane ^ static_cast<std::uint32_t>(tokens[i])) * kFnvPrime;
+    }
+    return foldHashLanes(lanes, count);
+}
+
+#if defined(TLLM_TOKEN_SCAN_X86)
+
+__attribute__((target("avx2"))) bool allTokensInRangeAvx2(
+    std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound)
+{
+    auto const lower = _mm256_set1_epi32(lowerBound);
+    auto const last = _mm256_set1_epi32(upperBound - 1);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        auto const vals = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(tokens + i));
+        auto const bad = _mm256_or_si256(_mm256_cmpgt_epi32(lower, vals), _mm256_cmpgt_epi32(vals, last));
+        if (!_mm256_testz_si256(bad, bad))
+        {
+            return false;
+        }
+    }
+    return allTokensInRangeScalar(tokens + i, count - i, lowerBound, upperBound);
+}
+
+__attribute__((target("avx512f"))) bool allTokensInRangeAvx512(
+    std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound)
+{
+    auto const lower = _mm512_set1_epi32(lowerBound);
+    auto const upper = _mm512_set1_epi32(upperBound);
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        auto const vals = _mm512_loadu_si512(tokens + i);
+        auto const bad = _mm512_cmp_epi32_mask(vals, lower, _MM_CMPINT_LT)
+            | _mm512_cmp_epi32_mask(vals, upper, _MM_CMPINT_NLT);
+        if (bad != 0)
+        {
+            return false;
+        }
+    }
+    return allTokensInRangeScalar(tokens + i, count - i, lowerBound, upperBound);
+}
+
+__attribute__((target("avx2"))) std::size_t hashTokensAvx2(std::int32_t const* tokens, std::size_t count)
+{
+    auto const prime = _mm256_set1_epi32(static_cast<std::int32_t>(kFnvPrime));
+    auto laneVec = _mm256_set1_epi32(static_cast<std::int32_t>(kFnvBasis));
+    std::size_t i = 0;
+    for (; i + kHashLanes <= count; i += kHashLanes)
+    {
+        auto const vals = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(tokens + i));
+        laneVec = _mm256_mullo_epi32(_mm256_xor_si256(laneVec, vals), prime);
+    }
+    alignas(32) std::uint32_t lanes[kHashLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), laneVec);
+    // i is a multiple of kHashLanes here, so tail token i + k belongs to lane k.
+    for (std::size_t k = 0; i + k < count; ++k)
+    {
+        lanes[k] = (lanes[k] ^ static_cast<std::uint32_t>(tokens[i + k])) * kFnvPrime;
+    }
+    return foldHashLanes(lanes, count);
+}
+
+#endif // TLLM_TOKEN_SCAN_X86
+
+#if defined(TLLM_TOKEN_SCAN_NEON)
+
+bool allTokensInRangeNeon(
+    std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound)
+{
+    auto const lower = vdupq_n_s32(lowerBound);
+    auto const upper = vdupq_n_s32(upperBound);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        auto const vals = vld1q_s32(tokens + i);
+        auto const bad = vorrq_u32(vcltq_s32(vals, lower), vcgeq_s32(vals, upper));
+        if (vmaxvq_u32(bad) != 0)
+        {
+            return false;
+        }
+    }
+    return allTokensInRangeScalar(tokens + i, count - i, lowerBound, upperBound);
+}
+
+std::size_t hashTokensNeon(std::int32_t const* tokens, std::size_t count)
+{
+    auto const prime = vdupq_n_u32(kFnvPrime);
+    // Two registers of four lanes each keep the eight-lane schedule of the scalar path.
+    uint32x4_t laneVecs[2] = {vdupq_n_u32(kFnvBasis), vdupq_n_u32(kFnvBasis)};
+    std::size_t i = 0;
+    for (; i + kHashLanes <= count; i += kHashLanes)
+    {
+        for (std::size_t half = 0; half < 2; ++half)
+        {
+            auto const vals = vreinterpretq_u32_s32(vld1q_s32(tokens + i + 4 * half));
+            laneVecs[half] = vmulq_u32(veorq_u32(laneVecs[half], vals), prime);
+        }
+    }
+    std::uint32_t lanes[kHashLanes];
+    vst1q_u32(lanes, laneVecs[0]);
+    vst1q_u32(lanes + 4, laneVecs[1]);
+    for (std::size_t k = 0; i + k < count; ++k)
+    {
+        lanes[k] = (lanes[k] ^ static_cast<std::uint32_t>(tokens[i + k])) * kFnvPrime;
+    }
+    return foldHashLanes(lanes, count);
+}
+
+#endif // TLLM_TOKEN_SCAN_NEON
+
+} // namespace
+
+bool allTokensInRange(std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound)
+{
+#if defined(TLLM_TOKEN_SCAN_X86)
+    static auto const impl = []
+    {
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return &allTokensInRangeAvx512;
+        }
+        return __builtin_cpu_supports("avx2") ? &allTokensInRangeAvx2 : &allTokensInRangeScalar;
+    }();
+    return impl(tokens, count, lowerBound, upperBound);
+#elif defined(TLLM_TOKEN_SCAN_NEON)
+    return allTokensInRangeNeon(tokens, count, lowerBound, upperBound);
+#else
+    return allTokensInRangeScalar(tokens, count, lowerBound, upperBound);
+#endif
+}
+
+std::size_t hashTokens(std::int32_t const* tokens, std::size_t count)
+{
+#if defined(TLLM_TOKEN_SCAN_X86)
+    static auto const impl = [] { return __builtin_cpu_supports("avx2") ? &hashTokensAvx2 : &hashTokensScalar; }();
+    return impl(tokens, count);
+#elif defined(TLLM_TOKEN_SCAN_NEON)
+    return hashTokensNeon(tokens, count);
+#else
+    return hashTokensScalar(tokens, count);
+#endif
+}
+
+} // namespace tensorrt_llm::common
@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace tensorrt_llm::common
+{
+
+//! Hot host-side scans over token-id vectors (enqueue validation, prompt interning). On x86-64 the
+//! implementations dispatch at first use to an AVX-512 or AVX2 path when the CPU supports it; on
+//! aarch64 they use NEON; otherwise a scalar loop. All paths return identical results for the same
+//! input, so callers never observe the dispatch.
+
+/// @brief Check that every token id lies in [lowerBound, upperBound). Returns true for count == 0.
+bool allTokensInRange(std::int32_t const* tokens, std::size_t count, std::int32_t lowerBound, std::int32_t upperBound);
+
+/// @brief Hash a token-id vector. Deterministic across the SIMD and scalar paths, but only
+/// meaningful within a process; do not persist the value.
+std::size_t hashTokens(std::int32_t const* tokens, std::size_t count);
+
+} // namespace tensorrt_llm::common
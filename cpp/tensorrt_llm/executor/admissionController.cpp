@@ -0,0 +1,154 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/admissionController.h"
+
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace tensorrt_llm::executor
+{
+
+namespace
+{
+//! Bucket key for requests that carry no client id.
+constexpr IdType kAnonymousTenant = std::numeric_limits<IdType>::max();
+
+IdType tenantKey(std::optional<IdType> const& clientId)
+{
+    return clientId.value_or(kAnonymousTenant);
+}
+} // namespace
+
+std::unique_ptr<AdmissionController> AdmissionController::createFromEnv()
+{
+    Limits limits;
+    limits.tokensPerSec = common::getEnvTenantTokensPerSec();
+    limits.tokenBurst = common::getEnvTenantTokenBurst();
+    limits.maxQueuedRequests = common::getEnvTenantMaxQueuedRequests();
+    if (limits.tokensPerSec <= 0. && limits.maxQueuedRequests == 0)
+    {
+        return nullptr;
+    }
+    TLLM_LOG_INFO("Admission control enabled: %.0f tokens/s, %.0f token burst, %zu queued requests per tenant",
+        limits.tokensPerSec, limits.tokenBurst, limits.maxQueuedRequests);
+    return std::make_unique<AdmissionController>(limits);
+}
+
+AdmissionController::AdmissionController(Limits const& limits)
+    : mLimits{limits}
+{
+    if (mLimits.tokenBurst <= 0.)
+    {
+        mLimits.tokenBurst = mLimits.tokensPerSec;
+    }
+}
+
+double AdmissionController::tokenCost(RequestWithId const& reqWithId)
+{
+    // Children sample their own outputs from the shared prompt.
+    auto const numOutputs = 1. + static_cast<double>(reqWithId.childReqIds.size());
+    return static_cast<double>(reqWithId.req.getInputTokenIds().size())
+        + numOutputs * static_cast<double>(reqWithId.req.getMaxTokens());
+}
+
+void AdmissionController::refill(TenantState& tenant, std::chrono::steady_clock::time_point now) const
+{
+    auto const elapsed = std::chrono::duration<double>(now - tenant.lastRefill).count();
+    tenant.tokens = std::min(mLimits.tokenBurst, tenant.tokens + elapsed * mLimits.tokensPerSec);
+    tenant.lastRefill = now;
+}
+
+AdmissionController::TenantState& AdmissionController::getTenant(
+    std::optional<IdType> const& clientId, std::chrono::steady_clock::time_point now)
+{
+    auto const [it, inserted] = mTenants.try_emplace(tenantKey(clientId), TenantState{mLimits.tokenBurst, now});
+    if (!inserted)
+    {
+        refill(it->second, now);
+    }
+    return it->second;
+}
+
+std::optional<std::string> AdmissionController::tryAdmit(std::vector<RequestWithId> const& requests)
+{
+    auto const now = std::chrono::steady_clock::now();
+
+    // Aggregate the batch per tenant, then check every tenant before charging any, so a rejection
+    // leaves the budgets untouched and the caller can fail the whole enqueue.
+    std::unordered_map<IdType, std::pair<double, std::size_t>> batchCost;
+    for (auto const& reqWithId : requests)
+    {
+        auto& [numTokens, numRequests] = batchCost[tenantKey(reqWithId.req.getClientId())];
+        numTokens += tokenCost(reqWithId);
+        numRequests += 1 + reqWithId.childReqIds.size();
+    }
+
+    for (auto const& [key, cost] : batchCost)
+    {
+        auto& tenant = getTenant(key, now);
+        if (mLimits.maxQueuedRequests > 0 && tenant.numQueued + cost.second > mLimits.maxQueuedRequests)
+        {
+            return common::fmtstr("Tenant queue depth limit of %zu requests has been reached, please try again later",
+                mLimits.maxQueuedRequests);
+        }
+        // Requests larger than the burst are admitted from a full bucket and drive it into debt,
+        // so the sustained rate still holds without making them impossible to admit.
+        if (mLimits.tokensPerSec > 0. && tenant.tokens < std::min(cost.first, mLimits.tokenBurst))
+        {
+            return common::fmtstr(
+                "Tenant token rate limit of %.0f tokens/s has been reached, please try again later",
+                mLimits.tokensPerSec);
+        }
+    }
+
+    for (auto const& [key, cost] : batchCost)
+    {
+        auto& tenant = mTenants.at(key);
+        if (mLimits.tokensPerSec > 0.)
+        {
+            tenant.tokens -= cost.first;
+        }
+        tenant.numQueued += cost.second;
+    }
+
+    if (mTenants.size() > kPruneThreshold)
+    {
+        for (auto it = mTenants.begin(); it != mTenants.end();)
+        {
+            refill(it->second, now);
+            it = it->second.numQueued == 0 && it->second.tokens >= mLimits.tokenBurst ? mTenants.erase(it)
+                                                                                      : std::next(it);
+        }
+    }
+    return std::nullopt;
+}
+
+void AdmissionController::onDequeued(std::optional<IdType> const& clientId, std::size_t numRequests)
+{
+    auto const it = mTenants.find(tenantKey(clientId));
+    if (it != mTenants.end())
+    {
+        it->second.numQueued -= std::min(it->second.numQueued, numRequests);
+    }
+}
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/requestWithId.h"
+#include "tensorrt_llm/executor/types.h"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief Per-tenant admission control enforced before requests enter the scheduling queue.
+/// @details Tenants are identified by the client id of a request; requests without one share an
+/// anonymous tenant. Each tenant gets a token bucket over the tokens a request asks for (input
+/// length plus max new tokens) and a bound on its queued request count, so one client flooding
+/// enqueueRequest cannot grow the queue the capacity scheduler has to walk for everyone else.
+/// Rejections happen at the queue boundary and are all-or-nothing per enqueue call, before any
+/// request of the call is queued.
+///
+/// The controller is not internally synchronized; like the queue it guards, all calls must hold
+/// the queued-request mutex.
+class AdmissionController
+{
+public:
+    struct Limits
+    {
+        /// @brief Sustained token admission rate per tenant; 0 disables rate shaping.
+        double tokensPerSec{0.};
+        /// @brief Token bucket capacity per tenant; 0 defaults to one second worth of rate.
+        double tokenBurst{0.};
+        /// @brief Maximum queued requests (including child requests) per tenant; 0 disables the bound.
+        std::size_t maxQueuedRequests{0};
+    };
+
+    /// @brief Create a controller from the TRTLLM_TENANT_* environment knobs.
+    /// @return The controller, or nullptr when no limit is configured.
+    static std::unique_ptr<AdmissionController> createFromEnv();
+
+    explicit AdmissionController(Limits const& limits);
+
+    /// @brief Admit a batch of requests about to be queued, charging the per-tenant budgets.
+    /// @return An error message suitable for a fast-fail response if any tenant of the batch is
+    /// over its limits; nothing is charged in that case.
+    [[nodiscard]] std::optional<std::string> tryAdmit(std::vector<RequestWithId> const& requests);
+
+    /// @brief Release queue depth when admitted requests leave the queue for the model.
+    void onDequeued(std::optional<IdType> const& clientId, std::size_t numRequests);
+
+private:
+    struct TenantState
+    {
+        double tokens;
+        std::chrono::steady_clock::time_point lastRefill;
+        std::size_t numQueued{0};
+    };
+
+    //! Tenant count above which idle tenants are pruned on admission, bounding the map under
+    //! client-id churn.
+    static constexpr std::size_t kPruneThreshold{4096};
+
+    TenantState& getTenant(std::optional<IdType> const& clientId, std::chrono::steady_clock::time_point now);
+    void refill(TenantState& tenant, std::chrono::steady_clock::time_point now) const;
+    static double tokenCost(RequestWithId const& reqWithId);
+
+    Limits mLimits;
+    //! Keyed by client id; the anonymous tenant uses a reserved key.
+    std::unordered_map<IdType, TenantState> mTenants;
+};
+
+} // namespace tensorrt_llm::executor
@@ -18,6 +18,8 @@
 #include "connection.h"
 #include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/executor/cache_transmission/cacheSplitConcat.h"
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <unistd.h>
 
@@ -98,36 +100,174 @@ size_t MemoryDesc::serializedSize(MemoryDesc const& memoryDesc)
         + su::serializedSize(memoryDesc.mDeviceId);
 }
 
+void AgentConnection::writeToReceiver(void const* data, size_t size, size_t dstOffset) const
+{
+    if (mSenderState.mPeerIpcPtr != nullptr)
+    {
+        // Same-host fast path: the receiver's buffer is mapped into this process, so the payload
+        // moves as a plain device-to-device copy over NVLink/PCIe instead of the RDMA stack.
+        TLLM_LOG_DEBUG("send via CUDA IPC dst: %p, size: %ld ,validSegmentIdx: %ld",
+            static_cast<char*>(mSenderState.mPeerIpcPtr) + dstOffset, size, mSenderState.validSegmentIdx);
+        TLLM_CUDA_CHECK(cudaMemcpy(
+            static_cast<char*>(mSenderState.mPeerIpcPtr) + dstOffset, data, size, cudaMemcpyDeviceToDevice));
+    }
+    else
+    {
+        MemoryDesc srcDesc{
+            reinterpret_cast<uintptr_t>(data), size, static_cast<uint32_t>(mAgentConnectionManager->getDeviceId())};
+        MemoryDescs srcDescs{MemoryType::kVRAM, {srcDesc}};
+        auto dstBaseDesc = mSenderState.mCacheReceiverBufferDesc;
+        MemoryDesc dstDesc{dstBaseDesc.getAddr() + dstOffset, size, dstBaseDesc.getDeviceId()};
+        TLLM_LOG_DEBUG(
+            "send dstDesc: %p, size: %ld ,validSegmentIdx: %ld", dstDesc.getAddr(), size, mSenderState.validSegmentIdx);
+        MemoryDescs dstDescs{MemoryType::kVRAM, {dstDesc}};
+        TransferRequest request{TransferOp::kWRITE, srcDescs, dstDescs, mRemoteAgentName};
+        auto status = mAgentConnectionManager->getAgent()->submitTransferRequests(request);
+        status->wait();
+    }
+}
+
 void AgentConnection::send(DataContext const& ctx, void const* data, size_t size) const
 {
 
-    MemoryDesc srcDesc{
-        reinterpret_cast<uintptr_t>(data), size, static_cast<uint32_t>(mAgentConnectionManager->getDeviceId())};
-    MemoryDescs srcDescs{MemoryType::kVRAM, {srcDesc}};
-    auto dstBaseDesc = mSenderState.mCacheReceiverBufferDesc;
     auto offset = size / mSenderState.mOffsetRatio.second * mSenderState.mOffsetRatio.first;
-    MemoryDesc dstDesc{dstBaseDesc.getAddr() + offset, size, dstBaseDesc.getDeviceId()};
-    TLLM_LOG_DEBUG(
-        "send dstDesc: %p, size: %ld ,validSegmentIdx: %ld", dstDesc.getAddr(), size, mSenderState.validSegmentIdx);
-    MemoryDescs dstDescs{MemoryType::kVRAM, {dstDesc}};
-    TransferRequest request{TransferOp::kWRITE, srcDescs, dstDescs, mRemoteAgentName};
-    auto status = mAgentConnectionManager->getAgent()->submitTransferRequests(request);
+    auto const chunkMb = common::getEnvKVCacheTransferChunkMb();
+    if (chunkMb > 0)
+    {
+        sendResumable(ctx, data, size, offset, chunkMb << 20);
+        return;
+    }
+    writeToReceiver(data, size, offset);
     NotificationSyncInfo syncInfo{mRemoteAgentName, ctx};
     NotificationInfo notificationInfo{syncInfo};
     std::stringstream ss;
     NotificationInfo::serialize(notificationInfo, ss);
-    status->wait();
     // TODO: there is a bug in request_with_notify https://github.com/ai-dynamo/nixl/pull/252
     mAgentConnectionManager->getAgent()->notifySyncMessage(mRemoteAgentName, ss.str());
 }
 
+void AgentConnection::sendResumable(
+    DataContext const& ctx, void const* data, size_t size, size_t offset, size_t chunkBytes) const
+{
+    // The acknowledgment bitmap is a single word, so cap the chunk count and grow the chunks
+    // instead when the payload is large.
+    constexpr uint64_t kMaxChunks = 64;
+    uint64_t const chunkCount = std::max<uint64_t>(1, std::min(kMaxChunks, (size + chunkBytes - 1) / chunkBytes));
+    size_t const bytesPerChunk = (size + chunkCount - 1) / chunkCount;
+    uint64_t const fullBitmap = chunkCount == kMaxChunks ? ~uint64_t{0} : (uint64_t{1} << chunkCount) - 1;
+    auto const maxAttempts = common::getEnvKVCacheTransferMaxRetries() + 1;
+    auto const ackTimeout = std::chrono::milliseconds(common::getEnvKVCacheTransferAckTimeoutMs());
+
+    uint64_t ackedBitmap = 0;
+    for (size_t attempt = 1;; ++attempt)
+    {
+        try
+        {
+            for (uint64_t chunkIdx = 0; chunkIdx < chunkCount; ++chunkIdx)
+            {
+                if ((ackedBitmap >> chunkIdx) & 1)
+                {
+                    continue;
+                }
+                auto const chunkOffset = chunkIdx * bytesPerChunk;
+                auto const chunkSize = std::min(bytesPerChunk, size - chunkOffset);
+                writeToReceiver(static_cast<char const*>(data) + chunkOffset, chunkSize, offset + chunkOffset);
+                ChunkSyncInfo chunkInfo{mRemoteAgentName, ctx, chunkIdx, chunkCount};
+                NotificationInfo notificationInfo{chunkInfo};
+                std::stringstream ss;
+                NotificationInfo::serialize(notificationInfo, ss);
+                mAgentConnectionManager->getAgent()->notifySyncMessage(mRemoteAgentName, ss.str());
+            }
+        }
+        catch (std::exception const& e)
+        {
+            // Keep the chunks that already went out; the receiver's acknowledgment below tells us
+            // where to resume.
+            TLLM_LOG_WARNING("Resumable cache transfer to %s failed on attempt %zu: %s", mRemoteAgentName.c_str(),
+                attempt, e.what());
+        }
+        auto const deadline = std::chrono::steady_clock::now() + ackTimeout;
+        while (ackedBitmap != fullBitmap)
+        {
+            auto const remaining
+                = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (remaining.count() <= 0)
+            {
+                break;
+            }
+            TransferAckInfo ackInfo{mAgentName, ctx, 0, 0};
+            if (!mAgentConnectionManager->waitForNotificationFor(mRemoteAgentName, ackInfo, remaining))
+            {
+                break;
+            }
+            ackedBitmap |= ackInfo.mReceivedBitmap;
+        }
+        if (ackedBitmap == fullBitmap)
+        {
+            return;
+        }
+        TLLM_CHECK_WITH_INFO(attempt < maxAttempts,
+            "Resumable cache transfer to %s incomplete after %zu attempts, %d of %zu chunks acknowledged",
+            mRemoteAgentName.c_str(), attempt, static_cast<int>(__builtin_popcountll(ackedBitmap)), static_cast<size_t>(chunkCount));
+        TLLM_LOG_WARNING("Resumable cache transfer to %s stalled with %d of %zu chunks acknowledged, resending the "
+                         "remainder (attempt %zu)",
+            mRemoteAgentName.c_str(), static_cast<int>(__builtin_popcountll(ackedBitmap)), static_cast<size_t>(chunkCount), attempt + 1);
+    }
+}
+
 void AgentConnection::recv(DataContext const& ctx, void* data, size_t size) const
 {
 
+    if (common::getEnvKVCacheTransferChunkMb() > 0)
+    {
+        recvResumable(ctx);
+        return;
+    }
     NotificationSyncInfo syncInfo{mAgentName, ctx};
     mAgentConnectionManager->waitForSyncInfo(mRemoteAgentName, syncInfo);
 }
 
+void AgentConnection::recvResumable(DataContext const& ctx) const
+{
+    auto const ackTimeout = std::chrono::milliseconds(common::getEnvKVCacheTransferAckTimeoutMs());
+    uint64_t receivedBitmap = 0;
+    uint64_t chunkCount = 0;
+    auto isComplete = [&]()
+    {
+        if (chunkCount == 0)
+        {
+            return false;
+        }
+        uint64_t const fullBitmap = chunkCount == 64 ? ~uint64_t{0} : (uint64_t{1} << chunkCount) - 1;
+        return receivedBitmap == fullBitmap;
+    };
+    while (!isComplete())
+    {
+        ChunkSyncInfo chunkInfo{mAgentName, ctx, 0, 0};
+        if (mAgentConnectionManager->waitForNotificationFor(mRemoteAgentName, chunkInfo, ackTimeout))
+        {
+            chunkCount = chunkInfo.mChunkCount;
+            receivedBitmap |= uint64_t{1} << chunkInfo.mChunkIdx;
+        }
+        else if (receivedBitmap != 0)
+        {
+            // Stalled mid-transfer: re-advertise the progress so a retrying sender resumes from
+            // the missing chunks instead of restarting.
+            sendTransferAck(ctx, receivedBitmap, chunkCount);
+        }
+    }
+    sendTransferAck(ctx, receivedBitmap, chunkCount);
+}
+
+void AgentConnection::sendTransferAck(DataContext const& ctx, uint64_t receivedBitmap, uint64_t chunkCount) const
+{
+    TransferAckInfo ackInfo{mRemoteAgentName, ctx, receivedBitmap, chunkCount};
+    NotificationInfo notificationInfo{ackInfo};
+    std::stringstream ss;
+    NotificationInfo::serialize(notificationInfo, ss);
+    mAgentConnectionManager->getAgent()->notifySyncMessage(mRemoteAgentName, ss.str());
+}
+
 void AgentConnection::sendRequestAndBufferInfo(
     batch_manager::RequestInfo& requestInfo, std::optional<size_t> cacheBufferId, int validConnectionIdx)
 {
@@ -152,21 +292,27 @@ void AgentConnection::sendRequestAndBufferInfo(
         metadataOpt = metadata;
         mNeedSendMetadata = false;
     }
+    std::optional<std::string> ipcHandleOpt = std::nullopt;
+    if (common::getEnvKVCacheTransferSameHostIpc())
+    {
+        ipcHandleOpt = mAgentConnectionManager->exportIpcHandle(preAllocateBuffer->data());
+    }
 
-    RequestAndBufferInfo requestAndBufferInfo{
-        mAgentName, address, requestInfo, bufferDesc, metadataOpt, validConnectionIdx};
+    RequestAndBufferInfo requestAndBufferInfo{mAgentName, address, requestInfo, bufferDesc, metadataOpt,
+        validConnectionIdx, mAgentConnectionManager->getHostName(), ipcHandleOpt};
     std::stringstream ss;
     NotificationInfo notificationInfo{requestAndBufferInfo};
     NotificationInfo::serialize(notificationInfo, ss);
     mAgentConnectionManager->getAgent()->notifySyncMessage(mRemoteAgentName, ss.str());
 }
 
-void AgentConnection::setSenderState(
-    MemoryDesc mCacheReceiverBufferDesc, int validSegmentIdx, std::pair<size_t, size_t> offsetRatio)
+void AgentConnection::setSenderState(MemoryDesc mCacheReceiverBufferDesc, int validSegmentIdx,
+    std::pair<size_t, size_t> offsetRatio, void* peerIpcPtr)
 {
     mSenderState.mCacheReceiverBufferDesc = mCacheReceiverBufferDesc;
     mSenderState.validSegmentIdx = validSegmentIdx;
     mSenderState.mOffsetRatio = offsetRatio;
+    mSenderState.mPeerIpcPtr = peerIpcPtr;
 }
 
 void AgentConnection::setHasLoadRemoteAgent(bool hasLoadRemoteAgent)
@@ -205,6 +351,9 @@ AgentConnectionManager::AgentConnectionManager(
     TLLM_CHECK(mDeviceId != -1);
 
     mAgentName = genUniqueAgentName();
+    char hostname[1024];
+    gethostname(hostname, sizeof(hostname));
+    mHostName = hostname;
     // Create Agent
     BaseAgentConfig config{mAgentName, true};
     m_Agent = makeTransferAgent("nixl", &config);
@@ -305,7 +454,14 @@ AgentConnection const* AgentConnectionManager::recvConnectionAndRequestInfo(batc
                     // to compute the offset.
                     auto offsetRatio = computeSendOffsetRatio(requestInfo.getTransState().getCacheState().value(),
                         requestInfo.getTransState().getCommState()->getSelfIdx(), mCacheState, validConnectionIdx);
-                    connection->setSenderState(bufferDesc, validConnectionIdx, offsetRatio);
+                    // Capability probe: a co-located receiver that exported its buffer gets a
+                    // direct CUDA IPC mapping; every other peer stays on the transfer agent.
+                    void* peerIpcPtr = nullptr;
+                    if (requestAndBufferInfo.mIpcHandle.has_value() && requestAndBufferInfo.mHostName == mHostName)
+                    {
+                        peerIpcPtr = openIpcHandle(requestAndBufferInfo.mIpcHandle.value());
+                    }
+                    connection->setSenderState(bufferDesc, validConnectionIdx, offsetRatio, peerIpcPtr);
                     notifIt = notifs.erase(notifIt);
                     if (notifs.empty())
                     {
@@ -449,6 +605,16 @@ int AgentConnectionManager::getDeviceId() const
 template <typename NotificationType>
 void AgentConnectionManager::waitForNotification(std::string const& remoteAgentName, NotificationType& expectedInfo)
 {
+    waitForNotificationFor(remoteAgentName, expectedInfo, std::chrono::milliseconds::max());
+}
+
+template <typename NotificationType>
+bool AgentConnectionManager::waitForNotificationFor(
+    std::string const& remoteAgentName, NotificationType& expectedInfo, std::chrono::milliseconds timeout)
+{
+    bool const bounded = timeout != std::chrono::milliseconds::max();
+    auto const deadline
+        = bounded ? std::chrono::steady_clock::now() + timeout : std::chrono::steady_clock::time_point::max();
     while (true)
     {
 
@@ -469,42 +635,22 @@ void AgentConnectionManager::waitForNotification(std::string const& remoteAgentN
                 std::stringstream ss(*notifIt);
                 NotificationInfo notificationInfo = NotificationInfo::deserialize(ss);
                 bool erase = false;
-                if constexpr (std::is_same_v<NotificationType, NotificationSyncInfo>)
-                {
-                    if (std::holds_alternative<NotificationSyncInfo>(notificationInfo.mInfo))
-                    {
-                        auto notificationData = std::get<NotificationSyncInfo>(notificationInfo.mInfo);
-                        if (notificationData.mContext.getTag() == expectedInfo.mContext.getTag()
-                            && notificationData.mAgentName == expectedInfo.mAgentName)
-                        {
-                            erase = true;
-                            notifIt = notifs.erase(notifIt);
-                            if (notifs.empty())
-                            {
-                                it = mUnhandledNotifications.erase(it);
-                            }
-                            return;
-                        }
-                    }
-                }
-                else if constexpr (std::is_same_v<NotificationType, ReadySignalInfo>)
+                // All awaitable notification types carry the destination agent name and the context
+                // tag; the copy assignment hands any extra fields back to the waiter.
+                if (std::holds_alternative<NotificationType>(notificationInfo.mInfo))
                 {
-                    if (std::holds_alternative<ReadySignalInfo>(notificationInfo.mInfo))
+                    auto notificationData = std::get<NotificationType>(notificationInfo.mInfo);
+                    if (notificationData.mContext.getTag() == expectedInfo.mContext.getTag()
+                        && notificationData.mAgentName == expectedInfo.mAgentName)
                     {
-                        auto readySignalData = std::get<ReadySignalInfo>(notificationInfo.mInfo);
-                        if (readySignalData.mContext.getTag() == expectedInfo.mContext.getTag()
-                            && readySignalData.mAgentName == expectedInfo.mAgentName)
+                        expectedInfo = notificationData;
+                        erase = true;
+                        notifIt = notifs.erase(notifIt);
+                        if (notifs.empty())
                         {
-                            expectedInfo.mIsReady = readySignalData.mIsReady;
-
-                            erase = true;
-                            notifIt = notifs.erase(notifIt);
-                            if (notifs.empty())
-                            {
-                                it = mUnhandledNotifications.erase(it);
-                            }
-                            return;
+                            it = mUnhandledNotifications.erase(it);
                         }
+                        return true;
                     }
                 }
 
@@ -522,6 +668,10 @@ void AgentConnectionManager::waitForNotification(std::string const& remoteAgentN
                 it++;
             }
         }
+        if (bounded && std::chrono::steady_clock::now() >= deadline)
+        {
+            return false;
+        }
     }
 }
 
@@ -530,6 +680,14 @@ template void AgentConnectionManager::waitForNotification<NotificationSyncInfo>(
     std::string const& remoteAgentName, NotificationSyncInfo& expectedInfo);
 template void AgentConnectionManager::waitForNotification<ReadySignalInfo>(
     std::string const& remoteAgentName, ReadySignalInfo& expectedInfo);
+template bool AgentConnectionManager::waitForNotificationFor<NotificationSyncInfo>(
+    std::string const& remoteAgentName, NotificationSyncInfo& expectedInfo, std::chrono::milliseconds timeout);
+template bool AgentConnectionManager::waitForNotificationFor<ReadySignalInfo>(
+    std::string const& remoteAgentName, ReadySignalInfo& expectedInfo, std::chrono::milliseconds timeout);
+template bool AgentConnectionManager::waitForNotificationFor<ChunkSyncInfo>(
+    std::string const& remoteAgentName, ChunkSyncInfo& expectedInfo, std::chrono::milliseconds timeout);
+template bool AgentConnectionManager::waitForNotificationFor<TransferAckInfo>(
+    std::string const& remoteAgentName, TransferAckInfo& expectedInfo, std::chrono::milliseconds timeout);
 
 void AgentConnectionManager::waitForSyncInfo(std::string const& remoteAgentName, NotificationSyncInfo& syncInfo)
 {
@@ -546,9 +704,67 @@ std::string const& AgentConnectionManager::getAgentName() const
     return mAgentName;
 }
 
+std::string const& AgentConnectionManager::getHostName() const
+{
+    return mHostName;
+}
+
+std::optional<std::string> AgentConnectionManager::exportIpcHandle(void* ptr)
+{
+    std::scoped_lock lock(mIpcMutex);
+    auto it = mExportedIpcHandles.find(ptr);
+    if (it != mExportedIpcHandles.end())
+    {
+        return it->second;
+    }
+    cudaIpcMemHandle_t handle;
+    std::optional<std::string> handleOpt = std::nullopt;
+    if (cudaIpcGetMemHandle(&handle, ptr) == cudaSuccess)
+    {
+        handleOpt = std::string(reinterpret_cast<char const*>(&handle), sizeof(handle));
+    }
+    else
+    {
+        // Pool-backed allocations are not exportable; clear the error and stay on the agent path.
+        cudaGetLastError();
+        TLLM_LOG_DEBUG("Cache transfer buffer %p is not CUDA IPC exportable, same-host IPC disabled for it", ptr);
+    }
+    mExportedIpcHandles.emplace(ptr, handleOpt);
+    return handleOpt;
+}
+
+void* AgentConnectionManager::openIpcHandle(std::string const& handleBytes)
+{
+    TLLM_CHECK(handleBytes.size() == sizeof(cudaIpcMemHandle_t));
+    std::scoped_lock lock(mIpcMutex);
+    auto it = mOpenedIpcHandles.find(handleBytes);
+    if (it != mOpenedIpcHandles.end())
+    {
+        return it->second;
+    }
+    cudaIpcMemHandle_t handle;
+    std::memcpy(&handle, handleBytes.data(), sizeof(handle));
+    void* ptr = nullptr;
+    if (cudaIpcOpenMemHandle(&ptr, handle, cudaIpcMemHandleLazyEnablePeerAccess) != cudaSuccess)
+    {
+        cudaGetLastError();
+        TLLM_LOG_WARNING("Failed to open peer CUDA IPC handle, falling back to the transfer agent");
+        ptr = nullptr;
+    }
+    mOpenedIpcHandles.emplace(handleBytes, ptr);
+    return ptr;
+}
+
 AgentConnectionManager::~AgentConnectionManager()
 {
     // TODO: invalideRemoteAgent
+    for (auto const& [handleBytes, ptr] : mOpenedIpcHandles)
+    {
+        if (ptr != nullptr)
+        {
+            cudaIpcCloseMemHandle(ptr);
+        }
+    }
     m_Agent->deregisterMemory(mRegMemDescs);
 }
 } // namespace tensorrt_llm::executor::kv_cache
@@ -24,6 +24,7 @@
 #include "tensorrt_llm/executor/cacheCommunicator.h"
 #include "tensorrt_llm/executor/dataTransceiverState.h"
 #include "tensorrt_llm/executor/transferAgent.h"
+#include <chrono>
 #include <map>
 
 namespace tensorrt_llm::executor::kv_cache
@@ -36,6 +37,10 @@ struct RequestAndBufferInfo
     MemoryDesc mBufferDesc;
     std::optional<std::string> mMetadata;
     int mValidConnectionIdx;
+    // Host the receiver runs on and the CUDA IPC handle of its buffer, so a same-host sender can
+    // write the cache directly instead of going through the transfer agent.
+    std::string mHostName;
+    std::optional<std::string> mIpcHandle;
 
     static void serialize(RequestAndBufferInfo const& requestAndBufferInfo, std::ostream& os)
     {
@@ -46,6 +51,8 @@ struct RequestAndBufferInfo
         MemoryDesc::serialize(requestAndBufferInfo.mBufferDesc, os);
         su::serialize(requestAndBufferInfo.mMetadata, os);
         su::serialize(requestAndBufferInfo.mValidConnectionIdx, os);
+        su::serialize(requestAndBufferInfo.mHostName, os);
+        su::serialize(requestAndBufferInfo.mIpcHandle, os);
     }
 
     static RequestAndBufferInfo deserialize(std::istream& is)
@@ -57,7 +64,10 @@ struct RequestAndBufferInfo
         auto bufferDesc = MemoryDesc::deserialize(is);
         auto metadata = su::deserialize<decltype(mMetadata)>(is);
         auto validConnectionIdx = su::deserialize<decltype(mValidConnectionIdx)>(is);
-        return RequestAndBufferInfo{agentName, address, requestInfo, bufferDesc, metadata, validConnectionIdx};
+        auto hostName = su::deserialize<decltype(mHostName)>(is);
+        auto ipcHandle = su::deserialize<decltype(mIpcHandle)>(is);
+        return RequestAndBufferInfo{
+            agentName, address, requestInfo, bufferDesc, metadata, validConnectionIdx, hostName, ipcHandle};
     }
 
     static size_t serializedSize(RequestAndBufferInfo const& requestAndBufferInfo)
@@ -67,7 +77,9 @@ struct RequestAndBufferInfo
             + batch_manager::RequestInfo::serializedSize(requestAndBufferInfo.mRequestInfo)
             + MemoryDesc::serializedSize(requestAndBufferInfo.mBufferDesc)
             + su::serializedSize(requestAndBufferInfo.mMetadata)
-            + su::serializedSize(requestAndBufferInfo.mValidConnectionIdx);
+            + su::serializedSize(requestAndBufferInfo.mValidConnectionIdx)
+            + su::serializedSize(requestAndBufferInfo.mHostName)
+            + su::serializedSize(requestAndBufferInfo.mIpcHandle);
     }
 };
 
@@ -133,10 +145,86 @@ struct NotificationSyncInfo
     }
 };
 
+//! Per-chunk completion notice of a resumable transfer: the sender has placed chunk mChunkIdx of
+//! mChunkCount for the transfer identified by the context tag.
+struct ChunkSyncInfo
+{
+
+    std::string mAgentName;
+    DataContext mContext;
+    uint64_t mChunkIdx;
+    uint64_t mChunkCount;
+
+    static void serialize(ChunkSyncInfo const& chunkSyncInfo, std::ostream& os)
+    {
+        namespace su = executor::serialize_utils;
+        su::serialize(chunkSyncInfo.mAgentName, os);
+        su::serialize(chunkSyncInfo.mContext.getTag(), os);
+        su::serialize(chunkSyncInfo.mChunkIdx, os);
+        su::serialize(chunkSyncInfo.mChunkCount, os);
+    }
+
+    static ChunkSyncInfo deserialize(std::istream& is)
+    {
+        namespace su = executor::serialize_utils;
+        auto agentName = su::deserialize<decltype(mAgentName)>(is);
+        auto contextTag = su::deserialize<decltype(mContext.getTag())>(is);
+        DataContext context{contextTag};
+        auto chunkIdx = su::deserialize<decltype(mChunkIdx)>(is);
+        auto chunkCount = su::deserialize<decltype(mChunkCount)>(is);
+        return ChunkSyncInfo{agentName, context, chunkIdx, chunkCount};
+    }
+
+    static size_t serializedSize(ChunkSyncInfo const& chunkSyncInfo)
+    {
+        namespace su = executor::serialize_utils;
+        return su::serializedSize(chunkSyncInfo.mAgentName) + su::serializedSize(chunkSyncInfo.mContext.getTag())
+            + su::serializedSize(chunkSyncInfo.mChunkIdx) + su::serializedSize(chunkSyncInfo.mChunkCount);
+    }
+};
+
+//! Receiver-side acknowledgment of a resumable transfer: bit i of mReceivedBitmap is set once the
+//! notice for chunk i has arrived, so a retrying sender resumes from the unacknowledged remainder.
+struct TransferAckInfo
+{
+
+    std::string mAgentName;
+    DataContext mContext;
+    uint64_t mReceivedBitmap;
+    uint64_t mChunkCount;
+
+    static void serialize(TransferAckInfo const& transferAckInfo, std::ostream& os)
+    {
+        namespace su = executor::serialize_utils;
+        su::serialize(transferAckInfo.mAgentName, os);
+        su::serialize(transferAckInfo.mContext.getTag(), os);
+        su::serialize(transferAckInfo.mReceivedBitmap, os);
+        su::serialize(transferAckInfo.mChunkCount, os);
+    }
+
+    static TransferAckInfo deserialize(std::istream& is)
+    {
+        namespace su = executor::serialize_utils;
+        auto agentName = su::deserialize<decltype(mAgentName)>(is);
+        auto contextTag = su::deserialize<decltype(mContext.getTag())>(is);
+        DataContext context{contextTag};
+        auto receivedBitmap = su::deserialize<decltype(mReceivedBitmap)>(is);
+        auto chunkCount = su::deserialize<decltype(mChunkCount)>(is);
+        return TransferAckInfo{agentName, context, receivedBitmap, chunkCount};
+    }
+
+    static size_t serializedSize(TransferAckInfo const& transferAckInfo)
+    {
+        namespace su = executor::serialize_utils;
+        return su::serializedSize(transferAckInfo.mAgentName) + su::serializedSize(transferAckInfo.mContext.getTag())
+            + su::serializedSize(transferAckInfo.mReceivedBitmap) + su::serializedSize(transferAckInfo.mChunkCount);
+    }
+};
+
 struct NotificationInfo
 {
 
-    std::variant<RequestAndBufferInfo, NotificationSyncInfo, ReadySignalInfo> mInfo;
+    std::variant<RequestAndBufferInfo, NotificationSyncInfo, ReadySignalInfo, ChunkSyncInfo, TransferAckInfo> mInfo;
 
     static void serialize(NotificationInfo const& notificationInfo, std::ostream& os)
     {
@@ -154,6 +242,14 @@ struct NotificationInfo
         {
             ReadySignalInfo::serialize(std::get<ReadySignalInfo>(notificationInfo.mInfo), os);
         }
+        else if (std::holds_alternative<ChunkSyncInfo>(notificationInfo.mInfo))
+        {
+            ChunkSyncInfo::serialize(std::get<ChunkSyncInfo>(notificationInfo.mInfo), os);
+        }
+        else if (std::holds_alternative<TransferAckInfo>(notificationInfo.mInfo))
+        {
+            TransferAckInfo::serialize(std::get<TransferAckInfo>(notificationInfo.mInfo), os);
+        }
         else
         {
             TLLM_THROW("Unknown variant type");
@@ -167,6 +263,8 @@ struct NotificationInfo
         constexpr std::size_t requestAndBufferInfoIdx{0};
         constexpr std::size_t notificationSyncInfoIdx{1};
         constexpr std::size_t readySignalInfoIdx{2};
+        constexpr std::size_t chunkSyncInfoIdx{3};
+        constexpr std::size_t transferAckInfoIdx{4};
         if (variantIdx == requestAndBufferInfoIdx)
         {
             return NotificationInfo{RequestAndBufferInfo::deserialize(is)};
@@ -179,6 +277,14 @@ struct NotificationInfo
         {
             return NotificationInfo{ReadySignalInfo::deserialize(is)};
         }
+        else if (variantIdx == chunkSyncInfoIdx)
+        {
+            return NotificationInfo{ChunkSyncInfo::deserialize(is)};
+        }
+        else if (variantIdx == transferAckInfoIdx)
+        {
+            return NotificationInfo{TransferAckInfo::deserialize(is)};
+        }
         else
         {
             TLLM_THROW("Unknown variant type");
@@ -202,6 +308,14 @@ struct NotificationInfo
         {
             totalSize += ReadySignalInfo::serializedSize(std::get<ReadySignalInfo>(notificationInfo.mInfo));
         }
+        else if (std::holds_alternative<ChunkSyncInfo>(notificationInfo.mInfo))
+        {
+            totalSize += ChunkSyncInfo::serializedSize(std::get<ChunkSyncInfo>(notificationInfo.mInfo));
+        }
+        else if (std::holds_alternative<TransferAckInfo>(notificationInfo.mInfo))
+        {
+            totalSize += TransferAckInfo::serializedSize(std::get<TransferAckInfo>(notificationInfo.mInfo));
+        }
         else
         {
             TLLM_THROW("Unknown variant type");
@@ -220,8 +334,8 @@ public:
     void recv(DataContext const& ctx, void* data, size_t size) const override;
     void sendRequestAndBufferInfo(
         batch_manager::RequestInfo& requestInfo, std::optional<size_t> cacheBufferId, int validConnectionIdx);
-    void setSenderState(
-        MemoryDesc mCacheReceiverBufferDesc, int valideSegmentIdx, std::pair<size_t, size_t> offsetRatio);
+    void setSenderState(MemoryDesc mCacheReceiverBufferDesc, int valideSegmentIdx,
+        std::pair<size_t, size_t> offsetRatio, void* peerIpcPtr);
     [[nodiscard]] std::optional<size_t> getCacheBufferId() const;
     void setHasLoadRemoteAgent(bool hasLoadRemoteAgent);
     [[nodiscard]] bool hasLoadRemoteAgent() const;
@@ -229,6 +343,15 @@ public:
     bool recvReadySignal(DataContext const& ctx) const;
 
 private:
+    //! Chunked send with receiver bitmap acknowledgment; retried attempts resume from the
+    //! unacknowledged chunks. Used instead of the single-shot path when a chunk size is configured.
+    void sendResumable(DataContext const& ctx, void const* data, size_t size, size_t offset, size_t chunkBytes) const;
+    void recvResumable(DataContext const& ctx) const;
+    void sendTransferAck(DataContext const& ctx, uint64_t receivedBitmap, uint64_t chunkCount) const;
+    //! Writes one contiguous range of the payload to the receiver buffer, via CUDA IPC when the
+    //! peer mapping is available and through the transfer agent otherwise.
+    void writeToReceiver(void const* data, size_t size, size_t dstOffset) const;
+
     std::string mAgentName;
     std::string mRemoteAgentName;
 
@@ -237,6 +360,8 @@ private:
         MemoryDesc mCacheReceiverBufferDesc{nullptr, 0, 0};
         int validSegmentIdx{0};
         std::pair<size_t, size_t> mOffsetRatio;
+        // Receiver buffer mapped into this process via CUDA IPC; nullptr keeps the agent path.
+        void* mPeerIpcPtr{nullptr};
         SenderState() = default;
     };
 
@@ -266,9 +391,20 @@ public:
         std::optional<std::string> metadata = std::nullopt, bool isSender = false);
     int getDeviceId() const;
     [[nodiscard]] std::string const& getAgentName() const;
+    [[nodiscard]] std::string const& getHostName() const;
+    // Returns the CUDA IPC handle bytes for a registered transfer buffer, or nullopt when the
+    // allocation cannot be exported (e.g. pool-backed memory). Results are cached per buffer.
+    std::optional<std::string> exportIpcHandle(void* ptr);
+    // Maps a peer buffer described by exportIpcHandle() bytes; returns nullptr when opening fails.
+    void* openIpcHandle(std::string const& handleBytes);
 
     template <typename NotificationType>
     void waitForNotification(std::string const& remoteAgentName, NotificationType& expectedInfo);
+    //! Like waitForNotification, but gives up once \p timeout has elapsed without a matching
+    //! notification and returns whether one was consumed.
+    template <typename NotificationType>
+    bool waitForNotificationFor(
+        std::string const& remoteAgentName, NotificationType& expectedInfo, std::chrono::milliseconds timeout);
     void waitForSyncInfo(std::string const& remoteAgentName, NotificationSyncInfo& syncInfo);
     void waitForReadySignal(std::string const& remoteAgentName, ReadySignalInfo& readySignalInfo);
 
@@ -283,7 +419,11 @@ private:
     std::unique_ptr<BaseTransferAgent> m_Agent;
     int mDeviceId;
     std::string mAgentName;
+    std::string mHostName;
     MemoryDescs mRegMemDescs;
+    std::mutex mIpcMutex;
+    std::map<void const*, std::optional<std::string>> mExportedIpcHandles;
+    std::map<std::string, void*> mOpenedIpcHandles;
 };
 
 } // namespace tensorrt_llm::executor::kv_cache
@@ -77,10 +77,11 @@ std::optional<bool> ExternalDraftTokensConfig::getFastLogits() const
 }
 
 LookaheadDecodingConfig::LookaheadDecodingConfig(
-    SizeType32 windowSize, SizeType32 ngramSize, SizeType32 verificationSetSize)
+    SizeType32 windowSize, SizeType32 ngramSize, SizeType32 verificationSetSize, bool usePoolCache)
     : mWindowSize(windowSize)
     , mNgramSize(ngramSize)
     , mVerificationSetSize(verificationSetSize)
+    , mUsePoolCache(usePoolCache)
 {
     TLLM_CHECK_WITH_INFO(mNgramSize >= 1, "ngramSize requires >= 1");
     TLLM_CHECK_WITH_INFO(mWindowSize >= 1, "windowSize requires >= 1");
@@ -93,7 +94,7 @@ LookaheadDecodingConfig::LookaheadDecodingConfig(
 bool LookaheadDecodingConfig::operator==(LookaheadDecodingConfig const& other) const
 {
     return mNgramSize == other.mNgramSize && mWindowSize == other.mWindowSize
-        && mVerificationSetSize == other.mVerificationSetSize;
+        && mVerificationSetSize == other.mVerificationSetSize && mUsePoolCache == other.mUsePoolCache;
 }
 
 std::tuple<SizeType32 const, SizeType32 const, SizeType32 const> LookaheadDecodingConfig::get() const
@@ -116,6 +117,11 @@ SizeType32 LookaheadDecodingConfig::getVerificationSetSize() const
     return mVerificationSetSize;
 }
 
+bool LookaheadDecodingConfig::getUsePoolCache() const
+{
+    return mUsePoolCache;
+}
+
 bool LookaheadDecodingConfig::isLegal(
     SizeType32 windowSize, SizeType32 ngramSize, SizeType32 verificationSetSize) noexcept
 {
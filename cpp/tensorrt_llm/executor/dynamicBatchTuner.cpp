@@ -16,14 +16,17 @@
  */
 
 #include "tensorrt_llm/executor/dynamicBatchTuner.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
+#include <algorithm>
 #include <cmath>
 
 namespace
 {
 using namespace tensorrt_llm::executor;
 
-void updateStats(SizeType32 value, std::deque<SizeType32>& stats, int64_t& sum, SizeType32 windowSize)
+template <typename TValue, typename TSum>
+void updateStats(TValue value, std::deque<TValue>& stats, TSum& sum, SizeType32 windowSize)
 {
     while (static_cast<SizeType32>(stats.size()) >= windowSize)
     {
@@ -50,6 +53,8 @@ DynamicBatchTuner::DynamicBatchTuner(DynamicBatchConfig const& config)
         TLLM_CHECK_WITH_INFO(mBatchSizeTable[i - 1].first < mBatchSizeTable[i].first,
             "Batch size table is not sorted in ascending order.");
     }
+    // Read through getFloatEnv so each tuner instance picks up the current value.
+    mIterLatencyTargetMs = common::getFloatEnv("TRTLLM_ITER_LATENCY_TARGET_MS").value_or(0.F);
 }
 
 void DynamicBatchTuner::updateStats(SizeType32 inputLength, SizeType32 outputLength)
@@ -68,21 +73,65 @@ double DynamicBatchTuner::getAverageOutputLength() const
     return mOutputLengthStats.empty() ? 0 : static_cast<double>(mOutputLengthSum) / mOutputLengthStats.size();
 }
 
+void DynamicBatchTuner::updateIterationLatency(double iterLatencyMs)
+{
+    if (!isLatencyFeedbackEnabled())
+    {
+        return;
+    }
+    ::updateStats(iterLatencyMs, mIterLatencyStats, mIterLatencySum, mDynamicBatchMovingAverageWindow);
+    // Wait until the moving average has settled after the last adjustment before reacting again.
+    auto const minItersBeforeAdjustment = std::min(kLatencyAdjustmentInterval, mDynamicBatchMovingAverageWindow);
+    if (++mItersSinceLatencyAdjustment < minItersBeforeAdjustment)
+    {
+        return;
+    }
+    auto const avgLatency = getAverageIterationLatency();
+    if (avgLatency > mIterLatencyTargetMs * kLatencyHighWatermark)
+    {
+        mLatencyScale = std::max(mLatencyScale * kLatencyScaleDownStep, kLatencyScaleMin);
+        mItersSinceLatencyAdjustment = 0;
+        TLLM_LOG_DEBUG("Average iteration latency %.2f ms exceeds target %.2f ms, reducing latency scale to %.3f",
+            avgLatency, mIterLatencyTargetMs, mLatencyScale);
+    }
+    else if (avgLatency < mIterLatencyTargetMs * kLatencyLowWatermark && mLatencyScale < 1.0)
+    {
+        mLatencyScale = std::min(mLatencyScale * kLatencyScaleUpStep, 1.0);
+        mItersSinceLatencyAdjustment = 0;
+        TLLM_LOG_DEBUG("Average iteration latency %.2f ms is below target %.2f ms, raising latency scale to %.3f",
+            avgLatency, mIterLatencyTargetMs, mLatencyScale);
+    }
+}
+
+double DynamicBatchTuner::getAverageIterationLatency() const
+{
+    return mIterLatencyStats.empty() ? 0 : mIterLatencySum / mIterLatencyStats.size();
+}
+
+SizeType32 DynamicBatchTuner::applyLatencyScale(SizeType32 value) const
+{
+    if (mLatencyScale >= 1.0)
+    {
+        return value;
+    }
+    return std::max<SizeType32>(1, static_cast<SizeType32>(value * mLatencyScale));
+}
+
 SizeType32 DynamicBatchTuner::getRuntimeBatchSize(SizeType32 maxCapacityBatchSize) const
 {
     for (auto const& [batchSizeLimit, batchSize] : mBatchSizeTable)
     {
         if (maxCapacityBatchSize < batchSizeLimit)
         {
-            return batchSize;
+            return applyLatencyScale(batchSize);
         }
     }
     SizeType32 threshold = maxCapacityBatchSize / kBatchSizeFallbackGranularity * kBatchSizeFallbackGranularity;
     if (maxCapacityBatchSize < (threshold + kBatchSizeFallbackThreshold))
     {
-        return threshold;
+        return applyLatencyScale(threshold);
     }
-    return maxCapacityBatchSize;
+    return applyLatencyScale(maxCapacityBatchSize);
 }
 
 SizeType32 DynamicBatchTuner::getRuntimeMaxNumTokens(SizeType32 maxRuntimeBatchSize) const
@@ -107,7 +156,7 @@ SizeType32 DynamicBatchTuner::getRuntimeMaxNumTokens(SizeType32 maxRuntimeBatchS
         tokenThreshold = kMaxNumTokensThresholdGenHeavy;
     }
     // pad it to pow of 2 and max of this value and threshold.
-    return (std::max(1 << int(ceil(log2(adjustedNumTokens))), tokenThreshold));
+    return applyLatencyScale(std::max(1 << int(ceil(log2(adjustedNumTokens))), tokenThreshold));
 }
 
 } // namespace tensorrt_llm::executor
@@ -58,7 +58,30 @@ public:
     /// @brief Get the dynamic max num tokens based on the current statistics.
     [[nodiscard]] SizeType32 getRuntimeMaxNumTokens(SizeType32 runtimeBatchSize) const;
 
+    /// @brief Check if closed-loop iteration latency feedback is enabled.
+    ///        Enabled by setting TRTLLM_ITER_LATENCY_TARGET_MS to a positive value.
+    [[nodiscard]] bool isLatencyFeedbackEnabled() const
+    {
+        return mIterLatencyTargetMs > 0;
+    }
+
+    /// @brief Record the measured latency of one executor iteration and adapt the latency scale applied to the
+    ///        runtime batch size and max num tokens.
+    void updateIterationLatency(double iterLatencyMs);
+
+    /// @brief Get average iteration latency in milliseconds.
+    [[nodiscard]] double getAverageIterationLatency() const;
+
+    /// @brief Get the scale in (0, 1] currently applied to the runtime batch size and max num tokens.
+    [[nodiscard]] double getLatencyScale() const
+    {
+        return mLatencyScale;
+    }
+
 private:
+    /// @brief Scale a runtime limit by the current latency feedback scale.
+    [[nodiscard]] SizeType32 applyLatencyScale(SizeType32 value) const;
+
     bool mEnableBatchSizeTuning = false;
 
     bool mEnableMaxNumTokensTuning = false;
@@ -73,6 +96,13 @@ private:
     int64_t mOutputLengthSum = 0;
     std::deque<SizeType32> mOutputLengthStats;
 
+    double mIterLatencyTargetMs = 0;
+    double mLatencyScale = 1.0;
+    SizeType32 mItersSinceLatencyAdjustment = 0;
+
+    double mIterLatencySum = 0;
+    std::deque<double> mIterLatencyStats;
+
     static SizeType32 const kBatchSizeFallbackGranularity = 512;
     static SizeType32 const kBatchSizeFallbackThreshold = 128;
 
@@ -82,6 +112,15 @@ private:
     static SizeType32 const kMaxNumTokensThresholdContextHeavy = 8192;
     static SizeType32 const kMaxNumTokensThresholdBalanced = 4096;
     static SizeType32 const kMaxNumTokensThresholdGenHeavy = 2048;
+
+    // Hysteresis band around the latency target: only react when the moving average leaves
+    // [kLatencyLowWatermark, kLatencyHighWatermark] * target, and at most once per adjustment interval.
+    static double constexpr kLatencyHighWatermark = 1.1;
+    static double constexpr kLatencyLowWatermark = 0.85;
+    static double constexpr kLatencyScaleDownStep = 0.8;
+    static double constexpr kLatencyScaleUpStep = 1.1;
+    static double constexpr kLatencyScaleMin = 0.1;
+    static SizeType32 const kLatencyAdjustmentInterval = 32;
 };
 
 } // namespace tensorrt_llm::executor
@@ -97,6 +97,16 @@ void Executor::cancelRequest(IdType requestId)
     return mImpl->cancelRequest(requestId);
 }
 
+void Executor::drain()
+{
+    return mImpl->drain();
+}
+
+void Executor::updateWeights(std::map<std::string, Tensor> const& weights)
+{
+    return mImpl->updateWeights(weights);
+}
+
 void Executor::shutdown()
 {
     return mImpl->shutdown();
@@ -132,6 +142,16 @@ std::optional<std::shared_ptr<KVCacheEventManager>> Executor::getKVCacheEventMan
     return mImpl->getKVCacheEventManager();
 }
 
+std::optional<KVCachePrefixDigest> Executor::getKVCachePrefixDigest() const
+{
+    return mImpl->getKVCachePrefixDigest();
+}
+
+bool Executor::writeDecoderTimingTrace(std::string const& path) const
+{
+    return mImpl->writeDecoderTimingTrace(path);
+}
+
 KVCacheEvent::KVCacheEvent(
     size_t eventId, KVCacheEventData data, SizeType32 windowSize, std::optional<SizeType32> attentionDpRank)
     : eventId{eventId}
@@ -16,14 +16,17 @@
  */
 
 #include "tensorrt_llm/executor/executorImpl.h"
+#include "tensorrt_llm/batch_manager/kvCacheManager.h"
 #include "tensorrt_llm/batch_manager/trtEncoderModel.h"
 #include "tensorrt_llm/batch_manager/trtGptModelFactory.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaProfilerUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/common/timestampUtils.h"
 #include "tensorrt_llm/common/utils.h"
+#include "tensorrt_llm/executor/admissionController.h"
 #include "tensorrt_llm/executor/dataTransceiverState.h"
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/executor/orchestratorUtils.h"
@@ -34,16 +37,23 @@
 #include "tensorrt_llm/executor/version.h"
 #include "tensorrt_llm/runtime/loraCache.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
+#include "tensorrt_llm/runtime/moeLoadBalancer/topologyDetector.h"
+#include "tensorrt_llm/runtime/nvlsPayloadBroadcaster.h"
 #include "tensorrt_llm/runtime/utils/mpiTags.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <cuda_profiler_api.h>
+#include <future>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
 
 namespace tensorrt_llm::executor
@@ -52,6 +62,17 @@ namespace tensorrt_llm::executor
 namespace
 {
 
+//! \brief Bind the calling thread to the CPU cores of the NUMA node of its GPU when requested.
+//! Must be called after cudaSetDevice. Pinned buffers the thread allocates afterwards are placed on the
+//! same node by first touch, so response serialization stays free of cross-socket traffic.
+void bindThreadToGpuNumaIfRequested()
+{
+    if (common::getEnvBindExecutorThreadsToGpuNuma())
+    {
+        runtime::TopologyDetector::getInstance().bindThreadByCurrentGpu();
+    }
+}
+
 [[nodiscard]] bool executorConfigIsValid(ExecutorConfig const& executorConfig, runtime::ModelConfig const& modelConfig)
 {
     // Make sure logic in this function matches fixExecutorConfig
@@ -408,6 +429,7 @@ void Executor::Impl::initialize(ExecutorConfig const& executorConfig)
     mIsChunkedContext = executorConfig.getEnableChunkedContext();
     mPromptTableOffloading = executorConfig.getPromptTableOffloading();
     mMaxQueueSize = executorConfig.getMaxQueueSize();
+    mAdmissionController = AdmissionController::createFromEnv();
 
     mLastReqId = 1;
 
@@ -441,6 +463,15 @@ void Executor::Impl::initialize(ExecutorConfig const& executorConfig)
             mCommPipelineParallel = std::make_shared<tensorrt_llm::mpi::MpiComm>(
                 commSession.split(rank % (tp * cp), worldConfig.getPipelineParallelRank()));
 
+            if (worldConfig.isTensorParallel() && common::getEnvEnableNvlsRequestBcast())
+            {
+                // Collective over the tensor parallel group; the env gate and the parallel layout are
+                // uniform across ranks, so all group members reach this call together.
+                constexpr std::size_t kNvlsRequestBcastCapacity = 8ULL << 20;
+                mNvlsRequestBroadcaster = tensorrt_llm::runtime::NvlsPayloadBroadcaster::create(
+                    *mCommTensorParallel, kNvlsRequestBcastCapacity);
+            }
+
             if (worldConfig.isPipelineParallel())
             {
                 mRequestWithIdWaitThread = std::make_unique<tensorrt_llm::mpi::MpiWaitThread>(
@@ -479,6 +510,24 @@ void Executor::Impl::initialize(ExecutorConfig const& executorConfig)
         }
     }
 
+    auto const& specDecConfig = executorConfig.getSpecDecConfig();
+    if (specDecConfig && specDecConfig->dynamicDraftLen)
+    {
+        if (mIsWorker)
+        {
+            if (mModel->getModelConfig().getSpeculativeDecodingMode().isDraftTokensExternal())
+            {
+                mSpecDecodingTuner = std::make_shared<SpecDecodingTuner>(specDecConfig.value());
+            }
+            else
+            {
+                TLLM_LOG_WARNING(
+                    "Dynamic draft length tuning can only support the external draft tokens speculative decoding "
+                    "mode.");
+            }
+        }
+    }
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -600,6 +649,13 @@ void Executor::Impl::initializeCommAndWorkers(SizeType32 tp, SizeType32 pp, Size
     mCommMode = parallelConfig.getCommunicationMode();
     auto optOrchestratorConfig = parallelConfig.getOrchestratorConfig();
 
+    if (mCommMode == CommunicationMode::kORCHESTRATOR)
+    {
+        // Orchestrator mode drives worker processes through MPI (spawn or ports), which the
+        // single-process fast path in initialize() above skips.
+        tensorrt_llm::mpi::forceInitialize(tensorrt_llm::mpi::MpiThreadSupport::THREAD_MULTIPLE);
+    }
+
     mRecvPollPeriodMs = executorConfig.getRecvPollPeriodMs();
 
     // Need to create communicator between orchestrator and leader if not spawning processes in orchestrator mode
@@ -697,9 +753,17 @@ void Executor::Impl::initializeOrchestrator(SizeType32 tp, SizeType32 pp, SizeTy
         mOrchLeaderComm->bcast(&bufferSize, 1, mpi::MpiType::kINT64, MPI_ROOT);
         mOrchLeaderComm->bcast(buffer.data(), buffer.size(), mpi::MpiType::kCHAR, MPI_ROOT);
 
+        // Negotiate the transport before the barrier: the leader runs its side of the handshake while
+        // constructing its executor instance, i.e. before reaching the worker-side barrier.
+        setupShmTransport();
+
         // Wait for workers to have created their executor instance
         MPICHECK(MPI_Barrier(intercomm));
     }
+    else
+    {
+        setupShmTransport();
+    }
 
     // Spawn the thread responsible for sending new requests to the leader of the model
     mOrchSendReqThread = std::thread(&Impl::orchSendReqThread, this);
@@ -786,7 +850,9 @@ void Executor::Impl::initializeWorkers(SizeType32 tp, SizeType32 pp, SizeType32
     mIsPipelineLeader = (mWorldRank == participantIds[tp * (pp - 1)]);
 
 #if ENABLE_MULTI_DEVICE
-    if (mIsWorker)
+    // With a single rank the session already equals the world and MPI may not even be
+    // initialized, so don't carve out a sub-communicator.
+    if (mIsWorker && worldSize > 1)
     {
         // Create a session, but only assign to COMM_SESSION for ranks participating in this model
         MPI_Group worldGroup = MPI_GROUP_NULL;
@@ -836,6 +902,8 @@ void Executor::Impl::initializeWorkers(SizeType32 tp, SizeType32 pp, SizeType32
             auto worldConfig = runtime::WorldConfig::mpi(gpusPerNode, tp, pp, cp, parallelConfig.getDeviceIds());
             mDeviceId = worldConfig.getDevice();
         }
+        setupShmTransport();
+
         // Spawn the thread responsible for receiving new requests from the orchestrator
         mLeaderRecvReqThread = std::thread(&Impl::leaderRecvReqThread, this);
 
@@ -885,6 +953,7 @@ std::vector<IdType> Executor::Impl::enqueueRequests(std::vector<Request> const&
 std::vector<IdType> Executor::Impl::enqueueRequests(common::ArrayView<Request const> const& requests)
 {
     TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called, cannot enqueue requests");
+    TLLM_CHECK_WITH_INFO(!mDrainRequested, "Executor is draining, cannot enqueue requests");
     checkParallelApiUsage(__func__);
 
     TLLM_LOG_DEBUG("Enqueuing %lu requests", requests.size());
@@ -902,6 +971,7 @@ std::vector<IdType> Executor::Impl::enqueueRequests(common::ArrayView<Request co
     }
 
     std::vector<IdType> ids;
+    auto totalRequestSize = 0;
     {
         auto now = std::chrono::steady_clock::now();
         for (auto const& req : requests)
@@ -911,6 +981,7 @@ std::vector<IdType> Executor::Impl::enqueueRequests(common::ArrayView<Request co
 
             std::vector<IdType> childReqIds;
             auto numChildRequests = getNumChildRequests(req);
+            totalRequestSize += numChildRequests + 1;
             if (numChildRequests > 0)
             {
                 childReqIds.reserve(numChildRequests);
@@ -931,23 +1002,20 @@ std::vector<IdType> Executor::Impl::enqueueRequests(common::ArrayView<Request co
             if (mMaxQueueSize)
             {
                 auto const maxQueueSize = mMaxQueueSize.value();
-
-                auto totalRequestSize = 0;
-                for (auto&& reqWithId : requestWithIds)
-                {
-                    totalRequestSize += (getNumChildRequests(reqWithId.req) + 1);
-                }
-
                 if (maxQueueSize > 0 && mQueuedRequests.size() + totalRequestSize > static_cast<size_t>(maxQueueSize))
                 {
                     TLLM_THROW("Maximum queue size of %d has been reached, please try again later", maxQueueSize);
                 }
             }
-
-            for (auto&& req : requestWithIds)
+            if (mAdmissionController)
             {
-                insertRequestInOrder(mQueuedRequests, std::move(req));
+                if (auto err = mAdmissionController->tryAdmit(requestWithIds))
+                {
+                    TLLM_THROW("%s", err->c_str());
+                }
             }
+
+            insertRequestsInOrder(mQueuedRequests, std::move(requestWithIds));
         }
         mQueuedReqCv.notify_one();
     }
@@ -965,16 +1033,22 @@ std::vector<Response> Executor::Impl::awaitResponses(std::optional<std::chrono::
     TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
     checkParallelApiUsage(__func__);
     std::unique_lock<std::mutex> lck(mResponsesMtx);
-    auto pred = [this]() -> bool { return !mResponses.empty() || mShutdown; };
+    auto pred = [this]() -> bool { return !mResponsesBatch.empty() || !mResponses.empty() || mShutdown; };
     auto storeResponses = [this]()
     {
         std::vector<Response> responses;
+        responses.swap(mResponsesBatch);
+        // The map only holds responses when the per-id overloads are used as well.
         for (auto it = mResponses.begin(); it != mResponses.end();)
         {
-            responses.insert(responses.end(), it->second.begin(), it->second.end());
-            addTerminatedReqId(it->second, it->first);
+            responses.insert(
+                responses.end(), std::make_move_iterator(it->second.begin()), std::make_move_iterator(it->second.end()));
             it = mResponses.erase(it);
         }
+        for (auto const& response : responses)
+        {
+            addTerminatedReqId(response, response.getRequestId());
+        }
         return responses;
     };
 
@@ -1000,8 +1074,12 @@ std::vector<Response> Executor::Impl::awaitResponses(
     TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
     checkParallelApiUsage(__func__);
     std::unique_lock<std::mutex> lck(mResponsesMtx);
+    indexResponsesBatch();
     auto pred = [this, reqId]() -> bool
-    { return (mResponses.find(reqId) != mResponses.end() && !mResponses.at(reqId).empty()) || mShutdown; };
+    {
+        indexResponsesBatch();
+        return (mResponses.find(reqId) != mResponses.end() && !mResponses.at(reqId).empty()) || mShutdown;
+    };
     auto storeIdResponse = [this, reqId]()
     {
         std::vector<Response> responses;
@@ -1083,9 +1161,12 @@ SizeType32 Executor::Impl::getNumResponsesReady(std::optional<IdType> const& opt
         {
             numResponsesReady = static_cast<SizeType32>(respIt->second.size());
         }
+        numResponsesReady += static_cast<SizeType32>(std::count_if(mResponsesBatch.begin(), mResponsesBatch.end(),
+            [reqId](Response const& response) { return response.getRequestId() == reqId; }));
     }
     else
     {
+        numResponsesReady = static_cast<SizeType32>(mResponsesBatch.size());
         for (auto const& [id, responses] : mResponses)
         {
             numResponsesReady += static_cast<SizeType32>(responses.size());
@@ -1192,6 +1273,54 @@ void Executor::Impl::cancelRequest(IdType requestId)
     }
 }
 
+void Executor::Impl::drain()
+{
+    TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
+    checkParallelApiUsage(__func__);
+    TLLM_CHECK_WITH_INFO(
+        mCommMode == CommunicationMode::kLEADER, "drain is not supported in ORCHESTRATOR mode");
+    if (mModel)
+    {
+        TLLM_CHECK_WITH_INFO(
+            !mModel->getWorldConfig().isPipelineParallel(), "drain does not support pipeline parallelism");
+        TLLM_CHECK_WITH_INFO(mModel->hasKvCacheTransceiver(),
+            "drain requires disaggregated serving to be enabled, please check the configuration of "
+            "cacheTransceiverConfig.");
+    }
+    TLLM_LOG_INFO("Executor drain requested, in-flight requests will be handed off for resumption");
+    mDrainRequested = true;
+}
+
+void Executor::Impl::updateWeights(std::map<std::string, Tensor> const& weights)
+{
+    TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
+    TLLM_CHECK_WITH_INFO(mCommMode == CommunicationMode::kLEADER,
+        "updateWeights is not supported in ORCHESTRATOR mode");
+    TLLM_CHECK_WITH_INFO(mIsWorker,
+        "updateWeights must be called on a participant; weights are sharded per rank, so every participant has to "
+        "receive the shards of its own rank");
+    std::scoped_lock<std::mutex> lck(mWeightUpdateMtx);
+    for (auto const& [name, tensor] : weights)
+    {
+        mPendingWeightUpdates[name] = tensor;
+    }
+}
+
+void Executor::Impl::applyPendingWeightUpdates()
+{
+    std::map<std::string, Tensor> updates;
+    {
+        std::scoped_lock<std::mutex> lck(mWeightUpdateMtx);
+        updates.swap(mPendingWeightUpdates);
+    }
+    if (updates.empty())
+    {
+        return;
+    }
+    NVTX3_SCOPED_RANGE(applyPendingWeightUpdates);
+    mModel->updateWeights(updates);
+}
+
 std::deque<IterationStats> Executor::Impl::getLatestIterationStats()
 {
     TLLM_CHECK_WITH_INFO(!mShutdownCalled, "Shutdown called");
@@ -1227,7 +1356,7 @@ std::deque<DebugTensorsPerIteration> Executor::Impl::getLatestDebugTensors()
 
 bool Executor::Impl::canEnqueueRequests() const
 {
-    return !mShutdownCalled
+    return !mShutdownCalled && !mDrainRequested
         && ((mCommMode == CommunicationMode::kLEADER && mIsLeader)
             || (mCommMode == CommunicationMode::kORCHESTRATOR && mIsOrchestrator));
 }
@@ -1247,9 +1376,25 @@ std::optional<std::shared_ptr<KVCacheEventManager>> Executor::Impl::getKVCacheEv
     return cacheEventManager ? std::optional(std::make_shared<KVCacheEventManager>(cacheEventManager)) : std::nullopt;
 }
 
+std::optional<KVCachePrefixDigest> Executor::Impl::getKVCachePrefixDigest() const
+{
+    if (!mModel)
+    {
+        return std::nullopt;
+    }
+    auto cacheManager = mModel->getKVCacheManager();
+    return cacheManager ? std::optional(cacheManager->getPrefixDigest()) : std::nullopt;
+}
+
+bool Executor::Impl::writeDecoderTimingTrace(std::string const& path) const
+{
+    return mModel && mModel->writeDecoderTimingTrace(path);
+}
+
 void Executor::Impl::requestWithIdLeaderThread()
 {
     TLLM_CUDA_CHECK(cudaSetDevice(mModel->getWorldConfig().getDevice()));
+    bindThreadToGpuNumaIfRequested();
     auto constexpr peer = 0;
     while (true)
     {
@@ -1284,6 +1429,7 @@ void Executor::Impl::requestWithIdLeaderThread()
 void Executor::Impl::cancelledRequestsLeaderThread()
 {
     TLLM_CUDA_CHECK(cudaSetDevice(mModel->getWorldConfig().getDevice()));
+    bindThreadToGpuNumaIfRequested();
     auto constexpr peer = 0;
     while (true)
     {
@@ -1305,11 +1451,49 @@ void Executor::Impl::cancelledRequestsLeaderThread()
     }
 }
 
+void Executor::Impl::idleHeartbeat()
+{
+    try
+    {
+        auto const& bufferManager = mModel->getBufferManager();
+        if (!mIdleHeartbeatSrc)
+        {
+            auto constexpr heartbeatBytes = 4096;
+            auto const heartbeatShape = runtime::ITensor::makeShape({heartbeatBytes});
+            mIdleHeartbeatSrc = runtime::BufferManager::pinned(heartbeatShape, nvinfer1::DataType::kUINT8);
+            mIdleHeartbeatDst = bufferManager.gpu(heartbeatShape, nvinfer1::DataType::kUINT8);
+        }
+        bufferManager.copy(*mIdleHeartbeatSrc, *mIdleHeartbeatDst);
+        bufferManager.getStream().synchronize();
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_WARNING("Idle heartbeat failed: %s", e.what());
+    }
+}
+
 std::vector<RequestWithId> Executor::Impl::getLeaderNewReqWithIds(
     SizeType32 numActiveRequests, std::optional<PriorityType> lowestPriorityActive)
 {
     std::unique_lock<std::mutex> lck(mQueuedReqMtx);
-    mQueuedReqCv.wait(lck, [&]() { return (!mQueuedRequests.empty() || numActiveRequests > 0 || mShutdown); });
+    auto const queuePred = [&]() { return (!mQueuedRequests.empty() || numActiveRequests > 0 || mShutdown); };
+    auto const heartbeatPeriodMs = common::getEnvIdleHeartbeatMs();
+    if (numActiveRequests == 0 && heartbeatPeriodMs > 0)
+    {
+        // Park on the request queue, but wake periodically to keep the device context and staging
+        // buffers warm. The heartbeat runs without the queue lock so enqueues are never delayed,
+        // and an arriving request (or shutdown) wakes the wait immediately via the notification.
+        while (!mQueuedReqCv.wait_for(lck, std::chrono::milliseconds(heartbeatPeriodMs), queuePred))
+        {
+            lck.unlock();
+            idleHeartbeat();
+            lck.lock();
+        }
+    }
+    else
+    {
+        mQueuedReqCv.wait(lck, queuePred);
+    }
 
     std::vector<RequestWithId> reqWithIds;
 
@@ -1342,6 +1526,10 @@ std::vector<RequestWithId> Executor::Impl::getLeaderNewReqWithIds(
         }
 
         TLLM_LOG_DEBUG("Dequeue request with ID %ld", nextRequest.id);
+        if (mAdmissionController)
+        {
+            mAdmissionController->onDequeued(nextRequest.req.getClientId(), nextRequest.childReqIds.size() + 1);
+        }
         reqWithIds.emplace_back(std::move(nextRequest));
         mQueuedRequests.pop_front();
         return true;
@@ -1420,7 +1608,10 @@ std::vector<RequestWithId> Executor::Impl::getNewReqWithIds(
             auto packed = RequestWithId::serializeReqWithIds(reqWithIds);
             if (worldConfig.isTensorParallel())
             {
-                mCommTensorParallel->bcast(packed, 0);
+                if (!mNvlsRequestBroadcaster || !mNvlsRequestBroadcaster->broadcast(packed, 0))
+                {
+                    mCommTensorParallel->bcast(packed, 0);
+                }
             }
             if (worldConfig.isContextParallel())
             {
@@ -1433,7 +1624,10 @@ std::vector<RequestWithId> Executor::Impl::getNewReqWithIds(
         if (worldConfig.isFirstPipelineParallelRank())
         {
             std::vector<char> buffer;
-            mCommTensorParallel->bcast(buffer, 0);
+            if (!mNvlsRequestBroadcaster || !mNvlsRequestBroadcaster->broadcast(buffer, 0))
+            {
+                mCommTensorParallel->bcast(buffer, 0);
+            }
             mCommContextParallel->bcast(buffer, 0);
             reqWithIds = RequestWithId::deserializeReqWithIds(buffer);
         }
@@ -1543,6 +1737,17 @@ std::tuple<Executor::Impl::RequestList, double> Executor::Impl::fetchNewRequests
                     mEncoderModel ? std::optional<SizeType32>(mEncoderModel->getMaxInputLen()) : std::nullopt,
                     mEnableBlockReuse);
 
+                // Truncate the draft to the length that currently pays off at the measured acceptance rate.
+                if (mSpecDecodingTuner && newReq->hasDraftTokens())
+                {
+                    auto const runtimeDraftLen = mSpecDecodingTuner->getRuntimeDraftLen(mModel->getMaxDraftLen());
+                    auto const numDraftTokens = newReq->getNumDraftTokens();
+                    if (numDraftTokens > runtimeDraftLen)
+                    {
+                        newReq->discardDraftTokens(numDraftTokens - runtimeDraftLen);
+                    }
+                }
+
                 TLLM_CHECK_WITH_INFO(!mEncoderModel || !mIsSchedulerMaxUtilization,
                     "Encoder or Encoder-Decoder model don't support max utilization scheduler yet. Only max requests "
                     "or guaranteed no evict.");
@@ -1689,6 +1894,28 @@ void Executor::Impl::terminateActiveRequests(RequestList& activeRequests, std::s
     }
 }
 
+bool Executor::Impl::terminateRequestWithError(RequestList& activeRequests, IdType requestId, std::string const& err)
+{
+    auto const it = std::find_if(activeRequests.begin(), activeRequests.end(),
+        [requestId](auto const& llmReq) { return llmReq->mRequestId == requestId; });
+    if (it == activeRequests.end())
+    {
+        return false;
+    }
+    TLLM_LOG_ERROR("%s", err.c_str());
+
+    auto llmReq = *it;
+    llmReq->setState(batch_manager::LlmRequestState::kGENERATION_COMPLETE);
+    mModel->terminateRequest(llmReq);
+
+    if (mIsLeader)
+    {
+        enqueueNewResponses({{llmReq->mRequestId, err, llmReq->mClientId}});
+    }
+    activeRequests.erase(it);
+    return true;
+}
+
 void Executor::Impl::forwardSync(RequestList& activeRequests)
 {
     TLLM_LOG_TRACE("[RANK %d] %s start", COMM_SESSION.getRank(), __PRETTY_FUNCTION__);
@@ -1700,6 +1927,16 @@ void Executor::Impl::forwardSync(RequestList& activeRequests)
         }
         mModel->forwardSync();
     }
+    catch (common::RequestSpecificException const& e)
+    {
+        // An error attributable to a single request (e.g. its memory budget was exceeded) only
+        // fails that request; the rest of the batch keeps running.
+        std::string const err = std::string("Encountered a request-specific error in forwardSync function: ") + e.what();
+        if (!terminateRequestWithError(activeRequests, e.getRequestId(), err))
+        {
+            terminateActiveRequests(activeRequests, err);
+        }
+    }
     catch (std::exception const& e)
     {
         std::string const err = std::string("Encountered an error in forwardSync function: ") + e.what();
@@ -1789,6 +2026,17 @@ void Executor::Impl::forwardAsync(RequestList& activeRequests)
 
         mModel->forwardAsync(activeRequests);
     }
+    catch (common::RequestSpecificException const& e)
+    {
+        // An error attributable to a single request (e.g. its memory budget was exceeded) only
+        // fails that request; the rest of the batch keeps running.
+        std::string const err
+            = std::string("Encountered a request-specific error in forwardAsync function: ") + e.what();
+        if (!terminateRequestWithError(activeRequests, e.getRequestId(), err))
+        {
+            terminateActiveRequests(activeRequests, err);
+        }
+    }
     catch (std::exception const& e)
     {
         std::string err = std::string("Encountered an error in forwardAsync function: ") + e.what();
@@ -1856,6 +2104,9 @@ RequestStatsPerIteration Executor::Impl::getCurrentRequestStats(
         requestStats.reusedBlocksPerRequest = request->getReusedBlocksPerRequest();
         requestStats.missedBlocksPerRequest = request->getMissedBlocksPerRequest();
         requestStats.kvCacheHitRatePerRequest = request->getKVCacheHitRatePerRequest();
+        requestStats.timeInQueueMS = request->getTimeInQueueMS();
+        requestStats.contextLatencyMS = request->getContextLatencyMS();
+        requestStats.lastTokenLatenciesMS = request->getLastTokenLatenciesMS();
         requestStatsVec.emplace_back(requestStats);
     }
 
@@ -1875,6 +2126,8 @@ RequestStatsPerIteration Executor::Impl::getCurrentRequestStats(
             requestStats.reusedBlocksPerRequest = 0;
             requestStats.missedBlocksPerRequest = 0;
             requestStats.kvCacheHitRatePerRequest = 0;
+            requestStats.timeInQueueMS = 0;
+            requestStats.contextLatencyMS = 0;
             requestStatsVec.emplace_back(requestStats);
         }
     }
@@ -1894,6 +2147,9 @@ RequestStatsPerIteration Executor::Impl::getCurrentRequestStats(
         requestStats.reusedBlocksPerRequest = request->getReusedBlocksPerRequest();
         requestStats.missedBlocksPerRequest = request->getMissedBlocksPerRequest();
         requestStats.kvCacheHitRatePerRequest = request->getKVCacheHitRatePerRequest();
+        requestStats.timeInQueueMS = request->getTimeInQueueMS();
+        requestStats.contextLatencyMS = request->getContextLatencyMS();
+        requestStats.lastTokenLatenciesMS = request->getLastTokenLatenciesMS();
         requestStatsVec.emplace_back(requestStats);
     }
 
@@ -1938,6 +2194,21 @@ void Executor::Impl::updateIterationStats(RequestList const& activeRequests, dou
     {
         auto currentIterStats = getCurrentIterationStats(
             activeRequests, iterLatencyMS, numNewActiveRequests, newActiveRequestsQueueLatencyMS, numCompletedRequests);
+        // Publish the flat binary record first; a monitoring agent mapping the ring gets the stats
+        // without JSON conversion or the stats API round trip.
+        if (!mIterationStatsRingChecked)
+        {
+            mIterationStatsRingChecked = true;
+            auto const& shmName = common::getEnvIterationStatsShmName();
+            if (!shmName.empty())
+            {
+                mIterationStatsRing = IterationStatsRing::create(shmName);
+            }
+        }
+        if (mIterationStatsRing)
+        {
+            mIterationStatsRing->push(IterationStatsRecord::fromStats(currentIterStats));
+        }
         // Send the stats to the orchestrator
         if (mCommMode == CommunicationMode::kORCHESTRATOR)
         {
@@ -2169,6 +2440,43 @@ void Executor::Impl::terminateCancelledRequests(RequestList& activeRequests)
     }
 }
 
+void Executor::Impl::drainActiveRequests(RequestList& activeRequests)
+{
+    NVTX3_SCOPED_RANGE(drainActiveRequests);
+    auto const& worldConfig = mModel->getWorldConfig();
+    bool drainRequested = mDrainRequested.load();
+    auto const& commSession = COMM_SESSION;
+    if (commSession.getSize() > 1)
+    {
+        // All ranks participate in both broadcasts so the whole tp x cp grid converts its requests
+        // at the same iteration.
+        if (worldConfig.isTensorParallel())
+        {
+            mCommTensorParallel->bcastValue(drainRequested, 0);
+        }
+        if (worldConfig.isContextParallel())
+        {
+            mCommContextParallel->bcastValue(drainRequested, 0);
+        }
+    }
+    if (!drainRequested)
+    {
+        return;
+    }
+
+    for (auto const& req : activeRequests)
+    {
+        // Completed requests and requests that already finish this iteration respond normally;
+        // there is nothing left to resume for them.
+        if (req->getLlmRequestType() == batch_manager::LlmRequestType::LLMREQUEST_TYPE_CONTEXT_AND_GENERATION
+            && (req->isContextInitState() || req->isGenerationInProgressState()))
+        {
+            TLLM_LOG_DEBUG("Draining request %lu, its KV cache will be handed off for resumption", req->mRequestId);
+            req->setLlmRequestType(batch_manager::LlmRequestType::LLMREQUEST_TYPE_CONTEXT_ONLY);
+        }
+    }
+}
+
 void Executor::Impl::terminateContextFinishedRequests(InTransList& inTransmissionRequests)
 {
     NVTX3_SCOPED_RANGE(terminateContextFinishedRequests);
@@ -2201,10 +2509,8 @@ void Executor::Impl::appendNewResponses(std::vector<Response>&& newResponses)
 {
     {
         std::scoped_lock<std::mutex> lck(mResponsesMtx);
-        for (auto& response : newResponses)
-        {
-            mResponses[response.getRequestId()].emplace_back(std::move(response));
-        }
+        mResponsesBatch.insert(mResponsesBatch.end(), std::make_move_iterator(newResponses.begin()),
+            std::make_move_iterator(newResponses.end()));
     }
     mResponsesCv.notify_all();
 }
@@ -2260,10 +2566,16 @@ void Executor::Impl::executionLoop()
 
     auto const& worldConfig = mModel->getWorldConfig();
     TLLM_CUDA_CHECK(cudaSetDevice(worldConfig.getDevice()));
+    bindThreadToGpuNumaIfRequested();
 
     auto const [profileIterIdxs, stopIterIdxs] = tensorrt_llm::common::populateIterationIndexes(
         kPROFILE_START_STOP_ENV_VAR_NAME, kLEGACY_PROFILE_START_STOP_ENV_VAR_NAME);
 
+    // With request-fetch overlap, new requests are fetched and deserialized on a side thread while
+    // forwardSync waits for the previous iteration's GPU work. Disabled with pipeline parallelism,
+    // where the fetch participates in the same send/recv chains as the forward path.
+    bool const overlapRequestFetch = common::getEnvOverlapRequestFetch() && !worldConfig.isPipelineParallel();
+
     SizeType32 numNewActiveRequests{0};
     std::chrono::time_point<std::chrono::steady_clock> iterStart;
     std::chrono::time_point<std::chrono::steady_clock> iterEnd;
@@ -2277,13 +2589,44 @@ void Executor::Impl::executionLoop()
         double newActiveRequestsQueueLatencyMS{0.0};
         bool reportFinishedRequests = true;
         RequestList finishedRequests;
+        std::optional<std::tuple<RequestList, double>> prefetchedNewRequests;
         if (!activeRequests.empty())
         {
             finishTimedOutRequests(activeRequests);
             terminateCancelledRequests(activeRequests);
+            drainActiveRequests(activeRequests);
+            std::optional<std::future<std::tuple<RequestList, double>>> newRequestsFuture;
+            if (overlapRequestFetch && !mShutdown)
+            {
+                // Snapshot capacity and priority before the sync; requests finishing in this
+                // iteration free capacity for the fetch one iteration later. The future is joined
+                // right after the sync, before response population touches any state the fetch
+                // writes (e.g. the child request id map).
+                auto const numActive = static_cast<SizeType32>(activeRequests.size());
+                auto const lowestPriorityActive = std::make_optional(activeRequests.back()->priority());
+                newRequestsFuture = std::async(std::launch::async, [this, numActive, lowestPriorityActive]()
+                    { return fetchNewRequests(numActive, lowestPriorityActive); });
+            }
             forwardSync(activeRequests);
+            if (newRequestsFuture)
+            {
+                prefetchedNewRequests = newRequestsFuture->get();
+            }
             finishedRequests = populateNewResponses(activeRequests, inTransmissionRequests, newResponses);
             cleanupDynamicLogitsPostProcessors(finishedRequests);
+            if (mSpecDecodingTuner)
+            {
+                for (auto const& finishedReq : finishedRequests)
+                {
+                    if (finishedReq->hasDraftTokens())
+                    {
+                        // Decoded tokens per iteration count the one token the target model produces itself,
+                        // everything above that came out of the draft.
+                        mSpecDecodingTuner->updateAcceptanceStats(
+                            finishedReq->getNumDraftTokens(), finishedReq->getAvgDecodedTokensPerIter() - 1.0);
+                    }
+                }
+            }
             auto const iterCounter = mModel->getIterCounter();
             auto const stopIter = !stopIterIdxs.empty() && (stopIterIdxs.count(iterCounter - 1) > 0);
             if (stopIter)
@@ -2308,6 +2651,10 @@ void Executor::Impl::executionLoop()
             }
             iterEnd = std::chrono::steady_clock::now();
             iterLatencyMS = std::chrono::duration<double, std::milli>(iterEnd - iterStart).count();
+            if (mDynamicBatchTuner)
+            {
+                mDynamicBatchTuner->updateIterationLatency(iterLatencyMS);
+            }
         }
 
         if (!inTransmissionRequests.empty())
@@ -2330,8 +2677,9 @@ void Executor::Impl::executionLoop()
                 lowestPriority = activeRequests.back()->priority();
             }
 
-            auto [newRequests, newActiveRequestsQueueLatency]
-                = fetchNewRequests(static_cast<SizeType32>(activeRequests.size()), lowestPriority);
+            auto [newRequests, newActiveRequestsQueueLatency] = prefetchedNewRequests
+                ? std::move(*prefetchedNewRequests)
+                : fetchNewRequests(static_cast<SizeType32>(activeRequests.size()), lowestPriority);
             newActiveRequestsQueueLatencyMS = newActiveRequestsQueueLatency;
             numNewActiveRequests = newRequests.size();
 
@@ -2356,9 +2704,21 @@ void Executor::Impl::executionLoop()
                 }
             }
         }
+        else if (prefetchedNewRequests)
+        {
+            // A shutdown arrived while the fetch ran on the side thread. Keep parity with the
+            // synchronous path, which still processes requests already taken off the queue.
+            for (auto const& newRequest : std::get<0>(*prefetchedNewRequests))
+            {
+                insertRequestInOrder(activeRequests, newRequest);
+            }
+        }
 
         if (!activeRequests.empty())
         {
+            // Weight updates are applied here, after the previous iteration synced and before the next
+            // one is enqueued, so active requests keep running on a consistent set of weights.
+            applyPendingWeightUpdates();
             forwardAsync(activeRequests);
             updateIterationStats(activeRequests, iterLatencyMS, numNewActiveRequests, newActiveRequestsQueueLatencyMS,
                 static_cast<SizeType32>(finishedRequests.size()), false);
@@ -2432,6 +2792,93 @@ void Executor::Impl::enqueueNewResponses(std::vector<Response>&& newResponses)
     }
 }
 
+void Executor::Impl::setupShmTransport()
+{
+#if ENABLE_MULTI_DEVICE
+    // The leader reports its host name; the orchestrator compares it with its own, creates the shared
+    // memory segments when they match and replies with the segment base name. An empty name keeps both
+    // sides on MPI, as does a leader that fails to attach to the segments.
+    char shmName[256] = {};
+    if (mIsOrchestrator)
+    {
+        char leaderHost[MPI_MAX_PROCESSOR_NAME] = {};
+        mOrchLeaderComm->recv(leaderHost, MPI_MAX_PROCESSOR_NAME, mpi::MpiType::kCHAR, mLeaderRank,
+            mpi::MpiTag::kOrchestratorShmHostname);
+
+        char orchHost[MPI_MAX_PROCESSOR_NAME] = {};
+        int hostLen = 0;
+        MPICHECK(MPI_Get_processor_name(orchHost, &hostLen)); // NOLINT
+
+        bool const coLocated = std::strncmp(leaderHost, orchHost, MPI_MAX_PROCESSOR_NAME) == 0;
+        if (coLocated && !common::getEnvDisableOrchShmTransport())
+        {
+            auto const base = common::fmtstr("/trtllm_orch_%llx",
+                static_cast<unsigned long long>(std::chrono::system_clock::now().time_since_epoch().count()));
+            mShmReqChannel = ShmChannel::create(base + "_req");
+            mShmRespChannel = ShmChannel::create(base + "_resp");
+            if (mShmReqChannel && mShmRespChannel)
+            {
+                std::strncpy(shmName, base.c_str(), sizeof(shmName) - 1);
+            }
+            else
+            {
+                mShmReqChannel.reset();
+                mShmRespChannel.reset();
+            }
+        }
+        mOrchLeaderComm->send(
+            shmName, sizeof(shmName), mpi::MpiType::kCHAR, mLeaderRank, mpi::MpiTag::kOrchestratorShmName);
+        if (shmName[0] != '\0')
+        {
+            char leaderAttached = 0;
+            mOrchLeaderComm->recv(&leaderAttached, 1, mpi::MpiType::kCHAR, mLeaderRank, mpi::MpiTag::kOrchestratorShmName);
+            if (leaderAttached)
+            {
+                TLLM_LOG_INFO("Orchestrator and leader share a host, using shared-memory transport %s", shmName);
+            }
+            else
+            {
+                mShmReqChannel.reset();
+                mShmRespChannel.reset();
+            }
+        }
+    }
+    else
+    {
+        char leaderHost[MPI_MAX_PROCESSOR_NAME] = {};
+        int hostLen = 0;
+        MPICHECK(MPI_Get_processor_name(leaderHost, &hostLen)); // NOLINT
+        mOrchLeaderComm->send(leaderHost, MPI_MAX_PROCESSOR_NAME, mpi::MpiType::kCHAR, mOrchRank,
+            mpi::MpiTag::kOrchestratorShmHostname);
+
+        mOrchLeaderComm->recv(
+            shmName, sizeof(shmName), mpi::MpiType::kCHAR, mOrchRank, mpi::MpiTag::kOrchestratorShmName);
+        if (shmName[0] != '\0')
+        {
+            auto const base = std::string{shmName};
+            mShmReqChannel = ShmChannel::open(base + "_req");
+            mShmRespChannel = ShmChannel::open(base + "_resp");
+            char attached = (mShmReqChannel && mShmRespChannel) ? 1 : 0;
+            if (!attached)
+            {
+                mShmReqChannel.reset();
+                mShmRespChannel.reset();
+            }
+            mOrchLeaderComm->send(&attached, 1, mpi::MpiType::kCHAR, mOrchRank, mpi::MpiTag::kOrchestratorShmName);
+        }
+    }
+#endif // ENABLE_MULTI_DEVICE
+}
+
+namespace
+{
+// Serialized request payloads larger than this stream to the leader in chunks of this size instead
+// of one MPI message. Chunking keeps every message below the int32_t element-count limit of a
+// single MPI send (so multi-gigabyte prompt-table or multimodal-embedding payloads no longer
+// fast-fail) and bounds how long any one send occupies the link while iterations run on the leader.
+constexpr uint64_t kRequestChunkBytes = 128ULL << 20;
+} // namespace
+
 // Orchestrator thread sending new requests to leader of the model
 void Executor::Impl::orchSendReqThread()
 {
@@ -2443,7 +2890,14 @@ void Executor::Impl::orchSendReqThread()
 
         if (message.id == MpiId::TERMINATION)
         {
-            mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorId);
+            if (mShmReqChannel)
+            {
+                mShmReqChannel->send(message.id, nullptr, 0);
+            }
+            else
+            {
+                mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorId);
+            }
             TLLM_LOG_INFO("Orchestrator sendReq thread exiting");
             break;
         }
@@ -2453,21 +2907,26 @@ void Executor::Impl::orchSendReqThread()
             auto packed = RequestWithId::serializeReqWithIds(reqWithIds.requests);
 
             TLLM_LOG_DEBUG("Orchestrator sendReq thread sending %d pending requests", reqWithIds.requests.size());
-            // Temporary WAR to indicate to client that we cannot send the serialized request
-            // because it exceeds int32_t size limit.
-            // TODO: Should fix as part of https://jirasw.nvidia.com/browse/TRTLLM-708
-            if (packed.size() > std::numeric_limits<int32_t>::max())
+            if (mShmReqChannel)
+            {
+                // The ring streams arbitrarily large payloads, so the MPI size limit does not apply
+                mShmReqChannel->send(message.id, packed.data(), packed.size());
+            }
+            else if (packed.size() > kRequestChunkBytes)
             {
-                for (auto const& reqWithId : reqWithIds.requests)
+                // Stream large payloads (prompt tables, multimodal embeddings) in bounded chunks.
+                // The leader reassembles them on its receive thread while the execution loop keeps
+                // iterating, so ingestion of a huge request overlaps with the work already running.
+                auto constexpr chunkedId = MpiId::PENDING_REQUEST_CHUNKED;
+                uint64_t const totalSize = packed.size();
+                mOrchLeaderComm->send(&chunkedId, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorId);
+                mOrchLeaderComm->send(
+                    &totalSize, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorData);
+                for (uint64_t chunkOffset = 0; chunkOffset < totalSize; chunkOffset += kRequestChunkBytes)
                 {
-                    {
-                        std::scoped_lock<std::mutex> lck(mResponsesMtx);
-                        mResponses[reqWithId.id].emplace_back(reqWithId.id,
-                            "Request is too large, or you are enqueuing too many requests at once "
-                            "to be sent via MPI_Send, please try to enqueue the request(s) again. "
-                            "This issue will be resolved in a future version of TRT-LLM.");
-                    }
-                    mResponsesCv.notify_all();
+                    auto const chunkBytes = std::min(kRequestChunkBytes, totalSize - chunkOffset);
+                    mOrchLeaderComm->send(packed.data() + chunkOffset, chunkBytes, mpi::MpiType::kCHAR, mLeaderRank,
+                        mpi::MpiTag::kOrchestratorData);
                 }
             }
             else
@@ -2481,9 +2940,16 @@ void Executor::Impl::orchSendReqThread()
         {
             auto& data = std::get<RequestIdsData>(message.data);
 
-            mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorId);
-            mOrchLeaderComm->send(
-                data.ids.data(), data.ids.size(), mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorData);
+            if (mShmReqChannel)
+            {
+                mShmReqChannel->send(message.id, data.ids.data(), data.ids.size() * sizeof(IdType));
+            }
+            else
+            {
+                mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mLeaderRank, mpi::MpiTag::kOrchestratorId);
+                mOrchLeaderComm->send(data.ids.data(), data.ids.size(), mpi::MpiType::kUINT64, mLeaderRank,
+                    mpi::MpiTag::kOrchestratorData);
+            }
         }
         else
         {
@@ -2497,26 +2963,36 @@ void Executor::Impl::leaderRecvReqThread()
 {
     tensorrt_llm::common::setThreadName("leaderRecvReq");
     TLLM_CUDA_CHECK(cudaSetDevice(mDeviceId));
+    bindThreadToGpuNumaIfRequested();
 #if ENABLE_MULTI_DEVICE
     auto& selCancelledReqIds = mUsePipelineParallel ? mPipelineCancelledReqIds : mCancelledReqIds;
     while (true)
     {
-        if (mRecvPollPeriodMs > 0)
+        MpiId mpiId{};
+        std::vector<char> shmPayload;
+        MPI_Message msg = nullptr;
+        MPI_Status status;
+        if (mShmReqChannel)
         {
-            mOrchLeaderComm->recvPoll(mOrchRank, mpi::MpiTag::kOrchestratorId, mRecvPollPeriodMs);
+            // Blocking is okay: terminate message is expected to arrive here
+            std::tie(mpiId, shmPayload) = mShmReqChannel->recv();
         }
+        else
+        {
+            if (mRecvPollPeriodMs > 0)
+            {
+                mOrchLeaderComm->recvPoll(mOrchRank, mpi::MpiTag::kOrchestratorId, mRecvPollPeriodMs);
+            }
 
-        // Blocking is okay: terminate message is expected to arrive here
-        MPI_Message msg = nullptr;
-        MPI_Status status;
-        mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorId, &msg, &status);
+            // Blocking is okay: terminate message is expected to arrive here
+            mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorId, &msg, &status);
 
-        int32_t count = 0;
-        MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count)); // NOLINT
-        TLLM_CHECK(count == 1);
+            int32_t count = 0;
+            MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count)); // NOLINT
+            TLLM_CHECK(count == 1);
 
-        MpiId mpiId{};
-        MPICHECK(MPI_Mrecv(&mpiId, count, MPI_UINT64_T, &msg, &status)); // NOLINT
+            MPICHECK(MPI_Mrecv(&mpiId, count, MPI_UINT64_T, &msg, &status)); // NOLINT
+        }
 
         // EXIT condition from receiving TERMINATE msg
         if (mpiId == MpiId::TERMINATION)
@@ -2529,12 +3005,35 @@ void Executor::Impl::leaderRecvReqThread()
             TLLM_LOG_INFO("Leader recvReq thread exiting");
             break;
         }
-        if (mpiId == MpiId::PENDING_REQUEST)
+        if (mpiId == MpiId::PENDING_REQUEST || mpiId == MpiId::PENDING_REQUEST_CHUNKED)
         {
-            mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorData, &msg, &status);
-            MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count));                 // NOLINT
-            std::vector<char> buffer(count);
-            MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+            std::vector<char> buffer;
+            if (mShmReqChannel)
+            {
+                buffer = std::move(shmPayload);
+            }
+            else if (mpiId == MpiId::PENDING_REQUEST_CHUNKED)
+            {
+                // Reassemble a chunked payload. Point-to-point messages on the same tag arrive in
+                // order, so the chunks land back to back in the preallocated buffer.
+                uint64_t totalSize = 0;
+                mOrchLeaderComm->recv(&totalSize, 1, mpi::MpiType::kUINT64, mOrchRank, mpi::MpiTag::kOrchestratorData);
+                buffer.resize(totalSize);
+                for (uint64_t chunkOffset = 0; chunkOffset < totalSize; chunkOffset += kRequestChunkBytes)
+                {
+                    auto const chunkBytes = std::min(kRequestChunkBytes, totalSize - chunkOffset);
+                    mOrchLeaderComm->recv(buffer.data() + chunkOffset, chunkBytes, mpi::MpiType::kCHAR, mOrchRank,
+                        mpi::MpiTag::kOrchestratorData);
+                }
+            }
+            else
+            {
+                int32_t count = 0;
+                mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorData, &msg, &status);
+                MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count)); // NOLINT
+                buffer.resize(count);
+                MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+            }
 
             auto requestWithIds = RequestWithId::deserializeReqWithIds(buffer);
             TLLM_LOG_DEBUG("Leader recvReq thread receiving %d pending requests", requestWithIds.size());
@@ -2558,21 +3057,47 @@ void Executor::Impl::leaderRecvReqThread()
                         continue;
                     }
                 }
+                if (mAdmissionController)
+                {
+                    if (auto err = mAdmissionController->tryAdmit(requestWithIds))
+                    {
+                        TLLM_LOG_ERROR("%s", err->c_str());
+                        std::vector<Response> responses;
+                        responses.reserve(requestWithIds.size());
+                        for (auto const& reqWithId : requestWithIds)
+                        {
+                            responses.emplace_back(reqWithId.id, err.value(), reqWithId.req.getClientId());
+                        }
+                        enqueueNewResponses(std::move(responses));
+                        continue;
+                    }
+                }
+                auto const queuedStart = std::chrono::steady_clock::now();
                 for (auto&& req : requestWithIds)
                 {
-                    req.queuedStart = std::chrono::steady_clock::now();
-                    insertRequestInOrder(mQueuedRequests, std::move(req));
+                    req.queuedStart = queuedStart;
                 }
+                insertRequestsInOrder(mQueuedRequests, std::move(requestWithIds));
             }
             mQueuedReqCv.notify_one();
         }
         else if (mpiId == MpiId::CANCEL_REQUEST)
         {
-            // Prepare receiving data
-            mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorData, &msg, &status);
-            MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count));                          // NOLINT
-            std::vector<uint64_t> cancelledReqIds(count);
-            MPICHECK(MPI_Mrecv(cancelledReqIds.data(), count, MPI_UINT64_T, &msg, &status)); // NOLINT
+            std::vector<uint64_t> cancelledReqIds;
+            if (mShmReqChannel)
+            {
+                cancelledReqIds.resize(shmPayload.size() / sizeof(uint64_t));
+                std::memcpy(cancelledReqIds.data(), shmPayload.data(), cancelledReqIds.size() * sizeof(uint64_t));
+            }
+            else
+            {
+                // Prepare receiving data
+                int32_t count = 0;
+                mOrchLeaderComm->mprobe(mOrchRank, mpi::MpiTag::kOrchestratorData, &msg, &status);
+                MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count)); // NOLINT
+                cancelledReqIds.resize(count);
+                MPICHECK(MPI_Mrecv(cancelledReqIds.data(), count, MPI_UINT64_T, &msg, &status)); // NOLINT
+            }
 
             std::scoped_lock<std::mutex> lck(mCancelReqMtx);
             selCancelledReqIds.insert(cancelledReqIds.begin(), cancelledReqIds.end());
@@ -2590,47 +3115,160 @@ void Executor::Impl::leaderSendThread(MpiMessageQueue& sendQueue, mpi::MpiTag id
 {
     tensorrt_llm::common::setThreadName("leaderSend");
     TLLM_CUDA_CHECK(cudaSetDevice(mDeviceId));
+    bindThreadToGpuNumaIfRequested();
 
 #if ENABLE_MULTI_DEVICE
-    while (true)
+    auto serializeMessage = [](MpiMessage& message)
     {
-        auto message = sendQueue.pop();
+        std::vector<char> buffer;
+        if (message.id == MpiId::RESPONSE)
+        {
+            auto& responseData = std::get<ResponseData>(message.data);
+            TLLM_LOG_DEBUG("Leader sendResp thread sending %d responses", responseData.responses.size());
+            buffer = Serialization::serialize(responseData.responses);
+        }
+        else if (message.id == MpiId::ITER_STATS)
+        {
+            auto& iterStatsData = std::get<IterStatsData>(message.data);
+            TLLM_LOG_DEBUG("Leader sendResp thread sending iter stats");
+            buffer = Serialization::serialize(iterStatsData.iterStatsVec);
+        }
+        else if (message.id == MpiId::REQUEST_ITER_STATS)
+        {
+            auto& requestIterStatsData = std::get<RequestStatsPerIterationData>(message.data);
+            TLLM_LOG_DEBUG("Leader sendResp thread sending iter request stats");
+            buffer = Serialization::serialize(requestIterStatsData.requestStatsPerIterationVec);
+        }
+        else
+        {
+            TLLM_THROW("Invalid message id");
+        }
+        return buffer;
+    };
 
-        if (message.id == MpiId::TERMINATION)
+    auto sendTermination = [this, idTag]()
+    {
+        auto const id = MpiId::TERMINATION;
+        if (mShmRespChannel)
         {
-            mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mOrchRank, idTag);
-            TLLM_LOG_INFO("Leader sendThread exiting");
-            break;
+            mShmRespChannel->send(id, nullptr, 0);
         }
-        if (message.id == MpiId::RESPONSE || message.id == MpiId::ITER_STATS
-            || message.id == MpiId ::REQUEST_ITER_STATS)
+        else
         {
-            std::vector<char> buffer;
-            if (message.id == MpiId::RESPONSE)
-            {
-                auto& responseData = std::get<ResponseData>(message.data);
-                TLLM_LOG_DEBUG("Leader sendResp thread sending %d responses", responseData.responses.size());
-                buffer = Serialization::serialize(responseData.responses);
-            }
-            else if (message.id == MpiId::ITER_STATS)
+            mOrchLeaderComm->send(&id, 1, mpi::MpiType::kUINT64, mOrchRank, idTag);
+        }
+        TLLM_LOG_INFO("Leader sendThread exiting");
+    };
+
+    auto sendBuffer = [this, idTag, dataTag](MpiId id, std::vector<char> const& buffer)
+    {
+        if (mShmRespChannel)
+        {
+            mShmRespChannel->send(id, buffer.data(), buffer.size());
+        }
+        else
+        {
+            mOrchLeaderComm->send(&id, 1, mpi::MpiType::kUINT64, mOrchRank, idTag);
+            mOrchLeaderComm->send(buffer.data(), buffer.size(), mpi::MpiType::kCHAR, mOrchRank, dataTag);
+        }
+    };
+
+    auto const numSerializers = common::getEnvResponseSerializerThreads();
+    if (numSerializers == 0)
+    {
+        while (true)
+        {
+            auto message = sendQueue.pop();
+
+            if (message.id == MpiId::TERMINATION)
             {
-                auto& iterStatsData = std::get<IterStatsData>(message.data);
-                TLLM_LOG_DEBUG("Leader sendResp thread sending iter stats");
-                buffer = Serialization::serialize(iterStatsData.iterStatsVec);
+                sendTermination();
+                break;
             }
-            else if (message.id == MpiId::REQUEST_ITER_STATS)
+            auto const buffer = serializeMessage(message);
+            sendBuffer(message.id, buffer);
+        }
+        return;
+    }
+
+    // Serialization is the dominant cost of this thread under high streaming response rates, so it
+    // is sharded across a pool of serializer threads. Messages are stamped with a sequence number
+    // when they leave the queue and the send loop below emits them in sequence order, so the wire
+    // order matches the queue order.
+    struct SequencedBuffer
+    {
+        MpiId id;
+        std::vector<char> buffer;
+    };
+
+    std::map<uint64_t, SequencedBuffer> readyBuffers;
+    std::mutex readyMutex;
+    std::condition_variable readyCv;
+    std::mutex popMutex;
+    uint64_t nextSeqNum{0};
+
+    std::vector<std::thread> serializers;
+    serializers.reserve(numSerializers);
+    for (size_t threadIdx = 0; threadIdx < numSerializers; ++threadIdx)
+    {
+        serializers.emplace_back(
+            [&]()
             {
-                auto& requestIterStatsData = std::get<RequestStatsPerIterationData>(message.data);
-                TLLM_LOG_DEBUG("Leader sendResp thread sending iter request stats");
-                buffer = Serialization::serialize(requestIterStatsData.requestStatsPerIterationVec);
-            }
-            mOrchLeaderComm->send(&message.id, 1, mpi::MpiType::kUINT64, mOrchRank, idTag);
-            mOrchLeaderComm->send(buffer.data(), buffer.size(), mpi::MpiType::kCHAR, mOrchRank, dataTag);
+                tensorrt_llm::common::setThreadName("leaderSerialize");
+                while (true)
+                {
+                    MpiMessage message(MpiId::TERMINATION);
+                    uint64_t seqNum{0};
+                    {
+                        // Popping and assigning the sequence number must be atomic, otherwise two
+                        // serializers could stamp messages out of queue order.
+                        std::scoped_lock<std::mutex> lck(popMutex);
+                        message = sendQueue.pop();
+                        seqNum = nextSeqNum++;
+                        if (message.id == MpiId::TERMINATION)
+                        {
+                            // Wake the sibling serializers; their termination markers get larger
+                            // sequence numbers and are dropped after the send loop has exited.
+                            sendQueue.push(MpiMessage(MpiId::TERMINATION));
+                        }
+                    }
+                    bool const terminate = message.id == MpiId::TERMINATION;
+                    SequencedBuffer item{message.id, terminate ? std::vector<char>{} : serializeMessage(message)};
+                    {
+                        std::scoped_lock<std::mutex> lck(readyMutex);
+                        readyBuffers.emplace(seqNum, std::move(item));
+                    }
+                    readyCv.notify_all();
+                    if (terminate)
+                    {
+                        return;
+                    }
+                }
+            });
+    }
+
+    uint64_t nextSeqNumToSend{0};
+    while (true)
+    {
+        SequencedBuffer item;
+        {
+            std::unique_lock<std::mutex> lck(readyMutex);
+            readyCv.wait(lck, [&readyBuffers, &nextSeqNumToSend]
+                { return readyBuffers.find(nextSeqNumToSend) != readyBuffers.end(); });
+            auto node = readyBuffers.extract(nextSeqNumToSend);
+            item = std::move(node.mapped());
         }
-        else
+        ++nextSeqNumToSend;
+        if (item.id == MpiId::TERMINATION)
         {
-            TLLM_THROW("Invalid message id");
+            sendTermination();
+            break;
         }
+        sendBuffer(item.id, item.buffer);
+    }
+    for (auto& serializer : serializers)
+    {
+        serializer.join();
     }
 #endif // ENABLE_MULTI_DEVICE
 }
@@ -2642,21 +3280,38 @@ void Executor::Impl::orchRecvThread(mpi::MpiTag idTag, mpi::MpiTag dataTag)
 #if ENABLE_MULTI_DEVICE
     while (true)
     {
-        if (mRecvPollPeriodMs > 0)
+        MpiId mpiId{};
+        std::vector<char> buffer;
+        if (mShmRespChannel)
         {
-            mOrchLeaderComm->recvPoll(mOrchRank, mpi::MpiTag::kOrchestratorId, mRecvPollPeriodMs);
+            std::tie(mpiId, buffer) = mShmRespChannel->recv();
         }
+        else
+        {
+            if (mRecvPollPeriodMs > 0)
+            {
+                mOrchLeaderComm->recvPoll(mOrchRank, mpi::MpiTag::kOrchestratorId, mRecvPollPeriodMs);
+            }
 
-        MPI_Message msg = nullptr;
-        MPI_Status status;
-        mOrchLeaderComm->mprobe(mLeaderRank, idTag, &msg, &status);
+            MPI_Message msg = nullptr;
+            MPI_Status status;
+            mOrchLeaderComm->mprobe(mLeaderRank, idTag, &msg, &status);
 
-        int32_t count = 0;
-        MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count)); // NOLINT
-        TLLM_CHECK(count == 1);
+            int32_t count = 0;
+            MPICHECK(MPI_Get_count(&status, MPI_UINT64_T, &count)); // NOLINT
+            TLLM_CHECK(count == 1);
 
-        MpiId mpiId{};
-        MPICHECK(MPI_Mrecv(&mpiId, count, MPI_UINT64_T, &msg, &status)); // NOLINT
+            MPICHECK(MPI_Mrecv(&mpiId, count, MPI_UINT64_T, &msg, &status)); // NOLINT
+
+            if (mpiId != MpiId::TERMINATION)
+            {
+                mOrchLeaderComm->mprobe(mLeaderRank, dataTag, &msg, &status);
+                MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count)); // NOLINT
+
+                buffer.resize(count);
+                MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
+            }
+        }
 
         if (mpiId == MpiId::TERMINATION)
         {
@@ -2665,12 +3320,6 @@ void Executor::Impl::orchRecvThread(mpi::MpiTag idTag, mpi::MpiTag dataTag)
         }
         if (mpiId == MpiId::RESPONSE || mpiId == MpiId::ITER_STATS || mpiId == MpiId::REQUEST_ITER_STATS)
         {
-            mOrchLeaderComm->mprobe(mLeaderRank, dataTag, &msg, &status);
-            MPICHECK(MPI_Get_count(&status, MPI_CHAR, &count)); // NOLINT
-
-            std::vector<char> buffer(count);
-            MPICHECK(MPI_Mrecv(buffer.data(), count, MPI_CHAR, &msg, &status)); // NOLINT
-
             if (mpiId == MpiId::RESPONSE)
             {
                 auto newResponses = Serialization::deserializeResponses(buffer);
@@ -2740,21 +3389,40 @@ void Executor::Impl::addTerminatedReqId(std::vector<Response> const& responses,
 {
     for (auto const& response : responses)
     {
-        if (response.hasError() || (!response.hasError() && response.getResult().isFinal))
+        addTerminatedReqId(response, reqId);
+    }
+}
+
+void Executor::Impl::addTerminatedReqId(Response const& response, IdType const& reqId)
+{
+    if (response.hasError() || (!response.hasError() && response.getResult().isFinal))
+    {
+        auto childIt = mChildReqIdsMap.find(reqId);
+        if (childIt != mChildReqIdsMap.end())
+        {
+            // Terminate the parent and all children as one batch so the intervals are compacted
+            // once instead of per id.
+            auto terminatedIds = std::move(childIt->second);
+            terminatedIds.push_back(reqId);
+            mTerminatedReqIds.insert(std::move(terminatedIds));
+            mChildReqIdsMap.erase(childIt);
+        }
+        else
         {
             mTerminatedReqIds.insert(reqId);
-            if (mChildReqIdsMap.find(reqId) != mChildReqIdsMap.end())
-            {
-                for (auto childReqId : mChildReqIdsMap.at(reqId))
-                {
-                    mTerminatedReqIds.insert(childReqId);
-                }
-                mChildReqIdsMap.erase(reqId);
-            }
         }
     }
 }
 
+void Executor::Impl::indexResponsesBatch()
+{
+    for (auto& response : mResponsesBatch)
+    {
+        mResponses[response.getRequestId()].emplace_back(std::move(response));
+    }
+    mResponsesBatch.clear();
+}
+
 void Executor::Impl::checkParallelApiUsage(std::string const& methodName) const
 {
     // If leader mode, and not leader, throw error
@@ -20,11 +20,14 @@
 #include "tensorrt_llm/batch_manager/llmRequest.h"
 #include "tensorrt_llm/common/arrayView.h"
 #include "tensorrt_llm/executor/dynamicBatchTuner.h"
+#include "tensorrt_llm/executor/specDecodingTuner.h"
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/executor/intervalSet.h"
+#include "tensorrt_llm/executor/iterationStatsRing.h"
 #include "tensorrt_llm/executor/model.h"
 #include "tensorrt_llm/executor/orchestratorUtils.h"
 #include "tensorrt_llm/executor/requestWithId.h"
+#include "tensorrt_llm/executor/shmTransport.h"
 #include "tensorrt_llm/executor/types.h"
 #include "tensorrt_llm/runtime/gptJsonConfig.h"
 #include "tensorrt_llm/runtime/modelConfig.h"
@@ -42,33 +45,61 @@
 #include <unordered_map>
 #include <unordered_set>
 
+namespace tensorrt_llm::runtime
+{
+class NvlsPayloadBroadcaster;
+} // namespace tensorrt_llm::runtime
+
 namespace tensorrt_llm::executor
 {
 
+class AdmissionController;
 class RequestWithIdAsyncSend;
 class CancelledRequestsAsyncSend;
 
+//! Multi-producer single-consumer message queue. The consumer drains the whole backlog in one
+//! locked operation and then pops from a private batch, so under load the mutex and the condition
+//! variable wake-up (tens of microseconds) are paid once per batch instead of once per message.
 class MpiMessageQueue
 {
 public:
     void push(MpiMessage&& message)
     {
-        std::lock_guard<std::mutex> const lock(mMutex);
-        mQueue.push(std::move(message));
+        {
+            std::lock_guard<std::mutex> const lock(mMutex);
+            mQueue.push(std::move(message));
+            mSize.fetch_add(1, std::memory_order_release);
+        }
         mCv.notify_one();
     }
 
+    //! Must be called from a single consumer thread.
     MpiMessage pop()
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCv.wait(lock, [this] { return !mQueue.empty(); });
-        MpiMessage message = std::move(mQueue.front());
-        mQueue.pop();
+        if (mBatch.empty())
+        {
+            // Messages often arrive while the consumer is still sending the previous one; spin
+            // briefly on the size counter so that case skips the condition variable sleep.
+            for (int i = 0; i < kSpinCount && mSize.load(std::memory_order_acquire) == 0; ++i)
+            {
+                std::this_thread::yield();
+            }
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCv.wait(lock, [this] { return !mQueue.empty(); });
+            mBatch.swap(mQueue);
+            mSize.store(0, std::memory_order_relaxed);
+        }
+        MpiMessage message = std::move(mBatch.front());
+        mBatch.pop();
         return message;
     }
 
 private:
+    static constexpr int kSpinCount{1024};
+
     std::queue<MpiMessage> mQueue;
+    std::queue<MpiMessage> mBatch; // consumer-private, drained without the lock
+    std::atomic<std::size_t> mSize{0};
     std::mutex mMutex;
     std::condition_variable mCv;
 };
@@ -127,6 +158,10 @@ public:
 
     void cancelRequest(IdType requestId);
 
+    void drain();
+
+    void updateWeights(std::map<std::string, Tensor> const& weights);
+
     void shutdown();
 
     std::deque<IterationStats> getLatestIterationStats();
@@ -139,6 +174,10 @@ public:
 
     std::optional<std::shared_ptr<KVCacheEventManager>> getKVCacheEventManager() const;
 
+    [[nodiscard]] std::optional<KVCachePrefixDigest> getKVCachePrefixDigest() const;
+
+    bool writeDecoderTimingTrace(std::string const& path) const;
+
 private:
     using RtTensorPtr = runtime::ITensor::SharedPtr;
     using CudaStreamPtr = runtime::BufferManager::CudaStreamPtr;
@@ -185,6 +224,11 @@ private:
 
     std::vector<RequestWithId> getLeaderNewReqWithIds(
         SizeType32 numActiveRequests, std::optional<PriorityType> lowestPriorityActive);
+
+    /// @brief Touch the device with a small staged copy while the executor is idle, keeping the
+    /// CUDA context, pinned staging memory and DMA path warm so the first iteration after an idle
+    /// stretch does not pay a cold-start penalty.
+    void idleHeartbeat();
     std::vector<RequestWithId> getNewReqWithIds(
         SizeType32 numActiveRequests, std::optional<PriorityType> lowestPriorityActive);
 
@@ -199,6 +243,10 @@ private:
 
     void terminateActiveRequests(RequestList& activeRequests, std::string const& err);
 
+    /// @brief Terminate a single active request with an error response, keeping the rest of the
+    /// batch running. Returns false when the request is not part of activeRequests.
+    bool terminateRequestWithError(RequestList& activeRequests, IdType requestId, std::string const& err);
+
     IterationStats getCurrentIterationStats(RequestList const& activeRequests, double iterLatencyMS,
         SizeType32 numNewActiveRequests, double newActiveRequestsQueueLatencyMS, SizeType32 numCompletedRequests);
 
@@ -217,6 +265,15 @@ private:
 
     void terminateCancelledRequests(RequestList& activeRequests);
 
+    /// @brief Switch in-flight requests to context-only when a drain was requested, so their KV
+    ///        cache is handed off through the cache transceiver instead of generating further
+    ///        tokens. Called by the execution loop between iterations on every rank; the drain flag
+    ///        is broadcast from the leader so all ranks convert at the same iteration.
+    void drainActiveRequests(RequestList& activeRequests);
+
+    /// @brief Apply queued weight updates to the model. Called by the execution loop between iterations.
+    void applyPendingWeightUpdates();
+
     void terminateContextFinishedRequests(InTransList& inTransmissionRequests);
 
     void appendNewResponses(std::vector<Response>&& newResponses);
@@ -242,7 +299,17 @@ private:
     void leaderRecvReqThread();
     void leaderSendThread(MpiMessageQueue& sendQueue, mpi::MpiTag idTag, mpi::MpiTag dataTag);
 
+    /// @brief Switch the orchestrator <-> leader transport to shared memory when both processes run on the
+    ///        same host. Must be called on the orchestrator and the leader before their send/recv threads
+    ///        start; both sides keep using MPI when the handshake does not enable the channels.
+    void setupShmTransport();
+
     void addTerminatedReqId(std::vector<Response> const& responses, IdType const& reqId);
+    void addTerminatedReqId(Response const& response, IdType const& reqId);
+
+    /// @brief Move the accumulated response batch into the per-request map. Must be called with
+    ///        mResponsesMtx held; only the per-request overloads pay the indexing cost.
+    void indexResponsesBatch();
 
     // Check that the current process is the leader or orchestrator
     void checkParallelApiUsage(std::string const& methodName) const;
@@ -276,18 +343,36 @@ private:
     // Atomic that indicates if shutdown method has been called
     std::atomic<bool> mShutdownCalled = false;
 
+    // Atomic that indicates a drain has been requested; blocks new admissions and makes the
+    // execution loop hand off in-flight requests through the cache transceiver
+    std::atomic<bool> mDrainRequested = false;
+
     // Queued requests
     std::mutex mQueuedReqMtx;
     std::condition_variable mQueuedReqCv;
     std::deque<RequestWithId> mQueuedRequests;
     std::optional<SizeType32> mMaxQueueSize;
+    // Staging buffers for the idle warm-keeping heartbeat, created lazily on the first idle period
+    RtTensorPtr mIdleHeartbeatSrc;
+    RtTensorPtr mIdleHeartbeatDst;
+    /// Per-tenant rate and queue depth limits applied before requests enter mQueuedRequests;
+    /// nullptr unless configured via the TRTLLM_TENANT_* environment knobs. Guarded by mQueuedReqMtx.
+    std::unique_ptr<AdmissionController> mAdmissionController;
 
     // Cancelled requests
     std::mutex mCancelReqMtx;
     std::unordered_set<IdType> mCancelledReqIds;
     std::unordered_set<IdType> mPipelineCancelledReqIds;
 
+    // Pending weight updates, keyed by engine tensor name; the latest update per name wins
+    std::mutex mWeightUpdateMtx;
+    std::map<std::string, Tensor> mPendingWeightUpdates;
+
     // Ready responses
+    // New responses accumulate in arrival order into mResponsesBatch, so producers append and the
+    // bulk awaitResponses overload drains with one swap under the lock, regardless of response
+    // count. The per-request map is only populated on demand by the per-id overloads.
+    std::vector<Response> mResponsesBatch;
     std::unordered_map<IdType, std::vector<Response>> mResponses;
     mutable std::mutex mResponsesMtx;
     std::condition_variable mResponsesCv;
@@ -302,6 +387,10 @@ private:
     IterationType mIterStatsMaxIterations;
     std::mutex mIterStatsMtx;
     std::deque<IterationStats> mIterationStats;
+    // Optional shared-memory ring of flat per-iteration stats records, enabled via
+    // TRTLLM_ITER_STATS_SHM so a monitoring agent can map them without the JSON stats API.
+    std::unique_ptr<IterationStatsRing> mIterationStatsRing;
+    bool mIterationStatsRingChecked{false};
 
     // Request stats
     IterationType mRequestStatsMaxIterations;
@@ -335,6 +424,11 @@ private:
     bool mIsOrchestrator = false;
     std::shared_ptr<tensorrt_llm::mpi::MpiComm> mOrchLeaderComm;
 
+    // Shared-memory channels replacing mOrchLeaderComm for requests (orchestrator -> leader) and
+    // responses (leader -> orchestrator) when both processes share a host
+    std::unique_ptr<ShmChannel> mShmReqChannel;
+    std::unique_ptr<ShmChannel> mShmRespChannel;
+
     std::thread mOrchSendReqThread;
     std::thread mOrchRecvThread;
     std::thread mLeaderRecvReqThread;
@@ -352,6 +446,9 @@ private:
     std::shared_ptr<tensorrt_llm::mpi::MpiComm> mCommTensorParallel;
     std::shared_ptr<tensorrt_llm::mpi::MpiComm> mCommPipelineParallel;
     std::shared_ptr<tensorrt_llm::mpi::MpiComm> mCommContextParallel;
+    //! NVLS multicast path for distributing serialized new requests to tensor parallel ranks.
+    //! Null when disabled or unsupported; oversize payloads fall back to mCommTensorParallel.
+    std::unique_ptr<tensorrt_llm::runtime::NvlsPayloadBroadcaster> mNvlsRequestBroadcaster;
     std::unique_ptr<RequestWithIdAsyncSend> mRequestWithIdAsyncSndHdl;
     std::unique_ptr<CancelledRequestsAsyncSend> mCancelledRequestsAsyncSndHdl;
     std::unique_ptr<std::thread> mRequestWithIdLeaderThread;
@@ -366,6 +463,8 @@ private:
     inline static std::string const kLEGACY_PROFILE_START_STOP_ENV_VAR_NAME = "TLLM_GPTM_PROFILE_START_STOP";
 
     std::shared_ptr<DynamicBatchTuner> mDynamicBatchTuner;
+
+    std::shared_ptr<SpecDecodingTuner> mSpecDecodingTuner;
 };
 
 } // namespace tensorrt_llm::executor
@@ -19,6 +19,10 @@
 
 #include "tensorrt_llm/executor/types.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 namespace tensorrt_llm::executor
 {
 
@@ -67,6 +71,25 @@ public:
         return false;
     }
 
+    /// @brief Check if the given number is in set, caching negative results by generation.
+    /// When the caller last saw the number absent at the current generation, the check is O(1) and
+    /// skips the binary search; insertions bump the generation, which invalidates the cache. A
+    /// zero-initialized cache is always safe: generation 0 means nothing was ever inserted. The
+    /// cached generation is only valid for the number it was last used with.
+    bool contains(NumType num, uint64_t& cachedGeneration) const
+    {
+        if (cachedGeneration == mGeneration)
+        {
+            return false;
+        }
+        if (contains(num))
+        {
+            return true;
+        }
+        cachedGeneration = mGeneration;
+        return false;
+    }
+
     /// @brief Insert a number into set. Do nothing if the number is already in the set.
     void insert(NumType num)
     {
@@ -76,6 +99,7 @@ public:
         {
             mIntervals.insert(mIntervals.begin(), intervalToAdd);
             mNumElements++;
+            mGeneration++;
             return;
         }
 
@@ -112,9 +136,88 @@ public:
             mIntervals.insert(iter, intervalToAdd);
         }
         mNumElements++;
+        mGeneration++;
+    }
+
+    /// @brief Insert a batch of numbers, compacting them into intervals in one pass.
+    /// The batch is sorted and merged with the existing intervals in a single linear sweep, instead
+    /// of one binary search and vector shift per number. The generation is bumped at most once per
+    /// batch, so cached contains checks are invalidated once per cancellation batch rather than per
+    /// number.
+    void insert(std::vector<NumType> nums)
+    {
+        if (nums.empty())
+        {
+            return;
+        }
+        std::sort(nums.begin(), nums.end());
+
+        // Compact the sorted batch into disjoint intervals.
+        std::vector<Interval<NumType>> batch;
+        for (auto num : nums)
+        {
+            if (batch.empty() || num > batch.back().upperEnd + 1)
+            {
+                batch.push_back(Interval<NumType>{num, num});
+            }
+            else if (num > batch.back().upperEnd)
+            {
+                batch.back().upperEnd = num;
+            }
+        }
+
+        // Merge the batch with the existing intervals in one sweep.
+        std::vector<Interval<NumType>> merged;
+        merged.reserve(mIntervals.size() + batch.size());
+        auto append = [&merged](Interval<NumType> const& interval)
+        {
+            if (!merged.empty() && interval.lowerEnd <= merged.back().upperEnd + 1)
+            {
+                merged.back().upperEnd = std::max(merged.back().upperEnd, interval.upperEnd);
+            }
+            else
+            {
+                merged.push_back(interval);
+            }
+        };
+        auto iterOld = mIntervals.begin();
+        auto iterNew = batch.begin();
+        while (iterOld != mIntervals.end() && iterNew != batch.end())
+        {
+            if (iterOld->lowerEnd <= iterNew->lowerEnd)
+            {
+                append(*iterOld++);
+            }
+            else
+            {
+                append(*iterNew++);
+            }
+        }
+        for (; iterOld != mIntervals.end(); ++iterOld)
+        {
+            append(*iterOld);
+        }
+        for (; iterNew != batch.end(); ++iterNew)
+        {
+            append(*iterNew);
+        }
+
+        SizeType32 numElements = 0;
+        for (auto const& interval : merged)
+        {
+            numElements += static_cast<SizeType32>(interval.upperEnd - interval.lowerEnd) + 1;
+        }
+        if (numElements != mNumElements)
+        {
+            mGeneration++;
+        }
+        mIntervals = std::move(merged);
+        mNumElements = numElements;
     }
 
     /// @brief Clear interval set and reset numElements to 0.
+    /// The generation is kept monotonic across clears so stale cached contains checks can never
+    /// alias a newer generation; cached negative results stay valid since clear only removes.
     void clear()
     {
         mIntervals.clear();
@@ -133,9 +236,16 @@ public:
         return mIntervals;
     }
 
+    /// @brief Return the current generation, bumped once per mutating insert or batch insert.
+    uint64_t getGeneration() const
+    {
+        return mGeneration;
+    }
+
 private:
     std::vector<Interval<NumType>> mIntervals;
     SizeType32 mNumElements{0};
+    uint64_t mGeneration{0};
 };
 
 } // namespace tensorrt_llm::executor
@@ -0,0 +1,256 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/iterationStatsRing.h"
+
+#include "tensorrt_llm/common/logger.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+namespace tensorrt_llm::executor
+{
+
+//! Lives at the start of the shared memory segment, followed by the slot array.
+//! head is the sequence number of the most recently published record; record with sequence s lives
+//! in slot (s - 1) % numSlots until it is lapped.
+struct IterationStatsRing::Header
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint64_t numSlots;
+    std::atomic<uint64_t> head;
+};
+
+//! Seqlock around one record: seq is 0 while the slot is empty, odd while a write is in flight and
+//! equal to the record's sequence number once published. A reader that observes a changed or odd seq
+//! after copying the payload discards the torn copy.
+struct IterationStatsRing::Slot
+{
+    std::atomic<uint64_t> seq;
+    IterationStatsRecord record;
+};
+
+namespace
+{
+constexpr uint64_t kRingMagic{0x4c4c54525f545349ULL}; // "IST_TRLL"
+constexpr uint32_t kRingVersion{1};
+} // namespace
+
+IterationStatsRecord IterationStatsRecord::fromStats(IterationStats const& stats)
+{
+    IterationStatsRecord record{};
+    record.timestampNs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+    record.iter = static_cast<uint64_t>(stats.iter);
+    record.iterLatencyMS = stats.iterLatencyMS;
+    record.newActiveRequestsQueueLatencyMS = stats.newActiveRequestsQueueLatencyMS;
+    record.numNewActiveRequests = stats.numNewActiveRequests;
+    record.numActiveRequests = stats.numActiveRequests;
+    record.numQueuedRequests = stats.numQueuedRequests;
+    record.numCompletedRequests = stats.numCompletedRequests;
+    record.maxNumActiveRequests = stats.maxNumActiveRequests;
+    record.maxBatchSizeRuntime = stats.maxBatchSizeRuntime;
+    record.maxNumTokensRuntime = stats.maxNumTokensRuntime;
+    record.gpuMemUsage = stats.gpuMemUsage;
+    record.cpuMemUsage = stats.cpuMemUsage;
+    record.pinnedMemUsage = stats.pinnedMemUsage;
+    if (stats.kvCacheStats)
+    {
+        record.presentMask |= kKV_CACHE_STATS_BIT;
+        record.kvCacheStats = *stats.kvCacheStats;
+    }
+    if (stats.crossKvCacheStats)
+    {
+        record.presentMask |= kCROSS_KV_CACHE_STATS_BIT;
+        record.crossKvCacheStats = *stats.crossKvCacheStats;
+    }
+    if (stats.staticBatchingStats)
+    {
+        record.presentMask |= kSTATIC_BATCHING_STATS_BIT;
+        record.staticBatchingStats = *stats.staticBatchingStats;
+    }
+    if (stats.inflightBatchingStats)
+    {
+        record.presentMask |= kINFLIGHT_BATCHING_STATS_BIT;
+        record.inflightBatchingStats = *stats.inflightBatchingStats;
+    }
+    if (stats.specDecodingStats)
+    {
+        record.presentMask |= kSPEC_DECODING_STATS_BIT;
+        record.specDecodingStats = *stats.specDecodingStats;
+    }
+    return record;
+}
+
+IterationStatsRing::IterationStatsRing(std::string name, void* shmBase, std::size_t numSlots, bool isOwner)
+    : mName(std::move(name))
+    , mShmBase(shmBase)
+    , mHeader(static_cast<Header*>(shmBase))
+    , mSlots(reinterpret_cast<Slot*>(static_cast<char*>(shmBase) + sizeof(Header)))
+    , mNumSlots(numSlots)
+    , mIsOwner(isOwner)
+{
+}
+
+#ifndef _WIN32
+
+std::unique_ptr<IterationStatsRing> IterationStatsRing::create(std::string const& name, std::size_t numSlots)
+{
+    auto const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        TLLM_LOG_WARNING("Failed to create iteration stats segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    auto const totalSize = sizeof(Header) + numSlots * sizeof(Slot);
+    if (ftruncate(fd, static_cast<off_t>(totalSize)) != 0)
+    {
+        TLLM_LOG_WARNING("Failed to size iteration stats segment %s: %s", name.c_str(), std::strerror(errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto* base = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        TLLM_LOG_WARNING("Failed to map iteration stats segment %s: %s", name.c_str(), std::strerror(errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto* header = new (base) Header{};
+    header->magic = kRingMagic;
+    header->version = kRingVersion;
+    header->recordSize = sizeof(IterationStatsRecord);
+    header->numSlots = numSlots;
+    return std::unique_ptr<IterationStatsRing>(new IterationStatsRing(name, base, numSlots, true));
+}
+
+std::unique_ptr<IterationStatsRing> IterationStatsRing::open(std::string const& name)
+{
+    auto const fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+        TLLM_LOG_WARNING("Failed to open iteration stats segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) <= sizeof(Header))
+    {
+        TLLM_LOG_WARNING("Invalid iteration stats segment %s", name.c_str());
+        close(fd);
+        return nullptr;
+    }
+    auto const totalSize = static_cast<std::size_t>(st.st_size);
+    auto* base = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        TLLM_LOG_WARNING("Failed to map iteration stats segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    auto* header = static_cast<Header*>(base);
+    if (header->magic != kRingMagic || header->version != kRingVersion
+        || header->recordSize != sizeof(IterationStatsRecord)
+        || totalSize < sizeof(Header) + header->numSlots * sizeof(Slot))
+    {
+        TLLM_LOG_WARNING("Iteration stats segment %s has an incompatible schema", name.c_str());
+        munmap(base, totalSize);
+        return nullptr;
+    }
+    return std::unique_ptr<IterationStatsRing>(
+        new IterationStatsRing(name, base, static_cast<std::size_t>(header->numSlots), false));
+}
+
+IterationStatsRing::~IterationStatsRing()
+{
+    munmap(mShmBase, sizeof(Header) + mNumSlots * sizeof(Slot));
+    if (mIsOwner)
+    {
+        shm_unlink(mName.c_str());
+    }
+}
+
+#else // _WIN32
+
+std::unique_ptr<IterationStatsRing> IterationStatsRing::create(std::string const& name, std::size_t /*numSlots*/)
+{
+    TLLM_LOG_WARNING("Iteration stats segment %s not created: unsupported on this platform", name.c_str());
+    return nullptr;
+}
+
+std::unique_ptr<IterationStatsRing> IterationStatsRing::open(std::string const& name)
+{
+    TLLM_LOG_WARNING("Iteration stats segment %s not opened: unsupported on this platform", name.c_str());
+    return nullptr;
+}
+
+IterationStatsRing::~IterationStatsRing() = default;
+
+#endif // _WIN32
+
+void IterationStatsRing::push(IterationStatsRecord const& record)
+{
+    auto const sequence = mHeader->head.load(std::memory_order_relaxed) + 1;
+    auto& slot = mSlots[(sequence - 1) % mNumSlots];
+    // Odd value marks the write in flight so a concurrent reader discards its copy.
+    slot.seq.store(sequence * 2 - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = record;
+    slot.seq.store(sequence * 2, std::memory_order_release);
+    mHeader->head.store(sequence, std::memory_order_release);
+}
+
+uint64_t IterationStatsRing::latestSequence() const
+{
+    return mHeader->head.load(std::memory_order_acquire);
+}
+
+std::optional<IterationStatsRecord> IterationStatsRing::read(uint64_t sequence) const
+{
+    if (sequence == 0 || sequence > mHeader->head.load(std::memory_order_acquire))
+    {
+        return std::nullopt;
+    }
+    auto const& slot = mSlots[(sequence - 1) % mNumSlots];
+    IterationStatsRecord record;
+    auto const seqBefore = slot.seq.load(std::memory_order_acquire);
+    record = slot.record;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto const seqAfter = slot.seq.load(std::memory_order_relaxed);
+    if (seqBefore != sequence * 2 || seqAfter != seqBefore)
+    {
+        // Torn or lapped: the writer reused the slot for a newer record.
+        return std::nullopt;
+    }
+    return record;
+}
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief Flat, fixed-schema binary record of one iteration's stats. The layout is a versioned POD so
+/// a monitoring agent can map the ring read-only and decode records without any serialization library;
+/// optional sections of IterationStats are flattened with a validity bit in `presentMask`.
+struct IterationStatsRecord
+{
+    /// @brief Bits of presentMask marking which optional sections carry data.
+    enum PresentBits : uint32_t
+    {
+        kKV_CACHE_STATS_BIT = 1U << 0,
+        kCROSS_KV_CACHE_STATS_BIT = 1U << 1,
+        kSTATIC_BATCHING_STATS_BIT = 1U << 2,
+        kINFLIGHT_BATCHING_STATS_BIT = 1U << 3,
+        kSPEC_DECODING_STATS_BIT = 1U << 4,
+    };
+
+    /// @brief Iteration end time, nanoseconds since the unix epoch (steady wall clock of the writer).
+    uint64_t timestampNs;
+    uint64_t iter;
+    double iterLatencyMS;
+    double newActiveRequestsQueueLatencyMS;
+    int32_t numNewActiveRequests;
+    int32_t numActiveRequests;
+    int32_t numQueuedRequests;
+    int32_t numCompletedRequests;
+    int32_t maxNumActiveRequests;
+    int32_t maxBatchSizeRuntime;
+    int32_t maxNumTokensRuntime;
+    uint32_t presentMask;
+    uint64_t gpuMemUsage;
+    uint64_t cpuMemUsage;
+    uint64_t pinnedMemUsage;
+    KvCacheStats kvCacheStats;
+    KvCacheStats crossKvCacheStats;
+    StaticBatchingStats staticBatchingStats;
+    InflightBatchingStats inflightBatchingStats;
+    SpecDecodingStats specDecodingStats;
+
+    /// @brief Flatten the stats the executor already gathered into the fixed schema.
+    [[nodiscard]] static IterationStatsRecord fromStats(IterationStats const& stats);
+};
+
+static_assert(std::is_trivially_copyable_v<IterationStatsRecord>,
+    "IterationStatsRecord is shared across processes and must stay a POD");
+
+/// @brief Single-writer ring of IterationStatsRecord in POSIX shared memory. The executor thread
+/// publishes one record per iteration with a seqlock per slot, so writing never blocks on readers and
+/// costs a few cache-line stores; a monitoring agent maps the segment and polls for new sequence
+/// numbers, detecting torn reads of a lapped slot by re-checking the slot sequence. Enabled by naming
+/// the segment in TRTLLM_ITER_STATS_SHM.
+class IterationStatsRing
+{
+public:
+    /// @brief Number of record slots in the ring.
+    static constexpr std::size_t kDefaultNumSlots{4096};
+
+    /// @brief Create the underlying shared memory segment. The creator owns the segment and unlinks it
+    /// on destruction. Returns nullptr if the segment cannot be created.
+    static std::unique_ptr<IterationStatsRing> create(
+        std::string const& name, std::size_t numSlots = kDefaultNumSlots);
+
+    /// @brief Attach to a segment created by the writer process. Returns nullptr if the segment cannot
+    /// be opened or its schema version does not match this build.
+    static std::unique_ptr<IterationStatsRing> open(std::string const& name);
+
+    ~IterationStatsRing();
+
+    IterationStatsRing(IterationStatsRing const&) = delete;
+    IterationStatsRing& operator=(IterationStatsRing const&) = delete;
+
+    /// @brief Publish one record. Writer side only; never blocks.
+    void push(IterationStatsRecord const& record);
+
+    /// @brief Sequence number of the most recently published record, 0 when the ring is empty.
+    [[nodiscard]] uint64_t latestSequence() const;
+
+    /// @brief Read the record with the given 1-based sequence number. Returns nullopt when the record
+    /// has not been written yet or has already been overwritten (the reader lapped).
+    [[nodiscard]] std::optional<IterationStatsRecord> read(uint64_t sequence) const;
+
+private:
+    struct Header;
+    struct Slot;
+
+    IterationStatsRing(std::string name, void* shmBase, std::size_t numSlots, bool isOwner);
+
+    std::string mName;
+    void* mShmBase;
+    Header* mHeader;
+    Slot* mSlots;
+    std::size_t mNumSlots;
+    bool mIsOwner;
+};
+
+} // namespace tensorrt_llm::executor
@@ -45,13 +45,16 @@ bool KvCacheRetentionConfig::TokenRangeRetentionConfig::operator==(TokenRangeRet
 KvCacheRetentionConfig::KvCacheRetentionConfig(
     std::vector<KvCacheRetentionConfig::TokenRangeRetentionConfig> const& tokenRangeRetentionPriorities,
     RetentionPriority decodeRetentionPriority, std::optional<std::chrono::milliseconds> decodeDurationMs,
-    KvCacheTransferMode transferMode, std::string const& directory)
+    KvCacheTransferMode transferMode, std::string const& directory, std::optional<SizeType32> attentionSinkTokenCount)
     : mTokenRangeRetentionConfigs(std::vector<TokenRangeRetentionConfig>(tokenRangeRetentionPriorities))
     , mDecodeRetentionPriority{decodeRetentionPriority}
     , mDecodeDurationMs{decodeDurationMs}
     , mTransferMode{transferMode}
     , mDirectory{directory}
+    , mAttentionSinkTokenCount{attentionSinkTokenCount}
 {
+    TLLM_CHECK_WITH_INFO(!mAttentionSinkTokenCount.has_value() || mAttentionSinkTokenCount.value() >= 0,
+        "attentionSinkTokenCount must be non-negative");
 
     // The token ranges must be non-overlapping
     // No end token indicates that the range extends to the end of the sequence
@@ -122,6 +125,11 @@ std::string const& KvCacheRetentionConfig::getDirectory() const
     return mDirectory;
 }
 
+std::optional<SizeType32> KvCacheRetentionConfig::getAttentionSinkTokenCount() const
+{
+    return mAttentionSinkTokenCount;
+}
+
 std::vector<RetentionPriorityAndDuration> KvCacheRetentionConfig::getPerBlockRetentionPriorityDuration(
     SizeType32 blockSize, SizeType32 seqLen) const
 {
@@ -76,6 +76,13 @@ public:
 
     virtual void updatePeftCache(LlmRequestPtr const& llmRequest) = 0;
 
+    /// @brief Update named engine weights in place without restarting the executor.
+    /// @details Called by the executor between iterations, so updates never race with a forward pass.
+    virtual void updateWeights(std::map<std::string, Tensor> const& weights)
+    {
+        TLLM_CHECK_WITH_INFO(false, "updateWeights is not implemented");
+    }
+
     /// @brief Reset the iteration stats when there are no inflight requests
     virtual void resetIterationStats() = 0;
 
@@ -108,6 +115,13 @@ public:
 
     [[nodiscard]] virtual DebugTensorsPerIteration getCurrentDebugTensors() const = 0;
 
+    /// @brief Write the decoder per-step timing ring as a binary trace, see DecoderTimingRing
+    /// @return Whether a trace was written; false for models without a batched decoder
+    virtual bool writeDecoderTimingTrace(std::string const& path) const
+    {
+        return false;
+    }
+
     using LogitsPostProcessorBatched = tensorrt_llm::batch_manager::LogitsPostProcessor::LogitsPostProcessorBatched;
 
     virtual void setLogitsPostProcessorBatched(std::optional<LogitsPostProcessorBatched> logitsPostProcessorBatched)
@@ -117,6 +131,8 @@ public:
 
     [[nodiscard]] virtual bool hasGuidedDecoder() const noexcept = 0;
 
+    [[nodiscard]] virtual bool hasKvCacheTransceiver() const noexcept = 0;
+
     [[nodiscard]] virtual std::shared_ptr<tensorrt_llm::batch_manager::kv_cache_manager::BaseKVCacheManager>
     getKVCacheManager() = 0;
     [[nodiscard]] virtual std::shared_ptr<tensorrt_llm::batch_manager::kv_cache_manager::BaseKVCacheManager const>
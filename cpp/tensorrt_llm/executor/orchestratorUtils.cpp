@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/orchestratorUtils.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/runtime/gptJsonConfig.h"
+#include "tensorrt_llm/runtime/utils/mpiUtils.h"
+#include "tensorrt_llm/runtime/worldConfig.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tensorrt_llm::executor
+{
+
+#if ENABLE_MULTI_DEVICE
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+// Files are broadcast between node leaders in fixed-size chunks to bound host memory while
+// staging multi-gigabyte engine shards.
+constexpr int64_t kStagingChunkBytes{256LL * 1024 * 1024};
+
+struct SourceFileInfo
+{
+    int64_t size;
+    int64_t mtime;
+};
+
+SourceFileInfo statSourceFile(fs::path const& file)
+{
+    auto const size = static_cast<int64_t>(fs::file_size(file));
+    auto const mtime = static_cast<int64_t>(fs::last_write_time(file).time_since_epoch().count());
+    return {size, mtime};
+}
+
+fs::path markerPath(fs::path const& cachedFile)
+{
+    return fs::path{cachedFile.string() + ".staged"};
+}
+
+// A staged copy is valid when its marker records the source size and mtime it was taken from and
+// the copy itself has the expected size. The marker is written only after the copy is renamed
+// into place, so a partially staged file is never considered valid.
+bool isStagedCopyValid(fs::path const& cachedFile, SourceFileInfo const& info)
+{
+    std::ifstream marker{markerPath(cachedFile)};
+    int64_t size{-1};
+    int64_t mtime{0};
+    if (!(marker >> size >> mtime) || size != info.size || mtime != info.mtime)
+    {
+        return false;
+    }
+    std::error_code ec;
+    return fs::is_regular_file(cachedFile, ec) && static_cast<int64_t>(fs::file_size(cachedFile, ec)) == info.size;
+}
+
+void finalizeStagedCopy(fs::path const& tmpFile, fs::path const& cachedFile, SourceFileInfo const& info)
+{
+    fs::rename(tmpFile, cachedFile);
+    std::ofstream marker{markerPath(cachedFile), std::ios::trunc};
+    marker << info.size << ' ' << info.mtime << '\n';
+    marker.close();
+    TLLM_CHECK_WITH_INFO(marker.good(), "Failed to write engine staging marker for %s", cachedFile.string().c_str());
+}
+
+// Engine files needed by the given session ranks: the shared config plus each rank's engine
+// shard. config.json comes first so it is staged before any shard.
+std::vector<std::string> filesNeededByRanks(
+    runtime::GptJsonConfig const& jsonConfig, std::vector<int> const& sessionRanks)
+{
+    std::set<std::string> shards;
+    for (auto const rank : sessionRanks)
+    {
+        auto const worldConfig = runtime::WorldConfig(jsonConfig.getTensorParallelism(),
+            jsonConfig.getPipelineParallelism(), jsonConfig.getContextParallelism(), rank,
+            jsonConfig.getGpusPerNode());
+        shards.insert(jsonConfig.engineFilename(worldConfig));
+    }
+    std::vector<std::string> files{"config.json"};
+    files.insert(files.end(), shards.begin(), shards.end());
+    return files;
+}
+
+// Session ranks hosted on the node of the given local communicator, derived by translating the
+// node-local members through MPI_COMM_WORLD into session rank order.
+std::vector<int> localSessionRanks(mpi::MpiComm const& session, mpi::MpiComm const& localComm)
+{
+    auto const sessionWorldRanks = mpi::getWorldRanks(session);
+    auto const localWorldRanks = mpi::getWorldRanks(localComm);
+    std::vector<int> ranks;
+    ranks.reserve(localWorldRanks.size());
+    for (auto const worldRank : localWorldRanks)
+    {
+        auto const it = std::find(sessionWorldRanks.begin(), sessionWorldRanks.end(), worldRank);
+        TLLM_CHECK_WITH_INFO(it != sessionWorldRanks.end(), "Node-local rank is not part of the MPI session");
+        ranks.push_back(static_cast<int>(std::distance(sessionWorldRanks.begin(), it)));
+    }
+    return ranks;
+}
+
+// The union of the per-node file lists, gathered over the leader communicator so the source
+// directory is read exactly once per file regardless of how shards are spread across nodes.
+std::vector<std::string> gatherFileUnion(mpi::MpiComm const& leaderComm, std::vector<std::string> const& neededFiles)
+{
+    std::string joined;
+    for (auto const& name : neededFiles)
+    {
+        joined += name;
+        joined += '\n';
+    }
+    auto const sendCount = static_cast<int>(joined.size());
+    std::vector<int> recvCounts(leaderComm.getSize());
+    leaderComm.allgather(&sendCount, recvCounts.data(), 1, mpi::MpiType::kINT32);
+
+    std::vector<int> displs(recvCounts.size());
+    int total{0};
+    for (size_t i = 0; i < recvCounts.size(); ++i)
+    {
+        displs[i] = total;
+        total += recvCounts[i];
+    }
+    std::string allJoined(total, '\0');
+    leaderComm.allgatherv(
+        joined.data(), sendCount, mpi::MpiType::kCHAR, allJoined.data(), recvCounts, displs, mpi::MpiType::kCHAR);
+
+    std::set<std::string> unique;
+    std::string name;
+    for (std::istringstream is{allJoined}; std::getline(is, name);)
+    {
+        if (!name.empty())
+        {
+            unique.insert(name);
+        }
+    }
+    unique.erase("config.json");
+    std::vector<std::string> files{"config.json"};
+    files.insert(files.end(), unique.begin(), unique.end());
+    return files;
+}
+
+// Stage one file from the source reader to every node leader whose node needs it. All leaders
+// take part in the broadcast; those whose ranks do not use the shard drop the data instead of
+// writing it, keeping the collective simple at the cost of some network traffic.
+void stageFile(mpi::MpiComm const& leaderComm, fs::path const& srcFile, fs::path const& cachedFile,
+    SourceFileInfo const& info, bool writeCopy)
+{
+    bool const isReader = leaderComm.getRank() == 0;
+
+    std::ifstream src;
+    if (isReader)
+    {
+        src.open(srcFile, std::ios::binary);
+        TLLM_CHECK_WITH_INFO(src.good(), "Failed to open engine file %s for staging", srcFile.string().c_str());
+    }
+    auto const tmpFile = fs::path{cachedFile.string() + ".tmp"};
+    std::ofstream dst;
+    if (writeCopy)
+    {
+        dst.open(tmpFile, std::ios::binary | std::ios::trunc);
+        TLLM_CHECK_WITH_INFO(dst.good(), "Failed to open staging file %s", tmpFile.string().c_str());
+    }
+
+    std::vector<char> chunk(static_cast<size_t>(std::min(info.size, kStagingChunkBytes)));
+    auto remaining = info.size;
+    while (remaining > 0)
+    {
+        auto const chunkSize = std::min(remaining, kStagingChunkBytes);
+        if (isReader)
+        {
+            src.read(chunk.data(), chunkSize);
+            TLLM_CHECK_WITH_INFO(src.gcount() == chunkSize, "Short read staging %s", srcFile.string().c_str());
+        }
+        leaderComm.bcast(chunk.data(), static_cast<size_t>(chunkSize), mpi::MpiType::kCHAR, 0);
+        if (writeCopy)
+        {
+            dst.write(chunk.data(), chunkSize);
+        }
+        remaining -= chunkSize;
+    }
+    if (writeCopy)
+    {
+        dst.close();
+        TLLM_CHECK_WITH_INFO(dst.good(), "Failed to write staged engine file %s", tmpFile.string().c_str());
+        finalizeStagedCopy(tmpFile, cachedFile, info);
+    }
+}
+
+} // namespace
+
+std::filesystem::path stageEngineToNodeLocalCache(std::filesystem::path const& modelPath)
+{
+    auto const& cacheRoot = common::getEnvEngineStagingCacheDir();
+    if (cacheRoot.empty())
+    {
+        return modelPath;
+    }
+    if (!fs::is_directory(modelPath))
+    {
+        TLLM_LOG_WARNING(
+            "Engine staging is enabled but %s is not a directory, loading it in place.", modelPath.string().c_str());
+        return modelPath;
+    }
+
+    auto const& session = mpi::MpiComm::session();
+    if (session.getSize() <= 1)
+    {
+        return modelPath;
+    }
+    auto const& localComm = mpi::MpiComm::localSession();
+    bool const isNodeLeader = localComm.getRank() == 0;
+
+    // The split is collective, so every rank takes part even though only the node leaders (color
+    // 0) use the resulting communicator for the copy plane.
+    auto const leaderComm = session.split(isNodeLeader ? 0 : 1, session.getRank());
+
+    // Per-engine cache directory: the source directory name plus a hash of its absolute path, so
+    // distinct engines with the same directory name do not collide in a shared cache root.
+    auto const srcDir = fs::absolute(modelPath).lexically_normal();
+    auto dirName = srcDir.filename().string();
+    if (dirName.empty())
+    {
+        dirName = srcDir.parent_path().filename().string();
+    }
+    auto const cacheDir
+        = fs::path(cacheRoot) / (dirName + "-" + std::to_string(std::hash<std::string>{}(srcDir.string())));
+
+    auto const jsonConfig = runtime::GptJsonConfig::parse(srcDir / "config.json");
+    auto const myFiles = filesNeededByRanks(jsonConfig, {session.getRank()});
+
+    if (isNodeLeader)
+    {
+        fs::create_directories(cacheDir);
+        auto const neededFiles = filesNeededByRanks(jsonConfig, localSessionRanks(session, localComm));
+        auto const allFiles = gatherFileUnion(leaderComm, neededFiles);
+        bool const isReader = leaderComm.getRank() == 0;
+
+        for (auto const& name : allFiles)
+        {
+            SourceFileInfo info{};
+            if (isReader)
+            {
+                info = statSourceFile(srcDir / name);
+            }
+            leaderComm.bcast(info, 0);
+
+            bool const needed = std::find(neededFiles.begin(), neededFiles.end(), name) != neededFiles.end();
+            auto const cachedFile = cacheDir / name;
+            bool const writeCopy = needed && !isStagedCopyValid(cachedFile, info);
+
+            // Skip the transfer entirely when every node already holds a valid copy, e.g. on a
+            // restart with an unchanged engine.
+            int const satisfied = writeCopy ? 0 : 1;
+            int allSatisfied{0};
+            leaderComm.allreduce(&satisfied, &allSatisfied, 1, mpi::MpiType::kINT32, mpi::MpiOp::MIN);
+            if (allSatisfied == 1)
+            {
+                continue;
+            }
+            stageFile(leaderComm, srcDir / name, cachedFile, info, writeCopy);
+            TLLM_LOG_INFO("Staged engine file %s into %s", name.c_str(), cacheDir.string().c_str());
+        }
+    }
+    else
+    {
+        // Wait for this rank's own files only: a rank whose shard is already staged (or still
+        // valid from a previous run) starts deserializing while its node leader keeps fetching
+        // the remaining shards.
+        for (auto const& name : myFiles)
+        {
+            auto const info = statSourceFile(srcDir / name);
+            auto const cachedFile = cacheDir / name;
+            auto lastLog = std::chrono::steady_clock::now();
+            while (!isStagedCopyValid(cachedFile, info))
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                auto const now = std::chrono::steady_clock::now();
+                if (now - lastLog > std::chrono::seconds(30))
+                {
+                    TLLM_LOG_INFO("Waiting for engine file %s to be staged into %s", name.c_str(),
+                        cacheDir.string().c_str());
+                    lastLog = now;
+                }
+            }
+        }
+    }
+
+    TLLM_LOG_INFO("Loading engine from node-local cache %s", cacheDir.string().c_str());
+    return cacheDir;
+}
+
+#else // ENABLE_MULTI_DEVICE
+
+std::filesystem::path stageEngineToNodeLocalCache(std::filesystem::path const& modelPath)
+{
+    return modelPath;
+}
+
+#endif // ENABLE_MULTI_DEVICE
+
+} // namespace tensorrt_llm::executor
@@ -21,12 +21,29 @@
 #include "tensorrt_llm/executor/types.h"
 
 #include <cstdint>
+#include <filesystem>
 #include <variant>
 #include <vector>
 
 namespace tensorrt_llm::executor
 {
 
+/// @brief Stage the engine directory into a node-local cache shared by all ranks on a node.
+///
+/// On multi-node runs every rank deserializes its engine shard from @p modelPath, which for a
+/// network filesystem means the same bytes are fetched once per rank. When
+/// TRTLLM_ENGINE_STAGING_CACHE_DIR is set, the first rank on each node instead copies the shards
+/// its node needs into that directory exactly once: the first node leader reads each file from the
+/// source and forwards it to the other node leaders over the MPI session, so the source filesystem
+/// is hit once per file in total. Ranks whose shards are already staged (e.g. from a previous run
+/// with the same engine) return as soon as their own files are validated and start deserializing
+/// while the remaining files are still in flight.
+///
+/// Collective over the MPI session; every rank must call it. Returns the directory the engine
+/// should be loaded from: the per-engine cache directory, or @p modelPath unchanged when staging
+/// is disabled or not applicable.
+std::filesystem::path stageEngineToNodeLocalCache(std::filesystem::path const& modelPath);
+
 enum class MpiId : uint64_t
 {
     PENDING_REQUEST = 1,
@@ -35,6 +52,8 @@ enum class MpiId : uint64_t
     TERMINATION = 4,
     ITER_STATS = 5,
     REQUEST_ITER_STATS = 6,
+    // Pending requests whose serialized payload streams to the leader in bounded chunks
+    PENDING_REQUEST_CHUNKED = 7,
 };
 
 struct PendingRequestData
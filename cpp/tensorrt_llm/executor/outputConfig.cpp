@@ -15,6 +15,7 @@
  * limitations under the License.
  */
 
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/executor/executor.h"
 
 namespace tensorrt_llm::executor
@@ -22,7 +23,8 @@ namespace tensorrt_llm::executor
 
 OutputConfig::OutputConfig(bool inReturnLogProbs, bool inReturnContextLogits, bool inReturnGenerationLogits,
     bool inExcludeInputFromOutput, bool inReturnEncoderOutput, bool inReturnPerfMetrics,
-    std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs)
+    std::optional<std::vector<AdditionalModelOutput>> additionalModelOutputs, bool inReturnDeltaLogProbs,
+    std::optional<SizeType32> inTopKLogits, bool inPackedLogProbs)
     : returnLogProbs(inReturnLogProbs)
     , returnContextLogits(inReturnContextLogits)
     , returnGenerationLogits(inReturnGenerationLogits)
@@ -30,7 +32,11 @@ OutputConfig::OutputConfig(bool inReturnLogProbs, bool inReturnContextLogits, bo
     , returnEncoderOutput(inReturnEncoderOutput)
     , returnPerfMetrics(inReturnPerfMetrics)
     , additionalModelOutputs(std::move(additionalModelOutputs))
+    , returnDeltaLogProbs(inReturnDeltaLogProbs)
+    , topKLogits(inTopKLogits)
+    , packedLogProbs(inPackedLogProbs)
 {
+    TLLM_CHECK_WITH_INFO(!topKLogits.has_value() || topKLogits.value() > 0, "topKLogits must be positive");
 }
 
 AdditionalModelOutput::AdditionalModelOutput(std::string name, bool gatherContext)
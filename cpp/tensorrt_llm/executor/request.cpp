@@ -73,7 +73,7 @@ Request& Request::operator=(Request const& other)
 
 Request& Request::operator=(Request&& other) noexcept = default;
 
-VecTokens Request::getInputTokenIds() const
+VecTokens const& Request::getInputTokenIds() const
 {
     return mImpl->getInputTokenIds();
 }
@@ -19,6 +19,7 @@
 
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/requestUtils.h"
 #include "tensorrt_llm/executor/serializeUtils.h"
 #include "tensorrt_llm/executor/tensor.h"
 #include "tensorrt_llm/executor/types.h"
@@ -49,7 +50,7 @@ public:
         std::optional<Tensor> skipCrossAttnBlocks, std::optional<GuidedDecodingParams> guidedDecodingParams,
         std::optional<SizeType32> languageAdapterUid, std::optional<MillisecondsType> allottedTimeMs,
         std::optional<CacheSaltIDType> cacheSaltID)
-        : mInputTokenIds(std::move(inputTokenIds))
+        : mInputTokenIds(internInputTokens(std::move(inputTokenIds)))
         , mMaxNewTokens(maxNewTokens)
         , mStreaming(streaming)
         , mSamplingConfig(samplingConfig)
@@ -114,9 +115,9 @@ public:
         return totalSize;
     }
 
-    [[nodiscard]] VecTokens getInputTokenIds() const
+    [[nodiscard]] VecTokens const& getInputTokenIds() const
     {
-        return mInputTokenIds;
+        return *mInputTokenIds;
     }
 
     [[nodiscard]] SizeType32 getMaxNewTokens() const
@@ -484,7 +485,7 @@ public:
 private:
     void validate()
     {
-        TLLM_CHECK(!mInputTokenIds.empty());
+        TLLM_CHECK(!mInputTokenIds->empty());
         TLLM_CHECK(mMaxNewTokens > 0);
 
         // Show warning message unless mNumReturnSequences is the default value.
@@ -519,7 +520,7 @@ private:
     template <typename Lambda>
     void visitMembers(Lambda const& lambda) const
     {
-        lambda(mInputTokenIds);
+        lambda(*mInputTokenIds);
         lambda(mMaxNewTokens);
         lambda(mStreaming);
         lambda(mSamplingConfig);
@@ -557,7 +558,8 @@ private:
         lambda(mCacheSaltID);
     }
 
-    VecTokens mInputTokenIds;
+    // Shared immutable prompt storage; identical prompts of live requests may alias one vector.
+    std::shared_ptr<VecTokens const> mInputTokenIds;
     SizeType32 mMaxNewTokens;
     bool mStreaming;
     SamplingConfig mSamplingConfig;
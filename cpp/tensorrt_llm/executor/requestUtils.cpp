@@ -17,8 +17,15 @@
 
 #include "tensorrt_llm/executor/requestUtils.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/tokenScanUtils.h"
 #include "tensorrt_llm/executor/requestWithId.h"
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 using tensorrt_llm::executor::RequestWithId;
 using tensorrt_llm::batch_manager::RequestList;
@@ -38,3 +45,100 @@ void tensorrt_llm::executor::insertRequestInOrder(std::deque<RequestWithId>& req
         [](RequestWithId const& a, RequestWithId const& b) { return a.req.getPriority() > b.req.getPriority(); });
     reqWithIdDeque.insert(it, std::move(reqWithId));
 }
+
+void tensorrt_llm::executor::insertRequestsInOrder(
+    std::deque<RequestWithId>& reqWithIdDeque, std::vector<RequestWithId>&& reqWithIds)
+{
+    auto const byPriority
+        = [](RequestWithId const& a, RequestWithId const& b) { return a.req.getPriority() > b.req.getPriority(); };
+    // Stable sort keeps the arrival order within a priority level, matching one-by-one insertion
+    std::stable_sort(std::begin(reqWithIds), std::end(reqWithIds), byPriority);
+    if (reqWithIdDeque.empty() || !byPriority(reqWithIds.front(), reqWithIdDeque.back()))
+    {
+        // Common case: no new request outranks any queued one, append the whole batch
+        reqWithIdDeque.insert(std::end(reqWithIdDeque), std::make_move_iterator(std::begin(reqWithIds)),
+            std::make_move_iterator(std::end(reqWithIds)));
+        return;
+    }
+    // Merging takes queued requests first on priority ties, like upper_bound in one-by-one insertion
+    std::deque<RequestWithId> merged;
+    std::merge(std::make_move_iterator(std::begin(reqWithIdDeque)), std::make_move_iterator(std::end(reqWithIdDeque)),
+        std::make_move_iterator(std::begin(reqWithIds)), std::make_move_iterator(std::end(reqWithIds)),
+        std::back_inserter(merged), byPriority);
+    reqWithIdDeque.swap(merged);
+}
+
+namespace
+{
+
+using tensorrt_llm::executor::VecTokens;
+
+//! Content-addressed store of the input-token vectors of live requests. Entries are weak: the
+//! store never extends the lifetime of a prompt, it only lets an enqueue whose tokens match a
+//! still-referenced prompt share that prompt's allocation.
+class InputTokensStore
+{
+public:
+    std::shared_ptr<VecTokens const> intern(VecTokens&& inputTokenIds, size_t maxEntries)
+    {
+        auto const hash = hashTokens(inputTokenIds);
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (auto bucketIt = mStore.find(hash); bucketIt != mStore.end())
+        {
+            for (auto const& weakTokens : bucketIt->second)
+            {
+                if (auto tokens = weakTokens.lock(); tokens && *tokens == inputTokenIds)
+                {
+                    return tokens;
+                }
+            }
+        }
+        auto tokens = std::make_shared<VecTokens const>(std::move(inputTokenIds));
+        if (mNumEntries >= maxEntries)
+        {
+            sweepExpired();
+        }
+        if (mNumEntries < maxEntries)
+        {
+            mStore[hash].push_back(tokens);
+            ++mNumEntries;
+        }
+        return tokens;
+    }
+
+private:
+    static size_t hashTokens(VecTokens const& tokens)
+    {
+        return tensorrt_llm::common::hashTokens(tokens.data(), tokens.size());
+    }
+
+    void sweepExpired()
+    {
+        for (auto bucketIt = mStore.begin(); bucketIt != mStore.end();)
+        {
+            auto& bucket = bucketIt->second;
+            auto const removeIt = std::remove_if(std::begin(bucket), std::end(bucket),
+                [](std::weak_ptr<VecTokens const> const& weakTokens) { return weakTokens.expired(); });
+            mNumEntries -= std::distance(removeIt, std::end(bucket));
+            bucket.erase(removeIt, std::end(bucket));
+            bucketIt = bucket.empty() ? mStore.erase(bucketIt) : std::next(bucketIt);
+        }
+    }
+
+    std::mutex mMutex;
+    std::unordered_map<size_t, std::vector<std::weak_ptr<VecTokens const>>> mStore;
+    size_t mNumEntries{0};
+};
+
+} // namespace
+
+std::shared_ptr<VecTokens const> tensorrt_llm::executor::internInputTokens(VecTokens&& inputTokenIds)
+{
+    auto const maxEntries = tensorrt_llm::common::getEnvPromptInternCacheSize();
+    if (maxEntries == 0)
+    {
+        return std::make_shared<VecTokens const>(std::move(inputTokenIds));
+    }
+    static InputTokensStore store;
+    return store.intern(std::move(inputTokenIds), maxEntries);
+}
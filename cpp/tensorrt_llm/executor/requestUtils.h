@@ -18,7 +18,10 @@
 #pragma once
 
 #include "tensorrt_llm/batch_manager/common.h"
+#include "tensorrt_llm/executor/types.h"
 #include <deque>
+#include <memory>
+#include <vector>
 
 namespace tensorrt_llm::executor
 {
@@ -30,4 +33,14 @@ void insertRequestInOrder(tensorrt_llm::batch_manager::RequestList& reqList,
 /// @brief Inserts a requestWithId into a request deque sorted by priority / arrival time
 void insertRequestInOrder(std::deque<RequestWithId>& reqWithIdDeque, RequestWithId&& reqWithId);
 
+/// @brief Inserts a batch of requestWithIds into a request deque sorted by priority / arrival time.
+///        Equivalent to inserting them one by one, but appends or merges the whole batch in a single
+///        pass so large bursts do not pay one deque insertion per request.
+void insertRequestsInOrder(std::deque<RequestWithId>& reqWithIdDeque, std::vector<RequestWithId>&& reqWithIds);
+
+/// @brief Returns shared immutable storage for the given input tokens. When prompt interning is
+///        enabled, a prompt that matches one still referenced by a live request shares that
+///        request's allocation through a content-addressed store instead of keeping its own copy.
+std::shared_ptr<VecTokens const> internInputTokens(VecTokens&& inputTokenIds);
+
 } // namespace tensorrt_llm::executor
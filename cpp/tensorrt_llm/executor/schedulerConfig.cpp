@@ -15,23 +15,31 @@
  * limitations under the License.
  */
 
+#include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/executor/executor.h"
 
 namespace tensorrt_llm::executor
 {
 
 SchedulerConfig::SchedulerConfig(CapacitySchedulerPolicy capacitySchedulerPolicy,
-    std::optional<ContextChunkingPolicy> contextChunkingPolicy, std::optional<DynamicBatchConfig> dynamicBatchConfig)
+    std::optional<ContextChunkingPolicy> contextChunkingPolicy, std::optional<DynamicBatchConfig> dynamicBatchConfig,
+    std::optional<FloatType> contextTokensPerSecond)
     : mCapacitySchedulerPolicy(capacitySchedulerPolicy)
     , mContextChunkingPolicy(std::move(contextChunkingPolicy))
     , mDynamicBatchConfig(std::move(dynamicBatchConfig))
+    , mContextTokensPerSecond(contextTokensPerSecond)
 {
+    if (mContextTokensPerSecond.has_value())
+    {
+        TLLM_CHECK(mContextTokensPerSecond.value() > 0.F);
+    }
 }
 
 bool SchedulerConfig::operator==(SchedulerConfig const& other) const
 {
     return mCapacitySchedulerPolicy == other.mCapacitySchedulerPolicy
-        && mContextChunkingPolicy == other.mContextChunkingPolicy;
+        && mContextChunkingPolicy == other.mContextChunkingPolicy
+        && mContextTokensPerSecond == other.mContextTokensPerSecond;
 }
 
 [[nodiscard]] CapacitySchedulerPolicy SchedulerConfig::getCapacitySchedulerPolicy() const
@@ -49,4 +57,9 @@ bool SchedulerConfig::operator==(SchedulerConfig const& other) const
     return mDynamicBatchConfig;
 }
 
+[[nodiscard]] std::optional<FloatType> SchedulerConfig::getContextTokensPerSecond() const
+{
+    return mContextTokensPerSecond;
+}
+
 } // namespace tensorrt_llm::executor
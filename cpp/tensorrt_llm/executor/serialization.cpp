@@ -25,6 +25,7 @@
 #include "tensorrt_llm/executor/types.h"
 #include "tensorrt_llm/runtime/cudaStream.h"
 #include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <type_traits>
@@ -229,8 +230,11 @@ OutputConfig Serialization::deserializeOutputConfig(std::istream& is)
     auto returnEncoderOutput = su::deserialize<bool>(is);
     auto returnPerfMetrics = su::deserialize<bool>(is);
     auto additionalOutputs = su::deserialize<std::optional<std::vector<AdditionalModelOutput>>>(is);
+    auto returnDeltaLogProbs = su::deserialize<bool>(is);
+    auto topKLogits = su::deserialize<std::optional<SizeType32>>(is);
+    auto packedLogProbs = su::deserialize<bool>(is);
     return OutputConfig{returnLogProbs, returnContextLogits, returnGenerationLogits, excludeInputFromOutput,
-        returnEncoderOutput, returnPerfMetrics, additionalOutputs};
+        returnEncoderOutput, returnPerfMetrics, additionalOutputs, returnDeltaLogProbs, topKLogits, packedLogProbs};
 }
 
 void Serialization::serialize(OutputConfig const& config, std::ostream& os)
@@ -242,6 +246,9 @@ void Serialization::serialize(OutputConfig const& config, std::ostream& os)
     su::serialize(config.returnEncoderOutput, os);
     su::serialize(config.returnPerfMetrics, os);
     su::serialize(config.additionalModelOutputs, os);
+    su::serialize(config.returnDeltaLogProbs, os);
+    su::serialize(config.topKLogits, os);
+    su::serialize(config.packedLogProbs, os);
 }
 
 size_t Serialization::serializedSize(OutputConfig const& config)
@@ -254,6 +261,9 @@ size_t Serialization::serializedSize(OutputConfig const& config)
     totalSize += su::serializedSize(config.returnEncoderOutput);
     totalSize += su::serializedSize(config.returnPerfMetrics);
     totalSize += su::serializedSize(config.additionalModelOutputs);
+    totalSize += su::serializedSize(config.returnDeltaLogProbs);
+    totalSize += su::serializedSize(config.topKLogits);
+    totalSize += su::serializedSize(config.packedLogProbs);
     return totalSize;
 }
 
@@ -892,13 +902,184 @@ size_t Serialization::serializedSize(SpeculativeDecodingFastLogitsInfo const& in
 }
 
 // Result
+namespace
+{
+
+// Helpers for the packed log prob encoding (OutputConfig::packedLogProbs): beam and step counts are
+// LEB128 varints and the values travel as IEEE binary16, quartering the wire size of the nested
+// float vectors. Conversions are hand-rolled since the executor library stays CUDA-header free.
+
+uint16_t floatToHalfBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t const sign = (bits >> 16) & 0x8000u;
+    int32_t const exponent = static_cast<int32_t>((bits >> 23) & 0xffu) - 127 + 15;
+    uint32_t mantissa = bits & 0x7fffffu;
+    if (exponent >= 31)
+    {
+        // Saturate overflow to infinity; keep NaN a NaN.
+        bool const isNan = ((bits & 0x7f800000u) == 0x7f800000u) && mantissa != 0;
+        return sign | 0x7c00u | (isNan ? 0x200u : 0u);
+    }
+    if (exponent <= 0)
+    {
+        if (exponent < -10)
+        {
+            return sign; // underflow to signed zero
+        }
+        mantissa |= 0x800000u;
+        uint32_t const shift = 14 - exponent;
+        auto half = static_cast<uint16_t>(sign | (mantissa >> shift));
+        half += (mantissa >> (shift - 1)) & 1u; // round to nearest
+        return half;
+    }
+    auto half = static_cast<uint16_t>(sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13));
+    half += (mantissa >> 12) & 1u; // round to nearest
+    return half;
+}
+
+float halfBitsToFloat(uint16_t half)
+{
+    uint32_t const sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+    uint32_t exponent = (half >> 10) & 0x1fu;
+    uint32_t mantissa = half & 0x3ffu;
+    uint32_t bits;
+    if (exponent == 0)
+    {
+        if (mantissa == 0)
+        {
+            bits = sign;
+        }
+        else
+        {
+            // subnormal half, normalize for float
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400u) == 0)
+            {
+                mantissa <<= 1;
+                --exponent;
+            }
+            mantissa &= 0x3ffu;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    }
+    else if (exponent == 31)
+    {
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent - 15 + 127) << 23) | (mantissa << 13);
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void serializeVarint(uint64_t value, std::ostream& os)
+{
+    while (value >= 0x80u)
+    {
+        auto const byte = static_cast<char>(value | 0x80u);
+        os.write(&byte, 1);
+        value >>= 7;
+    }
+    auto const byte = static_cast<char>(value);
+    os.write(&byte, 1);
+}
+
+uint64_t deserializeVarint(std::istream& is)
+{
+    uint64_t value = 0;
+    int shift = 0;
+    char byte;
+    do
+    {
+        is.read(&byte, 1);
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(byte) & 0x7fu) << shift;
+        shift += 7;
+    } while (static_cast<uint8_t>(byte) & 0x80u);
+    return value;
+}
+
+size_t varintSize(uint64_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80u)
+    {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+void serializePackedLogProbs(std::optional<std::vector<VecLogProbs>> const& logProbs, std::ostream& os)
+{
+    su::serialize(logProbs.has_value(), os);
+    if (!logProbs.has_value())
+    {
+        return;
+    }
+    serializeVarint(logProbs->size(), os);
+    for (auto const& beamLogProbs : logProbs.value())
+    {
+        serializeVarint(beamLogProbs.size(), os);
+        for (auto const value : beamLogProbs)
+        {
+            uint16_t const half = floatToHalfBits(value);
+            os.write(reinterpret_cast<char const*>(&half), sizeof(half));
+        }
+    }
+}
+
+std::optional<std::vector<VecLogProbs>> deserializePackedLogProbs(std::istream& is)
+{
+    auto const hasValue = su::deserialize<bool>(is);
+    if (!hasValue)
+    {
+        return std::nullopt;
+    }
+    std::vector<VecLogProbs> logProbs(deserializeVarint(is));
+    for (auto& beamLogProbs : logProbs)
+    {
+        beamLogProbs.resize(deserializeVarint(is));
+        for (auto& value : beamLogProbs)
+        {
+            uint16_t half;
+            is.read(reinterpret_cast<char*>(&half), sizeof(half));
+            value = halfBitsToFloat(half);
+        }
+    }
+    return logProbs;
+}
+
+size_t packedLogProbsSize(std::optional<std::vector<VecLogProbs>> const& logProbs)
+{
+    size_t totalSize = sizeof(bool);
+    if (!logProbs.has_value())
+    {
+        return totalSize;
+    }
+    totalSize += varintSize(logProbs->size());
+    for (auto const& beamLogProbs : logProbs.value())
+    {
+        totalSize += varintSize(beamLogProbs.size()) + beamLogProbs.size() * sizeof(uint16_t);
+    }
+    return totalSize;
+}
+
+} // namespace
+
 Result Serialization::deserializeResult(std::istream& is)
 {
     Result result{};
     result.isFinal = su::deserialize<bool>(is);
     result.outputTokenIds = su::deserialize<BeamTokens>(is);
     result.cumLogProbs = su::deserialize<std::optional<VecLogProbs>>(is);
-    result.logProbs = su::deserialize<std::optional<std::vector<VecLogProbs>>>(is);
+    result.packedLogProbs = su::deserialize<bool>(is);
+    result.logProbs = result.packedLogProbs ? deserializePackedLogProbs(is)
+                                            : su::deserialize<std::optional<std::vector<VecLogProbs>>>(is);
     result.contextLogits = su::deserialize<std::optional<Tensor>>(is);
     result.generationLogits = su::deserialize<std::optional<Tensor>>(is);
     result.specDecFastLogitsInfo = su::deserialize<std::optional<SpeculativeDecodingFastLogitsInfo>>(is);
@@ -911,6 +1092,8 @@ Result Serialization::deserializeResult(std::istream& is)
     result.isSequenceFinal = su::deserialize<bool>(is);
     result.requestPerfMetrics = su::deserialize<std::optional<RequestPerfMetrics>>(is);
     result.additionalOutputs = su::deserialize<std::vector<AdditionalOutput>>(is);
+    result.logProbsOffset = su::deserialize<std::optional<SizeType32>>(is);
+    result.generationLogitsTopKIndices = su::deserialize<std::optional<Tensor>>(is);
     return result;
 }
 
@@ -919,7 +1102,15 @@ void Serialization::serialize(Result const& result, std::ostream& os)
     su::serialize(result.isFinal, os);
     su::serialize(result.outputTokenIds, os);
     su::serialize(result.cumLogProbs, os);
-    su::serialize(result.logProbs, os);
+    su::serialize(result.packedLogProbs, os);
+    if (result.packedLogProbs)
+    {
+        serializePackedLogProbs(result.logProbs, os);
+    }
+    else
+    {
+        su::serialize(result.logProbs, os);
+    }
     su::serialize(result.contextLogits, os);
     su::serialize(result.generationLogits, os);
     su::serialize(result.specDecFastLogitsInfo, os);
@@ -932,6 +1123,8 @@ void Serialization::serialize(Result const& result, std::ostream& os)
     su::serialize(result.isSequenceFinal, os);
     su::serialize(result.requestPerfMetrics, os);
     su::serialize(result.additionalOutputs, os);
+    su::serialize(result.logProbsOffset, os);
+    su::serialize(result.generationLogitsTopKIndices, os);
 }
 
 size_t Serialization::serializedSize(Result const& result)
@@ -940,7 +1133,8 @@ size_t Serialization::serializedSize(Result const& result)
     totalSize += su::serializedSize(result.isFinal);
     totalSize += su::serializedSize(result.outputTokenIds);
     totalSize += su::serializedSize(result.cumLogProbs);
-    totalSize += su::serializedSize(result.logProbs);
+    totalSize += su::serializedSize(result.packedLogProbs);
+    totalSize += result.packedLogProbs ? packedLogProbsSize(result.logProbs) : su::serializedSize(result.logProbs);
     totalSize += su::serializedSize(result.contextLogits);
     totalSize += su::serializedSize(result.specDecFastLogitsInfo);
     totalSize += su::serializedSize(result.generationLogits);
@@ -953,6 +1147,8 @@ size_t Serialization::serializedSize(Result const& result)
     totalSize += su::serializedSize(result.isSequenceFinal);
     totalSize += su::serializedSize(result.requestPerfMetrics);
     totalSize += su::serializedSize(result.additionalOutputs);
+    totalSize += su::serializedSize(result.logProbsOffset);
+    totalSize += su::serializedSize(result.generationLogitsTopKIndices);
     return totalSize;
 }
 
@@ -1254,7 +1450,8 @@ SchedulerConfig Serialization::deserializeSchedulerConfig(std::istream& is)
     auto capacitySchedulerPolicy = su::deserialize<CapacitySchedulerPolicy>(is);
     auto contextChunkingPolicy = su::deserialize<std::optional<ContextChunkingPolicy>>(is);
     auto dynamicBatchConfig = su::deserialize<std::optional<DynamicBatchConfig>>(is);
-    return SchedulerConfig{capacitySchedulerPolicy, contextChunkingPolicy, dynamicBatchConfig};
+    auto contextTokensPerSecond = su::deserialize<std::optional<FloatType>>(is);
+    return SchedulerConfig{capacitySchedulerPolicy, contextChunkingPolicy, dynamicBatchConfig, contextTokensPerSecond};
 }
 
 void Serialization::serialize(SchedulerConfig const& schedulerConfig, std::ostream& os)
@@ -1262,6 +1459,7 @@ void Serialization::serialize(SchedulerConfig const& schedulerConfig, std::ostre
     su::serialize(schedulerConfig.getCapacitySchedulerPolicy(), os);
     su::serialize(schedulerConfig.getContextChunkingPolicy(), os);
     su::serialize(schedulerConfig.getDynamicBatchConfig(), os);
+    su::serialize(schedulerConfig.getContextTokensPerSecond(), os);
 }
 
 size_t Serialization::serializedSize(SchedulerConfig const& schedulerConfig)
@@ -1270,6 +1468,7 @@ size_t Serialization::serializedSize(SchedulerConfig const& schedulerConfig)
     totalSize += su::serializedSize(schedulerConfig.getCapacitySchedulerPolicy());
     totalSize += su::serializedSize(schedulerConfig.getContextChunkingPolicy());
     totalSize += su::serializedSize(schedulerConfig.getDynamicBatchConfig());
+    totalSize += su::serializedSize(schedulerConfig.getContextTokensPerSecond());
     return totalSize;
 }
 
@@ -1462,8 +1661,9 @@ LookaheadDecodingConfig Serialization::deserializeLookaheadDecodingConfig(std::i
     auto ngramSize = su::deserialize<SizeType32>(is);
     auto windowSize = su::deserialize<SizeType32>(is);
     auto verificationSetSize = su::deserialize<SizeType32>(is);
+    auto usePoolCache = su::deserialize<bool>(is);
 
-    return LookaheadDecodingConfig{windowSize, ngramSize, verificationSetSize};
+    return LookaheadDecodingConfig{windowSize, ngramSize, verificationSetSize, usePoolCache};
 }
 
 void Serialization::serialize(LookaheadDecodingConfig const& lookaheadDecodingConfig, std::ostream& os)
@@ -1471,6 +1671,7 @@ void Serialization::serialize(LookaheadDecodingConfig const& lookaheadDecodingCo
     su::serialize(lookaheadDecodingConfig.getNgramSize(), os);
     su::serialize(lookaheadDecodingConfig.getWindowSize(), os);
     su::serialize(lookaheadDecodingConfig.getVerificationSetSize(), os);
+    su::serialize(lookaheadDecodingConfig.getUsePoolCache(), os);
 }
 
 size_t Serialization::serializedSize(LookaheadDecodingConfig const& lookaheadDecodingConfig)
@@ -1479,6 +1680,7 @@ size_t Serialization::serializedSize(LookaheadDecodingConfig const& lookaheadDec
     totalSize += su::serializedSize(lookaheadDecodingConfig.getNgramSize());
     totalSize += su::serializedSize(lookaheadDecodingConfig.getWindowSize());
     totalSize += su::serializedSize(lookaheadDecodingConfig.getVerificationSetSize());
+    totalSize += su::serializedSize(lookaheadDecodingConfig.getUsePoolCache());
     return totalSize;
 }
 
@@ -1519,18 +1721,21 @@ size_t Serialization::serializedSize(EagleConfig const& eagleConfig)
 SpeculativeDecodingConfig Serialization::deserializeSpeculativeDecodingConfig(std::istream& is)
 {
     auto fastLogits = su::deserialize<decltype(SpeculativeDecodingConfig::fastLogits)>(is);
-    return SpeculativeDecodingConfig(fastLogits);
+    auto dynamicDraftLen = su::deserialize<decltype(SpeculativeDecodingConfig::dynamicDraftLen)>(is);
+    return SpeculativeDecodingConfig(fastLogits, dynamicDraftLen);
 }
 
 void Serialization::serialize(SpeculativeDecodingConfig const& specDecConfig, std::ostream& os)
 {
     su::serialize(specDecConfig.fastLogits, os);
+    su::serialize(specDecConfig.dynamicDraftLen, os);
 }
 
 size_t Serialization::serializedSize(SpeculativeDecodingConfig const& specDecConfig)
 {
     size_t totalSize = 0;
     totalSize += su::serializedSize(specDecConfig.fastLogits);
+    totalSize += su::serializedSize(specDecConfig.dynamicDraftLen);
     return totalSize;
 }
 
@@ -1603,9 +1808,10 @@ KvCacheRetentionConfig Serialization::deserializeKvCacheRetentionConfig(std::ist
     auto decodeDurationMs = intToDuration(su::deserialize<std::optional<size_t>>(is));
     auto transferMode = su::deserialize<executor::KvCacheTransferMode>(is);
     auto directory = su::deserialize<std::string>(is);
+    auto attentionSinkTokenCount = su::deserialize<std::optional<SizeType32>>(is);
 
-    return KvCacheRetentionConfig{
-        tokenRangeRetentionPriorities, decodePriority, decodeDurationMs, transferMode, directory};
+    return KvCacheRetentionConfig{tokenRangeRetentionPriorities, decodePriority, decodeDurationMs, transferMode,
+        directory, attentionSinkTokenCount};
 }
 
 void Serialization::serialize(KvCacheRetentionConfig const& kvCacheRetentionConfig, std::ostream& os)
@@ -1615,6 +1821,7 @@ void Serialization::serialize(KvCacheRetentionConfig const& kvCacheRetentionConf
     su::serialize(durationToInt(kvCacheRetentionConfig.getDecodeDurationMs()), os);
     su::serialize(kvCacheRetentionConfig.getTransferMode(), os);
     su::serialize(kvCacheRetentionConfig.getDirectory(), os);
+    su::serialize(kvCacheRetentionConfig.getAttentionSinkTokenCount(), os);
 }
 
 size_t Serialization::serializedSize(KvCacheRetentionConfig const& config)
@@ -1625,6 +1832,7 @@ size_t Serialization::serializedSize(KvCacheRetentionConfig const& config)
     totalSize += su::serializedSize(durationToInt(config.getDecodeDurationMs()));
     totalSize += su::serializedSize(config.getTransferMode());
     totalSize += su::serializedSize(config.getDirectory());
+    totalSize += su::serializedSize(config.getAttentionSinkTokenCount());
     return totalSize;
 }
 
@@ -2077,10 +2285,14 @@ RequestStats Serialization::deserializeRequestStats(std::istream& is)
     auto reusedBlocksPerRequest = su::deserialize<SizeType32>(is);
     auto missedBlocksPerRequest = su::deserialize<SizeType32>(is);
     auto kvCacheHitRatePerRequest = su::deserialize<FloatType>(is);
+    auto timeInQueueMS = su::deserialize<double>(is);
+    auto contextLatencyMS = su::deserialize<double>(is);
+    auto lastTokenLatenciesMS = su::deserialize<std::vector<double>>(is);
 
     return RequestStats{id, stage, contextPrefillPosition, numGeneratedTokens, avgNumDecodedTokensPerIter, scheduled,
         paused, disServingStats, allocTotalBlocksPerRequest, allocNewBlocksPerRequest, reusedBlocksPerRequest,
-        missedBlocksPerRequest, kvCacheHitRatePerRequest};
+        missedBlocksPerRequest, kvCacheHitRatePerRequest, timeInQueueMS, contextLatencyMS,
+        std::move(lastTokenLatenciesMS)};
 }
 
 void Serialization::serialize(RequestStats const& state, std::ostream& os)
@@ -2098,6 +2310,9 @@ void Serialization::serialize(RequestStats const& state, std::ostream& os)
     su::serialize(state.reusedBlocksPerRequest, os);
     su::serialize(state.missedBlocksPerRequest, os);
     su::serialize(state.kvCacheHitRatePerRequest, os);
+    su::serialize(state.timeInQueueMS, os);
+    su::serialize(state.contextLatencyMS, os);
+    su::serialize(state.lastTokenLatenciesMS, os);
 }
 
 size_t Serialization::serializedSize(RequestStats const& state)
@@ -2117,6 +2332,9 @@ size_t Serialization::serializedSize(RequestStats const& state)
     totalSize += su::serializedSize(state.reusedBlocksPerRequest);
     totalSize += su::serializedSize(state.missedBlocksPerRequest);
     totalSize += su::serializedSize(state.kvCacheHitRatePerRequest);
+    totalSize += su::serializedSize(state.timeInQueueMS);
+    totalSize += su::serializedSize(state.contextLatencyMS);
+    totalSize += su::serializedSize(state.lastTokenLatenciesMS);
     return totalSize;
 }
 
@@ -45,6 +45,18 @@ public:
     }
 };
 
+//! Write counterpart of VectorWrapBuf: serializes straight into a pre-sized vector,
+//! avoiding the intermediate string copy an ostringstream would make.
+template <typename CharT, typename TraitsT = std::char_traits<CharT>>
+class VectorSinkBuf : public std::basic_streambuf<CharT, TraitsT>
+{
+public:
+    explicit VectorSinkBuf(std::vector<CharT>& vec)
+    {
+        std::streambuf::setp(vec.data(), vec.data() + vec.size());
+    }
+};
+
 template <typename T, typename = void>
 struct ValueType
 {
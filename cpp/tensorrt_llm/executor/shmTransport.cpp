@@ -0,0 +1,217 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/shmTransport.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace tensorrt_llm::executor
+{
+
+//! Lives at the start of the shared memory segment, followed by the ring storage.
+//! head and tail are monotonically increasing byte counts; head - tail is the amount of unread data.
+struct ShmChannel::Header
+{
+    std::atomic<std::uint64_t> head;
+    std::atomic<std::uint64_t> tail;
+    std::uint64_t capacity;
+};
+
+namespace
+{
+// Sleep interval while waiting for the peer to produce or consume data.
+constexpr auto kPollInterval = std::chrono::microseconds(50);
+} // namespace
+
+ShmChannel::ShmChannel(std::string name, void* shmBase, std::size_t capacity, bool isOwner)
+    : mName(std::move(name))
+    , mShmBase(shmBase)
+    , mHeader(static_cast<Header*>(shmBase))
+    , mData(static_cast<char*>(shmBase) + sizeof(Header))
+    , mCapacity(capacity)
+    , mIsOwner(isOwner)
+{
+}
+
+#ifndef _WIN32
+
+std::unique_ptr<ShmChannel> ShmChannel::create(std::string const& name, std::size_t capacity)
+{
+    auto const fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0)
+    {
+        TLLM_LOG_WARNING("Failed to create shared memory segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    auto const totalSize = sizeof(Header) + capacity;
+    if (ftruncate(fd, static_cast<off_t>(totalSize)) != 0)
+    {
+        TLLM_LOG_WARNING("Failed to size shared memory segment %s: %s", name.c_str(), std::strerror(errno));
+        close(fd);
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto* base = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        TLLM_LOG_WARNING("Failed to map shared memory segment %s: %s", name.c_str(), std::strerror(errno));
+        shm_unlink(name.c_str());
+        return nullptr;
+    }
+    auto* header = new (base) Header{};
+    header->capacity = capacity;
+    return std::unique_ptr<ShmChannel>(new ShmChannel(name, base, capacity, true));
+}
+
+std::unique_ptr<ShmChannel> ShmChannel::open(std::string const& name)
+{
+    auto const fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0)
+    {
+        TLLM_LOG_WARNING("Failed to open shared memory segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) <= sizeof(Header))
+    {
+        TLLM_LOG_WARNING("Invalid shared memory segment %s", name.c_str());
+        close(fd);
+        return nullptr;
+    }
+    auto const totalSize = static_cast<std::size_t>(st.st_size);
+    auto* base = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED)
+    {
+        TLLM_LOG_WARNING("Failed to map shared memory segment %s: %s", name.c_str(), std::strerror(errno));
+        return nullptr;
+    }
+    return std::unique_ptr<ShmChannel>(new ShmChannel(name, base, totalSize - sizeof(Header), false));
+}
+
+ShmChannel::~ShmChannel()
+{
+    munmap(mShmBase, sizeof(Header) + mCapacity);
+    if (mIsOwner)
+    {
+        shm_unlink(mName.c_str());
+    }
+}
+
+#else // _WIN32
+
+std::unique_ptr<ShmChannel> ShmChannel::create(std::string const& /*name*/, std::size_t /*capacity*/)
+{
+    return nullptr;
+}
+
+std::unique_ptr<ShmChannel> ShmChannel::open(std::string const& /*name*/)
+{
+    return nullptr;
+}
+
+ShmChannel::~ShmChannel() = default;
+
+#endif // _WIN32
+
+void ShmChannel::writeBytes(void const* data, std::size_t size)
+{
+    auto const* src = static_cast<char const*>(data);
+    std::size_t written = 0;
+    while (written < size)
+    {
+        auto const head = mHeader->head.load(std::memory_order_relaxed);
+        auto const tail = mHeader->tail.load(std::memory_order_acquire);
+        auto const freeBytes = mCapacity - static_cast<std::size_t>(head - tail);
+        if (freeBytes == 0)
+        {
+            std::this_thread::sleep_for(kPollInterval);
+            continue;
+        }
+        auto const chunk = std::min(freeBytes, size - written);
+        auto const offset = static_cast<std::size_t>(head % mCapacity);
+        auto const contiguous = std::min(chunk, mCapacity - offset);
+        std::memcpy(mData + offset, src + written, contiguous);
+        std::memcpy(mData, src + written + contiguous, chunk - contiguous);
+        written += chunk;
+        mHeader->head.store(head + chunk, std::memory_order_release);
+    }
+}
+
+void ShmChannel::readBytes(void* data, std::size_t size)
+{
+    auto* dst = static_cast<char*>(data);
+    std::size_t consumed = 0;
+    while (consumed < size)
+    {
+        auto const head = mHeader->head.load(std::memory_order_acquire);
+        auto const tail = mHeader->tail.load(std::memory_order_relaxed);
+        auto const available = static_cast<std::size_t>(head - tail);
+        if (available == 0)
+        {
+            std::this_thread::sleep_for(kPollInterval);
+            continue;
+        }
+        auto const chunk = std::min(available, size - consumed);
+        auto const offset = static_cast<std::size_t>(tail % mCapacity);
+        auto const contiguous = std::min(chunk, mCapacity - offset);
+        std::memcpy(dst + consumed, mData + offset, contiguous);
+        std::memcpy(dst + consumed + contiguous, mData, chunk - contiguous);
+        consumed += chunk;
+        mHeader->tail.store(tail + chunk, std::memory_order_release);
+    }
+}
+
+void ShmChannel::send(MpiId id, void const* data, std::size_t size)
+{
+    std::uint64_t const frame[2] = {static_cast<std::uint64_t>(id), static_cast<std::uint64_t>(size)};
+    writeBytes(frame, sizeof(frame));
+    if (size > 0)
+    {
+        writeBytes(data, size);
+    }
+}
+
+std::pair<MpiId, std::vector<char>> ShmChannel::recv()
+{
+    std::uint64_t frame[2] = {};
+    readBytes(frame, sizeof(frame));
+    std::vector<char> payload(frame[1]);
+    if (!payload.empty())
+    {
+        readBytes(payload.data(), payload.size());
+    }
+    return {static_cast<MpiId>(frame[0]), std::move(payload)};
+}
+
+} // namespace tensorrt_llm::executor
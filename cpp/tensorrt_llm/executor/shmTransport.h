@@ -0,0 +1,76 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/orchestratorUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief Single-producer single-consumer byte ring in POSIX shared memory, used as the transport for
+/// orchestrator <-> leader messages when both processes run on the same host. Messages keep the
+/// (MpiId, payload) framing of the MPI transport; payloads larger than the ring are streamed through it
+/// chunk by chunk, so the ring size only bounds memory usage, not message size.
+class ShmChannel
+{
+public:
+    /// @brief Ring capacity per direction.
+    static constexpr std::size_t kDefaultCapacity{std::size_t{1} << 26}; // 64 MiB
+
+    /// @brief Create the underlying shared memory segment. The creator owns the segment and unlinks it
+    /// on destruction. Returns nullptr if the segment cannot be created.
+    static std::unique_ptr<ShmChannel> create(std::string const& name, std::size_t capacity = kDefaultCapacity);
+
+    /// @brief Attach to a segment created by the peer process. Returns nullptr if the segment cannot be opened.
+    static std::unique_ptr<ShmChannel> open(std::string const& name);
+
+    ~ShmChannel();
+
+    ShmChannel(ShmChannel const&) = delete;
+    ShmChannel& operator=(ShmChannel const&) = delete;
+
+    /// @brief Copy a message into the ring. Blocks while the ring is full.
+    void send(MpiId id, void const* data, std::size_t size);
+
+    /// @brief Pop the next message from the ring. Blocks while the ring is empty.
+    [[nodiscard]] std::pair<MpiId, std::vector<char>> recv();
+
+private:
+    struct Header;
+
+    ShmChannel(std::string name, void* shmBase, std::size_t capacity, bool isOwner);
+
+    void writeBytes(void const* data, std::size_t size);
+    void readBytes(void* data, std::size_t size);
+
+    std::string mName;
+    void* mShmBase;
+    Header* mHeader;
+    char* mData;
+    std::size_t mCapacity;
+    bool mIsOwner;
+};
+
+} // namespace tensorrt_llm::executor
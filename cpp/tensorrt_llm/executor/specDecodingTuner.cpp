@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/executor/specDecodingTuner.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+#include <algorithm>
+
+namespace
+{
+using namespace tensorrt_llm::executor;
+
+template <typename TValue, typename TSum>
+void updateStats(TValue value, std::deque<TValue>& stats, TSum& sum, SizeType32 windowSize)
+{
+    while (static_cast<SizeType32>(stats.size()) >= windowSize)
+    {
+        sum -= stats.front();
+        stats.pop_front();
+    }
+    stats.push_back(value);
+    sum += value;
+}
+} // namespace
+
+namespace tensorrt_llm::executor
+{
+
+SpecDecodingTuner::SpecDecodingTuner(SpeculativeDecodingConfig const& config, SizeType32 movingAverageWindow)
+    : mDraftLenTuningEnabled(config.dynamicDraftLen)
+    , mMovingAverageWindow(movingAverageWindow)
+{
+    TLLM_CHECK_WITH_INFO(mMovingAverageWindow > 0, "Moving average window must be positive.");
+}
+
+void SpecDecodingTuner::updateAcceptanceStats(SizeType32 numDraftTokens, double numAcceptedTokens)
+{
+    if (numDraftTokens <= 0)
+    {
+        return;
+    }
+    ::updateStats(numDraftTokens, mDraftTokensStats, mDraftTokensSum, mMovingAverageWindow);
+    ::updateStats(numAcceptedTokens, mAcceptedTokensStats, mAcceptedTokensSum, mMovingAverageWindow);
+    ++mRequestsSinceAdjustment;
+}
+
+double SpecDecodingTuner::getAverageAcceptanceRate() const
+{
+    return mDraftTokensSum == 0 ? 0 : mAcceptedTokensSum / mDraftTokensSum;
+}
+
+SizeType32 SpecDecodingTuner::getRuntimeDraftLen(SizeType32 maxDraftLen)
+{
+    if (mRuntimeDraftLen == 0)
+    {
+        // Start optimistic at the engine limit; the acceptance feedback below walks it down if drafts don't pay off.
+        mRuntimeDraftLen = maxDraftLen;
+    }
+    // Wait until the moving average has settled after the last adjustment before reacting again.
+    auto const minRequestsBeforeAdjustment = std::min(kAdjustmentInterval, mMovingAverageWindow);
+    if (mRequestsSinceAdjustment < minRequestsBeforeAdjustment)
+    {
+        return mRuntimeDraftLen;
+    }
+    auto const acceptanceRate = getAverageAcceptanceRate();
+    if (acceptanceRate < kAcceptanceLowWatermark && mRuntimeDraftLen > kMinRuntimeDraftLen)
+    {
+        --mRuntimeDraftLen;
+        mRequestsSinceAdjustment = 0;
+        TLLM_LOG_DEBUG("Average draft acceptance rate %.3f is below %.3f, reducing runtime draft length to %d",
+            acceptanceRate, kAcceptanceLowWatermark, mRuntimeDraftLen);
+    }
+    else if (acceptanceRate > kAcceptanceHighWatermark && mRuntimeDraftLen < maxDraftLen)
+    {
+        ++mRuntimeDraftLen;
+        mRequestsSinceAdjustment = 0;
+        TLLM_LOG_DEBUG("Average draft acceptance rate %.3f is above %.3f, raising runtime draft length to %d",
+            acceptanceRate, kAcceptanceHighWatermark, mRuntimeDraftLen);
+    }
+    return std::min(mRuntimeDraftLen, maxDraftLen);
+}
+
+} // namespace tensorrt_llm::executor
@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/types.h"
+
+#include <deque>
+
+namespace tensorrt_llm::executor
+{
+
+/// @brief A class that maintains draft token acceptance statistics and computes the runtime draft length for
+///        speculative decoding with external draft tokens.
+class SpecDecodingTuner
+{
+public:
+    static SizeType32 const kDefaultMovingAverageWindow = 128;
+
+    explicit SpecDecodingTuner(
+        SpeculativeDecodingConfig const& config, SizeType32 movingAverageWindow = kDefaultMovingAverageWindow);
+
+    /// @brief Check if dynamic draft length tuning is enabled.
+    [[nodiscard]] bool isDraftLenTuningEnabled() const
+    {
+        return mDraftLenTuningEnabled;
+    }
+
+    /// @brief Update current stats given the draft length and the average number of accepted draft tokens per
+    ///        iteration from a single finished request.
+    void updateAcceptanceStats(SizeType32 numDraftTokens, double numAcceptedTokens);
+
+    /// @brief Get the average acceptance rate, defined as accepted draft tokens over proposed draft tokens.
+    [[nodiscard]] double getAverageAcceptanceRate() const;
+
+    /// @brief Get the dynamic draft length based on the current statistics. Drafts longer than the returned value
+    ///        do not pay off at the observed acceptance rate and should be truncated.
+    [[nodiscard]] SizeType32 getRuntimeDraftLen(SizeType32 maxDraftLen);
+
+private:
+    bool mDraftLenTuningEnabled = false;
+
+    SizeType32 mMovingAverageWindow = 0;
+
+    // 0 means uninitialized; the first call to getRuntimeDraftLen starts from maxDraftLen.
+    SizeType32 mRuntimeDraftLen = 0;
+    SizeType32 mRequestsSinceAdjustment = 0;
+
+    int64_t mDraftTokensSum = 0;
+    std::deque<SizeType32> mDraftTokensStats;
+
+    double mAcceptedTokensSum = 0;
+    std::deque<double> mAcceptedTokensStats;
+
+    // Hysteresis band on the acceptance rate: shorten the draft when acceptance drops below the low watermark,
+    // lengthen it again when acceptance recovers above the high watermark, and react at most once per
+    // adjustment interval so the moving average can settle in between.
+    static double constexpr kAcceptanceHighWatermark = 0.7;
+    static double constexpr kAcceptanceLowWatermark = 0.4;
+    static SizeType32 const kMinRuntimeDraftLen = 1;
+    static SizeType32 const kAdjustmentInterval = 32;
+};
+
+} // namespace tensorrt_llm::executor
@@ -20,14 +20,15 @@
 namespace tensorrt_llm::executor
 {
 
-SpeculativeDecodingConfig::SpeculativeDecodingConfig(bool inFastLogits)
+SpeculativeDecodingConfig::SpeculativeDecodingConfig(bool inFastLogits, bool inDynamicDraftLen)
     : fastLogits(inFastLogits)
+    , dynamicDraftLen(inDynamicDraftLen)
 {
 }
 
 bool SpeculativeDecodingConfig::operator==(SpeculativeDecodingConfig const& other) const
 {
-    return fastLogits == other.fastLogits;
+    return fastLogits == other.fastLogits && dynamicDraftLen == other.dynamicDraftLen;
 }
 
 Tensor SpeculativeDecodingFastLogitsInfo::toTensor() const
@@ -17,6 +17,7 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/orchestratorUtils.h"
 #include "tensorrt_llm/executor/serialization.h"
 #include "tensorrt_llm/plugins/api/tllmPlugin.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
@@ -36,7 +37,8 @@ int main(int argc, char* argv[])
     // Register the TRT-LLM plugins
     initTrtLlmPlugins();
 
-    tensorrt_llm::mpi::initialize(tensorrt_llm::mpi::MpiThreadSupport::THREAD_MULTIPLE, true);
+    // The worker always talks to its parent over MPI, so never take the single-process fast path.
+    tensorrt_llm::mpi::forceInitialize(tensorrt_llm::mpi::MpiThreadSupport::THREAD_MULTIPLE, true);
 
     MPI_Comm parentComm;
     MPI_Comm_get_parent(&parentComm);
@@ -79,8 +81,13 @@ int main(int argc, char* argv[])
     auto newOrchConfig = tle::OrchestratorConfig(false, orchConfig.getWorkerExecutablePath(), orchLeaderComm);
     parallelConfig.value().setOrchestratorConfig(newOrchConfig);
     executorConfig.setParallelConfig(parallelConfig.value());
+    // Stage the engine into a node-local cache (once per node) before constructing the executor,
+    // so multi-node bring-up does not re-read the engine from a network filesystem on every rank.
+    // No-op unless TRTLLM_ENGINE_STAGING_CACHE_DIR is set.
+    auto const stagedModelPath = tle::stageEngineToNodeLocalCache(modelPath);
+
     // In orchestrator mode, the spawned threads will wait for termination signal from orchestrator
-    auto executor = tle::Executor(modelPath, modelType, executorConfig);
+    auto executor = tle::Executor(stagedModelPath.string(), modelType, executorConfig);
 
     // Wait for all workers to have created their instances
     MPI_Barrier(parentComm);
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/kernels/attentionSelectionTuner.h"
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+
+namespace
+{
+
+// Samples discarded per path before timing starts, and timed samples per path before a bucket resolves.
+constexpr std::int32_t kWarmupSamples = 3;
+constexpr std::int32_t kMeasureSamples = 16;
+constexpr std::int32_t kTotalSamples = kWarmupSamples + kMeasureSamples;
+
+std::int8_t log2Ceil(std::int64_t value)
+{
+    std::int8_t log2 = 0;
+    while ((std::int64_t{1} << log2) < value)
+    {
+        ++log2;
+    }
+    return log2;
+}
+
+} // namespace
+
+struct AttentionSelectionTuner::Measurement
+{
+    cudaEvent_t start = nullptr;
+    cudaEvent_t stop = nullptr;
+    BucketKey bucket{};
+    Choice choice = Choice::kXQA;
+};
+
+bool AttentionSelectionTuner::BucketKey::operator==(BucketKey const& other) const
+{
+    return numQHeads == other.numQHeads && numKvHeads == other.numKvHeads && headSize == other.headSize
+        && beamWidth == other.beamWidth && dataType == other.dataType && kvCacheDataType == other.kvCacheDataType
+        && log2BatchSize == other.log2BatchSize && log2KvLength == other.log2KvLength
+        && pagedKvCache == other.pagedKvCache;
+}
+
+std::size_t AttentionSelectionTuner::BucketKeyHash::operator()(BucketKey const& key) const
+{
+    auto const lo = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.numQHeads)) << 32)
+        | static_cast<std::uint32_t>(key.numKvHeads);
+    auto const hi = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.headSize)) << 32)
+        | (static_cast<std::uint32_t>(key.beamWidth) << 16) | (static_cast<std::uint8_t>(key.dataType) << 12)
+        | (static_cast<std::uint8_t>(key.kvCacheDataType) << 8) | (static_cast<std::uint8_t>(key.log2BatchSize) << 4)
+        | (static_cast<std::uint8_t>(key.log2KvLength) << 1) | static_cast<std::uint64_t>(key.pagedKvCache);
+    return std::hash<std::uint64_t>{}(lo) ^ (std::hash<std::uint64_t>{}(hi) << 1);
+}
+
+AttentionSelectionTuner& AttentionSelectionTuner::getInstance()
+{
+    static AttentionSelectionTuner instance;
+    return instance;
+}
+
+AttentionSelectionTuner::AttentionSelectionTuner()
+{
+    mAutotuneEnabled = common::getEnvXqaAutotune();
+    mProfilePath = common::getEnvXqaSelectionProfile();
+
+    cudaDeviceProp prop{};
+    int device = 0;
+    TLLM_CUDA_CHECK(cudaGetDevice(&device));
+    TLLM_CUDA_CHECK(cudaGetDeviceProperties(&prop, device));
+    std::string deviceName{prop.name};
+    std::replace(deviceName.begin(), deviceName.end(), ' ', '_');
+    mDeviceKey = common::fmtstr("%s_sm%d", deviceName.c_str(), common::getSMVersion());
+
+    if (!mProfilePath.empty())
+    {
+        std::lock_guard<std::mutex> const lock(mMutex);
+        loadProfileLocked();
+    }
+}
+
+AttentionSelectionTuner::~AttentionSelectionTuner()
+{
+    for (auto* measurement : mPending)
+    {
+        mFreeMeasurements.push_back(measurement);
+    }
+    for (auto* measurement : mFreeMeasurements)
+    {
+        cudaEventDestroy(measurement->start);
+        cudaEventDestroy(measurement->stop);
+        delete measurement;
+    }
+}
+
+AttentionSelectionTuner::BucketKey AttentionSelectionTuner::makeBucket(XQAParams const& params)
+{
+    BucketKey bucket{};
+    bucket.numQHeads = params.num_q_heads;
+    bucket.numKvHeads = params.num_kv_heads;
+    bucket.headSize = params.head_size;
+    bucket.beamWidth = params.beam_width;
+    bucket.dataType = static_cast<std::int8_t>(params.data_type);
+    bucket.kvCacheDataType = static_cast<std::int8_t>(params.kv_cache_data_type);
+    bucket.log2BatchSize = log2Ceil(std::max<std::int64_t>(params.batch_size, 1));
+    bucket.log2KvLength = log2Ceil(std::max<std::int64_t>(params.max_past_kv_length, 1));
+    bucket.pagedKvCache = params.paged_kv_cache;
+    return bucket;
+}
+
+void AttentionSelectionTuner::loadProfileLocked()
+{
+    std::ifstream file(mProfilePath);
+    if (!file)
+    {
+        return;
+    }
+    std::string line;
+    while (std::getline(file, line))
+    {
+        std::istringstream entry(line);
+        std::string deviceKey;
+        std::string winner;
+        BucketKey bucket{};
+        int dataType = 0;
+        int kvCacheDataType = 0;
+        int log2BatchSize = 0;
+        int log2KvLength = 0;
+        int pagedKvCache = 0;
+        if (!(entry >> deviceKey >> bucket.numQHeads >> bucket.numKvHeads >> bucket.headSize >> bucket.beamWidth
+                >> dataType >> kvCacheDataType >> log2BatchSize >> log2KvLength >> pagedKvCache >> winner))
+        {
+            continue;
+        }
+        if (deviceKey != mDeviceKey || (winner != "xqa" && winner != "mmha"))
+        {
+            continue;
+        }
+        bucket.dataType = static_cast<std::int8_t>(dataType);
+        bucket.kvCacheDataType = static_cast<std::int8_t>(kvCacheDataType);
+        bucket.log2BatchSize = static_cast<std::int8_t>(log2BatchSize);
+        bucket.log2KvLength = static_cast<std::int8_t>(log2KvLength);
+        bucket.pagedKvCache = pagedKvCache != 0;
+        auto& state = mStates[bucket];
+        state.resolved = true;
+        state.winner = winner == "xqa" ? Choice::kXQA : Choice::kMMHA;
+        mHasProfileEntries = true;
+    }
+    TLLM_LOG_INFO("Loaded %zu attention selection profile entries for %s from %s", mStates.size(), mDeviceKey.c_str(),
+        mProfilePath.c_str());
+}
+
+void AttentionSelectionTuner::appendProfileEntryLocked(BucketKey const& bucket, BucketState const& state)
+{
+    std::ofstream file(mProfilePath, std::ios::app);
+    if (!file)
+    {
+        TLLM_LOG_WARNING("Cannot append to attention selection profile %s", mProfilePath.c_str());
+        return;
+    }
+    file << mDeviceKey << ' ' << bucket.numQHeads << ' ' << bucket.numKvHeads << ' ' << bucket.headSize << ' '
+         << bucket.beamWidth << ' ' << static_cast<int>(bucket.dataType) << ' '
+         << static_cast<int>(bucket.kvCacheDataType) << ' ' << static_cast<int>(bucket.log2BatchSize) << ' '
+         << static_cast<int>(bucket.log2KvLength) << ' ' << (bucket.pagedKvCache ? 1 : 0) << ' '
+         << (state.winner == Choice::kXQA ? "xqa" : "mmha") << '\n';
+}
+
+void AttentionSelectionTuner::resolveLocked(BucketKey const& bucket, BucketState& state)
+{
+    auto const xqaMs = state.totalMs[0] / static_cast<float>(state.samples[0]);
+    auto const mmhaMs = state.totalMs[1] / static_cast<float>(state.samples[1]);
+    state.winner = xqaMs <= mmhaMs ? Choice::kXQA : Choice::kMMHA;
+    state.resolved = true;
+    TLLM_LOG_INFO(
+        "Attention autotuner picked %s for bucket {heads %d/%d, head size %d, beam %d, batch <=2^%d, kv len <=2^%d}: "
+        "XQA %.3f ms, MMHA %.3f ms",
+        state.winner == Choice::kXQA ? "XQA" : "MMHA", bucket.numQHeads, bucket.numKvHeads, bucket.headSize,
+        bucket.beamWidth, static_cast<int>(bucket.log2BatchSize), static_cast<int>(bucket.log2KvLength), xqaMs, mmhaMs);
+    if (!mProfilePath.empty())
+    {
+        appendProfileEntryLocked(bucket, state);
+    }
+}
+
+void AttentionSelectionTuner::pollPendingLocked()
+{
+    while (!mPending.empty())
+    {
+        auto* measurement = mPending.front();
+        auto const status = cudaEventQuery(measurement->stop);
+        if (status == cudaErrorNotReady)
+        {
+            break;
+        }
+        mPending.pop_front();
+        if (status == cudaSuccess)
+        {
+            float elapsedMs = 0.F;
+            if (cudaEventElapsedTime(&elapsedMs, measurement->start, measurement->stop) == cudaSuccess)
+            {
+                auto& state = mStates[measurement->bucket];
+                auto const choiceIdx = static_cast<int>(measurement->choice);
+                ++state.samples[choiceIdx];
+                if (state.samples[choiceIdx] > kWarmupSamples)
+                {
+                    state.totalMs[choiceIdx] += elapsedMs;
+                }
+                if (!state.resolved && state.samples[0] >= kTotalSamples && state.samples[1] >= kTotalSamples)
+                {
+                    // Warmup samples count towards samples[] but not totalMs[], so average over the rest
+                    state.samples[0] = kMeasureSamples;
+                    state.samples[1] = kMeasureSamples;
+                    resolveLocked(measurement->bucket, state);
+                }
+            }
+        }
+        else
+        {
+            // Swallow the sticky error; a lost sample only delays the decision
+            cudaGetLastError();
+        }
+        mFreeMeasurements.push_back(measurement);
+    }
+}
+
+AttentionSelectionTuner::Choice AttentionSelectionTuner::choose(BucketKey const& bucket)
+{
+    std::lock_guard<std::mutex> const lock(mMutex);
+    pollPendingLocked();
+    auto& state = mStates[bucket];
+    if (state.resolved)
+    {
+        return state.winner;
+    }
+    if (!mAutotuneEnabled)
+    {
+        // Profile without an entry for this bucket: keep the heuristic choice
+        return Choice::kXQA;
+    }
+    return state.issued[0] < kTotalSamples ? Choice::kXQA : Choice::kMMHA;
+}
+
+AttentionSelectionTuner::Measurement* AttentionSelectionTuner::beginMeasure(
+    BucketKey const& bucket, Choice choice, cudaStream_t stream)
+{
+    if (!mAutotuneEnabled)
+    {
+        return nullptr;
+    }
+    Measurement* measurement = nullptr;
+    {
+        std::lock_guard<std::mutex> const lock(mMutex);
+        auto& state = mStates[bucket];
+        auto const choiceIdx = static_cast<int>(choice);
+        if (state.resolved || state.issued[choiceIdx] >= kTotalSamples)
+        {
+            return nullptr;
+        }
+        ++state.issued[choiceIdx];
+        if (!mFreeMeasurements.empty())
+        {
+            measurement = mFreeMeasurements.back();
+            mFreeMeasurements.pop_back();
+        }
+    }
+    if (measurement == nullptr)
+    {
+        measurement = new Measurement();
+        TLLM_CUDA_CHECK(cudaEventCreate(&measurement->start));
+        TLLM_CUDA_CHECK(cudaEventCreate(&measurement->stop));
+    }
+    measurement->bucket = bucket;
+    measurement->choice = choice;
+    TLLM_CUDA_CHECK(cudaEventRecord(measurement->start, stream));
+    return measurement;
+}
+
+void AttentionSelectionTuner::endMeasure(Measurement* measurement, cudaStream_t stream)
+{
+    if (measurement == nullptr)
+    {
+        return;
+    }
+    TLLM_CUDA_CHECK(cudaEventRecord(measurement->stop, stream));
+    std::lock_guard<std::mutex> const lock(mMutex);
+    mPending.push_back(measurement);
+}
+
+} // namespace kernels
+} // namespace tensorrt_llm
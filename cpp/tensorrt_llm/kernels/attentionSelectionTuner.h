@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention/xqaParams.h"
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+
+//! XQA and MMHA cover the same generation-phase attention shapes and the static heuristics do not always
+//! pick the faster one. When enabled via TRTLLM_XQA_AUTOTUNE, the tuner times both paths on the serving
+//! stream for each observed shape bucket and sticks with the winner once enough samples are in. Decisions
+//! can be persisted per GPU in the file named by TRTLLM_XQA_SELECTION_PROFILE, so later processes on the
+//! same SKU skip the measurement phase.
+class AttentionSelectionTuner
+{
+public:
+    enum class Choice : std::int8_t
+    {
+        kXQA = 0,
+        kMMHA = 1,
+    };
+
+    //! Shape bucket of a generation step. Batch size and kv length are bucketed to their power-of-two
+    //! ceiling so one profile entry covers all nearby shapes.
+    struct BucketKey
+    {
+        std::int32_t numQHeads;
+        std::int32_t numKvHeads;
+        std::int32_t headSize;
+        std::int32_t beamWidth;
+        std::int8_t dataType;
+        std::int8_t kvCacheDataType;
+        std::int8_t log2BatchSize;
+        std::int8_t log2KvLength;
+        bool pagedKvCache;
+
+        bool operator==(BucketKey const& other) const;
+    };
+
+    //! In-flight timing of one generation step, opaque to the caller.
+    struct Measurement;
+
+    static AttentionSelectionTuner& getInstance();
+
+    //! Whether the tuner has anything to say. False unless autotuning or a selection profile is enabled.
+    [[nodiscard]] bool isEnabled() const
+    {
+        return mAutotuneEnabled || mHasProfileEntries;
+    }
+
+    static BucketKey makeBucket(XQAParams const& params);
+
+    //! Returns the path to run for this bucket: the resolved or profiled winner when one is known, the
+    //! path that still needs samples while measuring, and XQA (the heuristic choice) otherwise.
+    Choice choose(BucketKey const& bucket);
+
+    //! Start timing a generation step on the stream. Returns nullptr when the bucket needs no more
+    //! samples; endMeasure ignores nullptr, so callers can bracket their launches unconditionally.
+    Measurement* beginMeasure(BucketKey const& bucket, Choice choice, cudaStream_t stream);
+    void endMeasure(Measurement* measurement, cudaStream_t stream);
+
+private:
+    AttentionSelectionTuner();
+    ~AttentionSelectionTuner();
+
+    struct BucketState
+    {
+        std::int32_t issued[2] = {0, 0};
+        std::int32_t samples[2] = {0, 0};
+        float totalMs[2] = {0.F, 0.F};
+        bool resolved = false;
+        Choice winner = Choice::kXQA;
+    };
+
+    struct BucketKeyHash
+    {
+        std::size_t operator()(BucketKey const& key) const;
+    };
+
+    void loadProfileLocked();
+    void appendProfileEntryLocked(BucketKey const& bucket, BucketState const& state);
+    void pollPendingLocked();
+    void resolveLocked(BucketKey const& bucket, BucketState& state);
+
+    std::mutex mMutex;
+    std::unordered_map<BucketKey, BucketState, BucketKeyHash> mStates;
+    std::deque<Measurement*> mPending;
+    std::vector<Measurement*> mFreeMeasurements;
+    std::string mDeviceKey;
+    std::string mProfilePath;
+    bool mAutotuneEnabled = false;
+    bool mHasProfileEntries = false;
+};
+
+} // namespace kernels
+} // namespace tensorrt_llm
@@ -25,6 +25,10 @@ namespace tensorrt_llm
 namespace kernels
 {
 
+/* Number of trailing output tokens staged in shared memory per block. Covers every pattern of up
+ * to kMaxCachedTokens + 1 tokens; longer patterns fall back to global memory reads. */
+constexpr SizeType32 kMaxCachedTokens{64};
+
 template <typename T>
 __global__ void ban_bad_words(T* logits, TokenIdType const** output_ids_ptr, SizeType32 const** parent_ids_ptr,
     SizeType32 const* batch_slots, SizeType32 beam_width, TokenIdType const* const* bad_words_ptrs,
@@ -41,6 +45,25 @@ __global__ void ban_bad_words(T* logits, TokenIdType const** output_ids_ptr, Siz
     auto const bad_words_len = bad_words_lens[batch_slot];
     auto const* base_bad_words_offsets = base_bad_words + bad_words_len;
 
+    auto const current_step{sequence_lengths[batch_beam_idx]};
+
+    /* With a single beam every pattern compares against the same trailing window of the output, so
+     * the block stages it in shared memory once instead of each thread re-reading it from global
+     * memory; with 10K-entry blocklists those redundant reads dominate the kernel. Beam search
+     * gathers along per-pattern parent paths and keeps the global reads. */
+    __shared__ TokenIdType s_recent_tokens[kMaxCachedTokens];
+    SizeType32 num_cached{0};
+    if (beam_width == 1)
+    {
+        num_cached = min(current_step, kMaxCachedTokens);
+        for (auto token_idx = static_cast<SizeType32>(threadIdx.x); token_idx < num_cached;
+            token_idx += static_cast<SizeType32>(blockDim.x))
+        {
+            s_recent_tokens[token_idx] = output_ids_ptr[batch_slot][current_step - num_cached + token_idx];
+        }
+        __syncthreads();
+    }
+
     if (id >= bad_words_len || base_bad_words_offsets[id] < 0)
     {
         return;
@@ -52,7 +75,6 @@ __global__ void ban_bad_words(T* logits, TokenIdType const** output_ids_ptr, Siz
 
     /* The single-token case unconditionally bans the token */
     bool should_ban = item_size == 1;
-    auto const current_step{sequence_lengths[batch_beam_idx]};
     /* Multi-token case and enough previously generated tokens to look for a match
      */
     if (item_size > 1 && current_step >= item_size - 1)
@@ -60,11 +82,13 @@ __global__ void ban_bad_words(T* logits, TokenIdType const** output_ids_ptr, Siz
         should_ban = true;
         auto parent_id = static_cast<SizeType32>(beam_idx);
         bool const gather_beam = beam_width > 1;
+        bool const use_cache = beam_width == 1 && item_size - 1 <= num_cached;
 
         for (auto token_idx = item_size - 2; token_idx >= 0; token_idx--)
         {
-            auto const previous_token
-                = output_ids_ptr[batch_slot][parent_id * max_seq_len + current_step - (item_size - 1) + token_idx];
+            auto const previous_token = use_cache
+                ? s_recent_tokens[num_cached - (item_size - 1) + token_idx]
+                : output_ids_ptr[batch_slot][parent_id * max_seq_len + current_step - (item_size - 1) + token_idx];
 
             if (previous_token != base_bad_words[item_start + token_idx])
             {
@@ -15,6 +15,7 @@
  */
 
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/reduceKernelUtils.cuh"
 #include "tensorrt_llm/kernels/beamSearchKernels.h"
 
 using namespace tensorrt_llm::common;
@@ -136,17 +137,27 @@ void invokeUpdateCacheIndirection(int* tgtCI, int const* srcCI, BeamHypotheses&
 
 __global__ void addCumLogProbs(float* __restrict pStage1LogProbs, float const* __restrict cumLogProbs,
     FinishedState const* finished, int const* endIds, float const* diversityRates,
-    runtime::SizeType32 const* batchSlots, size_t const nBS, size_t const nBMIn, size_t const nBMOut, size_t const nBM)
+    runtime::SizeType32 const* batchSlots, int const* beamWidthsIn, int const* beamWidthsOut, size_t const nBS,
+    size_t const nBMIn, size_t const nBMOut, size_t const nBM)
 {
     int const bid = blockIdx.x; // Index of request in batch
     runtime::SizeType32 const slot = batchSlots[bid];
     float const diversityRate{diversityRates[slot]};
     float* pLocalLogProbs = pStage1LogProbs + bid * nBMIn * nBMOut * 2;
+    // Per-request beam widths for DBWS, `nBMIn` / `nBMOut` are the batch-wide widths keeping the memory layout
+    size_t const nBMInLocal = (beamWidthsIn == nullptr) ? nBMIn : beamWidthsIn[bid];
+    size_t const nBMOutLocal = (beamWidthsOut == nullptr) ? nBMOut : beamWidthsOut[bid];
 
     for (int i = threadIdx.x; i < nBMIn * nBMOut * 2; i += blockDim.x)
     {
         int const iBMIn = i / (nBMOut * 2);
-        if (finished[slot * nBMIn + iBMIn].isFinished())
+        if (iBMIn >= nBMInLocal || i % (nBMOut * 2) >= nBMOutLocal * 2)
+        {
+            // Padded candidate of a request running fewer beams than the batch-wide width,
+            // mask it so the batch-wide topK of stage 2 never selects it
+            pLocalLogProbs[i] = -FLT_MAX;
+        }
+        else if (finished[slot * nBMIn + iBMIn].isFinished())
         {
             pLocalLogProbs[i] += (i == endIds[slot]) ? 1.0f : 0.0f;
         }
@@ -161,17 +172,27 @@ __global__ void addCumLogProbs(float* __restrict pStage1LogProbs, float const* _
 
 __global__ void addCumLogProbs(half* __restrict pStage1LogProbs, float const* __restrict cumLogProbs,
     FinishedState const* finished, int const* endIds, float const* diversityRates,
-    runtime::SizeType32 const* batchSlots, size_t const nBS, size_t const nBMIn, size_t const nBMOut, size_t const nBM)
+    runtime::SizeType32 const* batchSlots, int const* beamWidthsIn, int const* beamWidthsOut, size_t const nBS,
+    size_t const nBMIn, size_t const nBMOut, size_t const nBM)
 {
     int const bid = blockIdx.x; // Index of request in batch
     runtime::SizeType32 const slot = batchSlots[bid];
     float const diversityRate{diversityRates[slot]};
     half* pLocalLogProbs = pStage1LogProbs + bid * nBMIn * nBMOut * 2;
+    // Per-request beam widths for DBWS, `nBMIn` / `nBMOut` are the batch-wide widths keeping the memory layout
+    size_t const nBMInLocal = (beamWidthsIn == nullptr) ? nBMIn : beamWidthsIn[bid];
+    size_t const nBMOutLocal = (beamWidthsOut == nullptr) ? nBMOut : beamWidthsOut[bid];
 
     for (int i = threadIdx.x; i < nBMIn * nBMOut * 2; i += blockDim.x)
     {
         int const iBMIn = i / (nBMOut * 2);
-        if (finished[slot * nBMIn + iBMIn].isFinished())
+        if (iBMIn >= nBMInLocal || i % (nBMOut * 2) >= nBMOutLocal * 2)
+        {
+            // Padded candidate of a request running fewer beams than the batch-wide width,
+            // mask it so the batch-wide topK of stage 2 never selects it
+            pLocalLogProbs[i] = -HALF_FLT_MAX;
+        }
+        else if (finished[slot * nBMIn + iBMIn].isFinished())
         {
             pLocalLogProbs[i] += (i == endIds[slot]) ? 1.0f : 0.0f;
         }
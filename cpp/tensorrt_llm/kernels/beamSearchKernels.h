@@ -63,6 +63,8 @@ struct BeamHypotheses
     int const* beamWidthArraysHost{nullptr};        // [BS, kMaxBeamWidthArrayLength]                           for VBWS
     int* nBeamWidthInHost{nullptr};                 // [BS], cpu                                                for VBWS, beam width of last forward computation
     int* nBeamWidthOutHost{nullptr};                // [BS], cpu                                                for VBWS, beam width of next forward computation
+    int const* beamWidthsInDevice{nullptr};         // [BS], gpu                                                for DBWS, per-request input beam width
+    int const* beamWidthsOutDevice{nullptr};        // [BS], gpu                                                for DBWS, per-request output beam width
 
     // Pointers from input
     int const* inputLengths{nullptr};               // [BS, BM]         %% context_length
@@ -132,11 +134,13 @@ void invokeUpdateCacheIndirection(int* tgtCI, int const* srcCI, BeamHypotheses&
 
 __global__ void addCumLogProbs(float* __restrict pStage1LogProbs, float const* __restrict cumLogProbs,
     FinishedState const* finished, int const* endIds, float const* diversityRates,
-    runtime::SizeType32 const* batchSlots, size_t const nBS, size_t const nBMIn, size_t const nBMOut, size_t const nBM);
+    runtime::SizeType32 const* batchSlots, int const* beamWidthsIn, int const* beamWidthsOut, size_t const nBS,
+    size_t const nBMIn, size_t const nBMOut, size_t const nBM);
 
 __global__ void addCumLogProbs(half* __restrict pStage1LogProbs, float const* __restrict cumLogProbs,
     FinishedState const* finished, int const* endIds, float const* diversityRates,
-    runtime::SizeType32 const* batchSlots, size_t const nBS, size_t const nBMIn, size_t const nBMOut, size_t const nBM);
+    runtime::SizeType32 const* batchSlots, int const* beamWidthsIn, int const* beamWidthsOut, size_t const nBS,
+    size_t const nBMIn, size_t const nBMOut, size_t const nBM);
 
 __global__ void gatherId(int const* __restrict pStage1Id, int* __restrict pStage2Id, size_t const nBS,
     size_t const nBMIn, size_t const nBMOut, size_t const nV);
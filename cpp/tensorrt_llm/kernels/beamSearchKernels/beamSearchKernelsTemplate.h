@@ -195,7 +195,12 @@ __launch_bounds__(BLOCK_SIZE) __global__ void beamStage3Kernel(
     size_t const nMBS{bh.nMaxBatchSize}; // Only for bh.logProbsTiled
     size_t const nBM{bh.nBeamWidth};
     // size_t const nBMIn{bh.bVBWS ? bh.nBeamWidthIn : bh.nBeamWidth};
-    size_t const nBMOut{bh.bVBWS ? bh.nBeamWidthOut : bh.nBeamWidth};
+    // Batch-wide output beam width decides the memory layout of the stage 2 output
+    size_t const nBMOutMax{bh.bVBWS ? bh.nBeamWidthOut : bh.nBeamWidth};
+    // Per-request output beam width for DBWS, so only the real beams of this request are selected
+    size_t const nBMOut{(bh.bVBWS && bh.beamWidthsOutDevice != nullptr)
+            ? static_cast<size_t>(bh.beamWidthsOutDevice[bid])
+            : nBMOutMax};
     size_t const nMSL{bh.nMaxSeqLen};
     size_t const nV{bh.nVocabSize};
     float const diversityRate{bh.diversityRates[slot]};
@@ -230,8 +235,8 @@ __launch_bounds__(BLOCK_SIZE) __global__ void beamStage3Kernel(
     // This TopK is needless in V2 workflow
     if constexpr (IS_V2)
     {
-        pStage2Ids += bid * nBMOut * 2;
-        pStage2LogProbs += bid * nBMOut * 2;
+        pStage2Ids += bid * nBMOutMax * 2;
+        pStage2LogProbs += bid * nBMOutMax * 2;
     }
     else
     {
@@ -600,10 +605,21 @@ void beamSearchKernelLauncher(
     //     + `nBM` is the max value of the beam width array, which is used for memory allocatation
     // Normal Beam Search:
     //     + `nBMIn` / `nBMOut` / `nBM` share the same value
-    // TODO: now `nBMIn` and `nBMOut` of request 0 is used for the whole batch,
-    //     change to corresponding BMs if Diverse-Beam-Width-Search is supported
-    size_t const nBMIn = bh.bVBWS ? bh.nBeamWidthInHost[0] : nBM;
-    size_t const nBMOut = bh.bVBWS ? bh.nBeamWidthOutHost[0] : nBM;
+    // DBWS (requests with diverse beam widths in one batch):
+    //     + the batch-wide `nBMIn` / `nBMOut` (max across requests) decide the memory layout and topK sizes
+    //     + `bh.beamWidthsInDevice` / `bh.beamWidthsOutDevice` carry the per-request widths, the kernels below
+    //       iterate and select only the real beams of each request
+    size_t nBMIn = nBM;
+    size_t nBMOut = nBM;
+    if (bh.bVBWS)
+    {
+        nBMIn = nBMOut = 0;
+        for (size_t i = 0; i < nBS; ++i)
+        {
+            nBMIn = std::max(nBMIn, static_cast<size_t>(bh.nBeamWidthInHost[i]));
+            nBMOut = std::max(nBMOut, static_cast<size_t>(bh.nBeamWidthOutHost[i]));
+        }
+    }
     bh.nBeamWidthIn = nBMIn;   // Save nBMIn back to bh
     bh.nBeamWidthOut = nBMOut; // Save nBMOut back to bh
 
@@ -629,7 +645,7 @@ void beamSearchKernelLauncher(
 
         int nThread = min(roundUp(nBMIn * nBMOut * 2, 32), 1024);
         addCumLogProbs<<<nBS, nThread, 0, stream>>>(pStage1LogProbs, bh.cumLogProbs, bh.finished, bh.endIds,
-            bh.diversityRates, bh.batchSlots, nBS, nBMIn, nBMOut, nBM);
+            bh.diversityRates, bh.batchSlots, bh.beamWidthsInDevice, bh.beamWidthsOutDevice, nBS, nBMIn, nBMOut, nBM);
         sync_check_cuda_error(stream);
 
         // Stage 2
@@ -391,9 +391,9 @@ struct QuantMaxValue<__nv_fp8_e4m3>
     static constexpr float value = 448.0f;
 };
 
-template <int32_t RANKS_PER_NODE, typename T_IN, typename T_OUT>
-__global__ void lowPrecisionPreprocessKernel(
-    const T_IN* __restrict__ input, size_t elts_per_rank_in, size_t elts_per_rank_out, T_OUT* __restrict__ output)
+template <int32_t RANKS_PER_NODE, typename T_IN, typename T_OUT, bool ErrorFeedback = false>
+__global__ void lowPrecisionPreprocessKernel(const T_IN* __restrict__ input, size_t elts_per_rank_in,
+    size_t elts_per_rank_out, T_OUT* __restrict__ output, T_IN* error_feedback)
 {
     constexpr float QUANT_MAX = QuantMaxValue<T_OUT>::value;
     constexpr int32_t output_rounds = sizeof(T_IN) / sizeof(T_OUT);
@@ -413,6 +413,10 @@ __global__ void lowPrecisionPreprocessKernel(
 
     input += elts_per_rank_in * target_rank;
     output += elts_per_rank_out * target_rank;
+    if constexpr (ErrorFeedback)
+    {
+        error_feedback += elts_per_rank_in * target_rank;
+    }
 
     const int32_t lane_id = threadIdx.x % WARP_SIZE;
     const int32_t wid = threadIdx.x / WARP_SIZE;
@@ -430,6 +434,19 @@ __global__ void lowPrecisionPreprocessKernel(
         if (local_offset < NUM_ELTS_PER_WARP_IN && global_offset < elts_per_rank_in)
         {
             vals[i].packed = *reinterpret_cast<PackedInputIntType const*>(input + start_in + local_offset);
+            if constexpr (ErrorFeedback)
+            {
+                // Compensate with the quantization error left over from the previous call.
+                PackedInputType err_vec;
+                err_vec.packed
+                    = *reinterpret_cast<PackedInputIntType const*>(error_feedback + start_in + local_offset);
+#pragma unroll
+                for (int j = 0; j < elts_per_round; j++)
+                {
+                    vals[i].unpacked[j]
+                        = static_cast<T_IN>((float) (vals[i].unpacked[j]) + (float) (err_vec.unpacked[j]));
+                }
+            }
         }
         else
         {
@@ -482,6 +499,29 @@ __global__ void lowPrecisionPreprocessKernel(
         }
     }
 
+    if constexpr (ErrorFeedback)
+    {
+        // Store the new residual error (compensated value minus its dequantized representation).
+#pragma unroll
+        for (int32_t i = 0; i < output_rounds; ++i)
+        {
+            int32_t local_offset = lane_id * elts_per_round + elts_per_warp_per_round * i;
+            int32_t global_offset = start_in + local_offset;
+            if (local_offset < NUM_ELTS_PER_WARP_IN && global_offset < elts_per_rank_in)
+            {
+                PackedInputType err_vec;
+#pragma unroll
+                for (int32_t j = 0; j < elts_per_round; ++j)
+                {
+                    float dequant_val
+                        = scalar != 0.0f ? (float) (output_vals[i].unpacked[j]) / scalar : 0.0f;
+                    err_vec.unpacked[j] = static_cast<T_IN>((float) (vals[i].unpacked[j]) - dequant_val);
+                }
+                *reinterpret_cast<PackedInputIntType*>(error_feedback + start_in + local_offset) = err_vec.packed;
+            }
+        }
+    }
+
 #pragma unroll
     for (int32_t i = 0; i < output_rounds; ++i)
     {
@@ -742,9 +782,9 @@ static __global__ void lowPrecisionTwoShotAllReduceKernel(LowPrecisionAllReduceP
         src_d, reinterpret_cast<T*>(params.local_output_buffer_ptr), smem_allgather, dst_rank);
 }
 
-template <typename T_IN, typename T_OUT>
+template <typename T_IN, typename T_OUT, bool ErrorFeedback = false>
 __global__ void lowPrecisionHierPreprocessKernel(
-    const T_IN* __restrict__ input, size_t n_in, T_OUT* __restrict__ output)
+    const T_IN* __restrict__ input, size_t n_in, T_OUT* __restrict__ output, T_IN* error_feedback)
 {
     constexpr float QUANT_MAX = QuantMaxValue<T_OUT>::value;
     constexpr int32_t output_rounds = sizeof(T_IN) / sizeof(T_OUT);
@@ -783,6 +823,19 @@ __global__ void lowPrecisionHierPreprocessKernel(
             {
                 vals[i].packed
                     = *reinterpret_cast<PackedInputIntType const*>(input + start * NUM_ELTS_PER_WARP_IN + local_offset);
+                if constexpr (ErrorFeedback)
+                {
+                    // Compensate with the quantization error left over from the previous call.
+                    PackedInputType err_vec;
+                    err_vec.packed = *reinterpret_cast<PackedInputIntType const*>(
+                        error_feedback + start * NUM_ELTS_PER_WARP_IN + local_offset);
+#pragma unroll
+                    for (int j = 0; j < elts_per_round; j++)
+                    {
+                        vals[i].unpacked[j]
+                            = static_cast<T_IN>((float) (vals[i].unpacked[j]) + (float) (err_vec.unpacked[j]));
+                    }
+                }
                 read_rounds++;
             }
             else
@@ -836,6 +889,30 @@ __global__ void lowPrecisionHierPreprocessKernel(
             }
         }
 
+        if constexpr (ErrorFeedback)
+        {
+            // Store the new residual error (compensated value minus its dequantized representation).
+#pragma unroll
+            for (int32_t i = 0; i < output_rounds; ++i)
+            {
+                int32_t local_offset = lane_id * elts_per_round + elts_per_warp_per_round * i;
+                if (local_offset < local_n_in)
+                {
+                    PackedInputType err_vec;
+#pragma unroll
+                    for (int32_t j = 0; j < elts_per_round; ++j)
+                    {
+                        float dequant_val
+                            = scalar != 0.0f ? (float) (output_vals[i].unpacked[j]) / scalar : 0.0f;
+                        err_vec.unpacked[j] = static_cast<T_IN>((float) (vals[i].unpacked[j]) - dequant_val);
+                    }
+                    *reinterpret_cast<PackedInputIntType*>(
+                        error_feedback + start * NUM_ELTS_PER_WARP_IN + local_offset)
+                        = err_vec.packed;
+                }
+            }
+        }
+
 #pragma unroll
         for (int32_t i = 0; i < output_rounds; ++i)
         {
@@ -1268,10 +1345,20 @@ void lowPrecisionAllReduceDispatchRanksPerNode(kernels::LowPrecisionAllReducePar
 
         params.buffer_offset = my_rank * elts_per_block_with_scale * num_rounds_per_rank;
         params.buffer_elts_per_rank = elts_per_block_with_scale * num_rounds_per_rank;
-        lowPrecisionPreprocessKernel<RANKS_PER_NODE, T, QUANT_T>
-            <<<num_rounds_per_rank * RANKS_PER_NODE, threads_per_block, 0, stream>>>(
-                (T const*) params.local_input_buffer_ptr, params.elts_per_rank, params.buffer_elts_per_rank,
-                (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank]);
+        if (params.error_feedback_buffer != nullptr)
+        {
+            lowPrecisionPreprocessKernel<RANKS_PER_NODE, T, QUANT_T, true>
+                <<<num_rounds_per_rank * RANKS_PER_NODE, threads_per_block, 0, stream>>>(
+                    (T const*) params.local_input_buffer_ptr, params.elts_per_rank, params.buffer_elts_per_rank,
+                    (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank], (T*) params.error_feedback_buffer);
+        }
+        else
+        {
+            lowPrecisionPreprocessKernel<RANKS_PER_NODE, T, QUANT_T>
+                <<<num_rounds_per_rank * RANKS_PER_NODE, threads_per_block, 0, stream>>>(
+                    (T const*) params.local_input_buffer_ptr, params.elts_per_rank, params.buffer_elts_per_rank,
+                    (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank], nullptr);
+        }
         lowPrecisionTwoShotAllReduceKernel<T, QUANT_T, RANKS_PER_NODE><<<blocks_per_grid, threads_per_block,
             (LP_ALLREDUCE_WARP_NUM_PER_BLOCK * RANKS_PER_NODE) * sizeof(float) * 2, stream>>>(params);
     }
@@ -1288,9 +1375,20 @@ void lowPrecisionAllReduceDispatchRanksPerNode(kernels::LowPrecisionAllReducePar
         size_t my_rank = params.local_rank;
         blocks_per_grid *= LP_ALLREDUCE_HIER_STAGE_NUM; // 3 stages need more block
 
-        lowPrecisionHierPreprocessKernel<T, QUANT_T><<<preprocess_blocks_per_grid, LP_ALLREDUCE_DEFAULT_BLOCK_SIZE,
-            (LP_ALLREDUCE_WARP_NUM_PER_BLOCK) * sizeof(float), stream>>>((T const*) params.local_input_buffer_ptr,
-            params.elts_total, (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank]);
+        if (params.error_feedback_buffer != nullptr)
+        {
+            lowPrecisionHierPreprocessKernel<T, QUANT_T, true><<<preprocess_blocks_per_grid,
+                LP_ALLREDUCE_DEFAULT_BLOCK_SIZE, (LP_ALLREDUCE_WARP_NUM_PER_BLOCK) * sizeof(float), stream>>>(
+                (T const*) params.local_input_buffer_ptr, params.elts_total,
+                (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank], (T*) params.error_feedback_buffer);
+        }
+        else
+        {
+            lowPrecisionHierPreprocessKernel<T, QUANT_T><<<preprocess_blocks_per_grid,
+                LP_ALLREDUCE_DEFAULT_BLOCK_SIZE, (LP_ALLREDUCE_WARP_NUM_PER_BLOCK) * sizeof(float), stream>>>(
+                (T const*) params.local_input_buffer_ptr, params.elts_total,
+                (QUANT_T*) params.peer_comm_buffer_ptrs[my_rank], nullptr);
+        }
         lowPrecisionTwoShotHierAllReduceKernel<T, QUANT_T, RANKS_PER_NODE><<<blocks_per_grid, threads_per_block,
             (LP_ALLREDUCE_WARP_NUM_PER_BLOCK * RANKS_PER_NODE) * sizeof(float), stream>>>(params);
     }
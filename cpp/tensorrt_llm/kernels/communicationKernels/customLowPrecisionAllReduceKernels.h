@@ -75,6 +75,10 @@ struct LowPrecisionAllReduceParams
     size_t buffer_elts_per_rank;
     size_t buffer_offset;
 
+    // Persistent per-layer error-feedback buffer with the same shape/dtype as the input. When set, the
+    // quantization error of each element is carried over and compensated on the next call for that layer.
+    void* error_feedback_buffer = nullptr;
+
     // for low precision hier
     uint32_t num_rounds = 0;
     uint32_t num_rounds_fence = 0;
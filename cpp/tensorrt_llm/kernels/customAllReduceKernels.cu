@@ -23,6 +23,7 @@
 #include "tensorrt_llm/common/envUtils.h"
 #include <cooperative_groups.h>
 #include <cstdint>
+#include <cuda_fp8.h>
 #include <tuple>
 #include <type_traits>
 
@@ -268,11 +269,14 @@ inline __device__ int4 rms_norm(float denom, PackedStruct& vec, PackedStruct& we
     return ret.packed;
 }
 
-template <typename T, bool Bias = false, bool Residual = false, bool Affine = false, bool UseSmem = false>
+template <typename T, bool Bias = false, bool Residual = false, bool Affine = false, bool UseSmem = false,
+    bool Fp8Quant = false>
 __global__ void rms_norm_kernel(AllReduceParams params)
 {
     static constexpr int kPackedSize = details::kBytesPerAccess / sizeof(T);
     using PackedStruct = typename PackedOn16Bytes<T>::Type;
+    // kPackedSize fp8 values packed into a single aligned store
+    using PackedQuantStruct = std::conditional_t<std::is_same_v<T, float>, float, float2>;
 
     extern __shared__ uint8_t smem_ptr[];
     T* smem = reinterpret_cast<T*>(smem_ptr);
@@ -284,6 +288,7 @@ __global__ void rms_norm_kernel(AllReduceParams params)
     T const* weight_buffer = reinterpret_cast<T const*>(params.fusion_params.weight_buffer);
     T* local_final_output_buffer = reinterpret_cast<T*>(params.local_output_buffer_ptr);
     T* intermediate_buffer = reinterpret_cast<T*>(params.fusion_params.intermediate_buffer);
+    __nv_fp8_e4m3* quant_buffer = reinterpret_cast<__nv_fp8_e4m3*>(params.fusion_params.quant_buffer);
 
     int block_offset = bid * params.fusion_params.hidden_size;
     int thread_offset = tid * kPackedSize;
@@ -292,7 +297,14 @@ __global__ void rms_norm_kernel(AllReduceParams params)
     {
         residual_buffer += block_offset;
     }
-    local_final_output_buffer += block_offset;
+    if (local_final_output_buffer != nullptr)
+    {
+        local_final_output_buffer += block_offset;
+    }
+    if constexpr (Fp8Quant)
+    {
+        quant_buffer += block_offset;
+    }
     intermediate_buffer += block_offset;
 
 #if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900) && (__CUDA_ARCH__ < 1200))
@@ -325,6 +337,7 @@ __global__ void rms_norm_kernel(AllReduceParams params)
     }
     acc = block_reduce_sum(acc);
     float denom = rsqrtf(acc / params.fusion_params.hidden_size + params.fusion_params.eps);
+    float scale_orig_quant = Fp8Quant ? 1.f / *params.fusion_params.scale_factor : 1.f;
     for (int offset = thread_offset; offset < params.fusion_params.hidden_size; offset += blockDim.x * kPackedSize)
     {
         if constexpr (UseSmem)
@@ -336,7 +349,25 @@ __global__ void rms_norm_kernel(AllReduceParams params)
             weight_vec.packed = *reinterpret_cast<int4 const*>(weight_buffer + offset);
         }
         inter_vec.packed = rms_norm<T, Affine>(denom, inter_vec, weight_vec);
-        *reinterpret_cast<int4*>(&local_final_output_buffer[offset]) = inter_vec.packed;
+        if constexpr (Fp8Quant)
+        {
+            PackedQuantStruct quant_vec;
+#pragma unroll
+            for (int i = 0; i < kPackedSize; ++i)
+            {
+                reinterpret_cast<__nv_fp8_e4m3*>(&quant_vec)[i] = static_cast<__nv_fp8_e4m3>(
+                    static_cast<float>(reinterpret_cast<T*>(inter_vec.unpacked)[i]) * scale_orig_quant);
+            }
+            *reinterpret_cast<PackedQuantStruct*>(&quant_buffer[offset]) = quant_vec;
+            if (local_final_output_buffer != nullptr)
+            {
+                *reinterpret_cast<int4*>(&local_final_output_buffer[offset]) = inter_vec.packed;
+            }
+        }
+        else
+        {
+            *reinterpret_cast<int4*>(&local_final_output_buffer[offset]) = inter_vec.packed;
+        }
     }
 #if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900) && (__CUDA_ARCH__ < 1200))
     cudaTriggerProgrammaticLaunchCompletion();
@@ -436,6 +467,13 @@ void rms_norm_kernel_launcher(AllReduceParams& params, cudaStream_t stream, AllR
     {
         TLLM_CHECK(params.fusion_params.hidden_size <= 8192);
     }
+    bool const fp8_quant = params.fusion_params.quant_buffer != nullptr;
+    TLLM_CHECK_WITH_INFO(!fp8_quant || fusionOp == AllReduceFusionOp::RESIDUAL_RMS_NORM,
+        "Fused fp8 quantization is only supported with RESIDUAL_RMS_NORM");
+    auto norm_kernel_smem = fp8_quant ? rms_norm_kernel<T, Bias, Residual, Affine, true, true>
+                                      : rms_norm_kernel<T, Bias, Residual, Affine, true, false>;
+    auto norm_kernel_no_smem = fp8_quant ? rms_norm_kernel<T, Bias, Residual, Affine, false, true>
+                                         : rms_norm_kernel<T, Bias, Residual, Affine, false, false>;
     int need_threads = params.fusion_params.hidden_size / kPackedSize;
     int cta_size;
     if (need_threads <= details::kMaxCtaSize)
@@ -468,8 +506,7 @@ void rms_norm_kernel_launcher(AllReduceParams& params, cudaStream_t stream, AllR
 
             if (fusionOp == AllReduceFusionOp::RESIDUAL_RMS_NORM)
             {
-                TLLM_CUDA_CHECK(
-                    cudaLaunchKernelEx(&kernelConfig, rms_norm_kernel<T, Bias, Residual, Affine, true>, params));
+                TLLM_CUDA_CHECK(cudaLaunchKernelEx(&kernelConfig, norm_kernel_smem, params));
             }
             else
             { // AllReduceFusionOp::RESIDUAL_RMS_PREPOST_NORM
@@ -481,7 +518,7 @@ void rms_norm_kernel_launcher(AllReduceParams& params, cudaStream_t stream, AllR
         {
             if (fusionOp == AllReduceFusionOp::RESIDUAL_RMS_NORM)
             {
-                rms_norm_kernel<T, Bias, Residual, Affine, true><<<cta_num, cta_size, smem_size, stream>>>(params);
+                norm_kernel_smem<<<cta_num, cta_size, smem_size, stream>>>(params);
             }
             else
             { // AllReduceFusionOp::RESIDUAL_RMS_PREPOST_NORM
@@ -508,8 +545,7 @@ void rms_norm_kernel_launcher(AllReduceParams& params, cudaStream_t stream, AllR
 
             if (fusionOp == AllReduceFusionOp::RESIDUAL_RMS_NORM)
             {
-                TLLM_CUDA_CHECK(
-                    cudaLaunchKernelEx(&kernelConfig, rms_norm_kernel<T, Bias, Residual, Affine, false>, params));
+                TLLM_CUDA_CHECK(cudaLaunchKernelEx(&kernelConfig, norm_kernel_no_smem, params));
             }
             else
             { // AllReduceFusionOp::RESIDUAL_RMS_PREPOST_NORM
@@ -521,7 +557,7 @@ void rms_norm_kernel_launcher(AllReduceParams& params, cudaStream_t stream, AllR
         {
             if (fusionOp == AllReduceFusionOp::RESIDUAL_RMS_NORM)
             {
-                rms_norm_kernel<T, Bias, Residual, Affine, false><<<cta_num, cta_size, smem_size, stream>>>(params);
+                norm_kernel_no_smem<<<cta_num, cta_size, smem_size, stream>>>(params);
             }
             else
             { // AllReduceFusionOp::RESIDUAL_RMS_PREPOST_NORM
@@ -58,6 +58,7 @@ enum class AllReduceStrategyType : int8_t
     LOWPRECISION = 6,
     MNNVL = 7,
     NCCL_SYMMETRIC = 8,
+    HIERARCHICAL = 9,
 };
 
 enum class AllReduceStrategyConfig : int8_t
@@ -114,6 +115,8 @@ struct AllReduceFusionParams
         , weight_buffer(nullptr)
         , weight_buffer_pre_residual_norm(nullptr)
         , intermediate_buffer(nullptr)
+        , scale_factor(nullptr)
+        , quant_buffer(nullptr)
     {
     }
 
@@ -128,6 +131,9 @@ struct AllReduceFusionParams
     float eps;
     // new residual
     void* intermediate_buffer;
+    // fp8 quantization of the norm output (orig_to_quant scale, fp8 output buffer)
+    float const* scale_factor;
+    void* quant_buffer;
     void* lamport_peer_comm_buffer_ptrs[MAX_RANKS_PER_NODE * 3];
 };
 
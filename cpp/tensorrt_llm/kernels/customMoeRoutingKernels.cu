@@ -108,7 +108,7 @@ __device__ void calcSoftmax(cg::thread_block_tile<WARP_SIZE> const& warp, DataTy
 template <typename InputT, typename OutputT, typename IdxT, int MaxNumExperts, int MaxNumTopExperts,
     bool DoSoftmaxBeforeTopK>
 __global__ void customMoeRoutingKernel(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices,
-    int32_t const numTokens, int32_t const numExperts, int32_t const topK)
+    int* expertTokenCount, int* const enabled, int32_t const numTokens, int32_t const numExperts, int32_t const topK)
 {
     using BaseType = std::conditional_t<DoSoftmaxBeforeTopK, float, InputT>;
     uint32_t const blockRank = blockIdx.x;
@@ -119,6 +119,19 @@ __global__ void customMoeRoutingKernel(InputT* routerLogits, OutputT* topkValues
     auto block = cg::this_thread_block();
     auto warp = cg::tiled_partition<WARP_SIZE>(block);
 
+    // Per-expert token counts for the load balancer, accumulated in shared memory and flushed
+    // once per block. doStatistic is uniform across the block, so the barriers below are safe.
+    __shared__ int sharedExpertCount[MaxNumExperts];
+    bool const doStatistic = expertTokenCount != nullptr && *enabled != 0;
+    if (doStatistic)
+    {
+        for (int i = threadIdx.x; i < numExperts; i += BLOCK_SIZE)
+        {
+            sharedExpertCount[i] = 0;
+        }
+        __syncthreads();
+    }
+
     BaseType minScore = BaseType{-INFINITY};
     for (uint32_t tokenId = warpIdx; tokenId < numTokens; tokenId += warpNum)
     {
@@ -167,7 +180,25 @@ __global__ void customMoeRoutingKernel(InputT* routerLogits, OutputT* topkValues
                 topkIndices[outputOffset + laneIdx] = warpTopKExpertIdx[laneIdx];
             }
         }
+        if (doStatistic && laneIdx < topK)
+        {
+            atomicAdd_block(&sharedExpertCount[warpTopKExpertIdx[laneIdx]], 1);
+        }
     } // end for tokenId
+
+    if (doStatistic)
+    {
+        __syncthreads();
+        for (int i = threadIdx.x; i < numExperts; i += BLOCK_SIZE)
+        {
+            int count = sharedExpertCount[i];
+            if (count != 0)
+            {
+                // System scope: expertTokenCount may be host-accessible memory polled by the CPU.
+                atomicAdd_system(&expertTokenCount[i], count);
+            }
+        }
+    }
 }
 
 int nextPowerOfTwo(int num)
@@ -210,8 +241,9 @@ int nextPowerOfTwo(int num)
         break;
 
 template <typename InputT, typename OutputT, typename IdxT, bool DoSoftmaxBeforeTopK>
-void invokeCustomMoeRouting(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices, int64_t const numTokens,
-    int64_t const numExperts, int64_t const topK, cudaStream_t const stream)
+void invokeCustomMoeRoutingWithLoadBalanceStatistic(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices,
+    int* expertTokenCount, int* const enabled, int64_t const numTokens, int64_t const numExperts, int64_t const topK,
+    cudaStream_t const stream)
 {
 
     const uint32_t maxNumBlocks = 1024;
@@ -248,15 +280,26 @@ void invokeCustomMoeRouting(InputT* routerLogits, OutputT* topkValues, IdxT* top
     attrs[0].val.programmaticStreamSerializationAllowed = tensorrt_llm::common::getEnvEnablePDL();
     config.numAttrs = 1;
     config.attrs = attrs;
-    cudaLaunchKernelEx(&config, kernelInstance, routerLogits, topkValues, topkIndices, static_cast<int32_t>(numTokens),
-        static_cast<int32_t>(numExperts), static_cast<int32_t>(topK));
+    cudaLaunchKernelEx(&config, kernelInstance, routerLogits, topkValues, topkIndices, expertTokenCount, enabled,
+        static_cast<int32_t>(numTokens), static_cast<int32_t>(numExperts), static_cast<int32_t>(topK));
     sync_check_cuda_error(stream);
 }
 
+template <typename InputT, typename OutputT, typename IdxT, bool DoSoftmaxBeforeTopK>
+void invokeCustomMoeRouting(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices, int64_t const numTokens,
+    int64_t const numExperts, int64_t const topK, cudaStream_t const stream)
+{
+    invokeCustomMoeRoutingWithLoadBalanceStatistic<InputT, OutputT, IdxT, DoSoftmaxBeforeTopK>(routerLogits, topkValues,
+        topkIndices, /*expertTokenCount=*/nullptr, /*enabled=*/nullptr, numTokens, numExperts, topK, stream);
+}
+
 #define INSTANTIATE_RENORM_MOE_ROUTING(InputT, OutputT, IdxT, DoSoftmaxBeforeTopK)                                     \
     template void invokeCustomMoeRouting<InputT, OutputT, IdxT, DoSoftmaxBeforeTopK>(InputT * routerLogits,            \
         OutputT * topkValues, IdxT * topkIndices, int64_t const numTokens, int64_t const numExperts,                   \
-        int64_t const topK, cudaStream_t const stream);
+        int64_t const topK, cudaStream_t const stream);                                                                \
+    template void invokeCustomMoeRoutingWithLoadBalanceStatistic<InputT, OutputT, IdxT, DoSoftmaxBeforeTopK>(          \
+        InputT * routerLogits, OutputT * topkValues, IdxT * topkIndices, int* expertTokenCount, int* const enabled,    \
+        int64_t const numTokens, int64_t const numExperts, int64_t const topK, cudaStream_t const stream);
 
 INSTANTIATE_RENORM_MOE_ROUTING(float, float, int32_t, false);
 INSTANTIATE_RENORM_MOE_ROUTING(half, float, int32_t, false);
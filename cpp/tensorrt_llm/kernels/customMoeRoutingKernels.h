@@ -26,4 +26,14 @@ namespace tensorrt_llm::kernels
 template <typename InputT, typename OutputT, typename IdxT, bool DoSoftmaxBeforeTopK>
 void invokeCustomMoeRouting(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices, int64_t const numTokens,
     int64_t const numExperts, int64_t const topK, cudaStream_t const stream);
+
+// Same as invokeCustomMoeRouting, but additionally accumulates per-expert token counts into
+// expertTokenCount (length numExperts, may live in host-accessible device memory) from the kernel
+// epilogue, so no separate statistic kernel has to re-read the routing output.
+// The accumulation is skipped when *enabled == 0; expertTokenCount must be zeroed (or window-shifted)
+// beforehand, see moeStatisticShiftWindowDevice.
+template <typename InputT, typename OutputT, typename IdxT, bool DoSoftmaxBeforeTopK>
+void invokeCustomMoeRoutingWithLoadBalanceStatistic(InputT* routerLogits, OutputT* topkValues, IdxT* topkIndices,
+    int* expertTokenCount, int* const enabled, int64_t const numTokens, int64_t const numExperts, int64_t const topK,
+    cudaStream_t const stream);
 } // namespace tensorrt_llm::kernels
@@ -68,7 +68,7 @@ struct Sm90GemmTypes
     using EpilogueScheduleType = EpilogueScheduleType_;
 };
 
-template <typename GemmTraits, bool OneShot>
+template <typename GemmTraits, bool OneShot, bool RowwiseScale = false>
 class GemmAllReduceImplTwoshot_Sm90 : public GemmAllReduceImplInterface
 {
 public:
@@ -111,8 +111,11 @@ public:
     ////////////////
     // Epilogue
     ////////////////
-    using FusionOp = cutlass::epilogue::fusion::Sm90LinCombAuxAllReduce<OneShot, TileBarrierType, LayoutD, ElementD,
-        ElementCompute, ElementC>;
+    using FusionOp = cute::conditional_t<RowwiseScale,
+        cutlass::epilogue::fusion::Sm90RowwiseScaleAuxAllReduce<OneShot, TileBarrierType, LayoutD, ElementD,
+            ElementCompute, ElementC>,
+        cutlass::epilogue::fusion::Sm90LinCombAuxAllReduce<OneShot, TileBarrierType, LayoutD, ElementD, ElementCompute,
+            ElementC>>;
 
     using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<cutlass::arch::Sm90,
         cutlass::arch::OpClassTensorOp, TileShape_MNK, ClusterShape_MNK,
@@ -298,23 +301,50 @@ private:
             ipc_ptr_D = workspace->_stage_buf.getIpcUnicastPointers();
         }
 
-        return typename Gemm::Arguments{cutlass::gemm::GemmUniversalMode::kGemm, {M, N, K},
-            {// Mainloop arguments
-                reinterpret_cast<ElementA const*>(problem.A), stride_A, reinterpret_cast<ElementB const*>(problem.B),
-                stride_B},
-            {// Epilogue arguments
-                {problem.alpha, problem.beta, problem.alpha_ptr, nullptr, mc_ptr_D, ptr_D, stride_D,
-                    skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(), problem.rank,
-                    static_cast<int>(problem.ranks.size())},
-                reinterpret_cast<ElementC const*>(problem.C), stride_C, (ElementD*) nullptr, stride_D},
-            {// AllReduce arguments
-                mc_ptr_D, mc_ptr_out, ipc_ptr_D, ipc_ptr_out, stride_D,
-                skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(),
-                skip_AR ? typename TileBarrierType::Params{} : workspace->getCompletionBarrierParams(), problem.rank,
-                static_cast<int>(problem.ranks.size())},
-            _hw_info,
-            {// TileScheduler arguments
-                1, RasterOrderOptions::AlongN}};
+        if constexpr (RowwiseScale)
+        {
+            // The runner swaps A & B for this kernel, so problem.A_scale holds the per-channel
+            // weight scales (varying along M) and problem.B_scale the per-token activation
+            // scales (varying along N).
+            return typename Gemm::Arguments{cutlass::gemm::GemmUniversalMode::kGemm, {M, N, K},
+                {// Mainloop arguments
+                    reinterpret_cast<ElementA const*>(problem.A), stride_A,
+                    reinterpret_cast<ElementB const*>(problem.B), stride_B},
+                {// Epilogue arguments
+                    {reinterpret_cast<ElementScalar const*>(problem.A_scale),
+                        reinterpret_cast<ElementScalar const*>(problem.B_scale), mc_ptr_D, ptr_D, stride_D,
+                        skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(), problem.rank,
+                        static_cast<int>(problem.ranks.size())},
+                    reinterpret_cast<ElementC const*>(problem.C), stride_C, (ElementD*) nullptr, stride_D},
+                {// AllReduce arguments
+                    mc_ptr_D, mc_ptr_out, ipc_ptr_D, ipc_ptr_out, stride_D,
+                    skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(),
+                    skip_AR ? typename TileBarrierType::Params{} : workspace->getCompletionBarrierParams(),
+                    problem.rank, static_cast<int>(problem.ranks.size())},
+                _hw_info,
+                {// TileScheduler arguments
+                    1, RasterOrderOptions::AlongN}};
+        }
+        else
+        {
+            return typename Gemm::Arguments{cutlass::gemm::GemmUniversalMode::kGemm, {M, N, K},
+                {// Mainloop arguments
+                    reinterpret_cast<ElementA const*>(problem.A), stride_A,
+                    reinterpret_cast<ElementB const*>(problem.B), stride_B},
+                {// Epilogue arguments
+                    {problem.alpha, problem.beta, problem.alpha_ptr, nullptr, mc_ptr_D, ptr_D, stride_D,
+                        skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(), problem.rank,
+                        static_cast<int>(problem.ranks.size())},
+                    reinterpret_cast<ElementC const*>(problem.C), stride_C, (ElementD*) nullptr, stride_D},
+                {// AllReduce arguments
+                    mc_ptr_D, mc_ptr_out, ipc_ptr_D, ipc_ptr_out, stride_D,
+                    skip_AR ? typename TileBarrierType::Params{} : workspace->getTileBarrierParams(),
+                    skip_AR ? typename TileBarrierType::Params{} : workspace->getCompletionBarrierParams(),
+                    problem.rank, static_cast<int>(problem.ranks.size())},
+                _hw_info,
+                {// TileScheduler arguments
+                    1, RasterOrderOptions::AlongN}};
+        }
     }
 
     // Holds the number of SMs on the GPU.
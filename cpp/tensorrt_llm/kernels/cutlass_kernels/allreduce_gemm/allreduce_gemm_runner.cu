@@ -26,22 +26,22 @@ namespace tensorrt_llm::kernels::opened_cutlass_kernels
 /////////////////////////////////////////////////
 // GemmAllReduce implementation specializations
 /////////////////////////////////////////////////
-template <int SmVersion, GemmAllReduceImpl Impl, typename SmXGemmTraits>
+template <int SmVersion, GemmAllReduceImpl Impl, typename SmXGemmTraits, bool RowwiseScale = false>
 struct GemmImpl
 {
     using Type = void;
 };
 
 // Hopper
-template <typename SmXGemmTraits>
-struct GemmImpl<90, GemmAllReduceImpl::kNVLS_2SHOT, SmXGemmTraits>
+template <typename SmXGemmTraits, bool RowwiseScale>
+struct GemmImpl<90, GemmAllReduceImpl::kNVLS_2SHOT, SmXGemmTraits, RowwiseScale>
 {
-    using Type = GemmAllReduceImplTwoshot_Sm90<SmXGemmTraits, false>;
+    using Type = GemmAllReduceImplTwoshot_Sm90<SmXGemmTraits, false, RowwiseScale>;
 };
 
 // Blackwell
 template <typename SmXGemmTraits>
-struct GemmImpl<100, GemmAllReduceImpl::kNVLS_2SHOT, SmXGemmTraits>
+struct GemmImpl<100, GemmAllReduceImpl::kNVLS_2SHOT, SmXGemmTraits, false>
 {
     using Type = GemmAllReduceImplTwoshot_Sm100<SmXGemmTraits>;
 };
@@ -54,7 +54,7 @@ class GemmAllReduceRegistryBuilder
 {
 public:
     template <typename GemmTraits, GemmAllReduceImpl Impl, MainloopScheduleType Schedule, TileShape TileShape_MNK,
-        ClusterShape ClusterShape_MNK>
+        ClusterShape ClusterShape_MNK, bool RowwiseScale = false>
     void addSm90()
     {
         using TransposedGemmTraits = decltype(swapAndTranspose<GemmTraits>());
@@ -78,7 +78,7 @@ public:
             typename TransposedGemmTraits::LayoutD, decltype(get_tile_shape<TileShape_MNK>()),
             decltype(get_cluster_shape<ClusterShape_MNK>()), MainloopSchedule, EpilogueSchedule>;
 
-        using GemmType = typename GemmImpl<90, Impl, Sm90GemmTraits>::Type;
+        using GemmType = typename GemmImpl<90, Impl, Sm90GemmTraits, RowwiseScale>::Type;
         static_assert(not std::is_same_v<GemmType, void>);
 
         const GemmAllReduceImplInterface::LaunchConfig key(
@@ -165,7 +165,10 @@ template <typename GemmTraits>
 GemmAllReduceImplRunner<GemmTraits>::GemmAllReduceImplRunner()
 {
     GemmAllReduceRegistryBuilder<KeyType, ValueType> registry_builder;
+    GemmAllReduceRegistryBuilder<KeyType, ValueType> rowwise_registry_builder;
     constexpr int bits_input = cutlass::sizeof_bits<typename GemmTraits::ElementA>::value;
+    constexpr bool is_fp8 = std::is_same_v<typename GemmTraits::ElementA, cutlass::float_e4m3_t>
+        and std::is_same_v<typename GemmTraits::ElementB, cutlass::float_e4m3_t>;
 
     // Instantiate GEMMs for each config
     switch (tensorrt_llm::common::getSMVersion())
@@ -184,6 +187,22 @@ GemmAllReduceImplRunner<GemmTraits>::GemmAllReduceImplRunner()
             registry_builder.addSm90<GemmTraits, GemmAllReduceImpl::kNVLS_2SHOT, MainloopScheduleType::PINGPONG,
                 TileShape::TileShape_128x128x128, ClusterShape::ClusterShape_2x1x1>();
         }
+        // Rowwise-quantized FP8 needs the per-token/per-channel dequant fused into the epilogue.
+        if constexpr (is_fp8)
+        {
+            rowwise_registry_builder.addSm90<GemmTraits, GemmAllReduceImpl::kNVLS_2SHOT,
+                MainloopScheduleType::PINGPONG, TileShape::TileShape_128x16x128, ClusterShape::ClusterShape_2x1x1,
+                true>();
+            rowwise_registry_builder.addSm90<GemmTraits, GemmAllReduceImpl::kNVLS_2SHOT,
+                MainloopScheduleType::PINGPONG, TileShape::TileShape_128x32x128, ClusterShape::ClusterShape_2x1x1,
+                true>();
+            rowwise_registry_builder.addSm90<GemmTraits, GemmAllReduceImpl::kNVLS_2SHOT,
+                MainloopScheduleType::PINGPONG, TileShape::TileShape_128x64x128, ClusterShape::ClusterShape_2x1x1,
+                true>();
+            rowwise_registry_builder.addSm90<GemmTraits, GemmAllReduceImpl::kNVLS_2SHOT,
+                MainloopScheduleType::PINGPONG, TileShape::TileShape_128x128x128, ClusterShape::ClusterShape_2x1x1,
+                true>();
+        }
         break;
     // Blackwell
     case 100:
@@ -194,6 +213,7 @@ GemmAllReduceImplRunner<GemmTraits>::GemmAllReduceImplRunner()
     }
 
     mGemmRegistry = registry_builder.build();
+    mRowwiseGemmRegistry = rowwise_registry_builder.build();
 }
 
 template <typename GemmTraits>
@@ -224,8 +244,20 @@ template <typename GemmTraits>
 int GemmAllReduceImplRunner<GemmTraits>::run(ProblemArgs const& problem, cudaStream_t stream)
 {
     auto swapped_problem = swapAB(problem);
-    TLLM_CHECK_WITH_INFO(mGemmRegistry.count(swapped_problem.launch_config) > 0, "No cutlass gemm impl found.");
-    auto gemm_impl = mGemmRegistry.at(swapped_problem.launch_config);
+    // For FP8 there are no mainloop scale factors, so A_scale/B_scale carry the rowwise dequant vectors.
+    constexpr bool is_fp8 = std::is_same_v<typename GemmTraits::ElementA, cutlass::float_e4m3_t>
+        and std::is_same_v<typename GemmTraits::ElementB, cutlass::float_e4m3_t>;
+    bool const rowwise_scale = is_fp8 and (problem.A_scale != nullptr or problem.B_scale != nullptr);
+    if (rowwise_scale)
+    {
+        TLLM_CHECK_WITH_INFO(problem.A_scale != nullptr and problem.B_scale != nullptr,
+            "Rowwise scaling requires both per-token and per-channel scale vectors.");
+        TLLM_CHECK_WITH_INFO(
+            not mRowwiseGemmRegistry.empty(), "Rowwise scaling not supported on this architecture.");
+    }
+    auto const& registry = rowwise_scale ? mRowwiseGemmRegistry : mGemmRegistry;
+    TLLM_CHECK_WITH_INFO(registry.count(swapped_problem.launch_config) > 0, "No cutlass gemm impl found.");
+    auto gemm_impl = registry.at(swapped_problem.launch_config);
     return gemm_impl->run(swapped_problem, stream);
 }
 
@@ -257,7 +289,7 @@ GemmAllReduceImplInterface::ProblemArgs GemmAllReduceImplRunner<GemmTraits>::swa
     swapped_problem.A = problem.B;
     swapped_problem.B = problem.A;
     swapped_problem.A_scale = problem.B_scale;
-    swapped_problem.B_scale = problem.B_scale;
+    swapped_problem.B_scale = problem.A_scale;
     swapped_problem.problem_size = std::make_tuple(N, M, K, L);
     return swapped_problem;
 }
@@ -397,4 +397,85 @@ struct FusionCallbacks<epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, Fragme
     using Impl::Impl;
 };
 
+// D = AllReduce(scale_n * (scale_m * acc))
+// Rowwise dequantization for FP8: scale_m broadcasts along M (one scale per row)
+// and scale_n broadcasts along N (one scale per column).
+template <bool IsOneShot_, class SystemBarrier_, class GmemLayoutTagAux_, class ElementAux_, class ElementCompute_,
+    class ElementSource_ = ElementAux_, class ElementScalar_ = ElementCompute_,
+    FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest>
+struct Sm90RowwiseScaleAuxAllReduce
+    : LinearCombination<ElementAux_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_>
+{
+    using ElementAux = ElementAux_;
+    using GmemLayoutTagAux = GmemLayoutTagAux_;
+    static constexpr int AlignmentAux = 128 / cute::sizeof_bits_v<ElementAux_>;
+    static constexpr bool IsAuxOutSupported = true;
+};
+
+template <int StagesD, bool IsOneShot, class SystemBarrier, class GmemLayoutTagOutput, class ElementOutput,
+    class ElementCompute, class ElementScalar, FloatRoundStyle RoundStyle, class CtaTileShapeMNK, class EpilogueTile,
+    class SmemLayoutAtom, class CopyOpR2S>
+using Sm90RowwiseScaleCombAuxAllReduce
+    = Sm90EVT<Sm90AuxAllReduce<StagesD, EpilogueTile, ElementOutput, cutlass::gemm::TagToStrideC_t<GmemLayoutTagOutput>,
+                  SmemLayoutAtom, RoundStyle, CopyOpR2S, CtaTileShapeMNK, SystemBarrier, IsOneShot>, // Aux AR
+        Sm90EVT<Sm90Compute<cutlass::multiplies, ElementOutput, ElementCompute, RoundStyle>, // scale_n * (scale_m * acc)
+            Sm90RowBroadcast<0, CtaTileShapeMNK, ElementScalar, ElementCompute, Stride<_0, _1, _0>>, // scale_n
+            Sm90EVT<Sm90Compute<cutlass::multiplies, ElementCompute, ElementCompute, RoundStyle>,    // scale_m * acc
+                Sm90ColBroadcast<0, CtaTileShapeMNK, ElementScalar, ElementCompute, Stride<_1, _0, _0>>, // scale_m
+                Sm90AccFetch>>>;
+
+template <
+    // Dispatch policy arguments
+    int StagesC, int StagesD, int FragmentSize, bool ReuseSmemC, bool DelayTmaStore,
+    // Fusion Op arguments
+    bool IsOneShot, class SystemBarrier, class GmemLayoutTagD, class ElementD, class ElementCompute, class ElementC,
+    class ElementScalar, FloatRoundStyle RoundStyle,
+    // Epilogue arguments
+    class CtaTileShapeMNK, class EpilogueTile, class SmemLayoutAtom, class CopyOpR2S>
+struct FusionCallbacks<epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    Sm90RowwiseScaleAuxAllReduce<IsOneShot, SystemBarrier, GmemLayoutTagD, ElementD, ElementCompute, ElementC,
+        ElementScalar, RoundStyle>,
+    CtaTileShapeMNK, EpilogueTile, SmemLayoutAtom, CopyOpR2S>
+    : Sm90RowwiseScaleCombAuxAllReduce<StagesD, IsOneShot, SystemBarrier, GmemLayoutTagD, ElementD, ElementCompute,
+          ElementScalar, RoundStyle, CtaTileShapeMNK, EpilogueTile, SmemLayoutAtom, CopyOpR2S>
+{
+
+    using Impl = Sm90RowwiseScaleCombAuxAllReduce<StagesD, IsOneShot, SystemBarrier, GmemLayoutTagD, ElementD,
+        ElementCompute, ElementScalar, RoundStyle, CtaTileShapeMNK, EpilogueTile, SmemLayoutAtom, CopyOpR2S>;
+    using Operation = Sm90RowwiseScaleAuxAllReduce<IsOneShot, SystemBarrier, GmemLayoutTagD, ElementD, ElementCompute,
+        ElementC, ElementScalar, RoundStyle>;
+
+    struct Arguments
+    {
+        using StrideD = cutlass::gemm::TagToStrideC_t<GmemLayoutTagD>;
+        ElementScalar const* scale_m_ptr = nullptr; // one scale per output row
+        ElementScalar const* scale_n_ptr = nullptr; // one scale per output column
+        ElementD* multicast_ptr_aux = nullptr;
+        ElementD* ptr_aux = nullptr;
+        StrideD dAux = {};
+        typename SystemBarrier::Params barrier_params{};
+        int rank = 0;
+        int num_ranks = 1;
+
+        operator typename Impl::Arguments() const
+        {
+            return {{
+                        // binary op : scale_n * (scale_m * acc)
+                        {const_cast<ElementScalar*>(scale_n_ptr)}, // leaf args : scale_n
+                        {
+                            // binary op : scale_m * acc
+                            {const_cast<ElementScalar*>(scale_m_ptr)}, // leaf args : scale_m
+                            {},                                        // leaf args : acc
+                            {}                                         // binary args : multiplies
+                        },                                             // end binary op
+                        {}                                             // binary args : multiplies
+                    },                                                 // end binary op
+                {multicast_ptr_aux, ptr_aux, dAux, barrier_params, rank, num_ranks}};
+        }
+    };
+
+    // Ctor inheritance
+    using Impl::Impl;
+};
+
 } // namespace cutlass::epilogue::fusion
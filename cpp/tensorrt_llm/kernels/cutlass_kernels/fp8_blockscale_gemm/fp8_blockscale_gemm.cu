@@ -182,6 +182,20 @@ void CutlassFp8BlockScaleGemmRunner<ElementA, ElementB, ElementD>::fp8CS1x128(
     fp8_1x128_cs(mat_quant, scales, mat, shape_x, shape_y, stream);
 }
 
+template <typename ElementA, typename ElementB, typename ElementD>
+void CutlassFp8BlockScaleGemmRunner<ElementA, ElementB, ElementD>::fp8CS1x128Dequant(__nv_fp8_e4m3* mat_quant,
+    float* scales, __nv_fp8_e4m3 const* mat, float const* global_scale, int shape_x, int shape_y, cudaStream_t stream)
+{
+    fp8_1x128_cs_dequant(mat_quant, scales, mat, global_scale, shape_x, shape_y, stream);
+}
+
+template <typename ElementA, typename ElementB, typename ElementD>
+void CutlassFp8BlockScaleGemmRunner<ElementA, ElementB, ElementD>::fp8CS1x128SwiGlu(
+    __nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y, cudaStream_t stream)
+{
+    fp8_1x128_cs_swiglu(mat_quant, scales, mat, shape_x, shape_y, stream);
+}
+
 template <typename ElementA, typename ElementB, typename ElementD>
 void CutlassFp8BlockScaleGemmRunner<ElementA, ElementB, ElementD>::fp8CS1x128Reshape(__nv_fp8_e4m3* mat_quant,
     float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_h, int shape_y, int stride_x, cudaStream_t stream)
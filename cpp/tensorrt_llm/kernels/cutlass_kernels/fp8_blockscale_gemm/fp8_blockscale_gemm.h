@@ -53,6 +53,15 @@ public:
     virtual void fp8CS1x128(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y,
         cudaStream_t stream)
         = 0;
+    //! Requantizes a per-tensor scaled FP8 matrix to 1x128 block scales without a BF16 round trip.
+    virtual void fp8CS1x128Dequant(__nv_fp8_e4m3* mat_quant, float* scales, __nv_fp8_e4m3 const* mat,
+        float const* global_scale, int shape_x, int shape_y, cudaStream_t stream)
+        = 0;
+    //! Applies SwiGLU to a BF16 [shape_y, 2 * shape_x] gate-up matrix and quantizes the activated
+    //! half to 1x128 block scales without materializing the BF16 activations.
+    virtual void fp8CS1x128SwiGlu(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x,
+        int shape_y, cudaStream_t stream)
+        = 0;
     virtual void fp8CS1x128Reshape(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x,
         int shape_h, int shape_y, int stride_x, cudaStream_t stream)
         = 0;
@@ -105,6 +114,10 @@ public:
 
     void fp8CS1x128(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y,
         cudaStream_t stream) override;
+    void fp8CS1x128Dequant(__nv_fp8_e4m3* mat_quant, float* scales, __nv_fp8_e4m3 const* mat,
+        float const* global_scale, int shape_x, int shape_y, cudaStream_t stream) override;
+    void fp8CS1x128SwiGlu(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y,
+        cudaStream_t stream) override;
     void fp8CS1x128Reshape(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_h,
         int shape_y, int stride_x, cudaStream_t stream) override;
     void fp8CS128x128(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y,
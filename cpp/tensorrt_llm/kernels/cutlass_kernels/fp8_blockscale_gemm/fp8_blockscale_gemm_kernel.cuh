@@ -1040,6 +1040,115 @@ __global__ void scale_1x128_kernel(
 #endif
 }
 
+// Requantizes a per-tensor scaled FP8 matrix to per-1x128-block scales in a single pass. The
+// per-tensor scale is applied while searching the block amax, so the BF16 intermediate a separate
+// dequantize + quantize pair would materialize never touches global memory.
+__global__ void dequant_scale_1x128_kernel(__nv_fp8_e4m3* output, float* scales, __nv_fp8_e4m3 const* const input,
+    float const* global_scale, int dim_x, int dim_y)
+{
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 890))
+    size_t scales_along_dim_x = div_up(dim_x, 128);
+    size_t scales_along_dim_y = div_up(dim_y, 1);
+    size_t stride_scale_dim_y = div_up(dim_y, 4) * 4;
+    float const dequant_scale = *global_scale;
+    for (size_t warp_idx = (blockIdx.x * blockDim.x + threadIdx.x) / 32;
+         warp_idx < scales_along_dim_x * scales_along_dim_y; warp_idx += gridDim.x * blockDim.x / 32)
+    {
+        int scales_idx_y = warp_idx / scales_along_dim_x;
+        int scales_idx_x = warp_idx % scales_along_dim_x;
+
+        __nv_fp8_e4m3 const* input_line = input + (size_t) scales_idx_y * dim_x + scales_idx_x * 128;
+        int lane_id = threadIdx.x % 32;
+
+        float input_frag[4] = {0.f, 0.f, 0.f, 0.f};
+        float input_amax = 0.f;
+#pragma unroll
+        for (int i = 0; i < 4; i++)
+        {
+            if (scales_idx_x * 128 + i * 32 + lane_id < dim_x)
+            {
+                input_frag[i] = float(input_line[i * 32 + lane_id]) * dequant_scale;
+                input_amax = std::max(input_amax, std::abs(input_frag[i]));
+            }
+        }
+
+        float amax = find_max_elem_in_warp(input_amax);
+        float scale = amax != 0.f ? 448.f / amax : 1.f;
+
+        if (lane_id == 0)
+        {
+            scales[(size_t) scales_idx_x * stride_scale_dim_y + scales_idx_y] = 1.f / scale;
+        }
+
+        __nv_fp8_e4m3* output_line = output + (size_t) scales_idx_y * dim_x + scales_idx_x * 128;
+#pragma unroll
+        for (int i = 0; i < 4; i++)
+        {
+            if (scales_idx_x * 128 + i * 32 + lane_id < dim_x)
+            {
+                output_line[i * 32 + lane_id] = __nv_fp8_e4m3(input_frag[i] * scale);
+            }
+        }
+    }
+#endif
+}
+
+// Applies SwiGLU to a [dim_y, 2 * dim_x] gate-up matrix (linear half first, gate half second, the
+// torch chunk order) and quantizes the activated [dim_y, dim_x] result to per-1x128-block scales in
+// a single pass, so the activation tensor a separate SwiGLU + quantize pair would materialize never
+// touches global memory.
+template <typename InputType>
+__global__ void swiglu_scale_1x128_kernel(
+    __nv_fp8_e4m3* output, float* scales, InputType const* const input, int dim_x, int dim_y)
+{
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 890))
+    size_t scales_along_dim_x = div_up(dim_x, 128);
+    size_t scales_along_dim_y = div_up(dim_y, 1);
+    size_t stride_scale_dim_y = div_up(dim_y, 4) * 4;
+    for (size_t warp_idx = (blockIdx.x * blockDim.x + threadIdx.x) / 32;
+         warp_idx < scales_along_dim_x * scales_along_dim_y; warp_idx += gridDim.x * blockDim.x / 32)
+    {
+        int scales_idx_y = warp_idx / scales_along_dim_x;
+        int scales_idx_x = warp_idx % scales_along_dim_x;
+
+        InputType const* input_line = input + (size_t) scales_idx_y * dim_x * 2 + scales_idx_x * 128;
+        int lane_id = threadIdx.x % 32;
+
+        float input_frag[4] = {0.f, 0.f, 0.f, 0.f};
+        float input_amax = 0.f;
+#pragma unroll
+        for (int i = 0; i < 4; i++)
+        {
+            if (scales_idx_x * 128 + i * 32 + lane_id < dim_x)
+            {
+                float linear = float(input_line[i * 32 + lane_id]);
+                float gate = float(input_line[dim_x + i * 32 + lane_id]);
+                input_frag[i] = linear * gate / (1.f + std::exp(-gate));
+                input_amax = std::max(input_amax, std::abs(input_frag[i]));
+            }
+        }
+
+        float amax = find_max_elem_in_warp(input_amax);
+        float scale = amax != 0.f ? 448.f / amax : 1.f;
+
+        if (lane_id == 0)
+        {
+            scales[(size_t) scales_idx_x * stride_scale_dim_y + scales_idx_y] = 1.f / scale;
+        }
+
+        __nv_fp8_e4m3* output_line = output + (size_t) scales_idx_y * dim_x + scales_idx_x * 128;
+#pragma unroll
+        for (int i = 0; i < 4; i++)
+        {
+            if (scales_idx_x * 128 + i * 32 + lane_id < dim_x)
+            {
+                output_line[i * 32 + lane_id] = __nv_fp8_e4m3(input_frag[i] * scale);
+            }
+        }
+    }
+#endif
+}
+
 template <bool UseBinarySearch, typename InputType, typename OutputType>
 __global__ void scale_1x128_kernel(OutputType* output, float* scales, InputType const* input,
     int64_t const* problem_m_offsets, int num_problems, int dim_x, int64_t scale_leading_dim, uint32_t scale_dim_x_mul,
@@ -1375,6 +1484,27 @@ void fp8_1x128_cs(
     scale_1x128_kernel<<<kNumDeviceSMs * 8, 256, 0, stream>>>(mat_quant, scales, mat, shape_x, shape_y);
 }
 
+void fp8_1x128_cs_dequant(__nv_fp8_e4m3* mat_quant, float* scales, __nv_fp8_e4m3 const* mat, float const* global_scale,
+    int shape_x, int shape_y, cudaStream_t stream)
+{
+    if (kNumDeviceSMs < 0)
+    {
+        kNumDeviceSMs = tensorrt_llm::common::getMultiProcessorCount();
+    }
+    dequant_scale_1x128_kernel<<<kNumDeviceSMs * 8, 256, 0, stream>>>(
+        mat_quant, scales, mat, global_scale, shape_x, shape_y);
+}
+
+void fp8_1x128_cs_swiglu(
+    __nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_y, cudaStream_t stream)
+{
+    if (kNumDeviceSMs < 0)
+    {
+        kNumDeviceSMs = tensorrt_llm::common::getMultiProcessorCount();
+    }
+    swiglu_scale_1x128_kernel<<<kNumDeviceSMs * 8, 256, 0, stream>>>(mat_quant, scales, mat, shape_x, shape_y);
+}
+
 void fp8_1x128_cs_reshape(__nv_fp8_e4m3* mat_quant, float* scales, __nv_bfloat16 const* mat, int shape_x, int shape_h,
     int shape_y, int stride_x, cudaStream_t stream)
 {
@@ -102,6 +102,8 @@ public:
         void* D = nullptr;
         void* D_mc = nullptr;   // required for NVLink Sharp
         void** D_ipc = nullptr; // required if NOT using NVLink Sharp
+        // Block scale factors for FP4, or rowwise dequant vectors for FP8
+        // (A_scale = per-token scales of length M, B_scale = per-channel scales of length N).
         void const* A_scale = nullptr;
         void const* B_scale = nullptr;
         float alpha = 1.f;
@@ -246,6 +248,8 @@ private:
     using ValueType = std::shared_ptr<GemmAllReduceImplInterface>;
 
     std::map<KeyType, ValueType> mGemmRegistry;
+    // FP8 kernels with rowwise dequant fused into the epilogue, keyed identically to mGemmRegistry.
+    std::map<KeyType, ValueType> mRowwiseGemmRegistry;
 };
 
 } // namespace tensorrt_llm::kernels::opened_cutlass_kernels
@@ -2122,20 +2122,24 @@ __global__ void doActivationKernel(T* output, GemmOutputType const* gemm_result,
 #if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
     asm volatile("griddepcontrol.wait;");
 #endif
+    int64_t expert = 0;
     for (int64_t token = blockIdx.x; token < num_valid_tokens; token += gridDim.x)
     {
         size_t gemm_result_offset = token * inter_size * gated_size_mul;
         size_t output_offset = token * inter_size;
 
-        int64_t expert = 0;
         float gate_alpha = 1.0f;
         float gate_beta = 0.0f;
         float gate_limit = std::numeric_limits<float>::infinity();
         if (bias_ptr || IsNVFP4 || IsMXFP8 || use_per_expert_act_scale || activation_params.swiglu_alpha
             || activation_params.swiglu_beta || activation_params.swiglu_limit)
         {
-            // TODO this is almost certainly faster as a linear scan
-            expert = findTotalEltsLessThanTarget(expert_first_token_offset, num_experts_per_node, token + 1) - 1;
+            // Tokens are visited in increasing order, so resume the linear scan from the previous token's
+            // expert instead of binary searching from scratch
+            while (expert + 1 < num_experts_per_node && expert_first_token_offset[expert + 1] <= token)
+            {
+                expert++;
+            }
 
             gate_alpha = activation_params.swiglu_alpha ? activation_params.swiglu_alpha[expert] : 1.0f;
             gate_beta = activation_params.swiglu_beta ? activation_params.swiglu_beta[expert] : 0.0f;
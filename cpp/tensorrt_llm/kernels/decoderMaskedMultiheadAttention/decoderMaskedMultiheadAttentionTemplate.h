@@ -1970,6 +1970,8 @@ __global__ void __launch_bounds__(MAX_THEADS_PER_BLOCK, MIN_BLOCKS_PER_SM) maske
 
         // The keys loaded from the key cache.
         K_vec_m k_vec_cache[K_LOOP_UNROLL][K_VECS_PER_THREAD];
+        // Whether the block holding each timestep is masked out by the block-skip bitmap.
+        bool k_block_skipped[K_LOOP_UNROLL];
 
 #pragma unroll
         for (int k_loop = 0; k_loop < K_LOOP_UNROLL; ++k_loop)
@@ -1999,6 +2001,19 @@ __global__ void __launch_bounds__(MAX_THEADS_PER_BLOCK, MIN_BLOCKS_PER_SM) maske
                 }
                 int const seqIdx = batch_idx * beam_width + beam_offset;
 
+                // Never fetch blocks masked out by the per-request block-skip bitmap; the dot
+                // product result is discarded below.
+                bool const block_skipped = pastKCache.isBlockSkipped(seqIdx, valid_time_now);
+                if (k_vec_i == 0)
+                {
+                    k_block_skipped[k_loop] = block_skipped;
+                }
+                if (block_skipped)
+                {
+                    zero(k_vec_cache[k_loop][k_vec_i]);
+                    continue;
+                }
+
                 // Base pointer to k cache block for beam's batch
                 TKcache* k_cache_batch = reinterpret_cast<TKcache*>(pastKCache.getKBlockPtr(seqIdx, valid_time_now));
 
@@ -2116,6 +2131,13 @@ __global__ void __launch_bounds__(MAX_THEADS_PER_BLOCK, MIN_BLOCKS_PER_SM) maske
                 qk_ += (1.0f - mask_val) * -10000.0f;
             }
 
+            // Mask out timesteps whose block was skipped via the block-skip bitmap (their keys
+            // were never fetched).
+            if (k_block_skipped[k_loop])
+            {
+                qk_ += -10000.0f;
+            }
+
             // There's one qk value per timestep.
             // Make sure only leader threads stores qk value within the bound.
             if (is_active && is_leader)
@@ -2373,6 +2395,15 @@ __global__ void __launch_bounds__(MAX_THEADS_PER_BLOCK, MIN_BLOCKS_PER_SM) maske
                 }
                 int rowIdx = batch_idx * beam_width + beam_offset;
 
+                // Never fetch blocks masked out by the per-request block-skip bitmap. Their
+                // logits were masked to ~0 in the key loop, so a zero value vector keeps the fma
+                // below a no-op.
+                if (kvCacheBuffer.isBlockSkipped(rowIdx, time_idx))
+                {
+                    zero(v_vec_cache[v_loop]);
+                    continue;
+                }
+
                 int const inBlockIdx = kvCacheBuffer.getKVLocalIdx(time_idx, hi_kv, Dh, vi);
                 // The base pointer for the value in the cache buffer.
                 Tcache* v_cache_batch = reinterpret_cast<Tcache*>(kvCacheBuffer.getVBlockPtr(rowIdx, time_idx));
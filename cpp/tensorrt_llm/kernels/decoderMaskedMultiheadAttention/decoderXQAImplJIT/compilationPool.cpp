@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "compilationPool.h"
+
+#include <algorithm>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+namespace jit
+{
+
+CompilationPool& CompilationPool::getInstance()
+{
+    static CompilationPool instance;
+    return instance;
+}
+
+CompilationPool::CompilationPool()
+    : mShutdown(false)
+{
+    // A single NVRTC compilation takes seconds; a handful of workers absorbs the burst of shapes
+    // prepared at setup time without oversubscribing the host.
+    unsigned int const numWorkers = std::max(1u, std::min(4u, std::thread::hardware_concurrency()));
+    mWorkers.reserve(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        mWorkers.emplace_back(&CompilationPool::workerLoop, this);
+    }
+}
+
+CompilationPool::~CompilationPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mShutdown = true;
+    }
+    mTaskAvailable.notify_all();
+    for (auto& worker : mWorkers)
+    {
+        worker.join();
+    }
+}
+
+void CompilationPool::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mTasks.push(std::move(task));
+    }
+    mTaskAvailable.notify_one();
+}
+
+void CompilationPool::workerLoop()
+{
+    while (true)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mTaskAvailable.wait(lock, [this] { return mShutdown || !mTasks.empty(); });
+            // Drain remaining tasks on shutdown so waiters on compilation results are not stranded.
+            if (mTasks.empty())
+            {
+                return;
+            }
+            task = std::move(mTasks.front());
+            mTasks.pop();
+        }
+        task();
+    }
+}
+
+} // namespace jit
+} // namespace kernels
+} // namespace tensorrt_llm
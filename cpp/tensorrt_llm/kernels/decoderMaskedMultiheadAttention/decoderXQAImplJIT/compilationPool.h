@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+namespace jit
+{
+
+// Process-wide worker pool for background NVRTC compilations, so compiling a cubin does not block
+// the thread that requested it. Queued tasks are drained before the pool shuts down.
+class CompilationPool
+{
+public:
+    static CompilationPool& getInstance();
+
+    void enqueue(std::function<void()> task);
+
+    CompilationPool(CompilationPool const&) = delete;
+    CompilationPool& operator=(CompilationPool const&) = delete;
+
+private:
+    CompilationPool();
+    ~CompilationPool();
+
+    void workerLoop();
+
+    std::mutex mMutex;
+    std::condition_variable mTaskAvailable;
+    std::queue<std::function<void()>> mTasks;
+    std::vector<std::thread> mWorkers;
+    bool mShutdown;
+};
+
+} // namespace jit
+} // namespace kernels
+} // namespace tensorrt_llm
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cubinDiskCache.h"
+
+#include "serializationUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/common/stringUtils.h"
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+namespace jit
+{
+
+CubinDiskCache& CubinDiskCache::getInstance()
+{
+    static CubinDiskCache instance;
+    return instance;
+}
+
+CubinDiskCache::CubinDiskCache()
+    : mDirectory(tensorrt_llm::common::getEnvXqaCubinCacheDir())
+{
+    if (mDirectory.empty())
+    {
+        return;
+    }
+    std::error_code ec;
+    std::filesystem::create_directories(mDirectory, ec);
+    if (ec)
+    {
+        TLLM_LOG_WARNING("Failed to create XQA cubin cache directory %s (%s); the cache is disabled.",
+            mDirectory.c_str(), ec.message().c_str());
+        mDirectory.clear();
+    }
+}
+
+std::string CubinDiskCache::entryPath(XQAKernelFullHashKey const& key) const
+{
+    // The hash determines the file name only; the serialized key stored inside the entry guards
+    // against collisions and layout changes.
+    auto const hash = static_cast<unsigned long long>(XQAKernelFullHasher()(key));
+    return tensorrt_llm::common::fmtstr("%s/xqa_sm%u_%016llx.cubin", mDirectory.c_str(), key.load_key.sm, hash);
+}
+
+std::optional<CubinObj> CubinDiskCache::tryLoad(XQAKernelFullHashKey const& key) const
+{
+    if (!isEnabled())
+    {
+        return std::nullopt;
+    }
+    auto const path = entryPath(key);
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    auto const fileSize = static_cast<size_t>(file.tellg());
+    std::vector<uint8_t> content(fileSize);
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(content.data()), fileSize);
+    if (!file)
+    {
+        TLLM_LOG_WARNING("Failed to read XQA cubin cache entry %s; ignoring it.", path.c_str());
+        return std::nullopt;
+    }
+
+    size_t remainingSize = fileSize;
+    auto const* buffer = content.data();
+    if (remainingSize < sizeof(uint32_t))
+    {
+        return std::nullopt;
+    }
+    auto const keySize = readFromBuffer<uint32_t>(buffer, remainingSize);
+    if (keySize > remainingSize)
+    {
+        return std::nullopt;
+    }
+    XQAKernelFullHashKey const storedKey(buffer, keySize);
+    if (!(storedKey == key))
+    {
+        // Hash collision or key layout change; treat as a miss.
+        return std::nullopt;
+    }
+    buffer += keySize;
+    remainingSize -= keySize;
+    TLLM_LOG_DEBUG("Loaded XQA cubin from cache entry %s.", path.c_str());
+    return CubinObj(buffer, remainingSize);
+}
+
+void CubinDiskCache::store(XQAKernelFullHashKey const& key, CubinObj const& obj) const
+{
+    if (!isEnabled())
+    {
+        return;
+    }
+    auto const path = entryPath(key);
+    // Write to a unique temporary file and rename so concurrent processes never observe a partial
+    // entry.
+    auto const ticks
+        = static_cast<unsigned long long>(std::chrono::steady_clock::now().time_since_epoch().count());
+    auto const tmpPath = tensorrt_llm::common::fmtstr("%s.tmp%llx", path.c_str(), ticks);
+
+    auto const keySize = static_cast<uint32_t>(key.getSerializationSize());
+    auto const objSize = obj.getSerializationSize();
+    std::vector<uint8_t> content(sizeof(uint32_t) + keySize + objSize);
+    size_t remainingSize = content.size();
+    auto* buffer = content.data();
+    writeToBuffer<uint32_t>(keySize, buffer, remainingSize);
+    key.serialize(buffer, remainingSize);
+    buffer += keySize;
+    remainingSize -= keySize;
+    obj.serialize(buffer, remainingSize);
+
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(reinterpret_cast<char const*>(content.data()), content.size()))
+    {
+        TLLM_LOG_WARNING("Failed to write XQA cubin cache entry %s.", tmpPath.c_str());
+        return;
+    }
+    file.close();
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec)
+    {
+        TLLM_LOG_WARNING(
+            "Failed to publish XQA cubin cache entry %s (%s).", path.c_str(), ec.message().c_str());
+        std::filesystem::remove(tmpPath, ec);
+    }
+}
+
+} // namespace jit
+} // namespace kernels
+} // namespace tensorrt_llm
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2020-2023, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include "cubinObj.h"
+#include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention/decoderXQAImplCommon.h"
+
+#include <optional>
+#include <string>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+namespace jit
+{
+
+// Persistent cache of JIT-compiled XQA cubins in the directory named by TRTLLM_XQA_CUBIN_CACHE_DIR.
+// Entries are keyed by the full kernel hash key, which includes the SM version, so one directory can
+// be shared across heterogeneous jobs. Disabled when the env var is unset.
+class CubinDiskCache
+{
+public:
+    static CubinDiskCache& getInstance();
+
+    [[nodiscard]] bool isEnabled() const
+    {
+        return !mDirectory.empty();
+    }
+
+    // Returns the cached cubin for key, or std::nullopt on a miss (or when the cache is disabled).
+    std::optional<CubinObj> tryLoad(XQAKernelFullHashKey const& key) const;
+
+    // Best-effort store: failures are logged and swallowed so a compilation result is never lost.
+    void store(XQAKernelFullHashKey const& key, CubinObj const& obj) const;
+
+    CubinDiskCache(CubinDiskCache const&) = delete;
+    CubinDiskCache& operator=(CubinDiskCache const&) = delete;
+
+private:
+    CubinDiskCache();
+
+    [[nodiscard]] std::string entryPath(XQAKernelFullHashKey const& key) const;
+
+    std::string mDirectory;
+};
+
+} // namespace jit
+} // namespace kernels
+} // namespace tensorrt_llm
@@ -16,13 +16,17 @@
 #pragma once
 #include "cubinObj.h"
 
+#include "compilationPool.h"
 #include "compileEngine.h"
 #include "serializationUtils.h"
 #include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention/decoderXQAImplCommon.h"
 
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace tensorrt_llm::kernels::jit
 {
@@ -34,6 +38,13 @@ class CubinObjRegistryTemplate
 public:
     CubinObjRegistryTemplate() = default;
 
+    ~CubinObjRegistryTemplate()
+    {
+        // Background compilations capture this; wait for them before the map goes away.
+        std::unique_lock<std::mutex> lock(mMutex);
+        drainInflightLocked(lock);
+    }
+
     CubinObjRegistryTemplate(void const* buffer_, size_t buffer_size)
     {
         size_t remaining_buffer_size = buffer_size;
@@ -62,7 +73,8 @@ public:
 
     std::unique_ptr<CubinObjRegistryTemplate<Key, Hash>> clone() const noexcept
     {
-        std::lock_guard<std::mutex> lock(mMutex);
+        std::unique_lock<std::mutex> lock(mMutex);
+        drainInflightLocked(lock);
         auto result = std::make_unique<CubinObjRegistryTemplate<Key, Hash>>();
         for (auto const& p : mMap)
         {
@@ -73,7 +85,8 @@ public:
 
     size_t getSerializationSize() const noexcept
     {
-        std::lock_guard<std::mutex> lock(mMutex);
+        std::unique_lock<std::mutex> lock(mMutex);
+        drainInflightLocked(lock);
         size_t result = sizeof(uint32_t);
         for (auto&& p : mMap)
         {
@@ -85,7 +98,8 @@ public:
 
     void serialize(void* buffer_, size_t buffer_size) const noexcept
     {
-        std::lock_guard<std::mutex> lock(mMutex);
+        std::unique_lock<std::mutex> lock(mMutex);
+        drainInflightLocked(lock);
         size_t remaining_buffer_size = buffer_size;
         auto* buffer = static_cast<uint8_t*>(buffer_);
         uint32_t n = mMap.size();
@@ -115,7 +129,10 @@ public:
     {
         TLLM_CHECK(compileEngine != nullptr);
 
-        std::lock_guard<std::mutex> lock(mMutex);
+        std::unique_lock<std::mutex> lock(mMutex);
+        // If a background compilation for the same key is in flight, wait for its result instead of
+        // compiling a second time.
+        mInflightDone.wait(lock, [this, &key] { return mInflightKeys.count(key) == 0; });
 
         auto iter = mMap.find(key);
         if (iter != mMap.end())
@@ -128,9 +145,59 @@ public:
         {
             obj.initialize();
         }
+        mFailures.erase(key);
         mMap.insert({key, std::move(obj)});
     }
 
+    // Compiles and inserts the cubin on a background worker if not found in mMap. Does nothing when
+    // the cubin is already present or a compilation for the same key is in flight. getCubin() keeps
+    // returning nullptr until the result lands; callers that cannot make progress without the cubin
+    // should use waitAndGetCubin().
+    void insertCubinAsync(Key const& key, std::function<CubinObj()> compile, bool initialize)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (mMap.find(key) != mMap.end() || mInflightKeys.count(key) != 0)
+            {
+                return;
+            }
+            mInflightKeys.insert(key);
+            // A fresh attempt supersedes any earlier failure.
+            mFailures.erase(key);
+        }
+        CompilationPool::getInstance().enqueue(
+            [this, key, compile = std::move(compile), initialize]()
+            {
+                std::exception_ptr failure;
+                CubinObj obj;
+                try
+                {
+                    obj = compile();
+                    if (initialize)
+                    {
+                        obj.initialize();
+                    }
+                }
+                catch (...)
+                {
+                    failure = std::current_exception();
+                }
+                // Notify under the lock: once the key leaves mInflightKeys the registry may be
+                // destroyed by a waiting thread.
+                std::lock_guard<std::mutex> lock(mMutex);
+                if (failure)
+                {
+                    mFailures.insert({key, failure});
+                }
+                else
+                {
+                    mMap.insert({key, std::move(obj)});
+                }
+                mInflightKeys.erase(key);
+                mInflightDone.notify_all();
+            });
+    }
+
     CubinObj* getCubin(Key const& key)
     {
         std::lock_guard<std::mutex> lock(mMutex);
@@ -143,6 +210,26 @@ public:
         return nullptr;
     }
 
+    // Blocks until no compilation for key is in flight. Rethrows the compilation failure if there
+    // was one; returns nullptr when no cubin was ever inserted for key.
+    CubinObj* waitAndGetCubin(Key const& key)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mInflightDone.wait(lock, [this, &key] { return mInflightKeys.count(key) == 0; });
+        auto failureIter = mFailures.find(key);
+        if (failureIter != mFailures.end())
+        {
+            std::rethrow_exception(failureIter->second);
+        }
+        auto iter = mMap.find(key);
+        if (iter != mMap.end())
+        {
+            return &iter->second;
+        }
+
+        return nullptr;
+    }
+
     // When initialize is true, initialize cubins.
     void merge(CubinObjRegistryTemplate<Key, Hash> const& other, bool initialize)
     {
@@ -165,8 +252,17 @@ public:
     }
 
 private:
+    // Waits until all in-flight compilations have landed. mMutex must be held via lock.
+    void drainInflightLocked(std::unique_lock<std::mutex>& lock) const
+    {
+        mInflightDone.wait(lock, [this] { return mInflightKeys.empty(); });
+    }
+
     std::unordered_map<Key, CubinObj, Hash> mMap;
+    std::unordered_set<Key, Hash> mInflightKeys;
+    std::unordered_map<Key, std::exception_ptr, Hash> mFailures;
     mutable std::mutex mMutex;
+    mutable std::condition_variable mInflightDone;
 };
 
 using CubinObjKey = XQAKernelFullHashKey;
@@ -16,6 +16,7 @@
 
 #include "tensorrt_llm/kernels/decoderMaskedMultiheadAttention/decoderXQAImplJIT/decoderXQAImplJIT.h"
 #include "compileEngine.h"
+#include "cubinDiskCache.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/utils.h"
@@ -127,6 +128,16 @@ bool DecoderXQAImplJIT::shouldUse(XQAParams const& umbrellaXQAParams, bool forCo
             TLLM_LOG_DEBUG("JIT XQA is not used: maybe no performance gain");
             return false;
         }
+        // While the cubin for this config is still compiling in the background, let the non-XQA
+        // path serve the step when one exists. Spec decoding and MLA have no such path; runImpl
+        // waits for the compilation instead.
+        bool const hasFallbackPath = !mForceXQA && !xqaParams.multi_query_tokens && !xqaParams.isMLA();
+        if (hasFallbackPath
+            && mResource->getCubinObjRegistry()->getCubin(getCubinObjKeyFromXQAParams(xqaParams)) == nullptr)
+        {
+            TLLM_LOG_DEBUG("JIT XQA is not used: cubin is still compiling");
+            return false;
+        }
         return true;
     }
 }
@@ -143,16 +154,30 @@ jit::CubinObjKey DecoderXQAImplJIT::getCubinObjKeyFromXQAParams(XQAParams const&
 
 void DecoderXQAImplJIT::prepareForActualXQAParams(XQAParams const& xqaParams)
 {
-    jit::CubinObjKey currentKey = getCubinObjKeyFromXQAParams(xqaParams);
-
-    jit::CompileEngine compileEngine(mSM, xqaParams);
-
     auto registryGlobal = mResource->getCubinObjRegistry();
 
     if (supportConfig(xqaParams, true))
     {
         jit::CubinObjKey key = getCubinObjKeyFromXQAParams(xqaParams);
-        registryGlobal->insertCubinIfNotExists(key, &compileEngine, /*initialize=*/true);
+        // Compile in the background so preparing new shapes does not stall the caller; the task
+        // owns a copy of the params since it outlives this call. The disk cache turns the NVRTC
+        // compilation into a file read for shapes seen by an earlier process.
+        int const sm = mSM;
+        registryGlobal->insertCubinAsync(
+            key,
+            [sm, key, params = xqaParams]() -> jit::CubinObj
+            {
+                auto& diskCache = jit::CubinDiskCache::getInstance();
+                if (auto cached = diskCache.tryLoad(key))
+                {
+                    return std::move(*cached);
+                }
+                jit::CompileEngine compileEngine(sm, params);
+                jit::CubinObj obj = compileEngine.compile();
+                diskCache.store(key, obj);
+                return obj;
+            },
+            /*initialize=*/true);
     }
 }
 
@@ -218,7 +243,7 @@ void DecoderXQAImplJIT::runImpl(XQAParams const& xqaParams, KVCacheBuffer const&
     int multiprocessor_count, cudaStream_t const& stream) const
 {
     jit::CubinObjKey const key = getCubinObjKeyFromXQAParams(xqaParams);
-    jit::CubinObj const* const cubinObj = mResource->getCubinObjRegistry()->getCubin(key);
+    jit::CubinObj const* const cubinObj = mResource->getCubinObjRegistry()->waitAndGetCubin(key);
     TLLM_CHECK(cubinObj != nullptr && cubinObj->isInitialized());
     bool const isSpecDec = xqaParams.multi_query_tokens;
     bool const isHMMAKernel = (cubinObj->getKernelType() == XQAKernelType::kAMPERE_WARP_SPECIALIZED);
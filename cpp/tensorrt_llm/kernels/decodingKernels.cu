@@ -16,6 +16,7 @@
 
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/launchConfigUtils.h"
 #include "tensorrt_llm/common/reduceKernelUtils.cuh"
 #include "tensorrt_llm/kernels/decodingKernels.h"
 
@@ -316,77 +317,84 @@ void invokeGatherTree(gatherTreeParam param)
     }
 }
 
-__global__ void insertUnfinishedPathKernel(BeamHypotheses bh)
+__device__ void insertUnfinishedPathBeam(BeamHypotheses const& bh, int const bid, int const i, int const indexDstStart)
 {
-    // Move ALL unfinished beams from bh.outputIdsUnfinish to bh.outputIdsCBA
-    // So here might be more than `nBM` beams in bh.outputIdsCBA after this kernel
+    // Move one unfinished beam from bh.outputIdsUnfinish to bh.outputIdsCBA
     // Data movement:
     // bh.outputIdsUnfinish -> bh.outputIdsCBA
     // bh.sequenceLengths   -> bh.sequenceLengthsCBA
     // bh.cumLogProbs       -> bh.cumLogProbsCBA
     // bh.logProbsTiled     -> bh.logProbsCBA
     // update bh.normedScoresCBA
-    // update bh.numBeamsCBA
 
-    size_t const bid = blockIdx.x;       // Index of Batch
     size_t const nBM{bh.nBeamWidth};
     size_t const nMBS{bh.nMaxBatchSize}; // Only for bh.logProbsTiled
     size_t const nMSL{bh.nMaxSeqLen};
     bool const bOutputLogProbs{bh.logProbsCBA != nullptr && bh.logProbsTiled != nullptr};
-    int const indexDstStart{bh.numBeamsCBA[bid]};
 
-    if (bh.batchDones[bid])
+    int const srcBeam = bid * nBM + i;
+    int const dstBeam = bid * nBM * 2 + i + indexDstStart;
+    int const step = bh.sequenceLengths[srcBeam] - 1;
+
+    // The last token
+    int const srcId = srcBeam * nMSL + step;
+    int const dstId = dstBeam * nMSL + step;
+    bh.outputIdsCBA[dstId] = bh.outputIdsUnfinish[srcId];
+    if (bOutputLogProbs)
     {
-        return;
+        bh.logProbsCBA[dstId] = bh.logProbsTiled[step * nMBS * nBM + srcBeam];
     }
-
-    for (int i = 0; i < nBM; ++i)
+    // Previous tokens, walking the parent chain once for both ids and log probs
+    int prevId = bh.parentIdsUnfinish[srcId];
+    for (int j = step - 1; j >= 0; --j)
     {
-        int const srcBeam = bid * nBM + i;
-        int const dstBeam = bid * nBM * 2 + i + indexDstStart;
-        int const step = bh.sequenceLengths[srcBeam] - 1;
-
-        // The last token
-        int const srcId = srcBeam * nMSL + step;
-        int const dstId = dstBeam * nMSL + step;
-        bh.outputIdsCBA[dstId] = bh.outputIdsUnfinish[srcId];
+        int const index = bid * nBM * nMSL + prevId * nMSL + j;
+        bh.outputIdsCBA[dstBeam * nMSL + j] = bh.outputIdsUnfinish[index];
         if (bOutputLogProbs)
         {
-            bh.logProbsCBA[dstId] = bh.logProbsTiled[step * nMBS * nBM + srcBeam];
+            bh.logProbsCBA[dstBeam * nMSL + j] = bh.logProbsTiled[j * nMBS * nBM + bid * nBM + prevId];
         }
-        // Previous tokens
-        int prevId = bh.parentIdsUnfinish[srcId];
-        for (int j = step - 1; j >= 0; --j)
-        {
-            int const index = bid * nBM * nMSL + prevId * nMSL + j;
-            bh.outputIdsCBA[dstBeam * nMSL + j] = bh.outputIdsUnfinish[index];
-            prevId = bh.parentIdsUnfinish[index];
-        }
-        if (bOutputLogProbs)
-        {
-            prevId = bh.parentIdsUnfinish[srcId];
-            for (int j = step - 1; j >= 0; --j)
-            {
-                int const index = bid * nBM * nMSL + prevId * nMSL + j;
-                bh.logProbsCBA[dstBeam * nMSL + j] = bh.logProbsTiled[j * nMBS * nBM + bid * nBM + prevId];
-                prevId = bh.parentIdsUnfinish[index];
-            }
-        }
-        // Other parameters
-        bh.sequenceLengthsCBA[dstBeam] = bh.sequenceLengths[srcBeam];
-        bh.normedScoresCBA[dstBeam]
-            = applyLengthPenalty(bh.cumLogProbs[srcBeam], step - bh.inputLengths[srcBeam] + 1, bh.lengthPenalties[bid]);
-        bh.cumLogProbsCBA[dstBeam] = bh.cumLogProbs[srcBeam];
-        bh.numBeamsCBA[bid]++;
+        prevId = bh.parentIdsUnfinish[index];
+    }
+    // Other parameters
+    bh.sequenceLengthsCBA[dstBeam] = bh.sequenceLengths[srcBeam];
+    bh.normedScoresCBA[dstBeam]
+        = applyLengthPenalty(bh.cumLogProbs[srcBeam], step - bh.inputLengths[srcBeam] + 1, bh.lengthPenalties[bid]);
+    bh.cumLogProbsCBA[dstBeam] = bh.cumLogProbs[srcBeam];
+}
+
+__global__ void insertUnfinishedPathKernel(BeamHypotheses bh)
+{
+    // Move ALL unfinished beams from bh.outputIdsUnfinish to bh.outputIdsCBA, one beam per thread
+    // So here might be more than `nBM` beams in bh.outputIdsCBA after this kernel
+
+    int const bid = blockIdx.x; // Index of Batch
+    int const nBM = bh.nBeamWidth;
+
+    if (bh.batchDones[bid])
+    {
+        return;
+    }
+
+    int const indexDstStart{bh.numBeamsCBA[bid]};
+    for (int i = threadIdx.x; i < nBM; i += blockDim.x)
+    {
+        insertUnfinishedPathBeam(bh, bid, i, indexDstStart);
+    }
+    if (threadIdx.x == 0)
+    {
+        bh.numBeamsCBA[bid] += nBM;
     }
 }
 
 void invokeInsertUnfinishedPath(BeamHypotheses& bh, cudaStream_t stream)
 {
-    insertUnfinishedPathKernel<<<bh.nBatchSize, 1, 0, stream>>>(bh);
+    int const nBM = bh.nBeamWidth;
+    int const nThread = min(roundUp(nBM, 32), 1024);
+    insertUnfinishedPathKernel<<<bh.nBatchSize, nThread, 0, stream>>>(bh);
 }
 
-__global__ void finalizeKernel(BeamHypotheses bh)
+__device__ void finalizeBatch(BeamHypotheses const& bh, int const bid, int const nCBA)
 {
     // Do index sort on bh.normedScoresCBA, then move buffers from CBA to output by the order of index
     // Data movement:
@@ -395,11 +403,9 @@ __global__ void finalizeKernel(BeamHypotheses bh)
     // bh.cumLogProbsCBA     -> bh.cumLogProbs
     // bh.logProbsCBA        -> bh.logProbs
 
-    int const bid = blockIdx.x;  // Index of Batch
     int const tid = threadIdx.x; // Index of Beam
     size_t const nBM{bh.nBeamWidth};
     size_t const nMSL{bh.nMaxSeqLen};
-    int const nCBA{bh.numBeamsCBA[bid]}; // Count of candidates in CBA, nBM <= nCBA <= 2*nBM
 
     extern __shared__ char smem[];
     int* smemRank = (int*) (smem);                // [nBM]
@@ -463,7 +469,7 @@ __global__ void finalizeKernel(BeamHypotheses bh)
             for (int j = 0; j < (nCBA + 1024 - 1) / 1024; ++j)
             {
                 int const index = tid + 1024 * j;
-                float const score = (index < bh.numBeamsCBA[bid]) ? smemScore[index] : -FLT_MAX;
+                float const score = (index < nCBA) ? smemScore[index] : -FLT_MAX;
                 float const maxScore1 = blockReduceMax<float>(score);
                 maxScore = max(maxScore, maxScore1);
             }
@@ -519,6 +525,13 @@ __global__ void finalizeKernel(BeamHypotheses bh)
     }
 }
 
+__global__ void finalizeKernel(BeamHypotheses bh)
+{
+    int const bid = blockIdx.x;          // Index of Batch
+    int const nCBA{bh.numBeamsCBA[bid]}; // Count of candidates in CBA, nBM <= nCBA <= 2*nBM
+    finalizeBatch(bh, bid, nCBA);
+}
+
 void invokeFinalize(BeamHypotheses& bh, cudaStream_t stream)
 {
     int const nBM = bh.nBeamWidth;
@@ -528,6 +541,42 @@ void invokeFinalize(BeamHypotheses& bh, cudaStream_t stream)
     sync_check_cuda_error(stream);
 }
 
+__global__ void insertUnfinishedPathAndFinalizeKernel(BeamHypotheses bh)
+{
+    // Insert phase then sort/gather phase in a single launch, saving a kernel launch and a trip of
+    // the CBA buffers through global memory between the two phases of stream-end finalization
+
+    int const bid = blockIdx.x; // Index of Batch
+    int const nBM = bh.nBeamWidth;
+
+    int nCBA = bh.numBeamsCBA[bid];
+    if (!bh.batchDones[bid])
+    {
+        int const indexDstStart{nCBA};
+        for (int i = threadIdx.x; i < nBM; i += blockDim.x)
+        {
+            insertUnfinishedPathBeam(bh, bid, i, indexDstStart);
+        }
+        nCBA += nBM;
+        if (threadIdx.x == 0)
+        {
+            bh.numBeamsCBA[bid] = nCBA;
+        }
+        __syncthreads();
+    }
+
+    finalizeBatch(bh, bid, nCBA);
+}
+
+void invokeInsertUnfinishedPathAndFinalize(BeamHypotheses& bh, cudaStream_t stream)
+{
+    int const nBM = bh.nBeamWidth;
+    int const nThread = min(roundUp(nBM * 2, 32), 1024);
+    size_t const nByteSharedMemory = (sizeof(int) + sizeof(float)) * nBM * 2;
+    insertUnfinishedPathAndFinalizeKernel<<<bh.nBatchSize, nThread, nByteSharedMemory, stream>>>(bh);
+    sync_check_cuda_error(stream);
+}
+
 __global__ void copyBeamHypotheses(CopyBeamHypothesesStruct copyStruct)
 {
     auto const idx = static_cast<SizeType32>(threadIdx.x + blockIdx.x * blockDim.x);
@@ -670,8 +719,7 @@ void invokeCopyNextStepIds(TokenIdType* nextStepIds, TokenIdType const* const* o
     SizeType32 maxTokensPerStep, cudaStream_t stream)
 {
     int const numElems = batchSize * beamWidth * maxTokensPerStep;
-    dim3 block(min(256, numElems));
-    dim3 grid(divUp(numElems, block.x));
+    auto const [grid, block] = adviseGridStrideLaunch1D(&copyNextStepIds, numElems);
     copyNextStepIds<<<grid, block, 0, stream>>>(nextStepIds, outputIdsPtr, sequenceLengths, numNewTokens, batchSlots,
         batchSize, maxBatchSize, beamWidth, maxSeqLen, maxTokensPerStep);
 }
@@ -704,8 +752,7 @@ void invokeTransposeLogProbs(float* outputLogProbs, float* outputLogProbsTiled,
     SizeType32 const* batchSlots, SizeType32 batchSize, SizeType32 maxBatchSize, SizeType32 beamWidth,
     SizeType32 maxSeqLen, cudaStream_t stream)
 {
-    dim3 block(256);
-    dim3 grid(divUp(batchSize * beamWidth * maxSeqLen, block.x));
+    auto const [grid, block] = adviseCoveringLaunch1D(&transposeLogProbs, batchSize * beamWidth * maxSeqLen);
     transposeLogProbs<<<grid, block, 0, stream>>>(outputLogProbs, outputLogProbsTiled, sequenceLengths, batchSlots,
         batchSize, maxBatchSize, beamWidth, maxSeqLen);
 }
@@ -793,10 +840,7 @@ void gatherTree(DecodingOutput const& decodingOutput, DecodingInput const& decod
     bh.parentIdsUnfinish = bufferCast<TokenIdType>(*decodingOutput.parentIds);
 
     // This is where transpose is done
-    tensorrt_llm::kernels::invokeInsertUnfinishedPath(bh, stream);
-    sync_check_cuda_error(stream);
-
-    tensorrt_llm::kernels::invokeFinalize(bh, stream);
+    tensorrt_llm::kernels::invokeInsertUnfinishedPathAndFinalize(bh, stream);
     sync_check_cuda_error(stream);
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
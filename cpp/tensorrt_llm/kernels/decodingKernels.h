@@ -62,6 +62,11 @@ void invokeInsertUnfinishedPath(BeamHypotheses& bh, cudaStream_t stream);
 
 void invokeFinalize(BeamHypotheses& bh, cudaStream_t stream);
 
+//! \brief Fused equivalent of invokeInsertUnfinishedPath followed by invokeFinalize in a single
+//! launch: the unfinished beams are inserted into the CBA buffers with one thread per beam, then the
+//! same block sorts the candidates and gathers the final outputs.
+void invokeInsertUnfinishedPathAndFinalize(BeamHypotheses& bh, cudaStream_t stream);
+
 //! \brief invoke the kernel that Initializes the output tensor by prefilling it with end tokens.
 //!
 //! \param finalOutputIds The output tensor to be initialized.
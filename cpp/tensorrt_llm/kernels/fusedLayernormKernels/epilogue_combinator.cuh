@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include "tensorrt_llm/common/cudaFp8Utils.h"
+#include <cuda.h>
+#include <cuda_bf16.h>
+#include <cuda_fp16.h>
+
+namespace tensorrt_llm::kernels
+{
+
+// Elementwise epilogue stages applied to the normalized values right before the writeback.
+// Each stage captures its operands from the kernel Param in the constructor and transforms the
+// row values in accumulator (float) precision; a stage whose operand keeps its default value
+// degenerates to a uniform no-op branch, so one instantiation serves the whole family.
+
+// v = cap * tanh(v / cap), the Gemma-2 style soft-capping. Disabled when softcap_scale == 0.
+template <typename T>
+struct SoftcapStage
+{
+    float const cap;
+
+    template <typename Param>
+    __device__ __forceinline__ SoftcapStage(Param const& p)
+        : cap(p.softcap_scale)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD>
+    __device__ __forceinline__ void apply(int rowIdx, int n_base, float (&vals)[ELTS_PER_THREAD]) const
+    {
+        if (cap == 0.f)
+        {
+            return;
+        }
+        float const inv_cap = 1.f / cap;
+#pragma unroll
+        for (int j = 0; j < (int) ELTS_PER_THREAD; j++)
+        {
+            vals[j] = cap * tanhf(vals[j] * inv_cap);
+        }
+    }
+};
+
+// Adds the residual stream after the norm (Gemma-2 post-norm ordering). The packed load mirrors
+// the writeback access pattern so it stays fully coalesced. Disabled when post_residual == nullptr.
+template <typename T>
+struct PostResidualStage
+{
+    T const* const residual;
+    int const numCols;
+
+    template <typename Param>
+    __device__ __forceinline__ PostResidualStage(Param const& p)
+        : residual(p.post_residual)
+        , numCols(p.n)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD>
+    __device__ __forceinline__ void apply(int rowIdx, int n_base, float (&vals)[ELTS_PER_THREAD]) const
+    {
+        if (residual == nullptr)
+        {
+            return;
+        }
+        auto const residual_in
+            = reinterpret_cast<typename PackType<T, ELTS_PER_THREAD>::type const*>(&residual[rowIdx * numCols + n_base])[0];
+#pragma unroll
+        for (int j = 0; j < (int) ELTS_PER_THREAD; j++)
+        {
+            vals[j] += (float) residual_in.array[j];
+        }
+    }
+};
+
+// Multiplies the normalized values by a scalar (DeepSeek norm-scale ordering). Disabled when
+// post_scale == 1.
+template <typename T>
+struct PostScaleStage
+{
+    float const scale;
+
+    template <typename Param>
+    __device__ __forceinline__ PostScaleStage(Param const& p)
+        : scale(p.post_scale)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD>
+    __device__ __forceinline__ void apply(int rowIdx, int n_base, float (&vals)[ELTS_PER_THREAD]) const
+    {
+        if (scale == 1.f)
+        {
+            return;
+        }
+#pragma unroll
+        for (int j = 0; j < (int) ELTS_PER_THREAD; j++)
+        {
+            vals[j] *= scale;
+        }
+    }
+};
+
+template <typename... Stages>
+struct StageChain;
+
+template <>
+struct StageChain<>
+{
+    template <typename Param>
+    __device__ __forceinline__ StageChain(Param const&)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD>
+    __device__ __forceinline__ void apply(int, int, float (&)[ELTS_PER_THREAD]) const
+    {
+    }
+};
+
+template <typename First, typename... Rest>
+struct StageChain<First, Rest...>
+{
+    First const first;
+    StageChain<Rest...> const rest;
+
+    template <typename Param>
+    __device__ __forceinline__ StageChain(Param const& p)
+        : first(p)
+        , rest(p)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD>
+    __device__ __forceinline__ void apply(int rowIdx, int n_base, float (&vals)[ELTS_PER_THREAD]) const
+    {
+        first.template apply<ELTS_PER_THREAD>(rowIdx, n_base, vals);
+        rest.template apply<ELTS_PER_THREAD>(rowIdx, n_base, vals);
+    }
+};
+
+// Generic fused operator chaining epilogue stages behind the layernorm writeback. It follows the
+// Traits::FusedOperator protocol (see FP4Converter): constructed from the kernel Param, handed the
+// packed normalized values via post_process(), and owning the store to param.normed_output.
+template <typename TOut, typename... Stages>
+struct EpilogueCombinator
+{
+    TOut* const out;
+    int const numCols;
+    StageChain<Stages...> const stages;
+
+    template <typename Param>
+    __device__ __forceinline__ EpilogueCombinator(Param const& p)
+        : out(p.normed_output)
+        , numCols(p.n)
+        , stages(p)
+    {
+    }
+
+    template <size_t ELTS_PER_THREAD, typename T>
+    __device__ __forceinline__ void post_process(int rowIdx, int n_base, T packed_input) const
+    {
+        float vals[ELTS_PER_THREAD];
+#pragma unroll
+        for (int j = 0; j < (int) ELTS_PER_THREAD; j++)
+        {
+            vals[j] = (float) packed_input.array[j];
+        }
+
+        stages.template apply<ELTS_PER_THREAD>(rowIdx, n_base, vals);
+
+        typename PackType<TOut, ELTS_PER_THREAD>::type packed_out;
+#pragma unroll
+        for (int j = 0; j < (int) ELTS_PER_THREAD; j++)
+        {
+            packed_out.array[j] = (TOut) vals[j];
+        }
+        reinterpret_cast<decltype(packed_out)*>(&out[rowIdx * numCols + n_base])[0] = packed_out;
+    }
+};
+
+} // namespace tensorrt_llm::kernels
@@ -41,4 +41,28 @@ struct GeneralFP4AddBiasResidualPreLayerNormParam
     cudaStream_t stream;
 };
 
+// Parameters for the fused epilogue layernorm variants. The epilogue stages transform the
+// normalized values right before the writeback: optional soft-capping (Gemma-2), an optional
+// residual that joins after the norm (Gemma-2 post-norm ordering) and an optional scalar applied
+// after the norm (DeepSeek norm-scale ordering). The defaults leave every stage disabled.
+template <typename T>
+struct GeneralFusedEpilogueLayerNormParam
+{
+    T* normed_output;
+    T* output;
+    T* input;
+    T const* residual = nullptr;      // Joins before the norm; ignored by the post-norm traits.
+    T const* post_residual = nullptr; // Joins after the norm; selects the post-norm traits.
+    T const* bias = nullptr;
+    T const* gamma = nullptr;
+    T const* beta = nullptr;
+    float softcap_scale = 0.f; // 0 disables soft-capping.
+    float post_scale = 1.f;    // Applied after the norm (and soft-capping).
+
+    int m;
+    int n;
+    float layernorm_eps;
+    cudaStream_t stream;
+};
+
 } // namespace tensorrt_llm::kernels
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/low_latency_layernorm.cuh"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/ws_layernorm.cuh"
+
+namespace tensorrt_llm::kernels
+{
+
+// Shared tile-size / scheduling-mode selection for the warp specialized layernorm family, so that
+// every traits family (FP4 converter, fused epilogues, ...) picks identical launch configurations.
+// The caller provides a generic lambda taking (m_block, n_block, stages, persistent, low_latency)
+// as ConstExprWrapper tags; it is expected to build the concrete traits and call
+// launchWSLayerNorm.
+
+template <typename Traits>
+void launchWSLayerNorm(WarpSpecializedParam<typename Traits::Param> param, int ctas)
+{
+    using Operator
+        = std::conditional_t<Traits::LOW_LATENCY_MODE, LowLatencyLayerNorm<Traits>, WarpSpecializedLayerNorm<Traits>>;
+    constexpr auto N_THREADS = Traits::MATH_WARPGROUPS * 128 + (Traits::LOW_LATENCY_MODE ? 0 : 128);
+    assert(param.n % Traits::PACKED_ELEMS_PER_COMPUTE == 0);
+    static_assert(sizeof(typename Operator::Shared) <= 262144);
+    static bool printed = false;
+    if (!printed)
+    {
+        int waves = ((param.m + Traits::M_BLOCK - 1) / Traits::M_BLOCK + ctas - 1) / ctas;
+        TLLM_LOG_DEBUG(
+            "Selected TILE_M = %d, N = %d, STAGE = %d, PERSISTENT_MODE = %d, LOW_LATENCY_MODE = %d for param M = "
+            "%d, N = %d, num_sms = %d. (waves = %d)\n",
+            Traits::M_BLOCK, Traits::N_BLOCK, Traits::STAGES, Traits::PERSISTENT_MODE, Traits::LOW_LATENCY_MODE,
+            param.m, param.n, ctas, waves);
+        printed = true;
+    }
+
+    CUDA_CALL(cudaFuncSetAttribute(warpSpecializedInvoker<Operator, N_THREADS>,
+        cudaFuncAttributeMaxDynamicSharedMemorySize, sizeof(typename Operator::Shared)));
+
+    if constexpr (!Traits::PERSISTENT_MODE)
+    {
+        ctas = (param.m + Traits::M_BLOCK - 1) / Traits::M_BLOCK;
+    }
+
+    cudaLaunchConfig_t config;
+    cudaLaunchAttribute attrs[1];
+    config.gridDim = ctas;
+    config.blockDim = N_THREADS;
+    config.dynamicSmemBytes = sizeof(typename Operator::Shared);
+    config.stream = param.stream;
+    config.attrs = attrs;
+    attrs[0].id = cudaLaunchAttributeProgrammaticStreamSerialization;
+    attrs[0].val.programmaticStreamSerializationAllowed = 1;
+    config.numAttrs = 1;
+
+    CUDA_CALL(cudaLaunchKernelEx(&config, &warpSpecializedInvoker<Operator, N_THREADS>, param));
+}
+
+template <typename Param, typename InvokeTraits>
+void selectWSLayerNormConfig(WarpSpecializedParam<Param> const& param, int ctas, InvokeTraits&& invoke_traits)
+{
+
+    auto _invokeSelectPersistentMode = [&](auto m_block, auto n_block)
+    {
+        constexpr auto M_BLOCK = decltype(m_block)::value;
+        constexpr auto N_BLOCK = decltype(n_block)::value;
+
+        constexpr int STAGES = N_BLOCK >= 8192 ? 2 : 3;
+
+        int waves = ((param.m + M_BLOCK - 1) / M_BLOCK + ctas - 1) / ctas;
+
+        if (M_BLOCK == 1 && waves == 1)
+        {
+            invoke_traits(ConstInt<1>{}, n_block, ConstInt<1>{}, ConstBool<false>{}, ConstBool<true>{});
+        }
+        else if (waves <= 1)
+        {
+            invoke_traits(m_block, n_block, ConstInt<1>{}, ConstBool<false>{}, ConstBool<false>{});
+        }
+        else if (waves <= 2)
+        {
+            invoke_traits(m_block, n_block, ConstInt<std::min(2, STAGES)>{}, ConstBool<true>{}, ConstBool<false>{});
+        }
+        else if (waves <= 3)
+        {
+            invoke_traits(m_block, n_block, ConstInt<std::min(3, STAGES)>{}, ConstBool<true>{}, ConstBool<false>{});
+        }
+        else
+        {
+            invoke_traits(m_block, n_block, ConstInt<STAGES>{}, ConstBool<true>{}, ConstBool<false>{});
+        }
+    };
+
+    auto _invokeSelectTileSize = [&](auto n_block)
+    {
+        constexpr auto N_BLOCK = decltype(n_block)::value;
+        static_assert(16384 % N_BLOCK == 0);
+        constexpr int MAX_M_BLOCK = (8192 / N_BLOCK < 4 ? 16384 / N_BLOCK : 8192 / N_BLOCK);
+
+        auto desired_m_block = (param.m + (ctas * 2) - 1) / (ctas * 2);
+
+        assert(desired_m_block);
+
+        if (desired_m_block >= MAX_M_BLOCK)
+        {
+            _invokeSelectPersistentMode(ConstInt<MAX_M_BLOCK>{}, n_block);
+            return;
+        }
+
+        int m_block = 1 << (31 - __builtin_clz(desired_m_block));
+
+        if (m_block == 1)
+        {
+            if constexpr (1 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<1>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 2)
+        {
+            if constexpr (2 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<2>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 4)
+        {
+            if constexpr (4 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<4>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 8)
+        {
+            if constexpr (8 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<8>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 16)
+        {
+            if constexpr (16 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<16>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 32)
+        {
+            if constexpr (32 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<32>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 64)
+        {
+            if constexpr (64 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<64>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else if (m_block == 128)
+        {
+            if constexpr (128 <= MAX_M_BLOCK)
+            {
+                _invokeSelectPersistentMode(ConstInt<128>{}, n_block);
+            }
+            else
+            {
+                assert(false);
+            }
+        }
+        else
+        {
+            assert(false);
+        }
+    };
+
+    auto _invokeSelectNBlock = [&]()
+    {
+        // if (param.n <= 512) {
+        //     _invokeSelectTileSize(ConstInt<512>{});
+        // } else if (param.n <= 1024) {
+        //     _invokeSelectTileSize(ConstInt<1024>{});
+        // } else
+        if (param.n <= 2048)
+        {
+            _invokeSelectTileSize(ConstInt<2048>{});
+        }
+        else if (param.n <= 4096)
+        {
+            _invokeSelectTileSize(ConstInt<4096>{});
+        }
+        else if (param.n <= 8192)
+        {
+            _invokeSelectTileSize(ConstInt<8192>{});
+        }
+        else if (param.n <= 16384)
+        {
+            _invokeSelectTileSize(ConstInt<16384>{});
+        }
+        else
+        {
+            assert(false);
+        }
+    };
+
+    _invokeSelectNBlock();
+}
+
+} // namespace tensorrt_llm::kernels
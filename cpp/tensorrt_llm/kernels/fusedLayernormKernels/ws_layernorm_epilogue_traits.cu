@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tuple>
+
+#include "tensorrt_llm/common/logger.h"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/epilogue_combinator.cuh"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/layernorm_param.h"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/low_latency_layernorm.cuh"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/ws_layernorm.cuh"
+#include "tensorrt_llm/kernels/fusedLayernormKernels/ws_layernorm_dispatch.cuh"
+
+using namespace tensorrt_llm::kernels;
+using namespace tensorrt_llm::common;
+
+namespace tensorrt_llm::kernels
+{
+
+// Layernorm with a generic elementwise epilogue. The pre-norm flavor (_POST_NORM = false) adds the
+// residual ahead of the norm and soft-caps / scales the normalized values (Gemma logit
+// soft-capping, DeepSeek norm-scale ordering). The post-norm flavor takes its residual inside the
+// epilogue instead (Gemma-2 post-norm ordering) and has no meaningful un-normed output.
+template <typename _Param, typename _InputType, bool _POST_NORM, bool _RMS_NORM, int _M_BLOCK, int _N_BLOCK,
+    int _STAGES = 3, bool _PERSISTENT_MODE = true, bool _LOW_LATENCY_MODE = false>
+struct FusedEpilogueLayerNormTraits
+{
+
+    using FusedOperator = std::conditional_t<_POST_NORM,
+        EpilogueCombinator<_InputType, SoftcapStage<_InputType>, PostResidualStage<_InputType>,
+            PostScaleStage<_InputType>>,
+        EpilogueCombinator<_InputType, SoftcapStage<_InputType>, PostScaleStage<_InputType>>>;
+
+    using Param = _Param;
+    using InputType = _InputType;
+    using OutputType = _InputType;
+    using AccumulatorType = float;
+    static constexpr bool RMS_NORM = _RMS_NORM;
+    static constexpr int M_BLOCK = _M_BLOCK;
+    static constexpr int N_BLOCK = _N_BLOCK;
+    static constexpr int STAGES = _STAGES;
+    static constexpr int MATH_WARPGROUPS = _LOW_LATENCY_MODE ? (_N_BLOCK > 4096 ? 4 : 2) : (_PERSISTENT_MODE ? 2 : 1);
+    static constexpr int PACKED_ELEMS_PER_COMPUTE
+        = std::min(16 / sizeof(InputType), (size_t) N_BLOCK / (_LOW_LATENCY_MODE ? MATH_WARPGROUPS * 128 : 128));
+    static constexpr bool GAMMA = true;
+    static constexpr bool BETA = false;
+    static constexpr bool RESIDUAL = !_POST_NORM;
+    static constexpr bool UNNORMED_OUTPUT = !_POST_NORM;
+    static constexpr SCALE_TYPE INPUT_SCALE = SCALE_TYPE::NONE;
+    static constexpr SCALE_TYPE BIAS = SCALE_TYPE::NONE;
+    static constexpr SCALE_TYPE OUTPUT_SCALE = SCALE_TYPE::NONE;
+    static constexpr bool USE_BULK_STORE = false;
+    static constexpr bool PERSISTENT_MODE = _PERSISTENT_MODE;
+    static constexpr bool LOW_LATENCY_MODE = _LOW_LATENCY_MODE;
+    static constexpr bool PREFETCH_TO_L2 = false;
+    static constexpr bool HIGH_PRECISION_NORMED_OUTPUT = false;
+};
+
+template <typename T>
+void invokeWSLayerNormImpl(
+    WarpSpecializedParam<GeneralFusedEpilogueLayerNormParam<T>> param, bool use_rms_norm, int ctas)
+{
+    // The residual placement is a compile-time property of the DMA stage, so it picks the traits
+    // flavor; soft-capping and scaling stay runtime-disabled stages of the same instantiation.
+    bool const post_norm = param.post_residual != nullptr;
+
+    selectWSLayerNormConfig(param, ctas,
+        [&](auto m_block, auto n_block, auto stages, auto persistent, auto low_latency_mode)
+        {
+            constexpr auto M_BLOCK = decltype(m_block)::value;
+            constexpr auto N_BLOCK = decltype(n_block)::value;
+            constexpr auto STAGES = decltype(stages)::value;
+            constexpr auto PERSISTENT = decltype(persistent)::value;
+            constexpr auto LOW_LATENCY_MODE = decltype(low_latency_mode)::value;
+
+            auto _launch = [&](auto post, auto rms)
+            {
+                launchWSLayerNorm<FusedEpilogueLayerNormTraits<GeneralFusedEpilogueLayerNormParam<T>, T,
+                    decltype(post)::value, decltype(rms)::value, M_BLOCK, N_BLOCK, STAGES, PERSISTENT,
+                    LOW_LATENCY_MODE>>(param, ctas);
+            };
+
+            if (post_norm)
+            {
+                use_rms_norm ? _launch(ConstBool<true>{}, ConstBool<true>{})
+                             : _launch(ConstBool<true>{}, ConstBool<false>{});
+            }
+            else
+            {
+                use_rms_norm ? _launch(ConstBool<false>{}, ConstBool<true>{})
+                             : _launch(ConstBool<false>{}, ConstBool<false>{});
+            }
+        });
+}
+
+template <>
+void invokeWSLayerNorm<GeneralFusedEpilogueLayerNormParam<half>>(
+    WarpSpecializedParam<GeneralFusedEpilogueLayerNormParam<half>> param, bool use_rms_norm, int ctas)
+{
+    invokeWSLayerNormImpl(param, use_rms_norm, ctas);
+}
+
+template <>
+void invokeWSLayerNorm<GeneralFusedEpilogueLayerNormParam<__nv_bfloat16>>(
+    WarpSpecializedParam<GeneralFusedEpilogueLayerNormParam<__nv_bfloat16>> param, bool use_rms_norm, int ctas)
+{
+    invokeWSLayerNormImpl(param, use_rms_norm, ctas);
+}
+
+} // namespace tensorrt_llm::kernels
@@ -18,6 +18,7 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/common/mathUtils.h"
 #include "tensorrt_llm/common/reduceKernelUtils.cuh"
+#include "tensorrt_llm/kernels/kvCacheUtils.h"
 #include <cmath>
 #include <cuda_bf16.h>
 #include <cuda_fp16.h>
@@ -54,7 +55,9 @@ namespace tensorrt_llm::kernels
 // Perform per-head QK Norm and RoPE in a single kernel.
 // head_dim: the dimension of each head
 // interleave: interleave=!is_neox.
-template <int head_dim, bool interleave>
+// write_kv_cache: also append the rotated K heads and the untouched V heads to the paged KV cache,
+// with extra warps covering the V heads.
+template <int head_dim, bool interleave, bool write_kv_cache>
 __global__ void fusedQKNormRopeKernel(
     __nv_bfloat16* qkv,            // Combined QKV tensor [num_tokens, (num_heads_q+num_heads_k+num_heads_v)*head_dim]
     int const num_heads_q,         // Number of query heads
@@ -70,7 +73,9 @@ __global__ void fusedQKNormRopeKernel(
     float factor, // factor in rope_scaling in config.json. When it is not 1.0, it means the model is using yarn.
     float low,    // threshold for high frequency
     float high,   // threshold for low frequency
-    float attention_factor // attention_factor applied on cos and sin
+    float attention_factor,      // attention_factor applied on cos and sin
+    KVBlockArray kv_cache,       // Paged KV cache to append K/V to (used when write_kv_cache)
+    int const* seq_idx_per_token // Sequence index of each token (used when write_kv_cache)
 )
 {
     int const warpsPerBlock = blockDim.x / 32;
@@ -83,16 +88,20 @@ __global__ void fusedQKNormRopeKernel(
     // Total number of attention heads (Q and K)
     int const total_qk_heads = num_heads_q + num_heads_k;
 
-    // Determine which token and head type (Q or K) this warp processes
-    int const tokenIdx = globalWarpIdx / total_qk_heads;
-    int const localHeadIdx = globalWarpIdx % total_qk_heads;
+    // With the KV cache write enabled, additional warps carry the V heads into the cache
+    int const heads_per_token = write_kv_cache ? total_qk_heads + num_heads_v : total_qk_heads;
+
+    // Determine which token and head type (Q, K or V) this warp processes
+    int const tokenIdx = globalWarpIdx / heads_per_token;
+    int const localHeadIdx = globalWarpIdx % heads_per_token;
 
     // Skip if this warp is assigned beyond the number of tokens
     if (tokenIdx >= num_tokens)
         return;
 
     bool const isQ = localHeadIdx < num_heads_q;
-    int const headIdx = isQ ? localHeadIdx : localHeadIdx - num_heads_q;
+    bool const isV = localHeadIdx >= total_qk_heads;
+    int const headIdx = isQ ? localHeadIdx : (isV ? localHeadIdx - total_qk_heads : localHeadIdx - num_heads_q);
 
     int const num_heads = num_heads_q + num_heads_k + num_heads_v;
 
@@ -106,18 +115,24 @@ __global__ void fusedQKNormRopeKernel(
     constexpr int vecSize = elemSizeBytes / 4; // Use packed_as<uint, vecSize> to perform loading/saving.
     using vec_T = typename tensorrt_llm::common::packed_as<uint, vecSize>::type;
 
-    int offsetWarp; // Offset for the warp
-    if (isQ)
-    {
-        // Q segment: token offset + head offset within Q segment
-        offsetWarp = tokenIdx * num_heads * head_dim + headIdx * head_dim;
-    }
-    else
+    // Token offset + head offset; localHeadIdx runs over the contiguous Q/K/V segments
+    int offsetWarp = tokenIdx * num_heads * head_dim + localHeadIdx * head_dim;
+    int offsetThread = offsetWarp + laneId * numElemsPerThread;
+
+    if constexpr (write_kv_cache)
     {
-        // K segment: token offset + entire Q segment + head offset within K segment
-        offsetWarp = tokenIdx * num_heads * head_dim + num_heads_q * head_dim + headIdx * head_dim;
+        if (isV)
+        {
+            // V heads need no norm or RoPE; copy them straight into the cache
+            vec_T vec = *reinterpret_cast<vec_T const*>(&qkv[offsetThread]);
+            int const seqIdx = seq_idx_per_token[tokenIdx];
+            int const kvTokenIdx = kv_cache.getKVTokenIdx(position_ids[tokenIdx]);
+            auto* vCachePtr = reinterpret_cast<__nv_bfloat16*>(kv_cache.getVBlockPtr(seqIdx, kvTokenIdx));
+            int const localIdx = kv_cache.getKVLocalIdx(kvTokenIdx, headIdx, head_dim, laneId * numElemsPerThread);
+            *reinterpret_cast<vec_T*>(&vCachePtr[localIdx]) = vec;
+            return;
+        }
     }
-    int offsetThread = offsetWarp + laneId * numElemsPerThread;
 
     // Sum of squares for RMSNorm
     float sumOfSquares = 0.0f;
@@ -247,15 +262,26 @@ __global__ void fusedQKNormRopeKernel(
     }
 
     // Store.
+    vec_T vec;
+    for (int i = 0; i < vecSize; i++)
     {
-        vec_T vec;
-        for (int i = 0; i < vecSize; i++)
+        __nv_bfloat162 vals = __float22bfloat162_rn(make_float2(elements[2 * i], elements[2 * i + 1]));
+        reinterpret_cast<__nv_bfloat162&>(*(reinterpret_cast<uint*>(&vec) + i)) = vals;
+    }
+    vec_T* outputPtr = reinterpret_cast<vec_T*>(&qkv[offsetThread]);
+    *outputPtr = vec;
+
+    if constexpr (write_kv_cache)
+    {
+        if (!isQ)
         {
-            __nv_bfloat162 vals = __float22bfloat162_rn(make_float2(elements[2 * i], elements[2 * i + 1]));
-            reinterpret_cast<__nv_bfloat162&>(*(reinterpret_cast<uint*>(&vec) + i)) = vals;
+            // Append the rotated K head to the cache, next to the V heads written above
+            int const seqIdx = seq_idx_per_token[tokenIdx];
+            int const kvTokenIdx = kv_cache.getKVTokenIdx(position_ids[tokenIdx]);
+            auto* kCachePtr = reinterpret_cast<__nv_bfloat16*>(kv_cache.getKBlockPtr(seqIdx, kvTokenIdx));
+            int const localIdx = kv_cache.getKVLocalIdx(kvTokenIdx, headIdx, head_dim, laneId * numElemsPerThread);
+            *reinterpret_cast<vec_T*>(&kCachePtr[localIdx]) = vec;
         }
-        vec_T* outputPtr = reinterpret_cast<vec_T*>(&qkv[offsetThread]);
-        *outputPtr = vec;
     }
 }
 
@@ -276,17 +302,26 @@ __global__ void fusedQKNormRopeKernel(
 void launchFusedQKNormRope(void* qkv, int const num_tokens, int const num_heads_q, int const num_heads_k,
     int const num_heads_v, int const head_dim, float const eps, void const* q_weight, void const* k_weight,
     float const base, bool const interleave, int const* position_ids, float factor, float low, float high,
-    float attention_factor, cudaStream_t stream)
+    float attention_factor, cudaStream_t stream, KVBlockArray const* kv_cache, int const* seq_idx_per_token)
 {
     if (factor == 1.0f)
     {
         TLLM_CHECK(attention_factor == 1.0f);
     }
+    bool const writeKvCache = kv_cache != nullptr;
+    if (writeKvCache)
+    {
+        TLLM_CHECK_WITH_INFO(seq_idx_per_token != nullptr, "seq_idx_per_token is required when writing the KV cache");
+    }
+    // Passed by value to the kernel; an empty array when the epilogue is disabled.
+    KVBlockArray const kvCacheArg = writeKvCache ? *kv_cache : KVBlockArray{};
+
     constexpr int blockSize = 256;
 
     int const warpsPerBlock = blockSize / 32;
-    int const totalQKHeads = num_heads_q + num_heads_k;
-    int const totalWarps = num_tokens * totalQKHeads;
+    // The KV cache write covers the V heads with extra warps.
+    int const headsPerToken = writeKvCache ? num_heads_q + num_heads_k + num_heads_v : num_heads_q + num_heads_k;
+    int const totalWarps = num_tokens * headsPerToken;
 
     int const gridSize = common::divUp(totalWarps, warpsPerBlock);
     dim3 gridDim(gridSize);
@@ -298,26 +333,35 @@ void launchFusedQKNormRope(void* qkv, int const num_tokens, int const num_heads_
     {
     case 64:
         DISPATCH_INTERLEAVE(interleave, INTERLEAVE, {
-            fusedQKNormRopeKernel<64, INTERLEAVE><<<gridDim, blockDim, 0, stream>>>(
-                reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
-                reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
-                base, position_ids, num_tokens, factor, low, high, attention_factor);
+            DISPATCH_INTERLEAVE(writeKvCache, WRITE_KV_CACHE, {
+                fusedQKNormRopeKernel<64, INTERLEAVE, WRITE_KV_CACHE><<<gridDim, blockDim, 0, stream>>>(
+                    reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
+                    reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
+                    base, position_ids, num_tokens, factor, low, high, attention_factor, kvCacheArg,
+                    seq_idx_per_token);
+            });
         });
         break;
     case 128:
         DISPATCH_INTERLEAVE(interleave, INTERLEAVE, {
-            fusedQKNormRopeKernel<128, INTERLEAVE><<<gridDim, blockDim, 0, stream>>>(
-                reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
-                reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
-                base, position_ids, num_tokens, factor, low, high, attention_factor);
+            DISPATCH_INTERLEAVE(writeKvCache, WRITE_KV_CACHE, {
+                fusedQKNormRopeKernel<128, INTERLEAVE, WRITE_KV_CACHE><<<gridDim, blockDim, 0, stream>>>(
+                    reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
+                    reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
+                    base, position_ids, num_tokens, factor, low, high, attention_factor, kvCacheArg,
+                    seq_idx_per_token);
+            });
         });
         break;
     case 256:
         DISPATCH_INTERLEAVE(interleave, INTERLEAVE, {
-            fusedQKNormRopeKernel<256, INTERLEAVE><<<gridDim, blockDim, 0, stream>>>(
-                reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
-                reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
-                base, position_ids, num_tokens, factor, low, high, attention_factor);
+            DISPATCH_INTERLEAVE(writeKvCache, WRITE_KV_CACHE, {
+                fusedQKNormRopeKernel<256, INTERLEAVE, WRITE_KV_CACHE><<<gridDim, blockDim, 0, stream>>>(
+                    reinterpret_cast<__nv_bfloat16*>(qkv), num_heads_q, num_heads_k, num_heads_v, eps,
+                    reinterpret_cast<__nv_bfloat16 const*>(q_weight), reinterpret_cast<__nv_bfloat16 const*>(k_weight),
+                    base, position_ids, num_tokens, factor, low, high, attention_factor, kvCacheArg,
+                    seq_idx_per_token);
+            });
         });
         break;
     default: TLLM_THROW("Unsupported head dimension for fusedQKNormRope: %d", head_dim);
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "tensorrt_llm/kernels/kvCacheUtils.h"
+
 #include <cuda_runtime.h>
 
 namespace tensorrt_llm
@@ -24,7 +26,10 @@ namespace kernels
 {
 
 // Perform fused QK Normalization and RoPE in a single CUDA kernel
-// This function efficiently applies RMS normalization and RoPE embeddings to query and key tensors
+// This function efficiently applies RMS normalization and RoPE embeddings to query and key tensors.
+// When kv_cache is non-null, the kernel additionally writes the rotated K heads and the untouched V
+// heads straight into the paged KV cache blocks, so the attention op does not need a second pass
+// over K/V to append them.
 void launchFusedQKNormRope(
     void* qkv,               // Combined QKV tensor [num_tokens, (num_heads_q+num_heads_k+num_heads_v)*head_dim]
     int const num_tokens,    // Number of tokens
@@ -41,8 +46,10 @@ void launchFusedQKNormRope(
     float factor, // factor in rope_scaling in config.json. When it is not 1.0, it means the model is using yarn.
     float low,    // threshold for high frequency
     float high,   // threshold for low frequency
-    float attention_factor, // attention_factor applied on cos and sin
-    cudaStream_t stream);   // CUDA stream
+    float attention_factor,                  // attention_factor applied on cos and sin
+    cudaStream_t stream,                     // CUDA stream
+    KVBlockArray const* kv_cache = nullptr,  // Optional paged KV cache to append K/V to
+    int const* seq_idx_per_token = nullptr); // Sequence index of each token, required with kv_cache
 
 } // namespace kernels
 } // namespace tensorrt_llm
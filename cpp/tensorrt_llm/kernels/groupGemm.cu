@@ -202,14 +202,21 @@ void groupedGemmType_(std::vector<cutlass::gemm::GemmCoord> problem_sizes, std::
 void groupedGemm(std::vector<cutlass::gemm::GemmCoord> problem_sizes, std::vector<void*> const& ptrA,
     std::vector<void*> const& ptrB, std::vector<void*> const& ptrC, std::vector<void*> const& ptrD,
     void* gemmParamsWorkSpace, int64_t gemmParamsWorkSpaceSize, void* gemmWorkSpace, int64_t gemmWorkspaceSize,
-    bool isLoraIn, nvinfer1::DataType dataType, int minKN, cudaStream_t stream)
+    bool isLoraIn, nvinfer1::DataType dataType, int minKN, int maxKN, cudaStream_t stream)
 {
-    TLLM_LOG_TRACE("%s start, isLoraIn: %d, minKN = %d", __PRETTY_FUNCTION__, static_cast<int>(isLoraIn), minKN);
+    TLLM_LOG_TRACE("%s start, isLoraIn: %d, minKN = %d, maxKN = %d", __PRETTY_FUNCTION__, static_cast<int>(isLoraIn),
+        minKN, maxKN);
     if (isLoraIn)
     {
         // K >> N, like K = 1024, N = 8
         // Use larger K tile and smaller N tile
-        if (minKN >= 8)
+        if (minKN >= 8 && maxKN <= 16)
+        {
+            // Every rank in this launch fits a 16-wide N tile, so do not pad it to the 32-wide one.
+            groupedGemmType_<16, 16, 64, 16, 16, 64, 8, 8, 4>(problem_sizes, ptrA, ptrB, ptrC, ptrD,
+                gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkspaceSize, dataType, stream);
+        }
+        else if (minKN >= 8)
         {
             groupedGemmType_<16, 32, 64, 16, 32, 64, 8, 8, 4>(problem_sizes, ptrA, ptrB, ptrC, ptrD,
                 gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkspaceSize, dataType, stream);
@@ -234,7 +241,13 @@ void groupedGemm(std::vector<cutlass::gemm::GemmCoord> problem_sizes, std::vecto
     {
         // N >> K, like K = 8, N = 1024
         // User larger N tile and smaller K tile
-        if (minKN >= 8)
+        if (minKN >= 8 && maxKN <= 16)
+        {
+            // Every rank in this launch fits a 16-deep K tile, so skip the 32-deep mainloop padding.
+            groupedGemmType_<32, 128, 16, 32, 32, 16, 8, 8, 4>(problem_sizes, ptrA, ptrB, ptrC, ptrD,
+                gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkspaceSize, dataType, stream);
+        }
+        else if (minKN >= 8)
         {
             groupedGemmType_<32, 128, 32, 32, 32, 32, 8, 8, 4>(problem_sizes, ptrA, ptrB, ptrC, ptrD,
                 gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkspaceSize, dataType, stream);
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/kvCacheBatchedCopy.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+namespace
+{
+
+__global__ void cuKvCacheBatchedCopy(KvCacheBatchedCopyParams params)
+{
+    int const copyIdx = blockIdx.y;
+    auto const* src = reinterpret_cast<uint4 const*>(params.srcs[copyIdx]);
+    auto* dst = reinterpret_cast<uint4*>(params.dsts[copyIdx]);
+    auto const numElts = params.sizesInBytes[copyIdx] / sizeof(uint4);
+
+    for (auto idx = static_cast<unsigned long long>(blockIdx.x) * blockDim.x + threadIdx.x; idx < numElts;
+         idx += static_cast<unsigned long long>(gridDim.x) * blockDim.x)
+    {
+        dst[idx] = src[idx];
+    }
+}
+
+} // namespace
+
+void invokeKvCacheBatchedCopy(KvCacheBatchedCopyParams const& params, cudaStream_t stream)
+{
+    if (params.numCopies == 0)
+    {
+        return;
+    }
+    TLLM_CHECK_WITH_INFO(params.numCopies <= kMaxBatchedCopies, "Batched copy count %d exceeds limit %d",
+        params.numCopies, kMaxBatchedCopies);
+
+    unsigned long long maxElts = 0;
+    for (int i = 0; i < params.numCopies; ++i)
+    {
+        maxElts = std::max(maxElts, params.sizesInBytes[i] / sizeof(uint4));
+    }
+
+    unsigned int const blockSize = 256;
+    // Cap CTAs per copy; the grid-stride loop covers the remainder for large blocks.
+    unsigned int const ctasPerCopy
+        = static_cast<unsigned int>(std::min<unsigned long long>((maxElts + blockSize - 1) / blockSize, 32));
+    dim3 const grid{std::max(ctasPerCopy, 1u), static_cast<unsigned int>(params.numCopies), 1};
+
+    cuKvCacheBatchedCopy<<<grid, blockSize, 0, stream>>>(params);
+    TLLM_CUDA_CHECK(cudaGetLastError());
+}
+
+} // namespace kernels
+} // namespace tensorrt_llm
@@ -14,9 +14,18 @@
  * limitations under the License.
  */
 
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/reduceKernelUtils.cuh"
 #include "tensorrt_llm/kernels/kvCachePartialCopy.h"
 #include <cstdint>
+#include <cuda_fp16.h>
 #include <cuda_runtime_api.h>
+#ifdef ENABLE_BF16
+#include <cuda_bf16.h>
+#endif
+#ifdef ENABLE_FP8
+#include <cuda_fp8.h>
+#endif
 
 namespace tensorrt_llm
 {
@@ -48,6 +57,53 @@ __global__ void cuKVCacheBlockPartialCopy(T* dst, T const* src, unsigned int num
     }
 }
 
+#ifdef ENABLE_FP8
+constexpr float kFp8E4m3Max = 448.f;
+
+template <typename T>
+__global__ void cuKVCacheBlockAbsMax(T const* src, std::size_t numElems, float* blockAmax)
+{
+    float localMax = 0.f;
+    for (std::size_t i = blockIdx.x * static_cast<std::size_t>(blockDim.x) + threadIdx.x; i < numElems;
+         i += static_cast<std::size_t>(gridDim.x) * blockDim.x)
+    {
+        localMax = fmaxf(localMax, fabsf(static_cast<float>(src[i])));
+    }
+    localMax = tensorrt_llm::common::blockReduceMax(localMax);
+    if (threadIdx.x == 0)
+    {
+        // Values are non-negative, so the integer representation orders the same way as the float.
+        atomicMax(reinterpret_cast<int*>(blockAmax), __float_as_int(localMax));
+    }
+}
+
+template <typename T>
+__global__ void cuKVCacheBlockQuantizeFp8(
+    __nv_fp8_e4m3* dst, T const* src, std::size_t numElems, float const* blockAmax)
+{
+    float const amax = *blockAmax;
+    float const scale = amax > 0.f ? kFp8E4m3Max / amax : 1.f;
+    for (std::size_t i = blockIdx.x * static_cast<std::size_t>(blockDim.x) + threadIdx.x; i < numElems;
+         i += static_cast<std::size_t>(gridDim.x) * blockDim.x)
+    {
+        dst[i] = __nv_fp8_e4m3(static_cast<float>(src[i]) * scale);
+    }
+}
+
+template <typename T>
+__global__ void cuKVCacheBlockDequantizeFp8(
+    T* dst, __nv_fp8_e4m3 const* src, std::size_t numElems, float const* blockAmax)
+{
+    float const amax = *blockAmax;
+    float const invScale = amax > 0.f ? amax / kFp8E4m3Max : 1.f;
+    for (std::size_t i = blockIdx.x * static_cast<std::size_t>(blockDim.x) + threadIdx.x; i < numElems;
+         i += static_cast<std::size_t>(gridDim.x) * blockDim.x)
+    {
+        dst[i] = static_cast<T>(static_cast<float>(src[i]) * invScale);
+    }
+}
+#endif
+
 unsigned int ipow2(unsigned int v)
 {
     unsigned int cnt = 0;
@@ -132,5 +188,71 @@ void kvCacheBlockPartialCopy(IBuffer& dst, IBuffer const& src, unsigned int numL
     }
 }
 
+void kvCacheBlockQuantizeCopyFp8(IBuffer& dst, IBuffer const& src, float* blockAmax, cudaStream_t stream)
+{
+#ifdef ENABLE_FP8
+    auto const numElems = src.getSize();
+    TLLM_CHECK_WITH_INFO(dst.getSizeInBytes() >= numElems, "FP8 payload does not fit into the destination block");
+    TLLM_CUDA_CHECK(cudaMemsetAsync(blockAmax, 0, sizeof(float), stream));
+
+    unsigned int const blockSize = 256u;
+    unsigned int const gridSize
+        = static_cast<unsigned int>(std::min<std::size_t>((numElems + blockSize - 1) / blockSize, 1024u));
+    auto* dstData = reinterpret_cast<__nv_fp8_e4m3*>(dst.data());
+    switch (src.getDataType())
+    {
+    case nvinfer1::DataType::kHALF:
+    {
+        auto srcData = bufferCast<half>(src);
+        cuKVCacheBlockAbsMax<half><<<gridSize, blockSize, 0, stream>>>(srcData, numElems, blockAmax);
+        cuKVCacheBlockQuantizeFp8<half><<<gridSize, blockSize, 0, stream>>>(dstData, srcData, numElems, blockAmax);
+        break;
+    }
+#ifdef ENABLE_BF16
+    case nvinfer1::DataType::kBF16:
+    {
+        auto srcData = bufferCast<__nv_bfloat16>(src);
+        cuKVCacheBlockAbsMax<__nv_bfloat16><<<gridSize, blockSize, 0, stream>>>(srcData, numElems, blockAmax);
+        cuKVCacheBlockQuantizeFp8<__nv_bfloat16>
+            <<<gridSize, blockSize, 0, stream>>>(dstData, srcData, numElems, blockAmax);
+        break;
+    }
+#endif
+    default: TLLM_THROW("KV cache block FP8 compression requires a half or bfloat16 cache");
+    }
+#else
+    TLLM_THROW("KV cache block FP8 compression requires FP8 support");
+#endif
+}
+
+void kvCacheBlockDequantizeCopyFp8(IBuffer& dst, IBuffer const& src, float const* blockAmax, cudaStream_t stream)
+{
+#ifdef ENABLE_FP8
+    auto const numElems = dst.getSize();
+    TLLM_CHECK_WITH_INFO(src.getSizeInBytes() >= numElems, "FP8 payload is smaller than the destination block");
+
+    unsigned int const blockSize = 256u;
+    unsigned int const gridSize
+        = static_cast<unsigned int>(std::min<std::size_t>((numElems + blockSize - 1) / blockSize, 1024u));
+    auto const* srcData = reinterpret_cast<__nv_fp8_e4m3 const*>(src.data());
+    switch (dst.getDataType())
+    {
+    case nvinfer1::DataType::kHALF:
+        cuKVCacheBlockDequantizeFp8<half>
+            <<<gridSize, blockSize, 0, stream>>>(bufferCast<half>(dst), srcData, numElems, blockAmax);
+        break;
+#ifdef ENABLE_BF16
+    case nvinfer1::DataType::kBF16:
+        cuKVCacheBlockDequantizeFp8<__nv_bfloat16>
+            <<<gridSize, blockSize, 0, stream>>>(bufferCast<__nv_bfloat16>(dst), srcData, numElems, blockAmax);
+        break;
+#endif
+    default: TLLM_THROW("KV cache block FP8 compression requires a half or bfloat16 cache");
+    }
+#else
+    TLLM_THROW("KV cache block FP8 compression requires FP8 support");
+#endif
+}
+
 } // namespace kernels
 } // namespace tensorrt_llm
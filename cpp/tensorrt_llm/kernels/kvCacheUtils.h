@@ -111,6 +111,11 @@ struct KVBlockArray : public KVBlockArrayForContextFMHA
     int32_t mBubbleLen;
     // Enable one more block to save the kv tokens
     bool mEnableOneMoreBlock;
+    // Optional per-sequence block-skip bitmap for block-sparse attention patterns.
+    // Shape [B, ceil(M / 32)], row-major, one bit per logical block (LSB first). A set bit marks a
+    // block that is masked out for the whole sequence, so attention kernels may skip fetching it
+    // entirely. nullptr keeps the dense behavior.
+    uint32_t const* mBlockSkipBitmap;
 
     KVBlockArray()
         : mSecondaryPoolPtr(nullptr)
@@ -119,6 +124,7 @@ struct KVBlockArray : public KVBlockArrayForContextFMHA
         , mCyclicCacheLen{0}
         , mBubbleLen{0}
         , mEnableOneMoreBlock{false}
+        , mBlockSkipBitmap{nullptr}
     {
     }
 
@@ -129,6 +135,7 @@ struct KVBlockArray : public KVBlockArrayForContextFMHA
         , mSecondaryPoolPtr{secondaryPoolPtr}
         , mMaxAttentionWindow(maxAttentionWindow)
         , mSinkTokens(sinkTokenLen)
+        , mBlockSkipBitmap{nullptr}
     {
         auto sinkTokensInLastBlock = mSinkTokens % mTokensPerBlock;
         mBubbleLen = sinkTokensInLastBlock == 0 ? 0 : mTokensPerBlock - sinkTokensInLastBlock;
@@ -188,6 +195,22 @@ struct KVBlockArray : public KVBlockArrayForContextFMHA
         return getBlockPtr(seqIdx, tokenIdx, KVIdxType::V_IDX);
     }
 
+    __host__ __device__ [[nodiscard]] inline int32_t getSkipBitmapWordsPerSeq() const
+    {
+        return (mMaxBlocksPerSeq + 31) / 32;
+    }
+
+    __host__ __device__ [[nodiscard]] inline bool isBlockSkipped(int32_t seqIdx, int32_t tokenIdx) const
+    {
+        if (mBlockSkipBitmap == nullptr)
+        {
+            return false;
+        }
+        auto const blockIdx = tokenIdx >> mTokensPerBlockLog2;
+        auto const word = mBlockSkipBitmap[seqIdx * getSkipBitmapWordsPerSeq() + (blockIdx >> 5)];
+        return ((word >> (blockIdx & 31)) & 1u) != 0;
+    }
+
     __host__ __device__ [[nodiscard]] inline int32_t getLocalIdx(int32_t globalIdx) const
     {
         return globalIdx & ((1 << mTokensPerBlockLog2) - 1);
@@ -320,6 +343,12 @@ struct KVLinearBuffer
     {
         return headIdx * mMaxSeqLen * dimsPerHead + tokenIdx * dimsPerHead + channelIdx;
     }
+
+    __host__ __device__ [[nodiscard]] static inline bool isBlockSkipped(int32_t /*seqIdx*/, int32_t /*tokenIdx*/)
+    {
+        // The contiguous cache has no block granularity to skip.
+        return false;
+    }
 };
 
 } // namespace tensorrt_llm::kernels
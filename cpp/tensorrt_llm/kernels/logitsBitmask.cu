@@ -29,6 +29,7 @@ namespace
 
 int32_t constexpr kBitsPerMaskElement = 32;
 int32_t constexpr kThreadsPerBlock = 256;
+int32_t constexpr kWarpSize = 32;
 
 template <typename T>
 __device__ T negativeInfinity()
@@ -181,6 +182,55 @@ template void invokeLogitsBitmask<__nv_bfloat16>(
     __nv_bfloat16** logits, uint32_t const** bitmask, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
 #endif
 
+template <typename T>
+__global__ void __launch_bounds__(kThreadsPerBlock) sparseLogitsBitmaskKernel(T** __restrict__ logits,
+    uint32_t const** __restrict__ sparseMask, int32_t const* __restrict__ numWords, int32_t vocabSizePadded)
+{
+    int constexpr kWarpsPerBlock = kThreadsPerBlock / kWarpSize;
+
+    int const batchIdx = blockIdx.y;
+    uint32_t const* sparseMaskPtr = sparseMask[batchIdx];
+    T* logitsGmemPtr = logits[batchIdx];
+    int const laneIdx = threadIdx.x % kWarpSize;
+
+    // One warp per (word index, mask word) pair; lane i owns bit i, so the banned logits of a
+    // 32-token segment are written in a single coalesced transaction.
+    for (int wordIdx = blockIdx.x * kWarpsPerBlock + threadIdx.x / kWarpSize; wordIdx < numWords[batchIdx];
+         wordIdx += gridDim.x * kWarpsPerBlock)
+    {
+        int32_t const tokenOffset = static_cast<int32_t>(sparseMaskPtr[2 * wordIdx]) * kBitsPerMaskElement + laneIdx;
+        uint32_t const bitmaskVal = sparseMaskPtr[2 * wordIdx + 1];
+        if (((~bitmaskVal >> laneIdx) & 1) && tokenOffset < vocabSizePadded)
+        {
+            logitsGmemPtr[tokenOffset] = negativeInfinity<T>();
+        }
+    }
+}
+
+template <typename T>
+void invokeSparseLogitsBitmask(T** logits, uint32_t const** sparseMask, int32_t const* numWords, int32_t maxNumWords,
+    int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream)
+{
+    if (maxNumWords <= 0)
+    {
+        return;
+    }
+    int constexpr kWarpsPerBlock = kThreadsPerBlock / kWarpSize;
+    dim3 const block(kThreadsPerBlock);
+    dim3 const grid(ceilDiv(maxNumWords, kWarpsPerBlock), batchSize);
+    sparseLogitsBitmaskKernel<T><<<grid, block, 0, stream>>>(logits, sparseMask, numWords, vocabSizePadded);
+}
+
+template void invokeSparseLogitsBitmask<float>(float** logits, uint32_t const** sparseMask, int32_t const* numWords,
+    int32_t maxNumWords, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+template void invokeSparseLogitsBitmask<half>(half** logits, uint32_t const** sparseMask, int32_t const* numWords,
+    int32_t maxNumWords, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+
+#ifdef ENABLE_BF16
+template void invokeSparseLogitsBitmask<__nv_bfloat16>(__nv_bfloat16** logits, uint32_t const** sparseMask,
+    int32_t const* numWords, int32_t maxNumWords, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+#endif
+
 template <typename T, typename PackedT, int32_t kBitsPerThread>
 __global__ void __launch_bounds__(kThreadsPerBlock) contiguousLogitsBitmaskKernel(T* __restrict__ logits,
     uint32_t const* __restrict__ bitmask, int32_t const* __restrict__ tokenMask, int32_t const* __restrict__ d2t,
@@ -29,6 +29,14 @@ template <typename T>
 void invokeLogitsBitmask(
     T** logits, uint32_t const** bitmask, int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
 
+//! \brief Applies sparse grammar bitmasks to a batch of logits. Each row of sparseMask holds
+//! numWords (word index, mask word) pairs covering only the 32-token segments that are not fully
+//! allowed, so grammars that allow most of the vocabulary touch a fraction of the memory the dense
+//! kernel scans. maxNumWords is the largest numWords in the batch and bounds the grid.
+template <typename T>
+void invokeSparseLogitsBitmask(T** logits, uint32_t const** sparseMask, int32_t const* numWords, int32_t maxNumWords,
+    int32_t batchSize, int32_t vocabSizePadded, cudaStream_t stream);
+
 template <typename T>
 void invokeContiguousLogitsBitmask(T* logits, uint32_t const* bitmask, int32_t const* tokenMask, int32_t const* d2t,
     int32_t batchSize, int32_t vocabSizePadded, int32_t bitmaskSize, cudaStream_t stream);
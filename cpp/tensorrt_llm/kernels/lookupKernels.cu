@@ -76,10 +76,80 @@ void invokeLookUp(Tout* out, Idx const* input, Tin const* weight, int64_t const
         <<<grid, block, 0, stream>>>(out, input, weight, token_num, offset, size, n_embed, perTokenScales);
 }
 
+/* Fused variant for prompt tuning. The real vocabulary and the virtual-token (prompt) table are resolved in the
+ * same pass: ids in [0, vocabSize) go through the regular (possibly TP-sharded, possibly quantized) embedding
+ * table exactly as in lookup_kernel, while ids in [vocabSize, ...) index the per-task prompt table, whose row
+ * offset for the owning task is precomputed on the host and passed per token in tasks. This removes the second
+ * gather and the select/concat over two full hidden-states buffers that the unfused graph needs.
+ *
+ * promptWeight is stored in the output type (the prompt table ships with the request, unquantized). When it is
+ * null, virtual tokens write zero; with tensor parallelism only one rank passes the table so the all-reduce
+ * accumulates each prompt embedding once.
+ */
+template <typename Tout, typename Tin, typename Idx>
+__global__ void fused_lookup_kernel(Tout* output, Idx const* input, Tin const* weight, Tout const* promptWeight,
+    Idx const* tasks, int64_t const token_num, Idx const offset, Idx const size, Idx const vocabSize,
+    Idx const n_embed, Tout const* perTokenScales)
+{
+    for (int64_t index = blockIdx.x * blockDim.x + threadIdx.x; index < token_num * n_embed;
+         index += blockDim.x * gridDim.x)
+    {
+        int64_t const token_index = index / n_embed;
+        Idx const col_index = index % n_embed;
+        Idx const id = input[token_index];
+        Tout embedding;
+        if (id >= vocabSize)
+        {
+            if (promptWeight == nullptr)
+            {
+                embedding = Tout(0.f);
+            }
+            else
+            {
+                int64_t const prompt_row = static_cast<int64_t>(tasks[token_index]) + (id - vocabSize);
+                embedding = promptWeight[prompt_row * n_embed + col_index];
+            }
+        }
+        else
+        {
+            int64_t const word_index = id - offset;
+            if (word_index < 0 || word_index >= size)
+            {
+                embedding = Tout(0.f);
+            }
+            else
+            {
+                embedding = (Tout) weight[word_index * n_embed + col_index];
+                if (perTokenScales != nullptr)
+                {
+                    embedding *= perTokenScales[word_index];
+                }
+            }
+        }
+        output[index] = embedding;
+    } // end for index
+}
+
+template <typename Tout, typename Tin, typename Idx>
+void invokeFusedLookUp(Tout* out, Idx const* input, Tin const* weight, Tout const* promptWeight, Idx const* tasks,
+    int64_t const token_num, Idx const offset, Idx const size, Idx const vocabSize, Idx const n_embed,
+    Tout const* perTokenScales, cudaStream_t stream)
+{
+    int64_t constexpr max_block_num = 65536;
+    Idx constexpr max_block_size = 512;
+    dim3 grid(min(token_num, max_block_num));
+    dim3 block(min(n_embed, max_block_size));
+    fused_lookup_kernel<Tout, Tin, Idx><<<grid, block, 0, stream>>>(
+        out, input, weight, promptWeight, tasks, token_num, offset, size, vocabSize, n_embed, perTokenScales);
+}
+
 #define INSTANTIATE_LOOK_UP(Tout, Tin, Idx)                                                                            \
     template void invokeLookUp<Tout, Tin, Idx>(Tout * out, Idx const* input, Tin const* weight,                        \
         int64_t const token_num, Idx const offset, Idx const size, Idx const n_embed, Tout const* perTokenScales,      \
-        cudaStream_t stream)
+        cudaStream_t stream);                                                                                          \
+    template void invokeFusedLookUp<Tout, Tin, Idx>(Tout * out, Idx const* input, Tin const* weight,                   \
+        Tout const* promptWeight, Idx const* tasks, int64_t const token_num, Idx const offset, Idx const size,         \
+        Idx const vocabSize, Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream)
 
 INSTANTIATE_LOOK_UP(float, float, int);
 INSTANTIATE_LOOK_UP(float, int8_t, int);
@@ -91,5 +161,13 @@ INSTANTIATE_LOOK_UP(__nv_bfloat16, __nv_bfloat16, int);
 INSTANTIATE_LOOK_UP(__nv_bfloat16, int8_t, int);
 #endif
 
+#ifdef ENABLE_FP8
+INSTANTIATE_LOOK_UP(float, __nv_fp8_e4m3, int);
+INSTANTIATE_LOOK_UP(half, __nv_fp8_e4m3, int);
+#ifdef ENABLE_BF16
+INSTANTIATE_LOOK_UP(__nv_bfloat16, __nv_fp8_e4m3, int);
+#endif
+#endif
+
 } // namespace kernels
 } // namespace tensorrt_llm
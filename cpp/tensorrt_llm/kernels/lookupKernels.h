@@ -19,6 +19,9 @@
 #include "tensorrt_llm/common/cudaUtils.h"
 #include <assert.h>
 #include <cuda_fp16.h>
+#ifdef ENABLE_FP8
+#include <cuda_fp8.h>
+#endif
 #include <cuda_runtime.h>
 
 namespace tensorrt_llm
@@ -29,5 +32,15 @@ template <typename Tout, typename Tin, typename Idx>
 void invokeLookUp(Tout* out, Idx const* input, Tin const* weight, int64_t const token_num, Idx const offset,
     Idx const size, Idx const n_embed, Tout const* perTokenScales, cudaStream_t stream = 0);
 
+//! Fused lookup for prompt-tuned batches. Ids below vocabSize are gathered from the model embedding table
+//! (dequantized inline via perTokenScales when the table is quantized); ids at or above vocabSize are virtual
+//! tokens and are gathered from promptWeight at row tasks[token] + (id - vocabSize), where tasks already holds
+//! the per-token task row offset (task id * task vocab size). A null promptWeight writes zeros for virtual
+//! tokens so that ranks without the prompt table contribute nothing to the ensuing all-reduce.
+template <typename Tout, typename Tin, typename Idx>
+void invokeFusedLookUp(Tout* out, Idx const* input, Tin const* weight, Tout const* promptWeight, Idx const* tasks,
+    int64_t const token_num, Idx const offset, Idx const size, Idx const vocabSize, Idx const n_embed,
+    Tout const* perTokenScales, cudaStream_t stream = 0);
+
 } // namespace kernels
 } // namespace tensorrt_llm
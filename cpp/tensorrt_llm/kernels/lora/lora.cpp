@@ -249,6 +249,7 @@ int LoraImpl::run(int64_t numTokens, int64_t numReqs, void const* input, int32_t
         ptrD_2.reserve(numTokens * mNumLoraModules);
 
         int minKN = mInHiddenSize; // Used to determine the alignment size
+        int maxKN = 0;             // Largest rank in the batch; used to pick the tile size
         for (int loraModuleIdx = 0; loraModuleIdx < mNumLoraModules; loraModuleIdx++)
         {
             auto const* loraWeightsPtrModule
@@ -282,6 +283,7 @@ int LoraImpl::run(int64_t numTokens, int64_t numReqs, void const* input, int32_t
                     auto const K = mInHiddenSize;
                     minKN = std::min(minKN, N);
                     minKN = std::min(minKN, K);
+                    maxKN = std::max(maxKN, N);
 
                     cutlass::gemm::GemmCoord problem(M, N, K);
                     problem_sizes.push_back(problem);
@@ -317,15 +319,72 @@ int LoraImpl::run(int64_t numTokens, int64_t numReqs, void const* input, int32_t
             TLLM_CHECK_WITH_INFO(mTransA == false && mTransB == true,
                 "Invalid transA (%d) transB (%d). transA must be false, transB must be true", int(mTransA),
                 int(mTransB));
-            // For the first GEMM, K is the "hidden size" and N is the "lora rank". So, K is often much larger than N.
-            // To improve the GPU utilization, we use splitK to handle the K dimension in multiple blocks in parallel.
-            splitkGroupedGemm(problem_sizes, ptrA, ptrB, ptrC, ptrD, groupGemmParamsWorkSpace,
-                groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, true, mType, mSplitKSlices, minKN,
-                stream);
-            sync_check_cuda_error(stream);
-            groupedGemm(problem_sizes_2, ptrA_2, ptrB_2, ptrC_2, ptrD_2, groupGemmParamsWorkSpace,
-                groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, false, mType, minKN, stream);
-            sync_check_cuda_error(stream);
+            // A batch mixing small and large adapter ranks used to run every group at the tile size of the
+            // largest rank. Partition the groups at the 16-wide tile boundary and launch each bucket with a
+            // tile shape matched to its rank range, so small-rank groups run at their native cost.
+            constexpr int kSmallRankTileBoundary = 16;
+            bool const splitByRank = minKN >= 8 && maxKN > kSmallRankTileBoundary
+                && std::any_of(problem_sizes.begin(), problem_sizes.end(),
+                    [](cutlass::gemm::GemmCoord const& problem) { return problem.n() <= kSmallRankTileBoundary; });
+            if (!splitByRank)
+            {
+                // For the first GEMM, K is the "hidden size" and N is the "lora rank". So, K is often much larger
+                // than N. To improve the GPU utilization, we use splitK to handle the K dimension in multiple
+                // blocks in parallel.
+                splitkGroupedGemm(problem_sizes, ptrA, ptrB, ptrC, ptrD, groupGemmParamsWorkSpace,
+                    groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, true, mType, mSplitKSlices, minKN,
+                    maxKN, stream);
+                sync_check_cuda_error(stream);
+                groupedGemm(problem_sizes_2, ptrA_2, ptrB_2, ptrC_2, ptrD_2, groupGemmParamsWorkSpace,
+                    groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, false, mType, minKN, maxKN,
+                    stream);
+                sync_check_cuda_error(stream);
+            }
+            else
+            {
+                for (int bucketIdx = 0; bucketIdx < 2; bucketIdx++)
+                {
+                    bool const smallRankBucket = bucketIdx == 0;
+                    std::vector<size_t> indices;
+                    for (size_t i = 0; i < problem_sizes.size(); i++)
+                    {
+                        if ((problem_sizes[i].n() <= kSmallRankTileBoundary) == smallRankBucket)
+                        {
+                            indices.push_back(i);
+                        }
+                    }
+                    if (indices.empty())
+                    {
+                        continue;
+                    }
+                    auto gather = [&indices](auto const& src)
+                    {
+                        std::decay_t<decltype(src)> dst;
+                        dst.reserve(indices.size());
+                        for (auto idx : indices)
+                        {
+                            dst.push_back(src[idx]);
+                        }
+                        return dst;
+                    };
+                    auto bucketProblems = gather(problem_sizes);
+                    int bucketMinKN = mInHiddenSize;
+                    int bucketMaxKN = 0;
+                    for (auto const& problem : bucketProblems)
+                    {
+                        bucketMinKN = std::min(bucketMinKN, problem.n());
+                        bucketMaxKN = std::max(bucketMaxKN, problem.n());
+                    }
+                    splitkGroupedGemm(bucketProblems, gather(ptrA), gather(ptrB), gather(ptrC), gather(ptrD),
+                        groupGemmParamsWorkSpace, groupGemmParamsWorkSpaceSize, gemmWorkSpace, GemmWorkSpaceSize, true,
+                        mType, mSplitKSlices, bucketMinKN, bucketMaxKN, stream);
+                    sync_check_cuda_error(stream);
+                    groupedGemm(gather(problem_sizes_2), gather(ptrA_2), gather(ptrB_2), gather(ptrC_2),
+                        gather(ptrD_2), groupGemmParamsWorkSpace, groupGemmParamsWorkSpaceSize, gemmWorkSpace,
+                        GemmWorkSpaceSize, false, mType, bucketMinKN, bucketMaxKN, stream);
+                    sync_check_cuda_error(stream);
+                }
+            }
         }
     }
 
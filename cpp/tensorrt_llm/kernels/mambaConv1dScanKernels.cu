@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime_api.h>
+
+#include <cuda_bf16.h>
+#include <cuda_fp16.h>
+
+#include "mambaConv1dScanKernels.h"
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+
+namespace
+{
+
+__device__ static inline float toFloatValue(float f)
+{
+    return f;
+}
+
+__device__ static inline float toFloatValue(__half h)
+{
+    return __half2float(h);
+}
+
+__device__ static inline float toFloatValue(__nv_bfloat16 val)
+{
+    return __bfloat162float(val);
+}
+
+//! Single-token causal conv1d for one channel: consumes the (kWidth - 1)-deep conv state plus the
+//! new activation, optionally shifts the state in-place, and returns silu(conv) like the context
+//! conv does for the whole xBC slice.
+template <typename input_t, int kWidth>
+__device__ static inline float convChannelUpdate(input_t const* xbcRow, input_t const* weight, input_t const* bias,
+    input_t* convState, int channel, bool writeState)
+{
+    input_t* stateRow = convState + channel * (kWidth - 1);
+    float vals[kWidth];
+#pragma unroll
+    for (int i = 0; i < kWidth - 1; ++i)
+    {
+        vals[i] = toFloatValue(stateRow[i]);
+    }
+    vals[kWidth - 1] = toFloatValue(xbcRow[channel]);
+    if (writeState)
+    {
+#pragma unroll
+        for (int i = 0; i < kWidth - 1; ++i)
+        {
+            stateRow[i] = input_t(vals[i + 1]);
+        }
+    }
+
+    float out = bias == nullptr ? 0.f : toFloatValue(bias[channel]);
+#pragma unroll
+    for (int i = 0; i < kWidth; ++i)
+    {
+        out += toFloatValue(weight[channel * kWidth + i]) * vals[i];
+    }
+    return out / (1.f + __expf(-out));
+}
+
+} // namespace
+
+template <typename input_t, typename state_t, int kWidth, int kNThreads = 128>
+__launch_bounds__(kNThreads) __global__ void mamba_conv1d_scan_update_kernel(MambaConv1dScanParamsBase params)
+{
+    int const dim = params.nheads * params.head_dim;
+    int const dstate = params.dstate;
+    int const groupWidth = dim / params.ngroups;
+    int const convDim = dim + 2 * params.ngroups * dstate;
+    int const group = blockIdx.x;
+    int const sample = blockIdx.y;
+
+    int const slot = params.state_slot_mapping_ptr == nullptr ? sample : params.state_slot_mapping_ptr[sample];
+    if (slot == params.pad_slot_id)
+    {
+        return;
+    }
+
+    extern __shared__ float sh_bc[]; // [2 * dstate], convolved B then C of this block's group
+
+    input_t const* xbcRow = reinterpret_cast<input_t const*>(params.xbc_ptr) + sample * params.xbc_row_stride;
+    input_t const* zRow = reinterpret_cast<input_t const*>(params.z_ptr) + sample * params.z_row_stride;
+    input_t const* dtRow = reinterpret_cast<input_t const*>(params.dt_ptr) + sample * params.dt_row_stride;
+    input_t const* weight = reinterpret_cast<input_t const*>(params.conv_weight_ptr);
+    input_t const* bias = reinterpret_cast<input_t const*>(params.conv_bias_ptr);
+    float const* A = reinterpret_cast<float const*>(params.A_ptr);
+    float const* dtBias = reinterpret_cast<float const*>(params.dt_bias_ptr);
+    float const* D = reinterpret_cast<float const*>(params.D_ptr);
+    input_t* convState
+        = reinterpret_cast<input_t*>(params.conv_state_ptr) + static_cast<size_t>(slot) * convDim * (kWidth - 1);
+    state_t* ssmState = reinterpret_cast<state_t*>(params.ssm_state_ptr);
+    input_t* outRow = reinterpret_cast<input_t*>(params.out_ptr) + sample * params.out_row_stride;
+
+    // Convolve this group's B and C channels into shared memory. The block owns these channels
+    // exclusively, so their conv state is shifted here as well.
+    int const bBase = dim + group * dstate;
+    int const cBase = dim + (params.ngroups + group) * dstate;
+    for (int i = threadIdx.x; i < 2 * dstate; i += kNThreads)
+    {
+        int const bcChannel = i < dstate ? bBase + i : cBase + (i - dstate);
+        sh_bc[i] = convChannelUpdate<input_t, kWidth>(xbcRow, weight, bias, convState, bcChannel, true);
+    }
+    __syncthreads();
+
+    // Sweep the group's x channels: the convolved activation stays in a register and goes straight
+    // into the state update instead of round-tripping through global memory.
+    for (int channel = group * groupWidth + threadIdx.x; channel < (group + 1) * groupWidth; channel += kNThreads)
+    {
+        float const convX = convChannelUpdate<input_t, kWidth>(xbcRow, weight, bias, convState, channel, true);
+
+        int const head = channel / params.head_dim;
+        float dtVal = toFloatValue(dtRow[head]);
+        if (dtBias != nullptr)
+        {
+            dtVal += dtBias[head];
+        }
+        if (params.dt_softplus)
+        {
+            dtVal = dtVal <= 20.f ? __logf(1.f + __expf(dtVal)) : dtVal; // softplus
+        }
+        float const dA = __expf(A[head] * dtVal);
+        float const dtx = dtVal * convX;
+
+        state_t* myState = ssmState
+            + (static_cast<size_t>(slot) * params.nheads * params.head_dim
+                  + static_cast<size_t>(head) * params.head_dim + channel % params.head_dim)
+                * dstate;
+        float out = D == nullptr ? 0.f : D[head] * convX;
+#pragma unroll 4
+        for (int i = 0; i < dstate; ++i)
+        {
+            float const newState = toFloatValue(myState[i]) * dA + sh_bc[i] * dtx;
+            myState[i] = state_t(newState);
+            out += newState * sh_bc[dstate + i];
+        }
+
+        float const zVal = toFloatValue(zRow[channel]);
+        out *= zVal / (1.f + __expf(-zVal)); // silu gate
+        outRow[channel] = input_t(out);
+    }
+}
+
+template <typename input_t, typename state_t>
+void invokeMambaConv1dScanUpdate(MambaConv1dScanParamsBase& params, cudaStream_t stream)
+{
+    int constexpr threads = 128;
+    TLLM_CHECK_WITH_INFO(params.nheads % params.ngroups == 0, "nheads must be divisible by ngroups");
+
+    dim3 block(threads, 1);
+    dim3 grid(params.ngroups, params.batch);
+    size_t const smemSize = 2 * params.dstate * sizeof(float);
+
+    if (params.dconv == 2)
+    {
+        mamba_conv1d_scan_update_kernel<input_t, state_t, 2, threads><<<grid, block, smemSize, stream>>>(params);
+    }
+    else if (params.dconv == 3)
+    {
+        mamba_conv1d_scan_update_kernel<input_t, state_t, 3, threads><<<grid, block, smemSize, stream>>>(params);
+    }
+    else if (params.dconv == 4)
+    {
+        mamba_conv1d_scan_update_kernel<input_t, state_t, 4, threads><<<grid, block, smemSize, stream>>>(params);
+    }
+    else
+    {
+        TLLM_CHECK_WITH_INFO(false, "unsupported conv width %d", params.dconv);
+    }
+    TLLM_CUDA_KERNEL_LAUNCH_CHECK();
+}
+
+#define INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(input_t, state_t)                                                      \
+    template void invokeMambaConv1dScanUpdate<input_t, state_t>(MambaConv1dScanParamsBase & params, cudaStream_t stream)
+
+INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(float, float);
+INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(half, half);
+INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(half, float);
+#ifdef ENABLE_BF16
+INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(__nv_bfloat16, __nv_bfloat16);
+INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE(__nv_bfloat16, float);
+#endif
+#undef INSTANTIATE_MAMBA_CONV1D_SCAN_DATA_TYPE
+
+} // namespace kernels
+} // namespace tensorrt_llm
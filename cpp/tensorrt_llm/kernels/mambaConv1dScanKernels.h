@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+
+namespace tensorrt_llm
+{
+namespace kernels
+{
+
+//! Parameters of the fused conv1d + selective-scan decode step. The z, xBC and dt pointers are
+//! slices of the in_proj output sharing one storage, hence the per-slice row strides (in elements).
+struct MambaConv1dScanParamsBase
+{
+    int batch, nheads, head_dim, dstate, ngroups, dconv;
+    int pad_slot_id;
+    bool dt_softplus;
+
+    int z_row_stride, xbc_row_stride, dt_row_stride, out_row_stride;
+
+    void const* __restrict__ z_ptr;
+    void const* __restrict__ xbc_ptr;
+    void const* __restrict__ dt_ptr;
+    void const* __restrict__ conv_weight_ptr;
+    void const* __restrict__ conv_bias_ptr;
+    void const* __restrict__ A_ptr;
+    void const* __restrict__ dt_bias_ptr;
+    void const* __restrict__ D_ptr;
+    void* conv_state_ptr;
+    void* ssm_state_ptr;
+    void* __restrict__ out_ptr;
+    int const* __restrict__ state_slot_mapping_ptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//! \brief Fused Mamba2 decode step for a single token per sequence: applies the causal conv1d to
+//! the xBC channels and feeds the result straight into the selective-scan state update without
+//! materializing the convolved activations in global memory. One thread block handles one
+//! (sequence, B/C group) pair so the group's convolved B and C live in shared memory and both the
+//! conv state and the [slot, nheads, head_dim, dstate] SSM state are updated in-place exactly once.
+template <typename input_t, typename state_t>
+void invokeMambaConv1dScanUpdate(MambaConv1dScanParamsBase& params, cudaStream_t stream);
+
+} // namespace kernels
+} // namespace tensorrt_llm
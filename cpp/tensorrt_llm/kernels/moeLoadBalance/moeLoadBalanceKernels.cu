@@ -235,35 +235,50 @@ __global__ void updateLoadFactorKernel(MoeLoadBalanceMetaInfo metaInfo, MoeLoadB
     loadFactor[expertIdx] = loadFactor[expertIdx] * statisticInfo.decayFactor + expertTokenCount;
 }
 
+void moeStatisticShiftWindowDevice(
+    MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatisticInfo statisticInfo, int* const enabled, cudaStream_t stream)
+{
+    // shift window and zero expertTokenCount
+    // only first stage need shift window.
+    int threadCount = metaInfo.expertCount;
+    auto* kernelFunc = shiftWindowKernel<int>;
+    if (threadCount % 4 == 0)
+    {
+        threadCount /= 4;
+        kernelFunc = shiftWindowKernel<int4>;
+    }
+    else if (threadCount % 2 == 0)
+    {
+        threadCount /= 2;
+        kernelFunc = shiftWindowKernel<int2>;
+    }
+    dim3 gridDim(statisticInfo.rawDataWindowSize + 1);
+    dim3 blockDim(threadCount);
+    int* expertTokenCount = statisticInfo.expertTokenCount;
+    void* args[] = {&metaInfo, static_cast<void*>(const_cast<int**>(&enabled)), static_cast<void*>(&expertTokenCount)};
+    TLLM_CHECK_WITH_INFO(
+        threadCount <= 1024, "expertCount=%d is too large and not supported now.", metaInfo.expertCount);
+    // TODO: add PDL support with cooperative launch
+    TLLM_CUDA_CHECK(cudaLaunchCooperativeKernel(kernelFunc, gridDim, blockDim, &args[0], 0, stream));
+}
+
+void moeStatisticUpdateLoadFactorDevice(
+    MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatisticInfo statisticInfo, int* const enabled, cudaStream_t stream)
+{
+    // only last stage need update load factor.
+    int threadCount = 128;
+    int blockCount = (metaInfo.expertCount + threadCount - 1) / threadCount;
+    launchWithPdlWhenEnabled("updateLoadFactor", updateLoadFactorKernel, blockCount, threadCount, 0, stream, metaInfo,
+        statisticInfo, statisticInfo.expertTokenCount, enabled);
+}
+
 void moeStatisticDevice(MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatisticInfo statisticInfo, int numTotalTokens,
     int* const enabled, bool isFirstStage, bool isLastStage, int* const gatheredRawExpertIds, cudaStream_t stream)
 {
     static int const smCount = tensorrt_llm::common::getMultiProcessorCount();
     if (isFirstStage)
     {
-        // shift window and zero expertTokenCount
-        // only first stage need shift window.
-        int threadCount = metaInfo.expertCount;
-        auto* kernelFunc = shiftWindowKernel<int>;
-        if (threadCount % 4 == 0)
-        {
-            threadCount /= 4;
-            kernelFunc = shiftWindowKernel<int4>;
-        }
-        else if (threadCount % 2 == 0)
-        {
-            threadCount /= 2;
-            kernelFunc = shiftWindowKernel<int2>;
-        }
-        dim3 gridDim(statisticInfo.rawDataWindowSize + 1);
-        dim3 blockDim(threadCount);
-        int* expertTokenCount = statisticInfo.expertTokenCount;
-        void* args[]
-            = {&metaInfo, static_cast<void*>(const_cast<int**>(&enabled)), static_cast<void*>(&expertTokenCount)};
-        TLLM_CHECK_WITH_INFO(
-            threadCount <= 1024, "expertCount=%d is too large and not supported now.", metaInfo.expertCount);
-        // TODO: add PDL support with cooperative launch
-        TLLM_CUDA_CHECK(cudaLaunchCooperativeKernel(kernelFunc, gridDim, blockDim, &args[0], 0, stream));
+        moeStatisticShiftWindowDevice(metaInfo, statisticInfo, enabled, stream);
     }
 
     {
@@ -282,11 +297,7 @@ void moeStatisticDevice(MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatistic
 
     if (isLastStage)
     {
-        // only last stage need update load factor.
-        int threadCount = 128;
-        int blockCount = (metaInfo.expertCount + threadCount - 1) / threadCount;
-        launchWithPdlWhenEnabled("updateLoadFactor", updateLoadFactorKernel, blockCount, threadCount, 0, stream,
-            metaInfo, statisticInfo, statisticInfo.expertTokenCount, enabled);
+        moeStatisticUpdateLoadFactorDevice(metaInfo, statisticInfo, enabled, stream);
     }
 }
 
@@ -56,6 +56,30 @@ void moeSetSignalForCpuStageDevice(MoeLoadBalanceSingleLayerSignal* signal, cuda
 // @param signal: the signal
 void moeSetSignalForCpuStageForTest(MoeLoadBalanceSingleLayerSignal* signal);
 
+// @brief shift the raw data window and zero the current slot of expertTokenCount
+//
+// This function is used to launch a kernel to shift the raw data window at the first stage of an
+// iteration. It is called by moeStatisticDevice, and exposed separately for paths that accumulate
+// the statistic inside another kernel (e.g. the fused routing epilogue) and thus skip the
+// standalone statistic kernel.
+//
+// @param metaInfo: the meta info
+// @param statisticInfo: the statistic info
+// @param enabled: flag on device memory to indicate if the statistic is enabled
+void moeStatisticShiftWindowDevice(MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatisticInfo statisticInfo,
+    int* const enabled, cudaStream_t stream);
+
+// @brief update expertLoadFactor from the current expertTokenCount with decay
+//
+// This function is used to launch a kernel to fold the accumulated expertTokenCount into
+// expertLoadFactor at the last stage of an iteration, counterpart of moeStatisticShiftWindowDevice.
+//
+// @param metaInfo: the meta info
+// @param statisticInfo: the statistic info
+// @param enabled: flag on device memory to indicate if the statistic is enabled
+void moeStatisticUpdateLoadFactorDevice(MoeLoadBalanceMetaInfo metaInfo, MoeLoadBalanceStatisticInfo statisticInfo,
+    int* const enabled, cudaStream_t stream);
+
 // @brief do the statistic
 //
 // This function is used to launch a kernel to do the statistic.
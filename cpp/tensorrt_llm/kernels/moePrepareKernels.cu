@@ -255,6 +255,66 @@ __global__ void moveIndiceDevice(int* sendCountsCumsum, int* recvCountsCumsum, i
     }
 }
 
+__global__ void cumsumAndMoveIndiceDevice(int* sendCounts, int* recvCounts, int* sendCountsCumsum,
+    int* recvCountsCumsum, int* sendIndice, int* gatherSendIndice, int* backwardIndice, int* gatherBackwardIndice,
+    int* recvIndice, int* gatherRecvIndice, int maxTokenCountPerRank, int rankCount)
+{
+    // Fused cumsum + gather: every CTA recomputes the full prefix sum of the counts it needs locally, so
+    // the index gather can start in the very next launch after the device-side counts exchange instead of
+    // waiting for a separate cumsum kernel. The counts and cumsum buffers must be distinct since CTAs read
+    // the counts concurrently with the designated CTA publishing the cumsum.
+    int targetRankId = blockIdx.x;
+    bool isSendSide = blockIdx.y == 0;
+    int* countsPtr = isSendSide ? sendCounts : recvCounts;
+    int* cumsumPtr = isSendSide ? sendCountsCumsum : recvCountsCumsum;
+
+    typedef cub::BlockScan<int, CUMSUM_MOVE_THREADS_PER_BLOCK> BlockScan;
+    __shared__ typename BlockScan::TempStorage temp_storage;
+    __shared__ int sharedStartEnd[2];
+
+#if (defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900))
+    cudaGridDependencySynchronize();
+    cudaTriggerProgrammaticLaunchCompletion();
+#endif
+
+    int tid = threadIdx.x;
+    int count = tid < rankCount ? countsPtr[tid] : 0;
+    int inclusiveSum;
+    __syncthreads();
+
+    BlockScan(temp_storage).InclusiveSum(count, inclusiveSum);
+    if (targetRankId == 0 && tid < rankCount)
+    {
+        cumsumPtr[tid] = inclusiveSum;
+    }
+    if (tid == targetRankId)
+    {
+        sharedStartEnd[0] = inclusiveSum - count;
+        sharedStartEnd[1] = inclusiveSum;
+    }
+    __syncthreads();
+
+    int startIndex = sharedStartEnd[0];
+    int localCount = sharedStartEnd[1] - startIndex;
+    if (isSendSide)
+    {
+        int* localSendIndice = sendIndice + targetRankId * maxTokenCountPerRank;
+        int* localBackwardIndice = backwardIndice + targetRankId * maxTokenCountPerRank;
+        for (int localIdx = tid; localIdx < localCount; localIdx += blockDim.x)
+        {
+            gatherSendIndice[startIndex + localIdx] = localSendIndice[localIdx];
+            gatherBackwardIndice[startIndex + localIdx] = localBackwardIndice[localIdx];
+        }
+    }
+    else
+    {
+        for (int localIdx = tid; localIdx < localCount; localIdx += blockDim.x)
+        {
+            gatherRecvIndice[startIndex + localIdx] = startIndex + localIdx;
+        }
+    }
+}
+
 __global__ void computeCumsumDevice(int* sendCountsCumsum, int* recvCountsCumsum, int rankId, int rankCount)
 {
     int* inputOutputPtr = blockIdx.x == 0 ? sendCountsCumsum : recvCountsCumsum;
@@ -355,6 +415,20 @@ void moveIndice(int* sendCountsCumsum, int* recvCountsCumsum, int* sendIndice, i
         maxTokenCountPerRank);
 }
 
+void cumsumAndMoveIndice(int* sendCounts, int* recvCounts, int* sendCountsCumsum, int* recvCountsCumsum,
+    int* sendIndice, int* gatherSendIndice, int* backwardIndice, int* gatherBackwardIndice, int* recvIndice,
+    int* gatherRecvIndice, int rankId, int rankCount, int maxTokenCountPerRank, cudaStream_t stream)
+{
+    TLLM_CHECK_WITH_INFO(
+        rankCount <= CUMSUM_MOVE_THREADS_PER_BLOCK, "rankCount %d exceeds the fused cumsum block size", rankCount);
+    dim3 block(CUMSUM_MOVE_THREADS_PER_BLOCK);
+    dim3 grid(rankCount, 2);
+
+    launchWithPdlWhenEnabled("cumsumAndMoveIndice", cumsumAndMoveIndiceDevice, grid, block, 0, stream, sendCounts,
+        recvCounts, sendCountsCumsum, recvCountsCumsum, sendIndice, gatherSendIndice, backwardIndice,
+        gatherBackwardIndice, recvIndice, gatherRecvIndice, maxTokenCountPerRank, rankCount);
+}
+
 void memsetExpertIds(int* expertIds, int* recvCountsCumsum, int maxTokenCountPerRank, int topK, int slotCount,
     int rankCount, cudaStream_t stream)
 {
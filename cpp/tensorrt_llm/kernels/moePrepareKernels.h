@@ -32,6 +32,7 @@ namespace moe_prepare
 #define UNIT_PER_PIPELINE 128
 #define PIPELINE_PER_CTA 4
 #define CUMSUM_THREADS_PER_BLOCK 128
+#define CUMSUM_MOVE_THREADS_PER_BLOCK 512
 
 static constexpr int THREADS_PER_PIPELINE = UNIT_PER_PIPELINE;
 
@@ -80,6 +81,12 @@ void moveIndice(int* sendCountsCumsum, int* recvCountsCumsum, int* sendIndice, i
     int* backwardIndice, int* gatherBackwardIndice, int* recvIndice, int* gatherRecvIndice, int rankId, int rankCount,
     int maxTokenCountPerRank, cudaStream_t stream);
 
+// Fused computeCumsum + moveIndice. Reads the raw per-rank counts (sendCounts/recvCounts) and writes the
+// cumsums into separate buffers so the gather can run in the same launch as the prefix sum.
+void cumsumAndMoveIndice(int* sendCounts, int* recvCounts, int* sendCountsCumsum, int* recvCountsCumsum,
+    int* sendIndice, int* gatherSendIndice, int* backwardIndice, int* gatherBackwardIndice, int* recvIndice,
+    int* gatherRecvIndice, int rankId, int rankCount, int maxTokenCountPerRank, cudaStream_t stream);
+
 void memsetExpertIds(int* expertIds, int* recvCountsCumsum, int maxTokenCountPerRank, int topK, int slotCount,
     int epSize, cudaStream_t stream);
 
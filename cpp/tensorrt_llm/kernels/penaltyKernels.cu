@@ -222,6 +222,191 @@ __global__ void batchApplyPenalty(T const* const* inputLogits, T* outputLogits,
     }
 }
 
+template <typename T>
+__global__ void batchApplyPenaltyDelta(T const* const* inputLogits, T* outputLogits, T const* biases,
+    TokenIdType* penaltyWorkspace, TokenIdType* seenTokens, SizeType32* seenTokensLens, float const* temperatures,
+    float const* repetitionPenalties, float const* presencePenalties, float const* frequencyPenalties,
+    SizeType32 vocabSize, SizeType32 vocabSizePadded, TokenIdType const** outputIdsPtr, SizeType32 const* inputLengths,
+    SizeType32 const* sequenceLengths, SizeType32 const* minLengths, TokenIdType const* endIds,
+    SizeType32 const* batchSlots, FinishedState const* finished)
+{
+    auto const batchIdx = static_cast<SizeType32>(blockIdx.x);
+    auto const batchSlot = batchSlots[batchIdx];
+
+    FinishedState const finishState = finished != nullptr ? finished[batchSlot] : FinishedState::empty();
+    if (finishState.isSkipDecoding())
+    {
+        return;
+    }
+
+    auto const inputLen = inputLengths == nullptr ? SizeType32{0} : inputLengths[batchSlot];
+    auto const currentStep = sequenceLengths == nullptr ? SizeType32{0} : sequenceLengths[batchSlot];
+    T const* biasBase = biases + batchSlot * vocabSizePadded;
+
+    float invTemperature{layers::DefaultDecodingParams::getTemperature()};
+    float repetitionPenalty{layers::DefaultDecodingParams::getRepetitionPenalty()};
+    float presencePenalty{layers::DefaultDecodingParams::getPresencePenalty()};
+    float frequencyPenalty{layers::DefaultDecodingParams::getFrequencyPenalty()};
+    SizeType32 minLength{layers::DefaultDecodingParams::getMinLength()};
+    bool accumulateVocab{false};
+    bool hasTemperature{false};
+    bool hasMinLength{false};
+    if (temperatures != nullptr)
+    {
+        float temperature = temperatures[batchSlot];
+        invTemperature = 1.0f / (temperature + 1e-6f);
+        hasTemperature |= (!almostEqual(temperature, layers::DefaultDecodingParams::getTemperature(), 1e-9));
+    }
+    if (repetitionPenalties != nullptr)
+    {
+        repetitionPenalty = repetitionPenalties[batchSlot];
+        accumulateVocab
+            |= (!almostEqual(repetitionPenalty, layers::DefaultDecodingParams::getRepetitionPenalty(), 1e-9));
+    }
+    if (presencePenalties != nullptr)
+    {
+        presencePenalty = presencePenalties[batchSlot];
+        accumulateVocab |= (!almostEqual(presencePenalty, layers::DefaultDecodingParams::getPresencePenalty(), 1e-9));
+    }
+    if (frequencyPenalties != nullptr)
+    {
+        frequencyPenalty = frequencyPenalties[batchSlot];
+        accumulateVocab |= (!almostEqual(frequencyPenalty, layers::DefaultDecodingParams::getFrequencyPenalty(), 1e-9));
+    }
+    if (minLengths != nullptr)
+    {
+        minLength = minLengths[batchSlot];
+        hasMinLength |= (minLength > 0);
+    }
+
+    // Update the occurrence counts and the compact list of distinct seen tokens; both persist per slot
+    auto* counts = penaltyWorkspace + batchSlot * vocabSize;
+    auto* seen = seenTokens + batchSlot * vocabSize;
+    auto* seenLen = seenTokensLens + batchSlot;
+    if (accumulateVocab)
+    {
+        if (currentStep <= inputLen)
+        { // Context phase
+            if (threadIdx.x == 0)
+            {
+                *seenLen = 0;
+            }
+            for (auto index = static_cast<SizeType32>(threadIdx.x); index < vocabSize;
+                 index += static_cast<SizeType32>(blockDim.x))
+            {
+                counts[index] = 0;
+            }
+            __syncthreads();
+            for (auto step = static_cast<SizeType32>(threadIdx.x); step < inputLen;
+                 step += static_cast<SizeType32>(blockDim.x))
+            {
+                auto tokenId = outputIdsPtr[batchSlot][step];
+                if (tokenId < vocabSize && atomicAdd(&counts[tokenId], 1) == 0)
+                {
+                    seen[atomicAdd(seenLen, 1)] = tokenId;
+                }
+            }
+        }
+        else
+        { // Generation phase, only the last decoded token can enter the set
+            if (threadIdx.x == 0)
+            {
+                auto tokenId = outputIdsPtr[batchSlot][currentStep - 1];
+                if (tokenId < vocabSize && atomicAdd(&counts[tokenId], 1) == 0)
+                {
+                    seen[*seenLen] = tokenId;
+                    *seenLen += 1;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    // Apply bias and temperature to the full vocabulary
+    auto const inLogitsPtr = inputLogits[batchIdx];
+    auto outLogitsPtr = outputLogits + batchIdx * vocabSizePadded;
+    T const MASK_VAL = (std::is_same<T, half>::value) ? -HALF_FLT_MAX : -FLT_MAX;
+    for (auto index = static_cast<SizeType32>(threadIdx.x); index < vocabSizePadded;
+         index += static_cast<SizeType32>(blockDim.x))
+    {
+        if (index < vocabSize)
+        {
+            auto logit = static_cast<float>(inLogitsPtr[index]);
+            // Bias
+            if (biases != nullptr)
+            {
+                logit += static_cast<float>(biasBase[index]);
+            }
+            // Temperature
+            if (hasTemperature)
+            {
+                logit *= invTemperature;
+            }
+            // do clamp to prevent overflow
+            if (logit > static_cast<float>(-MASK_VAL))
+            {
+                logit = static_cast<float>(-MASK_VAL);
+            }
+            else if (logit < static_cast<float>(MASK_VAL))
+            {
+                logit = static_cast<float>(MASK_VAL);
+            }
+            outLogitsPtr[index] = logit;
+        }
+        else
+        {
+            outLogitsPtr[index] = MASK_VAL;
+        }
+    }
+
+    // Apply the occurrence penalties only to the seen vocab entries
+    if (accumulateVocab)
+    {
+        __syncthreads();
+        auto const numSeen = *seenLen;
+        for (auto i = static_cast<SizeType32>(threadIdx.x); i < numSeen; i += static_cast<SizeType32>(blockDim.x))
+        {
+            auto const tokenId = seen[i];
+            auto logit = static_cast<float>(outLogitsPtr[tokenId]);
+            // Repetition
+            if (repetitionPenalties != nullptr)
+            {
+                logit = logit < 0.0f ? logit * repetitionPenalty : logit / repetitionPenalty;
+            }
+            // Presence
+            if (presencePenalties != nullptr)
+            {
+                logit -= presencePenalty;
+            }
+            // Frequency
+            if (frequencyPenalties != nullptr)
+            {
+                logit -= frequencyPenalty * counts[tokenId];
+            }
+            if (logit > static_cast<float>(-MASK_VAL))
+            {
+                logit = static_cast<float>(-MASK_VAL);
+            }
+            else if (logit < static_cast<float>(MASK_VAL))
+            {
+                logit = static_cast<float>(MASK_VAL);
+            }
+            outLogitsPtr[tokenId] = logit;
+        }
+    }
+
+    if (hasMinLength)
+    {
+        __syncthreads();
+        // If current generation length is too short, make sure EOS doesn't have high probability.
+        // This check is not needed when endId is already -1 as generation won't stop on EOS anyway.
+        if ((threadIdx.x == 0) && (currentStep - inputLen < minLength) && endIds[batchSlot] > -1)
+        {
+            outLogitsPtr[endIds[batchSlot]] = MASK_VAL;
+        }
+    }
+}
+
 template <typename T>
 void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<T> const& params)
 {
@@ -239,4 +424,23 @@ template void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<float> const
 
 template void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<half> const& params);
 
+template <typename T>
+void invokeBatchApplyPenaltyDelta(InvokeBatchApplyPenaltyParams<T> const& params)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    TLLM_CHECK_WITH_INFO(params.beamWidth == 1 && params.maxTokensPerStep == 1,
+        "Delta penalty kernel supports beam width 1 and a single decoded token per step only.");
+    dim3 block(512);
+    dim3 grid(params.batchSize);
+    batchApplyPenaltyDelta<T><<<grid, block, 0, params.stream>>>(params.inputLogits, params.outputLogits, params.biases,
+        params.penaltyWorkspace, params.seenTokens, params.seenTokensLens, params.temperatures,
+        params.repetitionPenalties, params.presencePenalties, params.frequencyPenalties, params.vocabSize,
+        params.vocabSizePadded, params.outputIdsPtr, params.inputLengths, params.sequenceLengths, params.minLengths,
+        params.endIds, params.batchSlots, params.finished);
+}
+
+template void invokeBatchApplyPenaltyDelta(InvokeBatchApplyPenaltyParams<float> const& params);
+
+template void invokeBatchApplyPenaltyDelta(InvokeBatchApplyPenaltyParams<half> const& params);
+
 } // namespace tensorrt_llm::kernels
@@ -50,10 +50,21 @@ struct InvokeBatchApplyPenaltyParams
     runtime::SizeType32 maxTokensPerStep;
     runtime::SizeType32 const* tokensPerStep;
     FinishedState const* finished;
+    //! Compact per-slot list of distinct seen tokens and its lengths, only used by the delta kernel
+    runtime::TokenIdType* seenTokens;
+    runtime::SizeType32* seenTokensLens;
     cudaStream_t stream;
 };
 
 template <typename T>
 void invokeBatchApplyPenalty(InvokeBatchApplyPenaltyParams<T> const& params);
 
+//! \brief Same as invokeBatchApplyPenalty, but maintains the set of seen tokens incrementally in
+//! params.seenTokens / params.seenTokensLens and applies the occurrence penalties only to those vocab
+//! entries instead of scanning the occurrence counts of the full vocabulary every step.
+//! Requires beamWidth == 1 and a single decoded token per step. The occurrence counts and the seen
+//! token lists are indexed by batch slot and persist across steps.
+template <typename T>
+void invokeBatchApplyPenaltyDelta(InvokeBatchApplyPenaltyParams<T> const& params);
+
 } // namespace tensorrt_llm::kernels
@@ -453,6 +453,180 @@ template void invokeBatchTopPSampling(TopPSamplingKernelParams<float> const& par
 
 template void invokeBatchTopPSampling(TopPSamplingKernelParams<half> const& params, cudaStream_t stream);
 
+namespace
+{
+SizeType32 constexpr FULL_DIST_SAMPLING_BLOCK_SIZE = 1024;
+SizeType32 constexpr FULL_DIST_SAMPLING_MAX_CHUNKS = 2048;
+} // namespace
+
+template <typename T, int blockSize>
+__global__ void fullDistSampling(T const* probs, TokenIdType* ids, TokenIdType** idsPtrs, SizeType32* sequenceLength,
+    FinishedState const* finishedInput, FinishedState* finishedOutput, float* cumLogProbs, float* outputLogProbs,
+    SizeType32 vocabSize, curandState_t* curandState, float const* randomVals, TokenIdType const* endIds,
+    SizeType32 maxBatchSize, bool const* skipDecode, SizeType32 const* batchSlots, SizeType32 maxSeqLen)
+{
+    /**
+     * Samples from the full (unsorted) distribution without radix sort. Each block processes one request row in two
+     * stages: the first stage accumulates a coarse histogram of per-chunk probability masses over vocab chunks of
+     * blockSize tokens, the second stage locates the chunk containing the random threshold via the histogram prefix
+     * and resolves the exact token with a single block-wide inclusive scan inside that chunk. This is equivalent to
+     * Top P sampling when P covers the whole distribution (P == 1.0) and avoids the sort cost that dominates the
+     * sorted Top P path for large vocabularies.
+     */
+
+    auto const tid = static_cast<SizeType32>(threadIdx.x);
+    auto const batchId = static_cast<SizeType32>(blockIdx.x);
+    auto const batchSlot = batchSlots[batchId];
+    // Skip kernel if this sampling method is not chosen
+    FinishedState const finishState = finishedInput != nullptr ? finishedInput[batchSlot] : FinishedState::empty();
+    if ((skipDecode != nullptr && skipDecode[batchSlot]) || (finishState.isSkipDecoding()))
+    {
+        return;
+    }
+
+    // Exit early if sequence has finished
+    if (finishState.isFinished())
+    {
+        if (tid == 0)
+        {
+            if (finishedOutput != nullptr)
+            {
+                finishedOutput[batchSlot] = finishState;
+            }
+        }
+        return;
+    }
+
+    auto const currentStep = sequenceLength == nullptr ? 0 : sequenceLength[batchSlot];
+    auto* outputIdsRequestPtr = idsPtrs == nullptr ? ids + batchSlot * maxSeqLen : idsPtrs[batchSlot];
+
+    auto const numChunks = (vocabSize + blockSize - 1) / blockSize;
+    auto const offset = batchId * vocabSize;
+
+    typedef cub::BlockReduce<float, blockSize> BlockReduce;
+    typedef cub::BlockScan<float, blockSize> BlockScan;
+    __shared__ union
+    {
+        typename BlockReduce::TempStorage reduce;
+        typename BlockScan::TempStorage scan;
+    } tempStorage;
+    __shared__ float chunkMass[FULL_DIST_SAMPLING_MAX_CHUNKS];
+    __shared__ SizeType32 selectedChunk;
+    __shared__ float chunkPrefix;
+    __shared__ float threshold;
+
+    // Stage 1: coarse histogram of probability mass per vocab chunk
+    for (SizeType32 chunk = 0; chunk < numChunks; ++chunk)
+    {
+        auto const vi = chunk * blockSize + tid;
+        auto const threadProb = (vi < vocabSize) ? static_cast<float>(probs[offset + vi]) : 0.f;
+        auto const mass = BlockReduce(tempStorage.reduce).Sum(threadProb);
+        if (tid == 0)
+        {
+            chunkMass[chunk] = mass;
+        }
+        // TempStorage is reused across iterations
+        __syncthreads();
+    }
+
+    // Thread 0 draws the threshold from the total mass (robust against the distribution not summing exactly to 1)
+    // and walks the histogram prefix to find the surviving chunk.
+    if (tid == 0)
+    {
+        float totalMass = 0.f;
+        for (SizeType32 chunk = 0; chunk < numChunks; ++chunk)
+        {
+            totalMass += chunkMass[chunk];
+        }
+        auto const randomNumber = randomVals ? randomVals[batchSlot] : curand_uniform(curandState + batchSlot);
+        threshold = randomNumber * totalMass;
+        float prefix = 0.f;
+        SizeType32 chunk = 0;
+        for (; chunk < numChunks - 1; ++chunk)
+        {
+            if (prefix + chunkMass[chunk] >= threshold)
+            {
+                break;
+            }
+            prefix += chunkMass[chunk];
+        }
+        selectedChunk = chunk;
+        chunkPrefix = prefix;
+    }
+    __syncthreads();
+
+    // Stage 2: exact scan over the surviving chunk. The chunk spans exactly blockSize tokens,
+    // so a single inclusive scan resolves the sampled token.
+    auto const vi = selectedChunk * blockSize + tid;
+    auto const threadProb = (vi < vocabSize) ? static_cast<float>(probs[offset + vi]) : 0.f;
+    float threadOffset = 0.f;
+    BlockScan(tempStorage.scan).InclusiveSum(threadProb, threadOffset);
+    auto const count = __syncthreads_count(threshold <= chunkPrefix + threadOffset);
+    if (tid == min(static_cast<SizeType32>(blockDim.x) - count, static_cast<SizeType32>(blockDim.x) - 1))
+    {
+        auto const selectedTokenId = min(vi, vocabSize - 1);
+        outputIdsRequestPtr[currentStep] = selectedTokenId;
+
+        if (cumLogProbs != nullptr || outputLogProbs != nullptr)
+        {
+            float const lprob = logf(static_cast<float>(probs[offset + selectedTokenId]));
+            if (cumLogProbs != nullptr)
+            {
+                cumLogProbs[batchSlot] += lprob;
+            }
+            if (outputLogProbs != nullptr)
+            {
+                outputLogProbs[sequenceLength[batchSlot] * maxBatchSize + batchSlot] = lprob;
+            }
+        }
+        if (finishedOutput != nullptr && endIds != nullptr)
+        {
+            if (selectedTokenId == endIds[batchSlot])
+            {
+                finishedOutput[batchSlot].setFinishedEOS();
+                // Do not increase seq len when EOS is generated. Seq len should always contain only tokens to be
+                // outputted
+            }
+            else
+            {
+                // We don't need to set output finished state as it is assumed to be in non finished state
+                sequenceLength[batchSlot] += 1;
+            }
+        }
+    }
+}
+
+bool fullDistTopPSamplingSupported(SizeType32 vocabSizePadded)
+{
+    return vocabSizePadded <= FULL_DIST_SAMPLING_BLOCK_SIZE * FULL_DIST_SAMPLING_MAX_CHUNKS;
+}
+
+template <typename T>
+void invokeBatchFullDistTopPSampling(TopPSamplingKernelParams<T> const& params, cudaStream_t stream)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    params.checkParams();
+    TLLM_CHECK_WITH_INFO(!params.returnAllSelectedTokens && params.returnAllSelectedTokensPerSlot == nullptr,
+        "Full distribution sampling does not support returning all selected tokens");
+    TLLM_CHECK_WITH_INFO(fullDistTopPSamplingSupported(params.vocabSizePadded),
+        "Full distribution sampling supports vocab sizes up to %d, got %d",
+        FULL_DIST_SAMPLING_BLOCK_SIZE * FULL_DIST_SAMPLING_MAX_CHUNKS, params.vocabSizePadded);
+
+    dim3 grid(params.batchSize);
+    fullDistSampling<T, FULL_DIST_SAMPLING_BLOCK_SIZE><<<grid, FULL_DIST_SAMPLING_BLOCK_SIZE, 0, stream>>>(
+        params.probs, params.outputIds, params.outputIdsPtrs, params.sequenceLength, params.finishedInput,
+        params.finishedOutput, params.cumLogProbs, params.outputLogProbs, params.vocabSizePadded, params.curandState,
+        params.randomVals, params.endIds, params.maxBatchSize, params.skipDecode, params.batchSlots, params.maxSeqLen);
+    sync_check_cuda_error(stream);
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
+template void invokeBatchFullDistTopPSampling(TopPSamplingKernelParams<float> const& params, cudaStream_t stream);
+
+template void invokeBatchFullDistTopPSampling(TopPSamplingKernelParams<half> const& params, cudaStream_t stream);
+
 __global__ void computeToppDecay(float* runtimeTopP, float const* runtimeInitialTopP, TokenIdType const** outputIds,
     float const* topPDecay, float const* topPMin, TokenIdType const* topPResetIds, SizeType32 const* sequenceLengths,
     SizeType32 const* batchSlots, SizeType32 localBatchSize)
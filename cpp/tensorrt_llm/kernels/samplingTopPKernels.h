@@ -137,6 +137,20 @@ template <typename T>
 template <typename T>
 void invokeBatchTopPSampling(TopPSamplingKernelParams<T> const& params, cudaStream_t stream);
 
+//! \brief Returns true if invokeBatchFullDistTopPSampling() supports the given padded vocab size.
+[[nodiscard]] bool fullDistTopPSamplingSupported(runtime::SizeType32 vocabSizePadded);
+
+// clang-format off
+//! \brief Given probs, samples from the full unsorted distribution via a coarse per-chunk histogram
+//! followed by an exact scan over the surviving chunk. Equivalent to Top P sampling with P == 1.0 but avoids
+//! the radix sort whose cost dominates invokeBatchTopPSampling() for large vocabularies. topPs and workspace
+//! are ignored. returnAllSelectedTokens is not supported.
+//! Fills sampled tokens to outputIds. Updates sequenceLength, finished state, cumLogProbs inplace.
+//! Sampling per request can be controlled using the skipDecode parameter.
+// clang-format on
+template <typename T>
+void invokeBatchFullDistTopPSampling(TopPSamplingKernelParams<T> const& params, cudaStream_t stream);
+
 //! \brief Compute the topp decay by https://arxiv.org/pdf/2206.04624.pdf
 //!        In short, the formula is
 //!          runtimeTopP = max(runtimeTopP * topPDecay, topPMin)
@@ -225,14 +225,22 @@ void splitkGroupedGemmType_(std::vector<cutlass::gemm::GemmCoord> const& problem
 void splitkGroupedGemm(std::vector<cutlass::gemm::GemmCoord> const& problemSizes, std::vector<void*> const& ptrA,
     std::vector<void*> const& ptrB, std::vector<void*> const& ptrC, std::vector<void*> const& ptrD,
     void* gemmParamsWorkSpace, int64_t gemmParamsWorkSpaceSize, void* gemmWorkSpace, int64_t gemmWorkSpaceSize,
-    bool isLoraIn, nvinfer1::DataType dataType, int splitKSlices, int minKN, cudaStream_t stream)
+    bool isLoraIn, nvinfer1::DataType dataType, int splitKSlices, int minKN, int maxKN, cudaStream_t stream)
 {
-    TLLM_LOG_TRACE("%s start, isLoraIn: %d, minKN = %d", __PRETTY_FUNCTION__, static_cast<int>(isLoraIn), minKN);
+    TLLM_LOG_TRACE("%s start, isLoraIn: %d, minKN = %d, maxKN = %d", __PRETTY_FUNCTION__, static_cast<int>(isLoraIn),
+        minKN, maxKN);
     if (isLoraIn)
     {
         // K >> N, like K = 1024, N = 8
         // Use larger K tile and smaller N tile
-        if (minKN >= 8)
+        if (minKN >= 8 && maxKN <= 16)
+        {
+            // Every rank in this launch fits a 16-wide N tile, so do not pad it to the 32-wide one.
+            splitkGroupedGemmType_<16, 16, 64, 16, 16, 64, 8, 8, 4>(problemSizes, ptrA, ptrB, ptrC, ptrD,
+                gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, dataType, splitKSlices,
+                stream);
+        }
+        else if (minKN >= 8)
         {
             splitkGroupedGemmType_<16, 32, 64, 16, 32, 64, 8, 8, 4>(problemSizes, ptrA, ptrB, ptrC, ptrD,
                 gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, dataType, splitKSlices,
@@ -261,7 +269,14 @@ void splitkGroupedGemm(std::vector<cutlass::gemm::GemmCoord> const& problemSizes
     {
         // N >> K, like K = 8, N = 1024
         // User larger N tile and smaller K tile
-        if (minKN >= 8)
+        if (minKN >= 8 && maxKN <= 16)
+        {
+            // Every rank in this launch fits a 16-deep K tile, so skip the 32-deep mainloop padding.
+            splitkGroupedGemmType_<32, 128, 16, 32, 32, 16, 8, 8, 4>(problemSizes, ptrA, ptrB, ptrC, ptrD,
+                gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, dataType, splitKSlices,
+                stream);
+        }
+        else if (minKN >= 8)
         {
             splitkGroupedGemmType_<32, 128, 32, 32, 32, 32, 8, 8, 4>(problemSizes, ptrA, ptrB, ptrC, ptrD,
                 gemmParamsWorkSpace, gemmParamsWorkSpaceSize, gemmWorkSpace, gemmWorkSpaceSize, dataType, splitKSlices,
@@ -27,6 +27,6 @@ int64_t getSplitkGroupedGemmParamsWorkSpaceSize(int64_t problem_count);
 void splitkGroupedGemm(std::vector<cutlass::gemm::GemmCoord> const& problem_sizes, std::vector<void*> const& ptrA,
     std::vector<void*> const& ptrB, std::vector<void*> const& ptrC, std::vector<void*> const& ptrD,
     void* gemmParamsWorkspace, int64_t gemmParamsWorkSpaceSize, void* gemmWorkSpace, int64_t gemmWorkspaceSize,
-    bool isLoraIn, nvinfer1::DataType dataType, int splitKSlices, int minKN, cudaStream_t stream);
+    bool isLoraIn, nvinfer1::DataType dataType, int splitKSlices, int minKN, int maxKN, cudaStream_t stream);
 
 } // namespace tensorrt_llm::kernels
@@ -194,6 +194,59 @@ void invokeLengthCriterion(FinishedState* finished, SizeType32* finishedSum, Siz
     sync_check_cuda_error(stream);
 }
 
+__global__ void lengthCriterionWithTokenCopy(FinishedState* finished, SizeType32* finishedSum,
+    SizeType32 const* sequenceLimitLength, SizeType32* sequenceLengths, SizeType32* numNewTokens,
+    TokenIdType* nextStepIds, TokenIdType const* const* outputIdsPtr, SizeType32 const* batchSlots,
+    SizeType32 batchSize)
+{
+    for (auto batchIdx = static_cast<SizeType32>(blockIdx.x * blockDim.x + threadIdx.x); batchIdx < batchSize;
+         batchIdx += static_cast<SizeType32>(blockDim.x * gridDim.x))
+    {
+        auto const batchSlot = batchSlots[batchIdx];
+        auto finishState = finished[batchSlot];
+
+        // Same criterion as lengthCriterion specialized for beamWidth == 1; no reduction is needed
+        // since the finished count per slot is 0 or 1.
+        auto const numTokensToLimit = sequenceLimitLength[batchSlot] - sequenceLengths[batchSlot];
+        if (numTokensToLimit <= 0)
+        {
+            finishState.setFinishedMaxLength();
+            sequenceLengths[batchSlot] = sequenceLimitLength[batchSlot];
+            if (numNewTokens)
+            {
+                numNewTokens[batchSlot] = numNewTokens[batchSlot] + numTokensToLimit;
+            }
+        }
+        finished[batchSlot] = finishState;
+        if (finishedSum)
+        {
+            finishedSum[batchSlot] = finishState.isFinished() ? 1 : 0;
+        }
+
+        // Token append, equivalent to copyNextStepIds for one token per step, applied after the
+        // criterion so the clamped sequence length selects the source index.
+        auto const newTokens = numNewTokens == nullptr ? 1 : numNewTokens[batchSlot];
+        auto const indexSrc = sequenceLengths[batchSlot] - newTokens;
+        if (newTokens > 0 && indexSrc >= 0)
+        {
+            nextStepIds[batchSlot] = outputIdsPtr[batchSlot][indexSrc];
+        }
+    }
+}
+
+void invokeLengthCriterionWithTokenCopy(FinishedState* finished, SizeType32* finishedSum,
+    SizeType32 const* sequenceLimitLength, SizeType32* sequenceLengths, SizeType32* numNewTokens,
+    TokenIdType* nextStepIds, TokenIdType const* const* outputIdsPtr, SizeType32 const* batchSlots,
+    SizeType32 batchSize, cudaStream_t stream)
+{
+    dim3 block{static_cast<uint32_t>(min(256, batchSize))};
+    dim3 grid{static_cast<uint32_t>(divUp(batchSize, static_cast<SizeType32>(block.x)))};
+
+    lengthCriterionWithTokenCopy<<<grid, block, 0, stream>>>(finished, finishedSum, sequenceLimitLength,
+        sequenceLengths, numNewTokens, nextStepIds, outputIdsPtr, batchSlots, batchSize);
+    sync_check_cuda_error(stream);
+}
+
 __global__ void explicitEOSCriterion(TokenIdType const** outputIds, TokenIdType const* endIds, FinishedState* finished,
     SizeType32* sequenceLengths, SizeType32* numNewTokens, SizeType32 const* batchSlots, SizeType32 batchSize,
     SizeType32 maxTokensPerStep)
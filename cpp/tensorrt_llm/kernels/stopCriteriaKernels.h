@@ -73,6 +73,28 @@ void invokeLengthCriterion(FinishedState* finished, runtime::SizeType32* finishe
     runtime::SizeType32* numNewTokens, runtime::SizeType32 const* batchSlots, runtime::SizeType32 batchSize,
     runtime::SizeType32 beamWidth, cudaStream_t stream);
 
+//! \brief Fused decoding-step epilogue for beamWidth == 1 and one token per step. Applies the same
+//! max-length criterion as invokeLengthCriterion and appends the token predicted at this step into
+//! nextStepIds in the same launch, replacing two small kernels with one. The fixed launch overhead
+//! of the per-iteration tail dominates at small batch sizes.
+//!
+//! \param finished input/output buffer [maxBatchSize]. Finished states, updated like invokeLengthCriterion
+//! \param finishedSum output buffer [maxBatchSize], optional. 1 per finished request, 0 otherwise
+//! \param sequenceLimitLength input buffer [maxBatchSize]. Maximum sequence length
+//! \param sequenceLengths input/output buffer [maxBatchSize]. Clamped to sequenceLimitLength
+//! \param numNewTokens input/output buffer [maxBatchSize], optional. Number of tokens predicted this step.
+//! If nullptr, 1 is used
+//! \param nextStepIds output buffer [maxBatchSize]. Token predicted at this step per request
+//! \param outputIdsPtr input buffer [maxBatchSize][maxSeqLen]. Pointers to rows with output tokens per request
+//! \param batchSlots input buffer [batchSize]. Indices of rows of data in memory pool
+//! \param batchSize batch size
+//! \param stream stream
+void invokeLengthCriterionWithTokenCopy(FinishedState* finished, runtime::SizeType32* finishedSum,
+    runtime::SizeType32 const* sequenceLimitLength, runtime::SizeType32* sequenceLengths,
+    runtime::SizeType32* numNewTokens, runtime::TokenIdType* nextStepIds,
+    runtime::TokenIdType const* const* outputIdsPtr, runtime::SizeType32 const* batchSlots,
+    runtime::SizeType32 batchSize, cudaStream_t stream);
+
 //! \brief Sets finished states based on the endIds and adjusts sequence length to length before the first EOS token.
 //! Does not support beamWidth > 1 for now.
 //!
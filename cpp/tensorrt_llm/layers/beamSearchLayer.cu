@@ -23,6 +23,7 @@
 #include "tensorrt_llm/layers/defaultDecodingParams.h"
 #include "tensorrt_llm/layers/layerUtils.h"
 
+#include <algorithm>
 #include <limits>
 
 using namespace tensorrt_llm::runtime;
@@ -115,6 +116,9 @@ void BeamSearchLayer<T>::allocateBuffer()
 
         mBeamWidthIn = mBufferManager->pinnedPool(batchSizeShape, TRTDataType<int>::value);
         mBeamWidthOut = mBufferManager->pinnedPool(batchSizeShape, TRTDataType<int>::value);
+
+        mBeamWidthInDevice = mBufferManager->gpu(batchSizeShape, TRTDataType<int>::value);
+        mBeamWidthOutDevice = mBufferManager->gpu(batchSizeShape, TRTDataType<int>::value);
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -364,11 +368,23 @@ void BeamSearchLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const
             bh.nBeamWidthInHost[i] = bh.beamWidthArraysHost[slot * kMaxBeamWidthArrayLength + indexInput];
             bh.nBeamWidthOutHost[i] = bh.beamWidthArraysHost[slot * kMaxBeamWidthArrayLength + indexOutput];
         }
-        // At present, all requests of a batch must have the same beam width in one generation step (or they will not
-        // be batched together). So, the beam width of the first request is taken here to reshape the buffer.
-        // Corresponding changes must be done if Diverse-Beam-Width-Search (DBWS, requests with diverse beam width in
-        // a batch in one generation step) is supported in the future.
-        op->beamWidth = bh.nBeamWidthOutHost[0];
+        // Copy the per-request beam widths to device so that the kernels can iterate only the real beams of
+        // each request (Diverse-Beam-Width-Search, DBWS, requests with diverse beam width in a batch in one
+        // generation step). The buffers are reshaped with the widest request of the batch, requests running
+        // fewer beams are masked inside the kernels instead of being padded to the batch-wide beam width.
+        auto const beamWidthInView = ITensor::slice(mBeamWidthIn, 0, ip->localBatchSize);
+        auto const beamWidthOutView = ITensor::slice(mBeamWidthOut, 0, ip->localBatchSize);
+        mBufferManager->copy(*beamWidthInView, *ITensor::slice(mBeamWidthInDevice, 0, ip->localBatchSize));
+        mBufferManager->copy(*beamWidthOutView, *ITensor::slice(mBeamWidthOutDevice, 0, ip->localBatchSize));
+        bh.beamWidthsInDevice = bufferCast<int>(*mBeamWidthInDevice);
+        bh.beamWidthsOutDevice = bufferCast<int>(*mBeamWidthOutDevice);
+
+        SizeType32 beamWidthOut{0};
+        for (int i = 0; i < ip->localBatchSize; ++i)
+        {
+            beamWidthOut = std::max(beamWidthOut, bh.nBeamWidthOutHost[i]);
+        }
+        op->beamWidth = beamWidthOut;
     }
     else
     {
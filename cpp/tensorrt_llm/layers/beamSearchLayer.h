@@ -70,6 +70,8 @@ private:
     TensorPtr mBeamWidthArrayDevice;          // [batchSize, kMaxBeamWidthArrayLength] gpu
     TensorPtr mBeamWidthIn;                   // [batchSize] cpu, the beamWidth of last forward computation
     TensorPtr mBeamWidthOut;                  // [batchSize] cpu, the beamWidth of next forward computation
+    TensorPtr mBeamWidthInDevice;             // [batchSize] gpu, per-request copy of mBeamWidthIn for DBWS
+    TensorPtr mBeamWidthOutDevice;            // [batchSize] gpu, per-request copy of mBeamWidthOut for DBWS
 };
 
 } // namespace tensorrt_llm::layers
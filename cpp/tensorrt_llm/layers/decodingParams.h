@@ -522,6 +522,10 @@ public:
     // Beam width might change in Variable-Beam-Width-Search mode.
     // So the beam width is updated in beam search layer for the later layers.
     runtime::SizeType32 beamWidth{1};
+
+    // Set when a layer already wrote the tokens predicted at this step into newTokens as part of a
+    // fused epilogue, so the separate copy kernel after the layer stack is skipped.
+    bool newTokensAppended{false};
 };
 
 class BeamSearchOutputs : public BaseDecodingOutputs
@@ -208,8 +208,18 @@ void DynamicDecodeLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> co
     //! Copy the input batch slots to device for faster access in devie usage (kernels).
     workspace->setDeviceBatchSlots(params->batchSlots);
 
-    prepareIdsPtrs(baseOutputs, params->batchSlots, localDecoderDomain.getBatchSize(),
-        localDecoderDomain.getBeamWidth(), maxSeqLen);
+    if (mConfiguredBeamWidth == 1)
+    {
+        // Fast path for the dominant beam-width-1 case: the per-slot pointers only depend on the
+        // slot index, so the arrays are filled once for all slots instead of being rebuilt on the
+        // host and copied to device on every step.
+        prepareIdsPtrsBeamWidth1(baseOutputs, localDecoderDomain.getBatchSize(), maxSeqLen);
+    }
+    else
+    {
+        prepareIdsPtrs(baseOutputs, params->batchSlots, localDecoderDomain.getBatchSize(),
+            localDecoderDomain.getBeamWidth(), maxSeqLen);
+    }
 
     for (auto& layer : mLayers)
     {
@@ -278,6 +288,39 @@ void DynamicDecodeLayer<T>::prepareIdsPtrs(std::shared_ptr<BaseDecodingOutputs>
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+template <typename T>
+void DynamicDecodeLayer<T>::prepareIdsPtrsBeamWidth1(
+    std::shared_ptr<BaseDecodingOutputs> const& outputs, SizeType32 batchSize, SizeType32 maxSeqLen)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    auto* outputIdsBase = bufferCast<TokenIdType>(*outputs->outputIds);
+    TensorPtr outputIdsPtrHostSlice = ITensor::at(mOutputIdsPtrHost, {0});
+    if (outputIdsBase != mFilledOutputIdsBase)
+    {
+        // Without beam search the pointer for a slot is constant for the lifetime of the output ids
+        // buffer, so fill the arrays for all slots once. The parent ids are never dereferenced with
+        // beam width 1 and all point at the zero scratch buffer.
+        TensorPtr parentIdsPtrHostSlice = ITensor::at(mParentIdsPtrHost, {0});
+        auto outputIdsPtrHost = runtime::bufferCast<TokenIdType*>(*outputIdsPtrHostSlice);
+        auto parentIdsPtrHost = runtime::bufferCast<TokenIdType*>(*parentIdsPtrHostSlice);
+        auto* zeroParentIds = bufferCast<TokenIdType>(*mZeroParentIdsDevice);
+        for (SizeType32 batchSlot = 0; batchSlot < mDecoderDomain.getBatchSize(); batchSlot++)
+        {
+            outputIdsPtrHost[batchSlot] = outputIdsBase + batchSlot * maxSeqLen;
+            parentIdsPtrHost[batchSlot] = zeroParentIds;
+        }
+        mBufferManager->copy(*outputIdsPtrHostSlice, *mOutputIdsPtrDevice);
+        mBufferManager->copy(*parentIdsPtrHostSlice, *mParentIdsPtrDevice);
+        mFilledOutputIdsBase = outputIdsBase;
+    }
+
+    outputs->outputIdsPtr = ITensor::slice(mOutputIdsPtrDevice, 0, batchSize);
+    outputs->outputIdsPtrHost = ITensor::slice(outputIdsPtrHostSlice, 0, batchSize);
+    outputs->parentIdsPtr = ITensor::slice(mParentIdsPtrDevice, 0, batchSize);
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 template <typename T>
 void DynamicDecodeLayer<T>::prepareOutputData(std::shared_ptr<BaseDecodingOutputs> const& outputs,
     BufferConstPtr batchSlots, SizeType32 batchSize, SizeType32 maxBatchSize, SizeType32 beamWidth,
@@ -290,8 +333,12 @@ void DynamicDecodeLayer<T>::prepareOutputData(std::shared_ptr<BaseDecodingOutput
     auto sequenceLengthsPtr = bufferCast<SizeType32>(*outputs->sequenceLength.value());
     auto const* batchSlotsPtr = bufferCast<SizeType32>(*batchSlots);
 
-    invokeCopyNextStepIds(newTokensPtr, outputIdsPtrDevice, sequenceLengthsPtr, numNewTokens, batchSlotsPtr, batchSize,
-        maxBatchSize, beamWidth, maxSeqLen, maxTokensPerStep, stream);
+    // The stop criteria layer may have already appended the new tokens as part of its fused epilogue.
+    if (!outputs->newTokensAppended)
+    {
+        invokeCopyNextStepIds(newTokensPtr, outputIdsPtrDevice, sequenceLengthsPtr, numNewTokens, batchSlotsPtr,
+            batchSize, maxBatchSize, beamWidth, maxSeqLen, maxTokensPerStep, stream);
+    }
 
     // Transpose output log probs from [maxSeqLen, batchSize, beamWidth] to [batchSize, beamWidth, maxSeqLen]
     if (outputLogProbs && outputs->outputLogProbsTiled)
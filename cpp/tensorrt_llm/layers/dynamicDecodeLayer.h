@@ -59,6 +59,8 @@ private:
 
     void prepareIdsPtrs(std::shared_ptr<BaseDecodingOutputs> const& outputs, BufferConstPtr batchSlots,
         runtime::SizeType32 batchSize, runtime::SizeType32 beamWidth, runtime::SizeType32 maxSeqLen);
+    void prepareIdsPtrsBeamWidth1(
+        std::shared_ptr<BaseDecodingOutputs> const& outputs, runtime::SizeType32 batchSize, runtime::SizeType32 maxSeqLen);
     void prepareOutputData(std::shared_ptr<BaseDecodingOutputs> const& outputs, BufferConstPtr batchSlots,
         runtime::SizeType32 batchSize, runtime::SizeType32 maxBatchSize, runtime::SizeType32 beamWidth,
         runtime::SizeType32 maxSeqLen, runtime::SizeType32 maxTokensPerStep, bool outputLogProbs, cudaStream_t stream);
@@ -83,6 +85,10 @@ private:
     runtime::SizeType32 mCyclicStep{0};
     runtime::SizeType32 mRuntimeMaxSeqLen{0};
     runtime::SizeType32 mConfiguredBeamWidth{-1};
+
+    //! Base of the output ids buffer the pointer arrays were last filled for in the beam-width-1
+    //! fast path; the arrays only need to be rebuilt and re-copied when this buffer moves.
+    runtime::TokenIdType const* mFilledOutputIdsBase{nullptr};
 };
 
 } // namespace tensorrt_llm::layers
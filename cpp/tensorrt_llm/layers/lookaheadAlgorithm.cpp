@@ -72,7 +72,7 @@ void LookaheadAlgorithm::setup(TensorConstPtr const& prompt, SizeType32 w, SizeT
     std::tie(std::ignore, std::ignore, mRuntimeMaxDraftLen, mRuntimeMaxDraftPathLen)
         = executor::LookaheadDecodingConfig(mW, mN, mG).calculateSpeculativeResource();
 
-    mPoolManager.setup(mG);
+    mPoolManager.setup(mG, mN);
     mPoolManager.accept(prompt, mN);
     mGoldenTokens = ITensor::slice(mGoldenTokensMax, 0, mN * 2 - 1);
     mPrefills = ITensor::slice(mPrefillsMax, 0, mN <= 1 ? 0 : mN - 2);
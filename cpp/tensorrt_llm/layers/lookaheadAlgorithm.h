@@ -34,6 +34,12 @@ public:
     LookaheadAlgorithm(
         runtime::SizeType32 maxW, runtime::SizeType32 maxN, runtime::SizeType32 maxG, runtime::SizeType32 id = 0);
 
+    //! @brief attach a cross-request ngram cache shared between all slots, surviving request completion.
+    void setSharedNgramCache(std::shared_ptr<LookaheadNgramCache> const& sharedCache)
+    {
+        mPoolManager.setSharedCache(sharedCache);
+    }
+
     //! @brief setup per request, fill internal states from @param prompt.
     void setup(TensorConstPtr const& prompt, runtime::SizeType32 w, runtime::SizeType32 n, runtime::SizeType32 g,
         uint64_t seed);
@@ -61,6 +61,15 @@ LookaheadDecodingLayer<T>::CpuAlgorithmResources::CpuAlgorithmResources(DecoderD
         mAlgos.emplace_back(maxW, maxN, maxG, id);
     }
 
+    if (lookaheadModule->getExecutionConfig().getUsePoolCache())
+    {
+        mNgramCache = std::make_shared<LookaheadNgramCache>(LookaheadNgramCache::kDefaultMaxKeys, maxG);
+        for (auto& algo : mAlgos)
+        {
+            algo.setSharedNgramCache(mNgramCache);
+        }
+    }
+
     mPrompts.reserve(maxBatchSize);
     for (auto bi = 0; bi < maxBatchSize; bi++)
     {
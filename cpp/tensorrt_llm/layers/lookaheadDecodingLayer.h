@@ -62,6 +62,8 @@ private:
         explicit CpuAlgorithmResources(DecoderDomain const& decoderDomain);
 
         std::vector<LookaheadAlgorithm> mAlgos;
+        //! the cross-request ngram cache shared by all slots, nullptr unless enabled in the execution config
+        std::shared_ptr<LookaheadNgramCache> mNgramCache;
         std::vector<TensorPtr> mPrompts;
         TensorPtr mBatchSlots;
         TensorPtr mTargetTokens;
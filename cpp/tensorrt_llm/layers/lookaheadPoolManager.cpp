@@ -17,6 +17,7 @@
 #include "tensorrt_llm/layers/lookaheadPoolManager.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/layers/lookaheadDecodingUtils.h"
+#include <algorithm>
 #include <cstddef>
 
 namespace tensorrt_llm::layers
@@ -24,10 +25,79 @@ namespace tensorrt_llm::layers
 
 using namespace tensorrt_llm::runtime;
 
-void LookaheadPoolManager::setup(SizeType32 guessSetSize)
+namespace
+{
+bool ngramEquals(ITensor::SharedConstPtr const& lhs, ITensor::SharedConstPtr const& rhs)
+{
+    if (ITensor::volume(lhs->getShape()) != ITensor::volume(rhs->getShape()))
+    {
+        return false;
+    }
+    BufferRange<TokenIdType const> lhsRange(*lhs);
+    BufferRange<TokenIdType const> rhsRange(*rhs);
+    return std::equal(lhsRange.begin(), lhsRange.end(), rhsRange.begin());
+}
+} // namespace
+
+void LookaheadNgramCache::insert(Key key, TensorConstPtr const& ngram)
+{
+    if (TLLM_UNLIKELY(ITensor::volume(ngram->getShape()) == 0 || mMaxKeys == 0 || mMaxNgramsPerKey == 0))
+    {
+        return;
+    }
+
+    auto search = mEntries.find(key);
+    if (search == mEntries.end())
+    {
+        while (static_cast<SizeType32>(mEntries.size()) >= mMaxKeys)
+        {
+            mEntries.erase(mLruKeys.front());
+            mLruKeys.pop_front();
+        }
+        mLruKeys.push_back(key);
+        search = mEntries.emplace(key, std::make_pair(std::prev(mLruKeys.end()), std::list<TensorConstPtr>())).first;
+    }
+    else
+    {
+        mLruKeys.splice(mLruKeys.end(), mLruKeys, search->second.first);
+    }
+
+    auto& ngrams = search->second.second;
+    ngrams.remove_if([&ngram](TensorConstPtr const& item) { return ngramEquals(ngram, item); });
+    if (mMaxNgramsPerKey > 0 && ngrams.size() >= static_cast<size_t>(mMaxNgramsPerKey))
+    {
+        ngrams.pop_front();
+    }
+    ngrams.push_back(ngram);
+}
+
+std::list<LookaheadNgramCache::TensorConstPtr> LookaheadNgramCache::lookup(
+    Key key, SizeType32 guessSize, SizeType32 ngramLen)
+{
+    std::list<TensorConstPtr> result;
+    auto search = mEntries.find(key);
+    if (search == mEntries.end())
+    {
+        return result;
+    }
+    mLruKeys.splice(mLruKeys.end(), mLruKeys, search->second.first);
+    auto const& ngrams = search->second.second;
+    // newest first, so the freshest ngrams win when the budget is short
+    for (auto it = ngrams.rbegin(); it != ngrams.rend() && static_cast<SizeType32>(result.size()) < guessSize; ++it)
+    {
+        if (ngramLen == 0 || ITensor::volume((*it)->getShape()) == ngramLen)
+        {
+            result.push_back(*it);
+        }
+    }
+    return result;
+}
+
+void LookaheadPoolManager::setup(SizeType32 guessSetSize, SizeType32 level)
 {
     TLLM_CHECK(guessSetSize >= 0 && guessSetSize <= mGuessSetSizeMax);
     mGuessSetSize = guessSetSize;
+    mLevel = level;
     mTokenMap.clear();
 }
 
@@ -38,6 +108,11 @@ void LookaheadPoolManager::insertOne(Key key, TensorConstPtr const& ngram)
         return;
     }
 
+    if (mSharedCache)
+    {
+        mSharedCache->insert(key, ngram);
+    }
+
     auto search = mTokenMap.find(key);
     if (search != mTokenMap.end())
     {
@@ -78,24 +153,40 @@ void LookaheadPoolManager::accept(TensorConstPtr const& prompt, SizeType32 level
 
 std::list<LookaheadPoolManager::TensorConstPtr> LookaheadPoolManager::guess(Key lastToken, SizeType32 guessSize) const
 {
+    std::list<TensorConstPtr> result;
     auto search = mTokenMap.find(lastToken);
     if (search != mTokenMap.end())
     {
-        auto ngrams = search->second;
+        auto const& ngrams = search->second;
         if (ngrams.size() > static_cast<size_t>(guessSize))
         {
             auto it = std::prev(ngrams.end(), guessSize);
-            return std::list<TensorConstPtr>(it, ngrams.end());
+            result.assign(it, ngrams.end());
         }
         else
         {
-            return ngrams;
+            result = ngrams;
         }
     }
-    else
+    // Warm start from n-grams of earlier requests when this request's pool cannot fill the budget yet.
+    if (mSharedCache && static_cast<SizeType32>(result.size()) < guessSize)
     {
-        return std::list<TensorConstPtr>();
+        auto const cached = mSharedCache->lookup(lastToken, guessSize, mLevel > 0 ? mLevel - 1 : 0);
+        for (auto const& ngram : cached)
+        {
+            if (static_cast<SizeType32>(result.size()) >= guessSize)
+            {
+                break;
+            }
+            auto const isDuplicate = std::any_of(result.begin(), result.end(),
+                [&ngram](TensorConstPtr const& item) { return ngramEquals(ngram, item); });
+            if (!isDuplicate)
+            {
+                result.push_back(ngram);
+            }
+        }
     }
+    return result;
 }
 
 void LookaheadPoolManager::update(TensorConstPtr const& keyTokens, TensorConstPtr const& ngramTokens)
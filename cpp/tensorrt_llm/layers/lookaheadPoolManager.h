@@ -17,6 +17,7 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include <unordered_map>
 
 #include "tensorrt_llm/runtime/bufferManager.h"
@@ -25,6 +26,48 @@
 namespace tensorrt_llm::layers
 {
 
+//! @brief A bounded key-ngram cache shared between requests, so n-grams learned on one request warm-start the
+//! following ones. Keys age out in LRU order. Not thread-safe; meant to be shared by the pool managers of one
+//! decoding layer, which all run on the decoder thread.
+class LookaheadNgramCache
+{
+public:
+    using TensorConstPtr = runtime::ITensor::SharedConstPtr;
+    using Key = runtime::TokenIdType;
+
+    static constexpr runtime::SizeType32 kDefaultMaxKeys = 2048;
+
+    LookaheadNgramCache(runtime::SizeType32 maxKeys, runtime::SizeType32 maxNgramsPerKey)
+        : mMaxKeys(maxKeys)
+        , mMaxNgramsPerKey(maxNgramsPerKey)
+    {
+    }
+
+    //! @brief insert one key-ngram pair, refreshing the key recency and evicting the oldest key when full.
+    void insert(Key key, TensorConstPtr const& ngram);
+
+    //! @brief get at most @param guessSize newest ngrams of @param key, refreshing the key recency.
+    //! Only ngrams of length @param ngramLen are returned, so requests with different n-gram levels do not mix.
+    std::list<TensorConstPtr> lookup(Key key, runtime::SizeType32 guessSize, runtime::SizeType32 ngramLen);
+
+    [[nodiscard]] size_t size() const
+    {
+        return mEntries.size();
+    }
+
+private:
+    using LruIterator = std::list<Key>::iterator;
+
+    //! @brief the bound on distinct keys, oldest evicted first
+    runtime::SizeType32 const mMaxKeys;
+    //! @brief the bound on ngrams kept per key, oldest evicted first
+    runtime::SizeType32 const mMaxNgramsPerKey;
+    //! @brief keys in access order, the most recently used at the back
+    std::list<Key> mLruKeys;
+    //! @brief the cached ngrams per key, along with the key position in mLruKeys
+    std::unordered_map<Key, std::pair<LruIterator, std::list<TensorConstPtr>>> mEntries;
+};
+
 //! @brief A helper class for managing key-ngram pool.
 class LookaheadPoolManager
 {
@@ -38,9 +81,17 @@ public:
     {
     }
 
+    //! @brief attach a cross-request ngram cache; the pool publishes new ngrams to it and falls back to it
+    //! when the per-request pool has no match yet.
+    void setSharedCache(std::shared_ptr<LookaheadNgramCache> const& sharedCache)
+    {
+        mSharedCache = sharedCache;
+    }
+
     //! @brief setup runtime resource
     //! @param guessSetSize the runtime guessSetSize.
-    void setup(runtime::SizeType32 guessSetSize);
+    //! @param level the n-gram length, used to filter shared cache hits; 0 disables the filter.
+    void setup(runtime::SizeType32 guessSetSize, runtime::SizeType32 level = 0);
 
     //! @brief fill token map from accepted tokens, including prompt.
     //! @param prompt the user input prompt, [length] on cpu
@@ -72,6 +123,10 @@ private:
     //! @brief guess set size, -1 for infinite size
     runtime::SizeType32 const mGuessSetSizeMax;
     runtime::SizeType32 mGuessSetSize;
+    //! @brief the n-gram length of the current request, 0 when unknown
+    runtime::SizeType32 mLevel{0};
+    //! @brief the optional cross-request ngram cache, surviving request completion
+    std::shared_ptr<LookaheadNgramCache> mSharedCache;
 };
 
 } // namespace tensorrt_llm::layers
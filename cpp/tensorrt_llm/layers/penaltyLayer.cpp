@@ -90,6 +90,14 @@ void PenaltyLayer<T>::allocateWorkspace()
         {
             mPenaltyWorkspacePrevDevice = mBufferManager->gpu(workspaceSize, nvinfer1::DataType::kINT32);
         }
+        else if (mConfiguredBeamWidth == 1 && mDecoderDomain.getMaxDecodingTokens() == 1)
+        {
+            // For the common single-beam single-token case the occurrence penalties are applied
+            // incrementally to the seen tokens only, tracked in a compact per-slot list.
+            mSeenTokensDevice = mBufferManager->gpu(
+                mDecoderDomain.getBatchSize() * mDecoderDomain.getVocabSize(), nvinfer1::DataType::kINT32);
+            mSeenTokensLensDevice = mBufferManager->gpu(mDecoderDomain.getBatchSize(), nvinfer1::DataType::kINT32);
+        }
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -224,6 +232,12 @@ void PenaltyLayer<T>::setup(SizeType32 batchSize, SizeType32 beamWidth, TensorCo
                 mPenaltyWorkspacePrevDevice, batchSlot * workspaceSizePerBatch, workspaceSizePerBatch);
             mBufferManager->setZero(*deviceSlice);
         }
+
+        if (mSeenTokensLensDevice)
+        {
+            auto deviceSlice = runtime::IBuffer::slice(mSeenTokensLensDevice, batchSlot, 1);
+            mBufferManager->setZero(*deviceSlice);
+        }
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -323,6 +337,8 @@ void PenaltyLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const& b
     penaltyParams.finished = (params->finished)
         ? reinterpret_cast<FinishedState const*>(bufferCast<FinishedState::UnderlyingType>(*params->finished.value()))
         : nullptr;
+    penaltyParams.seenTokens = bufferCastOrNull<TokenIdType>(mSeenTokensDevice);
+    penaltyParams.seenTokensLens = bufferCastOrNull<SizeType32>(mSeenTokensLensDevice);
     penaltyParams.stream = getStream();
 
     if (penaltyParams.beamWidth > 1)
@@ -344,7 +360,15 @@ void PenaltyLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const& b
         invokeAddBiasSoftMax(biasSoftmaxParams, penaltyParams.stream);
     }
 
-    invokeBatchApplyPenalty(penaltyParams);
+    if (penaltyParams.seenTokens != nullptr)
+    {
+        // Touch only the penalized vocab entries instead of scanning the occurrence counts every step
+        invokeBatchApplyPenaltyDelta(penaltyParams);
+    }
+    else
+    {
+        invokeBatchApplyPenalty(penaltyParams);
+    }
     sync_check_cuda_error(penaltyParams.stream);
 
     mCyclicStep += 1;
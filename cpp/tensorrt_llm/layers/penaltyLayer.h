@@ -86,6 +86,10 @@ private:
 
     BufferPtr mPenaltyWorkspaceDevice;
     BufferPtr mPenaltyWorkspacePrevDevice;
+    //! per-slot compact lists of seen tokens for the delta penalty kernel, only allocated for
+    //! single-beam single-token configurations
+    BufferPtr mSeenTokensDevice;
+    BufferPtr mSeenTokensLensDevice;
     TensorPtr mLogitsPtrsHost;
 };
 
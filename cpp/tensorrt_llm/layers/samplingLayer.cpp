@@ -50,8 +50,9 @@ SamplingLayer<T>::SamplingLayer(executor::DecodingMode const& mode, DecoderDomai
 
     if (mDecodingMode.isTopP())
     {
-        mSamplingLayers.emplace_back(
-            std::make_unique<TopPSamplingLayer<T>>(decoderDomain, mBufferManager, /* deterministic */ true));
+        auto topPLayer = std::make_unique<TopPSamplingLayer<T>>(decoderDomain, mBufferManager, /* deterministic */ true);
+        mTopPSkipDecodeHost = topPLayer->getSkipDecodeHost();
+        mSamplingLayers.emplace_back(std::move(topPLayer));
     }
 
     allocateBuffer(decoderDomain.getBatchSize());
@@ -151,9 +152,18 @@ void SamplingLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> const&
         ? reinterpret_cast<FinishedState const*>(bufferCast<FinishedState::UnderlyingType>(*inputs->finished.value()))
         : nullptr;
 
-    auto const skipTopP = !mDecodingMode.isTopP();
-
     auto const* batchSlotsHostPtr = bufferCast<SizeType32>(*inputs->batchSlots);
+
+    // TopP can also be skipped dynamically: when every request in the batch is handled by the top-k layer,
+    // the top-k kernel samples from the raw logits and the softmax pass over [batchSize, vocabSizePadded]
+    // is not needed.
+    auto skipTopP = !mDecodingMode.isTopP();
+    if (!skipTopP && mTopPSkipDecodeHost)
+    {
+        auto const* topPSkipDecodeHostPtr = bufferCast<bool>(*mTopPSkipDecodeHost);
+        skipTopP = allOfBatchSlots(batchSlotsHostPtr, topPSkipDecodeHostPtr, batchSize, true);
+    }
+
     auto minPs = mUseMinP
             && !allOfBatchSlots(batchSlotsHostPtr, bufferCast<float>(*mRuntimeMinPHost),
                 localDecoderDomain.getBatchSize(), DefaultDecodingParams::getMinP())
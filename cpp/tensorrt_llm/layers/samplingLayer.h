@@ -70,6 +70,10 @@ private:
     TensorPtr mRuntimeMinPDevice;
     bool mUseMinP{false};
 
+    //! Host-side skip flags of the top-p layer, used to skip the softmax pass over the logits
+    //! when every request in the batch takes the top-k path.
+    TensorConstPtr mTopPSkipDecodeHost;
+
     std::vector<std::unique_ptr<BaseLayer>> mSamplingLayers;
 
 private:
@@ -91,7 +91,8 @@ void StopCriteriaLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> con
     }
     if (mDecodingMode.isUseMaxLengthStop() && inputs->stopCriteriaInputs->sequenceLimitLength)
     {
-        checkMaxLengthStopCriteria(outputs, inputs, localDecoderDomain, *mBufferManager, workspace);
+        checkMaxLengthStopCriteria(
+            outputs, inputs, localDecoderDomain, mDecoderDomain.getMaxDecodingTokens(), *mBufferManager, workspace);
     }
 
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -108,20 +109,27 @@ void StopCriteriaLayer<T>::checkStopWordsStopCriteria(std::shared_ptr<BaseDecodi
     auto* outputIdsPtr = bufferCast<SizeType32 const*>(*outputs->outputIdsPtr);
     auto* parentIdsPtr = bufferCast<SizeType32 const*>(*outputs->parentIdsPtr);
     auto* sequenceLengthPtr = bufferCastOrNull<SizeType32>(outputs->sequenceLength);
+    // The finished states are persistent and device-resident in the executor workflow, so the criterion kernel
+    // can update them in place. Mirror them through the workspace only when they live in host memory.
+    bool const finishedIsOnGpu
+        = outputs->finished.has_value() && outputs->finished.value()->getMemoryType() == MemoryType::kGPU;
     auto [stopWordsLengthsDevice, stopWordsPtrDevice, finishedDevice]
         = workspace->mirrorInWorkspace(inputs->stopCriteriaInputs->stopWordsLengths.value_or(nullptr),
-            inputs->stopCriteriaInputs->stopWordsPtr.value_or(nullptr), outputs->finished.value_or(nullptr));
+            inputs->stopCriteriaInputs->stopWordsPtr.value_or(nullptr),
+            finishedIsOnGpu ? TensorPtr{} : outputs->finished.value_or(nullptr));
     auto const* stopWordsLengthsPtr
         = stopWordsLengthsDevice == nullptr ? nullptr : bufferCast<SizeType32>(*stopWordsLengthsDevice);
     auto const* stopWordsPtrPtr
         = stopWordsPtrDevice == nullptr ? nullptr : bufferCast<TokenIdType const*>(*stopWordsPtrDevice);
-    auto* finishedPtr = finishedDevice == nullptr
-        ? nullptr
-        : reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*finishedDevice));
+    auto* finishedPtr = finishedIsOnGpu
+        ? reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*outputs->finished.value()))
+        : (finishedDevice == nullptr
+                ? nullptr
+                : reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*finishedDevice)));
     invokeStopWordsCriterion(outputIdsPtr, parentIdsPtr, stopWordsPtrPtr, finishedPtr, sequenceLengthPtr,
         workspace->getDeviceBatchSlotsPtr(), stopWordsLengthsPtr, numNewTokens, maxStopWordsLength,
         decoderDomain.getBatchSize(), decoderDomain.getBeamWidth(), maxSeqLen, bufferManager.getStream().get());
-    if (finishedPtr != nullptr)
+    if (!finishedIsOnGpu && finishedPtr != nullptr)
     {
         bufferManager.copy(*finishedDevice, *outputs->finished.value());
     }
@@ -130,26 +138,55 @@ void StopCriteriaLayer<T>::checkStopWordsStopCriteria(std::shared_ptr<BaseDecodi
 
 template <typename T>
 void StopCriteriaLayer<T>::checkMaxLengthStopCriteria(std::shared_ptr<BaseDecodingOutputs>& outputs,
-    std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain,
+    std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain, SizeType32 maxDecodingTokens,
     BufferManager const& bufferManager, std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
     auto* numNewTokens = bufferCastOrNull<SizeType32>(outputs->numNewTokens);
+    // Same as for the stop words criterion, update the persistent device-resident states in place and only
+    // fall back to the workspace mirror for host-resident tensors.
+    bool const finishedIsOnGpu
+        = outputs->finished.has_value() && outputs->finished.value()->getMemoryType() == MemoryType::kGPU;
+    bool const finishedSumIsOnGpu
+        = outputs->finishedSum.has_value() && outputs->finishedSum.value()->getMemoryType() == MemoryType::kGPU;
     auto [finishedSumDevice, finishedDevice]
-        = workspace->mirrorInWorkspace(outputs->finishedSum.value_or(nullptr), outputs->finished.value_or(nullptr));
-    auto* finishedSumDevicePtr = finishedSumDevice == nullptr ? nullptr : bufferCast<SizeType32>(*finishedSumDevice);
-    auto* finishedPtr = finishedDevice == nullptr
-        ? nullptr
-        : reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*finishedDevice));
-    invokeLengthCriterion(finishedPtr, finishedSumDevicePtr,
-        bufferCastOrNull<SizeType32>(inputs->stopCriteriaInputs->sequenceLimitLength),
-        bufferCastOrNull<SizeType32>(outputs->sequenceLength), numNewTokens, workspace->getDeviceBatchSlotsPtr(),
-        decoderDomain.getBatchSize(), decoderDomain.getBeamWidth(), bufferManager.getStream().get());
-    if (finishedSumDevice != nullptr)
+        = workspace->mirrorInWorkspace(finishedSumIsOnGpu ? TensorPtr{} : outputs->finishedSum.value_or(nullptr),
+            finishedIsOnGpu ? TensorPtr{} : outputs->finished.value_or(nullptr));
+    auto* finishedSumDevicePtr = finishedSumIsOnGpu
+        ? bufferCast<SizeType32>(*outputs->finishedSum.value())
+        : (finishedSumDevice == nullptr ? nullptr : bufferCast<SizeType32>(*finishedSumDevice));
+    auto* finishedPtr = finishedIsOnGpu
+        ? reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*outputs->finished.value()))
+        : (finishedDevice == nullptr
+                ? nullptr
+                : reinterpret_cast<FinishedState*>(bufferCast<FinishedState::UnderlyingType>(*finishedDevice)));
+    // In the dominant single-beam single-token case the criterion and the token append into
+    // newTokens are fused into one launch; the copy kernel after the layer stack is then skipped.
+    // The fusion needs the persistent device-resident states, so host-mirrored states take the
+    // generic path.
+    bool const canFuseTokenCopy = decoderDomain.getBeamWidth() == 1 && maxDecodingTokens == 1
+        && finishedIsOnGpu && finishedSumIsOnGpu && outputs->newTokens != nullptr && outputs->outputIdsPtr != nullptr;
+    if (canFuseTokenCopy)
+    {
+        invokeLengthCriterionWithTokenCopy(finishedPtr, finishedSumDevicePtr,
+            bufferCastOrNull<SizeType32>(inputs->stopCriteriaInputs->sequenceLimitLength),
+            bufferCastOrNull<SizeType32>(outputs->sequenceLength), numNewTokens,
+            bufferCast<TokenIdType>(*outputs->newTokens), bufferCast<TokenIdType const*>(*outputs->outputIdsPtr),
+            workspace->getDeviceBatchSlotsPtr(), decoderDomain.getBatchSize(), bufferManager.getStream().get());
+        outputs->newTokensAppended = true;
+    }
+    else
+    {
+        invokeLengthCriterion(finishedPtr, finishedSumDevicePtr,
+            bufferCastOrNull<SizeType32>(inputs->stopCriteriaInputs->sequenceLimitLength),
+            bufferCastOrNull<SizeType32>(outputs->sequenceLength), numNewTokens, workspace->getDeviceBatchSlotsPtr(),
+            decoderDomain.getBatchSize(), decoderDomain.getBeamWidth(), bufferManager.getStream().get());
+    }
+    if (!finishedSumIsOnGpu && finishedSumDevice != nullptr)
     {
         bufferManager.copy(*finishedSumDevice, *outputs->finishedSum.value());
     }
-    if (finishedPtr != nullptr)
+    if (!finishedIsOnGpu && finishedPtr != nullptr)
     {
         bufferManager.copy(*finishedDevice, *outputs->finished.value());
     }
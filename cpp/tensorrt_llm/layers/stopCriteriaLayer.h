@@ -50,7 +50,8 @@ public:
 private:
     static void checkMaxLengthStopCriteria(std::shared_ptr<BaseDecodingOutputs>& outputs,
         std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain,
-        runtime::BufferManager const& bufferManager, std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace);
+        runtime::SizeType32 maxDecodingTokens, runtime::BufferManager const& bufferManager,
+        std::shared_ptr<runtime::DecodingLayerWorkspace> const& workspace);
     static void checkStopWordsStopCriteria(std::shared_ptr<BaseDecodingOutputs>& outputs,
         std::shared_ptr<DecodingInputs> const& inputs, DecoderDomain const& decoderDomain,
         runtime::SizeType32 maxSeqLen, runtime::BufferManager const& bufferManager,
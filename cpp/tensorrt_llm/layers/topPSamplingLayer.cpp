@@ -16,6 +16,7 @@
  */
 
 #include "topPSamplingLayer.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/memoryUtils.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
@@ -77,6 +78,9 @@ void TopPSamplingLayer<T>::allocateBuffer(SizeType32 batchSize)
     mSkipDecodeHost = mBufferManager->pinnedPool(batchSizeShape, TRTDataType<bool>::value);
     auto skipDecodeHostRange = BufferRange<bool>(*mSkipDecodeHost);
     std::fill(skipDecodeHostRange.begin(), skipDecodeHostRange.end(), true);
+    mFullDistSamplingHost = mBufferManager->pinnedPool(batchSizeShape, TRTDataType<bool>::value);
+    auto fullDistSamplingHostRange = BufferRange<bool>(*mFullDistSamplingHost);
+    std::fill(fullDistSamplingHostRange.begin(), fullDistSamplingHostRange.end(), true);
 
     mSetupWorkspaceSize = std::max({mRuntimeTopKDevice->getSizeInBytes(), mRuntimeTopPDevice->getSizeInBytes(),
         mInitialTopPDevice->getSizeInBytes(), mTopPDecayDevice->getSizeInBytes(), mTopPMinDevice->getSizeInBytes(),
@@ -100,6 +104,7 @@ void TopPSamplingLayer<T>::setup(SizeType32 batchSize, SizeType32 beamWidth, Ten
 
     auto const* batchSlotsHostPtr = bufferCastOrNull<SizeType32>(batchSlots);
     auto* skipDecodeHostPtr = bufferCastOrNull<bool>(mSkipDecodeHost);
+    auto* fullDistSamplingHostPtr = bufferCastOrNull<bool>(mFullDistSamplingHost);
     if (!setupParams->runtimeTopP.has_value() || setupParams->runtimeTopP.value().empty())
     {
         // Fast path to disable TopP for slots
@@ -107,6 +112,8 @@ void TopPSamplingLayer<T>::setup(SizeType32 batchSize, SizeType32 beamWidth, Ten
         {
             auto const bid = batchSlotsHostPtr[bi];
             skipDecodeHostPtr[bid] = true;
+            // Skipped slots must not veto the full distribution fast path of the remaining slots
+            fullDistSamplingHostPtr[bid] = true;
         }
         auto const maxBatchSize = mDecoderDomain.getBatchSize();
         auto skipDecodeHostSlice = IBuffer::slice(mSkipDecodeHost, 0, maxBatchSize);
@@ -205,6 +212,19 @@ void TopPSamplingLayer<T>::setup(SizeType32 batchSize, SizeType32 beamWidth, Ten
         {topKsPtr, runtimeTopK.front(), nullptr}, {}, //
         skipDecodeHostPtr, nullptr, batchSlotsHostPtr, false);
 
+    // Slots whose top P covers the (almost) whole distribution can skip the sort/rejection kernels in
+    // forwardAsync and sample from the unsorted probs directly. Slots with an active top P decay leave
+    // the setup value during decoding, so they stay on the regular path. Slots skipped by this layer
+    // qualify trivially so they do not veto the batch-wide fast path.
+    auto const fullDistThreshold = getEnvTopPFullDistThreshold();
+    for (SizeType32 bi = 0; bi < batchSize; ++bi)
+    {
+        auto const i = paramsSize == 1 ? size_t{0} : static_cast<size_t>(bi);
+        auto const bid = batchSlotsHostPtr[bi];
+        fullDistSamplingHostPtr[bid]
+            = skipDecodeHostPtr[bid] || (runtimeTopP[i] >= fullDistThreshold && decayVec[i] >= 1.0f);
+    }
+
     if (mIsAirTopP)
     {
         auto smCnt = mDeviceProp.multiProcessorCount;
@@ -275,7 +295,16 @@ void TopPSamplingLayer<T>::forwardAsync(std::shared_ptr<BaseDecodingOutputs> con
     params.maxBatchSize = mDecoderDomain.getBatchSize();
     params.vocabSizePadded = mDecoderDomain.getVocabSizePadded();
 
-    if (!mIsAirTopP)
+    auto const useFullDistSampling = fullDistTopPSamplingSupported(params.vocabSizePadded)
+        && allOfBatchSlots(batchSlotsHost, bufferCastOrNull<bool>(mFullDistSamplingHost), batchSize, true);
+
+    if (useFullDistSampling)
+    {
+        // Every live slot samples the full distribution, so the sort (or rejection sampling) cost of the
+        // regular kernels can be skipped entirely.
+        invokeBatchFullDistTopPSampling<T>(params, getStream());
+    }
+    else if (!mIsAirTopP)
     {
         invokeBatchTopPSampling<T>(params, getStream());
     }
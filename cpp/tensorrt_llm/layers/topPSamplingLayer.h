@@ -44,6 +44,12 @@ public:
     //! @returns workspace needed for this layer in bytes
     [[nodiscard]] size_t getWorkspaceSize() const noexcept override;
 
+    //! @returns host tensor with per-slot skip flags; slots fully handled by the top-k layer are skipped here
+    [[nodiscard]] TensorConstPtr getSkipDecodeHost() const noexcept
+    {
+        return mSkipDecodeHost;
+    }
+
 protected:
     TensorPtr mRuntimeTopKDevice;
     TensorPtr mRuntimeTopPDevice;
@@ -54,6 +60,9 @@ protected:
 
     TensorPtr mSkipDecodeDevice;
     TensorPtr mSkipDecodeHost;
+    // Per-slot host flag set when sampling covers the full distribution, so forwardAsync can route
+    // the batch to the sort-free sampling kernel without consulting device memory
+    TensorPtr mFullDistSamplingHost;
     size_t mWorkspaceSize{0};
     size_t mSetupWorkspaceSize{0};
 
@@ -50,9 +50,11 @@ using namespace tensorrt_llm::batch_manager;
 void tensorrt_llm::nanobind::batch_manager::algorithms::initBindings(nb::module_& m)
 {
     nb::class_<CapacityScheduler>(m, CapacityScheduler::name)
-        .def(nb::init<SizeType32, executor::CapacitySchedulerPolicy, bool, bool, LlmRequestState, LlmRequestState>(),
+        .def(nb::init<SizeType32, executor::CapacitySchedulerPolicy, bool, bool, std::optional<float>, LlmRequestState,
+                 LlmRequestState>(),
             nb::arg("max_num_requests"), nb::arg("capacity_scheduler_policy"), nb::arg("has_kv_cache_manager"),
-            nb::arg("two_step_lookahead") = false, nb::arg("no_schedule_until_state") = LlmRequestState::kCONTEXT_INIT,
+            nb::arg("two_step_lookahead") = false, nb::arg("context_tokens_per_second") = nb::none(),
+            nb::arg("no_schedule_until_state") = LlmRequestState::kCONTEXT_INIT,
             nb::arg("no_schedule_after_state") = LlmRequestState::kGENERATION_COMPLETE)
         .def("__call__", &CapacityScheduler::operator(), nb::arg("active_requests"),
             nb::arg("kv_cache_manager") = nullptr, nb::arg("peft_cache_manager") = nullptr,
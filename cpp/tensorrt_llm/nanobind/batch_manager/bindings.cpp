@@ -298,7 +298,7 @@ void initBindings(nb::module_& m)
                     std::optional<tb::LlmRequest::TensorPtr> tensorPtr = std::nullopt;
                     if (atTensor)
                     {
-                        tensorPtr = tr::TorchView::of(atTensor.value());
+                        tensorPtr = tr::TorchView::aliasOrCopy(atTensor.value(), "LlmRequest");
                         if (unsqueeze)
                         {
                             (*tensorPtr)->unsqueeze(0);
@@ -16,33 +16,157 @@
  */
 
 #include "tensorrt_llm/nanobind/batch_manager/kvCacheConnector.h"
+#include "tensorrt_llm/nanobind/common/customCasters.h"
 
+#include <nanobind/stl/pair.h>
+#include <nanobind/stl/vector.h>
 #include <nanobind/trampoline.h>
 #include <torch/extension.h>
 
 namespace
 {
 using KvCacheConnectorManager = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorManager;
+using KvCacheConnectorWorker = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorWorker;
+using KvCacheConnectorScheduler = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorScheduler;
+using KvCacheConnectorMetrics = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorMetrics;
 
 namespace tb = tensorrt_llm::batch_manager;
+namespace tr = tensorrt_llm::runtime;
 
 class PyKvCacheConnectorManager : KvCacheConnectorManager
 {
 public:
-    NB_TRAMPOLINE(KvCacheConnectorManager, 1);
+    NB_TRAMPOLINE(KvCacheConnectorManager, 3);
 
     SizeType32 getNumNewMatchedTokens(tb::LlmRequest const& request, SizeType32 numComputedTokens) override
     {
         NB_OVERRIDE_PURE_NAME("get_num_new_matched_tokens", getNumNewMatchedTokens, request, numComputedTokens);
     }
+
+    std::vector<SizeType32> getNumNewMatchedTokens(
+        tb::RequestVector const& requests, std::vector<SizeType32> const& numComputedTokens) override
+    {
+        NB_OVERRIDE_NAME("get_num_new_matched_tokens_batched", getNumNewMatchedTokens, requests, numComputedTokens);
+    }
+
+    KvCacheConnectorMetrics getMetrics() const override
+    {
+        NB_OVERRIDE_NAME("get_metrics", getMetrics);
+    }
+};
+
+class PyKvCacheConnectorWorker : KvCacheConnectorWorker
+{
+public:
+    NB_TRAMPOLINE(KvCacheConnectorWorker, 8);
+
+    void registerKvCaches(std::vector<tr::ITensor::SharedPtr> const& pools) override
+    {
+        NB_OVERRIDE_PURE_NAME("register_kv_caches", registerKvCaches, pools);
+    }
+
+    void startLoadKv(CudaStreamPtr const& stream) override
+    {
+        NB_OVERRIDE_PURE_NAME("start_load_kv", startLoadKv, stream);
+    }
+
+    void waitForLayerLoad(SizeType32 layerIdx, CudaStreamPtr const& stream) override
+    {
+        NB_OVERRIDE_PURE_NAME("wait_for_layer_load", waitForLayerLoad, layerIdx, stream);
+    }
+
+    void saveKvLayer(SizeType32 layerIdx, CudaStreamPtr const& stream) override
+    {
+        NB_OVERRIDE_PURE_NAME("save_kv_layer", saveKvLayer, layerIdx, stream);
+    }
+
+    void waitForSave(CudaStreamPtr const& stream) override
+    {
+        NB_OVERRIDE_PURE_NAME("wait_for_save", waitForSave, stream);
+    }
+
+    bool canScheduleSave(SizeType32 numBlocks) override
+    {
+        NB_OVERRIDE_NAME("can_schedule_save", canScheduleSave, numBlocks);
+    }
+
+    std::pair<std::vector<RequestIdType>, std::vector<RequestIdType>> getFinished(
+        std::vector<RequestIdType> const& finishedGenReqIds,
+        std::vector<RequestIdType> const& startedLoadingReqIds) override
+    {
+        NB_OVERRIDE_PURE_NAME("get_finished", getFinished, finishedGenReqIds, startedLoadingReqIds);
+    }
+
+    KvCacheConnectorMetrics getMetrics() const override
+    {
+        NB_OVERRIDE_NAME("get_metrics", getMetrics);
+    }
+};
+
+class PyKvCacheConnectorScheduler : KvCacheConnectorScheduler
+{
+public:
+    NB_TRAMPOLINE(KvCacheConnectorScheduler, 3);
+
+    std::pair<SizeType32, bool> getNumNewMatchedTokens(tb::LlmRequest const& request, SizeType32 numComputedTokens) override
+    {
+        NB_OVERRIDE_PURE_NAME("get_num_new_matched_tokens", getNumNewMatchedTokens, request, numComputedTokens);
+    }
+
+    void updateStateAfterAlloc(tb::LlmRequest const& request, std::vector<SizeType32> const& blockIds) override
+    {
+        NB_OVERRIDE_PURE_NAME("update_state_after_alloc", updateStateAfterAlloc, request, blockIds);
+    }
+
+    bool requestFinished(tb::LlmRequest const& request, std::vector<SizeType32> const& cacheBlockIds) override
+    {
+        NB_OVERRIDE_PURE_NAME("request_finished", requestFinished, request, cacheBlockIds);
+    }
 };
 
 } // namespace
 
 void tensorrt_llm::batch_manager::kv_cache_manager::KVCacheManagerConnectorBindings::initBindings(nb::module_& m)
 {
+    nb::class_<KvCacheConnectorMetrics>(m, "KvCacheConnectorMetrics")
+        .def(nb::init<>())
+        .def_rw("num_lookups", &KvCacheConnectorMetrics::numLookups)
+        .def_rw("num_matched_tokens", &KvCacheConnectorMetrics::numMatchedTokens)
+        .def_rw("num_onboarded_blocks", &KvCacheConnectorMetrics::numOnboardedBlocks)
+        .def_rw("num_offloaded_blocks", &KvCacheConnectorMetrics::numOffloadedBlocks)
+        .def_rw("num_deferred_offloads", &KvCacheConnectorMetrics::numDeferredOffloads)
+        .def_rw("num_failed_transfers", &KvCacheConnectorMetrics::numFailedTransfers);
+
     nb::class_<tb::kv_connector::KvCacheConnectorManager, PyKvCacheConnectorManager>(m, "KvCacheConnectorManager")
         .def(nb::init<>())
-        .def("get_num_new_matched_tokens", &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens,
-            nb::arg("request"), nb::arg("num_computed_tokens"));
+        .def("get_num_new_matched_tokens",
+            nb::overload_cast<tb::LlmRequest const&, SizeType32>(
+                &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens),
+            nb::arg("request"), nb::arg("num_computed_tokens"))
+        .def("get_num_new_matched_tokens_batched",
+            nb::overload_cast<tb::RequestVector const&, std::vector<SizeType32> const&>(
+                &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens),
+            nb::arg("requests"), nb::arg("num_computed_tokens"))
+        .def("get_metrics", &tb::kv_connector::KvCacheConnectorManager::getMetrics);
+
+    nb::class_<KvCacheConnectorWorker, PyKvCacheConnectorWorker>(m, "KvCacheConnectorWorker")
+        .def(nb::init<>())
+        .def("register_kv_caches", &KvCacheConnectorWorker::registerKvCaches, nb::arg("pools"))
+        .def("start_load_kv", &KvCacheConnectorWorker::startLoadKv, nb::arg("stream"))
+        .def("wait_for_layer_load", &KvCacheConnectorWorker::waitForLayerLoad, nb::arg("layer_idx"), nb::arg("stream"))
+        .def("save_kv_layer", &KvCacheConnectorWorker::saveKvLayer, nb::arg("layer_idx"), nb::arg("stream"))
+        .def("wait_for_save", &KvCacheConnectorWorker::waitForSave, nb::arg("stream"))
+        .def("can_schedule_save", &KvCacheConnectorWorker::canScheduleSave, nb::arg("num_blocks"))
+        .def("get_finished", &KvCacheConnectorWorker::getFinished, nb::arg("finished_gen_req_ids"),
+            nb::arg("started_loading_req_ids"))
+        .def("get_metrics", &KvCacheConnectorWorker::getMetrics);
+
+    nb::class_<KvCacheConnectorScheduler, PyKvCacheConnectorScheduler>(m, "KvCacheConnectorScheduler")
+        .def(nb::init<>())
+        .def("get_num_new_matched_tokens", &KvCacheConnectorScheduler::getNumNewMatchedTokens, nb::arg("request"),
+            nb::arg("num_computed_tokens"))
+        .def("update_state_after_alloc", &KvCacheConnectorScheduler::updateStateAfterAlloc, nb::arg("request"),
+            nb::arg("block_ids"))
+        .def("request_finished", &KvCacheConnectorScheduler::requestFinished, nb::arg("request"),
+            nb::arg("cache_block_ids"));
 }
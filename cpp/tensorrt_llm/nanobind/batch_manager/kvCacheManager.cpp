@@ -59,7 +59,7 @@ std::optional<tensorrt_llm::runtime::ITensor::UniquePtr> from_torch(std::optiona
 {
     if (torchPtr)
     {
-        return tr::TorchView::of(torchPtr.value());
+        return tr::TorchView::aliasOrCopy(torchPtr.value(), "KVCacheManager");
     }
     return std::nullopt;
 }
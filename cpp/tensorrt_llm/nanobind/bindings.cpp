@@ -50,6 +50,7 @@
 #include "tensorrt_llm/runtime/gptJsonConfig.h"
 #include "tensorrt_llm/runtime/ipcNvlsMemory.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
+#include "tensorrt_llm/runtime/memoryProfiler.h"
 #include "tensorrt_llm/runtime/samplingConfig.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
@@ -487,6 +488,15 @@ NB_MODULE(TRTLLM_NB_MODULE, m)
         .def_prop_ro("pinned", &tr::MemoryCounters::getPinned)
         .def_prop_ro("uvm", &tr::MemoryCounters::getUVM);
 
+    nb::class_<tr::MemoryProfiler>(m, "MemoryProfiler")
+        .def_static("instance", &tr::MemoryProfiler::getInstance, nb::rv_policy::reference)
+        .def_static("is_enabled", &tr::MemoryProfiler::isEnabled)
+        .def_static("set_enabled", &tr::MemoryProfiler::setEnabled)
+        .def("to_pprof_profile", [](tr::MemoryProfiler const& self) { return self.toPprofProfile(); })
+        .def("write_profile",
+            [](tr::MemoryProfiler const& self, std::string const& path) { self.writeProfile(path); })
+        .def("reset", &tr::MemoryProfiler::reset);
+
     tensorrt_llm::nanobind::process_group::initBindings(mInternalProcessGroup);
     tensorrt_llm::nanobind::runtime::initBindings(mInternalRuntime);
     tensorrt_llm::nanobind::testing::initBindings(mInternalTesting);
@@ -196,6 +196,9 @@ void initBindings(nb::module_& m)
         .def_rw("reused_blocks_per_request", &tle::RequestStats::reusedBlocksPerRequest)
         .def_rw("missed_blocks_per_request", &tle::RequestStats::missedBlocksPerRequest)
         .def_rw("kv_cache_hit_rate_per_request", &tle::RequestStats::kvCacheHitRatePerRequest)
+        .def_rw("time_in_queue_ms", &tle::RequestStats::timeInQueueMS)
+        .def_rw("context_latency_ms", &tle::RequestStats::contextLatencyMS)
+        .def_rw("last_token_latencies_ms", &tle::RequestStats::lastTokenLatenciesMS)
         .def("to_json_str",
             [](tle::RequestStats const& iterationStats) { return tle::JsonSerialization::toJsonStr(iterationStats); });
 
@@ -243,6 +246,14 @@ void initBindings(nb::module_& m)
         .def_ro("window_size", &tle::KVCacheEvent::windowSize)
         .def_ro("attention_dp_rank", &tle::KVCacheEvent::attentionDpRank);
 
+    nb::class_<tle::KVCachePrefixDigest>(executor_kv_cache, "KVCachePrefixDigest")
+        .def_ro("num_bits", &tle::KVCachePrefixDigest::numBits)
+        .def_ro("num_hashes", &tle::KVCachePrefixDigest::numHashes)
+        .def_ro("version", &tle::KVCachePrefixDigest::version)
+        .def_prop_ro("bits",
+            [](tle::KVCachePrefixDigest const& self)
+            { return nb::bytes(reinterpret_cast<char const*>(self.bits.data()), self.bits.size()); });
+
     nb::class_<tle::KVCacheEventManager>(executor_kv_cache, "KVCacheEventManager")
         .def(
             "get_latest_events",
@@ -215,11 +215,14 @@ void Executor::initBindings(nb::module_& m)
             nb::arg("ids"), nb::arg("timeout") = nb::none())
         .def("get_num_responses_ready", &Executor::getNumResponsesReady, nb::arg("id") = nb::none())
         .def("cancel_request", &Executor::cancelRequest, nb::arg("id") = nb::none())
+        .def("drain", &Executor::drain)
         .def("get_latest_iteration_stats", &Executor::getLatestIterationStats)
         .def("get_latest_request_stats", &Executor::getLatestRequestStats)
         .def("get_latest_debug_tensors", &Executor::getLatestDebugTensors)
         .def("can_enqueue_requests", &Executor::canEnqueueRequests)
-        .def("get_kv_cache_event_manager", &Executor::getKVCacheEventManager);
+        .def("get_kv_cache_event_manager", &Executor::getKVCacheEventManager)
+        .def("get_kv_cache_prefix_digest", &Executor::getKVCachePrefixDigest)
+        .def("write_decoder_timing_trace", &Executor::writeDecoderTimingTrace, nb::arg("path"));
 }
 
 } // namespace tensorrt_llm::nanobind::executor
@@ -76,27 +76,30 @@ void initConfigBindings(nb::module_& m)
 
     auto schedulerConfigSetstate = [](tle::SchedulerConfig& self, nb::tuple const& state)
     {
-        if (state.size() != 3)
+        if (state.size() != 4)
         {
             throw std::runtime_error("Invalid state!");
         }
         new (&self) tle::SchedulerConfig(nb::cast<tle::CapacitySchedulerPolicy>(state[0]),
             nb::cast<std::optional<tle::ContextChunkingPolicy>>(state[1]),
-            nb::cast<std::optional<tle::DynamicBatchConfig>>(state[2]));
+            nb::cast<std::optional<tle::DynamicBatchConfig>>(state[2]),
+            nb::cast<std::optional<tle::FloatType>>(state[3]));
     };
     auto schedulerConfigGetstate = [](tle::SchedulerConfig const& self)
     {
-        return nb::make_tuple(
-            self.getCapacitySchedulerPolicy(), self.getContextChunkingPolicy(), self.getDynamicBatchConfig());
+        return nb::make_tuple(self.getCapacitySchedulerPolicy(), self.getContextChunkingPolicy(),
+            self.getDynamicBatchConfig(), self.getContextTokensPerSecond());
     };
     nb::class_<tle::SchedulerConfig>(m, "SchedulerConfig")
         .def(nb::init<tle::CapacitySchedulerPolicy, std::optional<tle::ContextChunkingPolicy>,
-                 std::optional<tle::DynamicBatchConfig>>(),
+                 std::optional<tle::DynamicBatchConfig>, std::optional<tle::FloatType>>(),
             nb::arg("capacity_scheduler_policy") = tle::CapacitySchedulerPolicy::kGUARANTEED_NO_EVICT,
-            nb::arg("context_chunking_policy") = nb::none(), nb::arg("dynamic_batch_config") = nb::none())
+            nb::arg("context_chunking_policy") = nb::none(), nb::arg("dynamic_batch_config") = nb::none(),
+            nb::arg("context_tokens_per_second") = nb::none())
         .def_prop_ro("capacity_scheduler_policy", &tle::SchedulerConfig::getCapacitySchedulerPolicy)
         .def_prop_ro("context_chunking_policy", &tle::SchedulerConfig::getContextChunkingPolicy)
         .def_prop_ro("dynamic_batch_config", &tle::SchedulerConfig::getDynamicBatchConfig)
+        .def_prop_ro("context_tokens_per_second", &tle::SchedulerConfig::getContextTokensPerSecond)
         .def("__getstate__", schedulerConfigGetstate)
         .def("__setstate__", schedulerConfigSetstate);
 
@@ -379,19 +382,20 @@ void initConfigBindings(nb::module_& m)
         .def("__getstate__", extendedRuntimePerfKnobConfigGetstate)
         .def("__setstate__", extendedRuntimePerfKnobConfigSetstate);
 
-    auto SpeculativeDecodingConfigGetState
-        = [](tle::SpeculativeDecodingConfig const& self) { return nb::make_tuple(self.fastLogits); };
+    auto SpeculativeDecodingConfigGetState = [](tle::SpeculativeDecodingConfig const& self)
+    { return nb::make_tuple(self.fastLogits, self.dynamicDraftLen); };
     auto SpeculativeDecodingConfigSetState = [](tle::SpeculativeDecodingConfig& self, nb::tuple const& state)
     {
-        if (state.size() != 1)
+        if (state.size() != 2)
         {
             throw std::runtime_error("Invalid SpeculativeDecodingConfig state!");
         }
-        new (&self) tle::SpeculativeDecodingConfig(nb::cast<bool>(state[0]));
+        new (&self) tle::SpeculativeDecodingConfig(nb::cast<bool>(state[0]), nb::cast<bool>(state[1]));
     };
     nb::class_<tle::SpeculativeDecodingConfig>(m, "SpeculativeDecodingConfig")
-        .def(nb::init<bool>(), nb::arg("fast_logits") = false)
+        .def(nb::init<bool, bool>(), nb::arg("fast_logits") = false, nb::arg("dynamic_draft_len") = false)
         .def_rw("fast_logits", &tle::SpeculativeDecodingConfig::fastLogits)
+        .def_rw("dynamic_draft_len", &tle::SpeculativeDecodingConfig::dynamicDraftLen)
         .def("__getstate__", SpeculativeDecodingConfigGetState)
         .def("__setstate__", SpeculativeDecodingConfigSetState);
 
@@ -198,17 +198,19 @@ void initRequestBindings(nb::module_& m)
     auto outputConfigGetstate = [](tle::OutputConfig const& self)
     {
         return nb::make_tuple(self.returnLogProbs, self.returnContextLogits, self.returnGenerationLogits,
-            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs);
+            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs,
+            self.returnDeltaLogProbs, self.topKLogits, self.packedLogProbs);
     };
     auto outputConfigSetstate = [](tle::OutputConfig& outputConfig, nb::tuple const& state)
     {
-        if (state.size() != 7)
+        if (state.size() != 10)
         {
             throw std::runtime_error("Invalid OutputConfig state!");
         }
         new (&outputConfig) tle::OutputConfig(nb::cast<bool>(state[0]), nb::cast<bool>(state[1]),
             nb::cast<bool>(state[2]), nb::cast<bool>(state[3]), nb::cast<bool>(state[4]), nb::cast<bool>(state[5]),
-            nb::cast<std::optional<std::vector<tle::AdditionalModelOutput>>>(state[6]));
+            nb::cast<std::optional<std::vector<tle::AdditionalModelOutput>>>(state[6]), nb::cast<bool>(state[7]),
+            nb::cast<std::optional<SizeType32>>(state[8]), nb::cast<bool>(state[9]));
     };
     nb::class_<tle::OutputConfig>(m, "OutputConfig")
         .def(
@@ -216,17 +218,21 @@ void initRequestBindings(nb::module_& m)
             [](tle::OutputConfig& self, std::optional<bool> return_log_probs, std::optional<bool> return_context_logits,
                 std::optional<bool> return_generation_logits, std::optional<bool> exclude_input_from_output,
                 std::optional<bool> return_encoder_output, std::optional<bool> return_perf_metrics,
-                std::optional<std::vector<tle::AdditionalModelOutput>> additional_model_outputs)
+                std::optional<std::vector<tle::AdditionalModelOutput>> additional_model_outputs,
+                std::optional<bool> return_delta_log_probs, std::optional<SizeType32> top_k_logits,
+                std::optional<bool> packed_log_probs)
             {
                 new (&self) tle::OutputConfig(return_log_probs.value_or(false), return_context_logits.value_or(false),
                     return_generation_logits.value_or(false), exclude_input_from_output.value_or(false),
                     return_encoder_output.value_or(false), return_perf_metrics.value_or(false),
-                    additional_model_outputs);
+                    additional_model_outputs, return_delta_log_probs.value_or(false), top_k_logits,
+                    packed_log_probs.value_or(false));
             },
             nb::arg("return_log_probs") = nb::none(), nb::arg("return_context_logits") = nb::none(),
             nb::arg("return_generation_logits") = nb::none(), nb::arg("exclude_input_from_output") = nb::none(),
             nb::arg("return_encoder_output") = nb::none(), nb::arg("return_perf_metrics") = nb::none(),
-            nb::arg("additional_model_outputs") = nb::none())
+            nb::arg("additional_model_outputs") = nb::none(), nb::arg("return_delta_log_probs") = nb::none(),
+            nb::arg("top_k_logits") = nb::none(), nb::arg("packed_log_probs") = nb::none())
         .def_rw("return_log_probs", &tle::OutputConfig::returnLogProbs)
         .def_rw("return_context_logits", &tle::OutputConfig::returnContextLogits)
         .def_rw("return_generation_logits", &tle::OutputConfig::returnGenerationLogits)
@@ -234,6 +240,9 @@ void initRequestBindings(nb::module_& m)
         .def_rw("return_encoder_output", &tle::OutputConfig::returnEncoderOutput)
         .def_rw("return_perf_metrics", &tle::OutputConfig::returnPerfMetrics)
         .def_rw("additional_model_outputs", &tle::OutputConfig::additionalModelOutputs)
+        .def_rw("return_delta_log_probs", &tle::OutputConfig::returnDeltaLogProbs)
+        .def_rw("top_k_logits", &tle::OutputConfig::topKLogits)
+        .def_rw("packed_log_probs", &tle::OutputConfig::packedLogProbs)
         .def("__getstate__", outputConfigGetstate)
         .def("__setstate__", outputConfigSetstate);
 
@@ -336,24 +345,27 @@ void initRequestBindings(nb::module_& m)
         .def("__getstate__", MropeConfigGetstate)
         .def("__setstate__", MropeConfigSetstate);
 
-    auto lookaheadDecodingConfigGetstate = [](tle::LookaheadDecodingConfig const& self)
-    { return nb::make_tuple(self.getWindowSize(), self.getNgramSize(), self.getVerificationSetSize()); };
+    auto lookaheadDecodingConfigGetstate = [](tle::LookaheadDecodingConfig const& self) {
+        return nb::make_tuple(
+            self.getWindowSize(), self.getNgramSize(), self.getVerificationSetSize(), self.getUsePoolCache());
+    };
     auto lookaheadDecodingConfigSetstate
         = [](tle::LookaheadDecodingConfig& lookaheadDecodingConfig, nb::tuple const& state)
     {
-        if (state.size() != 3)
+        if (state.size() != 4)
         {
             throw std::runtime_error("Invalid LookaheadDecodingConfig state!");
         }
-        new (&lookaheadDecodingConfig) tle::LookaheadDecodingConfig(
-            nb::cast<SizeType32>(state[0]), nb::cast<SizeType32>(state[1]), nb::cast<SizeType32>(state[2]));
+        new (&lookaheadDecodingConfig) tle::LookaheadDecodingConfig(nb::cast<SizeType32>(state[0]),
+            nb::cast<SizeType32>(state[1]), nb::cast<SizeType32>(state[2]), nb::cast<bool>(state[3]));
     };
     nb::class_<tle::LookaheadDecodingConfig>(m, "LookaheadDecodingConfig")
-        .def(nb::init<SizeType32, SizeType32, SizeType32>(), nb::arg("max_window_size"), nb::arg("max_ngram_size"),
-            nb::arg("max_verification_set_size"))
+        .def(nb::init<SizeType32, SizeType32, SizeType32, bool>(), nb::arg("max_window_size"),
+            nb::arg("max_ngram_size"), nb::arg("max_verification_set_size"), nb::arg("use_pool_cache") = false)
         .def_prop_ro("max_window_size", &tle::LookaheadDecodingConfig::getWindowSize)
         .def_prop_ro("max_ngram_size", &tle::LookaheadDecodingConfig::getNgramSize)
         .def_prop_ro("max_verification_set_size", &tle::LookaheadDecodingConfig::getVerificationSetSize)
+        .def_prop_ro("use_pool_cache", &tle::LookaheadDecodingConfig::getUsePoolCache)
         .def("calculate_speculative_resource", &tle::LookaheadDecodingConfig::calculateSpeculativeResource)
         .def_static(
             "calculate_speculative_resource_tuple", &tle::LookaheadDecodingConfig::calculateSpeculativeResourceTuple)
@@ -382,19 +394,20 @@ void initRequestBindings(nb::module_& m)
     auto kvCacheRetentionConfigGetstate = [](tle::KvCacheRetentionConfig const& self)
     {
         return nb::make_tuple(self.getTokenRangeRetentionConfigs(), self.getDecodeRetentionPriority(),
-            self.getDecodeDurationMs(), self.getTransferMode(), self.getDirectory());
+            self.getDecodeDurationMs(), self.getTransferMode(), self.getDirectory(), self.getAttentionSinkTokenCount());
     };
     auto kvCacheRetentionConfigSetstate
         = [](tle::KvCacheRetentionConfig& kvCacheRetentionConfig, nb::tuple const& state)
     {
-        if (state.size() != 5)
+        if (state.size() != 6)
         {
             throw std::runtime_error("Invalid state!");
         }
         new (&kvCacheRetentionConfig) tle::KvCacheRetentionConfig(
             nb::cast<std::vector<tle::KvCacheRetentionConfig::TokenRangeRetentionConfig>>(state[0]),
             nb::cast<tle::RetentionPriority>(state[1]), nb::cast<std::optional<std::chrono::milliseconds>>(state[2]),
-            nb::cast<tle::KvCacheTransferMode>(state[3]), nb::cast<std::string>(state[4]));
+            nb::cast<tle::KvCacheTransferMode>(state[3]), nb::cast<std::string>(state[4]),
+            nb::cast<std::optional<SizeType32>>(state[5]));
     };
 
     auto kvCacheRetentionConfig = nb::class_<tle::KvCacheRetentionConfig>(m, "KvCacheRetentionConfig");
@@ -417,16 +430,18 @@ void initRequestBindings(nb::module_& m)
     // TokenRangeRetentionPriority bindings have been defined.
     kvCacheRetentionConfig
         .def(nb::init<std::vector<tle::KvCacheRetentionConfig::TokenRangeRetentionConfig>, tle::RetentionPriority,
-                 std::optional<std::chrono::milliseconds>, tle::KvCacheTransferMode, std::string>(),
+                 std::optional<std::chrono::milliseconds>, tle::KvCacheTransferMode, std::string,
+                 std::optional<SizeType32>>(),
             nb::arg("token_range_retention_configs"),
             nb::arg("decode_retention_priority") = tle::KvCacheRetentionConfig::kDefaultRetentionPriority,
             nb::arg("decode_duration_ms") = nb::none(), nb::arg("transfer_mode") = tle::KvCacheTransferMode::DRAM,
-            nb::arg("directory") = nb::none())
+            nb::arg("directory") = nb::none(), nb::arg("attention_sink_token_count") = nb::none())
         .def_prop_ro("token_range_retention_configs", &tle::KvCacheRetentionConfig::getTokenRangeRetentionConfigs)
         .def_prop_ro("decode_retention_priority", &tle::KvCacheRetentionConfig::getDecodeRetentionPriority)
         .def_prop_ro("decode_duration_ms", &tle::KvCacheRetentionConfig::getDecodeDurationMs)
         .def_prop_ro("transfer_mode", &tle::KvCacheRetentionConfig::getTransferMode)
         .def_prop_ro("directory", &tle::KvCacheRetentionConfig::getDirectory)
+        .def_prop_ro("attention_sink_token_count", &tle::KvCacheRetentionConfig::getAttentionSinkTokenCount)
         .def("__getstate__", kvCacheRetentionConfigGetstate)
         .def("__setstate__", kvCacheRetentionConfigSetstate)
         .def("__eq__", &tle::KvCacheRetentionConfig::operator==);
@@ -904,6 +919,9 @@ void initRequestBindings(nb::module_& m)
         .def_rw("context_phase_params", &tle::Result::contextPhaseParams, nb::arg("context_phase_params").none())
         .def_rw("request_perf_metrics", &tle::Result::requestPerfMetrics, nb::arg("request_perf_metrics").none())
         .def_rw("additional_outputs", &tle::Result::additionalOutputs)
+        .def_rw("log_probs_offset", &tle::Result::logProbsOffset, nb::arg("log_probs_offset").none())
+        .def_rw("generation_logits_top_k_indices", &tle::Result::generationLogitsTopKIndices,
+            nb::arg("generation_logits_top_k_indices").none())
         .def("__getstate__", resultGetstate)
         .def("__setstate__", resultSetstate);
 
@@ -87,6 +87,10 @@ void initMoeBindings(nb::module_& m)
         .def("add_single_host_weight", &tr::SingleLayerMoeLoadBalancer::addSingleHostWeight, nb::arg("expert_id"),
             nb::arg("name"), nb::arg("host_weight"), "Add a single host weight for a specific expert ID",
             nb::call_guard<nb::gil_scoped_release>())
+        .def("add_single_cold_host_weight", &tr::SingleLayerMoeLoadBalancer::addSingleColdHostWeight,
+            nb::arg("expert_id"), nb::arg("name"), nb::arg("file_path"), nb::arg("file_offset"), nb::arg("shape"),
+            "Add a single NVMe resident host weight for a specific expert ID",
+            nb::call_guard<nb::gil_scoped_release>())
         .def("set_initial_weight_assignments", &tr::SingleLayerMoeLoadBalancer::setInitialWeightAssignments,
             nb::arg("initial_weight_assignments"), "Set initial weight assignments for each slot",
             nb::call_guard<nb::gil_scoped_release>())
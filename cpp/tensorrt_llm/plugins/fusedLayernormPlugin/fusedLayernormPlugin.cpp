@@ -29,12 +29,19 @@ static char const* FUSED_LAYERNORM_PLUGIN_NAME{"FusedLayernorm"};
 PluginFieldCollection FusedLayernormPluginCreator::mFC{};
 std::vector<nvinfer1::PluginField> FusedLayernormPluginCreator::mPluginAttributes;
 
-FusedLayernormPlugin::FusedLayernormPlugin(float eps, bool needFP32Output, bool needQuantize, nvinfer1::DataType type)
+FusedLayernormPlugin::FusedLayernormPlugin(float eps, bool needFP32Output, bool needQuantize, float softcapScale,
+    bool postNorm, float postScale, nvinfer1::DataType type)
     : mEps(eps)
     , mNeedFP32Output(needFP32Output)
     , mNeedQuantize(needQuantize)
+    , mSoftcapScale(softcapScale)
+    , mPostNorm(postNorm)
+    , mPostScale(postScale)
     , mType(type)
 {
+    TLLM_CHECK_WITH_INFO(
+        !(mNeedQuantize && (mSoftcapScale != 0.f || mPostNorm || mPostScale != 1.f)),
+        "The fused epilogue stages are not supported together with FP4 quantization.");
 }
 
 // Parameterized constructor
@@ -44,6 +51,9 @@ FusedLayernormPlugin::FusedLayernormPlugin(void const* data, size_t length)
     read(d, mEps);
     read(d, mNeedFP32Output);
     read(d, mNeedQuantize);
+    read(d, mSoftcapScale);
+    read(d, mPostNorm);
+    read(d, mPostScale);
     read(d, mType);
     TLLM_CHECK_WITH_INFO(d == a + length,
         "Expected length (%d) != real length (%d). This is often "
@@ -55,7 +65,8 @@ FusedLayernormPlugin::FusedLayernormPlugin(void const* data, size_t length)
 // IPluginV2DynamicExt Methods
 nvinfer1::IPluginV2DynamicExt* FusedLayernormPlugin::clone() const noexcept
 {
-    auto* plugin = new FusedLayernormPlugin(mEps, mNeedFP32Output, mNeedQuantize, mType);
+    auto* plugin
+        = new FusedLayernormPlugin(mEps, mNeedFP32Output, mNeedQuantize, mSoftcapScale, mPostNorm, mPostScale, mType);
     plugin->setPluginNamespace(mNamespace.c_str());
     return plugin;
 }
@@ -168,7 +179,8 @@ int FusedLayernormPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc,
     //     scale [1, ] - if needQuantize
     // outputs
     //     output [M(*), N] - fp4 padded to int64 / fp16
-    //     un-normed output [M(*), N] - fp16
+    //     un-normed output [M(*), N] - fp16; left untouched in post-norm mode, where the residual
+    //                                  stream is already materialized by the producer
     //     act_per_block_scale - fp8 padded to int32 - if needQuantize
 
 #define SETUP_PARAM                                                                                                    \
@@ -196,6 +208,36 @@ int FusedLayernormPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc,
     param.output = reinterpret_cast<Input*>(outputs[1]);                                                               \
     param.sf_out = reinterpret_cast<uint32_t*>(outputs[2]);
 
+// The epilogue param carries the fp16/bf16 normed output together with the optional epilogue
+// stages; stages left at their defaults degenerate to a plain normed store, so this path also
+// serves the un-quantized plugin without any epilogue feature enabled.
+#define SETUP_EPILOGUE_PARAM                                                                                           \
+    Param param;                                                                                                       \
+    int64_t m64 = 1;                                                                                                   \
+    for (int i = 0; i < inputDesc[0].dims.nbDims - 1; ++i)                                                             \
+    {                                                                                                                  \
+        m64 *= inputDesc[0].dims.d[i];                                                                                 \
+    }                                                                                                                  \
+    param.m = TLLM_INT32_CAST(m64);                                                                                    \
+    param.n = TLLM_INT32_CAST(inputDesc[2].dims.d[0]);                                                                 \
+    param.layernorm_eps = mEps;                                                                                        \
+    param.input = const_cast<Input*>(reinterpret_cast<Input const*>(inputs[0]));                                       \
+    if (mPostNorm)                                                                                                     \
+    {                                                                                                                  \
+        param.post_residual = reinterpret_cast<Input const*>(inputs[1]);                                               \
+    }                                                                                                                  \
+    else                                                                                                               \
+    {                                                                                                                  \
+        param.residual = reinterpret_cast<Input const*>(inputs[1]);                                                    \
+    }                                                                                                                  \
+    param.gamma = reinterpret_cast<Input const*>(inputs[2]);                                                           \
+    param.softcap_scale = mSoftcapScale;                                                                               \
+    param.post_scale = mPostScale;                                                                                     \
+    param.counters = reinterpret_cast<WarpSpecializedCounters*>(workspace);                                            \
+    param.stream = stream;                                                                                             \
+    param.normed_output = reinterpret_cast<Input*>(outputs[0]);                                                        \
+    param.output = reinterpret_cast<Input*>(outputs[1]);
+
 #define CLEANUP_AND_INVOKE                                                                                             \
     TLLM_CUDA_CHECK(cudaMemsetAsync(workspace, 0, sizeof(WarpSpecializedCounters), stream));                           \
     invokeWSLayerNorm(param, true, num_sms);
@@ -205,17 +247,35 @@ int FusedLayernormPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc,
     if (mType == DataType::kHALF)
     {
         using Input = half;
-        using Param = WarpSpecializedParam<GeneralFP4AddBiasResidualPreLayerNormParam<Input>>;
-        SETUP_PARAM
-        CLEANUP_AND_INVOKE
+        if (mNeedQuantize)
+        {
+            using Param = WarpSpecializedParam<GeneralFP4AddBiasResidualPreLayerNormParam<Input>>;
+            SETUP_PARAM
+            CLEANUP_AND_INVOKE
+        }
+        else
+        {
+            using Param = WarpSpecializedParam<GeneralFusedEpilogueLayerNormParam<Input>>;
+            SETUP_EPILOGUE_PARAM
+            CLEANUP_AND_INVOKE
+        }
     }
 #ifdef ENABLE_BF16
     else if (mType == DataType::kBF16)
     {
         using Input = __nv_bfloat16;
-        using Param = WarpSpecializedParam<GeneralFP4AddBiasResidualPreLayerNormParam<Input>>;
-        SETUP_PARAM
-        CLEANUP_AND_INVOKE
+        if (mNeedQuantize)
+        {
+            using Param = WarpSpecializedParam<GeneralFP4AddBiasResidualPreLayerNormParam<Input>>;
+            SETUP_PARAM
+            CLEANUP_AND_INVOKE
+        }
+        else
+        {
+            using Param = WarpSpecializedParam<GeneralFusedEpilogueLayerNormParam<Input>>;
+            SETUP_EPILOGUE_PARAM
+            CLEANUP_AND_INVOKE
+        }
     }
 #endif
     else
@@ -276,7 +336,8 @@ void FusedLayernormPlugin::terminate() noexcept {}
 
 size_t FusedLayernormPlugin::getSerializationSize() const noexcept
 {
-    return sizeof(mEps) + sizeof(mNeedFP32Output) + sizeof(mNeedQuantize) + sizeof(mType);
+    return sizeof(mEps) + sizeof(mNeedFP32Output) + sizeof(mNeedQuantize) + sizeof(mSoftcapScale) + sizeof(mPostNorm)
+        + sizeof(mPostScale) + sizeof(mType);
 }
 
 void FusedLayernormPlugin::serialize(void* buffer) const noexcept
@@ -285,6 +346,9 @@ void FusedLayernormPlugin::serialize(void* buffer) const noexcept
     write(d, mEps);
     write(d, mNeedFP32Output);
     write(d, mNeedQuantize);
+    write(d, mSoftcapScale);
+    write(d, mPostNorm);
+    write(d, mPostScale);
     write(d, mType);
     TLLM_CHECK(d == a + getSerializationSize());
 }
@@ -304,6 +368,9 @@ FusedLayernormPluginCreator::FusedLayernormPluginCreator()
     mPluginAttributes.emplace_back(PluginField("eps", nullptr, PluginFieldType::kFLOAT32));
     mPluginAttributes.emplace_back(PluginField("need_fp32_output", nullptr, PluginFieldType::kINT32));
     mPluginAttributes.emplace_back(PluginField("need_quantize", nullptr, PluginFieldType::kINT32));
+    mPluginAttributes.emplace_back(PluginField("softcap_scale", nullptr, PluginFieldType::kFLOAT32));
+    mPluginAttributes.emplace_back(PluginField("post_norm", nullptr, PluginFieldType::kINT32));
+    mPluginAttributes.emplace_back(PluginField("post_scale", nullptr, PluginFieldType::kFLOAT32));
     mPluginAttributes.emplace_back(PluginField("type_id", nullptr, PluginFieldType::kINT32));
     mFC.nbFields = mPluginAttributes.size();
     mFC.fields = mPluginAttributes.data();
@@ -331,6 +398,9 @@ IPluginV2* FusedLayernormPluginCreator::createPlugin(char const* name, PluginFie
     nvinfer1::DataType type{};
     bool needFP32Output{};
     bool needQuantize{};
+    float softcapScale{0.f};
+    bool postNorm{false};
+    float postScale{1.f};
     // Read configurations from each fields
     for (int i = 0; i < fc->nbFields; ++i)
     {
@@ -355,10 +425,25 @@ IPluginV2* FusedLayernormPluginCreator::createPlugin(char const* name, PluginFie
             TLLM_CHECK(fields[i].type == PluginFieldType::kINT32);
             needQuantize = static_cast<bool>(*(static_cast<bool const*>(fields[i].data)));
         }
+        else if (!strcmp(attrName, "softcap_scale"))
+        {
+            TLLM_CHECK(fields[i].type == PluginFieldType::kFLOAT32);
+            softcapScale = static_cast<float>(*(static_cast<float const*>(fields[i].data)));
+        }
+        else if (!strcmp(attrName, "post_norm"))
+        {
+            TLLM_CHECK(fields[i].type == PluginFieldType::kINT32);
+            postNorm = static_cast<bool>(*(static_cast<bool const*>(fields[i].data)));
+        }
+        else if (!strcmp(attrName, "post_scale"))
+        {
+            TLLM_CHECK(fields[i].type == PluginFieldType::kFLOAT32);
+            postScale = static_cast<float>(*(static_cast<float const*>(fields[i].data)));
+        }
     }
     try
     {
-        auto* obj = new FusedLayernormPlugin(eps, needFP32Output, needQuantize, type);
+        auto* obj = new FusedLayernormPlugin(eps, needFP32Output, needQuantize, softcapScale, postNorm, postScale, type);
         obj->setPluginNamespace(mNamespace.c_str());
         return obj;
     }
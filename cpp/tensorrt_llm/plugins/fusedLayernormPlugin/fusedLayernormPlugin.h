@@ -32,7 +32,8 @@ class FusedLayernormPlugin : public BasePlugin
 public:
     FusedLayernormPlugin() = delete;
 
-    FusedLayernormPlugin(float eps, bool needFP32Output, bool needQuantize, nvinfer1::DataType type);
+    FusedLayernormPlugin(float eps, bool needFP32Output, bool needQuantize, float softcapScale, bool postNorm,
+        float postScale, nvinfer1::DataType type);
 
     FusedLayernormPlugin(void const* data, size_t length);
 
@@ -69,6 +70,9 @@ private:
     float mEps;
     bool mNeedFP32Output;
     bool mNeedQuantize;
+    float mSoftcapScale; // 0 disables soft-capping.
+    bool mPostNorm;      // Residual joins after the norm (Gemma-2 post-norm ordering).
+    float mPostScale;    // Scalar applied after the norm; 1 disables.
     nvinfer1::DataType mType;
 
     const std::string mLayerName;
@@ -327,8 +327,8 @@ bool GemmAllReducePlugin::supportsFormatCombination(
     case TensorArg::IN_WEIGHT: return typeExists(desc.type, std::integral_constant<size_t, 1>{});
     case TensorArg::IN_ACTIVATION_SF:
     case TensorArg::IN_WEIGHT_SF:
-        // Assumed SF for only FP4 at the moment
-        return desc.type == DataType::kFP8;
+        // FP4 uses UE4M3 block scale factors, FP8 uses float rowwise scale vectors
+        return mOptions.typeA == DataType::kFP8 ? desc.type == DataType::kFLOAT : desc.type == DataType::kFP8;
     case TensorArg::IN_ALPHA: return desc.type == DataType::kFLOAT;
     case TensorArg::OUT_D_UC:
     case TensorArg::OUT_D_MC:
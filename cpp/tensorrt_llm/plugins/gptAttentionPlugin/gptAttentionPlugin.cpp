@@ -1049,7 +1049,11 @@ int GPTAttentionPlugin::enqueueSome(int32_t seqIdxBeg, int32_t localNbSeq, int32
         enqueue_params.host_block_offsets = host_block_offsets;
         enqueue_params.batch_size = batch_size;
         enqueue_params.mrope_rotary_cos_sin = mrope_rotary_cos_sin;
-        enqueue_params.total_kv_len = enqueue_params.num_tokens;
+        // Sum of the kv lengths of the batch; equals num_tokens exactly when no request has cached
+        // history, which lets enqueueContext pick the packed-QKV FMHA path.
+        enqueue_params.total_kv_len = useKVCache()
+            ? std::accumulate(host_past_kv_len_list, host_past_kv_len_list + batch_size, 0)
+            : enqueue_params.num_tokens;
 
         if (isCrossAttention())
         {
@@ -32,9 +32,10 @@ static char const* LOOKUP_PLUGIN_NAME{"Lookup"};
 PluginFieldCollection LookupPluginCreator::mFC{};
 std::vector<nvinfer1::PluginField> LookupPluginCreator::mPluginAttributes;
 
-LookupPlugin::LookupPlugin(nvinfer1::DataType type, int rank)
+LookupPlugin::LookupPlugin(nvinfer1::DataType type, int rank, int vocabSize)
     : mType(type)
     , mRank(rank)
+    , mVocabSize(vocabSize)
 {
     mArch = tensorrt_llm::common::getSMVersion();
 }
@@ -46,6 +47,7 @@ LookupPlugin::LookupPlugin(void const* data, size_t length)
     char const *d = reinterpret_cast<char const*>(data), *a = d;
     read(d, mType);
     read(d, mRank);
+    read(d, mVocabSize);
     TLLM_CHECK_WITH_INFO(d == a + length,
         "Expected length (%d) != real length (%d). This is often "
         "caused by using different TensorRT LLM version to build "
@@ -67,7 +69,7 @@ nvinfer1::DimsExprs LookupPlugin::getOutputDimensions(
 {
     try
     {
-        TLLM_CHECK(nbInputs == 2 || nbInputs == 3);
+        TLLM_CHECK(nbInputs >= 2 && nbInputs <= 5);
         TLLM_CHECK(outputIndex == 0);
         DimsExprs ret;
         int const nbDimsInput = inputs[0].nbDims;
@@ -92,35 +94,47 @@ nvinfer1::DimsExprs LookupPlugin::getOutputDimensions(
 bool LookupPlugin::supportsFormatCombination(
     int pos, nvinfer1::PluginTensorDesc const* inOut, int nbInputs, int nbOutputs) noexcept
 {
-    bool res = false;
-    if (nbInputs == 2)
+    if (inOut[pos].format != TensorFormat::kLINEAR)
     {
-        switch (pos)
-        {
-        case 0: res = ((inOut[0].type == DataType::kINT32) && (inOut[0].format == TensorFormat::kLINEAR)); break;
-        case 1: res = ((inOut[1].type == mType) && (inOut[1].format == TensorFormat::kLINEAR)); break;
-        case 2: res = ((inOut[2].type == mType) && (inOut[2].format == TensorFormat::kLINEAR)); break;
-        default: // should NOT be here!
-            res = false;
-        }
+        return false;
     }
-    else
+
+    // Optional trailing prompt-tuning inputs: [..., promptTable, tasks]
+    int const nbPromptInputs = withPromptTuning() ? 2 : 0;
+    bool const hasScales = (nbInputs - nbPromptInputs) == 3;
+
+    if (pos == 0)
     {
-        TLLM_CHECK_WITH_INFO(mArch == 90, "int8 weight only lookupPlugin is only supported in SM 90 now.");
-        switch (pos)
+        // input ids
+        return inOut[0].type == DataType::kINT32;
+    }
+    if (pos == 1)
+    {
+        // weight, possibly quantized when per-token scales are supplied
+        if (hasScales && inOut[1].type == DataType::kINT8)
         {
-        case 0: res = ((inOut[0].type == DataType::kINT32) && (inOut[0].format == TensorFormat::kLINEAR)); break;
-        case 1:
-            res = ((inOut[1].type == DataType::kINT8 || inOut[1].type == mType)
-                && (inOut[1].format == TensorFormat::kLINEAR));
-            break;
-        case 2: res = ((inOut[2].type == mType) && (inOut[2].format == TensorFormat::kLINEAR)); break;
-        case 3: res = ((inOut[3].type == mType) && (inOut[3].format == TensorFormat::kLINEAR)); break;
-        default: // should NOT be here!
-            res = false;
+            TLLM_CHECK_WITH_INFO(mArch == 90, "int8 weight only lookupPlugin is only supported in SM 90 now.");
+            return true;
         }
+        if (hasScales && inOut[1].type == DataType::kFP8)
+        {
+            TLLM_CHECK_WITH_INFO(mArch >= 89, "fp8 weight only lookupPlugin is only supported in SM 89 and later.");
+            return true;
+        }
+        return inOut[1].type == mType;
+    }
+    if (hasScales && pos == 2)
+    {
+        // per-token scales
+        return inOut[2].type == mType;
+    }
+    if (withPromptTuning() && pos == nbInputs - 1)
+    {
+        // per-token task row offsets
+        return inOut[pos].type == DataType::kINT32;
     }
-    return res;
+    // prompt table (pos == nbInputs - 2) and output are in the activation type
+    return inOut[pos].type == mType;
 }
 
 void LookupPlugin::configurePlugin(nvinfer1::DynamicPluginTensorDesc const* in, int nbInputs,
@@ -135,13 +149,35 @@ size_t LookupPlugin::getWorkspaceSize(nvinfer1::PluginTensorDesc const* inputs,
     return 0;
 }
 
+namespace
+{
+template <typename Tout, typename Tin>
+void runLookup(Tout* output, int const* input, Tin const* weight, Tout const* perTokenScales,
+    Tout const* promptWeight, int const* tasks, int64_t tokenNum, int offset, int localVocabSize, int vocabSize,
+    int hidden, cudaStream_t stream)
+{
+    if (tasks != nullptr)
+    {
+        invokeFusedLookUp<Tout, Tin, int>(output, input, weight, promptWeight, tasks, tokenNum, offset,
+            localVocabSize, vocabSize, hidden, perTokenScales, stream);
+    }
+    else
+    {
+        invokeLookUp<Tout, Tin, int>(
+            output, input, weight, tokenNum, offset, localVocabSize, hidden, perTokenScales, stream);
+    }
+}
+} // namespace
+
 int LookupPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc, nvinfer1::PluginTensorDesc const* outputDesc,
     void const* const* inputs, void* const* outputs, void* workspace, cudaStream_t stream) noexcept
 {
     // inputs
     //     input  [tokenNum]
     //     weight [localVocabSize, hidden]
-    //     per_token_scales [localVocabSize], optional
+    //     per_token_scales [localVocabSize], optional (quantized weight)
+    //     prompt_embedding_table [promptTableRows, hidden], optional (prompt tuning)
+    //     tasks [tokenNum], optional (prompt tuning)
     // outputs
     //     embedding [tokenNum, hidden]
 
@@ -157,53 +193,86 @@ int LookupPlugin::enqueue(nvinfer1::PluginTensorDesc const* inputDesc, nvinfer1:
 
     int offset = mRank * localVocabSize;
 
-    if (mNbInputs == 3)
+    void const* scales = hasPerTokenScales() ? inputs[2] : nullptr;
+    // Only rank 0 gathers virtual tokens; with tensor parallelism the other ranks write zeros so the
+    // all-reduce accumulates each prompt embedding exactly once.
+    void const* promptWeight = nullptr;
+    int const* tasks = nullptr;
+    if (withPromptTuning())
+    {
+        promptWeight = mRank == 0 ? inputs[mNbInputs - 2] : nullptr;
+        tasks = reinterpret_cast<int const*>(inputs[mNbInputs - 1]);
+    }
+
+    auto const weightType = inputDesc[1].type;
+    if (weightType == DataType::kINT8)
     {
         int8_t const* weight = reinterpret_cast<int8_t const*>(inputs[1]);
         if (mType == DataType::kHALF)
         {
-            half const* per_token_scales = reinterpret_cast<half const*>(inputs[2]);
-            half* output = reinterpret_cast<half*>(outputs[0]);
-            invokeLookUp<half, int8_t, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, per_token_scales, stream);
+            runLookup<half, int8_t>(reinterpret_cast<half*>(outputs[0]), input, weight,
+                reinterpret_cast<half const*>(scales), reinterpret_cast<half const*>(promptWeight), tasks, tokenNum,
+                offset, localVocabSize, mVocabSize, hidden, stream);
         }
         else if (mType == DataType::kFLOAT)
         {
-            float const* per_token_scales = reinterpret_cast<float const*>(inputs[2]);
-            float* output = reinterpret_cast<float*>(outputs[0]);
-            invokeLookUp<float, int8_t, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, per_token_scales, stream);
+            runLookup<float, int8_t>(reinterpret_cast<float*>(outputs[0]), input, weight,
+                reinterpret_cast<float const*>(scales), reinterpret_cast<float const*>(promptWeight), tasks, tokenNum,
+                offset, localVocabSize, mVocabSize, hidden, stream);
         }
         else if (mType == DataType::kBF16)
         {
-            __nv_bfloat16 const* per_token_scales = reinterpret_cast<__nv_bfloat16 const*>(inputs[2]);
-            __nv_bfloat16* output = reinterpret_cast<__nv_bfloat16*>(outputs[0]);
-            invokeLookUp<__nv_bfloat16, int8_t, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, per_token_scales, stream);
+            runLookup<__nv_bfloat16, int8_t>(reinterpret_cast<__nv_bfloat16*>(outputs[0]), input, weight,
+                reinterpret_cast<__nv_bfloat16 const*>(scales), reinterpret_cast<__nv_bfloat16 const*>(promptWeight),
+                tasks, tokenNum, offset, localVocabSize, mVocabSize, hidden, stream);
         }
     }
+#ifdef ENABLE_FP8
+    else if (weightType == DataType::kFP8)
+    {
+        __nv_fp8_e4m3 const* weight = reinterpret_cast<__nv_fp8_e4m3 const*>(inputs[1]);
+        if (mType == DataType::kHALF)
+        {
+            runLookup<half, __nv_fp8_e4m3>(reinterpret_cast<half*>(outputs[0]), input, weight,
+                reinterpret_cast<half const*>(scales), reinterpret_cast<half const*>(promptWeight), tasks, tokenNum,
+                offset, localVocabSize, mVocabSize, hidden, stream);
+        }
+        else if (mType == DataType::kFLOAT)
+        {
+            runLookup<float, __nv_fp8_e4m3>(reinterpret_cast<float*>(outputs[0]), input, weight,
+                reinterpret_cast<float const*>(scales), reinterpret_cast<float const*>(promptWeight), tasks, tokenNum,
+                offset, localVocabSize, mVocabSize, hidden, stream);
+        }
+        else if (mType == DataType::kBF16)
+        {
+            runLookup<__nv_bfloat16, __nv_fp8_e4m3>(reinterpret_cast<__nv_bfloat16*>(outputs[0]), input, weight,
+                reinterpret_cast<__nv_bfloat16 const*>(scales), reinterpret_cast<__nv_bfloat16 const*>(promptWeight),
+                tasks, tokenNum, offset, localVocabSize, mVocabSize, hidden, stream);
+        }
+    }
+#endif
     else
     {
         if (mType == DataType::kHALF)
         {
-            half const* weight = reinterpret_cast<half const*>(inputs[1]);
-            half* output = reinterpret_cast<half*>(outputs[0]);
-            invokeLookUp<half, half, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, nullptr, stream);
+            runLookup<half, half>(reinterpret_cast<half*>(outputs[0]), input,
+                reinterpret_cast<half const*>(inputs[1]), reinterpret_cast<half const*>(scales),
+                reinterpret_cast<half const*>(promptWeight), tasks, tokenNum, offset, localVocabSize, mVocabSize,
+                hidden, stream);
         }
         else if (mType == DataType::kFLOAT)
         {
-            float const* weight = reinterpret_cast<float const*>(inputs[1]);
-            float* output = reinterpret_cast<float*>(outputs[0]);
-            invokeLookUp<float, float, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, nullptr, stream);
+            runLookup<float, float>(reinterpret_cast<float*>(outputs[0]), input,
+                reinterpret_cast<float const*>(inputs[1]), reinterpret_cast<float const*>(scales),
+                reinterpret_cast<float const*>(promptWeight), tasks, tokenNum, offset, localVocabSize, mVocabSize,
+                hidden, stream);
         }
         else if (mType == DataType::kBF16)
         {
-            __nv_bfloat16 const* weight = reinterpret_cast<__nv_bfloat16 const*>(inputs[1]);
-            __nv_bfloat16* output = reinterpret_cast<__nv_bfloat16*>(outputs[0]);
-            invokeLookUp<__nv_bfloat16, __nv_bfloat16, int>(
-                output, input, weight, tokenNum, offset, localVocabSize, hidden, nullptr, stream);
+            runLookup<__nv_bfloat16, __nv_bfloat16>(reinterpret_cast<__nv_bfloat16*>(outputs[0]), input,
+                reinterpret_cast<__nv_bfloat16 const*>(inputs[1]), reinterpret_cast<__nv_bfloat16 const*>(scales),
+                reinterpret_cast<__nv_bfloat16 const*>(promptWeight), tasks, tokenNum, offset, localVocabSize,
+                mVocabSize, hidden, stream);
         }
     }
     sync_check_cuda_error(stream);
@@ -248,7 +317,7 @@ void LookupPlugin::destroy() noexcept
 
 size_t LookupPlugin::getSerializationSize() const noexcept
 {
-    return sizeof(mType) + sizeof(mRank);
+    return sizeof(mType) + sizeof(mRank) + sizeof(mVocabSize);
 }
 
 void LookupPlugin::serialize(void* buffer) const noexcept
@@ -256,6 +325,7 @@ void LookupPlugin::serialize(void* buffer) const noexcept
     char *d = static_cast<char*>(buffer), *a = d;
     write(d, mType);
     write(d, mRank);
+    write(d, mVocabSize);
 
     TLLM_CHECK(d == a + getSerializationSize());
 }
@@ -270,6 +340,7 @@ LookupPluginCreator::LookupPluginCreator()
     mPluginAttributes.clear();
     mPluginAttributes.emplace_back(PluginField("type_id", nullptr, PluginFieldType::kINT32));
     mPluginAttributes.emplace_back(PluginField("rank", nullptr, PluginFieldType::kINT32));
+    mPluginAttributes.emplace_back(PluginField("vocab_size", nullptr, PluginFieldType::kINT32));
     mFC.nbFields = mPluginAttributes.size();
     mFC.fields = mPluginAttributes.data();
 }
@@ -294,6 +365,7 @@ IPluginV2* LookupPluginCreator::createPlugin(char const* name, PluginFieldCollec
     PluginField const* fields = fc->fields;
     nvinfer1::DataType type{};
     int rank{};
+    int vocabSize{};
     // Read configurations from each fields
     for (int i = 0; i < fc->nbFields; ++i)
     {
@@ -308,10 +380,15 @@ IPluginV2* LookupPluginCreator::createPlugin(char const* name, PluginFieldCollec
             TLLM_CHECK(fields[i].type == PluginFieldType::kINT32);
             rank = static_cast<int>(*(static_cast<int const*>(fields[i].data)));
         }
+        else if (!strcmp(attrName, "vocab_size"))
+        {
+            TLLM_CHECK(fields[i].type == PluginFieldType::kINT32);
+            vocabSize = static_cast<int>(*(static_cast<int const*>(fields[i].data)));
+        }
     }
     try
     {
-        auto* obj = new LookupPlugin(type, rank);
+        auto* obj = new LookupPlugin(type, rank, vocabSize);
         obj->setPluginNamespace(mNamespace.c_str());
         return obj;
     }
@@ -30,7 +30,7 @@ class LookupPlugin : public BasePlugin
 public:
     LookupPlugin() = delete;
 
-    LookupPlugin(nvinfer1::DataType type, int rank);
+    LookupPlugin(nvinfer1::DataType type, int rank, int vocabSize);
 
     LookupPlugin(void const* data, size_t length);
 
@@ -66,10 +66,23 @@ public:
 private:
     const std::string mLayerName;
 
+    // Non-zero vocab size enables the fused prompt-tuning path: the last two plugin inputs are then the
+    // prompt embedding table and the per-token task row offsets, and ids >= mVocabSize resolve in that table.
     nvinfer1::DataType mType;
     int mRank;
+    int mVocabSize = 0;
     int mNbInputs = 0;
     int mArch;
+
+    bool withPromptTuning() const
+    {
+        return mVocabSize > 0;
+    }
+
+    bool hasPerTokenScales() const
+    {
+        return mNbInputs - (withPromptTuning() ? 2 : 0) == 3;
+    }
 };
 
 class LookupPluginCreator : public BaseCreator
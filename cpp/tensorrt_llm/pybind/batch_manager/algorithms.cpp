@@ -49,9 +49,10 @@ using namespace tensorrt_llm::batch_manager;
 void tensorrt_llm::pybind::batch_manager::algorithms::initBindings(pybind11::module_& m)
 {
     py::class_<CapacityScheduler>(m, CapacityScheduler::name)
-        .def(py::init<SizeType32, executor::CapacitySchedulerPolicy, bool, bool, LlmRequestState, LlmRequestState>(),
+        .def(py::init<SizeType32, executor::CapacitySchedulerPolicy, bool, bool, std::optional<float>, LlmRequestState,
+                 LlmRequestState>(),
             py::arg("max_num_requests"), py::arg("capacity_scheduler_policy"), py::arg("has_kv_cache_manager"),
-            py::arg("two_step_lookahead") = false,
+            py::arg("two_step_lookahead") = false, py::arg("context_tokens_per_second") = py::none(),
             py::arg_v("no_schedule_until_state", LlmRequestState::kCONTEXT_INIT, "LlmRequestState.CONTEXT_INIT"),
             py::arg_v("no_schedule_after_state", LlmRequestState::kGENERATION_COMPLETE,
                 "LlmRequestState.GENERATION_COMPLETE"))
@@ -16,12 +16,19 @@
  */
 
 #include "tensorrt_llm/pybind/batch_manager/kvCacheConnector.h"
+#include "tensorrt_llm/pybind/common/customCasters.h"
+
+#include <pybind11/stl.h>
 
 namespace
 {
 using KvCacheConnectorManager = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorManager;
+using KvCacheConnectorWorker = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorWorker;
+using KvCacheConnectorScheduler = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorScheduler;
+using KvCacheConnectorMetrics = tensorrt_llm::batch_manager::kv_connector::KvCacheConnectorMetrics;
 
 namespace tb = tensorrt_llm::batch_manager;
+namespace tr = tensorrt_llm::runtime;
 
 class PyKvCacheConnectorManager : public KvCacheConnectorManager, py::trampoline_self_life_support
 {
@@ -33,15 +40,141 @@ public:
         PYBIND11_OVERRIDE_PURE_NAME(SizeType32, KvCacheConnectorManager, "get_num_new_matched_tokens",
             getNumNewMatchedTokens, request, numComputedTokens);
     }
+
+    std::vector<SizeType32> getNumNewMatchedTokens(
+        tb::RequestVector const& requests, std::vector<SizeType32> const& numComputedTokens) override
+    {
+        PYBIND11_OVERRIDE_NAME(std::vector<SizeType32>, KvCacheConnectorManager, "get_num_new_matched_tokens_batched",
+            getNumNewMatchedTokens, requests, numComputedTokens);
+    }
+
+    KvCacheConnectorMetrics getMetrics() const override
+    {
+        PYBIND11_OVERRIDE_NAME(KvCacheConnectorMetrics, KvCacheConnectorManager, "get_metrics", getMetrics);
+    }
+};
+
+class PyKvCacheConnectorWorker : public KvCacheConnectorWorker, py::trampoline_self_life_support
+{
+public:
+    using KvCacheConnectorWorker::KvCacheConnectorWorker;
+
+    void registerKvCaches(std::vector<tr::ITensor::SharedPtr> const& pools) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(void, KvCacheConnectorWorker, "register_kv_caches", registerKvCaches, pools);
+    }
+
+    void startLoadKv(CudaStreamPtr const& stream) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(void, KvCacheConnectorWorker, "start_load_kv", startLoadKv, stream);
+    }
+
+    void waitForLayerLoad(SizeType32 layerIdx, CudaStreamPtr const& stream) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(
+            void, KvCacheConnectorWorker, "wait_for_layer_load", waitForLayerLoad, layerIdx, stream);
+    }
+
+    void saveKvLayer(SizeType32 layerIdx, CudaStreamPtr const& stream) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(void, KvCacheConnectorWorker, "save_kv_layer", saveKvLayer, layerIdx, stream);
+    }
+
+    void waitForSave(CudaStreamPtr const& stream) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(void, KvCacheConnectorWorker, "wait_for_save", waitForSave, stream);
+    }
+
+    bool canScheduleSave(SizeType32 numBlocks) override
+    {
+        PYBIND11_OVERRIDE_NAME(bool, KvCacheConnectorWorker, "can_schedule_save", canScheduleSave, numBlocks);
+    }
+
+    std::pair<std::vector<RequestIdType>, std::vector<RequestIdType>> getFinished(
+        std::vector<RequestIdType> const& finishedGenReqIds,
+        std::vector<RequestIdType> const& startedLoadingReqIds) override
+    {
+        using ReturnType = std::pair<std::vector<RequestIdType>, std::vector<RequestIdType>>;
+        PYBIND11_OVERRIDE_PURE_NAME(
+            ReturnType, KvCacheConnectorWorker, "get_finished", getFinished, finishedGenReqIds, startedLoadingReqIds);
+    }
+
+    KvCacheConnectorMetrics getMetrics() const override
+    {
+        PYBIND11_OVERRIDE_NAME(KvCacheConnectorMetrics, KvCacheConnectorWorker, "get_metrics", getMetrics);
+    }
+};
+
+class PyKvCacheConnectorScheduler : public KvCacheConnectorScheduler, py::trampoline_self_life_support
+{
+public:
+    using KvCacheConnectorScheduler::KvCacheConnectorScheduler;
+
+    std::pair<SizeType32, bool> getNumNewMatchedTokens(tb::LlmRequest const& request, SizeType32 numComputedTokens) override
+    {
+        using ReturnType = std::pair<SizeType32, bool>;
+        PYBIND11_OVERRIDE_PURE_NAME(ReturnType, KvCacheConnectorScheduler, "get_num_new_matched_tokens",
+            getNumNewMatchedTokens, request, numComputedTokens);
+    }
+
+    void updateStateAfterAlloc(tb::LlmRequest const& request, std::vector<SizeType32> const& blockIds) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(
+            void, KvCacheConnectorScheduler, "update_state_after_alloc", updateStateAfterAlloc, request, blockIds);
+    }
+
+    bool requestFinished(tb::LlmRequest const& request, std::vector<SizeType32> const& cacheBlockIds) override
+    {
+        PYBIND11_OVERRIDE_PURE_NAME(
+            bool, KvCacheConnectorScheduler, "request_finished", requestFinished, request, cacheBlockIds);
+    }
 };
 
 } // namespace
 
 void tensorrt_llm::batch_manager::kv_cache_manager::KVCacheManagerConnectorBindings::initBindings(py::module_& m)
 {
+    py::class_<KvCacheConnectorMetrics>(m, "KvCacheConnectorMetrics")
+        .def(py::init<>())
+        .def_readwrite("num_lookups", &KvCacheConnectorMetrics::numLookups)
+        .def_readwrite("num_matched_tokens", &KvCacheConnectorMetrics::numMatchedTokens)
+        .def_readwrite("num_onboarded_blocks", &KvCacheConnectorMetrics::numOnboardedBlocks)
+        .def_readwrite("num_offloaded_blocks", &KvCacheConnectorMetrics::numOffloadedBlocks)
+        .def_readwrite("num_deferred_offloads", &KvCacheConnectorMetrics::numDeferredOffloads)
+        .def_readwrite("num_failed_transfers", &KvCacheConnectorMetrics::numFailedTransfers);
+
     py::class_<tb::kv_connector::KvCacheConnectorManager, PyKvCacheConnectorManager, py::smart_holder>(
         m, "KvCacheConnectorManager")
         .def(py::init<>())
-        .def("get_num_new_matched_tokens", &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens,
-            py::arg("request"), py::arg("num_computed_tokens"));
+        .def("get_num_new_matched_tokens",
+            py::overload_cast<tb::LlmRequest const&, SizeType32>(
+                &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens),
+            py::arg("request"), py::arg("num_computed_tokens"))
+        .def("get_num_new_matched_tokens_batched",
+            py::overload_cast<tb::RequestVector const&, std::vector<SizeType32> const&>(
+                &tb::kv_connector::KvCacheConnectorManager::getNumNewMatchedTokens),
+            py::arg("requests"), py::arg("num_computed_tokens"))
+        .def("get_metrics", &tb::kv_connector::KvCacheConnectorManager::getMetrics);
+
+    py::class_<KvCacheConnectorWorker, PyKvCacheConnectorWorker, py::smart_holder>(m, "KvCacheConnectorWorker")
+        .def(py::init<>())
+        .def("register_kv_caches", &KvCacheConnectorWorker::registerKvCaches, py::arg("pools"))
+        .def("start_load_kv", &KvCacheConnectorWorker::startLoadKv, py::arg("stream"))
+        .def("wait_for_layer_load", &KvCacheConnectorWorker::waitForLayerLoad, py::arg("layer_idx"), py::arg("stream"))
+        .def("save_kv_layer", &KvCacheConnectorWorker::saveKvLayer, py::arg("layer_idx"), py::arg("stream"))
+        .def("wait_for_save", &KvCacheConnectorWorker::waitForSave, py::arg("stream"))
+        .def("can_schedule_save", &KvCacheConnectorWorker::canScheduleSave, py::arg("num_blocks"))
+        .def("get_finished", &KvCacheConnectorWorker::getFinished, py::arg("finished_gen_req_ids"),
+            py::arg("started_loading_req_ids"))
+        .def("get_metrics", &KvCacheConnectorWorker::getMetrics);
+
+    py::class_<KvCacheConnectorScheduler, PyKvCacheConnectorScheduler, py::smart_holder>(
+        m, "KvCacheConnectorScheduler")
+        .def(py::init<>())
+        .def("get_num_new_matched_tokens", &KvCacheConnectorScheduler::getNumNewMatchedTokens, py::arg("request"),
+            py::arg("num_computed_tokens"))
+        .def("update_state_after_alloc", &KvCacheConnectorScheduler::updateStateAfterAlloc, py::arg("request"),
+            py::arg("block_ids"))
+        .def("request_finished", &KvCacheConnectorScheduler::requestFinished, py::arg("request"),
+            py::arg("cache_block_ids"));
 }
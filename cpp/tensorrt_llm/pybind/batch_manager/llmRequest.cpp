@@ -43,7 +43,7 @@ std::optional<tb::LlmRequest::TensorPtr> from_torch(std::optional<LlmRequest::Te
 {
     if (torchPtr)
     {
-        return tr::TorchView::of(torchPtr.value());
+        return tr::TorchView::aliasOrCopy(torchPtr.value(), "LlmRequest");
     }
     return std::nullopt;
 }
@@ -44,6 +44,7 @@
 #include "tensorrt_llm/runtime/gptJsonConfig.h"
 #include "tensorrt_llm/runtime/ipcNvlsMemory.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
+#include "tensorrt_llm/runtime/memoryProfiler.h"
 #include "tensorrt_llm/runtime/samplingConfig.h"
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
@@ -475,6 +476,15 @@ PYBIND11_MODULE(TRTLLM_PYBIND_MODULE, m)
         .def_property_readonly("pinned", &tr::MemoryCounters::getPinned)
         .def_property_readonly("uvm", &tr::MemoryCounters::getUVM);
 
+    py::class_<tr::MemoryProfiler>(m, "MemoryProfiler")
+        .def_static("instance", &tr::MemoryProfiler::getInstance, py::return_value_policy::reference)
+        .def_static("is_enabled", &tr::MemoryProfiler::isEnabled)
+        .def_static("set_enabled", &tr::MemoryProfiler::setEnabled)
+        .def("to_pprof_profile", [](tr::MemoryProfiler const& self) { return self.toPprofProfile(); })
+        .def("write_profile",
+            [](tr::MemoryProfiler const& self, std::string const& path) { self.writeProfile(path); })
+        .def("reset", &tr::MemoryProfiler::reset);
+
     tensorrt_llm::pybind::process_group::initBindings(mInternalProcessGroup);
     tensorrt_llm::pybind::runtime::initBindings(mInternalRuntime);
     tensorrt_llm::pybind::testing::initBindings(mInternalTesting);
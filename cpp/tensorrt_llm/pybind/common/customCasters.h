@@ -185,7 +185,8 @@ public:
         if (THPVariable_Check(obj))
         {
             at::Tensor const& t = THPVariable_Unpack(obj);
-            value = tensorrt_llm::executor::detail::ofITensor(tensorrt_llm::runtime::TorchView::of(t));
+            value = tensorrt_llm::executor::detail::ofITensor(
+                tensorrt_llm::runtime::TorchView::aliasOrCopy(t, "executor::Tensor"));
             return true;
         }
         return false;
@@ -211,7 +212,7 @@ public:
         if (THPVariable_Check(obj))
         {
             at::Tensor const& t = THPVariable_Unpack(obj);
-            value = std::move(tensorrt_llm::runtime::TorchView::of(t));
+            value = std::move(tensorrt_llm::runtime::TorchView::aliasOrCopy(t, "ITensor::SharedPtr"));
             return true;
         }
         return false;
@@ -242,7 +243,7 @@ public:
         if (THPVariable_Check(obj))
         {
             at::Tensor const& t = THPVariable_Unpack(obj);
-            value = std::move(tensorrt_llm::runtime::TorchView::of(t));
+            value = std::move(tensorrt_llm::runtime::TorchView::aliasOrCopy(t, "ITensor::SharedConstPtr"));
             return true;
         }
         return false;
@@ -28,6 +28,7 @@ void initExceptionsBindings(py::module_& m)
     py::enum_<tc::RequestErrorCode>(m, "RequestErrorCode")
         .value("UNKNOWN_ERROR", tc::RequestErrorCode::kUNKNOWN_ERROR)
         .value("NETWORK_ERROR", tc::RequestErrorCode::kNETWORK_ERROR)
+        .value("MEMORY_ALLOCATION_ERROR", tc::RequestErrorCode::kMEMORY_ALLOCATION_ERROR)
         .export_values();
 
     // Create the RequestSpecificException Python exception class
@@ -196,6 +196,9 @@ void initBindings(pybind11::module_& m)
         .def_readwrite("reused_blocks_per_request", &tle::RequestStats::reusedBlocksPerRequest)
         .def_readwrite("missed_blocks_per_request", &tle::RequestStats::missedBlocksPerRequest)
         .def_readwrite("kv_cache_hit_rate_per_request", &tle::RequestStats::kvCacheHitRatePerRequest)
+        .def_readwrite("time_in_queue_ms", &tle::RequestStats::timeInQueueMS)
+        .def_readwrite("context_latency_ms", &tle::RequestStats::contextLatencyMS)
+        .def_readwrite("last_token_latencies_ms", &tle::RequestStats::lastTokenLatenciesMS)
         .def("to_json_str",
             [](tle::RequestStats const& iterationStats) { return tle::JsonSerialization::toJsonStr(iterationStats); });
 
@@ -243,6 +246,14 @@ void initBindings(pybind11::module_& m)
         .def_readonly("window_size", &tle::KVCacheEvent::windowSize)
         .def_readonly("attention_dp_rank", &tle::KVCacheEvent::attentionDpRank);
 
+    py::class_<tle::KVCachePrefixDigest>(executor_kv_cache, "KVCachePrefixDigest")
+        .def_readonly("num_bits", &tle::KVCachePrefixDigest::numBits)
+        .def_readonly("num_hashes", &tle::KVCachePrefixDigest::numHashes)
+        .def_readonly("version", &tle::KVCachePrefixDigest::version)
+        .def_property_readonly("bits",
+            [](tle::KVCachePrefixDigest const& self)
+            { return py::bytes(reinterpret_cast<char const*>(self.bits.data()), self.bits.size()); });
+
     py::class_<tle::KVCacheEventManager, std::shared_ptr<tle::KVCacheEventManager>>(
         executor_kv_cache, "KVCacheEventManager")
         .def(
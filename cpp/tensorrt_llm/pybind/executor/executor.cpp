@@ -181,11 +181,14 @@ void Executor::initBindings(py::module_& m)
             py::arg("ids"), py::arg("timeout") = py::none())
         .def("get_num_responses_ready", &Executor::getNumResponsesReady, py::arg("id") = py::none())
         .def("cancel_request", &Executor::cancelRequest, py::arg("id") = py::none())
+        .def("drain", &Executor::drain)
         .def("get_latest_iteration_stats", &Executor::getLatestIterationStats)
         .def("get_latest_request_stats", &Executor::getLatestRequestStats)
         .def("get_latest_debug_tensors", &Executor::getLatestDebugTensors)
         .def("can_enqueue_requests", &Executor::canEnqueueRequests)
-        .def("get_kv_cache_event_manager", &Executor::getKVCacheEventManager);
+        .def("get_kv_cache_event_manager", &Executor::getKVCacheEventManager)
+        .def("get_kv_cache_prefix_digest", &Executor::getKVCachePrefixDigest)
+        .def("write_decoder_timing_trace", &Executor::writeDecoderTimingTrace, py::arg("path"));
 }
 
 } // namespace tensorrt_llm::pybind::executor
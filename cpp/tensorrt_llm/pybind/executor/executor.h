@@ -120,6 +120,16 @@ public:
         return mExecutor->getKVCacheEventManager();
     }
 
+    [[nodiscard]] std::optional<tle::KVCachePrefixDigest> getKVCachePrefixDigest() const
+    {
+        return mExecutor->getKVCachePrefixDigest();
+    }
+
+    bool writeDecoderTimingTrace(std::string const& path) const
+    {
+        return mExecutor->writeDecoderTimingTrace(path);
+    }
+
     static void initBindings(pybind11::module_& m);
 
 private:
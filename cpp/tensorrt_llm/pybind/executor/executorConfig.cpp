@@ -68,28 +68,30 @@ void initConfigBindings(pybind11::module_& m)
 
     auto schedulerConfigSetstate = [](py::tuple const& state)
     {
-        if (state.size() != 3)
+        if (state.size() != 4)
         {
             throw std::runtime_error("Invalid state!");
         }
         return tle::SchedulerConfig(state[0].cast<tle::CapacitySchedulerPolicy>(),
             state[1].cast<std::optional<tle::ContextChunkingPolicy>>(),
-            state[2].cast<std::optional<tle::DynamicBatchConfig>>());
+            state[2].cast<std::optional<tle::DynamicBatchConfig>>(), state[3].cast<std::optional<tle::FloatType>>());
     };
     auto schedulerConfigGetstate = [](tle::SchedulerConfig const& self)
     {
-        return py::make_tuple(
-            self.getCapacitySchedulerPolicy(), self.getContextChunkingPolicy(), self.getDynamicBatchConfig());
+        return py::make_tuple(self.getCapacitySchedulerPolicy(), self.getContextChunkingPolicy(),
+            self.getDynamicBatchConfig(), self.getContextTokensPerSecond());
     };
     py::class_<tle::SchedulerConfig>(m, "SchedulerConfig")
         .def(py::init<tle::CapacitySchedulerPolicy, std::optional<tle::ContextChunkingPolicy>,
-                 std::optional<tle::DynamicBatchConfig>>(),
+                 std::optional<tle::DynamicBatchConfig>, std::optional<tle::FloatType>>(),
             py::arg_v("capacity_scheduler_policy", tle::CapacitySchedulerPolicy::kGUARANTEED_NO_EVICT,
                 "CapacitySchedulerPolicy.GUARANTEED_NO_EVICT"),
-            py::arg("context_chunking_policy") = py::none(), py::arg("dynamic_batch_config") = py::none())
+            py::arg("context_chunking_policy") = py::none(), py::arg("dynamic_batch_config") = py::none(),
+            py::arg("context_tokens_per_second") = py::none())
         .def_property_readonly("capacity_scheduler_policy", &tle::SchedulerConfig::getCapacitySchedulerPolicy)
         .def_property_readonly("context_chunking_policy", &tle::SchedulerConfig::getContextChunkingPolicy)
         .def_property_readonly("dynamic_batch_config", &tle::SchedulerConfig::getDynamicBatchConfig)
+        .def_property_readonly("context_tokens_per_second", &tle::SchedulerConfig::getContextTokensPerSecond)
         .def(py::pickle(schedulerConfigGetstate, schedulerConfigSetstate));
 
     py::class_<RuntimeDefaults>(m, "RuntimeDefaults")
@@ -363,19 +365,20 @@ void initConfigBindings(pybind11::module_& m)
             &tle::ExtendedRuntimePerfKnobConfig::setCudaGraphCacheSize)
         .def(py::pickle(extendedRuntimePerfKnobConfigGetstate, extendedRuntimePerfKnobConfigSetstate));
 
-    auto SpeculativeDecodingConfigGetState
-        = [](tle::SpeculativeDecodingConfig const& self) { return py::make_tuple(self.fastLogits); };
+    auto SpeculativeDecodingConfigGetState = [](tle::SpeculativeDecodingConfig const& self)
+    { return py::make_tuple(self.fastLogits, self.dynamicDraftLen); };
     auto SpeculativeDecodingConfigSetState = [](py::tuple const& state)
     {
-        if (state.size() != 1)
+        if (state.size() != 2)
         {
             throw std::runtime_error("Invalid SpeculativeDecodingConfig state!");
         }
-        return tle::SpeculativeDecodingConfig(state[0].cast<bool>());
+        return tle::SpeculativeDecodingConfig(state[0].cast<bool>(), state[1].cast<bool>());
     };
     py::class_<tle::SpeculativeDecodingConfig>(m, "SpeculativeDecodingConfig")
-        .def(py::init<bool>(), py::arg("fast_logits") = false)
+        .def(py::init<bool, bool>(), py::arg("fast_logits") = false, py::arg("dynamic_draft_len") = false)
         .def_readwrite("fast_logits", &tle::SpeculativeDecodingConfig::fastLogits)
+        .def_readwrite("dynamic_draft_len", &tle::SpeculativeDecodingConfig::dynamicDraftLen)
         .def(py::pickle(SpeculativeDecodingConfigGetState, SpeculativeDecodingConfigSetState));
 
     // Guided decoding config
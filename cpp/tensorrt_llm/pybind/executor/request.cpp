@@ -191,24 +191,28 @@ void initRequestBindings(pybind11::module_& m)
     auto outputConfigGetstate = [](tle::OutputConfig const& self)
     {
         return py::make_tuple(self.returnLogProbs, self.returnContextLogits, self.returnGenerationLogits,
-            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs);
+            self.excludeInputFromOutput, self.returnEncoderOutput, self.returnPerfMetrics, self.additionalModelOutputs,
+            self.returnDeltaLogProbs, self.topKLogits, self.packedLogProbs);
     };
     auto outputConfigSetstate = [](py::tuple const& state)
     {
-        if (state.size() != 7)
+        if (state.size() != 10)
         {
             throw std::runtime_error("Invalid OutputConfig state!");
         }
         return tle::OutputConfig(state[0].cast<bool>(), state[1].cast<bool>(), state[2].cast<bool>(),
             state[3].cast<bool>(), state[4].cast<bool>(), state[5].cast<bool>(),
-            state[6].cast<std::optional<std::vector<tle::AdditionalModelOutput>>>());
+            state[6].cast<std::optional<std::vector<tle::AdditionalModelOutput>>>(), state[7].cast<bool>(),
+            state[8].cast<std::optional<SizeType32>>(), state[9].cast<bool>());
     };
     py::class_<tle::OutputConfig>(m, "OutputConfig")
-        .def(py::init<bool, bool, bool, bool, bool, bool, std::optional<std::vector<tle::AdditionalModelOutput>>>(),
+        .def(py::init<bool, bool, bool, bool, bool, bool, std::optional<std::vector<tle::AdditionalModelOutput>>, bool,
+                 std::optional<SizeType32>, bool>(),
             py::arg("return_log_probs") = false, py::arg("return_context_logits") = false,
             py::arg("return_generation_logits") = false, py::arg("exclude_input_from_output") = false,
             py::arg("return_encoder_output") = false, py::arg("return_perf_metrics") = false,
-            py::arg("additional_model_outputs") = py::none())
+            py::arg("additional_model_outputs") = py::none(), py::arg("return_delta_log_probs") = false,
+            py::arg("top_k_logits") = py::none(), py::arg("packed_log_probs") = false)
         .def_readwrite("return_log_probs", &tle::OutputConfig::returnLogProbs)
         .def_readwrite("return_context_logits", &tle::OutputConfig::returnContextLogits)
         .def_readwrite("return_generation_logits", &tle::OutputConfig::returnGenerationLogits)
@@ -216,6 +220,9 @@ void initRequestBindings(pybind11::module_& m)
         .def_readwrite("return_encoder_output", &tle::OutputConfig::returnEncoderOutput)
         .def_readwrite("return_perf_metrics", &tle::OutputConfig::returnPerfMetrics)
         .def_readwrite("additional_model_outputs", &tle::OutputConfig::additionalModelOutputs)
+        .def_readwrite("return_delta_log_probs", &tle::OutputConfig::returnDeltaLogProbs)
+        .def_readwrite("top_k_logits", &tle::OutputConfig::topKLogits)
+        .def_readwrite("packed_log_probs", &tle::OutputConfig::packedLogProbs)
         .def(py::pickle(outputConfigGetstate, outputConfigSetstate));
 
     auto externalDraftTokensConfigGetstate = [](tle::ExternalDraftTokensConfig const& self)
@@ -310,23 +317,26 @@ void initRequestBindings(pybind11::module_& m)
         .def_property_readonly("mrope_position_deltas", &tle::MropeConfig::getMRopePositionDeltas)
         .def(py::pickle(MropeConfigGetstate, MropeConfigSetstate));
 
-    auto lookaheadDecodingConfigGetstate = [](tle::LookaheadDecodingConfig const& self)
-    { return py::make_tuple(self.getWindowSize(), self.getNgramSize(), self.getVerificationSetSize()); };
+    auto lookaheadDecodingConfigGetstate = [](tle::LookaheadDecodingConfig const& self) {
+        return py::make_tuple(
+            self.getWindowSize(), self.getNgramSize(), self.getVerificationSetSize(), self.getUsePoolCache());
+    };
     auto lookaheadDecodingConfigSetstate = [](py::tuple const& state)
     {
-        if (state.size() != 3)
+        if (state.size() != 4)
         {
             throw std::runtime_error("Invalid LookaheadDecodingConfig state!");
         }
-        return tle::LookaheadDecodingConfig(
-            state[0].cast<SizeType32>(), state[1].cast<SizeType32>(), state[2].cast<SizeType32>());
+        return tle::LookaheadDecodingConfig(state[0].cast<SizeType32>(), state[1].cast<SizeType32>(),
+            state[2].cast<SizeType32>(), state[3].cast<bool>());
     };
     py::class_<tle::LookaheadDecodingConfig>(m, "LookaheadDecodingConfig")
-        .def(py::init<SizeType32, SizeType32, SizeType32>(), py::arg("max_window_size"), py::arg("max_ngram_size"),
-            py::arg("max_verification_set_size"))
+        .def(py::init<SizeType32, SizeType32, SizeType32, bool>(), py::arg("max_window_size"),
+            py::arg("max_ngram_size"), py::arg("max_verification_set_size"), py::arg("use_pool_cache") = false)
         .def_property_readonly("max_window_size", &tle::LookaheadDecodingConfig::getWindowSize)
         .def_property_readonly("max_ngram_size", &tle::LookaheadDecodingConfig::getNgramSize)
         .def_property_readonly("max_verification_set_size", &tle::LookaheadDecodingConfig::getVerificationSetSize)
+        .def_property_readonly("use_pool_cache", &tle::LookaheadDecodingConfig::getUsePoolCache)
         .def("calculate_speculative_resource", &tle::LookaheadDecodingConfig::calculateSpeculativeResource)
         .def_static(
             "calculate_speculative_resource_tuple", &tle::LookaheadDecodingConfig::calculateSpeculativeResourceTuple)
@@ -353,18 +363,19 @@ void initRequestBindings(pybind11::module_& m)
     auto kvCacheRetentionConfigGetstate = [](tle::KvCacheRetentionConfig const& self)
     {
         return py::make_tuple(self.getTokenRangeRetentionConfigs(), self.getDecodeRetentionPriority(),
-            self.getDecodeDurationMs(), self.getTransferMode(), self.getDirectory());
+            self.getDecodeDurationMs(), self.getTransferMode(), self.getDirectory(), self.getAttentionSinkTokenCount());
     };
     auto kvCacheRetentionConfigSetstate = [](py::tuple const& state)
     {
-        if (state.size() != 5)
+        if (state.size() != 6)
         {
             throw std::runtime_error("Invalid state!");
         }
         return tle::KvCacheRetentionConfig(
             state[0].cast<std::vector<tle::KvCacheRetentionConfig::TokenRangeRetentionConfig>>(),
             state[1].cast<tle::RetentionPriority>(), state[2].cast<std::optional<std::chrono::milliseconds>>(),
-            state[3].cast<tle::KvCacheTransferMode>(), state[4].cast<std::string>());
+            state[3].cast<tle::KvCacheTransferMode>(), state[4].cast<std::string>(),
+            state[5].cast<std::optional<SizeType32>>());
     };
 
     auto kvCacheRetentionConfig = py::class_<tle::KvCacheRetentionConfig>(m, "KvCacheRetentionConfig");
@@ -386,17 +397,21 @@ void initRequestBindings(pybind11::module_& m)
     // TokenRangeRetentionPriority bindings have been defined.
     kvCacheRetentionConfig
         .def(py::init<std::vector<tle::KvCacheRetentionConfig::TokenRangeRetentionConfig>, tle::RetentionPriority,
-                 std::optional<std::chrono::milliseconds>, tle::KvCacheTransferMode, std::string>(),
+                 std::optional<std::chrono::milliseconds>, tle::KvCacheTransferMode, std::string,
+                 std::optional<SizeType32>>(),
             py::arg("token_range_retention_configs"),
             py::arg("decode_retention_priority") = tle::KvCacheRetentionConfig::kDefaultRetentionPriority,
             py::arg("decode_duration_ms") = py::none(),
-            py::arg_v("transfer_mode", tle::KvCacheTransferMode::DRAM, "DRAM"), py::arg("directory") = py::none())
+            py::arg_v("transfer_mode", tle::KvCacheTransferMode::DRAM, "DRAM"), py::arg("directory") = py::none(),
+            py::arg("attention_sink_token_count") = py::none())
         .def_property_readonly(
             "token_range_retention_configs", &tle::KvCacheRetentionConfig::getTokenRangeRetentionConfigs)
         .def_property_readonly("decode_retention_priority", &tle::KvCacheRetentionConfig::getDecodeRetentionPriority)
         .def_property_readonly("decode_duration_ms", &tle::KvCacheRetentionConfig::getDecodeDurationMs)
         .def_property_readonly("transfer_mode", &tle::KvCacheRetentionConfig::getTransferMode)
         .def_property_readonly("directory", &tle::KvCacheRetentionConfig::getDirectory)
+        .def_property_readonly(
+            "attention_sink_token_count", &tle::KvCacheRetentionConfig::getAttentionSinkTokenCount)
         .def(py::pickle(kvCacheRetentionConfigGetstate, kvCacheRetentionConfigSetstate))
         .def("__eq__", &tle::KvCacheRetentionConfig::operator==);
 
@@ -846,6 +861,8 @@ void initRequestBindings(pybind11::module_& m)
         .def_readwrite("context_phase_params", &tle::Result::contextPhaseParams)
         .def_readwrite("request_perf_metrics", &tle::Result::requestPerfMetrics)
         .def_readwrite("additional_outputs", &tle::Result::additionalOutputs)
+        .def_readwrite("log_probs_offset", &tle::Result::logProbsOffset)
+        .def_readwrite("generation_logits_top_k_indices", &tle::Result::generationLogitsTopKIndices)
         .def(py::pickle(resultGetstate, resultSetstate));
 
     m.def("deserialize_result",
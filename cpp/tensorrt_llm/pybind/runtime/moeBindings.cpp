@@ -90,6 +90,10 @@ void initMoeBindings(pybind11::module_& m)
         .def("add_single_host_weight", &tr::SingleLayerMoeLoadBalancer::addSingleHostWeight, py::arg("expert_id"),
             py::arg("name"), py::arg("host_weight"), "Add a single host weight for a specific expert ID",
             py::call_guard<py::gil_scoped_release>())
+        .def("add_single_cold_host_weight", &tr::SingleLayerMoeLoadBalancer::addSingleColdHostWeight,
+            py::arg("expert_id"), py::arg("name"), py::arg("file_path"), py::arg("file_offset"), py::arg("shape"),
+            "Add a single NVMe resident host weight for a specific expert ID",
+            py::call_guard<py::gil_scoped_release>())
         .def("set_initial_weight_assignments", &tr::SingleLayerMoeLoadBalancer::setInitialWeightAssignments,
             py::arg("initial_weight_assignments"), "Set initial weight assignments for each slot",
             py::call_guard<py::gil_scoped_release>())
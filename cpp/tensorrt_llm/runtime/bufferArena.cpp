@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/bufferArena.h"
+
+#include "tensorrt_llm/common/cudaUtils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace tensorrt_llm::runtime
+{
+
+BufferArena::TensorPtr BufferArena::allocate(
+    BufferManager const& manager, nvinfer1::Dims const& shape, nvinfer1::DataType type)
+{
+    auto const sizeBytes = ITensor::volumeNonNegative(shape) * BufferDataType(type).getSizeInBits() / 8;
+    auto const alignedBytes = common::ceilDiv(sizeBytes, kAlignment) * kAlignment;
+    mIterationBytes += alignedBytes;
+
+    // Grow the slab to the high-water mark while no tensors are outstanding.
+    if (mOffset == 0 && mHighWaterMark > 0 && (!mSlab || mSlab->getSizeInBytes() < mHighWaterMark))
+    {
+        mSlab = manager.gpu(mHighWaterMark);
+    }
+
+    if (mSlab && mOffset + sizeBytes <= mSlab->getSizeInBytes())
+    {
+        auto* const data = static_cast<std::uint8_t*>(mSlab->data()) + mOffset;
+        mOffset += alignedBytes;
+        return ITensor::wrap(data, type, shape);
+    }
+
+    // The slab is exhausted; serve this iteration from the buffer manager and grow on the next reset.
+    return manager.gpu(shape, type);
+}
+
+void BufferArena::reset()
+{
+    mHighWaterMark = std::max(mHighWaterMark, mIterationBytes);
+    mIterationBytes = 0;
+    mOffset = 0;
+}
+
+} // namespace tensorrt_llm::runtime
@@ -51,6 +51,25 @@ std::size_t CudaMemPool::memoryPoolFree() const
     return memoryPoolReserved() - memoryPoolUsed();
 }
 
+CudaMemPoolStats CudaMemPool::memoryPoolStats() const
+{
+    CudaMemPoolStats stats{};
+    TLLM_CUDA_CHECK(cudaMemPoolGetAttribute(mPool.get(), cudaMemPoolAttrReservedMemCurrent, &stats.reservedBytes));
+    TLLM_CUDA_CHECK(cudaMemPoolGetAttribute(mPool.get(), cudaMemPoolAttrReservedMemHigh, &stats.reservedHighWatermark));
+    TLLM_CUDA_CHECK(cudaMemPoolGetAttribute(mPool.get(), cudaMemPoolAttrUsedMemCurrent, &stats.usedBytes));
+    TLLM_CUDA_CHECK(cudaMemPoolGetAttribute(mPool.get(), cudaMemPoolAttrUsedMemHigh, &stats.usedHighWatermark));
+    stats.fragmentedBytes = stats.reservedBytes - stats.usedBytes;
+    return stats;
+}
+
+void CudaMemPool::resetHighWatermarks()
+{
+    // The driver resets a watermark to the corresponding current value when 0 is written to it.
+    std::uint64_t zero = 0;
+    TLLM_CUDA_CHECK(cudaMemPoolSetAttribute(mPool.get(), cudaMemPoolAttrReservedMemHigh, &zero));
+    TLLM_CUDA_CHECK(cudaMemPoolSetAttribute(mPool.get(), cudaMemPoolAttrUsedMemHigh, &zero));
+}
+
 void CudaMemPool::memoryPoolTrimTo(std::size_t size)
 {
     TLLM_CUDA_CHECK(::cudaMemPoolTrimTo(mPool.get(), size));
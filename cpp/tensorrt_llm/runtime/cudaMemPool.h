@@ -25,6 +25,23 @@ using cudaMemPool_t = CUmemPoolHandle_st*;
 namespace tensorrt_llm::runtime
 {
 
+/// @brief Point-in-time usage snapshot of a CUDA memory pool, for fragmentation introspection.
+struct CudaMemPoolStats
+{
+    /// @brief Bytes of physical memory currently held by the pool.
+    std::size_t reservedBytes;
+    /// @brief High watermark of reserved memory since the last watermark reset.
+    std::size_t reservedHighWatermark;
+    /// @brief Bytes currently backing live allocations.
+    std::size_t usedBytes;
+    /// @brief High watermark of used memory since the last watermark reset.
+    std::size_t usedHighWatermark;
+    /// @brief Bytes held by the pool without backing any allocation. The driver can only hand this
+    /// memory out in pieces that fit its internal free runs, so a persistently large value while
+    /// allocations fail indicates pool fragmentation.
+    std::size_t fragmentedBytes;
+};
+
 class CudaMemPool
 {
 public:
@@ -39,6 +56,13 @@ public:
     /// @brief Gets the amount of free memory in the memory pool, WITHOUT synchronizing.
     [[nodiscard]] std::size_t memoryPoolFree() const;
 
+    /// @brief Gets a full usage snapshot of the memory pool, WITHOUT synchronizing.
+    [[nodiscard]] CudaMemPoolStats memoryPoolStats() const;
+
+    /// @brief Resets the reserved and used high watermarks to the current values, so the next
+    /// snapshot reports peaks of the interval since this call.
+    void resetHighWatermarks();
+
     /// @brief Hints the driver to trim the pool. Does not guarantee that the amount of reserved memory will actually
     /// decrease, only guarantees that this amount after trimming will be larger than the provided size.
     void memoryPoolTrimTo(std::size_t size);
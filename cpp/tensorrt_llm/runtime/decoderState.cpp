@@ -58,7 +58,13 @@ void DecoderState::setup(SizeType32 maxNumSequences, SizeType32 maxBeamWidth, Si
     WorldConfig const& worldConfig, BufferManager const& bufferManager)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    setupBuffers(dtype, bufferManager);
+    // Allocating the empty tensors is only needed on the first call (or when the data type changes);
+    // repeated setup calls reconfigure the existing allocation in reshapeBuffers.
+    if (mBufferDtype != dtype)
+    {
+        setupBuffers(dtype, bufferManager);
+        mBufferDtype = dtype;
+    }
     reshapeBuffers(maxNumSequences, maxBeamWidth, maxAttentionWindow, sinkTokenLength, maxSequenceLength, modelConfig,
         worldConfig, bufferManager);
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
@@ -210,6 +216,20 @@ void DecoderState::reshapeBuffers(SizeType32 maxNumSequences, SizeType32 maxBeam
     TLLM_CHECK(maxBeamWidth > 0);
     TLLM_CHECK(mMaxDecodingEngineTokens > 0);
     TLLM_CHECK(maxSequenceLength > 0);
+
+    // Fast path for reconfiguration while serving: when the request fits the current allocation,
+    // keep the larger buffers (shrinking is lazy) and only reset the per-slot host bookkeeping.
+    // Device slot state is initialized when a request is assigned to a slot, so no memsets are needed.
+    if (maxNumSequences <= mMaxNumSequences && maxBeamWidth == mMaxBeamWidth
+        && maxSequenceLength == mMaxSequenceLength && maxAttentionWindow == mJointDecodingInput->maxAttentionWindow
+        && sinkTokenLength == mJointDecodingInput->sinkTokenLength)
+    {
+        mNumDecodingEngineTokens.assign(mNumDecodingEngineTokens.size(), 0);
+        mJointDecodingInput->beamWidths.assign(mJointDecodingInput->beamWidths.size(), 0);
+        TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+        return;
+    }
+
     mMaxNumSequences = maxNumSequences;
     mMaxBeamWidth = maxBeamWidth;
     mMaxSequenceLength = maxSequenceLength;
@@ -300,7 +320,10 @@ void DecoderState::setupCacheIndirection(SizeType32 maxNumSequences, SizeType32
     SizeType32 maxAttentionWindow, BufferManager const& bufferManager)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
-    setupCacheIndirectionBuffers(bufferManager);
+    if (!mJointDecodingInput->cacheIndirection)
+    {
+        setupCacheIndirectionBuffers(bufferManager);
+    }
     reshapeCacheIndirectionBuffers(maxNumSequences, maxBeamWidth, maxAttentionWindow);
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
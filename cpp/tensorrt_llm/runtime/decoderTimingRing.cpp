@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/decoderTimingRing.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+using namespace tensorrt_llm::runtime;
+
+DecoderTimingRing::DecoderTimingRing(SizeType32 capacity)
+    : mRing(capacity)
+    , mCapacity{capacity}
+{
+    TLLM_CHECK_WITH_INFO(capacity > 0, "DecoderTimingRing capacity must be positive");
+}
+
+void DecoderTimingRing::beginStep(
+    SizeType32 numSequences, SizeType32 beamWidth, SizeType32 maxDecoderSteps, bool graphReplay, cudaStream_t stream)
+{
+    retireCompleted();
+    if (mPendingCount == kMaxPendingSteps)
+    {
+        auto& oldest = mPendingPool[mPendingHead];
+        oldest.stop.synchronize();
+        retireCompleted();
+    }
+
+    auto const now = std::chrono::steady_clock::now().time_since_epoch();
+    auto& pending = mPendingPool[(mPendingHead + mPendingCount) % kMaxPendingSteps];
+    pending.record.iteration = mNextIteration++;
+    pending.record.dispatchTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    pending.record.gpuMs = 0.F;
+    pending.record.numSequences = numSequences;
+    pending.record.beamWidth = beamWidth;
+    pending.record.maxDecoderSteps = maxDecoderSteps;
+    pending.record.graphReplay = graphReplay ? 1 : 0;
+    TLLM_CUDA_CHECK(::cudaEventRecord(pending.start.get(), stream));
+    mPendingCount += 1;
+}
+
+void DecoderTimingRing::endStep(cudaStream_t stream)
+{
+    TLLM_CHECK(mPendingCount > 0);
+    auto& pending = mPendingPool[(mPendingHead + mPendingCount - 1) % kMaxPendingSteps];
+    TLLM_CUDA_CHECK(::cudaEventRecord(pending.stop.get(), stream));
+}
+
+void DecoderTimingRing::retireCompleted()
+{
+    // Pending steps finish in stream order, so stop at the first one that is still running.
+    while (mPendingCount > 0)
+    {
+        auto& pending = mPendingPool[mPendingHead];
+        if (::cudaEventQuery(pending.stop.get()) != cudaSuccess)
+        {
+            break;
+        }
+        TLLM_CUDA_CHECK(::cudaEventElapsedTime(&pending.record.gpuMs, pending.start.get(), pending.stop.get()));
+        publish(pending.record);
+        mPendingHead = (mPendingHead + 1) % kMaxPendingSteps;
+        mPendingCount -= 1;
+    }
+}
+
+void DecoderTimingRing::publish(StepRecord const& record)
+{
+    auto const index = mPublished.load(std::memory_order_relaxed);
+    mRing[index % mCapacity] = record;
+    mPublished.store(index + 1, std::memory_order_release);
+}
+
+std::vector<DecoderTimingRing::StepRecord> DecoderTimingRing::snapshot() const
+{
+    auto const end = mPublished.load(std::memory_order_acquire);
+    auto const count = std::min<uint64_t>(end, mCapacity);
+
+    std::vector<StepRecord> records;
+    records.reserve(count);
+    for (uint64_t index = end - count; index < end; ++index)
+    {
+        records.push_back(mRing[index % mCapacity]);
+    }
+
+    // The writer may have wrapped into the copied range; published records retire in iteration
+    // order, so everything the slot for the next publish could alias is at the front.
+    auto const endAfter = mPublished.load(std::memory_order_acquire);
+    auto const dropBelow = endAfter >= static_cast<uint64_t>(mCapacity) ? endAfter + 1 - mCapacity : 0;
+    records.erase(records.begin(),
+        std::find_if(records.begin(), records.end(),
+            [dropBelow](StepRecord const& record) { return record.iteration >= dropBelow; }));
+    return records;
+}
+
+bool DecoderTimingRing::writeTrace(std::string const& path) const
+{
+    auto const records = snapshot();
+
+    std::ofstream trace(path, std::ios::binary);
+    if (!trace)
+    {
+        TLLM_LOG_ERROR("Failed to open decoder timing trace file: %s", path.c_str());
+        return false;
+    }
+
+    char const magic[4] = {'T', 'L', 'D', 'T'};
+    uint32_t const version = 1;
+    uint32_t const numRecords = static_cast<uint32_t>(records.size());
+    trace.write(magic, sizeof(magic));
+    trace.write(reinterpret_cast<char const*>(&version), sizeof(version));
+    trace.write(reinterpret_cast<char const*>(&numRecords), sizeof(numRecords));
+
+    for (auto const& record : records)
+    {
+        trace.write(reinterpret_cast<char const*>(&record.iteration), sizeof(record.iteration));
+        trace.write(reinterpret_cast<char const*>(&record.dispatchTimeNs), sizeof(record.dispatchTimeNs));
+        trace.write(reinterpret_cast<char const*>(&record.gpuMs), sizeof(record.gpuMs));
+        trace.write(reinterpret_cast<char const*>(&record.numSequences), sizeof(record.numSequences));
+        trace.write(reinterpret_cast<char const*>(&record.beamWidth), sizeof(record.beamWidth));
+        trace.write(reinterpret_cast<char const*>(&record.maxDecoderSteps), sizeof(record.maxDecoderSteps));
+        trace.write(reinterpret_cast<char const*>(&record.graphReplay), sizeof(record.graphReplay));
+    }
+    TLLM_LOG_INFO("Wrote decoder timing trace with %u records to %s", numRecords, path.c_str());
+    return true;
+}
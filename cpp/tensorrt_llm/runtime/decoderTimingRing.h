@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/common.h"
+#include "tensorrt_llm/runtime/cudaEvent.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+namespace tensorrt_llm::runtime
+{
+
+//! Always-on ring of per-step decoder timings for attributing rare inter-token latency spikes that
+//! disappear under a profiler. Each decoder step contributes one fixed-size record: the host
+//! wall-clock timestamp of the dispatch, the GPU time of the step measured with a CUDA event pair
+//! on the decoder stream, and a summary of the batch the step ran on. Event pairs come from a small
+//! fixed pool and are resolved lazily on later steps, so recording never waits on the GPU and the
+//! per-step cost stays at two event records and a few stores.
+//!
+//! Recording happens on the single thread driving the decoder; snapshot() and writeTrace() may be
+//! called concurrently from another thread (e.g. a debug executor call) without a lock. Records are
+//! published through an atomic counter and a reader drops the few entries the writer may have
+//! overwritten while the copy was in flight.
+class DecoderTimingRing
+{
+public:
+    struct StepRecord
+    {
+        uint64_t iteration;     //!< Decoder step counter, starts at 0 and also serves as the publish index.
+        int64_t dispatchTimeNs; //!< Steady-clock timestamp on the host when the step was dispatched.
+        float gpuMs;            //!< GPU time of the step on the decoder stream.
+        SizeType32 numSequences;    //!< Number of batch slots in the first decoder step.
+        SizeType32 beamWidth;       //!< Maximum beam width of the decoder state.
+        SizeType32 maxDecoderSteps; //!< Decoder steps fused into this dispatch (draft tokens).
+        uint8_t graphReplay;        //!< Whether the step ran as a CUDA graph replay.
+    };
+
+    explicit DecoderTimingRing(SizeType32 capacity);
+
+    //! @brief Open the record for the next decoder step and record its start event on \p stream.
+    //! Also retires earlier steps whose events have completed on the GPU into the ring.
+    void beginStep(
+        SizeType32 numSequences, SizeType32 beamWidth, SizeType32 maxDecoderSteps, bool graphReplay, cudaStream_t stream);
+
+    //! @brief Record the stop event of the step opened by the last beginStep on \p stream.
+    void endStep(cudaStream_t stream);
+
+    //! @brief Copy the retired records, oldest first. Safe to call from any thread; steps still in
+    //! flight on the GPU and entries overwritten during the copy are not included.
+    [[nodiscard]] std::vector<StepRecord> snapshot() const;
+
+    //! @brief Write a snapshot as a binary trace. Format: "TLDT" magic, uint32 version, uint32
+    //! record count, then the StepRecord fields per record in declaration order, all little-endian
+    //! host layout.
+    //! @return Whether the trace file was written.
+    bool writeTrace(std::string const& path) const;
+
+private:
+    //! In-flight steps the GPU has not necessarily finished; bounds the number of live event pairs.
+    //! Reaching the bound means the GPU is this many decoder steps behind the host and the rare
+    //! synchronize on reuse is hidden by the backlog.
+    static constexpr SizeType32 kMaxPendingSteps{32};
+
+    struct PendingStep
+    {
+        StepRecord record{};
+        CudaEvent start{cudaEventDefault};
+        CudaEvent stop{cudaEventDefault};
+    };
+
+    //! @brief Retire pending steps whose stop event has completed. Only called from beginStep, so
+    //! every pending step already has its stop event recorded.
+    void retireCompleted();
+    void publish(StepRecord const& record);
+
+    std::vector<StepRecord> mRing;
+    SizeType32 mCapacity;
+    //! Number of records published to the ring; the writer bumps it with release ordering after
+    //! filling the slot, readers pair it with acquire loads.
+    std::atomic<uint64_t> mPublished{0};
+    uint64_t mNextIteration{0};
+
+    std::array<PendingStep, kMaxPendingSteps> mPendingPool;
+    SizeType32 mPendingHead{0};
+    SizeType32 mPendingCount{0};
+};
+
+} // namespace tensorrt_llm::runtime
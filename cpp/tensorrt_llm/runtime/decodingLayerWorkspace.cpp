@@ -54,6 +54,18 @@ void tensorrt_llm::runtime::DecodingLayerWorkspace::setDeviceBatchSlots(TensorCo
 {
     mBatchSlotsDevice->reshape(newBatchSlots->getShape());
     mBufferManager->copy(*newBatchSlots, *mBatchSlotsDevice);
+    // Keep a host mirror of the batch slots so that initializeDeviceCurandStates can track the seeding
+    // state of individual slots without reading back from device.
+    auto const memoryType = newBatchSlots->getMemoryType();
+    if (memoryType != MemoryType::kGPU)
+    {
+        auto const* newBatchSlotsPtr = tensorrt_llm::runtime::bufferCast<SizeType32>(*newBatchSlots);
+        mBatchSlotsHost.assign(newBatchSlotsPtr, newBatchSlotsPtr + newBatchSlots->getSize());
+    }
+    else
+    {
+        mBatchSlotsHost.clear();
+    }
 }
 
 tensorrt_llm::runtime::SizeType32 const* tensorrt_llm::runtime::DecodingLayerWorkspace::getDeviceBatchSlotsPtr() const
@@ -102,6 +114,46 @@ void tensorrt_llm::runtime::DecodingLayerWorkspace::initializeDeviceCurandStates
     // of all sentences by 0 directly.
     auto const* batchSlotsPtr = tensorrt_llm::runtime::bufferCast<tensorrt_llm::runtime::SizeType32>(*batchSlots);
     auto* curandStateDevicePtr = reinterpret_cast<curandState_t*>(statesDevice->data());
+    if (randomSeed && randomSeed->size() != 1)
+    {
+        TLLM_CHECK_WITH_INFO(static_cast<tensorrt_llm::runtime::SizeType32>(randomSeed->size()) == batchSize,
+            "Random seed vector size mismatch.");
+    }
+
+    // The curand states are device-resident and survive request turnover, so slots that already hold states
+    // for the requested seed do not have to be re-initialized. Setup is called on every request admission,
+    // typically with the same (often default) seed for slots that are already seeded; tracking the last seed
+    // per slot lets us drop the initialization kernel from that path entirely. The bookkeeping requires the
+    // batch slots to be the ones mirrored to the host in setDeviceBatchSlots.
+    auto const slotsKnown = batchSlots->data() == mBatchSlotsDevice->data()
+        && static_cast<size_t>(batchSize) <= mBatchSlotsHost.size();
+    if (slotsKnown)
+    {
+        auto const slotSeed = [&randomSeed](tensorrt_llm::runtime::SizeType32 bi) -> uint64_t
+        { return randomSeed ? (randomSeed->size() == 1 ? randomSeed->front() : (*randomSeed)[bi]) : 0; };
+        auto& seededSlots = mCurandSeedsPerSlot[statesDevice->data()];
+        auto allSeeded = true;
+        for (tensorrt_llm::runtime::SizeType32 bi = 0; bi < batchSize && allSeeded; ++bi)
+        {
+            auto const slot = static_cast<size_t>(mBatchSlotsHost[bi]);
+            allSeeded = slot < seededSlots.size() && seededSlots[slot] == slotSeed(bi);
+        }
+        if (allSeeded)
+        {
+            TLLM_LOG_TRACE("%s stop (all %i slots already seeded)", __PRETTY_FUNCTION__, batchSize);
+            return;
+        }
+        for (tensorrt_llm::runtime::SizeType32 bi = 0; bi < batchSize; ++bi)
+        {
+            auto const slot = static_cast<size_t>(mBatchSlotsHost[bi]);
+            if (slot >= seededSlots.size())
+            {
+                seededSlots.resize(slot + 1);
+            }
+            seededSlots[slot] = slotSeed(bi);
+        }
+    }
+
     if (randomSeed)
     {
         if (randomSeed->size() == 1)
@@ -111,8 +163,6 @@ void tensorrt_llm::runtime::DecodingLayerWorkspace::initializeDeviceCurandStates
         }
         else
         {
-            TLLM_CHECK_WITH_INFO(static_cast<tensorrt_llm::runtime::SizeType32>(randomSeed->size()) == batchSize,
-                "Random seed vector size mismatch.");
             auto randomSeedsDevice = copyToWorkspace(randomSeed.value());
             auto const* randomSeedsDevicePtr = tensorrt_llm::runtime::bufferCast<uint64_t>(*randomSeedsDevice);
             tensorrt_llm::kernels::invokeCurandBatchInitialize(
@@ -17,6 +17,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #include "tensorrt_llm/common/dataType.h"
 #include "tensorrt_llm/common/workspace.h"
@@ -161,6 +164,9 @@ public:
 
 private:
     std::shared_ptr<BufferManager> mBufferManager;
+    std::vector<SizeType32> mBatchSlotsHost; // <! Host mirror of mBatchSlotsDevice for host-side bookkeeping.
+    std::unordered_map<void const*, std::vector<std::optional<uint64_t>>>
+        mCurandSeedsPerSlot; // <! Last seed each slot of a curand state tensor was initialized with.
     TensorPtr mBatchSlotsDevice;    // <! A copy of the batch slots on device ensure fast access when used in kernels.
     TensorPtr mRuntimeLogitsDevice; // <! The working state of the logits while decoding.
     TensorPtr
@@ -25,6 +25,9 @@
 #include "tensorrt_llm/runtime/iBuffer.h"
 #include "tensorrt_llm/runtime/runtimeKernels.h"
 
+#include <algorithm>
+#include <numeric>
+
 namespace tksd = tensorrt_llm::kernels::speculative_decoding;
 
 namespace tensorrt_llm::runtime
@@ -195,6 +198,16 @@ EagleBuffers::EagleBuffers(SizeType32 maxBatchSize, SizeType32 maxBeamWidth, run
     cumSumGenerationLengths = manager.emptyTensor(runtime::MemoryType::kGPU, nvinfer1::DataType::kINT32);
     maxGenerationLength = manager.gpu(ITensor::makeShape({1}), nvinfer1::DataType::kINT32);
 
+    // Prebuilt draft-paths row for chunked-context requests: the first path walks 0..maxPathLen-1,
+    // every other entry is -1. setFromInputs stamps it onto a batch row with one device copy.
+    chunkedContextDraftPathsRow = manager.gpu(ITensor::makeShape({numPaths, pathLen}), nvinfer1::DataType::kINT32);
+    chunkedContextDraftPathsRowHost
+        = BufferManager::pinnedPool(ITensor::makeShape({numPaths, pathLen}), nvinfer1::DataType::kINT32);
+    auto* pathsRowPtr = bufferCast<SizeType32>(*chunkedContextDraftPathsRowHost);
+    std::fill(pathsRowPtr, pathsRowPtr + numPaths * pathLen, -1);
+    std::iota(pathsRowPtr, pathsRowPtr + pathLen, 0);
+    manager.copy(*chunkedContextDraftPathsRowHost, *chunkedContextDraftPathsRow);
+
     // pre-allocate empty tensors
     reshape(0, maxNumSequences, modelConfig);
 
@@ -418,6 +431,21 @@ void EagleBuffers::setFromInputs(RequestVector const& contextRequests, RequestVe
         posteriorThresholdHostPtr[batchIdx] = posteriorThreshold;
     };
 
+    // Device work is batched over rows: a contiguous run of last-chunk rows shares one draft-token
+    // fill and each chunked row gets its fake path stamped from the prebuilt row, so the launch
+    // count no longer grows with the number of context requests.
+    SizeType32 lastChunkRunBegin{-1};
+    auto flushLastChunkRun = [this, &lastChunkRunBegin, &manager](SizeType32 runEnd)
+    {
+        if (lastChunkRunBegin >= 0)
+        {
+            TensorPtr draftTokensRows
+                = ITensor::slice(engineInputs.draftTokens, lastChunkRunBegin, runEnd - lastChunkRunBegin);
+            runtime::kernels::invokeFill(*draftTokensRows, -1, manager.getStream());
+            lastChunkRunBegin = -1;
+        }
+    };
+
     for (auto const& llmReq : contextRequests)
     {
         if (llmReq->isLastContextChunk())
@@ -425,11 +453,14 @@ void EagleBuffers::setFromInputs(RequestVector const& contextRequests, RequestVe
             auto const batchSlot = params.batchSlots[batchIdx];
             setupEagleNetHostBuffers(batchIdx, batchSlot);
 
-            auto draftTokens = ITensor::slice(engineInputs.draftTokens, batchIdx, 1);
-            runtime::kernels::invokeFill(*draftTokens, -1, manager.getStream());
+            if (lastChunkRunBegin < 0)
+            {
+                lastChunkRunBegin = batchIdx;
+            }
         }
         else
         {
+            flushLastChunkRun(batchIdx);
             auto const contextChunkSize = llmReq->getContextChunkSize();
             auto const beginCompute = llmReq->getContextCurrentPosition();
             auto const endCompute = beginCompute + contextChunkSize;
@@ -447,18 +478,9 @@ void EagleBuffers::setFromInputs(RequestVector const& contextRequests, RequestVe
                 = beginCompute + contextChunkSize;
 
             // Setup fake path
-            TensorPtr draftPathsHostSlice = ITensor::at(engineInputs.draftPathsHost, {batchIdx, 1});
-
-            for (SizeType32 ti = 0; ti < eagleModule.getMaxPathLen(); ++ti)
-            {
-                bufferCast<SizeType32>(*draftPathsHostSlice)[ti] = ti;
-            }
-
             TensorPtr draftPathsBatchSlice = ITensor::slice(engineInputs.draftPaths, batchIdx, 1);
             draftPathsBatchSlice->squeeze(0);
-            kernels::invokeFill(*draftPathsBatchSlice, -1, manager.getStream());
-            TensorPtr draftPathsBatchPathSlice = ITensor::slice(draftPathsBatchSlice, 0, 1);
-            manager.copy(*draftPathsHostSlice, *draftPathsBatchPathSlice);
+            manager.copy(*chunkedContextDraftPathsRow, *draftPathsBatchSlice);
 
             auto const& reqTokens = llmReq->getTokens(0);
             chunkedContextNextTokensHostPtr[batchIdx] = reqTokens[endCompute];
@@ -468,6 +490,7 @@ void EagleBuffers::setFromInputs(RequestVector const& contextRequests, RequestVe
 
         ++batchIdx;
     }
+    flushLastChunkRun(numCtxSequences);
 
     for (auto const& llmReq : genRequests)
     {
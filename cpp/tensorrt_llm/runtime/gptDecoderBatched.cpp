@@ -22,10 +22,14 @@
 #include "tensorrt_llm/batch_manager/createNewDecoderRequests.h"
 #include "tensorrt_llm/batch_manager/llmRequest.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/executor/types.h"
 #include "tensorrt_llm/kernels/decodingKernels.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/cudaEvent.h"
+#include "tensorrt_llm/runtime/decoderTimingRing.h"
 
 #include <algorithm>
 #include <cassert>
@@ -39,6 +43,36 @@ GptDecoderBatched::GptDecoderBatched(GptDecoderBatched::CudaStreamPtr stream)
     : mRuntimeStream{std::move(stream)}
     , mBufferManager{mRuntimeStream}
 {
+    if (auto const ringSize = common::getEnvDecoderTimingRingSize(); ringSize > 0)
+    {
+        mTimingRing = std::make_unique<DecoderTimingRing>(static_cast<SizeType32>(ringSize));
+    }
+}
+
+GptDecoderBatched::~GptDecoderBatched()
+{
+    try
+    {
+        clearCudaGraphs();
+    }
+    catch (std::exception& e)
+    {
+        TLLM_LOG_EXCEPTION(e);
+    }
+}
+
+void GptDecoderBatched::clearCudaGraphs()
+{
+    for (auto& graph : mDecoderGraphs)
+    {
+        TLLM_CUDA_CHECK(cudaGraphExecDestroy(graph.instance));
+    }
+    mDecoderGraphs.clear();
+}
+
+bool GptDecoderBatched::writeTimingTrace(std::string const& path) const
+{
+    return mTimingRing && mTimingRing->writeTrace(path);
 }
 
 void GptDecoderBatched::disableLookahead(RequestVector const& genRequests, TensorPtr const& batchSlots)
@@ -79,6 +113,19 @@ void GptDecoderBatched::setup(executor::DecodingMode const& mode, SizeType32 max
     TLLM_CHECK(maxNumSequences > 0);
     TLLM_CHECK(maxBeamWidth > 0);
 
+    // Captured graphs bake in per-request decisions and buffer addresses from the previous setup.
+    clearCudaGraphs();
+
+    // The sampling workspace is sized for the allocated capacity and per-slot state is written when
+    // requests are set up, so a reconfiguration that fits the existing decoder reuses it. Only a
+    // capacity increase or a decoding mode or dtype change recreates the decoder.
+    if (mDecoder && mDecoderMode == mode && dtype == mDecoderDtype && maxNumSequences <= mDecoderMaxNumSequences
+        && maxBeamWidth <= mDecoderMaxBeamWidth)
+    {
+        TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+        return;
+    }
+
     std::shared_ptr<SpeculativeDecodingModule const> speculativeDecodingModulePtr = nullptr;
     if (modelConfig.getSpeculativeDecodingMode().predictsDraftTokens())
     {
@@ -95,6 +142,11 @@ void GptDecoderBatched::setup(executor::DecodingMode const& mode, SizeType32 max
     mDecoder = IGptDecoder::create(mode, dtype, maxNumSequences, maxBeamWidth, vocabSize, vocabSizePadded,
         mDecoderStream, speculativeDecodingModulePtr);
 
+    mDecoderMode = mode;
+    mDecoderMaxNumSequences = maxNumSequences;
+    mDecoderMaxBeamWidth = maxBeamWidth;
+    mDecoderDtype = dtype;
+
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
@@ -137,6 +189,15 @@ void prepareForward(decoder::DecoderState const& decoderState, SizeType32 step,
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+//! @brief Whether one decoder iteration can be captured into a CUDA graph.
+//! Speculative decoding and beam search interleave host-side logic with the kernels, and multi-step
+//! inputs reset state on the host in prepareForward; neither can be replayed.
+bool isGraphReplayable(decoder::DecoderState const& decoderState, decoder_batch::Input const& input)
+{
+    return decoderState.getSpeculativeDecodingMode().isNone() && decoderState.getMaxBeamWidth() == 1
+        && input.maxDecoderSteps == 1 && input.batchSlots.at(0)->getSize() > 0;
+}
+
 } // namespace
 
 void GptDecoderBatched::forwardDispatch(decoder::DecoderState const& decoderState, decoder_batch::Input const& input)
@@ -157,6 +218,56 @@ void GptDecoderBatched::forwardDispatch(decoder::DecoderState const& decoderStat
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
 
+void GptDecoderBatched::forwardGraph(decoder::DecoderState const& decoderState, decoder_batch::Input const& input)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+
+    auto const& batchSlots = input.batchSlots.at(0);
+
+    // The input layout the graph is valid for: the addresses of the batch slots and logits tensors, and the
+    // batch slot values. The latter guard against a batch of the same shape with different active requests.
+    std::vector<void const*> inputPointers;
+    inputPointers.reserve(input.logits.at(0).size() + 1);
+    inputPointers.push_back(batchSlots->data());
+    for (auto const& logits : input.logits.at(0))
+    {
+        inputPointers.push_back(logits->data());
+    }
+    auto batchSlotsRange = BufferRange<SizeType32 const>(*batchSlots);
+    std::vector<SizeType32> batchSlotValues(batchSlotsRange.begin(), batchSlotsRange.end());
+
+    auto graphIt = std::find_if(mDecoderGraphs.begin(), mDecoderGraphs.end(),
+        [&inputPointers, &batchSlotValues](DecoderGraph const& graph)
+        { return graph.inputPointers == inputPointers && graph.batchSlotValues == batchSlotValues; });
+    if (graphIt == mDecoderGraphs.end())
+    {
+        // Capture one decoder iteration. The capture enqueues no work, the instance is launched below.
+        cudaGraph_t graph;
+        TLLM_CUDA_CHECK(cudaStreamBeginCapture(mDecoderStream->get(), cudaStreamCaptureModeThreadLocal));
+        forwardDispatch(decoderState, input);
+        TLLM_CUDA_CHECK(cudaStreamEndCapture(mDecoderStream->get(), &graph));
+
+        cudaGraphExec_t instance;
+        TLLM_CUDA_CHECK(cudaGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+        TLLM_CUDA_CHECK(cudaGraphDestroy(graph));
+
+        if (static_cast<SizeType32>(mDecoderGraphs.size()) >= kMaxDecoderGraphs)
+        {
+            TLLM_CUDA_CHECK(cudaGraphExecDestroy(mDecoderGraphs.back().instance));
+            mDecoderGraphs.pop_back();
+        }
+        mDecoderGraphs.push_front(DecoderGraph{std::move(inputPointers), std::move(batchSlotValues), instance});
+    }
+    else
+    {
+        mDecoderGraphs.splice(mDecoderGraphs.begin(), mDecoderGraphs, graphIt);
+    }
+
+    TLLM_CUDA_CHECK(cudaGraphLaunch(mDecoderGraphs.front().instance, mDecoderStream->get()));
+
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
+
 CudaEvent GptDecoderBatched::forwardAsync(decoder::DecoderState const& decoderState, decoder_batch::Input const& input)
 {
     TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
@@ -165,7 +276,27 @@ CudaEvent GptDecoderBatched::forwardAsync(decoder::DecoderState const& decoderSt
     mRuntimeStream->record(eventStart);
     mDecoderStream->wait(eventStart.get());
 
-    forwardDispatch(decoderState, input);
+    bool const graphReplay = mCudaGraphMode && isGraphReplayable(decoderState, input);
+    if (mTimingRing)
+    {
+        // The events bracket the dispatch on the decoder stream, outside any graph capture.
+        mTimingRing->beginStep(static_cast<SizeType32>(input.batchSlots.at(0)->getSize()),
+            decoderState.getMaxBeamWidth(), input.maxDecoderSteps, graphReplay, mDecoderStream->get());
+    }
+
+    if (graphReplay)
+    {
+        forwardGraph(decoderState, input);
+    }
+    else
+    {
+        forwardDispatch(decoderState, input);
+    }
+
+    if (mTimingRing)
+    {
+        mTimingRing->endStep(mDecoderStream->get());
+    }
 
     CudaEvent event{};
     mDecoderStream->record(event);
@@ -19,6 +19,7 @@
 #include "common.h"
 #include "modelConfig.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/eagleModule.h"
 #include "tensorrt_llm/runtime/explicitDraftTokensModule.h"
@@ -28,8 +29,11 @@
 #include "tensorrt_llm/runtime/modelConfig.h"
 #include "tensorrt_llm/runtime/runtimeDefaults.h"
 
+#include <chrono>
 #include <fstream>
+#include <iterator>
 #include <nlohmann/json.hpp>
+#include <optional>
 #include <string_view>
 #include <utility>
 
@@ -442,13 +446,8 @@ void parseLora(ModelConfig& modelConfig, Json const& json, Json const& pluginCon
     modelConfig.useLoraPlugin(useLoraPlugin);
 }
 
-template <typename InputType>
-GptJsonConfig parseJson(InputType&& input)
+GptJsonConfig parseJson(Json const& json)
 {
-    auto constexpr allowExceptions = true;
-    auto constexpr ignoreComments = true;
-    auto const json = nlohmann::json::parse(std::forward<InputType>(input), nullptr, allowExceptions, ignoreComments);
-
     auto const engineVersion = parseJsonFieldOr(json, "version", std::string("none"));
 
     auto const engineVersionNone = engineVersion == std::string("none");
@@ -698,6 +697,90 @@ GptJsonConfig parseJson(InputType&& input)
         gpusPerNode, modelConfig, runtimeDefaults};
 }
 
+template <typename InputType>
+GptJsonConfig parseJson(InputType&& input)
+{
+    auto constexpr allowExceptions = true;
+    auto constexpr ignoreComments = true;
+    return parseJson(nlohmann::json::parse(std::forward<InputType>(input), nullptr, allowExceptions, ignoreComments));
+}
+
+// The binary config cache stores the engine config as CBOR beside config.json so every rank and
+// every executor restart can skip tokenizing the JSON text, which reaches several MBs for MoE
+// engines. All local ranks read the same file (sharing the OS page cache) and a content hash of
+// config.json in the header invalidates the cache whenever the engine config changes.
+constexpr uint32_t kConfigCacheMagic = 0x544c4343; // "TLCC"
+constexpr uint32_t kConfigCacheVersion = 1;
+
+uint64_t hashConfigText(std::string const& text)
+{
+    // FNV-1a, 64 bit.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (char const c : text)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::optional<Json> readConfigCache(std::filesystem::path const& cachePath, uint64_t expectedHash)
+{
+    std::ifstream file(cachePath, std::ios::binary);
+    if (!file)
+    {
+        return std::nullopt;
+    }
+    try
+    {
+        uint32_t magic{0};
+        uint32_t version{0};
+        uint64_t hash{0};
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+        if (!file || magic != kConfigCacheMagic || version != kConfigCacheVersion || hash != expectedHash)
+        {
+            return std::nullopt;
+        }
+        return Json::from_cbor(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_WARNING("Ignoring unreadable engine config cache %s: %s", cachePath.string().c_str(), e.what());
+        return std::nullopt;
+    }
+}
+
+void writeConfigCache(std::filesystem::path const& cachePath, uint64_t hash, Json const& json)
+{
+    // Best effort: the engine directory may be read-only and several ranks may race to populate
+    // the cache. Write to a unique temporary file and rename it into place so readers never
+    // observe a partial cache; the last writer wins with identical content.
+    try
+    {
+        auto const payload = Json::to_cbor(json);
+        auto const uniqueSuffix = std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+        auto const tmpPath = std::filesystem::path{cachePath.string() + "." + uniqueSuffix + ".tmp"};
+        {
+            std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!file)
+            {
+                return;
+            }
+            file.write(reinterpret_cast<char const*>(&kConfigCacheMagic), sizeof(kConfigCacheMagic));
+            file.write(reinterpret_cast<char const*>(&kConfigCacheVersion), sizeof(kConfigCacheVersion));
+            file.write(reinterpret_cast<char const*>(&hash), sizeof(hash));
+            file.write(reinterpret_cast<char const*>(payload.data()), payload.size());
+        }
+        std::filesystem::rename(tmpPath, cachePath);
+    }
+    catch (std::exception const& e)
+    {
+        TLLM_LOG_DEBUG("Could not write engine config cache %s: %s", cachePath.string().c_str(), e.what());
+    }
+}
+
 } // namespace
 
 std::string GptJsonConfig::engineFilename(WorldConfig const& worldConfig, std::string const& model) const
@@ -735,6 +818,23 @@ GptJsonConfig GptJsonConfig::parse(std::istream& json)
 GptJsonConfig GptJsonConfig::parse(std::filesystem::path const& path)
 {
     TLLM_CHECK_WITH_INFO(std::filesystem::exists(path), std::string("File does not exist: ") + path.string());
-    std::ifstream json(path);
-    return parse(json);
+    std::ifstream file(path, std::ios::binary);
+    std::string const text{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    if (tc::getEnvDisableEngineConfigCache())
+    {
+        return parse(text);
+    }
+    auto const hash = hashConfigText(text);
+    auto const cachePath = std::filesystem::path{path.string() + ".cache"};
+    if (auto const cached = readConfigCache(cachePath, hash))
+    {
+        TLLM_LOG_DEBUG("Loaded engine config %s from binary cache", path.string().c_str());
+        return parseJson(*cached);
+    }
+    auto constexpr allowExceptions = true;
+    auto constexpr ignoreComments = true;
+    auto const json = Json::parse(text, nullptr, allowExceptions, ignoreComments);
+    auto config = parseJson(json);
+    writeConfigCache(cachePath, hash, json);
+    return config;
 }
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/iterationProfiler.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <fstream>
+
+using namespace tensorrt_llm::runtime;
+
+IterationProfiler::PendingIteration::PendingIteration(uint64_t iteration)
+    : iteration{iteration}
+    , hostMs{}
+    , hasEvents{}
+{
+    start.reserve(kNumStages);
+    stop.reserve(kNumStages);
+    for (SizeType32 si = 0; si < kNumStages; ++si)
+    {
+        start.emplace_back(cudaEventDefault);
+        stop.emplace_back(cudaEventDefault);
+    }
+}
+
+IterationProfiler::IterationProfiler(SizeType32 capacity)
+    : mRing(capacity)
+    , mCapacity{capacity}
+{
+    TLLM_CHECK_WITH_INFO(capacity > 0, "IterationProfiler capacity must be positive");
+}
+
+void IterationProfiler::beginIteration(uint64_t iteration)
+{
+    // Retire iterations whose last recorded event has completed. Pending iterations finish in
+    // stream order, so stop at the first one that is still running.
+    while (!mPending.empty())
+    {
+        auto& pending = mPending.front();
+        bool done = true;
+        for (SizeType32 si = 0; si < kNumStages && done; ++si)
+        {
+            if (pending.hasEvents[si])
+            {
+                done = ::cudaEventQuery(pending.stop[si].get()) == cudaSuccess;
+            }
+        }
+        if (!done)
+        {
+            break;
+        }
+        retire(pending);
+        mPending.pop_front();
+    }
+    mPending.emplace_back(iteration);
+}
+
+void IterationProfiler::recordStart(Stage stage, cudaStream_t stream)
+{
+    TLLM_CHECK(!mPending.empty());
+    TLLM_CUDA_CHECK(::cudaEventRecord(mPending.back().start[static_cast<SizeType32>(stage)].get(), stream));
+}
+
+void IterationProfiler::recordStop(Stage stage, cudaStream_t stream)
+{
+    TLLM_CHECK(!mPending.empty());
+    auto& pending = mPending.back();
+    TLLM_CUDA_CHECK(::cudaEventRecord(pending.stop[static_cast<SizeType32>(stage)].get(), stream));
+    pending.hasEvents[static_cast<SizeType32>(stage)] = true;
+}
+
+void IterationProfiler::addHostTime(Stage stage, float timeMs)
+{
+    if (mPending.empty())
+    {
+        return;
+    }
+    mPending.back().hostMs[static_cast<SizeType32>(stage)] += timeMs;
+}
+
+void IterationProfiler::retire(PendingIteration& pending)
+{
+    IterationProfile profile{pending.iteration, pending.hostMs};
+    for (SizeType32 si = 0; si < kNumStages; ++si)
+    {
+        if (pending.hasEvents[si])
+        {
+            float elapsedMs{0.F};
+            TLLM_CUDA_CHECK(::cudaEventElapsedTime(&elapsedMs, pending.start[si].get(), pending.stop[si].get()));
+            profile.stageMs[si] += elapsedMs;
+        }
+    }
+    mRing[mWriteIndex] = profile;
+    mWriteIndex = (mWriteIndex + 1) % mCapacity;
+    mSize = std::min(mSize + 1, mCapacity);
+}
+
+void IterationProfiler::finalize()
+{
+    for (auto& pending : mPending)
+    {
+        for (SizeType32 si = 0; si < kNumStages; ++si)
+        {
+            if (pending.hasEvents[si])
+            {
+                pending.stop[si].synchronize();
+            }
+        }
+        retire(pending);
+    }
+    mPending.clear();
+}
+
+void IterationProfiler::writeTrace(std::string const& path)
+{
+    finalize();
+
+    std::ofstream trace(path, std::ios::binary);
+    if (!trace)
+    {
+        TLLM_LOG_ERROR("Failed to open iteration profiler trace file: %s", path.c_str());
+        return;
+    }
+
+    char const magic[4] = {'T', 'L', 'I', 'P'};
+    uint32_t const version = 1;
+    uint32_t const numStages = kNumStages;
+    uint32_t const numRecords = mSize;
+    trace.write(magic, sizeof(magic));
+    trace.write(reinterpret_cast<char const*>(&version), sizeof(version));
+    trace.write(reinterpret_cast<char const*>(&numStages), sizeof(numStages));
+    trace.write(reinterpret_cast<char const*>(&numRecords), sizeof(numRecords));
+
+    // Emit oldest first so the trace is in iteration order.
+    auto const firstIndex = mSize < mCapacity ? 0 : mWriteIndex;
+    for (SizeType32 ri = 0; ri < mSize; ++ri)
+    {
+        auto const& record = mRing[(firstIndex + ri) % mCapacity];
+        trace.write(reinterpret_cast<char const*>(&record.iteration), sizeof(record.iteration));
+        trace.write(reinterpret_cast<char const*>(record.stageMs.data()), sizeof(float) * kNumStages);
+    }
+    TLLM_LOG_INFO("Wrote iteration profiler trace with %u records to %s", numRecords, path.c_str());
+}
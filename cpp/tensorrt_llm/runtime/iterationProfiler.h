@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/common.h"
+#include "tensorrt_llm/runtime/cudaEvent.h"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <cuda_runtime_api.h>
+
+namespace tensorrt_llm::runtime
+{
+
+//! Always-on per-iteration stage profiler. GPU stages are bracketed with CUDA event pairs recorded
+//! on the forward stream; host stages are measured with wall-clock time. Completed iterations are
+//! kept in a fixed-size ring buffer, so the cost per iteration is a handful of event records and
+//! the memory footprint is bounded. Unlike LayerProfiler this does not go through the TensorRT
+//! IProfiler interface and does not serialize engine execution.
+//!
+//! All methods are expected to be called from the thread driving the model forward; resolving
+//! finished event pairs is deferred to the next iteration so the profiler never blocks on the GPU.
+class IterationProfiler
+{
+public:
+    enum class Stage : SizeType32
+    {
+        kSCHEDULE = 0,
+        kENGINE,
+        kDECODE,
+        kTRANSFER,
+        kNUM_STAGES,
+    };
+
+    static constexpr auto kNumStages = static_cast<SizeType32>(Stage::kNUM_STAGES);
+
+    struct IterationProfile
+    {
+        uint64_t iteration;
+        std::array<float, kNumStages> stageMs;
+    };
+
+    explicit IterationProfiler(SizeType32 capacity);
+
+    //! @brief Open the record for the given iteration. Also resolves event pairs of earlier
+    //! iterations that have completed on the GPU and retires them into the ring buffer.
+    void beginIteration(uint64_t iteration);
+
+    //! @brief Record the start event of a GPU stage on \p stream.
+    void recordStart(Stage stage, cudaStream_t stream);
+
+    //! @brief Record the stop event of a GPU stage on \p stream.
+    void recordStop(Stage stage, cudaStream_t stream);
+
+    //! @brief Add host wall-clock time to a stage of the most recently opened iteration.
+    void addHostTime(Stage stage, float timeMs);
+
+    //! @brief Wait for all pending iterations and retire them into the ring buffer.
+    void finalize();
+
+    //! @brief Write the retired iterations as a binary trace. Format: "TLIP" magic, uint32 version,
+    //! uint32 stage count, uint32 record count, then per record a uint64 iteration index and one
+    //! float per stage (milliseconds), all little-endian host layout.
+    void writeTrace(std::string const& path);
+
+private:
+    struct PendingIteration
+    {
+        explicit PendingIteration(uint64_t iteration);
+
+        uint64_t iteration;
+        std::array<float, kNumStages> hostMs;
+        std::array<bool, kNumStages> hasEvents;
+        std::vector<CudaEvent> start;
+        std::vector<CudaEvent> stop;
+    };
+
+    void retire(PendingIteration& pending);
+
+    std::deque<PendingIteration> mPending;
+    std::vector<IterationProfile> mRing;
+    SizeType32 mCapacity;
+    SizeType32 mWriteIndex{0};
+    SizeType32 mSize{0};
+};
+
+} // namespace tensorrt_llm::runtime
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/memoryProfiler.h"
+
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <fstream>
+#include <sstream>
+
+#if !defined(_MSC_VER)
+#include <execinfo.h>
+#endif
+
+namespace tc = tensorrt_llm::common;
+
+namespace tensorrt_llm::runtime
+{
+
+namespace
+{
+
+std::uint64_t hashFrames(void* const* frames, SizeType32 depth)
+{
+    auto constexpr kOffsetBasis = 0xcbf29ce484222325ull;
+    auto constexpr kPrime = 0x00000100000001b3ull;
+    auto hash = kOffsetBasis;
+    for (SizeType32 i = 0; i < depth; ++i)
+    {
+        hash = (hash ^ reinterpret_cast<std::uintptr_t>(frames[i])) * kPrime;
+    }
+    return hash;
+}
+
+std::size_t memoryTypeIdx(MemoryType memoryType)
+{
+    return static_cast<std::size_t>(memoryType);
+}
+
+} // namespace
+
+std::atomic<bool> MemoryProfiler::mEnabled{tc::getEnvEnableMemoryProfiler()};
+
+MemoryProfiler& MemoryProfiler::getInstance()
+{
+    static MemoryProfiler instance;
+    return instance;
+}
+
+void MemoryProfiler::recordAlloc(MemoryType memoryType, void const* ptr, std::size_t size)
+{
+    std::array<void*, kMaxFrames> frames{};
+    SizeType32 depth{0};
+#if !defined(_MSC_VER)
+    depth = backtrace(frames.data(), kMaxFrames);
+#endif
+    auto const siteId = hashFrames(frames.data(), depth);
+
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto& site = mSites[siteId];
+    if (site.depth == 0)
+    {
+        site.frames = frames;
+        site.depth = depth;
+    }
+    auto const idx = memoryTypeIdx(memoryType);
+    site.inUseBytes[idx] += size;
+    site.inUseObjects[idx] += 1;
+    site.allocBytes[idx] += size;
+    site.allocObjects[idx] += 1;
+    mLiveAllocs[ptr] = LiveAlloc{siteId, memoryType, size};
+}
+
+void MemoryProfiler::recordFree(void const* ptr)
+{
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto liveIt = mLiveAllocs.find(ptr);
+    if (liveIt == mLiveAllocs.end())
+    {
+        // Allocated before the profiler was enabled.
+        return;
+    }
+    auto const& alloc = liveIt->second;
+    auto siteIt = mSites.find(alloc.siteId);
+    if (siteIt != mSites.end())
+    {
+        auto const idx = memoryTypeIdx(alloc.memoryType);
+        siteIt->second.inUseBytes[idx] -= alloc.size;
+        siteIt->second.inUseObjects[idx] -= 1;
+    }
+    mLiveAllocs.erase(liveIt);
+}
+
+std::string MemoryProfiler::toPprofProfile(std::optional<MemoryType> memoryType) const
+{
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    auto const sumOver = [&memoryType](std::array<std::size_t, 5> const& values)
+    {
+        if (memoryType)
+        {
+            return values[memoryTypeIdx(*memoryType)];
+        }
+        std::size_t sum{0};
+        for (auto value : values)
+        {
+            sum += value;
+        }
+        return sum;
+    };
+
+    std::size_t totalInUseBytes{0}, totalInUseObjects{0}, totalAllocBytes{0}, totalAllocObjects{0};
+    for (auto const& [siteId, site] : mSites)
+    {
+        totalInUseBytes += sumOver(site.inUseBytes);
+        totalInUseObjects += sumOver(site.inUseObjects);
+        totalAllocBytes += sumOver(site.allocBytes);
+        totalAllocObjects += sumOver(site.allocObjects);
+    }
+
+    std::ostringstream buf;
+    buf << "heap profile: " << totalInUseObjects << ": " << totalInUseBytes << " [" << totalAllocObjects << ": "
+        << totalAllocBytes << "] @ heapprofile\n";
+    for (auto const& [siteId, site] : mSites)
+    {
+        auto const allocObjects = sumOver(site.allocObjects);
+        if (allocObjects == 0)
+        {
+            continue;
+        }
+        buf << sumOver(site.inUseObjects) << ": " << sumOver(site.inUseBytes) << " [" << allocObjects << ": "
+            << sumOver(site.allocBytes) << "] @";
+        // Frame 0 is recordAlloc itself; pprof expects the caller chain only.
+        for (SizeType32 i = 1; i < site.depth; ++i)
+        {
+            buf << " " << site.frames[i];
+        }
+        buf << "\n";
+    }
+    buf << "\nMAPPED_LIBRARIES:\n";
+    std::ifstream maps{"/proc/self/maps"};
+    if (maps)
+    {
+        buf << maps.rdbuf();
+    }
+    return buf.str();
+}
+
+void MemoryProfiler::writeProfile(std::string const& path, std::optional<MemoryType> memoryType) const
+{
+    std::ofstream out{path};
+    if (!out)
+    {
+        TLLM_LOG_WARNING("Failed to open '%s' for writing the memory profile", path.c_str());
+        return;
+    }
+    out << toPprofProfile(memoryType);
+    TLLM_LOG_INFO("Wrote memory profile to '%s'", path.c_str());
+}
+
+void MemoryProfiler::reset()
+{
+    std::lock_guard<std::mutex> lock{mMutex};
+    mSites.clear();
+    mLiveAllocs.clear();
+}
+
+} // namespace tensorrt_llm::runtime
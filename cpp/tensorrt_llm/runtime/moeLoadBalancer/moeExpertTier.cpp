@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "moeExpertTier.h"
+
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "moeLoadBalancer.h"
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/logger.h"
+
+namespace tensorrt_llm::runtime
+{
+
+MoeExpertTierManager::MoeExpertTierManager(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, int warmExpertCount)
+    : mMetaInfo(metaInfo)
+    , mWarmExpertCount(warmExpertCount)
+{
+    TLLM_CHECK_WITH_INFO(warmExpertCount > 0 && warmExpertCount <= metaInfo.expertCount,
+        "warmExpertCount (%d) should be in range (0, %d]", warmExpertCount, metaInfo.expertCount);
+    mDecayedLoad.resize(metaInfo.expertCount, 0.0f);
+    // Until the first statistics arrive every file-backed expert counts as warm, matching the
+    // page cache state right after the loader touched the weights.
+    mExpertWarm.resize(metaInfo.expertCount, true);
+}
+
+MoeExpertTierManager::~MoeExpertTierManager()
+{
+    for (auto& expertMappings : mColdMappings)
+    {
+        for (auto& mapping : expertMappings.second)
+        {
+            if (munmap(mapping.mapBase, mapping.mapLength) != 0)
+            {
+                TLLM_LOG_WARNING("munmap failed for expert %d cold weight mapping", expertMappings.first);
+            }
+        }
+    }
+}
+
+MoeWeight MoeExpertTierManager::mapColdWeight(
+    int expertId, std::string const& filePath, size_t fileOffset, size_t height, size_t width, size_t pitch)
+{
+    TLLM_CHECK_WITH_INFO(expertId >= 0 && expertId < mMetaInfo.expertCount, "expertId (%d) should be in range[0, %d)",
+        expertId, mMetaInfo.expertCount);
+    TLLM_CHECK_WITH_INFO(height > 0 && width > 0 && pitch >= width, "Invalid shape Height=%ld, Width=%ld, Pitch=%ld",
+        height, width, pitch);
+
+    int fd = open(filePath.c_str(), O_RDONLY);
+    TLLM_CHECK_WITH_INFO(fd >= 0, "Cannot open weight file %s", filePath.c_str());
+
+    // mmap requires a page aligned file offset; map from the enclosing page boundary and
+    // point the weight into the mapping.
+    size_t const pageSize = sysconf(_SC_PAGESIZE);
+    size_t const mapOffset = fileOffset & ~(pageSize - 1);
+    size_t const offsetInMap = fileOffset - mapOffset;
+    size_t const mapLength = offsetInMap + height * pitch;
+
+    void* mapBase = mmap(nullptr, mapLength, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(mapOffset));
+    close(fd);
+    TLLM_CHECK_WITH_INFO(
+        mapBase != MAP_FAILED, "Cannot map %ld bytes at offset %ld of %s", mapLength, fileOffset, filePath.c_str());
+    // The mapping is read sequentially row by row during slot updates.
+    madvise(mapBase, mapLength, MADV_SEQUENTIAL);
+
+    mColdMappings[expertId].push_back(ColdMapping{mapBase, mapLength});
+
+    MoeWeight weight;
+    weight.mWeightPtr = static_cast<char*>(mapBase) + offsetInMap;
+    weight.mHeight = height;
+    weight.mWidth = width;
+    weight.mPitch = pitch;
+    return weight;
+}
+
+void MoeExpertTierManager::adviseExpert(int expertId, int advice)
+{
+    auto it = mColdMappings.find(expertId);
+    if (it == mColdMappings.end())
+    {
+        return;
+    }
+    for (auto& mapping : it->second)
+    {
+        if (madvise(mapping.mapBase, mapping.mapLength, advice) != 0)
+        {
+            TLLM_LOG_WARNING("madvise(%d) failed for expert %d cold weight mapping", advice, expertId);
+        }
+    }
+}
+
+void MoeExpertTierManager::updateTiers(float const* expertLoadFactor)
+{
+    for (int expertId = 0; expertId < mMetaInfo.expertCount; ++expertId)
+    {
+        mDecayedLoad[expertId] = mDecayedLoad[expertId] * kLoadDecayFactor + expertLoadFactor[expertId];
+    }
+
+    if (mColdMappings.empty() || mWarmExpertCount >= static_cast<int>(mColdMappings.size()))
+    {
+        return;
+    }
+
+    // Rank only the file-backed experts; the warm set is the mWarmExpertCount hottest of them.
+    std::vector<int> tieredExperts;
+    tieredExperts.reserve(mColdMappings.size());
+    for (auto const& expertMappings : mColdMappings)
+    {
+        tieredExperts.push_back(expertMappings.first);
+    }
+    std::nth_element(tieredExperts.begin(), tieredExperts.begin() + mWarmExpertCount - 1, tieredExperts.end(),
+        [this](int lhs, int rhs) { return mDecayedLoad[lhs] > mDecayedLoad[rhs]; });
+
+    std::vector<bool> newWarm(mMetaInfo.expertCount, true);
+    for (size_t i = mWarmExpertCount; i < tieredExperts.size(); ++i)
+    {
+        newWarm[tieredExperts[i]] = false;
+    }
+
+    for (int expertId = 0; expertId < mMetaInfo.expertCount; ++expertId)
+    {
+        if (newWarm[expertId] && !mExpertWarm[expertId])
+        {
+            // Promotion: start readahead from NVMe so a following slot copy finds the pages resident.
+            adviseExpert(expertId, MADV_WILLNEED);
+        }
+        else if (!newWarm[expertId] && mExpertWarm[expertId])
+        {
+            // Demotion: return the pages to the kernel; a later access repages from the file.
+            adviseExpert(expertId, MADV_DONTNEED);
+        }
+    }
+    mExpertWarm.swap(newWarm);
+}
+
+bool MoeExpertTierManager::isExpertWarm(int expertId) const
+{
+    TLLM_CHECK_WITH_INFO(expertId >= 0 && expertId < mMetaInfo.expertCount, "expertId (%d) should be in range[0, %d)",
+        expertId, mMetaInfo.expertCount);
+    return mExpertWarm[expertId];
+}
+
+} // namespace tensorrt_llm::runtime
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2022-2025, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tensorrt_llm/kernels/moeLoadBalance/moeLoadBalanceCommon.h"
+
+namespace tensorrt_llm::runtime
+{
+
+struct MoeWeight;
+
+/**
+ * @brief Per-layer expert weight tiering between host memory and NVMe.
+ *
+ * The load balancer already keeps the hot tier (device weight slots) and the warm tier
+ * (host weights) — this class adds the cold tier. Cold expert weights stay in files on
+ * NVMe and are exposed to the weight updater as read-only file-backed mappings, so a
+ * slot update for a cold expert demand-pages the bytes straight from disk. Between
+ * iterations the manager re-ranks experts by a decayed sum of the routing statistics
+ * (the same expertLoadFactor that drives replication and placement) and keeps only the
+ * top experts' pages resident: promoted experts get asynchronous readahead, demoted
+ * ones have their pages dropped back to the page cache. Host memory thus holds the warm
+ * working set instead of every expert, which is what makes weights larger than host +
+ * device memory servable.
+ */
+class MoeExpertTierManager
+{
+public:
+    /**
+     * @brief Construct a tier manager for one MOE layer.
+     *
+     * @param metaInfo Layer meta info; only expertCount is used.
+     * @param warmExpertCount How many file-backed experts to keep resident in host memory.
+     */
+    MoeExpertTierManager(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, int warmExpertCount);
+
+    ~MoeExpertTierManager();
+
+    MoeExpertTierManager(MoeExpertTierManager const&) = delete;
+    MoeExpertTierManager& operator=(MoeExpertTierManager const&) = delete;
+
+    /**
+     * @brief Map one expert weight from its NVMe file.
+     *
+     * The region [fileOffset, fileOffset + height * pitch) of filePath is mapped
+     * read-only and shared, so it consumes host memory only while its pages are
+     * resident. The returned weight has the mapped pointer filled in and can be handed
+     * to the weight updater like any host weight.
+     *
+     * @param expertId The expert the weight belongs to, used for tiering decisions.
+     * @param filePath Path of the weight file on NVMe.
+     * @param fileOffset Byte offset of the weight inside the file, no alignment required.
+     * @param height Weight height in rows, see MoeWeight.
+     * @param width Weight row size in bytes, see MoeWeight.
+     * @param pitch Distance between consecutive rows in bytes, see MoeWeight.
+     * @return MoeWeight The mapped, host-readable weight view.
+     */
+    MoeWeight mapColdWeight(
+        int expertId, std::string const& filePath, size_t fileOffset, size_t height, size_t width, size_t pitch);
+
+    /**
+     * @brief Re-tier the file-backed experts from this iteration's routing statistics.
+     *
+     * Accumulates expertLoadFactor into a decayed per-expert load, recomputes the warm
+     * set and issues the readahead/drop advice for experts that changed tier. Called
+     * between iterations from the weight update routine, before the slot copies, so
+     * promotion readahead overlaps the placement computation.
+     *
+     * @param expertLoadFactor This iteration's load factor, length expertCount.
+     */
+    void updateTiers(float const* expertLoadFactor);
+
+    /**
+     * @brief Whether the given expert is currently in the warm (host resident) tier.
+     * Experts without file-backed weights are always warm.
+     */
+    bool isExpertWarm(int expertId) const;
+
+    /**
+     * @brief Decay factor applied to the accumulated load each iteration.
+     */
+    static constexpr float kLoadDecayFactor = 0.95f;
+
+private:
+    struct ColdMapping
+    {
+        void* mapBase = nullptr;
+        size_t mapLength = 0;
+    };
+
+    void adviseExpert(int expertId, int advice);
+
+    tensorrt_llm::kernels::MoeLoadBalanceMetaInfo mMetaInfo;
+    int mWarmExpertCount;
+
+    // All file-backed mappings of one expert; experts absent from this map are not tiered.
+    std::map<int, std::vector<ColdMapping>> mColdMappings;
+    std::vector<float> mDecayedLoad;
+    std::vector<bool> mExpertWarm;
+};
+
+} // namespace tensorrt_llm::runtime
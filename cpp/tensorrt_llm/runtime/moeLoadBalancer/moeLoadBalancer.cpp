@@ -16,6 +16,7 @@
 
 #include "moeLoadBalancer.h"
 #include "hostAccessibleDeviceAllocator.h"
+#include "moeExpertTier.h"
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/kernels/moeLoadBalance/moeLoadBalanceKernels.h"
@@ -152,6 +153,8 @@ void doPlacement(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, float*
     // 3. Maintain Rank state and initialize Priority Queue
     std::vector<double> currentRankLoad(metaInfo.epSize, 0.0);
     std::vector<int> currentRankSlots(metaInfo.epSize, 0); // Tracks the count of assigned slots per rank
+    // Tracks which experts each rank already hosts so replicas of a hot expert land on distinct ranks
+    std::vector<std::set<int>> rankHostedExperts(metaInfo.epSize);
 
     // Define a min-priority queue storing pairs of {load, rank_id}
     using RankLoadPair = std::pair<double, int>;
@@ -170,6 +173,37 @@ void doPlacement(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, float*
         RankLoadPair top = pq.top();
         pq.pop();
 
+        // Co-locating two replicas of the same expert on one rank wastes the clone: the rank serves the
+        // same traffic either way. Skip to the least-loaded rank not yet hosting this expert, and only
+        // fall back to a hosting rank when every rank with free slots already has the expert.
+        if (rankHostedExperts[top.second].count(replica.expertId) != 0)
+        {
+            std::vector<RankLoadPair> skippedRanks;
+            skippedRanks.push_back(top);
+            bool foundRank = false;
+            while (!pq.empty())
+            {
+                RankLoadPair candidate = pq.top();
+                pq.pop();
+                if (rankHostedExperts[candidate.second].count(replica.expertId) == 0)
+                {
+                    top = candidate;
+                    foundRank = true;
+                    break;
+                }
+                skippedRanks.push_back(candidate);
+            }
+            if (!foundRank)
+            {
+                top = skippedRanks.front();
+                skippedRanks.erase(skippedRanks.begin());
+            }
+            for (auto const& candidate : skippedRanks)
+            {
+                pq.push(candidate);
+            }
+        }
+
         int bestRank = top.second;
         double currentLoad = top.first; // The load before adding this replica
 
@@ -181,6 +215,7 @@ void doPlacement(tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo, float*
         // Update rank state
         currentRankLoad[bestRank] = currentLoad + replica.slotSize; // Update load explicitly
         currentRankSlots[bestRank]++;                               // Increment the slot count for this rank
+        rankHostedExperts[bestRank].insert(replica.expertId);
 
         // If the rank still has capacity, push it back into the queue with updated load
         if (currentRankSlots[bestRank] < metaInfo.slotCountPerRank)
@@ -408,6 +443,29 @@ void SingleLayerMoeLoadBalancer::addSingleHostWeight(int expertId, std::string c
     mWeightUpdater->addSingleHostWeight(expertId, name, hostWeight);
 }
 
+void SingleLayerMoeLoadBalancer::addSingleColdHostWeight(
+    int expertId, std::string const& name, std::string const& filePath, size_t fileOffset, MoeWeight const& shape)
+{
+    if (!mExpertTierManager)
+    {
+        int warmExpertCount = std::max(1, mMetaInfo.expertCount / 2);
+        if (getenv("TLLM_MOE_WARM_EXPERT_COUNT"))
+        {
+            int warmExpertCountFromEnv = atoi(getenv("TLLM_MOE_WARM_EXPERT_COUNT"));
+            if (warmExpertCountFromEnv > 0)
+            {
+                TLLM_LOG_INFO(
+                    "Setting TLLM_MOE_WARM_EXPERT_COUNT to %d by environment variable", warmExpertCountFromEnv);
+                warmExpertCount = std::min(warmExpertCountFromEnv, mMetaInfo.expertCount);
+            }
+        }
+        mExpertTierManager.reset(new MoeExpertTierManager(mMetaInfo, warmExpertCount));
+    }
+    auto hostWeight
+        = mExpertTierManager->mapColdWeight(expertId, filePath, fileOffset, shape.mHeight, shape.mWidth, shape.mPitch);
+    mWeightUpdater->addSingleHostWeight(expertId, name, hostWeight);
+}
+
 void SingleLayerMoeLoadBalancer::setInitialWeightAssignments(std::vector<int> const& initialWeightAssignments)
 {
     std::fill_n(mCpuPlacementInfo.expertReplicaCount.begin(), mMetaInfo.expertCount, 0);
@@ -454,6 +512,8 @@ void SingleLayerMoeLoadBalancer::createResources()
 void SingleLayerMoeLoadBalancer::destroyResources()
 {
     mWeightUpdater.reset();
+    // host weights may point into the tier manager's file mappings, release them after the updater
+    mExpertTierManager.reset();
     freeStatisticInfo(&mStatisticInfo);
     freePlacementInfo(&mCpuPlacementInfo.placementInfoForGPU, true);
     freePlacementInfo(&mGpuPlacementGpuAccess, false);
@@ -563,6 +623,11 @@ void SingleLayerMoeLoadBalancer::updateWeightsRoutine()
 {
     doReplication(mMetaInfo, mStatisticInfo.expertLoadFactor, &mCpuPlacementInfo);
     doPlacement(mMetaInfo, mStatisticInfo.expertLoadFactor, &mCpuPlacementInfo);
+    if (mExpertTierManager)
+    {
+        // start promotion readahead before the slot copies so they find the pages resident
+        mExpertTierManager->updateTiers(mStatisticInfo.expertLoadFactor);
+    }
     prepareGpuPlacementInfo(mMetaInfo, &mCpuPlacementInfo);
     mWeightUpdater->updateWeights(&mCpuPlacementInfo);
     copyPlacementInfoToGpu();
@@ -577,6 +642,11 @@ void SingleLayerMoeLoadBalancer::updateWeightsRoutineByCpu()
 {
     doReplication(mMetaInfo, mStatisticInfo.expertLoadFactor, &mCpuPlacementInfo);
     doPlacement(mMetaInfo, mStatisticInfo.expertLoadFactor, &mCpuPlacementInfo);
+    if (mExpertTierManager)
+    {
+        // start promotion readahead before the slot copies so they find the pages resident
+        mExpertTierManager->updateTiers(mStatisticInfo.expertLoadFactor);
+    }
     prepareGpuPlacementInfo(mMetaInfo, &mCpuPlacementInfo);
     mLastUpdateTaskId = mMoeLoadBalancer->addCopyTask(
         [this](int rank, int size) { mWeightUpdater->updateWeights(&mCpuPlacementInfo, rank, size); });
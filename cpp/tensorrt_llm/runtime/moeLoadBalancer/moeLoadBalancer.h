@@ -115,6 +115,8 @@ private:
 
 class MoeLoadBalancer;
 
+class MoeExpertTierManager;
+
 class SingleLayerMoeLoadBalancer
 {
 public:
@@ -127,6 +129,11 @@ public:
     void addSingleWeightSlot(int slotId, std::string const& name, MoeWeight weightSlot);
     // should bind to python
     void addSingleHostWeight(int expertId, std::string const& name, MoeWeight hostWeight);
+    // register a cold expert weight that stays in a file on NVMe; shape carries
+    // height/width/pitch, the pointer is filled from the file mapping.
+    // should bind to python
+    void addSingleColdHostWeight(
+        int expertId, std::string const& name, std::string const& filePath, size_t fileOffset, MoeWeight const& shape);
 
     // set initial weight assignments for each slot
     // index is the global slot id, value is the expert id
@@ -171,6 +178,11 @@ public:
         return &mStatisticInfo;
     }
 
+    MoeExpertTierManager* getExpertTierManager()
+    {
+        return mExpertTierManager.get();
+    }
+
 private:
     friend class MoeLoadBalancer;
     friend class HostMemoryMoeWeightUpdater;
@@ -189,6 +201,8 @@ private:
     MoeLoadBalancer* mMoeLoadBalancer = nullptr;
 
     std::unique_ptr<MoeWeightUpdaterBase> mWeightUpdater;
+    // created lazily when the first cold weight is registered
+    std::unique_ptr<MoeExpertTierManager> mExpertTierManager;
 
     int64_t mIterId = -1;
     bool mStatisticEnabled = true;
@@ -16,15 +16,163 @@
 
 #include "tensorrt_llm/runtime/ncclCommunicator.h"
 
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/utils/multiDeviceUtils.h"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #if ENABLE_MULTI_DEVICE
 #include <nccl.h>
 #endif // ENABLE_MULTI_DEVICE
 
 using namespace tensorrt_llm::runtime;
 
+#if ENABLE_MULTI_DEVICE
+
+// Watches a completion event per issued collective. When an event misses its deadline the watchdog
+// dumps every in-flight operation and calls ncclCommAbort, which unblocks the stuck collective on
+// this rank; the peer ranks' watchdogs (or the abort-induced NCCL errors) fail the rest of the
+// group, so all pending work surfaces errors within seconds instead of wedging for minutes.
+class NcclCommunicator::Watchdog
+{
+public:
+    Watchdog(ncclComm_t comm, std::chrono::milliseconds timeout)
+        : mComm{comm}
+        , mTimeout{timeout}
+        , mThread{[this]() { watchLoop(); }}
+    {
+    }
+
+    ~Watchdog()
+    {
+        {
+            std::lock_guard<std::mutex> lck(mMutex);
+            mShutdown = true;
+        }
+        mCv.notify_one();
+        mThread.join();
+        for (auto const& op : mPending)
+        {
+            cudaEventDestroy(op.event);
+        }
+    }
+
+    // Registers the device-side completion of a collective just issued on stream.
+    void arm(char const* opName, size_t count, int peer, cudaStream_t stream)
+    {
+        cudaEvent_t event{nullptr};
+        TLLM_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+        TLLM_CUDA_CHECK(cudaEventRecord(event, stream));
+        {
+            std::lock_guard<std::mutex> lck(mMutex);
+            mPending.push_back({event, opName, count, peer, std::chrono::steady_clock::now()});
+        }
+        mCv.notify_one();
+    }
+
+    // Fails fast on the issuing thread once the communicator has been aborted.
+    void rethrowIfAborted() const
+    {
+        TLLM_CHECK_WITH_INFO(!mAborted.load(std::memory_order_acquire),
+            "NCCL communicator was aborted by the hung-collective watchdog.");
+    }
+
+private:
+    struct PendingOp
+    {
+        cudaEvent_t event;
+        char const* opName;
+        size_t count;
+        int peer;
+        std::chrono::steady_clock::time_point issuedAt;
+    };
+
+    void watchLoop()
+    {
+        constexpr auto kProbePeriod = std::chrono::milliseconds(10);
+        std::unique_lock<std::mutex> lck(mMutex);
+        while (!mShutdown)
+        {
+            if (mPending.empty())
+            {
+                mCv.wait(lck, [this]() { return mShutdown || !mPending.empty(); });
+                continue;
+            }
+            mCv.wait_for(lck, kProbePeriod, [this]() { return mShutdown; });
+
+            auto const now = std::chrono::steady_clock::now();
+            while (!mPending.empty())
+            {
+                auto const& op = mPending.front();
+                auto const status = cudaEventQuery(op.event);
+                if (status == cudaSuccess)
+                {
+                    cudaEventDestroy(op.event);
+                    mPending.pop_front();
+                    continue;
+                }
+                if (status != cudaErrorNotReady)
+                {
+                    TLLM_LOG_ERROR("NCCL watchdog: cudaEventQuery failed with %d (%s).", static_cast<int>(status),
+                        cudaGetErrorString(status));
+                }
+                if (now - op.issuedAt >= mTimeout)
+                {
+                    dumpAndAbort(now);
+                    return;
+                }
+                // Operations complete in issue order on the stream; the oldest one gates the rest.
+                break;
+            }
+        }
+    }
+
+    // Requires mMutex to be held.
+    void dumpAndAbort(std::chrono::steady_clock::time_point now)
+    {
+        TLLM_LOG_ERROR("NCCL watchdog: collective exceeded the %ld ms deadline; dumping %zu in-flight operation(s) "
+                       "and aborting the communicator.",
+            static_cast<long>(mTimeout.count()), mPending.size());
+        for (auto const& op : mPending)
+        {
+            auto const elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - op.issuedAt).count();
+            TLLM_LOG_ERROR(
+                "NCCL watchdog:   %s count=%zu peer=%d in flight for %ld ms", op.opName, op.count, op.peer, elapsedMs);
+        }
+        mAborted.store(true, std::memory_order_release);
+        auto const status = ncclCommAbort(mComm);
+        if (status != ncclSuccess)
+        {
+            TLLM_LOG_ERROR("NCCL watchdog: ncclCommAbort failed with %d.", static_cast<int>(status));
+        }
+    }
+
+    ncclComm_t mComm;
+    std::chrono::milliseconds mTimeout;
+    std::mutex mMutex;
+    std::condition_variable mCv;
+    std::deque<PendingOp> mPending;
+    bool mShutdown{false};
+    std::atomic<bool> mAborted{false};
+    std::thread mThread;
+};
+
+#else // ENABLE_MULTI_DEVICE
+
+class NcclCommunicator::Watchdog
+{
+};
+
+#endif // ENABLE_MULTI_DEVICE
+
 namespace
 {
 #if ENABLE_MULTI_DEVICE
@@ -53,7 +201,15 @@ void NcclCommunicator::send(
     void const* sendbuff, size_t count, nvinfer1::DataType dataType, int peer, CudaStream const& stream) const
 {
 #if ENABLE_MULTI_DEVICE
+    if (mWatchdog)
+    {
+        mWatchdog->rethrowIfAborted();
+    }
     TLLM_NCCL_CHECK(ncclSend(sendbuff, count, toNcclType(dataType), peer, mComm, stream.get()));
+    if (mWatchdog)
+    {
+        mWatchdog->arm("ncclSend", count, peer, stream.get());
+    }
 #else
     TLLM_THROW("Multi device support is disabled.");
 #endif // ENABLE_MULTI_DEVICE
@@ -63,12 +219,31 @@ void NcclCommunicator::receive(
     void* sendbuff, size_t count, nvinfer1::DataType dataType, int peer, CudaStream const& stream) const
 {
 #if ENABLE_MULTI_DEVICE
+    if (mWatchdog)
+    {
+        mWatchdog->rethrowIfAborted();
+    }
     TLLM_NCCL_CHECK(ncclRecv(sendbuff, count, toNcclType(dataType), peer, mComm, stream.get()));
+    if (mWatchdog)
+    {
+        mWatchdog->arm("ncclRecv", count, peer, stream.get());
+    }
 #else
     TLLM_THROW("Multi device support is disabled.");
 #endif // ENABLE_MULTI_DEVICE
 }
 
+void NcclCommunicator::initWatchdog()
+{
+#if ENABLE_MULTI_DEVICE
+    auto const timeoutMs = common::getEnvNcclWatchdogTimeoutMs();
+    if (mComm != nullptr && timeoutMs > 0)
+    {
+        mWatchdog = std::make_unique<Watchdog>(mComm, std::chrono::milliseconds(timeoutMs));
+    }
+#endif // ENABLE_MULTI_DEVICE
+}
+
 ncclComm_t NcclCommunicator::createComm(int worldSize, int rank, mpi::MpiComm const& mpiComm)
 {
 #if ENABLE_MULTI_DEVICE
@@ -99,6 +274,8 @@ ncclComm_t NcclCommunicator::createComm(int worldSize, int rank, mpi::MpiComm co
 NcclCommunicator::~NcclCommunicator()
 {
 #if ENABLE_MULTI_DEVICE
+    // Stop the watchdog before tearing down the communicator it probes.
+    mWatchdog.reset();
     if (mComm && ncclCommDestroy(mComm) != ncclSuccess)
     {
         TLLM_LOG_WARNING("Failed to destroy NCCL communicator.");
@@ -21,6 +21,8 @@
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 #include "tensorrt_llm/runtime/worldConfig.h"
 
+#include <memory>
+
 struct ncclComm;
 typedef struct ncclComm* ncclComm_t;
 
@@ -31,10 +33,16 @@ class NcclCommunicator
 {
 public:
     explicit NcclCommunicator(ncclComm_t comm)
-        : mComm{comm} {};
+        : mComm{comm}
+    {
+        initWatchdog();
+    };
 
     explicit NcclCommunicator(int worldSize, int rank, mpi::MpiComm const& mpiComm = COMM_SESSION)
-        : mComm{createComm(worldSize, rank, mpiComm)} {};
+        : mComm{createComm(worldSize, rank, mpiComm)}
+    {
+        initWatchdog();
+    };
 
     explicit NcclCommunicator(WorldConfig const& worldConfig, mpi::MpiComm const& mpiComm = COMM_SESSION)
         : NcclCommunicator{worldConfig.getSize(), worldConfig.getRank(), mpiComm} {};
@@ -63,7 +71,15 @@ private:
 
     static ncclComm_t createComm(int worldSize, int rank, mpi::MpiComm const& mpiComm);
 
+    // Starts the hung-collective watchdog when TRTLLM_NCCL_WATCHDOG_TIMEOUT_MS is set.
+    void initWatchdog();
+
     ncclComm_t mComm;
+
+    // Tracks a completion event per issued collective and aborts the communicator when one misses
+    // its deadline, so a stuck peer fails the whole group within seconds instead of wedging it.
+    class Watchdog;
+    std::unique_ptr<Watchdog> mWatchdog;
 };
 
 } // namespace tensorrt_llm::runtime
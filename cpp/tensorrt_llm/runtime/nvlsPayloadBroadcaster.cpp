@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/runtime/nvlsPayloadBroadcaster.h"
+
+#include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/logger.h"
+
+#include <cuda_runtime_api.h>
+#include <limits>
+
+namespace tensorrt_llm::runtime
+{
+
+namespace
+{
+
+struct PayloadHeader
+{
+    uint64_t sequence;
+    //! Payload size in bytes, or kOversize when the payload did not fit and the caller falls back to MPI.
+    uint64_t size;
+
+    static constexpr uint64_t kOversize = std::numeric_limits<uint64_t>::max();
+};
+
+} // namespace
+
+std::unique_ptr<NvlsPayloadBroadcaster> NvlsPayloadBroadcaster::create(
+    mpi::MpiComm const& groupComm, std::size_t payloadCapacity)
+{
+    auto const groupSize = groupComm.getSize();
+    if (groupSize < 2)
+    {
+        return nullptr;
+    }
+
+    // NVLS support can differ per device; all ranks must agree before the collective allocation.
+    int32_t const localSupported = ipcNvlsSupported() ? 1 : 0;
+    int32_t groupSupported{0};
+    groupComm.allreduce(&localSupported, &groupSupported, 1, mpi::MpiType::kINT32, mpi::MpiOp::MIN);
+    if (groupSupported == 0)
+    {
+        TLLM_LOG_INFO("NVLS payload broadcast disabled: multicast is not supported on all group ranks");
+        return nullptr;
+    }
+
+    // The NVLS allocator addresses peers by their COMM_SESSION ranks, so translate the group members.
+    int32_t const sessionRank = COMM_SESSION.getRank();
+    std::vector<int32_t> sessionRanks(groupSize);
+    groupComm.allgather(&sessionRank, sessionRanks.data(), 1, mpi::MpiType::kINT32);
+
+    TLLM_LOG_INFO(
+        "NVLS payload broadcast enabled for a group of %d ranks with %zu bytes capacity", groupSize, payloadCapacity);
+    return std::unique_ptr<NvlsPayloadBroadcaster>(new NvlsPayloadBroadcaster(
+        std::set<int>(sessionRanks.begin(), sessionRanks.end()), groupComm.getRank(), payloadCapacity));
+}
+
+NvlsPayloadBroadcaster::NvlsPayloadBroadcaster(std::set<int> groupRanks, int groupRank, std::size_t payloadCapacity)
+    : mGroupRanks{std::move(groupRanks)}
+    , mGroupRank{groupRank}
+    , mPayloadCapacity{payloadCapacity}
+{
+    mBuffer.reset(sizeof(PayloadHeader) + mPayloadCapacity, mGroupRanks);
+}
+
+bool NvlsPayloadBroadcaster::broadcast(std::vector<char>& payload, int root)
+{
+    auto const sequence = ++mSequence;
+    bool fits = true;
+
+    if (mGroupRank == root)
+    {
+        fits = payload.size() <= mPayloadCapacity;
+        PayloadHeader const header{sequence, fits ? static_cast<uint64_t>(payload.size()) : PayloadHeader::kOversize};
+        // Writes go through the multicast mapping so the switch replicates them to every rank;
+        // one staging copy replaces the per-peer sends of an MPI broadcast.
+        auto* mcPtr = mBuffer.getMulticastPointer();
+        TLLM_CUDA_CHECK(cudaMemcpy(mcPtr, &header, sizeof(PayloadHeader), cudaMemcpyHostToDevice));
+        if (fits && !payload.empty())
+        {
+            TLLM_CUDA_CHECK(
+                cudaMemcpy(mcPtr + sizeof(PayloadHeader), payload.data(), payload.size(), cudaMemcpyHostToDevice));
+        }
+        MPI_group_barrier(mGroupRanks);
+    }
+    else
+    {
+        MPI_group_barrier(mGroupRanks);
+        auto const* ucPtr = mBuffer.getUnicastPointer();
+        PayloadHeader header{};
+        TLLM_CUDA_CHECK(cudaMemcpy(&header, ucPtr, sizeof(PayloadHeader), cudaMemcpyDeviceToHost));
+        TLLM_CHECK_WITH_INFO(header.sequence == sequence, "NVLS payload broadcast sequence mismatch: got %lu, expected %lu",
+            static_cast<unsigned long>(header.sequence), static_cast<unsigned long>(sequence));
+        fits = header.size != PayloadHeader::kOversize;
+        if (fits)
+        {
+            payload.resize(header.size);
+            if (!payload.empty())
+            {
+                TLLM_CUDA_CHECK(
+                    cudaMemcpy(payload.data(), ucPtr + sizeof(PayloadHeader), payload.size(), cudaMemcpyDeviceToHost));
+            }
+        }
+    }
+
+    // Keep the root from overwriting the buffer on the next broadcast while peers still read this one.
+    MPI_group_barrier(mGroupRanks);
+    return fits;
+}
+
+} // namespace tensorrt_llm::runtime
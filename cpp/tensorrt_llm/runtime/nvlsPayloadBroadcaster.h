@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025, NVIDIA CORPORATION. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "tensorrt_llm/runtime/ipcNvlsMemory.h"
+#include "tensorrt_llm/runtime/utils/mpiUtils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <vector>
+
+namespace tensorrt_llm::runtime
+{
+
+//! \brief Broadcasts a host byte payload to every rank of an MPI group through an NVLS multicast buffer.
+//!
+//! The root stages the payload into the group's multicast mapping with a single copy, so the switch
+//! fans it out to all ranks instead of the point-to-point sends an MPI broadcast degenerates to.
+//! Non-root ranks then read the payload back from their unicast mapping of the same allocation.
+//! broadcast() matches the collective semantics of MpiComm::bcast(std::vector<char>&, root): every
+//! group rank must call it with the same root, and the payload vector is resized on non-root ranks.
+//!
+//! Payloads larger than the capacity chosen at construction are signalled through the buffer header
+//! and broadcast() returns false on all ranks; callers are expected to fall back to an MPI broadcast.
+class NvlsPayloadBroadcaster
+{
+public:
+    //! Creates a broadcaster for the calling rank's group, or nullptr when the group has fewer than
+    //! two ranks or any member lacks NVLS support. Collective over \p groupComm.
+    static std::unique_ptr<NvlsPayloadBroadcaster> create(mpi::MpiComm const& groupComm, std::size_t payloadCapacity);
+
+    //! Broadcasts \p payload from \p root to all group ranks. Returns false without transferring the
+    //! payload when it exceeds the capacity; the caller must then issue the same broadcast over MPI.
+    bool broadcast(std::vector<char>& payload, int root);
+
+private:
+    NvlsPayloadBroadcaster(std::set<int> groupRanks, int groupRank, std::size_t payloadCapacity);
+
+    //! Session ranks forming the multicast group, in group rank order.
+    std::set<int> mGroupRanks;
+    //! This rank's position within the group, comparable against the root argument of broadcast().
+    int mGroupRank;
+    std::size_t mPayloadCapacity;
+    //! Monotonic broadcast counter, checked against the received header to catch mismatched collectives.
+    uint64_t mSequence{0};
+    //! Header (sequence number and payload size) followed by the payload bytes.
+    DeviceAllocationNvls<char> mBuffer;
+};
+
+} // namespace tensorrt_llm::runtime
@@ -17,6 +17,7 @@
 
 #include "tensorrt_llm/common/assert.h"
 #include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/launchConfigUtils.h"
 #include "tensorrt_llm/kernels/kvCacheIndex.h"
 #include "tensorrt_llm/kernels/speculativeDecoding/kvCacheUpdateKernels.h"
 #include "tensorrt_llm/runtime/runtimeKernels.h"
@@ -74,10 +75,9 @@ void invokeFillBatch(IBuffer& buffer, IBuffer const& slotIndices, std::size_t sl
     auto fillValues = bufferCast<T>(values);
     auto numSlots = slotIndices.getSize();
     auto const size = slotStride;
-    dim3 const blockSize{256};
-    std::size_t const gridx{tc::ceilDiv(size, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax)), static_cast<std::uint32_t>(numSlots)};
+    auto const launchConfig = tc::adviseGridStrideLaunch1D(&fillBatch<T>, size);
+    dim3 const blockSize{launchConfig.block.x};
+    dim3 const gridSize{launchConfig.grid.x, static_cast<std::uint32_t>(numSlots)};
 
     fillBatch<<<gridSize, blockSize, 0, stream.get()>>>(data, indices, size, fillValues);
 }
@@ -109,14 +109,29 @@ void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& sl
     auto sparseValues = bufferCast<T>(values);
     auto numSlots = slotIndices.getSize();
     auto const size = slotStride;
-    dim3 const blockSize{256};
-    std::size_t const gridx{tc::ceilDiv(size, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax)), static_cast<std::uint32_t>(numSlots)};
+    auto const launchConfig = tc::adviseGridStrideLaunch1D(&gatherBatch<T>, size);
+    dim3 const blockSize{launchConfig.block.x};
+    dim3 const gridSize{launchConfig.grid.x, static_cast<std::uint32_t>(numSlots)};
 
     gatherBatch<<<gridSize, blockSize, 0, stream.get()>>>(data, sparseValues, indices, size);
 }
 
+__global__ void incrementDecodeStep(std::int32_t* sequenceLengths, std::size_t sequenceLengthsSize,
+    std::int32_t* positionIds, std::size_t positionIdsSize)
+{
+    auto const tidx = static_cast<std::size_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+    auto const stride = static_cast<std::size_t>(blockDim.x) * gridDim.x;
+
+    for (auto idx = tidx; idx < sequenceLengthsSize; idx += stride)
+    {
+        sequenceLengths[idx] += 1;
+    }
+    for (auto idx = tidx; idx < positionIdsSize; idx += stride)
+    {
+        positionIds[idx] += 1;
+    }
+}
+
 template <typename VecT>
 __global__ void copyBatch(uint8_t const* srcData, uint8_t* dstData, SizeType64 const* srcOffsets,
     SizeType64 const* dstOffsets, SizeType64 const* sizes, SizeType64 const dataTypeSize)
@@ -200,10 +215,9 @@ void invokeScatterTensor(ITensor& output, ITensor const& input, SizeType32 beamW
     TLLM_CHECK_WITH_INFO(outputRowSize >= inputRowSize,
         common::fmtstr("output row size (%ld) must be at least input row size (%ld)", outputRowSize, inputRowSize));
 
-    dim3 const blockSize{256, 1};
-    std::size_t const gridx{tc::ceilDiv(inputRowSize, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax)), nbInputRows};
+    auto const launchConfig = tc::adviseGridStrideLaunch1D(&scatterTensor<T>, inputRowSize);
+    dim3 const blockSize{launchConfig.block.x, 1};
+    dim3 const gridSize{launchConfig.grid.x, nbInputRows};
     scatterTensor<<<gridSize, blockSize, 0, stream.get()>>>(bufferCast<T>(output), bufferCast<T const>(input),
         nbInputRows, inputRowSize, outputRowSize, static_cast<uint32_t>(beamWidth));
 }
@@ -224,10 +238,9 @@ void invokeTileTensor(ITensor& output, ITensor const& input, SizeType32 const be
     TLLM_CHECK_WITH_INFO(outputRowSize >= inputRowSize,
         common::fmtstr("output row size (%ld) must be at least input row size (%ld)", outputRowSize, inputRowSize));
 
-    dim3 const blockSize{256, 1};
-    std::size_t const gridx{tc::ceilDiv(inputRowSize, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax)), nbInputRows};
+    auto const launchConfig = tc::adviseGridStrideLaunch1D(&tileTensor<T>, inputRowSize);
+    dim3 const blockSize{launchConfig.block.x, 1};
+    dim3 const gridSize{launchConfig.grid.x, nbInputRows};
     tileTensor<<<gridSize, blockSize, 0, stream.get()>>>(bufferCast<T>(output), bufferCast<T const>(input), nbInputRows,
         inputRowSize, outputRowSize, static_cast<uint32_t>(beamWidth));
 }
@@ -308,10 +321,7 @@ void invokeFill(IBuffer& buffer, T const value, CudaStream const& stream)
 {
     auto data = bufferCast<T>(buffer);
     auto const size = buffer.getSize();
-    dim3 const blockSize{256};
-    std::size_t const gridx{tc::ceilDiv(size, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax))};
+    auto const [gridSize, blockSize] = tc::adviseGridStrideLaunch1D(&fill<T>, size);
 
     fill<<<gridSize, blockSize, 0, stream.get()>>>(data, size, value);
 }
@@ -360,6 +370,18 @@ void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& sl
     }
 }
 
+void invokeIncrementDecodeStep(IBuffer& sequenceLengths, IBuffer& positionIds, CudaStream const& stream)
+{
+    TLLM_CHECK(sequenceLengths.getDataType() == nvinfer1::DataType::kINT32);
+    TLLM_CHECK(positionIds.getDataType() == nvinfer1::DataType::kINT32);
+    auto const size = std::max(sequenceLengths.getSize(), positionIds.getSize());
+    dim3 const blockSize{256};
+    dim3 const gridSize{static_cast<std::uint32_t>(tc::ceilDiv(size, static_cast<std::size_t>(blockSize.x)))};
+
+    incrementDecodeStep<<<gridSize, blockSize, 0, stream.get()>>>(bufferCast<std::int32_t>(sequenceLengths),
+        sequenceLengths.getSize(), bufferCast<std::int32_t>(positionIds), positionIds.getSize());
+}
+
 void invokeCopyBatch(IBuffer const& srcBuffer, IBuffer& dstBuffer, IBuffer const& srcOffsets, IBuffer const& dstOffsets,
     IBuffer const& sizes, std::size_t maxStride, CudaStream const& stream)
 {
@@ -396,10 +418,9 @@ void invokeCopyBatch(IBuffer const& srcBuffer, IBuffer& dstBuffer, IBuffer const
         copyBatchInvocation = copyBatch<uint16_t>;
     }
 
-    dim3 const blockSize{256};
-    std::size_t const gridx{tc::ceilDiv(copyRowSizeInBytes / vectorSize, blockSize.x)};
-    std::size_t const gridMax{std::numeric_limits<std::uint32_t>::max()};
-    dim3 const gridSize{static_cast<std::uint32_t>(std::min(gridx, gridMax)), static_cast<std::uint32_t>(numSlots)};
+    auto const launchConfig = tc::adviseGridStrideLaunch1D(copyBatchInvocation, copyRowSizeInBytes, vectorSize);
+    dim3 const blockSize{launchConfig.block.x};
+    dim3 const gridSize{launchConfig.grid.x, static_cast<std::uint32_t>(numSlots)};
     copyBatchInvocation<<<gridSize, blockSize, 0, stream.get()>>>(
         srcDataPtr, dstDataPtr, srcOffsetsPtr, dstOffsetsPtr, sizesPtr, static_cast<SizeType64>(dataTypeSize));
 }
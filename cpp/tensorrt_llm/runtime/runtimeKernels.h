@@ -40,6 +40,11 @@ void invokeFillBatch(
 void invokeGatherBatch(IBuffer& buffer, IBuffer const& values, IBuffer const& slotIndices, std::size_t slotStride,
     CudaStream const& stream);
 
+//! @brief Advance decode metadata by one step in place: adds 1 to every entry of sequenceLengths
+//! and positionIds. Lets steady-state decode iterations derive the next iteration's metadata from
+//! the arrays already on device instead of rebuilding and re-uploading them.
+void invokeIncrementDecodeStep(IBuffer& sequenceLengths, IBuffer& positionIds, CudaStream const& stream);
+
 void invokeCopyBatch(IBuffer const& srcBuffer, IBuffer& dstBuffer, IBuffer const& srcOffsets, IBuffer const& dstOffsets,
     IBuffer const& sizes, std::size_t maxStride, CudaStream const& stream);
 
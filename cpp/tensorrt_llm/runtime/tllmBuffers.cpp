@@ -25,6 +25,15 @@ typename PoolAllocator<TAllocator>::PoolType& PoolAllocator<TAllocator>::getPool
     return pool;
 }
 
+template <typename TAllocator>
+typename CachingPoolAllocator<TAllocator>::PoolType& CachingPoolAllocator<TAllocator>::getPool()
+{
+    // Hot-path allocations served through the size-class caches are small; start with a modest chunk
+    // and let the pool grow on demand.
+    static PoolType pool{PoolType::kInitialChunkSize / 8}; // 64 MB
+    return pool;
+}
+
 MulticastTensorView::MulticastTensorView(std::weak_ptr<MulticastTensor> const& tensor, ViewType viewType)
     : mTensor(tensor)
     , mViewType(viewType)
@@ -25,13 +25,16 @@
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/ipcNvlsMemory.h"
 #include "tensorrt_llm/runtime/memoryCounters.h"
+#include "tensorrt_llm/runtime/memoryProfiler.h"
 #include "tensorrt_llm/runtime/virtualMemory.h"
 
 #include <NvInferRuntime.h>
 #include <cuda_runtime_api.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdlib>
+#include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -58,6 +61,10 @@ public:
         if constexpr (count)
         {
             MemoryCounters::getInstance().allocate<memoryType>(n);
+            if (MemoryProfiler::isEnabled())
+            {
+                MemoryProfiler::getInstance().recordAlloc(memoryType, ptr, n);
+            }
         }
         return ptr;
     }
@@ -70,6 +77,10 @@ public:
             if constexpr (count)
             {
                 MemoryCounters::getInstance().deallocate<memoryType>(n);
+                if (MemoryProfiler::isEnabled())
+                {
+                    MemoryProfiler::getInstance().recordFree(ptr);
+                }
             }
         }
     }
@@ -499,7 +510,129 @@ protected:
     }
 };
 
+//! \brief Pool allocator with per-thread size-class caches.
+//!
+//! Requests are rounded up to power-of-two size classes and recycled through per-thread freelists, so in
+//! the steady state an allocation is a freelist pop that takes neither the pool lock nor the OS lock
+//! behind the underlying allocator. Oversized requests go to the pool directly. Cached blocks are
+//! returned to the pool when their thread exits.
+template <typename TAllocator>
+class CachingPoolAllocator : public BaseAllocator<CachingPoolAllocator<TAllocator>, TAllocator::kMemoryType, false>
+{
+    friend class BaseAllocator<CachingPoolAllocator<TAllocator>, TAllocator::kMemoryType, false>;
+
+public:
+    using Base = BaseAllocator<CachingPoolAllocator<TAllocator>, TAllocator::kMemoryType, false>;
+    using PointerType = typename Base::PointerType;
+    using PoolType = MemoryPool<TAllocator>;
+
+    static PoolType& getPool();
+
+    //! Largest block size served from the per-thread size-class caches.
+    static std::size_t constexpr kMaxCachedBlockSize{std::size_t{1} << 22}; // 4 MB
+    //! Number of recycled blocks of each size class kept per thread.
+    static std::size_t constexpr kMaxCachedBlocksPerClass{8};
+
+protected:
+    void allocateImpl(PointerType* ptr, std::size_t n) // NOLINT(readability-convert-member-functions-to-static)
+    {
+        auto const sizeClass = toSizeClass(n);
+        if (sizeClass == kNoSizeClass)
+        {
+            *ptr = getPool().allocate(n);
+            return;
+        }
+        auto& freeList = threadLocalCache()[sizeClass];
+        if (!freeList.empty())
+        {
+            *ptr = freeList.back();
+            freeList.pop_back();
+            return;
+        }
+        // Allocate the full class size so recycled blocks are interchangeable within their class.
+        *ptr = getPool().allocate(std::size_t{1} << sizeClass);
+    }
+
+    void deallocateImpl( // NOLINT(readability-convert-member-functions-to-static)
+        typename TAllocator::PointerType ptr, std::size_t n)
+    {
+        auto const sizeClass = toSizeClass(n);
+        if (sizeClass == kNoSizeClass)
+        {
+            getPool().deallocate(ptr, n);
+            return;
+        }
+        auto& freeList = threadLocalCache()[sizeClass];
+        if (freeList.size() < kMaxCachedBlocksPerClass)
+        {
+            freeList.push_back(ptr);
+            return;
+        }
+        getPool().deallocate(ptr, std::size_t{1} << sizeClass);
+    }
+
+private:
+    //! Smallest size class, matching the pool alignment.
+    static std::size_t constexpr kMinSizeClassLog2{8}; // 256 B
+    static std::size_t constexpr kMaxSizeClassLog2{22};
+    static std::size_t constexpr kNoSizeClass{std::numeric_limits<std::size_t>::max()};
+
+    //! \brief Map a request to the log2 of its size class, or kNoSizeClass for requests served by the
+    //! pool directly. Allocation and deallocation see the same size, so the mapping is consistent.
+    static std::size_t toSizeClass(std::size_t n)
+    {
+        if (n == 0 || n > kMaxCachedBlockSize)
+        {
+            return kNoSizeClass;
+        }
+        std::size_t sizeClass{kMinSizeClassLog2};
+        while ((std::size_t{1} << sizeClass) < n)
+        {
+            ++sizeClass;
+        }
+        return sizeClass;
+    }
+
+    //! \brief Per-thread freelists of recycled blocks, indexed by the log2 of the block size.
+    class ThreadCache
+    {
+    public:
+        std::vector<PointerType>& operator[](std::size_t sizeClass)
+        {
+            return mFreeLists[sizeClass];
+        }
+
+        ~ThreadCache()
+        {
+            for (std::size_t sizeClass = 0; sizeClass < mFreeLists.size(); ++sizeClass)
+            {
+                for (auto* const ptr : mFreeLists[sizeClass])
+                {
+                    try
+                    {
+                        getPool().deallocate(ptr, std::size_t{1} << sizeClass);
+                    }
+                    catch (std::exception const& e)
+                    {
+                        TLLM_LOG_EXCEPTION(e);
+                    }
+                }
+            }
+        }
+
+    private:
+        std::array<std::vector<PointerType>, kMaxSizeClassLog2 + 1> mFreeLists;
+    };
+
+    static ThreadCache& threadLocalCache()
+    {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+};
+
 using PinnedPoolAllocator = PoolAllocator<PinnedAllocator>;
+using PinnedCachingAllocator = CachingPoolAllocator<PinnedAllocator>;
 
 class CudaVirtualMemoryAllocatorAdaptor
     : public BaseAllocator<CudaVirtualMemoryAllocatorAdaptor, MemoryType::kGPU, /* count */ false>,
@@ -861,7 +994,7 @@ private:
 using DeviceBuffer = GenericBuffer<CudaAllocatorAsync>;
 using StaticDeviceBuffer = GenericBuffer<CudaAllocator>;
 using HostBuffer = GenericBuffer<HostAllocator>;
-using PinnedBuffer = GenericBuffer<PinnedAllocator>;
+using PinnedBuffer = GenericBuffer<PinnedCachingAllocator>;
 using PinnedPoolBuffer = GenericBuffer<PinnedPoolAllocator>;
 using UVMBuffer = GenericBuffer<UVMAllocator>;
 using VirtualAddressDeviceBuffer = GenericBuffer<CudaVirtualMemoryAllocatorAdaptor>;
@@ -1097,7 +1230,7 @@ private:
 using DeviceTensor = GenericTensor<CudaAllocatorAsync>;
 using StaticDeviceTensor = GenericTensor<CudaAllocator>;
 using HostTensor = GenericTensor<HostAllocator>;
-using PinnedTensor = GenericTensor<PinnedAllocator>;
+using PinnedTensor = GenericTensor<PinnedCachingAllocator>;
 using PinnedPoolTensor = GenericTensor<PinnedPoolAllocator>;
 using UVMTensor = GenericTensor<UVMAllocator>;
 using VirtualAddressDeviceTensor = GenericTensor<CudaVirtualMemoryAllocatorAdaptor>;
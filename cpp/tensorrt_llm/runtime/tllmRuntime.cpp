@@ -16,6 +16,8 @@
 #include "tllmRuntime.h"
 #include "common.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/common/nvtxUtils.h"
 #include "tensorrt_llm/common/safetensors.h"
@@ -32,8 +34,10 @@
 #include <cstddef>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -74,16 +78,70 @@ std::vector<std::size_t> dimsToShape(nvinfer1::Dims const& dims)
 
 tensorrt_llm::runtime::TllmLogger defaultLogger{};
 
+//! Cache of deserialized engines, keyed by engine file path and device. TllmRuntime instances serving the
+//! same model on the same GPU then share a single read-only weight allocation instead of duplicating it.
+//! Each instance still creates its own execution contexts and activation memory, so mutable state stays
+//! private. The cache holds weak references only and does not extend engine lifetimes.
+struct SharedEngineEntry
+{
+    std::weak_ptr<nvinfer1::IRuntime> runtime;
+    std::weak_ptr<nvinfer1::ICudaEngine> engine;
+};
+
+std::mutex sharedEngineMutex;
+
+std::unordered_map<std::string, SharedEngineEntry>& sharedEngineCache()
+{
+    static std::unordered_map<std::string, SharedEngineEntry> cache;
+    return cache;
+}
+
 void setWeightStreaming(nvinfer1::ICudaEngine& engine, float const gpuWeightsPercent)
 {
-    if (gpuWeightsPercent < 1)
+    auto const budgetMb = common::getEnvWeightStreamingBudgetMb();
+    if (gpuWeightsPercent >= 1 && !budgetMb.has_value())
+    {
+        return;
+    }
+    int64_t const streamableSize = engine.getStreamableWeightsSize();
+    if (streamableSize == 0)
+    {
+        TLLM_LOG_WARNING(
+            "Weight streaming was requested but the engine has no streamable weights. Re-build the engine with weight "
+            "streaming enabled.");
+        return;
+    }
+    int64_t budget{};
+    if (budgetMb.has_value())
+    {
+        if (*budgetMb >= 0)
+        {
+            budget = *budgetMb << 20;
+        }
+        else
+        {
+            // Automatic sizing: keep as many weights resident as fit next to the streaming scratch
+            // buffer and a safety margin for activations and KV cache. This lets models whose
+            // weights exceed device capacity come up with the remainder streamed from host memory;
+            // TensorRT owns the per-layer paging and prefetches on its own copy stream.
+            size_t freeMem{};
+            size_t totalMem{};
+            TLLM_CUDA_CHECK(cudaMemGetInfo(&freeMem, &totalMem));
+            auto const scratchSize = static_cast<int64_t>(engine.getWeightStreamingScratchMemorySize());
+            auto constexpr kFreeMemFraction = 0.8;
+            budget = static_cast<int64_t>(static_cast<double>(freeMem) * kFreeMemFraction) - scratchSize;
+        }
+        budget = std::min(std::max<int64_t>(budget, 0), streamableSize);
+        TLLM_LOG_INFO("Set weight streaming budget to %lld bytes out of %lld streamable bytes.", budget,
+            streamableSize);
+    }
+    else
     {
-        int64_t streamableSize = engine.getStreamableWeightsSize();
-        int64_t budget = gpuWeightsPercent * streamableSize;
+        budget = gpuWeightsPercent * streamableSize;
         TLLM_LOG_INFO("Set gpu weights percent to %f, which is %lld bytes. Valid range: %lld bytes - %lld bytes.",
             gpuWeightsPercent, budget, 0, streamableSize);
-        engine.setWeightStreamingBudgetV2(budget);
     }
+    engine.setWeightStreamingBudgetV2(budget);
 }
 
 class LayerInfo
@@ -195,31 +253,81 @@ TllmRuntime::TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger,
 {
     auto const startTime = std::chrono::high_resolution_clock::now();
 
-    switch (rawEngine.getType())
-    {
-    case RawEngine::Type::FilePath:
+    bool engineReused{false};
+    auto const loadEngine = [&]()
     {
-        if (useGpuDirectStorage)
+        switch (rawEngine.getType())
         {
-            TLLM_LOG_INFO("GDS is used to load the engine!");
-            auto reader = GDSStreamReader(rawEngine.getPath());
-            mEngine.reset(mRuntime->deserializeCudaEngine(reader));
+        case RawEngine::Type::FilePath:
+        {
+            // Engines loaded from a file can be identified reliably, so instances loading the same engine on the
+            // same device share one deserialized engine and thereby one copy of the weights.
+            auto const cacheKey = rawEngine.getPath().string() + "@" + std::to_string(common::getDevice());
+            std::lock_guard<std::mutex> lock(sharedEngineMutex);
+            auto& entry = sharedEngineCache()[cacheKey];
+            auto cachedRuntime = entry.runtime.lock();
+            auto cachedEngine = entry.engine.lock();
+            if (cachedRuntime && cachedEngine)
+            {
+                TLLM_LOG_INFO(
+                    "Engine %s is already loaded by another instance, sharing its weights.", cacheKey.c_str());
+                mRuntime = std::move(cachedRuntime);
+                mEngine = std::move(cachedEngine);
+                engineReused = true;
+                break;
+            }
+            if (useGpuDirectStorage)
+            {
+                TLLM_LOG_INFO("GDS is used to load the engine!");
+                auto reader = GDSStreamReader(rawEngine.getPath());
+                mEngine.reset(mRuntime->deserializeCudaEngine(reader));
+            }
+            else if (auto mmapReader = MMapStreamReader(rawEngine.getPath()); mmapReader.isOpen())
+            {
+                // Feed TensorRT directly from the page cache instead of buffering the engine in host memory.
+                mEngine.reset(mRuntime->deserializeCudaEngine(mmapReader));
+            }
+            else
+            {
+                TLLM_LOG_WARNING("Failed to map the engine file, falling back to a streaming read.");
+                auto reader = StreamReader(rawEngine.getPath());
+                mEngine.reset(mRuntime->deserializeCudaEngine(reader));
+            }
+            entry.runtime = mRuntime;
+            entry.engine = mEngine;
+            break;
         }
-        else
+        case RawEngine::Type::AddressWithSize:
+            mEngine.reset(mRuntime->deserializeCudaEngine(rawEngine.getAddress(), rawEngine.getSize()));
+            break;
+        case RawEngine::Type::HostMemory:
+            mEngine.reset(
+                mRuntime->deserializeCudaEngine(rawEngine.getHostMemory()->data(), rawEngine.getHostMemory()->size()));
+            break;
+        default: TLLM_THROW("Unsupported raw engine type.");
+        }
+    };
+
+    // When several ranks share a node, deserializing all engines at once thrashes the host memory bus and
+    // PCIe. The loads can be staggered in waves of TRTLLM_ENGINE_LOAD_CONCURRENCY ranks, ordered by local
+    // rank. Every rank passes through every barrier, so the waves stay aligned across the node.
+    auto const loadConcurrency = common::getEnvEngineLoadConcurrency();
+    auto const& localComm = LOCAL_COMM_SESSION;
+    if (loadConcurrency > 0 && localComm.getSize() > loadConcurrency)
+    {
+        auto const numWaves = common::ceilDiv(localComm.getSize(), loadConcurrency);
+        for (int32_t wave = 0; wave < numWaves; ++wave)
         {
-            auto reader = StreamReader(rawEngine.getPath());
-            mEngine.reset(mRuntime->deserializeCudaEngine(reader));
+            if (localComm.getRank() / loadConcurrency == wave)
+            {
+                loadEngine();
+            }
+            localComm.barrier();
         }
-        break;
     }
-    case RawEngine::Type::AddressWithSize:
-        mEngine.reset(mRuntime->deserializeCudaEngine(rawEngine.getAddress(), rawEngine.getSize()));
-        break;
-    case RawEngine::Type::HostMemory:
-        mEngine.reset(
-            mRuntime->deserializeCudaEngine(rawEngine.getHostMemory()->data(), rawEngine.getHostMemory()->size()));
-        break;
-    default: TLLM_THROW("Unsupported raw engine type.");
+    else
+    {
+        loadEngine();
     }
 
     auto const elapsedMs
@@ -229,8 +337,22 @@ TllmRuntime::TllmRuntime(RawEngine const& rawEngine, nvinfer1::ILogger* logger,
 
     TLLM_CHECK_WITH_INFO(mEngine != nullptr, "Failed to deserialize cuda engine.");
     mEngineInspector.reset(mEngine->createEngineInspector());
-    assessLikelihoodOfRuntimeAllocation(*mEngine, *mEngineInspector);
-    setWeightStreaming(getEngine(), gpuWeightsPercent);
+    if (engineReused)
+    {
+        // The weight streaming budget belongs to the shared engine and was already configured by the
+        // instance that loaded it; reconfiguring it here would disturb the other instances.
+        if (gpuWeightsPercent < 1)
+        {
+            TLLM_LOG_WARNING(
+                "Ignoring gpuWeightsPercent %.2f for a shared engine, keeping the budget of the first load.",
+                gpuWeightsPercent);
+        }
+    }
+    else
+    {
+        assessLikelihoodOfRuntimeAllocation(*mEngine, *mEngineInspector);
+        setWeightStreaming(getEngine(), gpuWeightsPercent);
+    }
     auto const devMemorySize = mEngine->getDeviceMemorySizeV2();
     mEngineBuffer = mBufferManager.gpu(devMemorySize);
     // Print context memory size for CI/CD to track.
@@ -489,11 +611,16 @@ void TllmRuntime::clearContexts()
 }
 
 bool TllmRuntime::executeContext(SizeType32 contextIndex) const
+{
+    return executeContext(contextIndex, *mStream);
+}
+
+bool TllmRuntime::executeContext(SizeType32 contextIndex, CudaStream const& stream) const
 {
     NVTX3_FUNC_RANGE();
     auto& context = getContext(contextIndex);
-    auto res = context.enqueueV3(mStream->get());
-    sync_check_cuda_error(mStream->get());
+    auto res = context.enqueueV3(stream.get());
+    sync_check_cuda_error(stream.get());
     return res;
 }
 
@@ -815,7 +942,10 @@ void TllmRuntime::loadManagedWeights(RawEngine const& rawEngine, int localRank)
         auto weightPath
             = enginePath->parent_path() / ("rank" + std::to_string(localRank) + "_managed_weights.safetensors");
         auto managed_weights = common::safetensors::ISafeTensor::open(weightPath.string().c_str());
-        for (auto const& name : managed_weights->keys())
+        auto const names = managed_weights->keys();
+        // Queue readahead for all weights up front so the copies below stream from the page cache.
+        managed_weights->prefetch(names);
+        for (auto const& name : names)
         {
             TLLM_LOG_DEBUG("Loading managed weight: %s", name.c_str());
             auto const weight = managed_weights->getTensor(name.c_str());
@@ -829,3 +959,26 @@ void TllmRuntime::loadManagedWeights(RawEngine const& rawEngine, int localRank)
     setStaticInputTensors(mManagedWeightsMap);
     TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
 }
+
+void TllmRuntime::refitManagedWeights(TensorMap const& weights, BufferManager const& manager)
+{
+    TLLM_LOG_TRACE("%s start", __PRETTY_FUNCTION__);
+    NVTX3_FUNC_RANGE();
+    for (auto const& [name, weight] : weights)
+    {
+        auto const it = mManagedWeightsMap.find(name);
+        TLLM_CHECK_WITH_INFO(it != mManagedWeightsMap.end(),
+            "Cannot update weight '%s': it is not a managed weight of this engine. Build the engine with managed "
+            "weights to make it updatable.",
+            name.c_str());
+        auto const& weightsDevice = it->second;
+        TLLM_CHECK_WITH_INFO(weight->getDataType() == weightsDevice->getDataType(),
+            "Cannot update weight '%s': data type mismatch.", name.c_str());
+        TLLM_CHECK_WITH_INFO(weight->getSize() == weightsDevice->getSize(),
+            "Cannot update weight '%s': expected %zu elements, got %zu.", name.c_str(), weightsDevice->getSize(),
+            weight->getSize());
+        TLLM_LOG_DEBUG("Updating managed weight: %s", name.c_str());
+        manager.copy(*weight, *weightsDevice);
+    }
+    TLLM_LOG_TRACE("%s stop", __PRETTY_FUNCTION__);
+}
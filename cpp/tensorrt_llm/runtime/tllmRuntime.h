@@ -93,6 +93,8 @@ public:
 
     bool executeContext(SizeType32 contextIndex) const;
 
+    bool executeContext(SizeType32 contextIndex, CudaStream const& stream) const;
+
     CudaStream const& getStream() const;
 
     BufferManager::CudaStreamPtr getStreamPtr()
@@ -135,6 +137,12 @@ public:
     std::string getLayerProfileInfo() const;
     void reportToProfiler(SizeType32 contextId);
     void loadManagedWeights(RawEngine const& rawEngine, int localRank);
+
+    /// @brief Copy new values into managed weights in place, keyed by engine tensor name.
+    /// @details Copies are enqueued on the stream of the given manager. Because the device buffers are
+    /// updated in place, tensor addresses bound to the contexts and captured CUDA graphs stay valid.
+    /// Throws if a name is not a managed weight of this engine or if dtype or size do not match.
+    void refitManagedWeights(TensorMap const& weights, BufferManager const& manager);
     void initializeUserBuffer(tensorrt_llm::runtime::WorldConfig const& world_config, SizeType32 maxBatchSize,
         SizeType32 maxBeamWidth, SizeType32 maxSequenceLength, SizeType32 hiddenSize,
         std::optional<SizeType32> maxNumTokens);
@@ -222,8 +230,10 @@ private:
 
     BufferManager::CudaStreamPtr mStream;
     BufferManager mBufferManager;
-    std::unique_ptr<nvinfer1::IRuntime> mRuntime;
-    std::unique_ptr<nvinfer1::ICudaEngine> mEngine;
+    // The runtime and the engine are shared between TllmRuntime instances that load the same engine file
+    // on the same device, so identical weights are only allocated once per process.
+    std::shared_ptr<nvinfer1::IRuntime> mRuntime;
+    std::shared_ptr<nvinfer1::ICudaEngine> mEngine;
     BufferManager::IBufferPtr mEngineBuffer;
     std::vector<std::unique_ptr<nvinfer1::IExecutionContext>> mContexts;
     std::unique_ptr<ITensor> mDummyTensor;
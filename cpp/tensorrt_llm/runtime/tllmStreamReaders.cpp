@@ -16,42 +16,162 @@
 
 #include "tllmStreamReaders.h"
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/asyncFileReader.h"
 #include "tensorrt_llm/common/logger.h"
 
 #include <cufile.h>
 #include <dlfcn.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
-#include <fstream>
 #include <string>
-#include <unistd.h>
 
 // Non-GDS StreamReader
 
 StreamReader::StreamReader(std::filesystem::path fp)
 {
-    mFile.open(fp.string(), std::ios::binary | std::ios::in);
-    TLLM_CHECK_WITH_INFO(mFile.good(), std::string("Error opening engine file: " + fp.string()));
+    mFd = ::open(fp.c_str(), O_RDONLY);
+    TLLM_CHECK_WITH_INFO(mFd >= 0, std::string("Error opening engine file: " + fp.string()));
+    mFileSize = lseek(mFd, 0, SEEK_END);
 }
 
 StreamReader::~StreamReader()
 {
-    if (mFile.is_open())
+    if (mFd >= 0)
     {
-        mFile.close();
+        ::close(mFd);
     }
 }
 
 int64_t StreamReader::read(void* destination, int64_t nbBytes)
 {
-    if (!mFile.good())
+    if (mFd < 0 || mCursor >= mFileSize)
+    {
+        return -1;
+    }
+
+    auto const bytesToRead = std::min(nbBytes, mFileSize - mCursor);
+    if (!tensorrt_llm::common::AsyncFileReader::instance().readRange(
+            mFd, destination, static_cast<size_t>(bytesToRead), mCursor))
+    {
+        return -1;
+    }
+    mCursor += bytesToRead;
+    return bytesToRead;
+}
+
+// Memory-mapped StreamReader
+
+MMapStreamReader::MMapStreamReader(std::filesystem::path const& filePath)
+{
+    int32_t const fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        TLLM_LOG_INFO("Failed to open engine file %s for mapping", filePath.c_str());
+        return;
+    }
+
+    mFileSize = lseek(fd, 0, SEEK_END);
+    if (mFileSize > 0)
+    {
+        void* const data = mmap(nullptr, mFileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED)
+        {
+            mData = data;
+        }
+        else
+        {
+            TLLM_LOG_INFO("Failed to map engine file %s", filePath.c_str());
+        }
+    }
+    // The mapping keeps the file referenced, the descriptor is no longer needed.
+    ::close(fd);
+
+    if (mData == nullptr)
+    {
+        return;
+    }
+
+    madvise(mData, mFileSize, MADV_SEQUENTIAL);
+    // Queue readahead chunk by chunk from a background thread, so the disk stays busy while TensorRT
+    // deserializes the parts that are already resident.
+    mPrefetchThread = std::thread(
+        [data = mData, size = mFileSize]()
+        {
+            constexpr int64_t kPrefetchChunkSize{64LL << 20};
+            for (int64_t offset = 0; offset < size; offset += kPrefetchChunkSize)
+            {
+                madvise(static_cast<char*>(data) + offset, std::min(kPrefetchChunkSize, size - offset),
+                    MADV_WILLNEED);
+            }
+        });
+}
+
+MMapStreamReader::~MMapStreamReader()
+{
+    if (mPrefetchThread.joinable())
+    {
+        mPrefetchThread.join();
+    }
+
+    if (mData != nullptr)
+    {
+        munmap(mData, mFileSize);
+        mData = nullptr;
+    }
+}
+
+[[nodiscard]] bool MMapStreamReader::isOpen() const
+{
+    return mData != nullptr;
+}
+
+bool MMapStreamReader::seek(int64_t offset, nvinfer1::SeekPosition where) noexcept
+{
+    switch (where)
+    {
+    case nvinfer1::SeekPosition::kSET: mCursor = offset; return true;
+    case nvinfer1::SeekPosition::kCUR: mCursor += offset; return true;
+    case nvinfer1::SeekPosition::kEND: mCursor = mFileSize + offset; return true;
+    default: return false;
+    }
+    return true;
+}
+
+int64_t MMapStreamReader::read(void* dest, int64_t bytes, cudaStream_t stream) noexcept
+{
+    if (mData == nullptr || mCursor < 0 || mCursor > mFileSize)
     {
         return -1;
     }
 
-    mFile.read(static_cast<char*>(destination), nbBytes);
+    auto const nbBytes = std::min(bytes, mFileSize - mCursor);
+    auto const* const src = static_cast<char const*>(mData) + mCursor;
+
+    cudaPointerAttributes attributes{};
+    if (cudaPointerGetAttributes(&attributes, dest) != cudaSuccess)
+    {
+        TLLM_LOG_INFO("cudaPointerGetAttributes failed");
+    }
+
+    if (attributes.type == cudaMemoryTypeDevice)
+    {
+        if (cudaMemcpyAsync(dest, src, nbBytes, cudaMemcpyHostToDevice, stream) != cudaSuccess)
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        std::memcpy(dest, src, nbBytes);
+    }
 
-    return mFile.gcount();
+    mCursor += nbBytes;
+    return nbBytes;
 }
 
 // StreamReader using GDS
@@ -19,8 +19,11 @@
 
 #include <cufile.h>
 #include <filesystem>
-#include <fstream>
+#include <thread>
 
+//! Fallback stream reader backed by the shared AsyncFileReader service: large reads are split into
+//! chunks submitted together, so deserialization-sized requests see NVMe queue depth instead of one
+//! blocking read.
 class StreamReader final : public nvinfer1::IStreamReader
 {
 public:
@@ -31,7 +34,32 @@ public:
     int64_t read(void* destination, int64_t nbBytes) final;
 
 private:
-    std::ifstream mFile;
+    int mFd{-1};
+    int64_t mFileSize{0};
+    int64_t mCursor{0};
+};
+
+//! Stream reader that maps the engine file and feeds TensorRT directly from the page cache, avoiding a
+//! second host copy of the serialized engine. A background thread queues readahead for the whole file so
+//! cold starts are bounded by disk bandwidth instead of alternating between reading and deserializing.
+class MMapStreamReader final : public nvinfer1::IStreamReaderV2
+{
+public:
+    explicit MMapStreamReader(std::filesystem::path const& filePath);
+
+    virtual ~MMapStreamReader();
+
+    [[nodiscard]] bool isOpen() const;
+
+    int64_t read(void* dest, int64_t bytes, cudaStream_t stream) noexcept final;
+
+    bool seek(int64_t offset, nvinfer1::SeekPosition where) noexcept final;
+
+private:
+    void* mData{nullptr};
+    int64_t mFileSize{0};
+    int64_t mCursor{0};
+    std::thread mPrefetchThread;
 };
 
 class GDSStreamReader final : public nvinfer1::IStreamReaderV2
@@ -17,6 +17,8 @@
 #pragma once
 
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
+#include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/iTensor.h"
 #include "tensorrt_llm/runtime/torchUtils.h"
 
@@ -38,6 +40,39 @@ public:
         return ITensor::UniquePtr{new TorchView{std::move(tensor)}};
     }
 
+    //! \brief Whether the tensor's storage can be reinterpreted as a dense row-major ITensor
+    //! without a copy. Size-1 and zero-element dimensions may carry arbitrary strides.
+    static bool isAliasable(at::Tensor const& tensor)
+    {
+        return tensor.layout() == at::kStrided && !tensor.is_conj() && !tensor.is_neg() && tensor.is_contiguous();
+    }
+
+    //! \brief Wraps tensor as an ITensor, aliasing its storage whenever the layout allows it and
+    //! materializing a contiguous copy otherwise. Setting TRTLLM_TORCH_BRIDGE_DEBUG logs each
+    //! hidden copy together with the caller-supplied provenance and the offending layout.
+    static ITensor::UniquePtr aliasOrCopy(at::Tensor tensor, char const* provenance = nullptr)
+    {
+        if (isAliasable(tensor))
+        {
+            return ITensor::UniquePtr{new TorchView{std::move(tensor), true}};
+        }
+        if (common::getEnvTorchBridgeDebug())
+        {
+            TLLM_LOG_WARNING("Torch bridge [%s]: hidden contiguous copy of %s tensor, sizes %s, strides %s",
+                provenance != nullptr ? provenance : "unknown", c10::toString(tensor.scalar_type()),
+                c10::str(tensor.sizes()).c_str(), c10::str(tensor.strides()).c_str());
+        }
+        return ITensor::UniquePtr{new TorchView{tensor.contiguous(), false}};
+    }
+
+    //! \brief Whether this view aliases the torch storage it was created from. Views created
+    //! through aliasOrCopy from a non-aliasable layout do not; writes through them are invisible
+    //! to the original tensor.
+    [[nodiscard]] bool isAlias() const noexcept
+    {
+        return mIsAlias;
+    }
+
     void* data() override
     {
         return TLLM_LIKELY(getSize() > 0) ? mTensor.data_ptr() : nullptr;
@@ -96,16 +131,20 @@ public:
     }
 
 private:
-    explicit TorchView(at::Tensor&& tensor)
+    explicit TorchView(at::Tensor&& tensor, bool isAlias = true)
         : mTensor(tensor)
         , mDims{TorchUtils::shape(mTensor.sizes())}
         , mCapacity{static_cast<std::size_t>(mTensor.numel())}
+        , mIsAlias{isAlias}
     {
-        TLLM_CHECK(mTensor.is_contiguous());
+        TLLM_CHECK_WITH_INFO(isAliasable(mTensor),
+            "Cannot alias a non-contiguous torch tensor (sizes %s, strides %s); use TorchView::aliasOrCopy.",
+            c10::str(mTensor.sizes()).c_str(), c10::str(mTensor.strides()).c_str());
     };
 
     at::Tensor mTensor;
     Shape mDims;
     std::size_t mCapacity;
+    bool mIsAlias;
 };
 } // namespace tensorrt_llm::runtime
@@ -20,12 +20,14 @@
 #include "tensorrt_llm/runtime/utils/mpiUtils.h"
 
 #include "tensorrt_llm/common/assert.h"
+#include "tensorrt_llm/common/envUtils.h"
 #include "tensorrt_llm/common/logger.h"
 #include "tensorrt_llm/runtime/common.h"
 #include "tensorrt_llm/runtime/iBuffer.h"
 
 #include <csignal>
 #include <cstdlib>
+#include <cstring>
 #include <mutex>
 #include <thread>
 #include <type_traits>
@@ -97,9 +99,65 @@ namespace
 bool mpiInitialized = false;
 std::recursive_mutex mpiMutex;
 
+// Set by initialize() when the process was started without an MPI launcher. The session then
+// degenerates to rank 0 of a size-1 world and MPI itself is never initialized, so every MpiComm
+// query has to answer without touching the MPI library.
+bool mpiSessionElided = false;
+
+#if ENABLE_MULTI_DEVICE
+// A process that was not started by an MPI launcher cannot gain peers later, so its MPI session is
+// known to be a single rank without calling MPI_Init. Launchers advertise themselves through their
+// environment; absence of all known markers identifies a plain single-process launch.
+// TRTLLM_FORCE_MPI_INIT=1 restores the previous behavior of always initializing MPI.
+bool isSingleProcessLaunch()
+{
+    if (tensorrt_llm::common::getEnvForceMpiInit())
+    {
+        return false;
+    }
+    for (auto const* launcherEnv :
+        {"OMPI_COMM_WORLD_SIZE", "PMI_SIZE", "PMI_RANK", "PMIX_RANK", "SLURM_PROCID", "MV2_COMM_WORLD_SIZE"})
+    {
+        if (std::getenv(launcherEnv) != nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Byte width per element, for the elided session's self-copy collectives, which must answer
+// without calling into the MPI library.
+size_t getDtypeSize(MpiType dtype)
+{
+    switch (dtype)
+    {
+    case MpiType::kBYTE:
+    case MpiType::kBOOL:
+    case MpiType::kINT8:
+    case MpiType::kUINT8:
+    case MpiType::kFP8:
+    case MpiType::kCHAR: return 1;
+    case MpiType::kHALF:
+    case MpiType::kBF16: return 2;
+    case MpiType::kFLOAT:
+    case MpiType::kINT32:
+    case MpiType::kUINT32: return 4;
+    case MpiType::kDOUBLE:
+    case MpiType::kINT64:
+    case MpiType::kUINT64: return 8;
+    }
+    TLLM_THROW("Unknown MPI dtype");
+}
+#endif // ENABLE_MULTI_DEVICE
+
 MpiComm initLocalSession()
 {
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return MpiComm{COMM_SESSION, false};
+    }
     MPI_Comm localComm = nullptr;
     MPI_Comm_split_type(COMM_SESSION, OMPI_COMM_TYPE_HOST, COMM_SESSION.getRank(), MPI_INFO_NULL, &localComm);
     MpiComm localSession{localComm, false};
@@ -114,6 +172,10 @@ MpiComm initLocalSession()
 std::vector<int> getWorldRanks(MpiComm const& comm)
 {
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return {0};
+    }
     MPI_Group group = nullptr;
     MPI_Group worldGroup = nullptr;
 
@@ -138,6 +200,10 @@ std::vector<int> getWorldRanks(MpiComm const& comm)
 int getNumNodes()
 {
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return 1;
+    }
     TLLM_LOG_WARNING("Number of nodes was not provided, using MPI to determine number of nodes");
 
     // Create a communicator for processes with the same hostname
@@ -161,6 +227,54 @@ int getNumNodes()
 #endif
 }
 
+#if ENABLE_MULTI_DEVICE
+namespace
+{
+
+void initializeMpi(MpiThreadSupport threadMode, bool forwardAbortToParent)
+{
+    TLLM_LOG_INFO("Initializing MPI with thread mode %d", threadMode);
+    int providedMode = 0;
+    auto requiredMode = static_cast<int>(threadMode);
+    MPICHECK(MPI_Init_thread(nullptr, nullptr, requiredMode, &providedMode));
+    TLLM_CHECK_WITH_INFO(providedMode >= requiredMode, "MPI_Init_thread failed");
+    std::atexit([]() { MPI_Finalize(); });
+
+    /*
+     * We only catch SIGABRT and SIGSEGV because most, of not all errors in the worker will cause one of these 2
+     * signals. Signals like SIGINT and SIGTERM should be issued to the parent and should terminate MPI workers
+     * correctly.
+     */
+    for (int sig : {SIGABRT, SIGSEGV})
+    {
+        __sighandler_t previousHandler = nullptr;
+        if (forwardAbortToParent)
+        {
+            previousHandler = std::signal(sig,
+                [](int signal)
+                {
+#ifndef _WIN32
+                    pid_t parentProcessId = getppid();
+                    kill(parentProcessId, SIGKILL);
+#endif
+                    MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
+                });
+        }
+        else
+        {
+            previousHandler = std::signal(sig, [](int signal) { MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE); });
+        }
+        TLLM_CHECK_WITH_INFO(previousHandler != SIG_ERR, "Signal handler setup failed");
+    }
+
+    // ensure local MPI communicator is initialized
+    MpiComm::localSession();
+    TLLM_LOG_INFO("Initialized MPI");
+}
+
+} // namespace
+#endif // ENABLE_MULTI_DEVICE
+
 void initialize(MpiThreadSupport threadMode, bool forwardAbortToParent)
 {
     // double-checked locking
@@ -178,43 +292,37 @@ void initialize(MpiThreadSupport threadMode, bool forwardAbortToParent)
     TLLM_MPI_CHECK(MPI_Initialized(&initialized));
     if (!initialized)
     {
-        TLLM_LOG_INFO("Initializing MPI with thread mode %d", threadMode);
-        int providedMode = 0;
-        auto requiredMode = static_cast<int>(threadMode);
-        MPICHECK(MPI_Init_thread(nullptr, nullptr, requiredMode, &providedMode));
-        TLLM_CHECK_WITH_INFO(providedMode >= requiredMode, "MPI_Init_thread failed");
-        std::atexit([]() { MPI_Finalize(); });
-
-        /*
-         * We only catch SIGABRT and SIGSEGV because most, of not all errors in the worker will cause one of these 2
-         * signals. Signals like SIGINT and SIGTERM should be issued to the parent and should terminate MPI workers
-         * correctly.
-         */
-        for (int sig : {SIGABRT, SIGSEGV})
+        if (isSingleProcessLaunch())
         {
-            __sighandler_t previousHandler = nullptr;
-            if (forwardAbortToParent)
-            {
-                previousHandler = std::signal(sig,
-                    [](int signal)
-                    {
-#ifndef _WIN32
-                        pid_t parentProcessId = getppid();
-                        kill(parentProcessId, SIGKILL);
-#endif
-                        MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE);
-                    });
-            }
-            else
-            {
-                previousHandler = std::signal(sig, [](int signal) { MPI_Abort(MPI_COMM_WORLD, EXIT_FAILURE); });
-            }
-            TLLM_CHECK_WITH_INFO(previousHandler != SIG_ERR, "Signal handler setup failed");
+            // Single-GPU fast path: the session is trivially rank 0 of a size-1 world, so skip
+            // MPI_Init and all of its machinery (progress threads, signal handlers, the
+            // local-session split and the MPI_Finalize atexit hook). Saves noticeable startup
+            // time on TP=1 runs.
+            TLLM_LOG_INFO("Single-process launch detected, eliding MPI initialization");
+            mpiSessionElided = true;
+        }
+        else
+        {
+            initializeMpi(threadMode, forwardAbortToParent);
         }
+    }
+#endif // ENABLE_MULTI_DEVICE
+    mpiInitialized = true;
+}
 
-        // ensure local MPI communicator is initialized
-        MpiComm::localSession();
-        TLLM_LOG_INFO("Initialized MPI");
+void forceInitialize(MpiThreadSupport threadMode, bool forwardAbortToParent)
+{
+    std::lock_guard<std::recursive_mutex> lk(mpiMutex);
+#if ENABLE_MULTI_DEVICE
+    // Leave the fast path before initializing so that the local session is derived from a real
+    // communicator. Answers given while elided (rank 0 of a size-1 world) stay valid: without a
+    // launcher the world has exactly one rank.
+    mpiSessionElided = false;
+    int initialized = 0;
+    TLLM_MPI_CHECK(MPI_Initialized(&initialized));
+    if (!initialized)
+    {
+        initializeMpi(threadMode, forwardAbortToParent);
     }
 #endif // ENABLE_MULTI_DEVICE
     mpiInitialized = true;
@@ -224,6 +332,10 @@ void MpiComm::barrier() const
 {
     couldUseMPI();
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return;
+    }
     MPICHECK(MPI_Barrier(mComm));
 #else
     TLLM_THROW("Multi device support is disabled.");
@@ -288,6 +400,10 @@ void MpiComm::bcast(void* buffer, size_t size, MpiType dtype, int root) const
 {
     couldUseMPI();
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return; // broadcasting to self is a no-op
+    }
     invokeChunked(MPI_Bcast, buffer, size, getMpiDtype(dtype), root, mComm);
 #else
     TLLM_THROW("Multi device support is disabled.");
@@ -397,6 +513,11 @@ void MpiComm::allreduce(void const* sendbuf, void* recvbuf, int count, MpiType d
 {
     couldUseMPI();
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        std::memcpy(recvbuf, sendbuf, count * getDtypeSize(dtype));
+        return;
+    }
     MPICHECK(MPI_Allreduce(sendbuf, recvbuf, count, getMpiDtype(dtype), getMpiOp(op), mComm));
 #else
     TLLM_THROW("Multi device support is disabled.");
@@ -407,6 +528,11 @@ void MpiComm::allgather(void const* sendbuf, void* recvbuf, int count, MpiType d
 {
     couldUseMPI();
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        std::memcpy(recvbuf, sendbuf, count * getDtypeSize(dtype));
+        return;
+    }
     MPICHECK(MPI_Allgather(sendbuf, count, getMpiDtype(dtype), recvbuf, count, getMpiDtype(dtype), mComm));
 #else
     TLLM_THROW("Multi device support is disabled.");
@@ -418,6 +544,12 @@ void MpiComm::allgatherv(void const* sendbuf, int sendcount, MpiType sendtype, v
 {
     couldUseMPI();
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        std::memcpy(static_cast<char*>(recvbuf) + displs.at(0) * getDtypeSize(recvtype), sendbuf,
+            sendcount * getDtypeSize(sendtype));
+        return;
+    }
     MPICHECK(MPI_Allgatherv(sendbuf, sendcount, getMpiDtype(sendtype), recvbuf, recvcounts.data(), displs.data(),
         getMpiDtype(recvtype), mComm));
 
@@ -478,7 +610,10 @@ int MpiComm::getRank() const
 {
     int rank = 0;
 #if ENABLE_MULTI_DEVICE
-    MPICHECK(MPI_Comm_rank(mComm, &rank));
+    if (!mpiSessionElided)
+    {
+        MPICHECK(MPI_Comm_rank(mComm, &rank));
+    }
 #endif
     return rank;
 }
@@ -487,7 +622,10 @@ int MpiComm::getSize() const
 {
     int world_size = 1;
 #if ENABLE_MULTI_DEVICE
-    MPICHECK(MPI_Comm_size(mComm, &world_size));
+    if (!mpiSessionElided)
+    {
+        MPICHECK(MPI_Comm_size(mComm, &world_size));
+    }
 #endif
     return world_size;
 }
@@ -521,6 +659,10 @@ MpiComm& MpiComm::mutableLocalSession()
 void MpiComm::refreshLocalSession()
 {
 #if ENABLE_MULTI_DEVICE
+    if (mpiSessionElided)
+    {
+        return; // the local session already equals the size-1 session
+    }
     static std::mutex mutex;
     std::unique_lock lock(mutex);
     auto initSessionRanks = getWorldRanks(MpiComm::session());
@@ -320,6 +320,66 @@ size_t CudaVirtualMemoryManager::materializeWithTag(std::string const& tag)
     return count;
 }
 
+GrowableDeviceBuffer::GrowableDeviceBuffer(std::size_t capacity, std::size_t chunkSize, int device)
+{
+    CUmemAllocationProp const prop{CU_MEM_ALLOCATION_TYPE_PINNED, CU_MEM_HANDLE_TYPE_NONE,
+        {
+            CU_MEM_LOCATION_TYPE_DEVICE,
+            device,
+        }};
+
+    std::size_t granularity{};
+    TLLM_CU_CHECK(cuMemGetAllocationGranularity(&granularity, &prop, CU_MEM_ALLOC_GRANULARITY_MINIMUM));
+    mChunkSize = (chunkSize + granularity - 1) & ~(granularity - 1);
+
+    auto const numChunks = (capacity + mChunkSize - 1) / mChunkSize;
+    TLLM_CHECK_WITH_INFO(numChunks > 0, "GrowableDeviceBuffer capacity cannot be zero");
+    TLLM_CU_CHECK(cuMemAddressReserve(&mAddress, numChunks * mChunkSize, 0, {}, 0));
+
+    CUmemAccessDesc const desc{{
+                                   CU_MEM_LOCATION_TYPE_DEVICE,
+                                   device,
+                               },
+        CU_MEM_ACCESS_FLAGS_PROT_READWRITE};
+    mChunks.reserve(numChunks);
+    for (std::size_t i = 0; i < numChunks; ++i)
+    {
+        CUDAVirtualMemoryChunk::Configurators configurators;
+        configurators.push_back(std::make_unique<UnicastConfigurator>(mAddress + i * mChunkSize, mChunkSize, desc));
+        mChunks.emplace_back(std::make_unique<LocalCreator<>>(prop, mChunkSize), std::move(configurators));
+    }
+}
+
+GrowableDeviceBuffer::~GrowableDeviceBuffer()
+{
+    auto const reservedSize = capacity();
+    // Chunks unmap themselves on destruction; the address range must outlive them.
+    mChunks.clear();
+    TLLM_CU_CHECK_FREE_RESOURCE(cuMemAddressFree(mAddress, reservedSize));
+}
+
+std::size_t GrowableDeviceBuffer::grow(std::size_t newSize)
+{
+    TLLM_CHECK_WITH_INFO(
+        newSize <= capacity(), "Cannot grow to %zu bytes; only %zu bytes are reserved", newSize, capacity());
+    while (size() < newSize)
+    {
+        mChunks[mMappedChunks].materialize();
+        ++mMappedChunks;
+    }
+    return size();
+}
+
+std::size_t GrowableDeviceBuffer::shrink(std::size_t newSize)
+{
+    while (mMappedChunks > 0 && mChunkSize * (mMappedChunks - 1) >= newSize)
+    {
+        mChunks[mMappedChunks - 1].release();
+        --mMappedChunks;
+    }
+    return size();
+}
+
 static_assert(sizeof(void*) == sizeof(CUdeviceptr));
 
 static CUdeviceptr deviceptr_cast(void* ptr)
@@ -336,6 +396,11 @@ static void* deviceptr_cast(CUdeviceptr ptr)
     return ret;
 }
 
+void* GrowableDeviceBuffer::data() const noexcept
+{
+    return deviceptr_cast(mAddress);
+}
+
 void CudaVirtualMemoryAllocator::allocate(Pointer* ptr, std::size_t n, int device) const
 {
     CUdeviceptr address{};
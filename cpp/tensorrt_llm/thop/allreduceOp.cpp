@@ -49,8 +49,12 @@
 #include <nvml.h>
 #include <torch/extension.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <optional>
 #include <unordered_set>
 
 // using namespace nvinfer1;
@@ -256,7 +260,14 @@ public:
     {
     }
 
-    ~AllreduceOp() = default;
+    ~AllreduceOp()
+    {
+        if (mProbeStart != nullptr)
+        {
+            cudaEventDestroy(mProbeStart);
+            cudaEventDestroy(mProbeStop);
+        }
+    }
 
     int getRank() const
     {
@@ -269,7 +280,8 @@ public:
     std::vector<torch::Tensor> run(torch::Tensor const& input, torch::optional<torch::Tensor> const& residual,
         torch::optional<torch::Tensor> const& norm_weight, torch::optional<torch::Tensor> const& scale,
         torch::optional<torch::Tensor> const& bias, bool trigger_completion_at_end,
-        torch::optional<torch::Tensor> workspace) noexcept
+        torch::optional<torch::Tensor> workspace,
+        torch::optional<torch::Tensor> const& error_feedback = torch::nullopt) noexcept
     {
         size_t size = input.numel();
         size_t seq_len = input.size(0);
@@ -282,22 +294,42 @@ public:
         auto const rank = getRank();
         logRunTimeStrategy(runtime_strategy, rank);
 
+        bool const probeThisCall = mProbeArmed;
+        mProbeArmed = false;
+        if (probeThisCall)
+        {
+            recordProbeStart(input.get_device());
+        }
+
         // Dispatch to different allreduce implementations
+        std::vector<torch::Tensor> output;
         switch (runtime_strategy)
         {
-        case AllReduceStrategyType::UB: return runUBAllReduce(input, residual, norm_weight, scale, bias);
-        case AllReduceStrategyType::NCCL: return runNCCLAllReduce(input, residual, norm_weight, scale, bias);
+        case AllReduceStrategyType::UB: output = runUBAllReduce(input, residual, norm_weight, scale, bias); break;
+        case AllReduceStrategyType::NCCL: output = runNCCLAllReduce(input, residual, norm_weight, scale, bias); break;
         case AllReduceStrategyType::NCCL_SYMMETRIC:
-            return runNCCLAllReduceSymmetric(input, residual, norm_weight, scale, bias);
+            output = runNCCLAllReduceSymmetric(input, residual, norm_weight, scale, bias);
+            break;
+        case AllReduceStrategyType::HIERARCHICAL:
+            output = runHierarchicalAllReduce(input, residual, norm_weight, scale, bias);
+            break;
         case AllReduceStrategyType::MIN_LATENCY:
         case AllReduceStrategyType::ONESHOT:
         case AllReduceStrategyType::TWOSHOT:
-            return runFusionAllReduce(
+            output = runFusionAllReduce(
                 input, residual, norm_weight, scale, bias, trigger_completion_at_end, workspace, runtime_strategy);
+            break;
         case AllReduceStrategyType::LOWPRECISION:
-            return runLowPrecisionAllReduce(input, residual, norm_weight, scale, bias);
+            output = runLowPrecisionAllReduce(input, residual, norm_weight, scale, bias, error_feedback);
+            break;
         default: TORCH_CHECK(false, "Invalid runtime strategy"); return {};
         }
+
+        if (probeThisCall)
+        {
+            recordProbeStop(input.get_device(), runtime_strategy);
+        }
+        return output;
     }
 
     int initialize()
@@ -311,6 +343,12 @@ public:
         {
 
             initGroupTopology();
+            // Groups spanning nodes can use the hierarchical strategy. Its communicators are only
+            // available on the MPI session path; the process-group path keeps the NCCL fallback.
+            if (!mIsP2PSupported && mNcclComm.index() == 0)
+            {
+                initHierarchicalComms();
+            }
         }
 
         TLLM_LOG_TRACE("%s stop for rank %d", __PRETTY_FUNCTION__, getRank());
@@ -475,9 +513,44 @@ private:
         return fallbackRunSubsequentOps(input, residual, norm_weight, scale, bias, norm_out);
     }
 
+    std::vector<torch::Tensor> runHierarchicalAllReduce(torch::Tensor const& input,
+        torch::optional<torch::Tensor> const& residual, torch::optional<torch::Tensor> const& norm_weight,
+        torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias)
+    {
+        auto stream = at::cuda::getCurrentCUDAStream(input.get_device());
+        size_t const size = input.numel();
+        size_t const chunk_size = size / mHierLocalSize;
+        size_t const bytes_per_element = input.element_size();
+
+        torch::Tensor reduce_output = torch::empty_like(input);
+        void* const shard_ptr = static_cast<char*>(reduce_output.mutable_data_ptr())
+            + mHierLocalSlot * chunk_size * bytes_per_element;
+
+        // Reduce-scatter over NVLink so each local rank owns a 1/localSize shard, all-reduce only
+        // that shard across the IB links, then all-gather the shards back over NVLink. Chunk
+        // ownership of reduce-scatter and all-gather follow the same rank order, so the
+        // concatenation equals the flat all-reduce result.
+        auto const nccl_dtype = (*getDtypeMap())[mType];
+        NCCLCHECK_THROW(ncclReduceScatter(
+            input.data_ptr(), shard_ptr, chunk_size, nccl_dtype, ncclSum, *mHierLocalComm, stream));
+        NCCLCHECK_THROW(
+            ncclAllReduce(shard_ptr, shard_ptr, chunk_size, nccl_dtype, ncclSum, *mHierCrossComm, stream));
+        NCCLCHECK_THROW(ncclAllGather(
+            shard_ptr, reduce_output.mutable_data_ptr(), chunk_size, nccl_dtype, *mHierLocalComm, stream));
+
+        if (mOp == AllReduceFusionOp::NONE)
+        {
+            return {reduce_output};
+        }
+
+        // Treat any other patterns as fallback cases.
+        return fallbackRunSubsequentOps(input, residual, norm_weight, scale, bias, reduce_output);
+    }
+
     std::vector<torch::Tensor> runLowPrecisionAllReduce(torch::Tensor const& input,
         torch::optional<torch::Tensor> const& residual, torch::optional<torch::Tensor> const& norm_weight,
-        torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias) noexcept
+        torch::optional<torch::Tensor> const& scale, torch::optional<torch::Tensor> const& bias,
+        torch::optional<torch::Tensor> const& error_feedback) noexcept
     {
 #ifdef ENABLE_FP8
         auto stream = at::cuda::getCurrentCUDAStream(input.get_device());
@@ -503,6 +576,17 @@ private:
 
         torch::Tensor reduce_output = torch::empty_like(input);
 
+        // Optional error-feedback compensation: the buffer must persist across calls for the same layer and
+        // mirror the input exactly so the carried-over quantization error lines up element by element.
+        char* error_feedback_ptr = nullptr;
+        if (error_feedback)
+        {
+            TORCH_CHECK(error_feedback.value().scalar_type() == input.scalar_type()
+                    && error_feedback.value().numel() == input.numel(),
+                "error_feedback must match the input dtype and number of elements");
+            error_feedback_ptr = reinterpret_cast<char*>(error_feedback.value().mutable_data_ptr());
+        }
+
         size_t global_offset = 0;
         for (size_t i = 0; i < parts.size(); ++i)
         {
@@ -524,6 +608,11 @@ private:
             tmp_param.local_output_buffer_ptr = reinterpret_cast<void*>(
                 reinterpret_cast<char*>(reduce_output.mutable_data_ptr()) + global_offset * bytes_per_element);
             tmp_param.elts_total = tmp_size;
+            if (error_feedback_ptr != nullptr)
+            {
+                tmp_param.error_feedback_buffer
+                    = reinterpret_cast<void*>(error_feedback_ptr + global_offset * bytes_per_element);
+            }
             tensorrt_llm::kernels::customLowPrecisionAllReduce(tmp_param, mType, stream);
 
             global_offset += tmp_size;
@@ -732,23 +821,40 @@ private:
         torch::Tensor& reduce_output)
     {
         // If we reach here, it means the extra fallback operations are required.
-        // All patterns are broken into ALlReduce + residual_rms_norm + following operations (quantization, etc.)
+        // FP8 patterns fuse the quantization into the residual_rms_norm kernel; the NVFP4 patterns are broken into
+        // AllReduce + residual_rms_norm + a separate block-scaled quantization kernel.
         auto const size = input.numel();
         auto const hidden_size = input.size(-1);
         auto const stream = at::cuda::getCurrentCUDAStream(input.get_device());
 
-        torch::Tensor norm_out = torch::empty_like(input);
+        bool const fuse_fp8_quant = mOp == AllReduceFusionOp::RESIDUAL_RMS_NORM_QUANT_FP8
+            || mOp == AllReduceFusionOp::RESIDUAL_RMS_NORM_OUT_QUANT_FP8;
+        bool const need_norm_out = mOp != AllReduceFusionOp::RESIDUAL_RMS_NORM_QUANT_FP8;
+
+        torch::Tensor norm_out;
+        torch::Tensor quant_out;
+        if (need_norm_out)
+        {
+            norm_out = torch::empty_like(input);
+        }
 
         tensorrt_llm::kernels::AllReduceParams params;
         params.fusion_params.bias_buffer = bias ? bias.value().data_ptr() : nullptr;
         params.fusion_params.residual_buffer = residual ? residual.value().data_ptr() : nullptr;
         params.fusion_params.weight_buffer = norm_weight ? norm_weight.value().data_ptr() : nullptr;
-        params.local_output_buffer_ptr = norm_out.mutable_data_ptr();
+        params.local_output_buffer_ptr = need_norm_out ? norm_out.mutable_data_ptr() : nullptr;
         params.elts_total = size;
 
         params.fusion_params.hidden_size = hidden_size;
         params.fusion_params.eps = mEps;
         params.fusion_params.intermediate_buffer = reduce_output.mutable_data_ptr();
+        if (fuse_fp8_quant)
+        {
+            TORCH_CHECK(scale, "scale is required for quantization ops");
+            quant_out = at::detail::empty_cuda(input.sizes(), torch::kFloat8_e4m3fn, input.device(), std::nullopt);
+            params.fusion_params.scale_factor = static_cast<float const*>(scale.value().data_ptr());
+            params.fusion_params.quant_buffer = quant_out.mutable_data_ptr();
+        }
         tensorrt_llm::kernels::residualRmsNorm(params, mType, stream, AllReduceFusionOp::RESIDUAL_RMS_NORM);
 
         // If no quantization is needed, return the norm and residual outputs.
@@ -757,6 +863,16 @@ private:
             return {norm_out, reduce_output};
         }
 
+        // FP8 quantization has already been fused into the norm kernel above.
+        if (mOp == AllReduceFusionOp::RESIDUAL_RMS_NORM_QUANT_FP8)
+        {
+            return {quant_out, reduce_output};
+        }
+        if (mOp == AllReduceFusionOp::RESIDUAL_RMS_NORM_OUT_QUANT_FP8)
+        {
+            return {norm_out, quant_out, reduce_output};
+        }
+
         const int64_t sf_vecsize = 16;
         bool const sf_use_ue8m0 = false;
         bool const is_sf_swizzled_layout = true;
@@ -765,22 +881,12 @@ private:
         // Attach the subsequent operations after the residual RMS norm all-reduce and return the final outputs.
         switch (mOp)
         {
-        case AllReduceFusionOp::RESIDUAL_RMS_NORM_QUANT_FP8:
-        {
-            auto [quant_out, scale_out] = torch_ext::symmetric_static_quantize_per_tensor(norm_out, scale.value());
-            return {quant_out, reduce_output};
-        }
         case AllReduceFusionOp::RESIDUAL_RMS_NORM_QUANT_NVFP4:
         {
             auto [quant_out, scale_out]
                 = torch_ext::fp4_quantize(norm_out, scale.value(), sf_vecsize, sf_use_ue8m0, is_sf_swizzled_layout);
             return {quant_out, scale_out, reduce_output};
         }
-        case AllReduceFusionOp::RESIDUAL_RMS_NORM_OUT_QUANT_FP8:
-        {
-            auto [quant_out, scale_out] = torch_ext::symmetric_static_quantize_per_tensor(norm_out, scale.value());
-            return {norm_out, quant_out, reduce_output};
-        }
         case AllReduceFusionOp::RESIDUAL_RMS_NORM_OUT_QUANT_NVFP4:
         {
             auto [quant_out, scale_out]
@@ -809,6 +915,11 @@ private:
         {
             runtime_strategy = AllReduceStrategyType::NCCL_SYMMETRIC;
         }
+        else if (mStrategy == AllReduceStrategyType::HIERARCHICAL)
+        {
+            runtime_strategy = isHierarchicalAvailable(size) ? AllReduceStrategyType::HIERARCHICAL
+                                                             : AllReduceStrategyType::NCCL;
+        }
         else
         {
             // This is for DEBUG and BENCHMARK purpose. It will overried the strategy if AUTO is set.
@@ -820,6 +931,7 @@ private:
             else
             {
                 runtime_strategy = selectImplementation(seq_len, size, mGroup.size(), mType);
+                runtime_strategy = adaptStrategy(runtime_strategy, seq_len, size);
             }
         }
         return runtime_strategy;
@@ -854,6 +966,11 @@ private:
             TLLM_LOG_DEBUG("AllReducePlugin strategy for rank %d: LOWPRECISION", rank);
             break;
         }
+        case AllReduceStrategyType::HIERARCHICAL:
+        {
+            TLLM_LOG_DEBUG("AllReducePlugin strategy for rank %d: HIERARCHICAL", rank);
+            break;
+        }
         default: TLLM_LOG_DEBUG("AllReducePlugin strategy for rank %d: UNKNOWN: %d", rank, strategy); break;
         }
     }
@@ -985,6 +1102,88 @@ private:
         }
     }
 
+    void initHierarchicalComms()
+    {
+        // Group discovery below uses session-wide collectives; cache the result per group like
+        // initGroupTopology so the per-call op construction stays cheap.
+        static std::map<std::set<int>, std::optional<std::pair<std::set<int>, std::set<int>>>> cache;
+        auto it = cache.find(mGroup);
+        if (it == cache.end())
+        {
+            it = cache.emplace(mGroup, computeHierarchicalGroups()).first;
+        }
+        if (!it->second.has_value())
+        {
+            return;
+        }
+        auto const& [local_group, cross_group] = it->second.value();
+        mHierLocalComm = getComm(local_group);
+        mHierCrossComm = getComm(cross_group);
+        mHierLocalSize = local_group.size();
+        mHierLocalSlot = std::distance(local_group.begin(), local_group.find(COMM_SESSION.getRank()));
+    }
+
+    std::optional<std::pair<std::set<int>, std::set<int>>> computeHierarchicalGroups()
+    {
+        auto const myRank = COMM_SESSION.getRank();
+        auto const worldSize = COMM_SESSION.getSize();
+        // Discovering on which node each group member lives takes session-wide collectives, which
+        // are only safe when every rank of the session participates in this group.
+        if (mGroup.size() != static_cast<size_t>(worldSize))
+        {
+            return std::nullopt;
+        }
+
+        // The world rank of local rank 0 uniquely identifies the node.
+        auto const localSize = static_cast<size_t>(LOCAL_COMM_SESSION.getSize());
+        std::vector<int32_t> localWorldRanks(localSize, 0);
+        LOCAL_COMM_SESSION.allgather(&myRank, localWorldRanks.data(), 1, tensorrt_llm::mpi::MpiType::kINT32);
+        int32_t const nodeId = localWorldRanks[0];
+        std::vector<int32_t> nodeIds(worldSize, 0);
+        COMM_SESSION.allgather(&nodeId, nodeIds.data(), 1, tensorrt_llm::mpi::MpiType::kINT32);
+
+        std::map<int32_t, std::set<int>> nodeMembers;
+        for (int rank = 0; rank < worldSize; ++rank)
+        {
+            nodeMembers[nodeIds[rank]].insert(rank);
+        }
+        // Single node: the flat strategies already cover it.
+        if (nodeMembers.size() < 2)
+        {
+            return std::nullopt;
+        }
+        // The shard exchanged across nodes pairs the i-th rank of every node; that requires an
+        // equal member count per node, and more than one member for the split to gain anything.
+        auto const membersPerNode = nodeMembers.begin()->second.size();
+        if (membersPerNode < 2)
+        {
+            return std::nullopt;
+        }
+        for (auto const& [id, members] : nodeMembers)
+        {
+            if (members.size() != membersPerNode)
+            {
+                return std::nullopt;
+            }
+        }
+
+        std::set<int> local_group = nodeMembers[nodeId];
+        auto const slot = std::distance(local_group.begin(), local_group.find(myRank));
+        std::set<int> cross_group;
+        for (auto const& [id, members] : nodeMembers)
+        {
+            cross_group.insert(*std::next(members.begin(), slot));
+        }
+        return std::make_pair(std::move(local_group), std::move(cross_group));
+    }
+
+    bool isHierarchicalAvailable(size_t message_size) const noexcept
+    {
+        // The communicators exist only when the group spans nodes with an equal rank count per
+        // node; equal reduce-scatter chunks additionally need the element count to split evenly.
+        return mHierLocalComm != nullptr && mHierCrossComm != nullptr && message_size % mHierLocalSize == 0;
+    }
+
     bool ifFallbackToNCCL(size_t seq_len, size_t message_size_bytes, size_t max_workspace_size, bool is_auto)
     {
         // If messageSize is less than maxWorkspaceSize, use NCCL, regardless of the fusion type.
@@ -1045,6 +1244,13 @@ private:
 
         if (ifFallbackToNCCL(seq_len, message_size_bytes, max_workspace_size, is_auto))
         {
+            // A group spanning nodes pays the full inter-node latency for every element with flat
+            // NCCL. Prefer the hierarchical strategy when its communicators could be built: only a
+            // 1/localSize shard then crosses the IB links.
+            if (isHierarchicalAvailable(message_size))
+            {
+                return AllReduceStrategyType::HIERARCHICAL;
+            }
             return AllReduceStrategyType::NCCL;
         }
 
@@ -1115,6 +1321,188 @@ private:
         return strategy;
     }
 
+    // Measured state of the NCCL <-> MIN_LATENCY choice for one message-size bucket.
+    struct AdaptiveStrategyState
+    {
+        AllReduceStrategyType preferred{AllReduceStrategyType::NCCL};
+        std::array<float, 2> avgTimeUs{}; // indexed by strategySlot
+        std::array<int, 2> numSamples{};
+        size_t numCalls{0};
+    };
+
+    static constexpr size_t kProbeCallsPerWindow = 3;
+    static constexpr float kTimeEwmaDecay = 0.7F;
+    static constexpr float kSwitchHysteresis = 0.15F;
+
+    static size_t adaptiveReprobeInterval()
+    {
+        // Number of calls between probe windows; 0 (the default) keeps the static heuristic only.
+        static size_t const interval = []
+        {
+            char const* env = std::getenv("TRTLLM_ALLREDUCE_REPROBE_INTERVAL");
+            return env != nullptr ? static_cast<size_t>(std::atoll(env)) : size_t{0};
+        }();
+        return interval;
+    }
+
+    static int strategySlot(AllReduceStrategyType strategy)
+    {
+        return strategy == AllReduceStrategyType::NCCL ? 0 : 1;
+    }
+
+    // The static message-size heuristic is computed once and cannot see changing link conditions,
+    // e.g. NVLink contention from co-located jobs that makes the custom kernels slower than NCCL.
+    // When enabled, a few calls per window run the non-preferred strategy on real traffic, both
+    // strategies keep a per-message-size-bucket EWMA of measured time, and the preference is
+    // re-selected with hysteresis so it tracks actual link conditions.
+    AllReduceStrategyType adaptStrategy(AllReduceStrategyType chosen, size_t seq_len, size_t message_size)
+    {
+        auto const interval = adaptiveReprobeInterval();
+        if (interval == 0 || mStrategy != AllReduceStrategyType::AUTO)
+        {
+            return chosen;
+        }
+        // Only the NCCL <-> MIN_LATENCY choice is re-measured, and only when both are usable for this
+        // message: the fusion type must have implementations in both and the message must fit the
+        // custom kernel workspace.
+        if (chosen != AllReduceStrategyType::NCCL && chosen != AllReduceStrategyType::MIN_LATENCY)
+        {
+            return chosen;
+        }
+        if (mOp != AllReduceFusionOp::NONE && mOp != AllReduceFusionOp::RESIDUAL_RMS_NORM)
+        {
+            return chosen;
+        }
+        auto const message_size_bytes = message_size * tensorrt_llm::common::getDTypeSize(mType);
+        auto const max_workspace_size
+            = tensorrt_llm::utils::customAllReduceUtils::getMaxRequiredWorkspaceSize(mGroup.size());
+        if (ifFallbackToNCCL(seq_len, message_size_bytes, max_workspace_size, /* is_auto */ true))
+        {
+            return chosen;
+        }
+        // Group-wide agreement needs the raw NCCL comm; the torch process-group path keeps the heuristic.
+        if (!std::holds_alternative<std::shared_ptr<ncclComm_t>>(mNcclComm))
+        {
+            return chosen;
+        }
+        // Timing events and the agreement broadcast cannot run under graph capture; a captured graph
+        // replays whatever preference was current at capture time.
+        cudaStreamCaptureStatus captureStatus{cudaStreamCaptureStatusNone};
+        TLLM_CUDA_CHECK(cudaStreamIsCapturing(at::cuda::getCurrentCUDAStream(), &captureStatus));
+        if (captureStatus != cudaStreamCaptureStatusNone)
+        {
+            return chosen;
+        }
+
+        harvestProbe();
+
+        // Timings are only comparable between equally sized messages, so state is kept per
+        // power-of-two message-size bucket.
+        size_t bucket = 0;
+        while ((message_size_bytes >> bucket) > 1)
+        {
+            ++bucket;
+        }
+        auto [it, inserted] = mAdaptiveStates.try_emplace(bucket);
+        auto& state = it->second;
+        if (inserted)
+        {
+            state.preferred = chosen;
+        }
+        ++state.numCalls;
+
+        // Every rank advances the same per-bucket call counter, so this schedule is identical on all
+        // ranks of the group and the collectives stay matched.
+        auto const phase = state.numCalls % interval;
+        auto strategy = state.preferred;
+        if (phase < kProbeCallsPerWindow)
+        {
+            strategy = state.preferred == AllReduceStrategyType::NCCL ? AllReduceStrategyType::MIN_LATENCY
+                                                                      : AllReduceStrategyType::NCCL;
+        }
+        else if (phase == kProbeCallsPerWindow)
+        {
+            reselectPreferred(state, bucket);
+            strategy = state.preferred;
+        }
+        if (!mProbePending)
+        {
+            mProbeArmed = true;
+            mProbeBucket = bucket;
+        }
+        return strategy;
+    }
+
+    void recordProbeStart(int device)
+    {
+        if (mProbeStart == nullptr)
+        {
+            TLLM_CUDA_CHECK(cudaEventCreate(&mProbeStart));
+            TLLM_CUDA_CHECK(cudaEventCreate(&mProbeStop));
+        }
+        TLLM_CUDA_CHECK(cudaEventRecord(mProbeStart, at::cuda::getCurrentCUDAStream(device)));
+    }
+
+    void recordProbeStop(int device, AllReduceStrategyType strategy)
+    {
+        TLLM_CUDA_CHECK(cudaEventRecord(mProbeStop, at::cuda::getCurrentCUDAStream(device)));
+        mProbeStrategy = strategy;
+        mProbePending = true;
+    }
+
+    void harvestProbe()
+    {
+        if (!mProbePending)
+        {
+            return;
+        }
+        // Never block on the measurement; if the timed call has not finished yet, try again next call.
+        if (auto const status = cudaEventQuery(mProbeStop); status != cudaSuccess)
+        {
+            TLLM_CHECK_WITH_INFO(status == cudaErrorNotReady, "Probe event query failed");
+            (void) cudaGetLastError();
+            return;
+        }
+        float elapsedMs = 0.F;
+        TLLM_CUDA_CHECK(cudaEventElapsedTime(&elapsedMs, mProbeStart, mProbeStop));
+        auto& state = mAdaptiveStates[mProbeBucket];
+        auto const slot = strategySlot(mProbeStrategy);
+        auto const elapsedUs = elapsedMs * 1.e3F;
+        state.avgTimeUs[slot] = state.numSamples[slot] == 0
+            ? elapsedUs
+            : kTimeEwmaDecay * state.avgTimeUs[slot] + (1.F - kTimeEwmaDecay) * elapsedUs;
+        ++state.numSamples[slot];
+        mProbePending = false;
+    }
+
+    void reselectPreferred(AdaptiveStrategyState& state, size_t bucket)
+    {
+        // The first rank of the group decides from its own timings and broadcasts the result, so all
+        // ranks keep issuing the same collective even when their local measurements disagree.
+        auto preferred = static_cast<int32_t>(state.preferred);
+        auto const cur = strategySlot(state.preferred);
+        auto const other = 1 - cur;
+        if (getRank() == *mGroup.begin() && state.numSamples[cur] > 0 && state.numSamples[other] > 0
+            && state.avgTimeUs[other] < (1.F - kSwitchHysteresis) * state.avgTimeUs[cur])
+        {
+            // Hysteresis: only switch on a clear win, so measurement jitter cannot make the choice flap.
+            preferred = static_cast<int32_t>(
+                other == 0 ? AllReduceStrategyType::NCCL : AllReduceStrategyType::MIN_LATENCY);
+        }
+        auto const& rawComm = std::get<std::shared_ptr<ncclComm_t>>(mNcclComm);
+        auto stream = at::cuda::getCurrentCUDAStream();
+        auto buffer = torch::full({1}, preferred, torch::dtype(torch::kInt32).device(torch::kCUDA));
+        NCCLCHECK_THROW(
+            ncclBroadcast(buffer.data_ptr(), buffer.mutable_data_ptr(), 1, ncclInt32, 0, *rawComm, stream));
+        auto const agreed = static_cast<AllReduceStrategyType>(buffer.item<int32_t>());
+        if (agreed != state.preferred)
+        {
+            TLLM_LOG_INFO("AllreduceOp rank %d: re-measured preference for 2^%zu-byte messages switches to %s",
+                getRank(), bucket, agreed == AllReduceStrategyType::NCCL ? "NCCL" : "MIN_LATENCY");
+        }
+        state.preferred = agreed;
+    }
+
     bool isUsingLowPrecision(size_t message_size) const noexcept
     {
         bool force_low_precision = mStrategy == AllReduceStrategyType::LOWPRECISION;
@@ -1139,6 +1527,19 @@ private:
     AllReduceFusionOp mOp;
     float mEps;
     std::variant<std::shared_ptr<ncclComm_t>, c10::intrusive_ptr<c10d::ProcessGroup>> mNcclComm;
+    // Adaptive strategy re-selection (see adaptStrategy); at most one probe measurement is in flight.
+    std::map<size_t, AdaptiveStrategyState> mAdaptiveStates;
+    cudaEvent_t mProbeStart{nullptr};
+    cudaEvent_t mProbeStop{nullptr};
+    bool mProbeArmed{false};
+    bool mProbePending{false};
+    AllReduceStrategyType mProbeStrategy{AllReduceStrategyType::NCCL};
+    size_t mProbeBucket{0};
+    // Communicators of the hierarchical strategy; null unless the group spans nodes symmetrically.
+    std::shared_ptr<ncclComm_t> mHierLocalComm;
+    std::shared_ptr<ncclComm_t> mHierCrossComm;
+    size_t mHierLocalSize{0};
+    size_t mHierLocalSlot{0};
 };
 
 } // namespace
@@ -1149,7 +1550,7 @@ std::vector<torch::Tensor> allreduce_raw(torch::Tensor const& input, torch::opti
     torch::optional<torch::Tensor> const& norm_weight, torch::optional<torch::Tensor> const& scale,
     torch::optional<torch::Tensor> const& bias, torch::optional<torch::Tensor> workspace,
     torch::List<int64_t> const& group_, int64_t const strategy_, int64_t const fusion_op_, double const eps_,
-    bool const trigger_completion_at_end_)
+    bool const trigger_completion_at_end_, torch::optional<torch::Tensor> const& error_feedback)
 {
 #if ENABLE_MULTI_DEVICE
     auto const dtype = tensorrt_llm::runtime::TorchUtils::dataType(input.scalar_type());
@@ -1163,7 +1564,7 @@ std::vector<torch::Tensor> allreduce_raw(torch::Tensor const& input, torch::opti
     }
     AllreduceOp op(group, dtype, strategy, fusion_op, eps);
     op.initialize();
-    return op.run(input, residual, norm_weight, scale, bias, trigger_completion_at_end_, workspace);
+    return op.run(input, residual, norm_weight, scale, bias, trigger_completion_at_end_, workspace, error_feedback);
 #else
     return {input};
 #endif // ENABLE_MULTI_DEVICE
@@ -1173,7 +1574,8 @@ std::vector<torch::Tensor> allreduce_pg(torch::Tensor const& input, torch::optio
     torch::optional<torch::Tensor> const& norm_weight, torch::optional<torch::Tensor> const& scale,
     torch::optional<torch::Tensor> const& bias, torch::optional<torch::Tensor> const& workspace,
     torch::List<int64_t> const& group_, int64_t rank, c10::intrusive_ptr<c10d::ProcessGroup> const& pg,
-    int64_t const strategy_, int64_t const fusion_op_, double const eps_, bool const trigger_completion_at_end_)
+    int64_t const strategy_, int64_t const fusion_op_, double const eps_, bool const trigger_completion_at_end_,
+    torch::optional<torch::Tensor> const& error_feedback)
 {
 #if ENABLE_MULTI_DEVICE
     auto const dtype = tensorrt_llm::runtime::TorchUtils::dataType(input.scalar_type());
@@ -1202,7 +1604,8 @@ std::vector<torch::Tensor> allreduce_pg(torch::Tensor const& input, torch::optio
 
     AllreduceOp op(group, pg, dtype, strategy, fusion_op, eps);
     op.initialize();
-    auto ret = op.run(input, residual, norm_weight, scale, bias, trigger_completion_at_end_, workspace);
+    auto ret
+        = op.run(input, residual, norm_weight, scale, bias, trigger_completion_at_end_, workspace, error_feedback);
     return ret;
 #else
     return {input};
@@ -1409,7 +1812,8 @@ TORCH_LIBRARY_FRAGMENT(trtllm, m)
         "int strategy,"
         "int op,"
         "float eps,"
-        "bool trigger_completion_at_end) -> Tensor[]");
+        "bool trigger_completion_at_end,"
+        "Tensor? error_feedback=None) -> Tensor[]");
     m.def(
         "allreduce_pg("
         "Tensor input,"
@@ -1424,7 +1828,8 @@ TORCH_LIBRARY_FRAGMENT(trtllm, m)
         "int strategy,"
         "int op,"
         "float eps,"
-        "bool trigger_completion_at_end) -> Tensor[]");
+        "bool trigger_completion_at_end,"
+        "Tensor? error_feedback=None) -> Tensor[]");
     m.def(
         "moe_allreduce("
         "Tensor residual,"
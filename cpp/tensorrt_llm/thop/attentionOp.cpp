@@ -695,8 +695,11 @@ void attention(torch::Tensor q, std::optional<torch::Tensor> k, std::optional<to
             && op->mKVCacheQuantMode.hasFp8KvCache();
         op->mIsGenerationMLA = head_size == op->mMLAParams.kv_lora_rank + op->mMLAParams.qk_rope_head_dim;
         op->mFP8GenerationMLA = op->mKVCacheQuantMode.hasFp8KvCache();
-        // only enable flash mla on sm90 and head_size == 576 and tokens_per_block == 64
-        op->mUseGenFlashMLA = tensorrt_llm::common::getSMVersion() == 90 && tokens_per_block == 64;
+        // Only enable flash mla on sm90 for the geometry the kernel is built for: 64-token blocks
+        // and head_size == 576 with head_size_v == 512 (kv_lora_rank 512 + qk_rope_head_dim 64).
+        // Other MLA geometries route to the generation FMHA path instead of tripping kernel asserts.
+        op->mUseGenFlashMLA = tensorrt_llm::common::getSMVersion() == 90 && tokens_per_block == 64
+            && op->mMLAParams.kv_lora_rank == 512 && op->mMLAParams.qk_rope_head_dim == 64;
 
         // The following two parameters are used to compute kvcache related parameters such as kvcache block_size. So
         // they need to be set to 1 and 512 + 64 for both context and generation. For MLA attention kernel configs,
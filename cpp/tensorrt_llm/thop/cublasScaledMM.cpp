@@ -244,15 +244,11 @@ void cublas_gemm_caller(torch::Tensor& out, torch::Tensor const& a, torch::Tenso
     cudaDataType_t scaleType = CUDA_R_32F;
     cublasWrapper->setGemmConfig(aType, bType, outType, /*computeType=*/scaleType);
 
-    auto const workspace_options = torch::TensorOptions().dtype(torch::kUInt8).device(a.device());
-    auto workspace = torch::empty(CUBLAS_WORKSPACE_SIZE, workspace_options);
-
     auto stream = at::cuda::getCurrentCUDAStream(a.get_device());
 
     auto* a_ptr = static_cast<void*>(a.data_ptr());
     auto* b_ptr = static_cast<void*>(b.data_ptr());
     auto* out_ptr = static_cast<void*>(out.data_ptr());
-    auto* ws_ptr = static_cast<void*>(workspace.data_ptr());
     void* a_scale = nullptr;
     void* b_scale = nullptr;
     if (use_scale)
@@ -269,7 +265,8 @@ void cublas_gemm_caller(torch::Tensor& out, torch::Tensor const& a, torch::Tenso
     }
 
     cublasWrapper->setStream(stream);
-    cublasWrapper->setWorkspace(ws_ptr);
+    // Workspaces come from the process-wide pool, so wrappers on the same stream share one block.
+    cublasWrapper->acquireWorkspace();
 
     // set algo according to m/n/k
     cublasLtMatmulAlgo_t algo;
@@ -16,7 +16,10 @@
 
 #include "tensorrt_llm/common/opUtils.h"
 #include "tensorrt_llm/kernels/customMoeRoutingKernels.h"
+#include "tensorrt_llm/kernels/moeLoadBalance/moeLoadBalanceKernels.h"
+#include "tensorrt_llm/runtime/moeLoadBalancer/moeLoadBalancer.h"
 #include "tensorrt_llm/runtime/torchUtils.h"
+#include "tensorrt_llm/thop/thUtils.h"
 
 namespace th = torch;
 namespace tl = tensorrt_llm;
@@ -25,8 +28,8 @@ namespace tk = tensorrt_llm::kernels;
 namespace torch_ext
 {
 template <bool DoSoftmaxBeforeTopK>
-std::tuple<at::Tensor, at::Tensor> custom_moe_routing_op(
-    th::Tensor const& router_logits, int64_t topk, c10::optional<at::ScalarType> output_dtype)
+std::tuple<at::Tensor, at::Tensor> custom_moe_routing_impl(th::Tensor const& router_logits, int64_t topk,
+    c10::optional<at::ScalarType> output_dtype, int* expert_token_count, int* enabled)
 {
     auto data_type = router_logits.scalar_type();
     auto input_size = router_logits.sizes();
@@ -53,51 +56,51 @@ std::tuple<at::Tensor, at::Tensor> custom_moe_routing_op(
         // Handle Float32 input
         if (topk_values_dtype == torch::kFloat32)
         {
-            tk::invokeCustomMoeRouting<float, float, int32_t, DoSoftmaxBeforeTopK>(
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<float, float, int32_t, DoSoftmaxBeforeTopK>(
                 reinterpret_cast<float*>(router_logits.mutable_data_ptr()),
-                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(), num_tokens,
-                num_experts, topk, stream);
+                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         else
         { // bfloat16 output
-            tk::invokeCustomMoeRouting<float, __nv_bfloat16, int32_t, DoSoftmaxBeforeTopK>(
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<float, __nv_bfloat16, int32_t, DoSoftmaxBeforeTopK>(
                 reinterpret_cast<float*>(router_logits.mutable_data_ptr()),
                 reinterpret_cast<__nv_bfloat16*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
-                num_tokens, num_experts, topk, stream);
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         break;
     case torch::kBFloat16:
         // Handle BFloat16 input
         if (topk_values_dtype == torch::kFloat32)
         {
-            tk::invokeCustomMoeRouting<__nv_bfloat16, float, int32_t, DoSoftmaxBeforeTopK>(
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<__nv_bfloat16, float, int32_t, DoSoftmaxBeforeTopK>(
                 reinterpret_cast<__nv_bfloat16*>(router_logits.mutable_data_ptr()),
-                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(), num_tokens,
-                num_experts, topk, stream);
+                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         else
         { // bfloat16 output
-            tk::invokeCustomMoeRouting<__nv_bfloat16, __nv_bfloat16, int32_t, DoSoftmaxBeforeTopK>(
-                reinterpret_cast<__nv_bfloat16*>(router_logits.mutable_data_ptr()),
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<__nv_bfloat16, __nv_bfloat16, int32_t,
+                DoSoftmaxBeforeTopK>(reinterpret_cast<__nv_bfloat16*>(router_logits.mutable_data_ptr()),
                 reinterpret_cast<__nv_bfloat16*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
-                num_tokens, num_experts, topk, stream);
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         break;
     case torch::kHalf:
         // Handle Half input
         if (topk_values_dtype == torch::kFloat32)
         {
-            tk::invokeCustomMoeRouting<half, float, int32_t, DoSoftmaxBeforeTopK>(
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<half, float, int32_t, DoSoftmaxBeforeTopK>(
                 reinterpret_cast<half*>(router_logits.mutable_data_ptr()),
-                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(), num_tokens,
-                num_experts, topk, stream);
+                reinterpret_cast<float*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         else
         { // bfloat16 output
-            tk::invokeCustomMoeRouting<half, __nv_bfloat16, int32_t, DoSoftmaxBeforeTopK>(
+            tk::invokeCustomMoeRoutingWithLoadBalanceStatistic<half, __nv_bfloat16, int32_t, DoSoftmaxBeforeTopK>(
                 reinterpret_cast<half*>(router_logits.mutable_data_ptr()),
                 reinterpret_cast<__nv_bfloat16*>(topk_values.mutable_data_ptr()), topk_indices.data_ptr<int32_t>(),
-                num_tokens, num_experts, topk, stream);
+                expert_token_count, enabled, num_tokens, num_experts, topk, stream);
         }
         break;
     default:
@@ -108,6 +111,53 @@ std::tuple<at::Tensor, at::Tensor> custom_moe_routing_op(
     return {topk_indices, topk_values};
 }
 
+template <bool DoSoftmaxBeforeTopK>
+std::tuple<at::Tensor, at::Tensor> custom_moe_routing_op(
+    th::Tensor const& router_logits, int64_t topk, c10::optional<at::ScalarType> output_dtype)
+{
+    return custom_moe_routing_impl<DoSoftmaxBeforeTopK>(
+        router_logits, topk, output_dtype, /*expert_token_count=*/nullptr, /*enabled=*/nullptr);
+}
+
+// Fused routing + load-balance statistic: accumulates per-expert token counts into the load
+// balancer's host-accessible buffers from the routing kernel epilogue instead of launching
+// a separate statistic kernel that re-reads the routing output.
+template <bool DoSoftmaxBeforeTopK>
+std::tuple<at::Tensor, at::Tensor> custom_moe_routing_statistic_op(th::Tensor const& router_logits,
+    th::Tensor const& enabled, int64_t topk, int64_t singleLayerLoadBalancerPtr, int64_t isFirstStage,
+    int64_t isLastStage, c10::optional<at::ScalarType> output_dtype)
+{
+    CHECK_INPUT(enabled, torch::kInt32);
+    TORCH_CHECK(enabled.dim() == 1, "enabled must be a 1D tensor");
+    TORCH_CHECK(enabled.size(0) == 1, "enabled must have 1 element");
+    TORCH_CHECK(isFirstStage == 0 || isFirstStage == 1, "isFirstStage must be 0 or 1");
+    TORCH_CHECK(isLastStage == 0 || isLastStage == 1, "isLastStage must be 0 or 1");
+    TORCH_CHECK(singleLayerLoadBalancerPtr != 0, "singleLayerLoadBalancerPtr must be non-null");
+
+    auto* loadBalancer
+        = reinterpret_cast<tensorrt_llm::runtime::SingleLayerMoeLoadBalancer*>(singleLayerLoadBalancerPtr);
+    auto stream = at::cuda::getCurrentCUDAStream(router_logits.get_device());
+
+    tk::MoeLoadBalanceMetaInfo metaInfo = loadBalancer->getMetaInfo();
+    TORCH_CHECK(topk == metaInfo.topK, "topk must be equal to metaInfo.topK");
+    TORCH_CHECK(router_logits.dim() == 2 && router_logits.size(1) == metaInfo.expertCount,
+        "router_logits must have shape (num_tokens, %d)", metaInfo.expertCount);
+
+    auto statisticInfo = loadBalancer->getStatisticInfo();
+
+    if (isFirstStage)
+    {
+        tk::moeStatisticShiftWindowDevice(metaInfo, *statisticInfo, enabled.data_ptr<int>(), stream);
+    }
+    auto result = custom_moe_routing_impl<DoSoftmaxBeforeTopK>(
+        router_logits, topk, output_dtype, statisticInfo->expertTokenCount, enabled.data_ptr<int>());
+    if (isLastStage)
+    {
+        tk::moeStatisticUpdateLoadFactorDevice(metaInfo, *statisticInfo, enabled.data_ptr<int>(), stream);
+    }
+    return result;
+}
+
 std::tuple<at::Tensor, at::Tensor> renorm_moe_routing_op(
     th::Tensor const& router_logits, int64_t topk, c10::optional<at::ScalarType> output_dtype)
 {
@@ -119,6 +169,22 @@ std::tuple<at::Tensor, at::Tensor> default_moe_routing_op(
 {
     return custom_moe_routing_op<true>(router_logits, topk, output_dtype);
 }
+
+std::tuple<at::Tensor, at::Tensor> renorm_moe_routing_statistic_op(th::Tensor const& router_logits,
+    th::Tensor const& enabled, int64_t topk, int64_t single_layer_load_balancer_ptr, int64_t is_first_stage,
+    int64_t is_last_stage, c10::optional<at::ScalarType> output_dtype)
+{
+    return custom_moe_routing_statistic_op<false>(
+        router_logits, enabled, topk, single_layer_load_balancer_ptr, is_first_stage, is_last_stage, output_dtype);
+}
+
+std::tuple<at::Tensor, at::Tensor> default_moe_routing_statistic_op(th::Tensor const& router_logits,
+    th::Tensor const& enabled, int64_t topk, int64_t single_layer_load_balancer_ptr, int64_t is_first_stage,
+    int64_t is_last_stage, c10::optional<at::ScalarType> output_dtype)
+{
+    return custom_moe_routing_statistic_op<true>(
+        router_logits, enabled, topk, single_layer_load_balancer_ptr, is_first_stage, is_last_stage, output_dtype);
+}
 } // namespace torch_ext
 
 TORCH_LIBRARY_FRAGMENT(trtllm, m)
@@ -144,3 +210,29 @@ TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
 {
     m.impl("default_moe_routing_op", &torch_ext::default_moe_routing_op);
 }
+
+TORCH_LIBRARY_FRAGMENT(trtllm, m)
+{
+    m.def(
+        "renorm_moe_routing_statistic_op(Tensor router_logits, Tensor enabled, SymInt topk, "
+        "int single_layer_load_balancer_ptr, int is_first_stage, int is_last_stage, ScalarType? output_dtype=None"
+        ") -> (Tensor, Tensor)");
+}
+
+TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
+{
+    m.impl("renorm_moe_routing_statistic_op", &torch_ext::renorm_moe_routing_statistic_op);
+}
+
+TORCH_LIBRARY_FRAGMENT(trtllm, m)
+{
+    m.def(
+        "default_moe_routing_statistic_op(Tensor router_logits, Tensor enabled, SymInt topk, "
+        "int single_layer_load_balancer_ptr, int is_first_stage, int is_last_stage, ScalarType? output_dtype=None"
+        ") -> (Tensor, Tensor)");
+}
+
+TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
+{
+    m.impl("default_moe_routing_statistic_op", &torch_ext::default_moe_routing_statistic_op);
+}
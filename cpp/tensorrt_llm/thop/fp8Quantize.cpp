@@ -83,6 +83,126 @@ std::tuple<at::Tensor, at::Tensor> fp8_quantize_1x128(at::Tensor const& self)
     return {valueE4M3.slice(0, 0, m), scaleFP8SF};
 }
 
+// Requantizes a per-tensor scaled FP8 matrix (e.g. fused FP8 attention output) to the 1x128
+// block-scale layout in a single pass, without materializing a BF16 copy of the activations.
+std::tuple<at::Tensor, at::Tensor> fp8_dequant_quantize_1x128(at::Tensor const& self, at::Tensor const& globalScale)
+{
+    CHECK_TH_CUDA(self);
+    CHECK_CONTIGUOUS(self);
+    CHECK_TH_CUDA(globalScale);
+
+    TORCH_CHECK(self.scalar_type() == at::ScalarType::Float8_e4m3fn, "Input matrix dtype must be FP8.");
+    TORCH_CHECK(self.dim() == 2, "input must be a matrix");
+    TORCH_CHECK(globalScale.scalar_type() == at::ScalarType::Float, "globalScale must be float32.");
+    TORCH_CHECK(globalScale.numel() == 1, "globalScale must hold a single per-tensor scale.");
+
+    auto const m = self.sizes()[0];
+    auto const n = self.sizes()[1];
+
+    TORCH_CHECK(m <= std::numeric_limits<int32_t>::max(), "M must be within int32");
+    TORCH_CHECK(n <= std::numeric_limits<int32_t>::max(), "N must be within int32");
+
+    // required by the sm90 fp8_block_scaling gemm kernel
+    TORCH_CHECK(n % 16 == 0, "self.sizes()[1] must be a multiple of 16, but got ", n);
+
+    auto mGemmRunner = tensorrt_llm::kernels::fp8_blockscale_gemm::CutlassFp8BlockScaleGemmRunner<__nv_bfloat16,
+        __nv_fp8_e4m3, __nv_bfloat16>();
+
+    auto const m_padded = (m + 4 - 1) / 4 * 4;
+
+    // row major, add padding required by the sm90 fp8_block_scaling gemm kernel
+    at::Tensor valueE4M3 = at::detail::empty_cuda(
+        {m_padded, n}, at::ScalarType::Float8_e4m3fn, self.device(), /* stride */ std::nullopt);
+    int64_t scaleSizeInBytes = mGemmRunner.getActScaleSize(m, n); // 128-byte aligned
+    int64_t elementSize = scaleSizeInBytes / torch::elementSize(FP8_BLOCK_SCALING_SF_DTYPE);
+
+    // col major
+    at::Tensor scaleFP8SF = at::detail::empty_cuda(
+        {elementSize}, FP8_BLOCK_SCALING_SF_DTYPE, self.device(), /* stride */ std::nullopt); // 1D tensor
+
+    __nv_fp8_e4m3* act_buffer = reinterpret_cast<__nv_fp8_e4m3*>(valueE4M3.data_ptr());
+    float* act_scale_buffer = reinterpret_cast<float*>(scaleFP8SF.data_ptr());
+
+    auto stream = at::cuda::getCurrentCUDAStream(self.get_device());
+
+    mGemmRunner.fp8CS1x128Dequant(act_buffer, act_scale_buffer, reinterpret_cast<__nv_fp8_e4m3 const*>(self.data_ptr()),
+        reinterpret_cast<float const*>(globalScale.data_ptr()), n, m, stream);
+
+    // Post-process the scale tensor for sm100 gemm/moe kernel
+    if (tensorrt_llm::common::isSM100Family())
+    {
+        auto const num_n_blocks = (n + 127) / 128;
+        auto const act_scal_elesize = num_n_blocks * m_padded;
+        TORCH_CHECK(act_scal_elesize <= scaleFP8SF.numel(), "Scale tensor size mismatch. Expected at least ",
+            act_scal_elesize, " elements, got ", scaleFP8SF.numel());
+
+        // scaleFP8SF = scaleFP8SF[0:num_n_blocks, 0:m] // no 4-element alignment in blackwell
+        scaleFP8SF
+            = scaleFP8SF.slice(0, 0, act_scal_elesize).view({num_n_blocks, m_padded}).slice(1, 0, m).contiguous();
+    }
+    return {valueE4M3.slice(0, 0, m), scaleFP8SF};
+}
+
+// Applies SwiGLU to a BF16 [m, 2n] gate-up matrix (linear half first, gate half second, the torch
+// chunk order) and quantizes the activated [m, n] result to the 1x128 block-scale layout in a
+// single pass, without materializing a BF16 copy of the activations. Used between the grouped MoE
+// GEMMs, where the activation tensor is expanded by top-k and is the largest transient.
+std::tuple<at::Tensor, at::Tensor> silu_and_mul_quantize_1x128(at::Tensor const& self)
+{
+    CHECK_TH_CUDA(self);
+    CHECK_CONTIGUOUS(self);
+
+    TORCH_CHECK(self.scalar_type() == at::ScalarType::BFloat16, "Input matrix dtype must be BF16.");
+    TORCH_CHECK(self.dim() == 2, "input must be a matrix");
+    TORCH_CHECK(self.sizes()[1] % 2 == 0, "self.sizes()[1] must be even, but got ", self.sizes()[1]);
+
+    auto const m = self.sizes()[0];
+    auto const n = self.sizes()[1] / 2;
+
+    TORCH_CHECK(m <= std::numeric_limits<int32_t>::max(), "M must be within int32");
+    TORCH_CHECK(n <= std::numeric_limits<int32_t>::max(), "N must be within int32");
+
+    // required by the sm90 fp8_block_scaling gemm kernel
+    TORCH_CHECK(n % 16 == 0, "self.sizes()[1] / 2 must be a multiple of 16, but got ", n);
+
+    auto mGemmRunner = tensorrt_llm::kernels::fp8_blockscale_gemm::CutlassFp8BlockScaleGemmRunner<__nv_bfloat16,
+        __nv_fp8_e4m3, __nv_bfloat16>();
+
+    auto const m_padded = (m + 4 - 1) / 4 * 4;
+
+    // row major, add padding required by the sm90 fp8_block_scaling gemm kernel
+    at::Tensor valueE4M3 = at::detail::empty_cuda(
+        {m_padded, n}, at::ScalarType::Float8_e4m3fn, self.device(), /* stride */ std::nullopt);
+    int64_t scaleSizeInBytes = mGemmRunner.getActScaleSize(m, n); // 128-byte aligned
+    int64_t elementSize = scaleSizeInBytes / torch::elementSize(FP8_BLOCK_SCALING_SF_DTYPE);
+
+    // col major
+    at::Tensor scaleFP8SF = at::detail::empty_cuda(
+        {elementSize}, FP8_BLOCK_SCALING_SF_DTYPE, self.device(), /* stride */ std::nullopt); // 1D tensor
+
+    __nv_fp8_e4m3* act_buffer = reinterpret_cast<__nv_fp8_e4m3*>(valueE4M3.data_ptr());
+    float* act_scale_buffer = reinterpret_cast<float*>(scaleFP8SF.data_ptr());
+
+    auto stream = at::cuda::getCurrentCUDAStream(self.get_device());
+
+    mGemmRunner.fp8CS1x128SwiGlu(
+        act_buffer, act_scale_buffer, reinterpret_cast<__nv_bfloat16 const*>(self.data_ptr()), n, m, stream);
+
+    // Post-process the scale tensor for sm100 gemm/moe kernel
+    if (tensorrt_llm::common::isSM100Family())
+    {
+        auto const num_n_blocks = (n + 127) / 128;
+        auto const act_scal_elesize = num_n_blocks * m_padded;
+        TORCH_CHECK(act_scal_elesize <= scaleFP8SF.numel(), "Scale tensor size mismatch. Expected at least ",
+            act_scal_elesize, " elements, got ", scaleFP8SF.numel());
+
+        // scaleFP8SF = scaleFP8SF[0:num_n_blocks, 0:m] // no 4-element alignment in blackwell
+        scaleFP8SF
+            = scaleFP8SF.slice(0, 0, act_scal_elesize).view({num_n_blocks, m_padded}).slice(1, 0, m).contiguous();
+    }
+    return {valueE4M3.slice(0, 0, m), scaleFP8SF};
+}
+
 std::tuple<at::Tensor, at::Tensor> fp8_batched_quantize_1x128_permute102(at::Tensor const& self)
 {
     CHECK_TH_CUDA(self);
@@ -138,11 +258,15 @@ std::tuple<at::Tensor, at::Tensor> fp8_batched_quantize_1x128_permute102(at::Ten
 TORCH_LIBRARY_FRAGMENT(trtllm, m)
 {
     m.def("fp8_quantize_1x128(Tensor input) -> (Tensor, Tensor)");
+    m.def("fp8_dequant_quantize_1x128(Tensor input, Tensor global_scale) -> (Tensor, Tensor)");
+    m.def("silu_and_mul_quantize_1x128(Tensor input) -> (Tensor, Tensor)");
     m.def("fp8_batched_quantize_1x128_permute102(Tensor input) -> (Tensor, Tensor)");
 }
 
 TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
 {
     m.impl("fp8_quantize_1x128", &torch_ext::fp8_quantize_1x128);
+    m.impl("fp8_dequant_quantize_1x128", &torch_ext::fp8_dequant_quantize_1x128);
+    m.impl("silu_and_mul_quantize_1x128", &torch_ext::silu_and_mul_quantize_1x128);
     m.impl("fp8_batched_quantize_1x128_permute102", &torch_ext::fp8_batched_quantize_1x128_permute102);
 }
@@ -15,11 +15,14 @@
  */
 
 #include "tensorrt_llm/kernels/fusedQKNormRopeKernel.h"
+#include "tensorrt_llm/kernels/kvCacheUtils.h"
 #include "tensorrt_llm/thop/thUtils.h"
 
 #include <ATen/cuda/CUDAContext.h>
 #include <torch/extension.h>
 
+using tensorrt_llm::kernels::KVBlockArray;
+
 namespace torch_ext
 {
 
@@ -77,6 +80,102 @@ void fused_qk_norm_rope(
         static_cast<float>(high), static_cast<float>(attention_factor), stream);
 }
 
+// Fused QK Norm and RoPE with a paged KV cache write epilogue.
+// In addition to the in-place update of qkv, the kernel appends the rotated K heads and the
+// untouched V heads directly into the paged KV cache blocks, so the attention op does not need to
+// re-read K/V from global memory to fill the cache.
+void fused_qk_norm_rope_paged_kv_write(
+    torch::Tensor& qkv,          // Combined QKV tensor [num_tokens, (num_heads_q+num_heads_k+num_heads_v)*head_dim]
+    int64_t num_heads_q,         // Number of query heads
+    int64_t num_heads_k,         // Number of key heads
+    int64_t num_heads_v,         // Number of value heads
+    int64_t head_dim,            // Dimension per head
+    double eps,                  // Epsilon for RMS normalization
+    torch::Tensor& q_weight,     // RMSNorm weights for query [head_dim]
+    torch::Tensor& k_weight,     // RMSNorm weights for key [head_dim]
+    double base,                 // Base for RoPE computation
+    bool is_neox,                // Whether RoPE is applied in Neox style
+    torch::Tensor& position_ids, // Position IDs for RoPE [num_tokens]
+    // parameters for yarn
+    double factor, // factor in rope_scaling in config.json. When it is not 1.0, it means the model is using yarn.
+    double low,    // threshold for high frequency
+    double high,   // threshold for low frequency
+    double attention_factor,                          // attention_factor applied on cos and sin
+    torch::Tensor& seq_idx_per_token,                 // Sequence index of each token [num_tokens]
+    torch::Tensor const& kv_cache_block_offsets,      // Block offsets into the KV cache pools
+    torch::Tensor const& host_kv_cache_pool_pointers, // Host KV cache pool pointers
+    torch::Tensor const& host_kv_cache_pool_mapping,  // Host layer index to pool mapping
+    int64_t layer_idx,                                // Layer index
+    int64_t tokens_per_block,                         // Number of tokens per KV cache block
+    int64_t attention_window_size,                    // Attention window size
+    int64_t sink_token_length,                        // Sink token length
+    int64_t beam_width                                // Beam width
+)
+{
+    // Input validation
+    TORCH_CHECK(qkv.dim() == 2, "QKV tensor must be 2D: [num_tokens, (num_heads_q+num_heads_k+num_heads_v)*head_dim]");
+    TORCH_CHECK(position_ids.dim() == 1, "Position IDs must be 1D: [num_tokens]");
+    TORCH_CHECK(seq_idx_per_token.dim() == 1, "Sequence indices must be 1D: [num_tokens]");
+    TORCH_CHECK(q_weight.dim() == 1, "Query weights must be 1D: [head_dim]");
+    TORCH_CHECK(k_weight.dim() == 1, "Key weights must be 1D: [head_dim]");
+    TORCH_CHECK(q_weight.size(0) == head_dim, "Query weights size must match head dimension");
+    TORCH_CHECK(k_weight.size(0) == head_dim, "Key weights size must match head dimension");
+
+    CHECK_INPUT(qkv, torch::kBFloat16);
+    CHECK_INPUT(position_ids, torch::kInt32);
+    CHECK_INPUT(seq_idx_per_token, torch::kInt32);
+    CHECK_INPUT(q_weight, torch::kBFloat16);
+    CHECK_INPUT(k_weight, torch::kBFloat16);
+
+    int64_t num_tokens = qkv.size(0);
+    TORCH_CHECK(position_ids.size(0) == num_tokens, "Number of tokens in position_ids must match QKV");
+    TORCH_CHECK(seq_idx_per_token.size(0) == num_tokens, "Number of tokens in seq_idx_per_token must match QKV");
+
+    int64_t total_heads = num_heads_q + num_heads_k + num_heads_v;
+    TORCH_CHECK(
+        qkv.size(1) == total_heads * head_dim, "QKV tensor size must match total number of heads and head dimension");
+    TORCH_CHECK(num_heads_k == num_heads_v, "KV cache write requires the same number of K and V heads");
+
+    // Build the KVBlockArray for this layer. The kernel is bf16-only, so the cache holds bf16 too.
+    auto const elem_size = static_cast<int64_t>(sizeof(__nv_bfloat16));
+    auto const size_per_token = num_heads_k * head_dim * elem_size;
+    int const num_seqs = kv_cache_block_offsets.size(1);
+    int const max_blocks_per_sequence = kv_cache_block_offsets.size(-1);
+    bool const can_use_one_more_block = beam_width > 1;
+
+    auto const pool_index = host_kv_cache_pool_mapping.index({layer_idx, 0}).item<int32_t>();
+    auto const layer_idx_in_cache_pool = host_kv_cache_pool_mapping.index({layer_idx, 1}).item<int32_t>();
+    KVBlockArray::DataType* block_offsets
+        = static_cast<KVBlockArray::DataType*>(kv_cache_block_offsets.index({pool_index, 0}).data_ptr());
+
+    auto const bytes_per_block = tokens_per_block * num_heads_k * head_dim * elem_size;
+    int32_t const kv_factor = 2; // separate K and V blocks
+    auto const intra_pool_offset = layer_idx_in_cache_pool * kv_factor * bytes_per_block;
+
+    void* primary_pool_pointer = reinterpret_cast<void*>(
+        reinterpret_cast<char*>(host_kv_cache_pool_pointers.index({pool_index, 0}).item<int64_t>())
+        + intra_pool_offset);
+    void* secondary_pool_pointer = reinterpret_cast<void*>(
+        reinterpret_cast<char*>(host_kv_cache_pool_pointers.index({pool_index, 1}).item<int64_t>())
+        + intra_pool_offset);
+
+    KVBlockArray kv_cache(num_seqs, max_blocks_per_sequence, tokens_per_block, size_per_token, attention_window_size,
+        attention_window_size, sink_token_length, can_use_one_more_block, primary_pool_pointer, secondary_pool_pointer,
+        block_offsets);
+
+    auto stream = at::cuda::getCurrentCUDAStream(qkv.get_device());
+
+    tensorrt_llm::kernels::launchFusedQKNormRope(reinterpret_cast<__nv_bfloat16*>(qkv.data_ptr()),
+        static_cast<int>(num_tokens), static_cast<int>(num_heads_q), static_cast<int>(num_heads_k),
+        static_cast<int>(num_heads_v), static_cast<int>(head_dim), static_cast<float>(eps),
+        reinterpret_cast<__nv_bfloat16*>(q_weight.data_ptr()), reinterpret_cast<__nv_bfloat16*>(k_weight.data_ptr()),
+        static_cast<float>(base),
+        !is_neox, // interleave
+        reinterpret_cast<int const*>(position_ids.data_ptr()), static_cast<float>(factor), static_cast<float>(low),
+        static_cast<float>(high), static_cast<float>(attention_factor), stream, &kv_cache,
+        reinterpret_cast<int const*>(seq_idx_per_token.data_ptr()));
+}
+
 // Register the PyTorch operators
 TORCH_LIBRARY_FRAGMENT(trtllm, m)
 {
@@ -84,12 +183,19 @@ TORCH_LIBRARY_FRAGMENT(trtllm, m)
         "fused_qk_norm_rope(Tensor(a!) qkv, int num_heads_q, int num_heads_k, int num_heads_v, int head_dim, float "
         "eps, Tensor q_weight, Tensor k_weight, float base, bool is_neox, Tensor position_ids, float factor, float "
         "low, float high, float attention_factor) -> ()");
+    m.def(
+        "fused_qk_norm_rope_paged_kv_write(Tensor(a!) qkv, int num_heads_q, int num_heads_k, int num_heads_v, int "
+        "head_dim, float eps, Tensor q_weight, Tensor k_weight, float base, bool is_neox, Tensor position_ids, float "
+        "factor, float low, float high, float attention_factor, Tensor seq_idx_per_token, Tensor "
+        "kv_cache_block_offsets, Tensor host_kv_cache_pool_pointers, Tensor host_kv_cache_pool_mapping, int layer_idx, "
+        "int tokens_per_block, int attention_window_size, int sink_token_length, int beam_width) -> ()");
 }
 
 // Register the CUDA implementation
 TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
 {
     m.impl("fused_qk_norm_rope", &fused_qk_norm_rope);
+    m.impl("fused_qk_norm_rope_paged_kv_write", &fused_qk_norm_rope_paged_kv_write);
 }
 
 } // namespace torch_ext
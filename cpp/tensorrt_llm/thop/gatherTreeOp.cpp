@@ -86,10 +86,7 @@ th::Tensor gatherTree(                                    // BS: batch_size, BM:
         bh.outputIdsUnfinish = get_ptr<int32_t>(output_ids);
         bh.parentIdsUnfinish = get_ptr<int32_t>(parent_ids);
 
-        tk::invokeInsertUnfinishedPath(bh, stream);
-        sync_check_cuda_error(stream);
-
-        tk::invokeFinalize(bh, stream);
+        tk::invokeInsertUnfinishedPathAndFinalize(bh, stream);
         sync_check_cuda_error(stream);
     }
     else if (!use_beam_hyps && beam_width > 1)
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/kernels/mambaConv1dScanKernels.h"
+#include "tensorrt_llm/thop/thUtils.h"
+
+namespace th = torch;
+namespace tk = tensorrt_llm::kernels;
+
+namespace torch_ext
+{
+
+//! Fused causal conv1d + selective-scan update for single-token Mamba2 decode. z, xbc and dt are
+//! row-major slices of the in_proj output; conv_state and ssm_state are updated in-place in the
+//! slots selected by state_indices. Returns the gated scan output [batch, nheads * head_dim].
+th::Tensor mamba_conv1d_scan_update(th::Tensor const& z, th::Tensor const& xbc, th::Tensor const& dt,
+    th::Tensor const& conv_weight, th::optional<th::Tensor> const& conv_bias, th::Tensor const& conv_state,
+    th::Tensor const& ssm_state, th::Tensor const& A, th::optional<th::Tensor> const& dt_bias,
+    th::optional<th::Tensor> const& D, th::Tensor const& state_indices, int64_t const head_dim, int64_t const ngroups,
+    bool const dt_softplus, int64_t const pad_slot_id)
+{
+    // tensors info: [shapes] x [dtype]
+    // z: [batch, nheads * head_dim] x [float16, float32, bfloat16]
+    // xbc: [batch, nheads * head_dim + 2 * ngroups * dstate] x input dtype
+    // dt: [batch, nheads] x input dtype
+    // conv_weight: [conv_dim, dconv] x input dtype
+    // conv_bias: [conv_dim] x input dtype
+    // conv_state: [num_slots, conv_dim, dconv - 1] x input dtype
+    // ssm_state: [num_slots, nheads, head_dim, dstate] x input dtype or float32
+    // A, dt_bias, D: [nheads] x [float32]
+    // state_indices: [batch] x [int32]
+
+    auto stream = at::cuda::getCurrentCUDAStream().stream();
+
+    tk::MambaConv1dScanParamsBase params;
+
+    int const batch = xbc.sizes()[0];
+    int const nheads = dt.sizes()[1];
+    int const dim = nheads * head_dim;
+    int const dstate = ssm_state.sizes()[3];
+    int const dconv = conv_weight.sizes()[1];
+
+    TORCH_CHECK(z.stride(1) == 1 && xbc.stride(1) == 1 && dt.stride(1) == 1,
+        "z, xbc and dt must be contiguous along the channel dimension");
+    TORCH_CHECK(conv_weight.is_contiguous() && conv_state.is_contiguous() && ssm_state.is_contiguous());
+    TORCH_CHECK(A.scalar_type() == torch::kFloat32, "A must be float32");
+    TORCH_CHECK(xbc.sizes()[1] == dim + 2 * ngroups * dstate, "xbc width mismatch");
+    TORCH_CHECK(conv_state.sizes()[2] == dconv - 1, "conv state depth must be dconv - 1");
+
+    auto out = torch::empty({batch, dim}, z.options());
+
+    params.batch = batch;
+    params.nheads = nheads;
+    params.head_dim = head_dim;
+    params.dstate = dstate;
+    params.ngroups = ngroups;
+    params.dconv = dconv;
+    params.pad_slot_id = pad_slot_id;
+    params.dt_softplus = dt_softplus;
+
+    params.z_row_stride = z.stride(0);
+    params.xbc_row_stride = xbc.stride(0);
+    params.dt_row_stride = dt.stride(0);
+    params.out_row_stride = out.stride(0);
+
+    params.z_ptr = z.data_ptr();
+    params.xbc_ptr = xbc.data_ptr();
+    params.dt_ptr = dt.data_ptr();
+    params.conv_weight_ptr = conv_weight.data_ptr();
+    params.conv_bias_ptr = conv_bias.has_value() ? conv_bias.value().data_ptr() : nullptr;
+    params.A_ptr = A.data_ptr();
+    params.dt_bias_ptr = dt_bias.has_value() ? dt_bias.value().data_ptr() : nullptr;
+    params.D_ptr = D.has_value() ? D.value().data_ptr() : nullptr;
+    params.conv_state_ptr = conv_state.data_ptr();
+    params.ssm_state_ptr = ssm_state.data_ptr();
+    params.out_ptr = out.data_ptr();
+    params.state_slot_mapping_ptr = static_cast<int const*>(state_indices.const_data_ptr());
+
+    c10::ScalarType dtype = xbc.scalar_type();
+    c10::ScalarType state_dtype = ssm_state.scalar_type();
+    TORCH_CHECK(state_dtype == dtype || state_dtype == torch::kFloat32,
+        "ssm_state must match the input dtype or be float32");
+    bool const float_state = state_dtype == torch::kFloat32;
+
+    switch (dtype)
+    {
+    case torch::kFloat16:
+        if (float_state)
+        {
+            tk::invokeMambaConv1dScanUpdate<half, float>(params, stream);
+        }
+        else
+        {
+            tk::invokeMambaConv1dScanUpdate<half, half>(params, stream);
+        }
+        break;
+    case torch::kFloat32: tk::invokeMambaConv1dScanUpdate<float, float>(params, stream); break;
+    case torch::kBFloat16:
+        if (float_state)
+        {
+            tk::invokeMambaConv1dScanUpdate<__nv_bfloat16, float>(params, stream);
+        }
+        else
+        {
+            tk::invokeMambaConv1dScanUpdate<__nv_bfloat16, __nv_bfloat16>(params, stream);
+        }
+        break;
+    default: throw std::invalid_argument("Invalid dtype, only supports float16, float32, and bfloat16");
+    }
+
+    sync_check_cuda_error(stream);
+
+    return out;
+}
+
+} // namespace torch_ext
+
+TORCH_LIBRARY_FRAGMENT(trtllm, m)
+{
+    m.def(
+        "mamba_conv1d_scan_update(Tensor z, Tensor xbc, Tensor dt, "
+        "Tensor conv_weight, Tensor? conv_bias, Tensor conv_state, "
+        "Tensor ssm_state, Tensor A, Tensor? dt_bias, Tensor? D, "
+        "Tensor state_indices, int head_dim, int ngroups, "
+        "bool dt_softplus, int pad_slot_id) -> Tensor");
+}
+
+TORCH_LIBRARY_IMPL(trtllm, CUDA, m)
+{
+    m.impl("mamba_conv1d_scan_update", &torch_ext::mamba_conv1d_scan_update);
+}
@@ -174,6 +174,8 @@ moePrepareOp(torch::Tensor expertsIds, c10::optional<torch::Tensor> expertsStati
     torch::Tensor preparedLocalExpertIds
         = torch::empty({maxTokenCountPerRank * epSize, topK}, expertsIds.options().dtype(torch::kInt32));
 
+    torch::Tensor sendRankCount = torch::empty({epSize}, expertsIds.options().dtype(torch::kInt32));
+    torch::Tensor recvRankCount = torch::empty({epSize}, expertsIds.options().dtype(torch::kInt32));
     torch::Tensor sendRankCountCumSum = torch::empty({epSize}, expertsIds.options().dtype(torch::kInt32));
     torch::Tensor RecvRankCountCumSum = torch::empty({epSize}, expertsIds.options().dtype(torch::kInt32));
 
@@ -209,16 +211,14 @@ moePrepareOp(torch::Tensor expertsIds, c10::optional<torch::Tensor> expertsStati
     auto stream = at::cuda::getCurrentCUDAStream();
 
     tensorrt_llm::kernels::moe_prepare::computeCountAndIndice(expertsIds.data_ptr<int>(),
-        sendRankCountCumSum.data_ptr<int>(), RecvRankCountCumSum.data_ptr<int>(), sendRankIndices.data_ptr<int>(),
+        sendRankCount.data_ptr<int>(), recvRankCount.data_ptr<int>(), sendRankIndices.data_ptr<int>(),
         backwardRecvRankIndices.data_ptr<int>(), recvRankIndices.data_ptr<int>(), localExpertStaticsPtr,
         gatheredExpertStaticsPtr, workspace, tokenCount, maxTokenCountPerRank, topK, slotCount, expertCount, epRank,
         epSize, stream);
 
-    tensorrt_llm::kernels::moe_prepare::computeCumsum(
-        sendRankCountCumSum.data_ptr<int>(), RecvRankCountCumSum.data_ptr<int>(), epRank, epSize, stream);
-
-    tensorrt_llm::kernels::moe_prepare::moveIndice(sendRankCountCumSum.data_ptr<int>(),
-        RecvRankCountCumSum.data_ptr<int>(), sendRankIndices.data_ptr<int>(), gatherSendRankIndices.data_ptr<int>(),
+    tensorrt_llm::kernels::moe_prepare::cumsumAndMoveIndice(sendRankCount.data_ptr<int>(),
+        recvRankCount.data_ptr<int>(), sendRankCountCumSum.data_ptr<int>(), RecvRankCountCumSum.data_ptr<int>(),
+        sendRankIndices.data_ptr<int>(), gatherSendRankIndices.data_ptr<int>(),
         backwardRecvRankIndices.data_ptr<int>(), gatherBackwardRecvRankIndices.data_ptr<int>(),
         recvRankIndices.data_ptr<int>(), gatherRecvRankIndices.data_ptr<int>(), epRank, epSize, maxTokenCountPerRank,
         stream);
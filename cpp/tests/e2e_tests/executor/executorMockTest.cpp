@@ -79,6 +79,7 @@ public:
     MOCK_METHOD(void, setReplicateLogitsPostProcessor, (bool), ());
     MOCK_METHOD(bool, getReplicateLogitsPostProcessor, (), (const));
     MOCK_METHOD(bool, hasGuidedDecoder, (), (const, noexcept));
+    MOCK_METHOD(bool, hasKvCacheTransceiver, (), (const, noexcept));
     MOCK_METHOD(void, resetIterationStats, (), ());
     MOCK_METHOD(
         std::shared_ptr<tensorrt_llm::batch_manager::kv_cache_manager::BaseKVCacheManager>, getKVCacheManager, (), ());
@@ -21,6 +21,7 @@
 #include "tensorrt_llm/executor/executor.h"
 #include "tensorrt_llm/runtime/bufferManager.h"
 #include "tensorrt_llm/runtime/iTensor.h"
+#include <algorithm>
 #include <gtest/gtest.h>
 #include <memory>
 using namespace tensorrt_llm::batch_manager::kv_cache_manager;
@@ -435,4 +436,49 @@ TEST_F(CacheTransBufferTest, TestForNullOptAndDefaultTransSize)
     }
 }
 
+TEST_F(CacheTransBufferTest, TestDynamicBufferRecycle)
+{
+
+    pid_t pid = fork();
+    ASSERT_NE(pid, -1) << "Fork failed";
+    if (pid == 0)
+    {
+        std::optional<size_t> maxNumTokens = std::nullopt;
+        SizeType32 maxBlocksPerSeq = 10;
+        SizeType32 tokensPerBlock = 8;
+        setenv("TRTLLM_KVCACHE_TRANSFER_BUFFER_SIZE", "0B", 1);
+        SetUpCacheTransBuffer(4, 2, 64, tokensPerBlock, CacheType::kSELF, maxNumTokens, maxBlocksPerSeq);
+        auto bufferManager = tensorrt_llm::runtime::BufferManager{std::make_shared<CudaStream>()};
+        auto targetNum = 2;
+        auto targetSize = 1024;
+        std::vector<size_t> targetSizeVec = std::vector<size_t>(targetNum, targetSize);
+        std::vector<void*> firstAddrs;
+        {
+            auto [sendBuffers, bufferCoverTargetNum, onlyUseDynamicBuffer]
+                = mTransBufferManager->getOrAllocateSendBuffers(std::nullopt, targetNum, targetSizeVec, bufferManager);
+            EXPECT_EQ(onlyUseDynamicBuffer, true);
+            for (auto const& buffer : sendBuffers)
+            {
+                firstAddrs.push_back(buffer->data());
+            }
+            // Buffers go back to the recycle pool here.
+        }
+        auto [sendBuffers2, bufferCoverTargetNum2, onlyUseDynamicBuffer2]
+            = mTransBufferManager->getOrAllocateSendBuffers(std::nullopt, targetNum, targetSizeVec, bufferManager);
+        for (auto const& buffer : sendBuffers2)
+        {
+            EXPECT_NE(std::find(firstAddrs.begin(), firstAddrs.end(), buffer->data()), firstAddrs.end());
+            EXPECT_EQ(buffer->getSize(), targetSize);
+        }
+        exit(testing::Test::HasFailure() ? 1 : 0);
+    }
+    else
+    {
+        int status;
+        ASSERT_NE(-1, waitpid(pid, &status, 0)) << "waitpid failed";
+        ASSERT_TRUE(WIFEXITED(status)) << "Child process terminated abnormally";
+        ASSERT_EQ(0, WEXITSTATUS(status)) << "Test in child process failed";
+    }
+}
+
 // TODO: pybinding
@@ -97,6 +97,20 @@ TEST_F(LRUPolicyTest, GetFreeBlockTest)
     EXPECT_FALSE(secondaryBlock->isPrimary());
 }
 
+TEST_F(LRUPolicyTest, GetFreeBlocksBulkTest)
+{
+    auto blocks = policy->getFreeBlocks(0, 3);
+    ASSERT_EQ(3, blocks.size());
+    // Bulk selection must match repeated getFreeBlock/claimBlock cycles.
+    for (auto const& [block, canOffload] : blocks)
+    {
+        EXPECT_EQ(block->getBlockId(), std::get<0>(policy->getFreeBlock(0))->getBlockId());
+        policy->claimBlock(block);
+    }
+    // Asking for more blocks than are free returns only the free ones.
+    EXPECT_EQ(NUM_SECONDARY_BLOCKS, policy->getFreeBlocks(1, NUM_SECONDARY_BLOCKS + 2).size());
+}
+
 TEST_F(LRUPolicyTest, ReleaseBlockTest)
 {
     auto origPrimaryBlock = std::get<0>(policy->getFreeBlock(0));
@@ -218,6 +232,150 @@ TEST_F(LRUPolicyTest, TimedBlockTest)
     EXPECT_EQ(std::get<0>(policy->getFreeBlock(0)), block1);
 }
 
+class LFUPolicyTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        policy = std::make_shared<LFUEvictionPolicy>();
+
+        for (KVCacheBlock::IdType blockId = 0; blockId < NUM_PRIMARY_BLOCKS; ++blockId)
+        {
+            allBlocksById.push_back(std::make_shared<KVCacheBlock>(blockId, tk::KVCacheIndex{blockId, false}));
+        }
+
+        for (KVCacheBlock::IdType blockId = 0; blockId < NUM_SECONDARY_BLOCKS; ++blockId)
+        {
+            allBlocksById.push_back(
+                std::make_shared<KVCacheBlock>(NUM_PRIMARY_BLOCKS + blockId, tk::KVCacheIndex{blockId, true}));
+        }
+        policy->initialize(allBlocksById, {NUM_PRIMARY_BLOCKS, NUM_SECONDARY_BLOCKS}, std::nullopt);
+    }
+
+    void TearDown() override {}
+
+    std::vector<BlockPtr> allBlocksById;
+    std::shared_ptr<LFUEvictionPolicy> policy;
+};
+
+TEST_F(LFUPolicyTest, FallsBackToLruWithoutReuse)
+{
+    // Blocks without tokens all have a zero reuse count, so eviction order must be pure LRU.
+    auto block1 = std::get<0>(policy->getFreeBlock(0));
+    policy->claimBlock(block1);
+
+    auto block2 = std::get<0>(policy->getFreeBlock(0));
+    policy->claimBlock(block2);
+
+    policy->releaseBlock(block2);
+    policy->releaseBlock(block1);
+
+    for (int i = 0; i < NUM_PRIMARY_BLOCKS - 2; i++)
+    {
+        policy->claimBlock(std::get<0>(policy->getFreeBlock(0)));
+    }
+    ASSERT_EQ(std::get<0>(policy->getFreeBlock(0))->getBlockId(), block2->getBlockId());
+
+    policy->claimBlock(std::get<0>(policy->getFreeBlock(0)));
+
+    ASSERT_EQ(std::get<0>(policy->getFreeBlock(0))->getBlockId(), block1->getBlockId());
+}
+
+TEST_F(LFUPolicyTest, EvictsLeastFrequentlyReusedFirst)
+{
+    auto frequentBlock = allBlocksById[0];
+    auto rareBlock = allBlocksById[1];
+    frequentBlock->setBlockKey(BlockKey(VecTokens{0, 1}), true);
+    rareBlock->setBlockKey(BlockKey(VecTokens{2, 3}), true);
+
+    // Each claim of a block that holds tokens counts as a reuse of its content.
+    for (int i = 0; i < 3; i++)
+    {
+        policy->claimBlock(frequentBlock);
+        policy->releaseBlock(frequentBlock);
+    }
+    policy->claimBlock(rareBlock);
+    policy->releaseBlock(rareBlock);
+
+    // The untouched blocks have a zero count and leave in LRU order; the reused blocks leave
+    // last, least-frequently-reused first.
+    auto blocks = policy->getFreeBlocks(0, NUM_PRIMARY_BLOCKS);
+    ASSERT_EQ(NUM_PRIMARY_BLOCKS, blocks.size());
+    EXPECT_EQ(std::get<0>(blocks[NUM_PRIMARY_BLOCKS - 2])->getBlockId(), rareBlock->getBlockId());
+    EXPECT_EQ(std::get<0>(blocks[NUM_PRIMARY_BLOCKS - 1])->getBlockId(), frequentBlock->getBlockId());
+
+    // Bulk selection must match repeated getFreeBlock/claimBlock cycles.
+    for (auto const& [block, canOffload] : blocks)
+    {
+        EXPECT_EQ(block->getBlockId(), std::get<0>(policy->getFreeBlock(0))->getBlockId());
+        policy->claimBlock(block);
+    }
+}
+
+class AdaptivePolicyTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        policy = std::make_shared<AdaptiveEvictionPolicy>();
+
+        for (KVCacheBlock::IdType blockId = 0; blockId < NUM_PRIMARY_BLOCKS; ++blockId)
+        {
+            allBlocksById.push_back(std::make_shared<KVCacheBlock>(blockId, tk::KVCacheIndex{blockId, false}));
+        }
+
+        for (KVCacheBlock::IdType blockId = 0; blockId < NUM_SECONDARY_BLOCKS; ++blockId)
+        {
+            allBlocksById.push_back(
+                std::make_shared<KVCacheBlock>(NUM_PRIMARY_BLOCKS + blockId, tk::KVCacheIndex{blockId, true}));
+        }
+        policy->initialize(allBlocksById, {NUM_PRIMARY_BLOCKS, NUM_SECONDARY_BLOCKS}, std::nullopt);
+    }
+
+    void TearDown() override {}
+
+    std::vector<BlockPtr> allBlocksById;
+    std::shared_ptr<AdaptiveEvictionPolicy> policy;
+};
+
+TEST_F(AdaptivePolicyTest, KeepsBothPoliciesInLockstep)
+{
+    EXPECT_FALSE(policy->isLfuLive());
+    EXPECT_EQ(NUM_PRIMARY_BLOCKS, policy->getNumFreeBlocks(0));
+    EXPECT_EQ(NUM_SECONDARY_BLOCKS, policy->getNumFreeBlocks(1));
+
+    // Run a few eviction/reuse cycles with tokened blocks; both policies observe every claim and
+    // release, so the bookkeeping must stay consistent without any flush.
+    for (int iteration = 0; iteration < 3; iteration++)
+    {
+        std::vector<BlockPtr> claimed;
+        for (int i = 0; i < NUM_PRIMARY_BLOCKS; i++)
+        {
+            auto block = std::get<0>(policy->getFreeBlock(0));
+            policy->claimBlock(block);
+            block->setBlockKey(BlockKey(VecTokens{iteration, i}), true);
+            claimed.push_back(block);
+        }
+        EXPECT_EQ(0, policy->getNumFreeBlocks(0));
+        for (auto const& block : claimed)
+        {
+            policy->releaseBlock(block);
+        }
+        EXPECT_EQ(NUM_PRIMARY_BLOCKS, policy->getNumFreeBlocks(0));
+        policy->refresh();
+    }
+    EXPECT_TRUE(policy->verifyQueueIntegrity());
+
+    // Retention priorities and expiration still work through the meta-policy.
+    auto block = std::get<0>(policy->getFreeBlock(0));
+    policy->claimBlock(block, 80, std::nullopt);
+    EXPECT_EQ(block->getPriority(), 80);
+    policy->releaseBlock(block);
+    policy->claimBlock(block);
+    EXPECT_EQ(NUM_PRIMARY_BLOCKS - 1, policy->getNumFreeBlocks(0));
+    EXPECT_TRUE(policy->verifyQueueIntegrity());
+}
+
 TEST_F(KvCacheRetentionConfigTest, InitializeTest)
 {
     // Invalid EOS
@@ -472,6 +472,202 @@ TEST_F(KVCacheManagerTest, BlockManagerTestPartialCopyFP8)
 }
 #endif
 
+TEST_F(KVCacheManagerTest, BlockManagerSecondaryPoolCompaction)
+{
+    auto constexpr numLayers = 2;
+    auto constexpr numKvHeads = 2;
+    auto constexpr sizePerHead = 64;
+    auto constexpr tokensPerBlock = 8;
+    auto constexpr blocksInPrimaryPool = 8;
+    auto constexpr blocksInSecondaryPool = 8;
+    auto constexpr maxNumSequences = 8;
+    auto constexpr maxAttentionWindow = 4096;
+    auto constexpr beamWidth = 1;
+    auto constexpr beamIdx = 0;
+    auto constexpr onboardBlocks = true;
+    SizeType32 constexpr maxNewTokens{0};
+    auto const stream = std::make_shared<tr::CudaStream>();
+    tr::SamplingConfig const samplingConfig{beamWidth};
+    bool constexpr isStreaming{false};
+
+    auto const blocksPerWindow = BlocksPerWindow{{maxAttentionWindow, {blocksInPrimaryPool, blocksInSecondaryPool}}};
+
+    BlockManager blockManager(std::vector<BlockManager::SizeType32>(numLayers, numKvHeads), sizePerHead, tokensPerBlock,
+        blocksPerWindow, maxNumSequences, stream, maxAttentionWindow, beamWidth,
+        std::vector<BlockManager::SizeType32>{maxAttentionWindow}, std::nullopt, nvinfer1::DataType::kINT32, 0,
+        onboardBlocks);
+    blockManager.allocatePools(false);
+
+    // An unfragmented manager reports one free run spanning each pool.
+    {
+        auto const stats = blockManager.calculateFragmentationStats().at(maxAttentionWindow);
+        EXPECT_EQ(stats.freeBlocksPrimary, blocksInPrimaryPool);
+        EXPECT_EQ(stats.largestFreeRunPrimary, blocksInPrimaryPool);
+        EXPECT_EQ(stats.freeBlocksSecondary, blocksInSecondaryPool);
+        EXPECT_EQ(stats.largestFreeRunSecondary, blocksInSecondaryPool);
+    }
+
+    // Two full context blocks.
+    auto inputTokens = std::make_shared<VecTokens>(VecTokens{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15});
+    auto const inputLength = static_cast<SizeType32>(inputTokens->size());
+    LlmRequest::RequestIdType requestId{0};
+    auto llmRequest0 = std::make_shared<LlmRequest>(requestId, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    GenerationRequest seq0{requestId, inputLength, beamWidth, blockManager.getWindowSizesMetadata()};
+    auto const promptLen0 = llmRequest0->getNumTokens(beamIdx);
+    auto const numContextBlocks0 = tc::ceilDiv(promptLen0, blockManager.getTokensPerBlock());
+    blockManager.holdSequence(seq0.getRequestId());
+    blockManager.addSequence(seq0, promptLen0, numContextBlocks0, *llmRequest0, maxAttentionWindow);
+    auto const cacheBlockIds = seq0.getCacheBlockIds(maxAttentionWindow).at(beamIdx);
+    ASSERT_EQ(cacheBlockIds.size(), 2);
+
+    // Offload both blocks, then onboard the first again so its former secondary slot becomes a
+    // hole below the remaining offloaded block.
+    auto block0 = blockManager.getBlockById(cacheBlockIds[0], maxAttentionWindow);
+    auto block1 = blockManager.getBlockById(cacheBlockIds[1], maxAttentionWindow);
+    blockManager.offloadBlock(block0, maxAttentionWindow);
+    blockManager.offloadBlock(block1, maxAttentionWindow);
+    EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+    EXPECT_FALSE(block1->isPrimary());
+    auto const block1SlotBefore = block1->getMemoryPoolBlockIndex();
+    blockManager.onboardBlock(seq0, block0, maxAttentionWindow);
+    EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+    EXPECT_TRUE(block0->isPrimary());
+    EXPECT_GT(block1SlotBefore, 0);
+
+    {
+        auto const stats = blockManager.calculateFragmentationStats().at(maxAttentionWindow);
+        EXPECT_EQ(stats.freeBlocksPrimary, blocksInPrimaryPool - 1);
+        EXPECT_EQ(stats.freeBlocksSecondary, blocksInSecondaryPool - 1);
+        // block1 sits at slot 1, splitting the secondary pool into runs of 1 and 6.
+        EXPECT_EQ(stats.largestFreeRunSecondary, blocksInSecondaryPool - 2);
+        ASSERT_EQ(stats.freeRunHistogramSecondary.size(), 3);
+        EXPECT_EQ(stats.freeRunHistogramSecondary[0], 1);
+        EXPECT_EQ(stats.freeRunHistogramSecondary[1], 0);
+        EXPECT_EQ(stats.freeRunHistogramSecondary[2], 1);
+    }
+
+    // Fill the offloaded block with a recognizable pattern so the relocation can be verified.
+    auto const secondaryPoolPtr = blockManager.getSecondaryPool(0);
+    auto const blockNumElts = 2 * numLayers * blockManager.getBlockSize(0);
+    {
+        auto blockPtr{tr::ITensor::slice(secondaryPoolPtr, block1SlotBefore, 1)};
+        auto* rawBlockPtr = reinterpret_cast<std::uint32_t*>(blockPtr->data());
+        for (SizeType32 i = 0; i < blockNumElts; ++i)
+        {
+            rawBlockPtr[i] = static_cast<std::uint32_t>(i) * 2654435761U;
+        }
+    }
+
+    // Store the blocks for reuse; block1 stays offloaded with no references.
+    blockManager.releaseBlocks(seq0, llmRequest0);
+    blockManager.releaseSequence(seq0.getRequestId());
+
+    // Compaction moves the offloaded block into the lowest hole and keeps its contents intact.
+    EXPECT_EQ(blockManager.compactSecondaryPools(blocksInSecondaryPool), 1);
+    EXPECT_FALSE(block1->isPrimary());
+    EXPECT_EQ(block1->getMemoryPoolBlockIndex(), 0);
+    {
+        auto blockPtr{tr::ITensor::slice(secondaryPoolPtr, block1->getMemoryPoolBlockIndex(), 1)};
+        auto const* rawBlockPtr = reinterpret_cast<std::uint32_t const*>(blockPtr->data());
+        int numBad = 0;
+        for (SizeType32 i = 0; i < blockNumElts && numBad < 10; ++i)
+        {
+            if (rawBlockPtr[i] != static_cast<std::uint32_t>(i) * 2654435761U)
+            {
+                ++numBad;
+            }
+        }
+        EXPECT_EQ(numBad, 0);
+    }
+    EXPECT_TRUE(blockManager.verifyQueueIntegrity(maxAttentionWindow));
+    EXPECT_EQ(blockManager.compactSecondaryPools(blocksInSecondaryPool), 0);
+
+    // The relocated block is still reachable through the reuse tree.
+    requestId = 1;
+    auto llmRequest1 = std::make_shared<LlmRequest>(requestId, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    GenerationRequest seq1{requestId, inputLength, beamWidth, blockManager.getWindowSizesMetadata()};
+    auto const promptLen1 = llmRequest1->getNumTokens(beamIdx);
+    auto const numContextBlocks1 = tc::ceilDiv(promptLen1, blockManager.getTokensPerBlock());
+    blockManager.holdSequence(seq1.getRequestId());
+    blockManager.addSequence(seq1, promptLen1, numContextBlocks1, *llmRequest1, maxAttentionWindow);
+    EXPECT_EQ(llmRequest1->getContextCurrentPosition(), inputLength - 1);
+    blockManager.releaseBlocks(seq1, llmRequest1);
+    blockManager.releaseSequence(seq1.getRequestId());
+}
+
+TEST_F(KVCacheManagerTest, BlockManagerCapacityDrainRestore)
+{
+    auto constexpr numLayers = 2;
+    auto constexpr numKvHeads = 2;
+    auto constexpr sizePerHead = 64;
+    auto constexpr tokensPerBlock = 8;
+    auto constexpr blocksInPrimaryPool = 8;
+    auto constexpr blocksInSecondaryPool = 0;
+    auto constexpr maxNumSequences = 8;
+    auto constexpr maxAttentionWindow = 4096;
+    auto constexpr beamWidth = 1;
+    auto constexpr beamIdx = 0;
+    auto constexpr onboardBlocks = true;
+    SizeType32 constexpr maxNewTokens{0};
+    auto const stream = std::make_shared<tr::CudaStream>();
+    tr::SamplingConfig const samplingConfig{beamWidth};
+    bool constexpr isStreaming{false};
+
+    auto const blocksPerWindow = BlocksPerWindow{{maxAttentionWindow, {blocksInPrimaryPool, blocksInSecondaryPool}}};
+
+    BlockManager blockManager(std::vector<BlockManager::SizeType32>(numLayers, numKvHeads), sizePerHead, tokensPerBlock,
+        blocksPerWindow, maxNumSequences, stream, maxAttentionWindow, beamWidth,
+        std::vector<BlockManager::SizeType32>{maxAttentionWindow}, std::nullopt, nvinfer1::DataType::kHALF, 0,
+        onboardBlocks);
+    blockManager.allocatePools(false);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool);
+
+    // Two full context blocks.
+    auto inputTokens = std::make_shared<VecTokens>(VecTokens{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15});
+    auto const inputLength = static_cast<SizeType32>(inputTokens->size());
+    LlmRequest::RequestIdType requestId{0};
+    auto llmRequest0 = std::make_shared<LlmRequest>(requestId, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    GenerationRequest seq0{requestId, inputLength, beamWidth, blockManager.getWindowSizesMetadata()};
+    auto const promptLen0 = llmRequest0->getNumTokens(beamIdx);
+    auto const numContextBlocks0 = tc::ceilDiv(promptLen0, blockManager.getTokensPerBlock());
+    blockManager.holdSequence(seq0.getRequestId());
+    blockManager.addSequence(seq0, promptLen0, numContextBlocks0, *llmRequest0, maxAttentionWindow);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - 2);
+
+    // Shrinking takes only free blocks; the sequence keeps its two.
+    EXPECT_EQ(blockManager.drainFreeBlocks(3), 3);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), 3);
+    EXPECT_EQ(blockManager.drainFreeBlocks(100), 3);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), 0);
+    EXPECT_EQ(seq0.getCacheBlockIds(maxAttentionWindow).at(beamIdx).size(), 2);
+
+    // Growing returns drained blocks, but never more than were drained.
+    EXPECT_EQ(blockManager.restoreDrainedBlocks(2), 2);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), 2);
+    EXPECT_EQ(blockManager.restoreDrainedBlocks(100), 4);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), 6);
+    EXPECT_TRUE(blockManager.verifyQueueIntegrity(maxAttentionWindow));
+
+    // Store the blocks for reuse and cycle the whole pool through a drain. The drain must evict
+    // the stored content, so an identical request afterwards gets no reuse.
+    blockManager.releaseBlocks(seq0, llmRequest0);
+    blockManager.releaseSequence(seq0.getRequestId());
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool);
+    EXPECT_EQ(blockManager.drainFreeBlocks(blocksInPrimaryPool), blocksInPrimaryPool);
+    EXPECT_EQ(blockManager.restoreDrainedBlocks(blocksInPrimaryPool), blocksInPrimaryPool);
+
+    requestId = 1;
+    auto llmRequest1 = std::make_shared<LlmRequest>(requestId, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    GenerationRequest seq1{requestId, inputLength, beamWidth, blockManager.getWindowSizesMetadata()};
+    auto const promptLen1 = llmRequest1->getNumTokens(beamIdx);
+    auto const numContextBlocks1 = tc::ceilDiv(promptLen1, blockManager.getTokensPerBlock());
+    blockManager.holdSequence(seq1.getRequestId());
+    blockManager.addSequence(seq1, promptLen1, numContextBlocks1, *llmRequest1, maxAttentionWindow);
+    EXPECT_EQ(llmRequest1->getContextCurrentPosition(), 0);
+    blockManager.releaseBlocks(seq1, llmRequest1);
+    blockManager.releaseSequence(seq1.getRequestId());
+}
+
 TEST_F(KVCacheManagerTest, BlockManagerTestWindowSizeToShare)
 {
     auto constexpr numPrimaryBlocks = 16384;
@@ -3343,6 +3539,97 @@ TEST_F(KVCacheManagerTest, KVCacheManagerMaxAttentionWindowSmallerThanBlockSizeT
     EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool);
 }
 
+TEST_F(KVCacheManagerTest, KVCacheManagerAttentionSinkRotationTest)
+{
+    auto constexpr numLayers = 2;
+    auto constexpr numHeads = 2;
+    auto constexpr sizePerHead = 64;
+    auto constexpr tokensPerBlock = 4;
+    auto constexpr maxNumSequences = 8;
+    auto constexpr maxBeamWidth = 1;
+    // One block of attention sinks stays pinned while the window rotates over the tail.
+    auto constexpr sinkTokenLength = 4;
+    auto const stream = std::make_shared<tr::CudaStream>();
+    auto constexpr maxSequenceLength = 128;
+
+    auto constexpr maxAttentionWindow = 12;
+
+    auto constexpr blocksInPrimaryPool = 16;
+    auto constexpr blocksInSecondaryPool = 0;
+
+    auto constexpr enableBlockReuse = false;
+    auto constexpr onboardBlocks = true;
+
+    auto const blocksPerWindow = BlocksPerWindow{{maxAttentionWindow, {blocksInPrimaryPool, blocksInSecondaryPool}}};
+    KVCacheManager kvCacheManager(numLayers, numHeads, sizePerHead, tokensPerBlock, blocksPerWindow, maxNumSequences,
+        maxBeamWidth, std::vector<BlockManager::SizeType32>{maxAttentionWindow}, std::nullopt,
+        nvinfer1::DataType::kHALF, sinkTokenLength, stream, maxSequenceLength, enableBlockReuse, onboardBlocks);
+    kvCacheManager.allocatePools(false);
+
+    auto const& blockManager = kvCacheManager.getBlockManager();
+    auto const onlyWindowSize = theOnlyWindowSize(kvCacheManager);
+
+    SizeType32 constexpr maxNewTokens = 40;
+    TokenIdType constexpr firstToken = 1000;
+    auto constexpr beamWidth = maxBeamWidth;
+    tr::SamplingConfig const samplingConfig{beamWidth};
+    bool constexpr isStreaming{false};
+    auto constexpr beamIdx = 0;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // fill the attention window exactly: 1 sink block + 2 tail blocks
+    SizeType32 requestId = 0;
+    int inputLength = 12;
+    auto inputTokens = std::make_shared<VecTokens>(inputLength);
+    std::iota(inputTokens->begin(), inputTokens->end(), firstToken);
+    auto llmRequest = std::make_shared<LlmRequest>(requestId, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+
+    kvCacheManager.addSequence(requestId, inputLength, beamWidth, llmRequest);
+    GenerationRequest const& seq0 = kvCacheManager.getSequence(requestId);
+    EXPECT_EQ(seq0.getNumSinkBlocks(), 1);
+    EXPECT_THAT(seq0.getCacheBlockIds(onlyWindowSize).at(beamIdx), ::testing::ElementsAreArray({0, 1, 2}));
+
+    // add tokens up to the detach threshold; a tail block is allocated at the block boundary
+    for (auto token = 1012; token <= 1014; ++token)
+    {
+        llmRequest->addNewToken(token, beamIdx);
+        kvCacheManager.addToken(requestId);
+    }
+    EXPECT_EQ(seq0.getNumFrontBlocksRemoved(onlyWindowSize), 0);
+    EXPECT_THAT(seq0.getCacheBlockIds(onlyWindowSize).at(beamIdx), ::testing::ElementsAreArray({0, 1, 2, 3}));
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - 4);
+
+    // the next token pushes the oldest NON-sink block out of the window; the sink block stays pinned
+    llmRequest->addNewToken(1015, beamIdx);
+    kvCacheManager.addToken(requestId);
+    EXPECT_EQ(seq0.getNumFrontBlocksRemoved(onlyWindowSize), 1);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool - 3);
+
+    // releasing the sequence must return every remaining block, including the pinned sink block,
+    // without touching the already-detached one again
+    EXPECT_NO_THROW((void) kvCacheManager.removeSequence(requestId, llmRequest));
+    EXPECT_EQ(blockManager.getNumAllocatedBlocks(), 0);
+    EXPECT_EQ(blockManager.getNumFreeBlocks(), blocksInPrimaryPool);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // a per-request sink count may only opt into the engine-wide value, since the attention
+    // kernels read one batch-uniform sink token length
+    auto goodRequest = std::make_shared<LlmRequest>(
+        /*requestId=*/1, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    goodRequest->setKvCacheRetentionConfig(tle::KvCacheRetentionConfig(
+        {}, tle::KvCacheRetentionConfig::kDefaultRetentionPriority, std::nullopt,
+        tle::KvCacheTransferMode::DRAM, "", sinkTokenLength));
+    EXPECT_NO_THROW(kvCacheManager.addSequence(/*requestId=*/1, inputLength, beamWidth, goodRequest));
+    EXPECT_NO_THROW((void) kvCacheManager.removeSequence(/*requestId=*/1, goodRequest));
+
+    auto badRequest = std::make_shared<LlmRequest>(
+        /*requestId=*/2, maxNewTokens, inputTokens, samplingConfig, isStreaming);
+    badRequest->setKvCacheRetentionConfig(tle::KvCacheRetentionConfig(
+        {}, tle::KvCacheRetentionConfig::kDefaultRetentionPriority, std::nullopt,
+        tle::KvCacheTransferMode::DRAM, "", 2 * sinkTokenLength));
+    EXPECT_THROW(kvCacheManager.addSequence(/*requestId=*/2, inputLength, beamWidth, badRequest), std::exception);
+}
+
 TEST_F(KVCacheManagerTest, KVCacheManagerEventStream)
 {
     auto constexpr numLayers = 12;
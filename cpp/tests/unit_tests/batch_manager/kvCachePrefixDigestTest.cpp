@@ -0,0 +1,95 @@
+#include "tensorrt_llm/batch_manager/kvCachePrefixDigest.h"
+
+#include <gtest/gtest.h>
+
+using namespace tensorrt_llm::batch_manager::kv_cache_manager;
+namespace tle = tensorrt_llm::executor;
+
+namespace
+{
+
+// Router-side membership query, implemented from the probe schedule documented on
+// executor::KVCachePrefixDigest. Kept independent of the digest internals on purpose.
+uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+bool mayContain(tle::KVCachePrefixDigest const& digest, std::size_t hash)
+{
+    uint64_t const h1 = splitmix64(hash);
+    uint64_t const h2 = splitmix64(hash ^ tle::KVCachePrefixDigest::kProbeSeed);
+    for (int32_t i = 0; i < digest.numHashes; ++i)
+    {
+        auto const bit = (h1 + static_cast<uint64_t>(i) * h2) % static_cast<uint64_t>(digest.numBits);
+        if ((digest.bits[bit / 8] & (1U << (bit % 8))) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(KVCachePrefixDigestTest, InsertedHashesAreMembers)
+{
+    KVCachePrefixDigest digest;
+    for (std::size_t hash = 1; hash <= 1000; ++hash)
+    {
+        digest.insert(splitmix64(hash));
+    }
+    auto snapshot = digest.snapshot();
+    EXPECT_EQ(snapshot.numBits, KVCachePrefixDigest::kDefaultNumBits);
+    EXPECT_EQ(snapshot.numHashes, KVCachePrefixDigest::kDefaultNumHashes);
+    EXPECT_EQ(snapshot.bits.size(), static_cast<std::size_t>(KVCachePrefixDigest::kDefaultNumBits) / 8);
+    for (std::size_t hash = 1; hash <= 1000; ++hash)
+    {
+        EXPECT_TRUE(mayContain(snapshot, splitmix64(hash)));
+    }
+}
+
+TEST(KVCachePrefixDigestTest, FalsePositiveRateIsSmall)
+{
+    KVCachePrefixDigest digest;
+    for (std::size_t hash = 1; hash <= 1000; ++hash)
+    {
+        digest.insert(splitmix64(hash));
+    }
+    auto snapshot = digest.snapshot();
+    int falsePositives = 0;
+    constexpr int kProbes = 10000;
+    for (std::size_t hash = 1; hash <= kProbes; ++hash)
+    {
+        falsePositives += mayContain(snapshot, splitmix64(hash + 1000000));
+    }
+    // 1000 keys in 64Ki bits with 4 probes should sit well below a 1% false positive rate.
+    EXPECT_LT(falsePositives, kProbes / 100);
+}
+
+TEST(KVCachePrefixDigestTest, RemoveClearsMembership)
+{
+    KVCachePrefixDigest digest;
+    auto const keep = splitmix64(1);
+    auto const drop = splitmix64(2);
+    digest.insert(keep);
+    digest.insert(drop);
+    digest.remove(drop);
+    auto snapshot = digest.snapshot();
+    EXPECT_TRUE(mayContain(snapshot, keep));
+    EXPECT_FALSE(mayContain(snapshot, drop));
+}
+
+TEST(KVCachePrefixDigestTest, VersionAdvancesOnMutation)
+{
+    KVCachePrefixDigest digest;
+    auto const v0 = digest.snapshot().version;
+    digest.insert(splitmix64(42));
+    auto const v1 = digest.snapshot().version;
+    EXPECT_GT(v1, v0);
+    digest.remove(splitmix64(42));
+    EXPECT_GT(digest.snapshot().version, v1);
+}
@@ -404,6 +404,26 @@ TEST_F(LlmRequestTest, testAllocateLogitsBuffer)
     EXPECT_EQ(targetModelAcceptedTokenLogitShape.d[2], vocabSizePadded);
 }
 
+TEST_F(LlmRequestTest, testHostMemoryAccounting)
+{
+    auto inputTokens = std::make_shared<VecTokens>(VecTokens{1, 2, 3, 4, 5});
+    SizeType32 maxNewTokens(60);
+    tb::LlmRequest llmReq(78, maxNewTokens, inputTokens, tr::SamplingConfig(1), false);
+
+    SizeType32 vocabSizePadded = 32000;
+    nvinfer1::DataType logitsDataType = nvinfer1::DataType::kFLOAT;
+
+    // Host buffers allocated for the request are charged against its memory budget.
+    EXPECT_EQ(llmReq.getHostMemoryBytes(), 0);
+    llmReq.allocContextLogitsHost(vocabSizePadded, logitsDataType);
+    auto const contextBytes = static_cast<size_t>(llmReq.mPromptLen) * vocabSizePadded * sizeof(float);
+    EXPECT_EQ(llmReq.getHostMemoryBytes(), contextBytes);
+
+    llmReq.allocGenerationLogitsHost(vocabSizePadded, logitsDataType);
+    auto const generationBytes = static_cast<size_t>(maxNewTokens) * vocabSizePadded * sizeof(float);
+    EXPECT_EQ(llmReq.getHostMemoryBytes(), contextBytes + generationBytes);
+}
+
 TEST_F(LlmRequestTest, testLastTokensSetIndependence)
 {
     tb::LlmRequest::RequestIdType requestId{77};
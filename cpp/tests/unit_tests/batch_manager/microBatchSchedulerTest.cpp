@@ -67,6 +67,30 @@ protected:
             /*returnContextLogits=*/false, /*returnGenerationLogits=*/false, draftTokens, draftLogits);
     }
 
+    static std::shared_ptr<LlmRequest> createEncoderRequest(
+        int32_t encoderInputLen, int32_t maxNewTokens, std::optional<uint64_t> optionalReqId)
+    {
+        tensorrt_llm::runtime::SamplingConfig samplingConfig;
+        samplingConfig.beamWidth = 1;
+        uint64_t reqId = optionalReqId.value_or((rand() % INT64_MAX) + 1);
+        return std::make_shared<LlmRequest>(reqId, maxNewTokens, std::vector<int32_t>(1, 1), samplingConfig,
+            /*isStreaming=*/false,
+            /*endId=*/std::nullopt,
+            /*padId=*/std::nullopt, /*embeddingBias=*/std::nullopt,
+            /*badWordsList=*/std::nullopt, /*stopWordsList=*/std::nullopt, /*positionIds=*/std::nullopt,
+            /*promptEmbeddingTable=*/std::nullopt, /*promptVocabSize=*/std::nullopt,
+            /*multimodalHashes=*/std::nullopt, /*multimodalPos=*/std::nullopt, /*multimodalLength=*/std::nullopt,
+            /*multimodalEmbedding=*/std::nullopt,
+            /*mropeRotaryCosSin=*/std::nullopt, /*mropePositionDeltas*/ std::nullopt,
+            /*loraTaskId=*/std::nullopt, /*loraWeights=*/std::nullopt,
+            /*loraConfig=*/std::nullopt, /*lookaheadConfig=*/std::nullopt, /*kvCacheRetentionConfig=*/std::nullopt,
+            /*returnLogProbs=*/false,
+            /*returnContextLogits=*/false, /*returnGenerationLogits=*/false, /*draftTokens=*/std::nullopt,
+            /*draftLogits=*/std::nullopt, /*excludeInputFromOutput=*/false, /*logitsPostProcessor=*/std::nullopt,
+            /*applyLogitsPostProcessorBatched=*/false,
+            /*encoderInputTokens=*/LlmRequest::VecTokens(encoderInputLen, 1));
+    }
+
     RequestTable forward(
         RequestVector& activeRequests, SizeType32 maxBatchSizeRuntime, std::optional<SizeType32> maxNumTokensRuntime)
     {
@@ -791,6 +815,43 @@ TEST_F(MicroBatchSchedulerTest, DraftTokensGreaterThanChunkSize)
     }
 }
 
+TEST_F(MicroBatchSchedulerTest, EncoderPackingMaxNumTokens)
+{
+    // Packed encoder batching: a long request that does not fit the token budget must not
+    // block shorter requests behind it, and the skipped request is scheduled first once
+    // the batch drains.
+    constexpr SizeType32 maxBatchSize = 8;
+    constexpr SizeType32 maxNumTokens = 100;
+
+    mMicroBatchScheduler = std::make_shared<MicroBatchScheduler>(
+        std::nullopt, mMaxInputLen, LlmRequestState::kENCODER_INIT, LlmRequestState::kCONTEXT_INIT);
+
+    RequestVector activeRequests;
+    activeRequests.push_back(createEncoderRequest(60, 1, 0));
+    activeRequests.push_back(createEncoderRequest(50, 1, 1));
+    activeRequests.push_back(createEncoderRequest(30, 1, 2));
+
+    auto [contextRequests, genRequests]
+        = (*mMicroBatchScheduler)(activeRequests, mInflightReqIds, maxBatchSize, maxNumTokens);
+
+    // Request 1 (50 tokens) exceeds the remaining budget after request 0, but request 2
+    // (30 tokens) still fits: 60 + 30 <= 100.
+    ASSERT_EQ(contextRequests.size(), 2);
+    EXPECT_EQ(contextRequests.at(0)->mRequestId, 0);
+    EXPECT_EQ(contextRequests.at(1)->mRequestId, 2);
+    EXPECT_TRUE(genRequests.empty());
+
+    // Once the first batch completes its encoder phase, the skipped request is scheduled.
+    for (auto const& llmReq : contextRequests)
+    {
+        llmReq->setState(LlmRequestState::kCONTEXT_INIT);
+    }
+    std::tie(contextRequests, genRequests)
+        = (*mMicroBatchScheduler)(activeRequests, mInflightReqIds, maxBatchSize, maxNumTokens);
+    ASSERT_EQ(contextRequests.size(), 1);
+    EXPECT_EQ(contextRequests.at(0)->mRequestId, 1);
+}
+
 class ContextChunkingTest : public MicroBatchSchedulerTest
 {
 protected:
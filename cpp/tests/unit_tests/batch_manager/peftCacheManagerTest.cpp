@@ -403,6 +403,33 @@ TEST_F(PeftCacheManagerTest, gptManagerSim)
     }
 }
 
+TEST_F(PeftCacheManagerTest, prefetchTasks)
+{
+    // Unknown tasks and an empty hint list are ignored.
+    mPeftManager->prefetchTasks({});
+    mPeftManager->prefetchTasks({9999});
+
+    SamplingConfig sampleConfig;
+    auto tokens = std::make_shared<std::vector<int32_t>>(std::initializer_list<int32_t>{1, 2, 3, 4});
+    auto llmRequest = std::make_shared<LlmRequest>(0, 4, tokens, sampleConfig, false);
+    llmRequest->setLoraTaskId(1234);
+    llmRequest->setLoraWeights(loraWeightsTp2);
+    llmRequest->setLoraConfig(loraConfigTp2);
+    std::vector<std::shared_ptr<LlmRequest>> reqVector{llmRequest};
+
+    mPeftManager->addRequestPeft(llmRequest);
+    // While the put is still pending the prefetch must defer to it instead of racing the copy.
+    mPeftManager->prefetchTasks({1234});
+    auto peftTable = mPeftManager->ensureBatch(reqVector, {});
+    ASSERT_EQ(1, peftTable.size());
+
+    // Once the task is device resident further prefetch passes are no-ops.
+    mPeftManager->prefetchTasks({1234, 9999});
+    auto peftTable2 = mPeftManager->ensureBatch(reqVector, {});
+    ASSERT_EQ(1, peftTable2.size());
+    EXPECT_EQ(peftTable.at(0), peftTable2.at(0));
+}
+
 TEST_F(PeftCacheManagerTest, updateTaskState)
 {
     ASSERT_TRUE(mPeftManager->getActiveTasks().empty());
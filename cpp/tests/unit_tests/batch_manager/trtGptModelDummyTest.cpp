@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: NVIDIA TensorRT Source Code License Agreement
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/batch_manager/llmRequest.h"
+#include "tensorrt_llm/batch_manager/trtGptModelDummy.h"
+#include "tensorrt_llm/runtime/modelConfig.h"
+#include "tensorrt_llm/runtime/worldConfig.h"
+
+#include <memory>
+#include <optional>
+
+using namespace tensorrt_llm::batch_manager;
+using namespace tensorrt_llm::runtime;
+
+namespace texec = tensorrt_llm::executor;
+
+namespace
+{
+
+ModelConfig makeModelConfig(SizeType32 tokensPerBlock = 64)
+{
+    ModelConfig modelConfig(/*vocabSize=*/1024, /*nbLayers=*/2, /*nbAttentionLayers=*/2, /*nbRnnLayers=*/0,
+        /*nbHeads=*/1, /*hiddenSize=*/64, nvinfer1::DataType::kHALF);
+    modelConfig.setMaxBatchSize(8);
+    modelConfig.setMaxBeamWidth(1);
+    modelConfig.setMaxInputLen(128);
+    modelConfig.setMaxSequenceLen(256);
+    modelConfig.setTokensPerBlock(tokensPerBlock);
+    return modelConfig;
+}
+
+std::shared_ptr<LlmRequest> createRequest(RequestIdType reqId, SizeType32 promptLen, SizeType32 maxNewTokens)
+{
+    SamplingConfig samplingConfig;
+    samplingConfig.beamWidth = 1;
+    return std::make_shared<LlmRequest>(
+        reqId, maxNewTokens, std::vector<TokenIdType>(promptLen, 1), samplingConfig, /*isStreaming=*/false);
+}
+
+} // namespace
+
+TEST(TrtGptModelDummyTest, CompletesRequests)
+{
+    texec::ExecutorConfig const executorConfig;
+    TrtGptModelDummy model(
+        makeModelConfig(), WorldConfig(), TrtGptModelType::InflightFusedBatching, executorConfig);
+
+    constexpr SizeType32 promptLen{8};
+    constexpr SizeType32 maxNewTokens{4};
+    RequestList activeRequests{createRequest(1, promptLen, maxNewTokens), createRequest(2, promptLen, maxNewTokens)};
+
+    // One context iteration producing the first token, then the remaining generation steps.
+    for (SizeType32 iter = 0; iter < maxNewTokens; ++iter)
+    {
+        model.forwardAsync(activeRequests);
+        model.forwardSync();
+    }
+
+    for (auto const& llmReq : activeRequests)
+    {
+        EXPECT_TRUE(llmReq->isGenerationCompleteState());
+        EXPECT_EQ(llmReq->getMaxNumGeneratedTokens(), maxNewTokens);
+        EXPECT_EQ(llmReq->getNumTokens(0), promptLen + maxNewTokens);
+    }
+    EXPECT_EQ(model.getIterCounter(), maxNewTokens);
+    EXPECT_FALSE(model.getNumFreeBlocks().has_value());
+}
+
+TEST(TrtGptModelDummyTest, SimulatedKvCapacityDefersContext)
+{
+    constexpr SizeType32 tokensPerBlock{4};
+    texec::KvCacheConfig kvCacheConfig;
+    kvCacheConfig.setMaxTokens(4 * tokensPerBlock);
+    texec::ExecutorConfig executorConfig;
+    executorConfig.setKvCacheConfig(kvCacheConfig);
+
+    TrtGptModelDummy model(
+        makeModelConfig(tokensPerBlock), WorldConfig(), TrtGptModelType::InflightFusedBatching, executorConfig);
+    ASSERT_EQ(model.getNumFreeBlocks(), 4);
+
+    // Each request needs 3 of the 4 blocks, so only one fits at a time.
+    constexpr SizeType32 promptLen{8};
+    constexpr SizeType32 maxNewTokens{2};
+    auto first = createRequest(1, promptLen, maxNewTokens);
+    auto second = createRequest(2, promptLen, maxNewTokens);
+    RequestList activeRequests{first, second};
+
+    for (SizeType32 iter = 0; iter < maxNewTokens; ++iter)
+    {
+        model.forwardAsync(activeRequests);
+        model.forwardSync();
+    }
+
+    EXPECT_TRUE(first->isGenerationCompleteState());
+    EXPECT_TRUE(second->isContextInitState());
+    EXPECT_EQ(model.getNumFreeBlocks(), 1);
+
+    // Releasing the finished request frees its simulated blocks and unblocks the second one.
+    model.terminateRequest(first);
+    activeRequests.pop_front();
+    EXPECT_EQ(model.getNumFreeBlocks(), 4);
+
+    for (SizeType32 iter = 0; iter < maxNewTokens; ++iter)
+    {
+        model.forwardAsync(activeRequests);
+        model.forwardSync();
+    }
+    EXPECT_TRUE(second->isGenerationCompleteState());
+}
+
+TEST(TrtGptModelDummyTest, MaxCapacityBatchSize)
+{
+    constexpr SizeType32 tokensPerBlock{4};
+    texec::KvCacheConfig kvCacheConfig;
+    kvCacheConfig.setMaxTokens(4 * tokensPerBlock);
+    texec::ExecutorConfig executorConfig;
+    executorConfig.setKvCacheConfig(kvCacheConfig);
+
+    TrtGptModelDummy model(
+        makeModelConfig(tokensPerBlock), WorldConfig(), TrtGptModelType::InflightFusedBatching, executorConfig);
+
+    // Two blocks per sequence of 8 tokens fit twice into the four simulated blocks.
+    EXPECT_EQ(model.getMaxCapacityBatchSize(/*inputLength=*/6, /*outputLength=*/2), 2);
+    EXPECT_EQ(model.getMaxCapacityBatchSize(/*inputLength=*/14, /*outputLength=*/2), 1);
+}
@@ -0,0 +1,157 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tensorrt_llm/common/asyncFileReader.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <future>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using tensorrt_llm::common::AsyncFileReader;
+
+namespace
+{
+
+//! A file whose byte at offset i is a deterministic function of i, so any read can be verified
+//! without keeping a reference copy.
+class PatternFile
+{
+public:
+    explicit PatternFile(std::size_t size)
+        : mPath(std::string(::testing::TempDir()) + "asyncFileReaderTest_"
+            + std::to_string(::getpid()) + "_" + std::to_string(reinterpret_cast<std::uintptr_t>(this)))
+    {
+        auto* file = std::fopen(mPath.c_str(), "wb");
+        ASSERT_NE(file, nullptr);
+        std::vector<char> buffer(1 << 16);
+        for (std::size_t offset = 0; offset < size;)
+        {
+            auto const chunk = std::min(buffer.size(), size - offset);
+            for (std::size_t i = 0; i < chunk; ++i)
+            {
+                buffer[i] = byteAt(offset + i);
+            }
+            ASSERT_EQ(std::fwrite(buffer.data(), 1, chunk, file), chunk);
+            offset += chunk;
+        }
+        std::fclose(file);
+        mFd = ::open(mPath.c_str(), O_RDONLY);
+        ASSERT_GE(mFd, 0);
+    }
+
+    ~PatternFile()
+    {
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+        std::remove(mPath.c_str());
+    }
+
+    [[nodiscard]] int fd() const
+    {
+        return mFd;
+    }
+
+    static char byteAt(std::size_t offset)
+    {
+        return static_cast<char>((offset * 31 + 7) & 0xff);
+    }
+
+private:
+    std::string mPath;
+    int mFd{-1};
+};
+
+void expectPattern(std::vector<char> const& data, std::size_t fileOffset)
+{
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        ASSERT_EQ(data[i], PatternFile::byteAt(fileOffset + i)) << "mismatch at offset " << fileOffset + i;
+    }
+}
+
+} // namespace
+
+TEST(AsyncFileReaderTest, ReadRangeSmall)
+{
+    constexpr std::size_t kFileSize = 64 * 1024 + 13;
+    PatternFile file(kFileSize);
+
+    std::vector<char> data(kFileSize);
+    EXPECT_TRUE(AsyncFileReader::instance().readRange(file.fd(), data.data(), data.size(), 0));
+    expectPattern(data, 0);
+}
+
+TEST(AsyncFileReaderTest, ReadRangeChunked)
+{
+    // Larger than the internal chunk size, so the range is split into several in-flight reads.
+    constexpr std::size_t kFileSize = (24 << 20) + 4097;
+    PatternFile file(kFileSize);
+
+    std::vector<char> data(kFileSize);
+    EXPECT_TRUE(AsyncFileReader::instance().readRange(file.fd(), data.data(), data.size(), 0));
+    expectPattern(data, 0);
+}
+
+TEST(AsyncFileReaderTest, ConcurrentOffsetReads)
+{
+    constexpr std::size_t kFileSize = 1 << 20;
+    constexpr std::size_t kNumReads = 64;
+    constexpr std::size_t kReadSize = kFileSize / kNumReads;
+    PatternFile file(kFileSize);
+
+    std::vector<std::vector<char>> buffers(kNumReads, std::vector<char>(kReadSize));
+    std::vector<std::future<bool>> futures;
+    futures.reserve(kNumReads);
+    for (std::size_t i = 0; i < kNumReads; ++i)
+    {
+        futures.push_back(AsyncFileReader::instance().readAsync(
+            file.fd(), buffers[i].data(), kReadSize, static_cast<std::int64_t>(i * kReadSize)));
+    }
+    for (std::size_t i = 0; i < kNumReads; ++i)
+    {
+        EXPECT_TRUE(futures[i].get());
+        expectPattern(buffers[i], i * kReadSize);
+    }
+}
+
+TEST(AsyncFileReaderTest, ReadPastEofFails)
+{
+    constexpr std::size_t kFileSize = 4096;
+    PatternFile file(kFileSize);
+
+    std::vector<char> data(256);
+    EXPECT_FALSE(AsyncFileReader::instance().readAsync(file.fd(), data.data(), data.size(), kFileSize).get());
+    // A range straddling EOF cannot be read in full either.
+    EXPECT_FALSE(AsyncFileReader::instance().readRange(file.fd(), data.data(), data.size(), kFileSize - 128));
+}
+
+TEST(AsyncFileReaderTest, ZeroSizeReadSucceeds)
+{
+    constexpr std::size_t kFileSize = 4096;
+    PatternFile file(kFileSize);
+
+    EXPECT_TRUE(AsyncFileReader::instance().readAsync(file.fd(), nullptr, 0, 0).get());
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/common/cublasMMWrapper.h"
+#include "tensorrt_llm/common/cudaUtils.h"
+
+namespace tc = tensorrt_llm::common;
+
+TEST(CublasWorkspacePoolTest, SharesBlockPerStream)
+{
+    cudaStream_t stream{};
+    TLLM_CUDA_CHECK(cudaStreamCreate(&stream));
+
+    auto const first = tc::CublasWorkspacePool::lease(stream);
+    auto const second = tc::CublasWorkspacePool::lease(stream);
+    EXPECT_EQ(first.get(), second.get()) << "Leases on the same stream must share one workspace.";
+
+    TLLM_CUDA_CHECK(cudaStreamDestroy(stream));
+}
+
+TEST(CublasWorkspacePoolTest, DistinctBlocksPerStream)
+{
+    cudaStream_t streamA{};
+    cudaStream_t streamB{};
+    TLLM_CUDA_CHECK(cudaStreamCreate(&streamA));
+    TLLM_CUDA_CHECK(cudaStreamCreate(&streamB));
+
+    auto const leaseA = tc::CublasWorkspacePool::lease(streamA);
+    auto const leaseB = tc::CublasWorkspacePool::lease(streamB);
+    EXPECT_NE(leaseA.get(), leaseB.get()) << "Concurrent streams must not share a workspace.";
+
+    TLLM_CUDA_CHECK(cudaStreamDestroy(streamA));
+    TLLM_CUDA_CHECK(cudaStreamDestroy(streamB));
+}
+
+TEST(CublasWorkspacePoolTest, RecyclesBlockAfterLastLease)
+{
+    cudaStream_t stream{};
+    TLLM_CUDA_CHECK(cudaStreamCreate(&stream));
+
+    void* block = nullptr;
+    {
+        auto const lease = tc::CublasWorkspacePool::lease(stream);
+        block = lease.get();
+    }
+    // The block went back to the free list, so the next lease on any stream reuses it.
+    auto const lease = tc::CublasWorkspacePool::lease(stream);
+    EXPECT_EQ(lease.get(), block);
+
+    TLLM_CUDA_CHECK(cudaStreamDestroy(stream));
+}
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/common/tokenScanUtils.h"
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace tc = tensorrt_llm::common;
+
+namespace
+{
+
+// Lane-interleaved FNV-1a as documented in tokenScanUtils.cpp. The production scalar and SIMD
+// paths must both match this reference, so the test pins the algorithm rather than the platform.
+std::size_t referenceHash(std::vector<std::int32_t> const& tokens)
+{
+    constexpr std::size_t kLanes = 8;
+    std::uint32_t lanes[kLanes];
+    for (auto& lane : lanes)
+    {
+        lane = 2166136261u;
+    }
+    for (std::size_t i = 0; i < tokens.size(); ++i)
+    {
+        lanes[i % kLanes] = (lanes[i % kLanes] ^ static_cast<std::uint32_t>(tokens[i])) * 16777619u;
+    }
+    std::size_t seed = tokens.size();
+    for (auto const lane : lanes)
+    {
+        seed ^= lane + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+}
+
+} // namespace
+
+TEST(TokenScanUtils, AllTokensInRangeAcceptsValidVectors)
+{
+    EXPECT_TRUE(tc::allTokensInRange(nullptr, 0, 0, 1));
+    // Sweep sizes around the 4/8/16-lane vector widths so full blocks and tails are both covered.
+    for (std::size_t size = 1; size <= 70; ++size)
+    {
+        std::vector<std::int32_t> tokens(size);
+        std::iota(tokens.begin(), tokens.end(), 0);
+        tokens.front() = 0;
+        tokens.back() = static_cast<std::int32_t>(size) - 1;
+        EXPECT_TRUE(tc::allTokensInRange(tokens.data(), tokens.size(), 0, static_cast<std::int32_t>(size)))
+            << "size " << size;
+    }
+}
+
+TEST(TokenScanUtils, AllTokensInRangeRejectsAnyPosition)
+{
+    constexpr std::size_t size = 67;
+    constexpr std::int32_t vocabSize = 1000;
+    for (std::size_t pos = 0; pos < size; ++pos)
+    {
+        std::vector<std::int32_t> tokens(size, 42);
+        tokens[pos] = vocabSize;
+        EXPECT_FALSE(tc::allTokensInRange(tokens.data(), tokens.size(), 0, vocabSize)) << "pos " << pos;
+        tokens[pos] = -1;
+        EXPECT_FALSE(tc::allTokensInRange(tokens.data(), tokens.size(), 0, vocabSize)) << "pos " << pos;
+    }
+}
+
+TEST(TokenScanUtils, AllTokensInRangeBoundsAreHalfOpen)
+{
+    std::vector<std::int32_t> tokens(16, 0);
+    tokens.back() = 9;
+    EXPECT_TRUE(tc::allTokensInRange(tokens.data(), tokens.size(), 0, 10));
+    EXPECT_FALSE(tc::allTokensInRange(tokens.data(), tokens.size(), 0, 9));
+}
+
+TEST(TokenScanUtils, HashTokensMatchesReference)
+{
+    for (std::size_t size = 0; size <= 70; ++size)
+    {
+        std::vector<std::int32_t> tokens(size);
+        std::iota(tokens.begin(), tokens.end(), 17);
+        EXPECT_EQ(tc::hashTokens(tokens.data(), tokens.size()), referenceHash(tokens)) << "size " << size;
+    }
+}
+
+TEST(TokenScanUtils, HashTokensDistinguishesSingleTokenChange)
+{
+    std::vector<std::int32_t> tokens(33);
+    std::iota(tokens.begin(), tokens.end(), 0);
+    auto const baseline = tc::hashTokens(tokens.data(), tokens.size());
+    for (std::size_t pos = 0; pos < tokens.size(); ++pos)
+    {
+        auto changed = tokens;
+        changed[pos] += 1;
+        EXPECT_NE(tc::hashTokens(changed.data(), changed.size()), baseline) << "pos " << pos;
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: NVIDIA TensorRT Source Code License Agreement
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#include "tensorrt_llm/executor/admissionController.h"
+#include "tensorrt_llm/executor/executor.h"
+#include <gtest/gtest.h>
+
+using namespace tensorrt_llm::executor;
+
+namespace
+{
+
+RequestWithId makeRequest(IdType id, SizeType32 numInputTokens, SizeType32 maxTokens, std::optional<IdType> clientId)
+{
+    Request req(VecTokens(numInputTokens, 1), maxTokens);
+    if (clientId)
+    {
+        req.setClientId(clientId.value());
+    }
+    return RequestWithId{std::move(req), id, {}, std::chrono::steady_clock::now()};
+}
+
+} // namespace
+
+TEST(AdmissionControllerTest, QueueDepthBound)
+{
+    AdmissionController controller({0., 0., 2});
+
+    std::vector<RequestWithId> first;
+    first.push_back(makeRequest(1, 4, 4, 7));
+    first.push_back(makeRequest(2, 4, 4, 7));
+    EXPECT_FALSE(controller.tryAdmit(first).has_value());
+
+    // The tenant is at its depth limit; another tenant is unaffected.
+    std::vector<RequestWithId> second;
+    second.push_back(makeRequest(3, 4, 4, 7));
+    EXPECT_TRUE(controller.tryAdmit(second).has_value());
+    std::vector<RequestWithId> other;
+    other.push_back(makeRequest(4, 4, 4, 8));
+    EXPECT_FALSE(controller.tryAdmit(other).has_value());
+
+    // Dequeuing frees depth for the limited tenant.
+    controller.onDequeued(7, 1);
+    EXPECT_FALSE(controller.tryAdmit(second).has_value());
+}
+
+TEST(AdmissionControllerTest, QueueDepthRejectionIsAllOrNothing)
+{
+    AdmissionController controller({0., 0., 2});
+
+    // One batch over the limit charges nothing.
+    std::vector<RequestWithId> batch;
+    batch.push_back(makeRequest(1, 4, 4, 7));
+    batch.push_back(makeRequest(2, 4, 4, 7));
+    batch.push_back(makeRequest(3, 4, 4, 7));
+    EXPECT_TRUE(controller.tryAdmit(batch).has_value());
+
+    batch.pop_back();
+    EXPECT_FALSE(controller.tryAdmit(batch).has_value());
+}
+
+TEST(AdmissionControllerTest, TokenBucket)
+{
+    // High burst, negligible refill within the test.
+    AdmissionController controller({1., 100., 0});
+
+    // Cost is input plus max new tokens: 10 + 42 = 52.
+    std::vector<RequestWithId> batch;
+    batch.push_back(makeRequest(1, 10, 42, 7));
+    EXPECT_FALSE(controller.tryAdmit(batch).has_value());
+    // 48 tokens left in the bucket.
+    EXPECT_TRUE(controller.tryAdmit(batch).has_value());
+
+    // Tenants have separate buckets; anonymous requests share one.
+    std::vector<RequestWithId> other;
+    other.push_back(makeRequest(2, 10, 42, 8));
+    EXPECT_FALSE(controller.tryAdmit(other).has_value());
+    std::vector<RequestWithId> anonymous;
+    anonymous.push_back(makeRequest(3, 10, 80, std::nullopt));
+    EXPECT_FALSE(controller.tryAdmit(anonymous).has_value());
+    EXPECT_TRUE(controller.tryAdmit(anonymous).has_value());
+}
+
+TEST(AdmissionControllerTest, OversizeRequestAdmittedFromFullBucket)
+{
+    AdmissionController controller({1., 100., 0});
+
+    // Cost 200 exceeds the burst of 100 but the bucket is full, so the request is admitted and
+    // leaves the bucket in debt; the next request is rejected.
+    std::vector<RequestWithId> large;
+    large.push_back(makeRequest(1, 100, 100, 7));
+    EXPECT_FALSE(controller.tryAdmit(large).has_value());
+    std::vector<RequestWithId> small;
+    small.push_back(makeRequest(2, 1, 1, 7));
+    EXPECT_TRUE(controller.tryAdmit(small).has_value());
+}
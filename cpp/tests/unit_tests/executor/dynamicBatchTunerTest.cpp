@@ -51,6 +51,46 @@ TEST(DynamicBatchTunerTest, Stats)
     EXPECT_EQ(dynamicBatchTuner.getAverageOutputLength(), 4);
 }
 
+TEST(DynamicBatchTunerTest, LatencyFeedback)
+{
+    setenv("TRTLLM_ITER_LATENCY_TARGET_MS", "40", 1);
+    // moving average window size is 1 so the controller reacts after each iteration
+    DynamicBatchConfig dynamicBatchConfig(true, true, 1);
+    DynamicBatchTuner dynamicBatchTuner(dynamicBatchConfig);
+    unsetenv("TRTLLM_ITER_LATENCY_TARGET_MS");
+
+    EXPECT_TRUE(dynamicBatchTuner.isLatencyFeedbackEnabled());
+    EXPECT_EQ(dynamicBatchTuner.getLatencyScale(), 1.0);
+
+    auto const baseBatchSize = dynamicBatchTuner.getRuntimeBatchSize(4096);
+
+    // within the hysteresis band, no adjustment
+    dynamicBatchTuner.updateIterationLatency(42.0);
+    EXPECT_EQ(dynamicBatchTuner.getLatencyScale(), 1.0);
+
+    // above the high watermark, scale down
+    dynamicBatchTuner.updateIterationLatency(60.0);
+    EXPECT_LT(dynamicBatchTuner.getLatencyScale(), 1.0);
+    auto const reducedScale = dynamicBatchTuner.getLatencyScale();
+    EXPECT_LT(dynamicBatchTuner.getRuntimeBatchSize(4096), baseBatchSize);
+
+    // below the low watermark, scale back up towards 1
+    dynamicBatchTuner.updateIterationLatency(20.0);
+    EXPECT_GT(dynamicBatchTuner.getLatencyScale(), reducedScale);
+    EXPECT_LE(dynamicBatchTuner.getLatencyScale(), 1.0);
+}
+
+TEST(DynamicBatchTunerTest, LatencyFeedbackDisabled)
+{
+    // moving average window size is 1
+    DynamicBatchConfig dynamicBatchConfig(true, true, 1);
+    DynamicBatchTuner dynamicBatchTuner(dynamicBatchConfig);
+
+    EXPECT_FALSE(dynamicBatchTuner.isLatencyFeedbackEnabled());
+    dynamicBatchTuner.updateIterationLatency(1000.0);
+    EXPECT_EQ(dynamicBatchTuner.getLatencyScale(), 1.0);
+}
+
 TEST(DynamicBatchConfig, RuntimeBatchSize)
 {
     // moving average window size is 3
@@ -131,6 +131,75 @@ TEST_F(IntervalSetTest, testRandomInsert)
     EXPECT_EQ(mIntervalSet.getNumElements(), 0);
 }
 
+TEST_F(IntervalSetTest, testCachedGenerationContains)
+{
+    uint64_t cachedGeneration = 0;
+    // Generation 0 means nothing was ever inserted, so a zero-initialized cache short-circuits.
+    EXPECT_EQ(mIntervalSet.getGeneration(), 0);
+    EXPECT_FALSE(mIntervalSet.contains(7, cachedGeneration));
+
+    mIntervalSet.insert(3);
+    EXPECT_EQ(mIntervalSet.getGeneration(), 1);
+    // The insert invalidated the cache; the slow path runs and re-caches the negative result.
+    EXPECT_FALSE(mIntervalSet.contains(7, cachedGeneration));
+    EXPECT_EQ(cachedGeneration, 1);
+    EXPECT_FALSE(mIntervalSet.contains(7, cachedGeneration));
+
+    // Inserting an already contained number does not change the set nor the generation.
+    mIntervalSet.insert(3);
+    EXPECT_EQ(mIntervalSet.getGeneration(), 1);
+    EXPECT_FALSE(mIntervalSet.contains(7, cachedGeneration));
+
+    mIntervalSet.insert(7);
+    EXPECT_EQ(mIntervalSet.getGeneration(), 2);
+    EXPECT_TRUE(mIntervalSet.contains(7, cachedGeneration));
+
+    // Clear keeps the generation monotonic; cached negatives stay valid.
+    mIntervalSet.clear();
+    EXPECT_EQ(mIntervalSet.getGeneration(), 2);
+    uint64_t freshCache = 0;
+    EXPECT_FALSE(mIntervalSet.contains(3, freshCache));
+    EXPECT_EQ(freshCache, 2);
+}
+
+TEST_F(IntervalSetTest, testBatchInsert)
+{
+    mIntervalSet.insert(4);
+    mIntervalSet.insert(8);
+    auto const generationBefore = mIntervalSet.getGeneration();
+
+    // Batch with duplicates and out-of-order numbers; merges [4, 4] and [8, 8] into [2, 9].
+    mIntervalSet.insert(std::vector<IdType>{9, 5, 2, 3, 5, 7, 6, 2});
+    EXPECT_EQ(mIntervalSet.getNumElements(), 8);
+    EXPECT_EQ(mIntervalSet.getIntervals().size(), 1);
+    EXPECT_EQ(mIntervalSet.getGeneration(), generationBefore + 1);
+    for (int i = 2; i <= 9; i++)
+    {
+        EXPECT_TRUE(mIntervalSet.contains(i));
+    }
+    EXPECT_FALSE(mIntervalSet.contains(1));
+    EXPECT_FALSE(mIntervalSet.contains(10));
+
+    // A batch fully contained in the set leaves the generation untouched.
+    mIntervalSet.insert(std::vector<IdType>{3, 8});
+    EXPECT_EQ(mIntervalSet.getNumElements(), 8);
+    EXPECT_EQ(mIntervalSet.getGeneration(), generationBefore + 1);
+
+    // An empty batch is a no-op.
+    mIntervalSet.insert(std::vector<IdType>{});
+    EXPECT_EQ(mIntervalSet.getNumElements(), 8);
+    EXPECT_EQ(mIntervalSet.getGeneration(), generationBefore + 1);
+
+    // Disjoint batch keeps intervals ordered and disjoint.
+    mIntervalSet.insert(std::vector<IdType>{20, 0, 15});
+    EXPECT_EQ(mIntervalSet.getNumElements(), 11);
+    EXPECT_EQ(mIntervalSet.getIntervals().size(), 4);
+    EXPECT_TRUE(mIntervalSet.contains(0));
+    EXPECT_TRUE(mIntervalSet.contains(15));
+    EXPECT_TRUE(mIntervalSet.contains(20));
+    EXPECT_FALSE(mIntervalSet.contains(14));
+}
+
 TEST_F(IntervalSetTest, testTerminatedReqIdIntervals)
 {
     mIntervalSet.insert(4);
@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: NVIDIA TensorRT Source Code License Agreement
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#include "tensorrt_llm/executor/iterationStatsRing.h"
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace tensorrt_llm::executor;
+
+namespace
+{
+
+std::string uniqueRingName()
+{
+    return "/trtllm_iter_stats_test_" + std::to_string(::getpid());
+}
+
+IterationStats makeStats(uint64_t iter)
+{
+    IterationStats stats;
+    stats.iter = iter;
+    stats.iterLatencyMS = 1.5;
+    stats.numActiveRequests = 3;
+    stats.numQueuedRequests = 7;
+    stats.gpuMemUsage = 1024;
+    InflightBatchingStats ifbStats{};
+    ifbStats.numScheduledRequests = 3;
+    ifbStats.numCtxTokens = 128;
+    stats.inflightBatchingStats = ifbStats;
+    return stats;
+}
+
+} // namespace
+
+TEST(IterationStatsRingTest, RoundTripThroughSharedMemory)
+{
+    auto const name = uniqueRingName();
+    auto writer = IterationStatsRing::create(name, 8);
+    ASSERT_NE(writer, nullptr);
+    auto reader = IterationStatsRing::open(name);
+    ASSERT_NE(reader, nullptr);
+
+    EXPECT_EQ(reader->latestSequence(), 0);
+    EXPECT_FALSE(reader->read(1).has_value());
+
+    writer->push(IterationStatsRecord::fromStats(makeStats(42)));
+    ASSERT_EQ(reader->latestSequence(), 1);
+    auto const record = reader->read(1);
+    ASSERT_TRUE(record.has_value());
+    EXPECT_EQ(record->iter, 42);
+    EXPECT_DOUBLE_EQ(record->iterLatencyMS, 1.5);
+    EXPECT_EQ(record->numActiveRequests, 3);
+    EXPECT_EQ(record->numQueuedRequests, 7);
+    EXPECT_EQ(record->gpuMemUsage, 1024);
+    ASSERT_TRUE(record->presentMask & IterationStatsRecord::kINFLIGHT_BATCHING_STATS_BIT);
+    EXPECT_EQ(record->inflightBatchingStats.numScheduledRequests, 3);
+    EXPECT_EQ(record->inflightBatchingStats.numCtxTokens, 128);
+    // Sections the writer never filled are marked absent.
+    EXPECT_FALSE(record->presentMask & IterationStatsRecord::kKV_CACHE_STATS_BIT);
+}
+
+TEST(IterationStatsRingTest, LappedRecordsAreRejected)
+{
+    auto const name = uniqueRingName() + "_lap";
+    auto writer = IterationStatsRing::create(name, 4);
+    ASSERT_NE(writer, nullptr);
+
+    for (uint64_t iter = 1; iter <= 10; ++iter)
+    {
+        writer->push(IterationStatsRecord::fromStats(makeStats(iter)));
+    }
+    EXPECT_EQ(writer->latestSequence(), 10);
+
+    // Only the last numSlots records are still readable; older ones were reused.
+    EXPECT_FALSE(writer->read(6).has_value());
+    for (uint64_t seq = 7; seq <= 10; ++seq)
+    {
+        auto const record = writer->read(seq);
+        ASSERT_TRUE(record.has_value());
+        EXPECT_EQ(record->iter, seq);
+    }
+    // Sequences beyond the head are not readable yet.
+    EXPECT_FALSE(writer->read(11).has_value());
+}
+
+TEST(IterationStatsRingTest, OpenRejectsMissingSegment)
+{
+    EXPECT_EQ(IterationStatsRing::open("/trtllm_iter_stats_test_does_not_exist"), nullptr);
+}
@@ -125,6 +125,9 @@ void compareRequestStats(texec::RequestStats const& lh, texec::RequestStats cons
     EXPECT_EQ(lh.reusedBlocksPerRequest, rh.reusedBlocksPerRequest);
     EXPECT_EQ(lh.missedBlocksPerRequest, rh.missedBlocksPerRequest);
     EXPECT_EQ(lh.kvCacheHitRatePerRequest, rh.kvCacheHitRatePerRequest);
+    EXPECT_EQ(lh.timeInQueueMS, rh.timeInQueueMS);
+    EXPECT_EQ(lh.contextLatencyMS, rh.contextLatencyMS);
+    EXPECT_EQ(lh.lastTokenLatenciesMS, rh.lastTokenLatenciesMS);
 }
 
 void compareRequestStatsPerIteration(
@@ -437,6 +440,24 @@ TEST(SerializeUtilsTest, ResultResponse)
     }
 }
 
+TEST(SerializeUtilsTest, PackedLogProbsResult)
+{
+    // Values chosen exactly representable in fp16 so the packed round trip compares equal.
+    texec::Result res = texec::Result{false, {{1, 2, 3}}, texec::VecLogProbs{-1.0, -2.0},
+        std::vector<texec::VecLogProbs>{{-0.125, -3.5, -0.0078125}, {-10.25}}, std::nullopt, std::nullopt,
+        std::nullopt, std::nullopt, std::vector<texec::FinishReason>{texec::FinishReason::kLENGTH},
+        texec::ContextPhaseParams({9, 37}, 0, VecTokens{1, 2}), 3, 2, true};
+    res.packedLogProbs = true;
+
+    // The packed encoding must be smaller than the plain nested float vectors.
+    auto plainRes = res;
+    plainRes.packedLogProbs = false;
+    EXPECT_LT(texec::Serialization::serializedSize(res), texec::Serialization::serializedSize(plainRes));
+
+    testSerializeDeserialize(res);
+    testSerializeDeserialize(texec::Response(1, res));
+}
+
 TEST(SerializeUtilsTest, VectorResponses)
 {
     int numResponses = 15;
@@ -827,7 +848,7 @@ TEST(SerializeUtilsTest, RequestStats)
 {
     tensorrt_llm::executor::DisServingRequestStats disServingRequestStats{0.56222, 78643200};
     texec::RequestStats requestStats{123, tensorrt_llm::executor::RequestStage::kQUEUED, 56, 25, 135, true, false,
-        disServingRequestStats, 33, 22, 6, 1, 8};
+        disServingRequestStats, 33, 22, 6, 1, 8, 12.5, 250.75, {1.5, 2.25, 3.125}};
     auto requestStats2 = serializeDeserialize(requestStats);
     compareRequestStats(requestStats, requestStats2);
     requestStats.disServingStats = std::nullopt;
@@ -840,9 +861,9 @@ TEST(SerializeUtilsTest, RequestStatsPerIteration)
 
     tensorrt_llm::executor::DisServingRequestStats disServingRequestStats{0.56222, 78643200};
     texec::RequestStats requestStats1{123, tensorrt_llm::executor::RequestStage::kQUEUED, 56, 25, 135, true, false,
-        disServingRequestStats, 33, 22, 6, 1, 8};
-    texec::RequestStats requestStats2{
-        899, texec::RequestStage::kGENERATION_IN_PROGRESS, 98, 78, 77, false, true, std::nullopt, 7, 14, 65, 61, 78};
+        disServingRequestStats, 33, 22, 6, 1, 8, 12.5, 250.75, {1.5, 2.25, 3.125}};
+    texec::RequestStats requestStats2{899, texec::RequestStage::kGENERATION_IN_PROGRESS, 98, 78, 77, false, true,
+        std::nullopt, 7, 14, 65, 61, 78, 3.5, 120.25, {10.5, 11.75}};
 
     texec::RequestStatsPerIteration requestStatsPerIteration{0, {requestStats1, requestStats2}};
     auto requestStatsPerIteration2 = serializeDeserialize(requestStatsPerIteration);
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: NVIDIA TensorRT Source Code License Agreement
+ *
+ * NVIDIA CORPORATION, its affiliates and licensors retain all intellectual
+ * property and proprietary rights in and to this material, related
+ * documentation and any modifications thereto. Any use, reproduction,
+ * disclosure or distribution of this material and related documentation
+ * without an express license agreement from NVIDIA CORPORATION or
+ * its affiliates is strictly prohibited.
+ */
+
+#include "tensorrt_llm/executor/specDecodingTuner.h"
+#include "tensorrt_llm/executor/executor.h"
+#include "tensorrt_llm/executor/types.h"
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace tensorrt_llm::executor;
+
+TEST(SpecDecodingTunerTest, Stats)
+{
+    SpeculativeDecodingConfig specDecConfig(false, true);
+    // moving average window size is 2
+    SpecDecodingTuner specDecodingTuner(specDecConfig, 2);
+
+    EXPECT_TRUE(specDecodingTuner.isDraftLenTuningEnabled());
+
+    // check no division by zero issue
+    EXPECT_EQ(specDecodingTuner.getAverageAcceptanceRate(), 0);
+
+    specDecodingTuner.updateAcceptanceStats(4, 2.0);
+    EXPECT_EQ(specDecodingTuner.getAverageAcceptanceRate(), 0.5);
+
+    specDecodingTuner.updateAcceptanceStats(4, 4.0);
+    EXPECT_EQ(specDecodingTuner.getAverageAcceptanceRate(), 0.75);
+
+    // check that the first element is removed from the moving average window
+    specDecodingTuner.updateAcceptanceStats(4, 0.0);
+    EXPECT_EQ(specDecodingTuner.getAverageAcceptanceRate(), 0.5);
+
+    // requests without draft tokens do not contribute to the stats
+    specDecodingTuner.updateAcceptanceStats(0, 1.0);
+    EXPECT_EQ(specDecodingTuner.getAverageAcceptanceRate(), 0.5);
+}
+
+TEST(SpecDecodingTunerTest, DraftLenFeedback)
+{
+    SizeType32 constexpr maxDraftLen = 4;
+    SpeculativeDecodingConfig specDecConfig(false, true);
+    // moving average window size is 1 so the controller reacts after each request
+    SpecDecodingTuner specDecodingTuner(specDecConfig, 1);
+
+    // the runtime draft length starts at the engine limit
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), maxDraftLen);
+
+    // low acceptance shortens the draft by one step per adjustment
+    specDecodingTuner.updateAcceptanceStats(4, 1.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 3);
+
+    // no further reaction until new samples arrive
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 3);
+
+    specDecodingTuner.updateAcceptanceStats(3, 0.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 2);
+
+    specDecodingTuner.updateAcceptanceStats(2, 0.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 1);
+
+    // the draft never shrinks below one token
+    specDecodingTuner.updateAcceptanceStats(1, 0.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 1);
+
+    // high acceptance grows the draft back toward the engine limit
+    specDecodingTuner.updateAcceptanceStats(1, 1.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 2);
+
+    specDecodingTuner.updateAcceptanceStats(2, 2.0);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 3);
+
+    // acceptance inside the hysteresis band leaves the draft length unchanged
+    specDecodingTuner.updateAcceptanceStats(3, 1.5);
+    EXPECT_EQ(specDecodingTuner.getRuntimeDraftLen(maxDraftLen), 3);
+}
@@ -20,8 +20,11 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
+#include <numeric>
 #include <random>
+#include <vector>
 
 namespace tk = tensorrt_llm::kernels;
 namespace tc = tensorrt_llm::common;
@@ -49,9 +52,10 @@ public:
     void initData(SizeType32 seed, SizeType32 batchSize, SizeType32 vocabSizePadded)
     {
         std::mt19937 generator(seed);
-        std::vector<int32_t> index(batchSize);
-        std::iota(index.begin(), index.end(), 0);
-        std::shuffle(index.begin(), index.end(), generator);
+        mRowIndex.resize(batchSize);
+        std::iota(mRowIndex.begin(), mRowIndex.end(), 0);
+        std::shuffle(mRowIndex.begin(), mRowIndex.end(), generator);
+        auto const& index = mRowIndex;
         std::uniform_int_distribution<BitmaskT> dist(
             std::numeric_limits<BitmaskT>::min(), std::numeric_limits<BitmaskT>::max());
 
@@ -98,6 +102,64 @@ public:
         mBufferManager->copy(*mLogitsBitmaskPtrVecHost, *mLogitsBitmaskPtrVec);
     }
 
+    //! Like initData, but most mask words allow all tokens; also builds the sparse
+    //! (word index, mask word) representation consumed by the sparse kernel.
+    void initSparseData(SizeType32 seed, SizeType32 batchSize, SizeType32 vocabSizePadded)
+    {
+        initData(seed, batchSize, vocabSizePadded);
+
+        std::mt19937 generator(seed + 1);
+        std::uniform_int_distribution<BitmaskT> valueDist(
+            std::numeric_limits<BitmaskT>::min(), std::numeric_limits<BitmaskT>::max());
+        std::uniform_int_distribution<int32_t> sparsityDist(0, 15);
+
+        auto constexpr bitmaskDtype = TRTDataType<BitmaskT>::value;
+        auto constexpr bitmaskPtrDtype = TRTDataType<BitmaskT*>::value;
+        auto constexpr numWordsDtype = TRTDataType<int32_t>::value;
+
+        mSparseMask = mBufferManager->gpu(ITensor::makeShape({mBatchSize, 2 * mBitmaskSize}), bitmaskDtype);
+        mSparseMaskHost = BufferManager::pinned(ITensor::makeShape({mBatchSize, 2 * mBitmaskSize}), bitmaskDtype);
+        mSparseMaskPtrVec = mBufferManager->gpu(ITensor::makeShape({mBatchSize}), bitmaskPtrDtype);
+        mSparseMaskPtrVecHost = BufferManager::pinned(ITensor::makeShape({mBatchSize}), bitmaskPtrDtype);
+        mSparseNumWordsVec = mBufferManager->gpu(ITensor::makeShape({mBatchSize}), numWordsDtype);
+        mSparseNumWordsVecHost = BufferManager::pinned(ITensor::makeShape({mBatchSize}), numWordsDtype);
+
+        auto logitsBitmaskHost = BufferRange<BitmaskT>(*mLogitsBitmaskHost);
+        auto sparseMaskHost = BufferRange<BitmaskT>(*mSparseMaskHost);
+        auto sparseMaskPtrVecHost = BufferRange<BitmaskT*>(*mSparseMaskPtrVecHost);
+        auto sparseNumWordsVecHost = BufferRange<int32_t>(*mSparseNumWordsVecHost);
+        std::vector<int32_t> numWordsPerRow(mBatchSize);
+        mMaxSparseNumWords = 0;
+        for (int i = 0; i < mBatchSize; i++)
+        {
+            int32_t numWords = 0;
+            for (int j = 0; j < mBitmaskSize; j++)
+            {
+                auto const word = sparsityDist(generator) == 0 ? valueDist(generator) : ~BitmaskT{0};
+                logitsBitmaskHost[i * mBitmaskSize + j] = word;
+                if (word != ~BitmaskT{0})
+                {
+                    sparseMaskHost[i * 2 * mBitmaskSize + 2 * numWords] = static_cast<BitmaskT>(j);
+                    sparseMaskHost[i * 2 * mBitmaskSize + 2 * numWords + 1] = word;
+                    numWords++;
+                }
+            }
+            numWordsPerRow[i] = numWords;
+            mMaxSparseNumWords = std::max(mMaxSparseNumWords, numWords);
+        }
+        for (int i = 0; i < mBatchSize; i++)
+        {
+            // Pair each batch entry with the same shuffled row as the dense logits pointers.
+            sparseMaskPtrVecHost[i] = bufferCast<BitmaskT>(*ITensor::at(mSparseMask, {mRowIndex[i]}));
+            sparseNumWordsVecHost[i] = numWordsPerRow[mRowIndex[i]];
+        }
+
+        mBufferManager->copy(*mLogitsBitmaskHost, *mLogitsBitmask);
+        mBufferManager->copy(*mSparseMaskHost, *mSparseMask);
+        mBufferManager->copy(*mSparseMaskPtrVecHost, *mSparseMaskPtrVec);
+        mBufferManager->copy(*mSparseNumWordsVecHost, *mSparseNumWordsVec);
+    }
+
     void runTest()
     {
         auto logitsPtrVec = bufferCast<T*>(*mLogitsPtrVec);
@@ -107,7 +169,25 @@ public:
 
         mBufferManager->copy(*mLogits, *mLogitsHost);
         mStream->synchronize();
+        verifyLogits();
+    }
+
+    void runSparseTest()
+    {
+        auto logitsPtrVec = bufferCast<T*>(*mLogitsPtrVec);
+        auto sparseMaskPtrVec = bufferCast<BitmaskT const*>(*mSparseMaskPtrVec);
+        auto sparseNumWordsVec = bufferCast<int32_t const>(*mSparseNumWordsVec);
+
+        tk::invokeSparseLogitsBitmask<T>(logitsPtrVec, sparseMaskPtrVec, sparseNumWordsVec, mMaxSparseNumWords,
+            mBatchSize, mVocabSizePadded, mStream->get());
+
+        mBufferManager->copy(*mLogits, *mLogitsHost);
+        mStream->synchronize();
+        verifyLogits();
+    }
 
+    void verifyLogits()
+    {
         auto logitsHost = BufferRange<T>(*mLogitsHost);
         auto logitsBitmaskHost = BufferRange<BitmaskT>(*mLogitsBitmaskHost);
         for (int i = 0; i < mBatchSize; i++)
@@ -152,6 +232,15 @@ protected:
     TensorPtr mLogitsHost;              // [mBatchSize, mVocabSizePadded]
     TensorPtr mLogitsPtrVec;            // [mBatchSize], pointers to the logits in a batch
     TensorPtr mLogitsPtrVecHost;        // [mBatchSize]
+
+    std::vector<SizeType32> mRowIndex;  // Shuffled row backing each batch entry
+    int32_t mMaxSparseNumWords;
+    TensorPtr mSparseMask;              // [mBatchSize, 2 * mBitmaskSize], (word index, mask word) pairs
+    TensorPtr mSparseMaskHost;          // [mBatchSize, 2 * mBitmaskSize]
+    TensorPtr mSparseMaskPtrVec;        // [mBatchSize], pointers to the sparse masks in a batch
+    TensorPtr mSparseMaskPtrVecHost;    // [mBatchSize]
+    TensorPtr mSparseNumWordsVec;       // [mBatchSize]
+    TensorPtr mSparseNumWordsVecHost;   // [mBatchSize]
 };
 
 using TestingTypes = testing::Types<float, half, __nv_bfloat16>;
@@ -170,4 +259,16 @@ TYPED_TEST(LogitsBitmaskTest, NotAligned)
     this->runTest();
 }
 
+TYPED_TEST(LogitsBitmaskTest, Sparse)
+{
+    this->initSparseData(0, 16, 128000);
+    this->runSparseTest();
+}
+
+TYPED_TEST(LogitsBitmaskTest, SparseNotAligned)
+{
+    this->initSparseData(515, 123, 1234);
+    this->runSparseTest();
+}
+
 } // namespace
@@ -109,4 +109,62 @@ TYPED_TEST(TopPSamplingKernelTest, CorrectnessReturnAllSelectedTokens)
                       .setTopP(0.8f)
                       .setReturnAllSelectedTokens());
 };
+
+template <typename T>
+class FullDistTopPSamplingKernelTest : public SamplingKernelTest<T>
+{
+
+protected:
+    const int32_t endId = 0;
+    using SamplingKernelTest<T>::mSeed;
+    using SamplingKernelTest<T>::mStream;
+    using SamplingKernelTest<T>::mBufferManager;
+
+private:
+    size_t getWorkspaceSize(SamplingKernelTestParam const& params) override
+    {
+        return tensorrt_llm::kernels::getTopPWorkspaceSize<T>(params.batchSize, params.vocabSize);
+    }
+
+    void callTestedFunction(
+        SamplingKernelTestParam const& params, tensorrt_llm::runtime::ITensor::SharedPtr& workspaceDevice) override
+    {
+        auto const maxBatchSize = 2 * params.batchSize;
+
+        tk::TopPSamplingKernelParams<T> kernelParams;
+        kernelParams.probs = bufferCast<T>(*this->mProbsDevice);
+        kernelParams.outputIdsPtrs = bufferCast<int*>(*this->mIdsPtrHost);
+        kernelParams.workspace = workspaceDevice->data();
+        kernelParams.topPs = bufferCast<float>(*this->mTopPsDevice);
+        kernelParams.sequenceLength = bufferCast<int32_t>(*this->mSeqLengthsDevice);
+        kernelParams.endIds = bufferCast<int32_t>(*this->mEndIdsDevice);
+        kernelParams.batchSlots = bufferCast<int32_t>(*this->mBatchSlots);
+        kernelParams.finishedInput = reinterpret_cast<tensorrt_llm::kernels::FinishedState*>(
+            bufferCast<tensorrt_llm::kernels::FinishedState::UnderlyingType>(*this->mFinishedDevice));
+        kernelParams.finishedOutput = reinterpret_cast<tensorrt_llm::kernels::FinishedState*>(
+            bufferCast<tensorrt_llm::kernels::FinishedState::UnderlyingType>(*this->mFinishedDevice));
+        kernelParams.skipDecode = bufferCast<bool>(*this->mSkipDecodeDevice);
+        kernelParams.cumLogProbs = bufferCast<float>(*this->mCumLogProbsDevice);
+        kernelParams.outputLogProbs = bufferCast<float>(*this->mOutputLogProbsDevice);
+        kernelParams.curandState = reinterpret_cast<curandState_t*>(bufferCast<int8_t>(*this->mCurandStatesDevice));
+        kernelParams.batchSize = params.batchSize;
+        kernelParams.maxBatchSize = maxBatchSize;
+        kernelParams.vocabSizePadded = params.vocabSize;
+
+        // Perform batched sampling from the full distribution, equivalent to TopP with P == 1
+        tk::invokeBatchFullDistTopPSampling<T>(kernelParams, this->mStream->get());
+    }
+};
+
+TYPED_TEST_SUITE(FullDistTopPSamplingKernelTest, FloatAndHalfTypes);
+
+TYPED_TEST(FullDistTopPSamplingKernelTest, CorrectnessAncestral)
+{
+    this->runTest(SamplingKernelTestParam().setBatchSize(6).setVocabSize(4).setTopK(0).setTopP(1.0f));
+};
+
+TYPED_TEST(FullDistTopPSamplingKernelTest, CorrectnessLargeVocabAncestral)
+{
+    this->runTest(SamplingKernelTestParam().setBatchSize(32).setVocabSize(51200).setTopK(0).setTopP(1.0f));
+};
 } // end of namespace
@@ -415,6 +415,39 @@ public:
         verifyMaxSeqLenStopCriteriaResults(seed, batchSize, beamWidth);
     }
 
+    void runFusedMaxLengthCriteriaTest(SizeType32 seed, SizeType32 batchSize)
+    {
+        SizeType32 constexpr beamWidth = 1;
+        initData(seed, {}, 0, batchSize, beamWidth);
+
+        auto const maxBatchSize = 2 * batchSize;
+        mNewTokens = BufferManager::pinned(ITensor::makeShape({maxBatchSize}), nvinfer1::DataType::kINT32);
+
+        tk::invokeLengthCriterionWithTokenCopy(
+            reinterpret_cast<tk::FinishedState*>(bufferCast<tk::FinishedState::UnderlyingType>(*mFinished)),
+            bufferCast<SizeType32>(*mFinishedSum),
+            reinterpret_cast<SizeType32 const*>(bufferCast<SizeType32>(*mSequenceLengthLimits)),
+            bufferCast<SizeType32>(*mSequenceLengths), /* numNewTokens */ nullptr,
+            bufferCast<TokenIdType>(*mNewTokens),
+            reinterpret_cast<TokenIdType const**>(bufferCast<int64_t>(*mOutputIdsPtr)),
+            bufferCast<SizeType32>(*mBatchSlots), batchSize, mStream->get());
+
+        verifyMaxSeqLenStopCriteriaResults(seed, batchSize, beamWidth);
+
+        // The token at the (possibly clamped) sequence length must have been appended in the same launch.
+        auto sequenceLengthsPtr = bufferCast<SizeType32>(*mSequenceLengths);
+        auto batchSlotsPtr = bufferCast<SizeType32>(*mBatchSlots);
+        auto outputIdsData = bufferCast<TokenIdType>(*mOutputIds);
+        auto newTokensPtr = bufferCast<TokenIdType>(*mNewTokens);
+        for (SizeType32 batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+        {
+            auto const batchSlot = batchSlotsPtr[batchIdx];
+            auto const idx = tc::flat_index3(batchSlot, /* ri */ 0, sequenceLengthsPtr[batchSlot] - 1, beamWidth,
+                mMaxSeqLen);
+            EXPECT_EQ(newTokensPtr[batchSlot], outputIdsData[idx]) << " batchIdx: " << batchIdx << " seed: " << seed;
+        }
+    }
+
     void runExplicitEOSCriteriaTest(SizeType32 seed, SizeType32 batchSize)
     {
         initData(seed, {}, 0, batchSize, /* beamWidth */ 1);
@@ -447,6 +480,7 @@ protected:
     TensorPtr mStopWordsPtr;
     TensorPtr mStopWordsLen;
     TensorPtr mBatchSlots;
+    TensorPtr mNewTokens;
     TensorPtr mEndIds;
     TensorPtr mTokensPerStep;
     TensorPtr mInitTokensPerStep;
@@ -500,6 +534,26 @@ TEST_F(StopCriteriaKernelsTest, maxLengthCriteriaBS1024BW2Test)
     }
 }
 
+TEST_F(StopCriteriaKernelsTest, fusedMaxLengthCriteriaBS1Test)
+{
+    SizeType32 constexpr seeds = 64;
+    SizeType32 constexpr batchSize = 1;
+    for (SizeType32 seed = 0; seed < seeds; ++seed)
+    {
+        this->runFusedMaxLengthCriteriaTest(seed, batchSize);
+    }
+}
+
+TEST_F(StopCriteriaKernelsTest, fusedMaxLengthCriteriaBS1024Test)
+{
+    SizeType32 constexpr seeds = 64;
+    SizeType32 constexpr batchSize = 1024;
+    for (SizeType32 seed = 0; seed < seeds; ++seed)
+    {
+        this->runFusedMaxLengthCriteriaTest(seed, batchSize);
+    }
+}
+
 TEST_F(StopCriteriaKernelsTest, stopWordsCriteriaBS1SingleTokenSingleWordTest)
 {
     SizeType32 constexpr batchSize = 1;
@@ -171,4 +171,71 @@ TEST(LookaheadPoolManagerTest, fillAndUpdate)
     EXPECT_TRUE(isTensorEqString(*it, "abc"));
 }
 
+TEST(LookaheadPoolManagerTest, sharedCacheWarmStart)
+{
+    SizeType32 constexpr N{4};
+    SizeType32 constexpr G{5};
+    auto sharedCache = std::make_shared<LookaheadNgramCache>(LookaheadNgramCache::kDefaultMaxKeys, G);
+
+    // the first request fills the shared cache through its pool
+    LookaheadPoolManager pm0(G);
+    pm0.setSharedCache(sharedCache);
+    pm0.setup(G, N);
+    pm0.accept(initTensor("hello world; hello world."), N);
+    EXPECT_GT(sharedCache->size(), 0);
+
+    // a fresh pool without a shared cache knows nothing
+    LookaheadPoolManager pmCold(G);
+    pmCold.setup(G, N);
+    EXPECT_EQ(pmCold.guess('l', G).size(), 0);
+
+    // a fresh pool attached to the shared cache is warm-started from the first request
+    LookaheadPoolManager pm1(G);
+    pm1.setSharedCache(sharedCache);
+    pm1.setup(G, N);
+    auto list = pm1.guess('l', G);
+    // 'l' was followed by "lo ", "o w" and "d; " in the first request, the newest cached ngram comes first
+    ASSERT_EQ(list.size(), 3);
+    EXPECT_TRUE(isTensorEqString(*list.begin(), "o w"));
+
+    // local pool hits take precedence and cached duplicates are dropped
+    pm1.update(initTensor(std::string("l")), initTensor(std::string("ive"), ITensor::makeShape({1, 3})));
+    list = pm1.guess('l', G);
+    auto const numDistinct = list.size();
+    EXPECT_EQ(numDistinct, 4);
+    EXPECT_TRUE(isTensorEqString(*list.begin(), "ive"));
+    pm1.update(initTensor(std::string("l")), initTensor(std::string("o w"), ITensor::makeShape({1, 3})));
+    list = pm1.guess('l', G);
+    EXPECT_EQ(list.size(), numDistinct);
+}
+
+TEST(LookaheadNgramCacheTest, lruEviction)
+{
+    SizeType32 constexpr maxKeys{2};
+    SizeType32 constexpr maxNgramsPerKey{2};
+    LookaheadNgramCache cache(maxKeys, maxNgramsPerKey);
+
+    cache.insert('a', initTensor("123"));
+    cache.insert('b', initTensor("456"));
+    EXPECT_EQ(cache.size(), 2);
+
+    // touching 'a' makes 'b' the eviction candidate
+    EXPECT_EQ(cache.lookup('a', maxNgramsPerKey, 3).size(), 1);
+    cache.insert('c', initTensor("789"));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.lookup('b', maxNgramsPerKey, 3).size(), 0);
+    EXPECT_EQ(cache.lookup('a', maxNgramsPerKey, 3).size(), 1);
+
+    // per-key bound evicts the oldest ngram, re-inserting refreshes instead of duplicating
+    cache.insert('a', initTensor("456"));
+    cache.insert('a', initTensor("456"));
+    cache.insert('a', initTensor("789"));
+    auto list = cache.lookup('a', maxNgramsPerKey, 3);
+    ASSERT_EQ(list.size(), 2);
+    EXPECT_TRUE(isTensorEqString(*list.begin(), "789"));
+
+    // ngrams of a different length are filtered out
+    EXPECT_EQ(cache.lookup('a', maxNgramsPerKey, 4).size(), 0);
+}
+
 } // namespace tensorrt_llm::tests::layers
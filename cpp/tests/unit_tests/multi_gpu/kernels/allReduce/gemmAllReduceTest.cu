@@ -348,6 +348,7 @@ protected:
     // Only currently supported for FP4 GEMM
     static constexpr bool IsInputScalingNeeded = std::is_same_v<ElementSFA, cutlass::float_ue4m3_t>;
     static constexpr bool IsFP4 = std::is_same_v<ElementA, cutlass::float_e2m1_t>;
+    static constexpr bool IsFP8 = std::is_same_v<ElementA, cutlass::float_e4m3_t>;
 
     static bool isMultiGpu()
     {
@@ -435,6 +436,17 @@ protected:
 
         _alpha_vec.host_data()[0] = options.alpha;
         _alpha_vec.sync_device();
+
+        if constexpr (IsFP8)
+        {
+            // Rowwise dequant vectors: per-token scales [M] and per-channel scales [N]
+            _scale_M.resize(cutlass::make_Coord(M));
+            _scale_N.resize(cutlass::make_Coord(N));
+            initializeTensor(_scale_M.host_view(), options.seed + options.rank + 2025);
+            initializeTensor(_scale_N.host_view(), options.seed + options.rank + 2026);
+            _scale_M.sync_device();
+            _scale_N.sync_device();
+        }
     }
 
     void TearDown() override
@@ -587,9 +599,14 @@ protected:
     /**
      * Run each config to ensure each one passes numerical check.
      */
-    void run(cudaStream_t stream = NULL)
+    void run(cudaStream_t stream = NULL, bool rowwise_scale = false)
     {
         cutlass_kernels::GemmAllReduceImplInterface::ProblemArgs args = get_arguments();
+        if (rowwise_scale)
+        {
+            args.argAScale(_scale_M.device_data());
+            args.argBScale(_scale_N.device_data());
+        }
 
         Result result;
         result.passed = true;
@@ -603,7 +620,7 @@ protected:
             _gemm->run(args, stream);
             TLLM_CUDA_CHECK(cudaStreamSynchronize(stream));
 
-            bool passed = verify(stream);
+            bool passed = verify(stream, rowwise_scale);
             std::cout << launch_config.str() << std::endl;
             std::cout << "  Verify: " << (passed ? "Pass" : "Fail") << std::endl;
             result.passed &= passed;
@@ -708,7 +725,7 @@ private:
         return true;
     }
 
-    bool verify(cudaStream_t stream)
+    bool verify(cudaStream_t stream, bool rowwise_scale = false)
     {
         auto const M = options.M;
         auto const N = options.N;
@@ -756,11 +773,24 @@ private:
 
         epilogue_params.C = tensor_C;
         epilogue_params.D = tensor_D;
-        epilogue_params.alpha = options.alpha;
-        epilogue_params.beta = options.beta;
+        // Rowwise scaling replaces alpha/beta with per-token and per-channel dequant vectors
+        epilogue_params.alpha = rowwise_scale ? 1.f : options.alpha;
+        epilogue_params.beta = rowwise_scale ? 0.f : options.beta;
 
         // Run reference gemm
         cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
+        if (rowwise_scale)
+        {
+            for (int m = 0; m < M; ++m)
+            {
+                for (int n = 0; n < N; ++n)
+                {
+                    float const val = static_cast<float>(_D_ref.host_data()[m * N + n]);
+                    _D_ref.host_data()[m * N + n]
+                        = static_cast<ElementD>(val * _scale_M.host_data()[m] * _scale_N.host_data()[n]);
+                }
+            }
+        }
         // Reference is run on host, so copy results to device
         _D_ref.sync_device();
 
@@ -861,6 +891,8 @@ private:
     cutlass::HostTensor<ElementD, cutlass::layout::PackedVectorLayout> _D;
     cutlass::HostTensor<ElementD, cutlass::layout::PackedVectorLayout> _D_ref;
     cutlass::HostTensor<float, cutlass::layout::PackedVectorLayout> _alpha_vec;
+    cutlass::HostTensor<float, cutlass::layout::PackedVectorLayout> _scale_M;
+    cutlass::HostTensor<float, cutlass::layout::PackedVectorLayout> _scale_N;
     // Requires conditional because cannot have HostTensor with type void
     // which is the case when we have no scale-factors.
     typename std::conditional<IsInputScalingNeeded,
@@ -902,6 +934,27 @@ TYPED_TEST(GemmAllReduceFixture, RunnerTest)
     cudaStreamDestroy(stream);
 }
 
+TYPED_TEST(GemmAllReduceFixture, RunnerRowwiseScaleTest)
+{
+    if (!TestFixture::IsFP8)
+    {
+        GTEST_SKIP() << "Rowwise scaling requires FP8 inputs";
+    }
+    if (getSMVersion() != 90)
+    {
+        GTEST_SKIP() << "Rowwise scaling only supported on Sm90";
+    }
+    if (!options.verify)
+    {
+        TLLM_LOG_WARNING("Skipping verify - return success");
+        return;
+    }
+    cudaStream_t stream;
+    cudaStreamCreate(&stream);
+    this->run(stream, /*rowwise_scale=*/true);
+    cudaStreamDestroy(stream);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
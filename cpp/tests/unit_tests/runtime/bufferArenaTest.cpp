@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022-2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/common/cudaUtils.h"
+#include "tensorrt_llm/runtime/bufferArena.h"
+#include "tensorrt_llm/runtime/bufferManager.h"
+
+#include <memory>
+
+using namespace tensorrt_llm::runtime;
+namespace tc = tensorrt_llm::common;
+
+class BufferArenaTest : public ::testing::Test // NOLINT(cppcoreguidelines-pro-type-member-init)
+{
+protected:
+    void SetUp() override
+    {
+        mDeviceCount = tc::getDeviceCount();
+        if (mDeviceCount > 0)
+        {
+            mBufferManager = std::make_unique<BufferManager>(std::make_unique<CudaStream>());
+        }
+        else
+        {
+            GTEST_SKIP() << "This test suite cannot run on systems with no devices.";
+        }
+    }
+
+    void TearDown() override {}
+
+    int mDeviceCount;
+    std::unique_ptr<BufferManager> mBufferManager = nullptr;
+};
+
+TEST_F(BufferArenaTest, AllocateAndReset)
+{
+    auto const shape = ITensor::makeShape({16, 32});
+    BufferArena arena;
+
+    // The first iteration warms up the high-water mark and falls back to the buffer manager.
+    auto tensor = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    ASSERT_NE(tensor, nullptr);
+    EXPECT_EQ(tensor->getMemoryType(), MemoryType::kGPU);
+    EXPECT_TRUE(ITensor::shapeEquals(tensor->getShape(), shape));
+
+    // After a reset the slab covers the previous demand, so allocations are served in place.
+    arena.reset();
+    tensor = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    ASSERT_NE(tensor, nullptr);
+    auto const* const slabData = tensor->data();
+
+    arena.reset();
+    tensor = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    ASSERT_NE(tensor, nullptr);
+    EXPECT_EQ(tensor->data(), slabData);
+    EXPECT_EQ(tensor->getMemoryType(), MemoryType::kGPU);
+
+    // Requests beyond the slab capacity fall back to the buffer manager and grow the slab on reset.
+    auto overflow = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    ASSERT_NE(overflow, nullptr);
+    EXPECT_NE(overflow->data(), tensor->data());
+    EXPECT_TRUE(ITensor::shapeEquals(overflow->getShape(), shape));
+
+    arena.reset();
+    auto first = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    auto second = arena.allocate(*mBufferManager, shape, nvinfer1::DataType::kFLOAT);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_NE(first->data(), second->data());
+}
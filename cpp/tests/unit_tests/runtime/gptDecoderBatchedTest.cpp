@@ -110,7 +110,7 @@ void newRequests(std::vector<std::shared_ptr<tb::LlmRequest>> const& requests, T
 
     tb::CreateNewDecoderRequests createNewDecoderRequests(false, false, false);
     auto [lookaheadPrompt, lookaheadAlgoConfigs]
-        = createNewDecoderRequests.createDecoderRequests(requests, inputBuffers.inputsIds, decodingConfig, decoderState,
+        = createNewDecoderRequests.createDecoderRequests(requests, inputBuffers, decodingConfig, decoderState,
             logitsType, modelConfig, worldConfig, runtimeStream, decoderStream, maxSequenceLength, std::nullopt);
 
     std::vector<SamplingConfig> samplingConfigs;
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "tensorrt_llm/runtime/memoryProfiler.h"
+#include "tensorrt_llm/runtime/tllmBuffers.h"
+
+#include <string>
+
+using namespace tensorrt_llm::runtime;
+
+TEST(MemoryProfilerTest, DisabledRecordsNothing)
+{
+    auto& profiler = MemoryProfiler::getInstance();
+    MemoryProfiler::setEnabled(false);
+    profiler.reset();
+
+    HostAllocator allocator;
+    auto constexpr size = std::size_t{1024};
+    auto* ptr = allocator.allocate(size);
+    allocator.deallocate(ptr, size);
+
+    auto const profile = profiler.toPprofProfile();
+    EXPECT_EQ(profile.rfind("heap profile: 0: 0 [0: 0]", 0), 0) << profile;
+}
+
+TEST(MemoryProfilerTest, AttributesHostAllocationsToSites)
+{
+    auto& profiler = MemoryProfiler::getInstance();
+    profiler.reset();
+    MemoryProfiler::setEnabled(true);
+
+    HostAllocator allocator;
+    auto constexpr size = std::size_t{1 << 20};
+    auto* ptr = allocator.allocate(size);
+
+    auto profile = profiler.toPprofProfile(MemoryType::kCPU);
+    auto const sizeStr = std::to_string(size);
+    EXPECT_EQ(profile.rfind("heap profile: 1: " + sizeStr + " [1: " + sizeStr + "]", 0), 0) << profile;
+
+    allocator.deallocate(ptr, size);
+
+    // The site stays in the profile with zero in-use bytes and its cumulative attribution.
+    profile = profiler.toPprofProfile(MemoryType::kCPU);
+    EXPECT_EQ(profile.rfind("heap profile: 0: 0 [1: " + sizeStr + "]", 0), 0) << profile;
+    EXPECT_NE(profile.find("0: 0 [1: " + sizeStr + "] @"), std::string::npos) << profile;
+
+    MemoryProfiler::setEnabled(false);
+    profiler.reset();
+}
+
+TEST(MemoryProfilerTest, SeparatesMemoryTypes)
+{
+    auto& profiler = MemoryProfiler::getInstance();
+    profiler.reset();
+    MemoryProfiler::setEnabled(true);
+
+    HostAllocator allocator;
+    auto constexpr size = std::size_t{4096};
+    auto* ptr = allocator.allocate(size);
+
+    // Host allocations must not show up under a pinned-only filter.
+    auto const pinnedProfile = profiler.toPprofProfile(MemoryType::kPINNED);
+    EXPECT_EQ(pinnedProfile.rfind("heap profile: 0: 0 [0: 0]", 0), 0) << pinnedProfile;
+
+    allocator.deallocate(ptr, size);
+    MemoryProfiler::setEnabled(false);
+    profiler.reset();
+}
@@ -18,8 +18,11 @@
 
 #include <cstdlib>
 
+#include <unistd.h>
+
 #include "tensorrt_llm/common/cudaUtils.h"
 #include "tensorrt_llm/kernels/moeLoadBalance/moeLoadBalanceKernels.h"
+#include "tensorrt_llm/runtime/moeLoadBalancer/moeExpertTier.h"
 #include "tensorrt_llm/runtime/moeLoadBalancer/moeLoadBalancer.h"
 
 using namespace tensorrt_llm::runtime;
@@ -198,6 +201,23 @@ TEST_P(MoePlacementTest, VerifyPlacement)
             << "Expert " << i << " should be assigned to exactly replicaCounts[" << i << "] slots";
     }
 
+    // Verify replicas of the same expert are placed on distinct ranks whenever that is feasible
+    // (co-located replicas serve the same traffic and waste the redundant slot)
+    for (int rankId = 0; rankId < param.epSize; rankId++)
+    {
+        std::set<int> hostedExperts;
+        for (int slotId = 0; slotId < param.slotCountPerRank; slotId++)
+        {
+            int expertId = cpuPlacement.rankExpertIds[rankId][slotId];
+            if (param.replicaCounts[expertId] <= param.epSize)
+            {
+                EXPECT_EQ(hostedExperts.count(expertId), 0u)
+                    << "Rank " << rankId << " hosts multiple replicas of expert " << expertId;
+            }
+            hostedExperts.insert(expertId);
+        }
+    }
+
     // Test load balancing property: ranks should have roughly equal total load
     std::vector<double> rankLoads(param.epSize, 0.0);
     for (int rankId = 0; rankId < param.epSize; rankId++)
@@ -278,7 +298,16 @@ INSTANTIATE_TEST_SUITE_P(PlacementTests, MoePlacementTest,
             {2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f}, // expertLoadFactors
             {1, 1, 1, 1, 1, 1},                   // replicaCounts - one replica per expert
             1.0,                                  // maxExpectedLoadDiff
-            "One replica per expert"}),
+            "One replica per expert"},
+
+        // Test case 6: Hot expert replicated across all ranks; replicas must land on distinct ranks
+        PlacementTestParam{5,                // expertCount
+            2,                               // slotCountPerRank
+            4,                               // epSize
+            {20.0f, 1.0f, 1.0f, 1.0f, 1.0f}, // expertLoadFactors - one dominating expert
+            {4, 1, 1, 1, 1},                 // replicaCounts - hot expert cloned to every rank
+            1.0,                             // maxExpectedLoadDiff
+            "Hot expert replicated"}),
     [](::testing::TestParamInfo<PlacementTestParam> const& info)
     {
         // Generate readable test names based on the description
@@ -291,6 +320,76 @@ INSTANTIATE_TEST_SUITE_P(PlacementTests, MoePlacementTest,
         return name;
     });
 
+// Unit test for the expert tier manager: cold weights come from a file mapping and the
+// warm set follows the decayed routing statistics.
+TEST(MoeExpertTierTest, MapAndRetier)
+{
+    int constexpr expertCount = 4;
+    size_t constexpr height = 4;
+    size_t constexpr width = 64;
+
+    // Write one recognizable weight per expert into a temporary "NVMe" file.
+    char fileNameTemplate[] = "/tmp/moeExpertTierTestXXXXXX";
+    int fd = mkstemp(fileNameTemplate);
+    ASSERT_GE(fd, 0);
+    std::vector<char> fileData(expertCount * height * width);
+    for (int expertId = 0; expertId < expertCount; ++expertId)
+    {
+        std::fill_n(fileData.data() + expertId * height * width, height * width, static_cast<char>('A' + expertId));
+    }
+    ASSERT_EQ(write(fd, fileData.data(), fileData.size()), static_cast<ssize_t>(fileData.size()));
+    close(fd);
+
+    {
+        tensorrt_llm::kernels::MoeLoadBalanceMetaInfo metaInfo{expertCount, 2, 0, 1, 2};
+        MoeExpertTierManager tierManager(metaInfo, /*warmExpertCount=*/2);
+
+        std::vector<MoeWeight> mappedWeights;
+        for (int expertId = 0; expertId < expertCount; ++expertId)
+        {
+            mappedWeights.push_back(tierManager.mapColdWeight(
+                expertId, fileNameTemplate, expertId * height * width, height, width, width));
+        }
+
+        // Mapped weights expose the file bytes, including at unaligned file offsets.
+        for (int expertId = 0; expertId < expertCount; ++expertId)
+        {
+            EXPECT_EQ(mappedWeights[expertId].mHeight, height);
+            EXPECT_EQ(mappedWeights[expertId].mWidth, width);
+            char const* weightData = static_cast<char const*>(mappedWeights[expertId].mWeightPtr);
+            EXPECT_EQ(weightData[0], 'A' + expertId);
+            EXPECT_EQ(weightData[height * width - 1], 'A' + expertId);
+        }
+
+        // Everything starts warm; the first statistics keep the two hottest experts warm.
+        for (int expertId = 0; expertId < expertCount; ++expertId)
+        {
+            EXPECT_TRUE(tierManager.isExpertWarm(expertId));
+        }
+        std::vector<float> loadFactor = {1.0f, 8.0f, 4.0f, 2.0f};
+        tierManager.updateTiers(loadFactor.data());
+        EXPECT_FALSE(tierManager.isExpertWarm(0));
+        EXPECT_TRUE(tierManager.isExpertWarm(1));
+        EXPECT_TRUE(tierManager.isExpertWarm(2));
+        EXPECT_FALSE(tierManager.isExpertWarm(3));
+
+        // A sustained load shift promotes expert 0 and demotes expert 2, and a demoted
+        // expert's weight stays readable (repaged from the file).
+        loadFactor = {16.0f, 8.0f, 0.0f, 0.0f};
+        for (int iter = 0; iter < 3; ++iter)
+        {
+            tierManager.updateTiers(loadFactor.data());
+        }
+        EXPECT_TRUE(tierManager.isExpertWarm(0));
+        EXPECT_TRUE(tierManager.isExpertWarm(1));
+        EXPECT_FALSE(tierManager.isExpertWarm(2));
+        EXPECT_FALSE(tierManager.isExpertWarm(3));
+        EXPECT_EQ(static_cast<char const*>(mappedWeights[2].mWeightPtr)[0], 'C');
+    }
+
+    unlink(fileNameTemplate);
+}
+
 // Iteration control parameter structure
 struct IterConfig
 {
@@ -539,6 +539,38 @@ TEST_F(TllmBuffersTest, PinnedPoolAllocator)
     }
 }
 
+TEST_F(TllmBuffersTest, PinnedCachingAllocator)
+{
+    if (mDeviceCount == 0)
+    {
+        GTEST_SKIP() << noDeviceSkipReason;
+    }
+
+    PinnedCachingAllocator allocator{};
+    auto constexpr size = 1000;
+    auto* const ptr = allocator.allocate(size);
+    EXPECT_NE(ptr, nullptr);
+    EXPECT_NO_THROW(allocator.deallocate(ptr, size));
+
+    // Blocks are recycled through the per-thread size-class cache, so a request of the same class gets
+    // the same block back without going through the pool.
+    auto constexpr sameClassSize = 600; // rounds up to the same 1024 B class as size
+    auto* const recycled = allocator.allocate(sameClassSize);
+    EXPECT_EQ(recycled, ptr);
+    EXPECT_NO_THROW(allocator.deallocate(recycled, sameClassSize));
+
+    // A different size class gets a different block.
+    auto* const larger = allocator.allocate(2 * size);
+    EXPECT_NE(larger, ptr);
+    EXPECT_NO_THROW(allocator.deallocate(larger, 2 * size));
+
+    // Requests above the cached block size go to the pool directly.
+    auto constexpr uncachedSize = PinnedCachingAllocator::kMaxCachedBlockSize + 1;
+    auto* const uncached = allocator.allocate(uncachedSize);
+    EXPECT_NE(uncached, nullptr);
+    EXPECT_NO_THROW(allocator.deallocate(uncached, uncachedSize));
+}
+
 TEST_F(TllmBuffersTest, MemoryPool)
 {
     using MemPool = MemoryPool<HostAllocator>;
@@ -151,3 +151,33 @@ TEST_F(TorchTest, Resize)
         EXPECT_EQ(tensorView->getSize(), size * 2);
     }
 }
+
+TEST_F(TorchTest, AliasOrCopy)
+{
+    auto devices = {at::Device{at::kCUDA, 0}, at::Device{at::kCPU}};
+    for (auto device : devices)
+    {
+        auto tensorAten = at::randn({4, 6}).to(device);
+
+        // A contiguous tensor is shared by reference across the boundary.
+        EXPECT_TRUE(TorchView::isAliasable(tensorAten));
+        auto aliasView = TorchView::aliasOrCopy(tensorAten, "torchTest");
+        EXPECT_EQ(aliasView->data(), tensorAten.data_ptr());
+
+        // A leading-dim slice stays dense and must alias as well.
+        auto slice = tensorAten.slice(0, 1, 3);
+        EXPECT_TRUE(TorchView::isAliasable(slice));
+        auto sliceView = TorchView::aliasOrCopy(slice, "torchTest");
+        EXPECT_EQ(sliceView->data(), slice.data_ptr());
+
+        // A transposed tensor cannot alias a dense row-major ITensor; the bridge materializes a
+        // copy and the strict factory rejects it.
+        auto transposed = tensorAten.t();
+        EXPECT_FALSE(TorchView::isAliasable(transposed));
+        EXPECT_THROW(TorchView::of(transposed), tc::TllmException);
+        auto copyView = TorchView::aliasOrCopy(transposed, "torchTest");
+        EXPECT_NE(copyView->data(), tensorAten.data_ptr());
+        EXPECT_EQ(copyView->getSize(), tensorAten.numel());
+        EXPECT_EQ(TorchUtils::shape(copyView->getShape()), transposed.sizes());
+    }
+}
@@ -189,6 +189,62 @@ TEST_F(VirtualMemoryTest, TestBasic)
     }
 }
 
+// Test GrowableDeviceBuffer maps and unmaps physical memory while keeping the prefix content
+TEST_F(VirtualMemoryTest, TestGrowableDeviceBuffer)
+{
+    std::size_t constexpr chunkSize = 64 * 1024 * 1024;
+    std::size_t constexpr capacity = 4 * chunkSize;
+
+    GrowableDeviceBuffer buffer(capacity, chunkSize, 0);
+    ASSERT_GE(buffer.chunkSize(), chunkSize);
+    ASSERT_GE(buffer.capacity(), capacity);
+    ASSERT_EQ(buffer.size(), 0);
+
+    auto const address = reinterpret_cast<CUdeviceptr>(buffer.data());
+    auto const memoryBegin = getCurrentProcessMemoryInfo();
+
+    // Growing by a single byte maps a full chunk.
+    ASSERT_EQ(buffer.grow(1), buffer.chunkSize());
+    if (memoryInfoAvailable())
+    {
+        ASSERT_EQ(memoryBegin + buffer.chunkSize(), getCurrentProcessMemoryInfo());
+    }
+
+    ASSERT_EQ(buffer.grow(buffer.capacity()), buffer.capacity());
+    auto result = cuMemsetD8_v2(address, 255, buffer.size());
+    ASSERT_EQ(result, CUDA_SUCCESS) << "Accessing grown memory returned failure";
+    TLLM_CU_CHECK(cuStreamSynchronize(nullptr));
+
+    // Shrinking unmaps the tail chunks and keeps the prefix content.
+    std::vector<uint8_t> pattern(buffer.chunkSize());
+    for (std::size_t i = 0; i < pattern.size(); ++i)
+    {
+        pattern[i] = static_cast<uint8_t>(i * 13);
+    }
+    TLLM_CU_CHECK(cuMemcpyHtoD_v2(address, pattern.data(), pattern.size()));
+    ASSERT_EQ(buffer.shrink(1), buffer.chunkSize());
+    if (memoryInfoAvailable())
+    {
+        ASSERT_EQ(memoryBegin + buffer.chunkSize(), getCurrentProcessMemoryInfo());
+    }
+
+    std::vector<uint8_t> readback(buffer.chunkSize());
+    TLLM_CU_CHECK(cuMemcpyDtoH_v2(readback.data(), address, readback.size()));
+    ASSERT_EQ(readback, pattern) << "shrink corrupted the remaining prefix";
+
+    ASSERT_EQ(buffer.shrink(0), 0);
+    if (memoryInfoAvailable())
+    {
+        ASSERT_EQ(memoryBegin, getCurrentProcessMemoryInfo()) << "shrink does not release memory";
+    }
+
+    // The range can be regrown after a full shrink.
+    ASSERT_EQ(buffer.grow(buffer.capacity()), buffer.capacity());
+    result = cuMemsetD8_v2(address, 0, buffer.size());
+    ASSERT_EQ(result, CUDA_SUCCESS) << "Accessing regrown memory returned failure";
+    TLLM_CU_CHECK(cuStreamSynchronize(nullptr));
+}
+
 // Test BackedConfigurator refills memory correctly for both CPU and PINNED memory types
 class VirtualMemoryOffloadConfigurator : public VirtualMemoryTest, public ::testing::WithParamInterface<MemoryType>
 {
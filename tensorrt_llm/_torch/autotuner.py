@@ -216,12 +216,14 @@ def autotune(tune_mode: bool = True, cache_path: str = None, rank: int = 0):
         cache_path_no_ext_rank = cache_path_no_ext + f".rank{rank}.json"
         # if the rank-specific file exists, load it
         file_exists = os.path.exists(cache_path_no_ext_rank)
-        # if the rank-specific file exists, do not enable tuning mode
-        tune_required = tune_required and not os.path.exists(cache_path)
         if file_exists:
             logger.info(
                 f"[Autotuner] Loading cache from {cache_path_no_ext_rank}")
-            AutoTuner.get().profiling_cache.load_cache(cache_path_no_ext_rank)
+            cache_valid = AutoTuner.get().profiling_cache.load_cache(
+                cache_path_no_ext_rank)
+            # only skip tuning when a cache recorded with the same library
+            # version and GPU was loaded; a stale cache is ignored and re-tuned
+            tune_required = tune_required and not cache_valid
 
     # record the old tuning mode
     old_mode = AutoTuner.get().is_tuning_mode
@@ -404,19 +406,25 @@ class AutoTunerProfilingCache:
             logger.error(f"[AutoTuner] Failed to save cache with JSON: {e}")
             raise
 
-    def load_cache(self, file_path: Union[str, Path]) -> None:
+    def load_cache(self, file_path: Union[str, Path]) -> bool:
         """Load the profiling cache from disk in JSON format.
 
         Args:
             file_path: Path to the cache file
 
+        Returns:
+            True if a cache recorded on the same library version and GPU was
+            loaded, False if the cache was stale and ignored.
+
         Raises:
             FileNotFoundError: If cache file doesn't exist
             IOError: If file cannot be read
 
         Note:
             Loading will replace the current cache contents. The cache is loaded
-            from JSON format.
+            from JSON format. Runner and tactic indices are only meaningful for
+            the library version and GPU that produced them, so a cache recorded
+            elsewhere is rejected rather than applied.
         """
         file_path = Path(file_path)
         if not file_path.exists():
@@ -425,14 +433,31 @@ class AutoTunerProfilingCache:
         try:
             with open(file_path, 'r') as f:
                 serializable_cache = json.load(f)
+            metadata = serializable_cache.get("metadata", {})
+            if not self._validate_metadata(metadata):
+                logger.warning(
+                    f"[AutoTuner] Ignoring cache {file_path}: recorded with "
+                    f"lib_version={metadata.get('lib_version')} on "
+                    f"{metadata.get('device_name')}, but running "
+                    f"lib_version={tensorrt_llm.__version__} on "
+                    f"{torch.cuda.get_device_name()}. Re-tuning.")
+                return False
             self.cache = self._deserialize_cache_from_json(serializable_cache)
             logger.info(
                 f"[AutoTuner] Successfully loaded cache from {file_path} using JSON format"
             )
+            return True
         except Exception as e:
             logger.error(f"[AutoTuner] Failed to load cache with JSON: {e}")
             raise
 
+    def _validate_metadata(self, metadata: Dict[str, Any]) -> bool:
+        """Check that a cache file was recorded in an environment whose tactics are still valid here."""
+        return (metadata.get("lib_version") == tensorrt_llm.__version__
+                and metadata.get("device_name") == torch.cuda.get_device_name()
+                and tuple(metadata.get("device_capability", ()))
+                == torch.cuda.get_device_capability())
+
     def _serialize_cache_to_json(self) -> Dict[str, Any]:
         """Convert the profiling cache to a JSON-serializable format.
 
@@ -28,7 +28,7 @@ def register_ar_residual_norm(custom_pass: PatternMatcherPass):
         torch.ops.trtllm.allreduce.default, KeywordArg("input"), None, None,
         None, None, KeywordArg("workspace"), mapping.tp_group,
         KeywordArg("strategy"), int(AllReduceFusionOp.NONE), Ignored(),
-        KeywordArg("trigger_completion_at_end"))
+        KeywordArg("trigger_completion_at_end"), Ignored())
     getitem_x = CallFunction(getitem, trtllm_allreduce_default, 0)
     add_Tensor = CallFunction(aten.add.Tensor,
                               getitem_x,
@@ -139,6 +139,7 @@ def register_ar_residual_norm_out_fp8_quant(custom_pass: PatternMatcherPass):
                                      int(AllReduceFusionOp.RESIDUAL_RMS_NORM),
                                      KeywordArg("eps"),
                                      KeywordArg("trigger_completion_at_end"),
+                                     Ignored(),
                                      _users=2)
     getitem_0 = CallFunction(getitem, allreduce_default, 0, _users=2)
     getitem_1 = CallFunction(getitem, allreduce_default, 1)
@@ -222,6 +223,7 @@ def register_ar_residual_norm_fp8_quant(custom_pass: PatternMatcherPass):
                                      int(AllReduceFusionOp.RESIDUAL_RMS_NORM),
                                      KeywordArg("eps"),
                                      KeywordArg("trigger_completion_at_end"),
+                                     Ignored(),
                                      _users=2)
     getitem_0 = CallFunction(getitem, allreduce_default, 0)
     getitem_1 = CallFunction(getitem, allreduce_default, 1)
@@ -304,6 +306,7 @@ def register_ar_residual_norm_out_fp4_quant(custom_pass: PatternMatcherPass):
                                      int(AllReduceFusionOp.RESIDUAL_RMS_NORM),
                                      KeywordArg("eps"),
                                      KeywordArg("trigger_completion_at_end"),
+                                     Ignored(),
                                      _users=2)
     getitem_0 = CallFunction(getitem, allreduce_default, 0, _users=2)
     getitem_1 = CallFunction(getitem, allreduce_default, 1)
@@ -382,6 +385,7 @@ def register_ar_residual_norm_fp4_quant(custom_pass: PatternMatcherPass):
                                      int(AllReduceFusionOp.RESIDUAL_RMS_NORM),
                                      KeywordArg("eps"),
                                      KeywordArg("trigger_completion_at_end"),
+                                     Ignored(),
                                      _users=2)
     getitem_0 = CallFunction(getitem, allreduce_default, 0)
     getitem_1 = CallFunction(getitem, allreduce_default, 1)
@@ -452,7 +456,7 @@ def register_ub_patterns(custom_passes: List[PatternMatcherPass]):
             torch.ops.trtllm.allreduce.default, input_node,
             KeywordArg('residual_in'), KeywordArg('gamma'), KeywordArg('scale'),
             None, Ignored(), mapping.tp_group, strategy, fusion,
-            KeywordArg('eps'), Ignored())
+            KeywordArg('eps'), Ignored(), Ignored())
 
         def empty_convert_supported_ar_to_ub(
             input: torch.Tensor,
@@ -671,7 +675,7 @@ def register_ub_patterns(custom_passes: List[PatternMatcherPass]):
             trtllm_userbuffers_allreduce_finalize_default, KeywordArg("gamma"),
             KeywordArg("scale"), Ignored(), Ignored(), mapping.tp_group,
             int(AllReduceStrategy.UB), KeywordArg("fusion_op"),
-            KeywordArg("eps"), Ignored())
+            KeywordArg("eps"), Ignored(), Ignored())
 
         def empty_finalize_pattern(
             input: torch.Tensor,
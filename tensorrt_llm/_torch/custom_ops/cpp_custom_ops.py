@@ -22,6 +22,7 @@ def _register_fake():
         op,
         eps,
         trigger_completion_at_end,
+        error_feedback=None,
     ):
         from tensorrt_llm.functional import AllReduceFusionOp
         if op == int(AllReduceFusionOp.NONE):
@@ -70,9 +71,11 @@ def _register_fake():
         op,
         eps,
         trigger_completion_at_end,
+        error_feedback=None,
     ):
         return allreduce(input, residual, norm_weight, scale, bias, workspace,
-                         group, strategy, op, eps, trigger_completion_at_end)
+                         group, strategy, op, eps, trigger_completion_at_end,
+                         error_feedback)
 
     #MNNVL Allreduce
     @torch.library.register_fake("trtllm::mnnvl_twoshot_allreduce")
@@ -372,6 +375,19 @@ def _register_fake():
                                 dtype=torch.float8_e4m3fn), input.new_empty(
                                     sz, dtype=torch.float)
 
+    @torch.library.register_fake("trtllm::silu_and_mul_quantize_1x128")
+    def _(input: torch.Tensor):
+        out_n = input.shape[1] // 2
+        pad_m = fp4_utils.pad_up(input.shape[0], 4)
+        blocked_n = (out_n + 127) // 128
+        if get_sm_version() >= 100:
+            sz = (blocked_n, input.shape[0])
+        else:
+            sz = (fp4_utils.pad_up(pad_m * blocked_n * 4, 128) // 4, )
+        return input.new_empty(
+            (input.shape[0], out_n),
+            dtype=torch.float8_e4m3fn), input.new_empty(sz, dtype=torch.float)
+
     @torch.library.register_fake("trtllm::causal_conv1d_fwd")
     def _(
         x: torch.Tensor,
@@ -551,6 +567,36 @@ def _register_fake():
             sz, dtype=torch.int32), router_logits.new_empty(sz,
                                                             dtype=output_dtype)
 
+    @torch.library.register_fake("trtllm::renorm_moe_routing_statistic_op")
+    def _(router_logits,
+          enabled,
+          topk,
+          single_layer_load_balancer_ptr,
+          is_first_stage,
+          is_last_stage,
+          output_dtype: torch.dtype = None):
+        num_tokens = router_logits.shape[0]
+        sz = (num_tokens, topk)
+        output_dtype = output_dtype or torch.float32
+        return router_logits.new_empty(
+            sz, dtype=torch.int32), router_logits.new_empty(sz,
+                                                            dtype=output_dtype)
+
+    @torch.library.register_fake("trtllm::default_moe_routing_statistic_op")
+    def _(router_logits,
+          enabled,
+          topk,
+          single_layer_load_balancer_ptr,
+          is_first_stage,
+          is_last_stage,
+          output_dtype: torch.dtype = None):
+        num_tokens = router_logits.shape[0]
+        sz = (num_tokens, topk)
+        output_dtype = output_dtype or torch.float32
+        return router_logits.new_empty(
+            sz, dtype=torch.int32), router_logits.new_empty(sz,
+                                                            dtype=output_dtype)
+
     @torch.library.register_fake("trtllm::alltoall_helix")
     def _(input_list, group, num_lists):
         num_ranks = len(group)
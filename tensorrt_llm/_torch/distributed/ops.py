@@ -504,6 +504,13 @@ class AllReduce(nn.Module):
         self.mnnvl_allreduce = None
         self._disable_mpi = mpi_disabled()
 
+        # Opt-in error-feedback compensation for the LOWPRECISION strategy: the quantization error of
+        # each call is carried in a per-layer buffer and added back on the next call to bound drift.
+        self.enable_error_feedback = (
+            strategy == AllReduceStrategy.LOWPRECISION and os.environ.get(
+                "TRTLLM_LOWPRECISION_ERROR_FEEDBACK", "0") == "1")
+        self._error_feedback = None
+
         self.all_reduce_op = torch.ops.trtllm.allreduce_pg if self._disable_mpi else torch.ops.trtllm.allreduce
 
         if self.mapping.tp_size > 1:
@@ -590,6 +597,13 @@ class AllReduce(nn.Module):
             allreduce_strategy = AllReduceStrategy.AUTO
 
         additional_args = {}
+        if self.enable_error_feedback:
+            if self._error_feedback is None or self._error_feedback.numel(
+            ) != input.numel():
+                # The error buffer must line up with the input element by element; when the token count
+                # changes, the carried error no longer applies and is dropped.
+                self._error_feedback = torch.zeros_like(input)
+            additional_args["error_feedback"] = self._error_feedback
         if self._disable_mpi:
             pg = self.mapping.tp_group_pg
             assert pg is not None, "TP ProcessGroup not initialised"
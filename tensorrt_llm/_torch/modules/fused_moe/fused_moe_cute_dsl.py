@@ -2,7 +2,6 @@ import math
 from typing import Dict, List, Optional, Union
 
 import torch
-import torch.nn.functional as F
 
 from tensorrt_llm._utils import is_sm_100f
 
@@ -13,11 +12,6 @@ from .quantization import MoEWeightLoadingMode
 from .routing import BaseMoeRoutingMethod
 
 
-def swiglu_fused_moe(x):
-    x, gate = x.chunk(2, dim=-1)
-    return F.silu(gate) * x
-
-
 def cute_dsl_fp8_group_blockwise_gemm_ref(
     a: torch.Tensor,
     b: torch.Tensor,
@@ -217,8 +211,11 @@ class CuteDslFusedMoE(CutlassFusedMoE):
             b_sf=self.quant_scales[0],
             offset_array=expert_first_token_offset_tensor,
         )
-        h2 = swiglu_fused_moe(h1)
-        act_input_fp8, act_input_sf = torch.ops.trtllm.fp8_quantize_1x128(h2)
+        # Fused SwiGLU + quantize: h1 holds [linear, gate] halves in torch chunk
+        # order and is the top-k expanded tensor, so one pass saves the largest
+        # interstage read/write.
+        act_input_fp8, act_input_sf = torch.ops.trtllm.silu_and_mul_quantize_1x128(
+            h1)
         h3 = cute_dsl_fp8_group_blockwise_gemm_ref(
             a=act_input_fp8,
             b=self.w2_weight.view(weight_dtype),
@@ -615,19 +615,27 @@ class FP8BlockScalesLinearMethod(LinearMethodBase):
 
     def apply(self, module: Linear, input: torch.Tensor,
               bias: Optional[torch.Tensor]):
-        if input.dtype == torch.float8_e4m3fn:
-            input = input.to(torch.bfloat16) * module.input_scale
-        assert input.dtype == torch.bfloat16
+
+        def quantize_1x128(input: torch.Tensor):
+            if input.dtype == torch.float8_e4m3fn:
+                # Per-tensor FP8 input (fused FP8 attention output): dequantize and requantize
+                # per 1x128 block in one pass instead of materializing a BF16 copy.
+                return torch.ops.trtllm.fp8_dequant_quantize_1x128(
+                    input, module.input_scale)
+            assert input.dtype == torch.bfloat16
+            return torch.ops.trtllm.fp8_quantize_1x128(input)
 
         if is_sm_100f():
             if module.use_cute_dsl_blockscaling_mm or module.disable_deep_gemm:
                 # TODO (@lmin): replace with cute_dsl gemm
-                act_input_fp8, act_input_sf = torch.ops.trtllm.fp8_quantize_1x128(
-                    input)
+                act_input_fp8, act_input_sf = quantize_1x128(input)
                 output = torch.ops.trtllm.fp8_block_scaling_gemm(
                     act_input_fp8, module.weight, act_input_sf,
                     module.weight_scale)
             else:
+                if input.dtype == torch.float8_e4m3fn:
+                    input = input.to(torch.bfloat16) * module.input_scale
+                assert input.dtype == torch.bfloat16
                 output = torch.ops.trtllm.fp8_swap_ab_gemm(
                     input,
                     module.weight,
@@ -635,8 +643,7 @@ class FP8BlockScalesLinearMethod(LinearMethodBase):
                     disable_ue8m0_cast=True,
                 )
         else:
-            act_input_fp8, act_input_sf = torch.ops.trtllm.fp8_quantize_1x128(
-                input)
+            act_input_fp8, act_input_sf = quantize_1x128(input)
             output = torch.ops.trtllm.fp8_block_scaling_gemm(
                 act_input_fp8, module.weight, act_input_sf, module.weight_scale)
 
@@ -19,6 +19,7 @@ import torch
 from einops import rearrange, repeat
 from torch import nn
 
+from tensorrt_llm._torch.modules.mamba import PAD_SLOT_ID
 from tensorrt_llm._torch.modules.mamba.mamba2_metadata import Mamba2Metadata
 
 from ...attention_backend import AttentionMetadata
@@ -254,7 +255,28 @@ class Mamba2Mixer(nn.Module):
             # copy new ssm state
             ssm_states[state_indices_p] = current_ssm_states
 
-        if num_decodes > 0:
+        if num_decodes > 0 and ssm_states.dtype in (xbc_d.dtype, torch.float32):
+            # Fused single-token path: the conv1d output feeds the scan update in registers and
+            # both states are written in-place, skipping two global round-trips per layer.
+            y = torch.ops.trtllm.mamba_conv1d_scan_update(
+                z_d,
+                xbc_d,
+                dt_d,
+                self.conv1d.weight,
+                self.conv1d.bias,
+                conv_states,
+                ssm_states,
+                self.A,
+                self.dt_bias,
+                self.D,
+                state_indices_d,
+                self.head_dim,
+                self.tp_ngroups,
+                self.delta_softplus,
+                PAD_SLOT_ID,
+            )
+            out.append(y)
+        elif num_decodes > 0:
             xbc_d = causal_conv1d_update(xbc_d,
                                          conv_states,
                                          self.conv1d.weight,
@@ -2667,8 +2667,13 @@ def softmax(input: Tensor, dim: Optional[int] = None) -> Tensor:
     return _create_tensor(layer.get_output(0), layer)
 
 
-def _lookup_plugin(input: Tensor, weight: Tensor, rank: int,
-                   per_token_scale: Tensor) -> Tensor:
+def _lookup_plugin(input: Tensor,
+                   weight: Tensor,
+                   rank: int,
+                   per_token_scale: Tensor,
+                   prompt_embedding_table: Optional[Tensor] = None,
+                   tasks: Optional[Tensor] = None,
+                   vocab_size: int = 0) -> Tensor:
     '''
     Add an operation to perform lookup in a tensor.
 
@@ -2677,6 +2682,11 @@ def _lookup_plugin(input: Tensor, weight: Tensor, rank: int,
     [inputs.size(0), cols] where the ith row corresponds to the input[i] row in
     the weight tensor.
 
+    When 'prompt_embedding_table' and 'tasks' are provided (together with a
+    non-zero 'vocab_size'), prompt-tuned virtual tokens (ids >= vocab_size) are
+    resolved from the prompt embedding table in the same kernel, so no second
+    gather and select over the hidden states is needed.
+
     It inserts a IPluginV2Layer.
 
     Parameters:
@@ -2689,6 +2699,20 @@ def _lookup_plugin(input: Tensor, weight: Tensor, rank: int,
         rank :  int
             The mpi rank.
 
+        per_token_scale : Tensor
+            The per-row dequantization scales when 'weight' is quantized.
+
+        prompt_embedding_table : Optional[Tensor]
+            The prompt-tuning table for virtual tokens, size
+            [num_tasks * num_tokens_per_task, hidden_size].
+
+        tasks : Optional[Tensor]
+            Per-token row offset of the owning task in
+            'prompt_embedding_table' (task id * num_tokens_per_task).
+
+        vocab_size : int
+            The first virtual-token id; 0 disables the fused prompt lookup.
+
     Returns:
         The output tensor of the lookup layer.
     '''
@@ -2696,19 +2720,27 @@ def _lookup_plugin(input: Tensor, weight: Tensor, rank: int,
         'Lookup', '1', TRT_LLM_PLUGIN_NAMESPACE)
     assert plg_creator is not None
 
-    p_dtype = per_token_scale.dtype
+    p_dtype = per_token_scale.dtype if per_token_scale is not None else weight.dtype
     pf_type = trt.PluginField("type_id", np.array([int(p_dtype)], np.int32),
                               trt.PluginFieldType.INT32)
 
     rank = trt.PluginField("rank", np.array([int(rank)], np.int32),
                            trt.PluginFieldType.INT32)
 
-    pfc = trt.PluginFieldCollection([pf_type, rank])
+    pf_vocab_size = trt.PluginField("vocab_size",
+                                    np.array([int(vocab_size)], np.int32),
+                                    trt.PluginFieldType.INT32)
+
+    pfc = trt.PluginFieldCollection([pf_type, rank, pf_vocab_size])
     lookup_plug = plg_creator.create_plugin("lookup", pfc)
     plug_inputs = [input.trt_tensor, weight.trt_tensor]
     if per_token_scale is not None:
         plug_inputs.append(per_token_scale.trt_tensor)
         weight.trt_tensor.set_dynamic_range(-127, 127)
+    if prompt_embedding_table is not None:
+        assert tasks is not None and vocab_size > 0
+        plug_inputs.append(prompt_embedding_table.trt_tensor)
+        plug_inputs.append(tasks.trt_tensor)
     layer = default_trtnet().add_plugin_v2(plug_inputs, lookup_plug)
     _add_plugin_info(layer, plg_creator, "lookup", pfc)
     return _create_tensor(layer.get_output(0), layer)
@@ -2721,7 +2753,10 @@ def embedding(input: Tensor,
               sharding_dim=0,
               tp_rank=None,
               per_token_scale=None,
-              padding=None) -> Tensor:
+              padding=None,
+              prompt_embedding_table=None,
+              tasks=None,
+              vocab_size=0) -> Tensor:
     '''
     Add an operation to perform embedding lookup.
 
@@ -2775,13 +2810,23 @@ def embedding(input: Tensor,
         padding: Tensor
             Additional padding added to the end of the embedding table before feeding into gather op.
 
+        prompt_embedding_table: Tensor
+            Optional prompt-tuning table; when given (with 'tasks' and a non-zero
+            'vocab_size'), virtual tokens are resolved in the same lookup kernel.
+
+        tasks: Tensor
+            Per-token row offset of the owning task in 'prompt_embedding_table'.
+
+        vocab_size: int
+            The first virtual-token id; only used with 'prompt_embedding_table'.
+
     Returns:
         The tensor produced by the embedding lookup layer.
     '''
 
-    # Per token scale is only supported by lookup plugin so if per_token_scale is not None, we must use lookup plugin
-    # Otherwise, we prefer to use ootb
-    use_lookup_plugin = per_token_scale is not None
+    # Per token scale and fused prompt tuning are only supported by the lookup plugin, so
+    # if either is requested we must use the lookup plugin. Otherwise, we prefer to use ootb
+    use_lookup_plugin = per_token_scale is not None or prompt_embedding_table is not None
 
     if padding is not None:
         padded_weight = concat([weight, padding], dim=0)
@@ -2796,7 +2841,8 @@ def embedding(input: Tensor,
                     "Rank cannot be none for tensor parallelism on vocab dim")
 
             if use_lookup_plugin:
-                x = _lookup_plugin(input, weight, tp_rank, per_token_scale)
+                x = _lookup_plugin(input, weight, tp_rank, per_token_scale,
+                                   prompt_embedding_table, tasks, vocab_size)
                 x = allreduce(x, tp_group)
             else:
                 shape_weight = shape(weight)
@@ -2843,7 +2889,10 @@ def embedding(input: Tensor,
             x = _lookup_plugin(input,
                                padded_weight,
                                rank=0,
-                               per_token_scale=per_token_scale)
+                               per_token_scale=per_token_scale,
+                               prompt_embedding_table=prompt_embedding_table,
+                               tasks=tasks,
+                               vocab_size=vocab_size)
         else:
             layer = default_trtnet().add_gather(padded_weight.trt_tensor,
                                                 input.trt_tensor, 0)
@@ -3883,6 +3932,7 @@ class AllReduceStrategy(IntEnum):
     LOWPRECISION = 6
     MNNVL = 7
     NCCL_SYMMETRIC = 8
+    HIERARCHICAL = 9
 
 
 class AllReduceFusionOp(IntEnum):
@@ -4355,9 +4405,11 @@ def gemm_allreduce(a: Tensor,
         b: Tensor
             Input tensor B
         a_sf: Optional[Tensor]
-            Input tensor for scaling input A
+            Input tensor for scaling input A. Block scale factors for FP4,
+            or float32 per-token dequant scales of shape [M] for rowwise FP8.
         b_sf: Optional[Tensor]
-            Input tensor for scaling input B
+            Input tensor for scaling input B. Block scale factors for FP4,
+            or float32 per-channel dequant scales of shape [N] for rowwise FP8.
         group: List[int]
             Ranks participating in collective
         transa: bool
@@ -4389,10 +4441,16 @@ def gemm_allreduce(a: Tensor,
     assert isinstance(b.dtype, trt.DataType)
 
     if fp8_inputs_override:
-        assert (
-            isinstance(alpha, np.ndarray) and alpha.dtype == np.float32
-            and alpha.size == 1
-        ), "`alpha` must be passed as a float32 ndarray if `fp8_inputs_override` is enabled for gemm_allreduce_plugin"
+        if a_sf is not None or b_sf is not None:
+            # rowwise quantization: per-token/per-channel dequant scales passed as tensors
+            assert (
+                a_sf is not None and b_sf is not None
+            ), "rowwise-scaled FP8 requires both `a_sf` and `b_sf` for gemm_allreduce_plugin"
+        else:
+            assert (
+                isinstance(alpha, np.ndarray) and alpha.dtype == np.float32
+                and alpha.size == 1
+            ), "`alpha` must be passed as a float32 ndarray if `fp8_inputs_override` is enabled for gemm_allreduce_plugin"
         assert a.dtype == trt.fp8
         assert b.dtype == trt.fp8
 
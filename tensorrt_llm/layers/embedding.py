@@ -161,6 +161,20 @@ class PromptTuningEmbedding(Embedding):
         Returns:
             Tokens' embedding
         """
+        if self.sharding_dim == 0:
+            # Fused path: the lookup plugin resolves both real-vocab and virtual tokens in a
+            # single gather, skipping the second embedding and the select over hidden states.
+            task_offsets = expand(tasks * task_vocab_size, shape(tokens))
+            return embedding(tokens,
+                             self.weight.value,
+                             tp_size=self.tp_size,
+                             tp_group=self.tp_group,
+                             sharding_dim=self.sharding_dim,
+                             tp_rank=self.tp_rank,
+                             prompt_embedding_table=prompt_embedding_table,
+                             tasks=task_offsets,
+                             vocab_size=self.vocab_size)
+
         # do not use ">=" because internally the layer works with floating points
         prompt_tokens_mask = tokens > (self.vocab_size - 1)
 
@@ -2513,7 +2513,7 @@ class TorchLlmArgs(BaseLlmArgs):
     allreduce_strategy: Optional[Literal[
         'AUTO', 'NCCL', 'UB', 'MINLATENCY', 'ONESHOT', 'TWOSHOT',
         'LOWPRECISION', 'MNNVL',
-        'NCCL_SYMMETRIC']] = Field(default='AUTO',
+        'NCCL_SYMMETRIC', 'HIERARCHICAL']] = Field(default='AUTO',
                                    description="Allreduce strategy to use.",
                                    status="beta")
     checkpoint_loader: Optional[object] = Field(
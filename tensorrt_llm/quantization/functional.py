@@ -701,7 +701,10 @@ def fused_layernorm(
         scale: Optional[Tensor] = None,
         eps: float = 1e-05,
         p_dtype: str = 'float16',
-        need_fp32_output: bool = False) -> Tensor:
+        need_fp32_output: bool = False,
+        softcap_scale: float = 0.0,
+        post_norm: bool = False,
+        post_scale: float = 1.0) -> Tensor:
     plg_creator = trt.get_plugin_registry().get_plugin_creator(
         'FusedLayernorm', '1', TRT_LLM_PLUGIN_NAMESPACE)
     assert plg_creator is not None
@@ -718,8 +721,23 @@ def fused_layernorm(
     need_quantize = trt.PluginField(
         "need_quantize", np.array([int(need_quantize_value)], np.int32),
         trt.PluginFieldType.INT32)
-    pfc = trt.PluginFieldCollection(
-        [eps, need_fp32_output, need_quantize, pf_type])
+    # Fused epilogue stages (Gemma-2 post-norm / soft-capping, DeepSeek norm-scale); the
+    # defaults keep every stage disabled. Not supported together with quantization.
+    assert not (need_quantize_value and
+                (softcap_scale != 0.0 or post_norm or post_scale != 1.0))
+    softcap_scale = trt.PluginField("softcap_scale",
+                                    np.array(softcap_scale, dtype=np.float32),
+                                    trt.PluginFieldType.FLOAT32)
+    post_norm = trt.PluginField("post_norm", np.array([int(post_norm)],
+                                                      np.int32),
+                                trt.PluginFieldType.INT32)
+    post_scale = trt.PluginField("post_scale",
+                                 np.array(post_scale, dtype=np.float32),
+                                 trt.PluginFieldType.FLOAT32)
+    pfc = trt.PluginFieldCollection([
+        eps, need_fp32_output, need_quantize, softcap_scale, post_norm,
+        post_scale, pf_type
+    ])
     fused_layernorm_plug = plg_creator.create_plugin("fused_layernorm", pfc)
     normalized_shape = [normalized_shape] if isinstance(
         normalized_shape, int) else normalized_shape
@@ -99,6 +99,69 @@ def test_fp8_quantize_blackwell(dtype, m, k):
                                rtol=1e-1)
 
 
+@pytest.mark.skipif(
+    getSMVersion() != 100 and getSMVersion() != 90,
+    reason="Only test on Blackwell and Hopper",
+)
+@pytest.mark.parametrize("k", [576, 256, 32])
+@pytest.mark.parametrize(
+    "m",
+    [4, 16, 256],
+)
+def test_fp8_dequant_quantize(m, k):
+    torch.random.manual_seed(0)
+    # TODO: make sure there is no padding for now
+    assert m % 4 == 0, "Disable padding for now"
+    a = torch.randn((m, k), device='cuda', dtype=torch.bfloat16)
+
+    # Per-tensor FP8 input, as produced by the fused FP8 attention output path.
+    global_scale = (a.float().abs().max() / 448.0).clamp(min=1e-6)
+    a_fp8 = (a.float() / global_scale).to(torch.float8_e4m3fn)
+    a_ref = a_fp8.to(torch.float32) * global_scale
+
+    fp8_a, fp8_a_scale = torch.ops.trtllm.fp8_dequant_quantize_1x128(
+        a_fp8, global_scale)
+    fp8_a_scale = fp8_a_scale.view(-1,
+                                   fp8_a.shape[0])  # transpose the scale view
+    a_dequant = _dequant_fp8(fp8_a, fp8_a_scale, True, False, True)
+
+    torch.testing.assert_close(a_dequant.cpu().to(torch.float32),
+                               a_ref.cpu(),
+                               atol=1e-1,
+                               rtol=1e-1)
+
+
+@pytest.mark.skipif(
+    getSMVersion() != 100 and getSMVersion() != 90,
+    reason="Only test on Blackwell and Hopper",
+)
+@pytest.mark.parametrize("k", [576, 256, 32])
+@pytest.mark.parametrize(
+    "m",
+    [4, 16, 256],
+)
+def test_silu_and_mul_quantize(m, k):
+    torch.random.manual_seed(0)
+    # TODO: make sure there is no padding for now
+    assert m % 4 == 0, "Disable padding for now"
+    a = torch.randn((m, 2 * k), device='cuda', dtype=torch.bfloat16)
+
+    # Linear half first, gate half second, as produced by the gated MoE GEMM1.
+    linear, gate = a.chunk(2, dim=-1)
+    a_ref = (torch.nn.functional.silu(gate.float()) *
+             linear.float()).to(torch.bfloat16)
+
+    fp8_a, fp8_a_scale = torch.ops.trtllm.silu_and_mul_quantize_1x128(a)
+    fp8_a_scale = fp8_a_scale.view(-1,
+                                   fp8_a.shape[0])  # transpose the scale view
+    a_dequant = _dequant_fp8(fp8_a, fp8_a_scale, True, False, True)
+
+    torch.testing.assert_close(a_dequant.cpu().to(torch.float32),
+                               a_ref.cpu().to(torch.float32),
+                               atol=1e-1,
+                               rtol=1e-1)
+
+
 def mxfp8_quantize_check_accuracy(a, b, atol, rtol, percent):
     if torch.any(torch.isnan(a)):
         raise Exception("NaN in a")
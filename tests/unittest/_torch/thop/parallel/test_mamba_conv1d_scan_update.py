@@ -0,0 +1,136 @@
+# SPDX-FileCopyrightText: Copyright (c) 2022-2024 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+from itertools import product
+
+import pytest
+import torch
+from einops import rearrange, repeat
+
+from tensorrt_llm._torch.modules.mamba.causal_conv1d import \
+    causal_conv1d_update
+from tensorrt_llm._torch.modules.mamba.selective_state_update import \
+    selective_state_update
+from tensorrt_llm._utils import str_dtype_to_torch
+
+
+@pytest.mark.parametrize(
+    "dim, headdim, ngroups, dstate, dconv, batch_size, dtype, ssm_dtype",
+    # dim / headdim parametrization
+    list(
+        product([1024, 2048], [32, 64], [1], [128], [4], [3], ['bfloat16'],
+                ['same'])) +
+    # ngroups / dstate parametrization
+    list(
+        product([2048], [64], [1, 4], [64, 128], [4], [3], ['bfloat16'],
+                ['same'])) +
+    # conv width parametrization
+    list(product([2048], [64], [1], [128], [2, 3], [3], ['bfloat16'], ['same']))
+    +
+    # dtype parametrization, including a float32 ssm state cache
+    list(
+        product([2048], [64], [1], [128], [4], [3],
+                ['float16', 'bfloat16', 'float32'], ['same', 'float32'])) +
+    # batch_size parametrization
+    list(
+        product([2048], [64], [1], [128], [4], [1, 8, 16], ['bfloat16'],
+                ['same'])),
+)
+def test_mamba_conv1d_scan_update(dim, headdim, ngroups, dstate, dconv,
+                                  batch_size, dtype, ssm_dtype):
+    # configs
+    device = "cuda"
+    nheads = dim // headdim
+    conv_dim = dim + 2 * ngroups * dstate
+    d_in_proj = 2 * dim + 2 * ngroups * dstate + nheads
+    delta_softplus = True
+    std_dev = 0.5 if dtype == "float32" else 0.1
+
+    torch_dtype = str_dtype_to_torch(dtype)
+    ssm_torch_dtype = torch_dtype if ssm_dtype == 'same' else torch.float32
+
+    # test data
+    torch.random.manual_seed(0)
+    zxbcdt = torch.empty(batch_size, d_in_proj, device=device,
+                         dtype=torch_dtype).normal_(0.0, std_dev)
+    z, xbc, dt = torch.split(zxbcdt, [dim, conv_dim, nheads], dim=-1)
+    conv_weight = torch.empty(conv_dim, dconv, device=device,
+                              dtype=torch_dtype).normal_(0.0, std_dev)
+    conv_bias = torch.empty(conv_dim, device=device,
+                            dtype=torch_dtype).normal_(0.0, std_dev)
+    A = -torch.rand(nheads, device=device, dtype=torch.float32) - 1.0
+    dt_bias = torch.rand(nheads, device=device, dtype=torch.float32)
+    D = torch.rand(nheads, device=device, dtype=torch.float32)
+
+    # states live in shuffled slots of a larger cache
+    num_slots = batch_size + 4
+    state_indices = torch.randperm(num_slots,
+                                   device=device)[:batch_size].to(torch.int32)
+    conv_state = torch.empty(num_slots,
+                             conv_dim,
+                             dconv - 1,
+                             device=device,
+                             dtype=torch_dtype).normal_(0.0, std_dev)
+    ssm_state = torch.empty(num_slots,
+                            nheads,
+                            headdim,
+                            dstate,
+                            device=device,
+                            dtype=ssm_torch_dtype).normal_(0.0, std_dev)
+    conv_state_ref = conv_state.detach().clone()
+    ssm_state_ref = ssm_state.detach().clone()
+
+    # fused kernel
+    out = torch.ops.trtllm.mamba_conv1d_scan_update(z, xbc, dt, conv_weight,
+                                                    conv_bias, conv_state,
+                                                    ssm_state, A, dt_bias, D,
+                                                    state_indices, headdim,
+                                                    ngroups, delta_softplus, -1)
+
+    # reference: separate conv update and scan update
+    xbc_ref = causal_conv1d_update(xbc.detach().clone(),
+                                   conv_state_ref,
+                                   conv_weight,
+                                   conv_bias,
+                                   activation="silu",
+                                   conv_state_indices=state_indices)
+    x_ref, B_ref, C_ref = torch.split(
+        xbc_ref, [dim, ngroups * dstate, ngroups * dstate], dim=-1)
+    y_ref = selective_state_update(
+        ssm_state_ref,
+        rearrange(x_ref, "b (h p) -> b h p", p=headdim),
+        repeat(dt, "b h -> b h p", p=headdim),
+        repeat(A, "h -> h p n", p=headdim, n=dstate),
+        rearrange(B_ref, "b (g n) -> b g n", g=ngroups),
+        rearrange(C_ref, "b (g n) -> b g n", g=ngroups),
+        repeat(D, "h -> h p", p=headdim),
+        z=rearrange(z, "b (h p) -> b h p", p=headdim),
+        dt_bias=repeat(dt_bias, "h -> h p", p=headdim),
+        dt_softplus=delta_softplus,
+        state_batch_indices=state_indices,
+    )
+    out_ref = rearrange(y_ref, "b h p -> b (h p)")
+
+    atol = {"float16": 2e-2, "float32": 1e-2, "bfloat16": 1e-1}
+
+    torch.testing.assert_close(out, out_ref, rtol=1e-2, atol=atol[dtype])
+    torch.testing.assert_close(conv_state,
+                               conv_state_ref,
+                               rtol=1e-2,
+                               atol=atol[dtype])
+    torch.testing.assert_close(ssm_state,
+                               ssm_state_ref,
+                               rtol=1e-2,
+                               atol=atol[dtype])